@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// CPU profiling scopes and counters with Chrome Trace Event export.
+///
+/// Profiling points are added with the DILIGENT_PROFILE_SCOPE(), DILIGENT_PROFILE_FUNCTION() and
+/// DILIGENT_PROFILE_COUNTER() macros. The macros are compiled out unless DILIGENT_CPU_PROFILER is
+/// defined to a non-zero value (see DILIGENT_ENABLE_CPU_PROFILER CMake option). When compiled in,
+/// recording can be toggled at run time with CPUProfiler::SetEnabled().
+///
+/// Every thread records events into its own buffer that is only appended to, so recording does
+/// not take locks. The recorded events can be written to a file with CPUProfiler::WriteChromeTrace()
+/// and opened in chrome://tracing or https://ui.perfetto.dev.
+
+#include <chrono>
+#include <atomic>
+#include <string>
+
+#include "../../Primitives/interface/BasicTypes.h"
+
+// The processor time stamp counter is read much faster than the steady clock
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#    define DILIGENT_CPU_PROFILER_USE_TSC 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#    include <x86intrin.h>
+#    define DILIGENT_CPU_PROFILER_USE_TSC 1
+#else
+#    define DILIGENT_CPU_PROFILER_USE_TSC 0
+#endif
+
+namespace Diligent
+{
+
+namespace CPUProfiler
+{
+
+namespace Internal
+{
+
+extern std::atomic<bool> g_Enabled;
+
+} // namespace Internal
+
+/// Enables or disables recording. Recording is disabled by default.
+void SetEnabled(bool Enabled);
+
+/// Returns true if recording is enabled.
+inline bool IsEnabled()
+{
+    return Internal::g_Enabled.load(std::memory_order_relaxed);
+}
+
+/// Returns the current profiler timestamp.
+
+/// \remarks   On x86 and x64, the timestamp is the processor time stamp counter value that is
+///             converted to nanoseconds when the trace is written. On other platforms, it is
+///             the steady clock time in nanoseconds.
+inline Uint64 GetTimestamp()
+{
+#if DILIGENT_CPU_PROFILER_USE_TSC
+    return static_cast<Uint64>(__rdtsc());
+#else
+    return static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/// Records a scope that started at StartTime and ended at EndTime on the calling thread.
+
+/// \param Name      - Scope name. The string is not copied and must stay valid
+///                    until the trace is written. String literals are expected.
+/// \param StartTime - Start timestamp returned by GetTimestamp().
+/// \param EndTime   - End timestamp returned by GetTimestamp().
+void RecordScope(const char* Name, Uint64 StartTime, Uint64 EndTime);
+
+/// Records the value of the named counter at the current time.
+
+/// \param Name  - Counter name. The string is not copied and must stay valid
+///                until the trace is written. String literals are expected.
+/// \param Value - Counter value.
+void RecordCounter(const char* Name, Int64 Value);
+
+/// Sets the name of the calling thread displayed in the trace.
+void SetCurrentThreadName(const char* Name);
+
+/// Sets the maximum number of events recorded by every thread since the last call to Reset().
+/// Events that exceed the limit are dropped. The default limit is 1048576 events.
+void SetMaxEventsPerThread(size_t MaxEvents);
+
+/// Returns the total number of recorded events that have not been discarded by Reset().
+size_t GetEventCount();
+
+/// Returns the number of events dropped because a thread exceeded the event limit.
+size_t GetDroppedEventCount();
+
+/// Discards all events recorded so far.
+
+/// \remarks    The memory of the discarded events is kept and reused when the thread records
+///             new events. The memory that has not been reused by the next call is released.
+///             The buffers of the threads that have exited are released as well.
+void Reset();
+
+/// Returns the recorded events in Chrome Trace Event JSON format.
+
+/// \remarks    The function may be called while other threads record events. Events
+///             that are recorded concurrently may or may not be included.
+std::string GetChromeTrace();
+
+/// Writes the recorded events to the file in Chrome Trace Event JSON format.
+bool WriteChromeTrace(const char* FilePath);
+
+
+/// Records a scope from the constructor to the destructor of the object.
+class ScopedEvent
+{
+public:
+    explicit ScopedEvent(const char* Name) :
+        m_Name{IsEnabled() ? Name : nullptr},
+        m_StartTime{m_Name != nullptr ? GetTimestamp() : 0}
+    {}
+
+    ~ScopedEvent()
+    {
+        if (m_Name != nullptr)
+            RecordScope(m_Name, m_StartTime, GetTimestamp());
+    }
+
+    // clang-format off
+    ScopedEvent           (const ScopedEvent&) = delete;
+    ScopedEvent& operator=(const ScopedEvent&) = delete;
+    // clang-format on
+
+private:
+    const char* const m_Name;
+    const Uint64      m_StartTime;
+};
+
+} // namespace CPUProfiler
+
+} // namespace Diligent
+
+#define DILIGENT_PROFILE_CONCAT_IMPL(a, b) a##b
+#define DILIGENT_PROFILE_CONCAT(a, b)      DILIGENT_PROFILE_CONCAT_IMPL(a, b)
+
+#if defined(DILIGENT_CPU_PROFILER) && DILIGENT_CPU_PROFILER
+
+/// Records the named scope until the end of the enclosing block.
+#    define DILIGENT_PROFILE_SCOPE(Name) ::Diligent::CPUProfiler::ScopedEvent DILIGENT_PROFILE_CONCAT(_ProfileScope, __LINE__)(Name)
+
+/// Records the enclosing function scope.
+#    define DILIGENT_PROFILE_FUNCTION() DILIGENT_PROFILE_SCOPE(__FUNCTION__)
+
+/// Records the value of the named counter.
+#    define DILIGENT_PROFILE_COUNTER(Name, Value)                                                    \
+        do                                                                                          \
+        {                                                                                           \
+            if (::Diligent::CPUProfiler::IsEnabled())                                               \
+                ::Diligent::CPUProfiler::RecordCounter(Name, static_cast<::Diligent::Int64>(Value)); \
+        } while (false)
+
+#else
+
+#    define DILIGENT_PROFILE_SCOPE(Name) \
+        do                               \
+        {                                \
+        } while (false)
+#    define DILIGENT_PROFILE_FUNCTION() \
+        do                              \
+        {                               \
+        } while (false)
+#    define DILIGENT_PROFILE_COUNTER(Name, Value) \
+        do                                        \
+        {                                         \
+        } while (false)
+
+#endif
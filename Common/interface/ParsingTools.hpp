@@ -574,6 +574,8 @@ std::string GetContext(const IteratorType& Start, const IteratorType& End, Itera
 ///                            be created.
 /// \param [in] GetTokenType - a function that should return the token type
 ///                            for the given literal.
+/// \param [in] Tokens       - an empty container to add the tokens to. This allows
+///                            using a container with a custom allocator.
 /// \return     Tokenized representation of the source string
 ///
 /// \remarks    In case of a parsing error, the function throws std::runtime_error.
@@ -585,11 +587,12 @@ template <typename TokenClass,
 ContainerType Tokenize(const IteratorType&   SourceStart,
                        const IteratorType&   SourceEnd,
                        CreateTokenFuncType   CreateToken,
-                       GetTokenTypeFunctType GetTokenType) noexcept(false)
+                       GetTokenTypeFunctType GetTokenType,
+                       ContainerType         Tokens = {}) noexcept(false)
 {
     using TokenType = typename TokenClass::TokenType;
 
-    ContainerType Tokens;
+    VERIFY(Tokens.empty(), "Token container must be empty");
     // Push empty node in the beginning of the list to facilitate
     // backwards searching
     Tokens.emplace_back(TokenClass{});
@@ -43,6 +43,7 @@
 #include <new>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -58,8 +59,11 @@ namespace Diligent
 ///
 /// The cache owns only weak references. A cached object may expire when all
 /// external strong references are released; the key remains in the map until
-/// the object is replaced by a later GetOrCreate() call or explicitly removed
-/// by EraseIfExpired().
+/// the object is replaced by a later GetOrCreate() or Set() call, or the entry
+/// is removed by Get(), EraseIfExpired(), EraseExpired() or Clear().
+///
+/// Objects that are created outside of the cache can be published with Set()
+/// and looked up with Get(), which never waits for in-flight creations.
 ///
 /// Example:
 ///
@@ -513,6 +517,152 @@ public:
         }
     }
 
+    /// Returns a live object for the key, or null if there is none.
+    ///
+    /// Unlike GetOrCreate(), the method never invokes a factory and never waits
+    /// for an in-flight creation. If the key references an expired object and
+    /// no other thread is using the entry, the entry is erased.
+    ///
+    /// If the key is null or empty, the method logs an error and returns null.
+    RefCntAutoPtr<InterfaceType> Get(const Char* CacheKey)
+    {
+        if (CacheKey == nullptr || CacheKey[0] == '\0')
+        {
+            LOG_ERROR_MESSAGE("WeakObjectCache key must not be null or empty");
+            return {};
+        }
+
+        const HashMapStringKey       Key{CacheKey};
+        Shard&                       CacheShard = GetShard(Key.GetHash());
+        std::shared_ptr<ObjectEntry> pEntry;
+
+        {
+            std::shared_lock<Threading::SharedMutex> Lock{CacheShard.Mutex};
+
+            const auto It = CacheShard.Objects.find(Key);
+            if (It == CacheShard.Objects.end())
+                return {};
+
+            pEntry = It->second;
+        }
+
+        if (RefCntAutoPtr<InterfaceType> pObject = pEntry->Lock())
+            return pObject;
+
+        // Release our reference so that EraseIfExpired() sees the map as the only owner.
+        pEntry.reset();
+        EraseIfExpired(CacheKey);
+
+        return {};
+    }
+
+    /// Stores an object that was created outside of the cache.
+    ///
+    /// If the key already references a live object, the cache is not modified
+    /// and the existing object is returned. Otherwise, pObject is stored as a
+    /// weak reference and returned. Callers that race to publish objects for
+    /// the same key should use the returned object so that all of them end up
+    /// with the same instance.
+    ///
+    /// The method does not wait for in-flight GetOrCreate() calls for the same
+    /// key; the object published last replaces the weak reference.
+    ///
+    /// If the key is null or empty, or pObject is null, the method logs an
+    /// error and returns null.
+    RefCntAutoPtr<InterfaceType> Set(const Char* CacheKey, InterfaceType* pObject)
+    {
+        if (CacheKey == nullptr || CacheKey[0] == '\0')
+        {
+            LOG_ERROR_MESSAGE("WeakObjectCache key must not be null or empty");
+            return {};
+        }
+        if (pObject == nullptr)
+        {
+            LOG_ERROR_MESSAGE("Object for cache key '", CacheKey, "' must not be null");
+            return {};
+        }
+
+        const HashMapStringKey Key{CacheKey};
+        Shard&                 CacheShard = GetShard(Key.GetHash());
+
+        // Allocate outside the shard lock, see GetOrCreate().
+        std::shared_ptr<ObjectEntry> pNewEntry = std::make_shared<ObjectEntry>();
+
+        RefCntAutoPtr<InterfaceType> pExisting;
+        {
+            // The live-object check and the update are done under the exclusive
+            // shard lock, so that concurrent Set() calls for the same key
+            // agree on a single object.
+            std::unique_lock<Threading::SharedMutex> Lock{CacheShard.Mutex};
+
+            auto It = CacheShard.Objects.find(Key);
+            if (It == CacheShard.Objects.end())
+            {
+                bool Inserted = false;
+                std::tie(It, Inserted) = CacheShard.Objects.emplace(HashMapStringKey{CacheKey, true}, std::move(pNewEntry));
+                VERIFY_EXPR(Inserted);
+                if (Inserted)
+                    m_Size.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                pExisting = It->second->Lock();
+            }
+
+            if (!pExisting)
+                It->second->Set(pObject);
+        }
+
+        return pExisting ? std::move(pExisting) : RefCntAutoPtr<InterfaceType>{pObject};
+    }
+
+    /// Returns strong references to all live objects in the cache.
+    ///
+    /// The objects are collected shard by shard, so the result is not a
+    /// consistent snapshot under concurrent modification. The returned
+    /// references keep the objects alive, which allows the caller to work
+    /// with them without holding any cache lock.
+    std::vector<RefCntAutoPtr<InterfaceType>> GetLiveObjects() const
+    {
+        std::vector<RefCntAutoPtr<InterfaceType>> LiveObjects;
+        LiveObjects.reserve(Size());
+
+        for (size_t ShardIdx = 0; ShardIdx < m_ShardCount; ++ShardIdx)
+        {
+            const Shard& CacheShard = m_Shards[ShardIdx];
+
+            std::shared_lock<Threading::SharedMutex> Lock{CacheShard.Mutex};
+            for (const auto& It : CacheShard.Objects)
+            {
+                if (RefCntAutoPtr<InterfaceType> pObject = It.second->Lock())
+                    LiveObjects.emplace_back(std::move(pObject));
+            }
+        }
+
+        return LiveObjects;
+    }
+
+    /// Removes all entries from the cache.
+    ///
+    /// In-flight GetOrCreate() calls are not interrupted: they complete and
+    /// return their objects, but the objects are no longer reachable through
+    /// the cache.
+    void Clear()
+    {
+        ObjectMapType RemovedObjects;
+        for (size_t ShardIdx = 0; ShardIdx < m_ShardCount; ++ShardIdx)
+        {
+            Shard& CacheShard = m_Shards[ShardIdx];
+            {
+                std::unique_lock<Threading::SharedMutex> Lock{CacheShard.Mutex};
+                m_Size.fetch_sub(CacheShard.Objects.size(), std::memory_order_relaxed);
+                RemovedObjects.swap(CacheShard.Objects);
+            }
+            // Destroy the entries outside the shard lock, see EraseExpired().
+            RemovedObjects.clear();
+        }
+    }
+
     /// Removes the key if it exists and no live object or in-flight operation
     /// is associated with it.
     ///
@@ -633,7 +783,7 @@ private:
         return ThreadCount != 0 ? static_cast<size_t>(ThreadCount) : size_t{1};
     }
 
-    Shard& GetShard(size_t Hash)
+    Shard& GetShard(size_t Hash) const
     {
         VERIFY_EXPR(m_ShardCount > 0);
         return m_Shards[Hash % m_ShardCount];
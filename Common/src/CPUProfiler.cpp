@@ -0,0 +1,555 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "CPUProfiler.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <iomanip>
+
+#include "FileWrapper.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace CPUProfiler
+{
+
+namespace Internal
+{
+
+std::atomic<bool> g_Enabled{false};
+
+} // namespace Internal
+
+namespace
+{
+
+enum class EventType : Uint8
+{
+    Scope,
+    Counter
+};
+
+struct Event
+{
+    const char* Name;
+    Uint64      Timestamp;
+    // Duration of the scope, or the counter value
+    Uint64    Data;
+    EventType Type;
+};
+
+constexpr size_t EventsPerBlock = 4096;
+
+struct EventBlock
+{
+    Event                    Events[EventsPerBlock];
+    std::atomic<EventBlock*> pNext{nullptr};
+};
+
+// Frees the list of blocks linked by pNext
+void DeleteBlockList(EventBlock* pBlock)
+{
+    while (pBlock != nullptr)
+    {
+        EventBlock* pNext = pBlock->pNext.load(std::memory_order_relaxed);
+        delete pBlock;
+        pBlock = pNext;
+    }
+}
+
+// Events recorded by a single thread. Only the owning thread adds events. Other threads
+// may read the events that have been published by the atomic event count at any time.
+// Blocks whose events have all been discarded by Reset() become spare blocks that the
+// owning thread reuses, so that a thread that records a similar number of events every
+// frame does not touch fresh memory. Spare blocks not reused until the next Reset() are released.
+class ThreadEventBuffer
+{
+public:
+    explicit ThreadEventBuffer(Uint32 ThreadId) :
+        m_ThreadId{ThreadId},
+        m_pHead{std::make_unique<EventBlock>()},
+        m_pTail{m_pHead.get()}
+    {}
+
+    ~ThreadEventBuffer()
+    {
+        DeleteBlockList(m_pHead->pNext.load(std::memory_order_relaxed));
+        DeleteBlockList(m_pSpareBlocks.load(std::memory_order_relaxed));
+        DeleteBlockList(m_pWriterSpareBlocks);
+    }
+
+    void Add(const Event& Evt, size_t MaxEvents)
+    {
+        const size_t Count = m_Count.load(std::memory_order_relaxed);
+        // The limit applies to the events that have not been discarded by Reset()
+        if (Count - m_ReadStart.load(std::memory_order_relaxed) >= MaxEvents)
+        {
+            m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        const size_t Idx = Count % EventsPerBlock;
+        if (Idx == 0 && Count != 0)
+            AddBlock();
+        m_pTail->Events[Idx] = Evt;
+
+        // Publish the event to the readers
+        m_Count.store(Count + 1, std::memory_order_release);
+    }
+
+    // Discards the events before ReadStart and releases the blocks that only contain discarded events.
+    // Must be called with the registry mutex locked.
+    void Discard(size_t ReadStart)
+    {
+        VERIFY_EXPR(ReadStart >= m_ReadStart.load(std::memory_order_relaxed) && ReadStart <= GetCount());
+        m_ReadStart.store(ReadStart, std::memory_order_relaxed);
+
+        EventBlock* pDrainedBlocks = nullptr;
+
+        while (m_HeadStart + EventsPerBlock <= ReadStart)
+        {
+            // The block that has no next block is the tail that is still owned by the recording thread
+            EventBlock* pNext = m_pHead->pNext.load(std::memory_order_acquire);
+            if (pNext == nullptr)
+                break;
+
+            std::unique_ptr<EventBlock> pDrained{m_pHead.release()};
+            m_pHead.reset(pNext);
+            m_HeadStart += EventsPerBlock;
+
+            pDrained->pNext.store(pDrainedBlocks, std::memory_order_relaxed);
+            pDrainedBlocks = pDrained.release();
+        }
+
+        // The spare blocks that the owning thread has not taken since the previous
+        // call are not needed and are replaced with the blocks drained now.
+        DeleteBlockList(m_pSpareBlocks.exchange(pDrainedBlocks, std::memory_order_acq_rel));
+    }
+
+    // Must be called with the registry mutex locked.
+    template <typename HandlerType>
+    void ProcessEvents(size_t Start, size_t End, HandlerType&& Handler) const
+    {
+        VERIFY_EXPR(Start >= m_HeadStart);
+        const EventBlock* pBlock = m_pHead.get();
+        for (size_t i = m_HeadStart; i + EventsPerBlock <= Start; i += EventsPerBlock)
+            pBlock = pBlock->pNext.load(std::memory_order_acquire);
+
+        for (size_t i = Start; i < End; ++i)
+        {
+            const size_t Idx = i % EventsPerBlock;
+            if (Idx == 0 && i != Start)
+                pBlock = pBlock->pNext.load(std::memory_order_acquire);
+            Handler(pBlock->Events[Idx]);
+        }
+    }
+
+    size_t GetCount() const
+    {
+        return m_Count.load(std::memory_order_acquire);
+    }
+
+    size_t GetReadStart() const
+    {
+        return m_ReadStart.load(std::memory_order_relaxed);
+    }
+
+    size_t GetDroppedCount() const
+    {
+        return m_DroppedCount.load(std::memory_order_relaxed);
+    }
+
+    Uint32 GetThreadId() const
+    {
+        return m_ThreadId;
+    }
+
+    // Called by the owning thread when it exits
+    void SetThreadExited()
+    {
+        m_ThreadExited.store(true, std::memory_order_release);
+    }
+
+    // Returns true if the owning thread has exited and all its events have been discarded.
+    // Must be called with the registry mutex locked.
+    bool CanBeReleased() const
+    {
+        return m_ThreadExited.load(std::memory_order_acquire) && GetReadStart() == GetCount();
+    }
+
+    // Protected by the registry mutex
+    std::string Name;
+    size_t      DroppedStart = 0;
+
+private:
+    void AddBlock()
+    {
+        if (m_pWriterSpareBlocks == nullptr)
+        {
+            // Take all blocks drained by the last Reset() at once. The list is only
+            // modified by Discard() with an atomic exchange, so it can't change under us.
+            m_pWriterSpareBlocks = m_pSpareBlocks.exchange(nullptr, std::memory_order_acquire);
+        }
+
+        EventBlock* pNewBlock = m_pWriterSpareBlocks;
+        if (pNewBlock != nullptr)
+        {
+            m_pWriterSpareBlocks = pNewBlock->pNext.load(std::memory_order_relaxed);
+            pNewBlock->pNext.store(nullptr, std::memory_order_relaxed);
+        }
+        else
+        {
+            // Events are not value-initialized to avoid touching the whole block up front
+            pNewBlock = new EventBlock;
+        }
+        m_pTail->pNext.store(pNewBlock, std::memory_order_release);
+        m_pTail = pNewBlock;
+    }
+
+private:
+    const Uint32        m_ThreadId;
+    std::atomic<size_t> m_Count{0};
+    std::atomic<size_t> m_DroppedCount{0};
+    // Index of the first event that has not been discarded. Written with the registry mutex locked.
+    std::atomic<size_t> m_ReadStart{0};
+
+    // Reader side, protected by the registry mutex
+    std::unique_ptr<EventBlock> m_pHead;
+    size_t                      m_HeadStart = 0;
+
+    // Writer side
+    EventBlock* m_pTail;
+    // Spare blocks taken by the owning thread
+    EventBlock* m_pWriterSpareBlocks = nullptr;
+
+    // Blocks drained by the last Reset()
+    std::atomic<EventBlock*> m_pSpareBlocks{nullptr};
+
+    std::atomic<bool> m_ThreadExited{false};
+};
+
+Uint64 GetSteadyClockTime()
+{
+    return static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+struct ClockSample
+{
+    // Steady clock time, in nanoseconds
+    Uint64 Time = 0;
+    // Profiler timestamp
+    Uint64 Ticks = 0;
+};
+
+// Reads the steady clock and the profiler timestamp at the same moment
+ClockSample SampleClocks()
+{
+#if DILIGENT_CPU_PROFILER_USE_TSC
+    // The steady clock is read between two time stamp counter reads. The sample with the
+    // shortest read interval is the most accurate, and its midpoint is used.
+    ClockSample Sample;
+    Uint64      MinInterval = ~Uint64{0};
+    for (int i = 0; i < 5; ++i)
+    {
+        const Uint64 Ticks0 = GetTimestamp();
+        const Uint64 Time   = GetSteadyClockTime();
+        const Uint64 Ticks1 = GetTimestamp();
+        if (Ticks1 - Ticks0 < MinInterval)
+        {
+            MinInterval  = Ticks1 - Ticks0;
+            Sample.Time  = Time;
+            Sample.Ticks = Ticks0 + (Ticks1 - Ticks0) / 2;
+        }
+    }
+    return Sample;
+#else
+    const Uint64 Time = GetSteadyClockTime();
+    return {Time, Time};
+#endif
+}
+
+struct Registry
+{
+    std::mutex Mtx;
+
+    std::vector<std::unique_ptr<ThreadEventBuffer>> Buffers;
+
+    // Thread ids are not reused when the buffers of exited threads are released
+    Uint32 NextThreadId = 1;
+
+    std::atomic<size_t> MaxEventsPerThread{size_t{1} << 20};
+
+    // Steady clock time in nanoseconds and the profiler timestamp at the same moment
+    const ClockSample Start = SampleClocks();
+};
+
+Registry& GetRegistry()
+{
+    static Registry TheRegistry;
+    return TheRegistry;
+}
+
+// Notifies the thread buffer that its thread has exited
+struct ThreadExitNotifier
+{
+    ThreadEventBuffer* pBuffer = nullptr;
+
+    ~ThreadExitNotifier()
+    {
+        if (pBuffer != nullptr)
+            pBuffer->SetThreadExited();
+    }
+};
+
+ThreadEventBuffer& GetThreadBuffer()
+{
+    // Buffers are owned by the registry and outlive the threads so that their events can still be written.
+    // The buffer of an exited thread is released by the first Reset() that discards all its events.
+    thread_local ThreadEventBuffer* pThreadBuffer = nullptr;
+    if (pThreadBuffer == nullptr)
+    {
+        Registry& Reg = GetRegistry();
+        {
+            std::lock_guard<std::mutex> Lock{Reg.Mtx};
+            Reg.Buffers.emplace_back(std::make_unique<ThreadEventBuffer>(Reg.NextThreadId++));
+            pThreadBuffer = Reg.Buffers.back().get();
+        }
+
+        // The notifier is only constructed here, so that the fast path above
+        // accesses a trivial thread-local variable.
+        thread_local ThreadExitNotifier ExitNotifier;
+        ExitNotifier.pBuffer = pThreadBuffer;
+    }
+    return *pThreadBuffer;
+}
+
+// Returns the number of nanoseconds per profiler timestamp tick
+double GetNanosecondsPerTick(const Registry& Reg)
+{
+#if DILIGENT_CPU_PROFILER_USE_TSC
+    // The time stamp counter frequency is measured against the steady clock over the time
+    // elapsed since the registry was created. The error of a clock sample is a few tens of
+    // nanoseconds, so the error of a converted timestamp does not exceed that either, no
+    // matter how short the calibration interval is. No waiting is needed.
+    const ClockSample Now = SampleClocks();
+    return Now.Ticks > Reg.Start.Ticks && Now.Time > Reg.Start.Time ?
+        static_cast<double>(Now.Time - Reg.Start.Time) / static_cast<double>(Now.Ticks - Reg.Start.Ticks) :
+        1.0;
+#else
+    (void)Reg;
+    return 1.0;
+#endif
+}
+
+void WriteJSONString(std::ostream& os, const char* Str)
+{
+    os << '"';
+    for (const char* c = Str != nullptr ? Str : ""; *c != '\0'; ++c)
+    {
+        switch (*c)
+        {
+            case '"': os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20)
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(*c) << std::dec << std::setfill(' ');
+                else
+                    os << *c;
+        }
+    }
+    os << '"';
+}
+
+} // namespace
+
+void SetEnabled(bool Enabled)
+{
+    // Make sure the registry start time is initialized before the first event is recorded
+    GetRegistry();
+    Internal::g_Enabled.store(Enabled, std::memory_order_relaxed);
+}
+
+void RecordScope(const char* Name, Uint64 StartTime, Uint64 EndTime)
+{
+    VERIFY_EXPR(EndTime >= StartTime);
+    GetThreadBuffer().Add({Name, StartTime, EndTime - StartTime, EventType::Scope},
+                          GetRegistry().MaxEventsPerThread.load(std::memory_order_relaxed));
+}
+
+void RecordCounter(const char* Name, Int64 Value)
+{
+    GetThreadBuffer().Add({Name, GetTimestamp(), static_cast<Uint64>(Value), EventType::Counter},
+                          GetRegistry().MaxEventsPerThread.load(std::memory_order_relaxed));
+}
+
+void SetCurrentThreadName(const char* Name)
+{
+    ThreadEventBuffer& Buffer = GetThreadBuffer();
+
+    std::lock_guard<std::mutex> Lock{GetRegistry().Mtx};
+    Buffer.Name = Name != nullptr ? Name : "";
+}
+
+void SetMaxEventsPerThread(size_t MaxEvents)
+{
+    GetRegistry().MaxEventsPerThread.store(MaxEvents, std::memory_order_relaxed);
+}
+
+size_t GetEventCount()
+{
+    Registry& Reg = GetRegistry();
+
+    std::lock_guard<std::mutex> Lock{Reg.Mtx};
+
+    size_t Count = 0;
+    for (const std::unique_ptr<ThreadEventBuffer>& pBuffer : Reg.Buffers)
+        Count += pBuffer->GetCount() - pBuffer->GetReadStart();
+    return Count;
+}
+
+size_t GetDroppedEventCount()
+{
+    Registry& Reg = GetRegistry();
+
+    std::lock_guard<std::mutex> Lock{Reg.Mtx};
+
+    size_t Count = 0;
+    for (const std::unique_ptr<ThreadEventBuffer>& pBuffer : Reg.Buffers)
+        Count += pBuffer->GetDroppedCount() - pBuffer->DroppedStart;
+    return Count;
+}
+
+void Reset()
+{
+    Registry& Reg = GetRegistry();
+
+    std::lock_guard<std::mutex> Lock{Reg.Mtx};
+    for (std::unique_ptr<ThreadEventBuffer>& pBuffer : Reg.Buffers)
+    {
+        pBuffer->Discard(pBuffer->GetCount());
+        pBuffer->DroppedStart = pBuffer->GetDroppedCount();
+    }
+
+    // Release the buffers of the threads that have exited. An exited thread can't
+    // record events, so all its events have been discarded above.
+    Reg.Buffers.erase(std::remove_if(Reg.Buffers.begin(), Reg.Buffers.end(),
+                                     [](const std::unique_ptr<ThreadEventBuffer>& pBuffer) {
+                                         return pBuffer->CanBeReleased();
+                                     }),
+                      Reg.Buffers.end());
+}
+
+std::string GetChromeTrace()
+{
+    Registry& Reg = GetRegistry();
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    ss << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool FirstEvent = true;
+
+    const auto BeginEvent = [&]() -> std::ostream& {
+        ss << (FirstEvent ? "\n" : ",\n");
+        FirstEvent = false;
+        return ss;
+    };
+
+    // Chrome trace timestamps are in microseconds
+    const double MicrosecondsPerTick = GetNanosecondsPerTick(Reg) / 1000.0;
+
+    const auto ToMicroseconds = [&Reg, MicrosecondsPerTick](Uint64 Timestamp) {
+        return static_cast<double>(Timestamp - (std::min)(Timestamp, Reg.Start.Ticks)) * MicrosecondsPerTick;
+    };
+
+    std::lock_guard<std::mutex> Lock{Reg.Mtx};
+    for (const std::unique_ptr<ThreadEventBuffer>& pBuffer : Reg.Buffers)
+    {
+        const Uint32 ThreadId = pBuffer->GetThreadId();
+
+        BeginEvent() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ThreadId << ",\"args\":{\"name\":";
+        if (!pBuffer->Name.empty())
+            WriteJSONString(ss, pBuffer->Name.c_str());
+        else
+            ss << "\"Thread " << ThreadId << '"';
+        ss << "}}";
+
+        pBuffer->ProcessEvents(pBuffer->GetReadStart(), pBuffer->GetCount(), [&](const Event& Evt) {
+            std::ostream& os = BeginEvent();
+            os << "{\"name\":";
+            WriteJSONString(os, Evt.Name);
+            if (Evt.Type == EventType::Scope)
+            {
+                os << ",\"cat\":\"Diligent\",\"ph\":\"X\",\"pid\":1,\"tid\":" << ThreadId
+                   << ",\"ts\":" << ToMicroseconds(Evt.Timestamp)
+                   << ",\"dur\":" << static_cast<double>(Evt.Data) * MicrosecondsPerTick << '}';
+            }
+            else
+            {
+                os << ",\"cat\":\"Diligent\",\"ph\":\"C\",\"pid\":1,\"tid\":" << ThreadId
+                   << ",\"ts\":" << ToMicroseconds(Evt.Timestamp)
+                   << ",\"args\":{\"value\":" << static_cast<Int64>(Evt.Data) << "}}";
+            }
+        });
+    }
+    ss << "\n]}\n";
+
+    return ss.str();
+}
+
+bool WriteChromeTrace(const char* FilePath)
+{
+    const std::string Trace = GetChromeTrace();
+
+    FileWrapper File{FilePath, EFileAccessMode::Overwrite};
+    if (!File)
+    {
+        LOG_ERROR_MESSAGE("Failed to open file '", FilePath, "' to write CPU profiler trace");
+        return false;
+    }
+
+    if (!File->Write(Trace.data(), Trace.size()))
+    {
+        LOG_ERROR_MESSAGE("Failed to write CPU profiler trace to file '", FilePath, "'");
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace CPUProfiler
+
+} // namespace Diligent
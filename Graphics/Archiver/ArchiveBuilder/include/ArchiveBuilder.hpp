@@ -0,0 +1,153 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ArchiveBuilder class
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "ArchiverFactory.h"
+#include "ArchiveManifest.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "XXH128Hasher.hpp"
+#include "ShaderToolsCommon.hpp"
+
+namespace Diligent
+{
+
+struct ArchiveBuilderSettings
+{
+    /// Path of the archive to write. If empty, the output path from the manifest is used.
+    std::string OutputPath;
+
+    /// Directory where per-object archives and the dependency database are stored.
+    /// If empty, "<output>.cache" is used.
+    std::string CacheDirectory;
+
+    /// The number of shader compilation threads. ~0u selects the number automatically.
+    Uint32 NumThreads = ~0u;
+
+    /// Rebuild all objects even if they are up to date.
+    bool ForceRebuild = false;
+};
+
+/// Builds a device object archive from a manifest.
+
+/// Every standalone shader, resource signature and pipeline in the manifest is serialized into its own
+/// archive that is stored in the cache directory under the hash of everything the object depends on:
+/// its description, the content of the shader source files and all files they include, the device
+/// types and the content version. Objects whose archives are already in the cache are not compiled
+/// again, and the final archive is produced by merging the per-object archives.
+class ArchiveBuilder
+{
+public:
+    ArchiveBuilder(IArchiverFactory*             pArchiverFactory,
+                   const ArchiveManifest&        Manifest,
+                   const ArchiveBuilderSettings& Settings) noexcept(false);
+
+    /// Builds the archive. Returns true if the archive was successfully written or is up to date.
+    bool Build() noexcept(false);
+
+    struct Statistics
+    {
+        /// The total number of objects in the manifest.
+        Uint32 NumObjects = 0;
+
+        /// The number of objects that were compiled.
+        Uint32 NumCompiled = 0;
+
+        /// The number of objects that were loaded from the cache.
+        Uint32 NumCached = 0;
+
+        /// Whether the output archive was up to date and was not written.
+        bool UpToDate = false;
+    };
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+private:
+    enum class ObjectType
+    {
+        Shader,
+        Signature,
+        Pipeline
+    };
+
+    struct ObjectInfo
+    {
+        ObjectType  Type  = ObjectType::Shader;
+        size_t      Index = 0; // Index in the manifest array
+        XXH128Hash  Hash;
+        std::string CacheFile;
+        bool        IsCached = false;
+    };
+
+    ShaderCreateInfo GetShaderCreateInfo(const ArchiveManifest::ShaderInfo& Shader, ShaderMacroArray Macros) const;
+
+    void ComputeHashes() noexcept(false);
+
+    IShader*                    GetShader(const std::string& Name) noexcept(false);
+    IPipelineResourceSignature* GetSignature(const std::string& Name) noexcept(false);
+    RefCntAutoPtr<IObject>      CreateObject(const ObjectInfo& Object) noexcept(false);
+
+    bool SerializeObject(const ObjectInfo& Object, IObject* pObject) noexcept(false);
+    bool WriteOutput() noexcept(false);
+
+    bool LoadDatabase(XXH128Hash& OutputHash, std::vector<std::string>& CacheFiles) const;
+    void SaveDatabase(const XXH128Hash& OutputHash) const noexcept(false);
+
+private:
+    RefCntAutoPtr<IArchiverFactory> m_pArchiverFactory;
+
+    const ArchiveManifest& m_Manifest;
+
+    const std::string m_OutputPath;
+    const std::string m_CacheDirectory;
+    const std::string m_DatabasePath;
+
+    const ArchiveBuilderSettings m_Settings;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pShaderSourceFactory;
+    RefCntAutoPtr<ISerializationDevice>            m_pSerializationDevice;
+
+    std::vector<ObjectInfo> m_Objects;
+
+    std::unordered_map<std::string, XXH128Hash> m_ShaderHashes;
+    std::unordered_map<std::string, XXH128Hash> m_SignatureHashes;
+
+    std::unordered_map<std::string, RefCntAutoPtr<IShader>>                    m_Shaders;
+    std::unordered_map<std::string, RefCntAutoPtr<IPipelineResourceSignature>> m_Signatures;
+
+    ShaderIncludeCache m_SourceCache;
+
+    Statistics m_Stats;
+};
+
+} // namespace Diligent
@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::ArchiveManifest struct
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "GraphicsTypesX.hpp"
+
+namespace Diligent
+{
+
+/// Description of the objects to pack into a device object archive, see readme.md for the file format.
+struct ArchiveManifest
+{
+    struct ShaderInfo
+    {
+        std::string Name;
+
+        /// Source file path, relative to one of the search directories.
+        std::string FilePath;
+
+        std::string            EntryPoint     = "main";
+        SHADER_TYPE            Type           = SHADER_TYPE_UNKNOWN;
+        SHADER_SOURCE_LANGUAGE SourceLanguage = SHADER_SOURCE_LANGUAGE_DEFAULT;
+        SHADER_COMPILER        Compiler       = SHADER_COMPILER_DEFAULT;
+
+        std::vector<std::pair<std::string, std::string>> Macros;
+
+        bool UseCombinedTextureSamplers = false;
+
+        /// Whether the shader is added to the archive as a standalone object.
+        /// Shaders used by pipelines are packed with the pipelines regardless of this flag.
+        bool Archive = false;
+    };
+
+    struct PipelineInfo
+    {
+        /// Pipeline type. Graphics and mesh pipelines use GraphicsCI, compute pipelines use ComputeCI.
+        PIPELINE_TYPE Type = PIPELINE_TYPE_GRAPHICS;
+
+        /// Pipeline create info without shaders and resource signatures.
+        GraphicsPipelineStateCreateInfoX GraphicsCI;
+        ComputePipelineStateCreateInfoX  ComputeCI;
+
+        /// Shader names by stage.
+        std::vector<std::pair<SHADER_TYPE, std::string>> Shaders;
+
+        /// Resource signature names.
+        std::vector<std::string> Signatures;
+
+        PSO_ARCHIVE_FLAGS ArchiveFlags = PSO_ARCHIVE_FLAG_NONE;
+
+        const PipelineStateCreateInfo& GetCreateInfo() const
+        {
+            if (Type == PIPELINE_TYPE_COMPUTE)
+                return ComputeCI;
+            else
+                return GraphicsCI;
+        }
+
+        const char* GetName() const
+        {
+            return GetCreateInfo().PSODesc.Name;
+        }
+    };
+
+    /// Path of the archive to write.
+    std::string OutputPath;
+
+    /// Shader source search directories.
+    std::vector<std::string> SearchDirectories;
+
+    ARCHIVE_DEVICE_DATA_FLAGS DeviceFlags    = ARCHIVE_DEVICE_DATA_FLAG_NONE;
+    Uint32                    ContentVersion = 0;
+
+    std::vector<ShaderInfo>                     Shaders;
+    std::vector<PipelineResourceSignatureDescX> Signatures;
+    std::vector<PipelineInfo>                   Pipelines;
+
+    /// Loads the manifest from a JSON file. Relative paths in the manifest are resolved
+    /// against the directory that contains the manifest. Throws an exception in case of an error.
+    static ArchiveManifest Load(const char* FilePath) noexcept(false);
+
+    /// Returns the shader with the given name, or null if there is no such shader.
+    const ShaderInfo* FindShader(const std::string& Name) const;
+
+    /// Returns the resource signature with the given name, or null if there is no such signature.
+    const PipelineResourceSignatureDescX* FindSignature(const std::string& Name) const;
+};
+
+} // namespace Diligent
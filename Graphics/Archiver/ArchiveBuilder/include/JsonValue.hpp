@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Minimal JSON document model used to read archive build manifests.
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+/// JSON value.
+
+/// Object members are kept in the order they appear in the document.
+/// The parser supports the full JSON grammar except for \\u escapes of non-ASCII characters,
+/// and additionally allows // line comments, which are convenient in hand-written manifests.
+class JsonValue
+{
+public:
+    enum class Type
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object
+    };
+
+    JsonValue() noexcept {}
+
+    /// Parses the JSON document. Throws an exception if the document is invalid.
+
+    /// \param [in] Text     - JSON text.
+    /// \param [in] Length   - Text length.
+    /// \param [in] Location - Document name used in error messages.
+    static JsonValue Parse(const char* Text, size_t Length, const char* Location) noexcept(false);
+
+    Type GetType() const { return m_Type; }
+
+    bool IsNull() const { return m_Type == Type::Null; }
+    bool IsBool() const { return m_Type == Type::Bool; }
+    bool IsNumber() const { return m_Type == Type::Number; }
+    bool IsString() const { return m_Type == Type::String; }
+    bool IsArray() const { return m_Type == Type::Array; }
+    bool IsObject() const { return m_Type == Type::Object; }
+
+    /// Value accessors throw an exception if the value has a different type.
+    /// Path is the location of the value in the document, e.g. "pipelines[2].name".
+    bool               AsBool(const std::string& Path) const noexcept(false);
+    double             AsNumber(const std::string& Path) const noexcept(false);
+    Uint32             AsUint(const std::string& Path) const noexcept(false);
+    const std::string& AsString(const std::string& Path) const noexcept(false);
+
+    const std::vector<JsonValue>&                          AsArray(const std::string& Path) const noexcept(false);
+    const std::vector<std::pair<std::string, JsonValue>>& AsObject(const std::string& Path) const noexcept(false);
+
+    /// Returns the object member with the given name or null if there is no such member.
+    const JsonValue* Find(const char* Name) const;
+
+private:
+    friend class JsonParser;
+
+    Type m_Type = Type::Null;
+
+    bool        m_Bool   = false;
+    double      m_Number = 0;
+    std::string m_String;
+
+    std::vector<JsonValue>                          m_Array;
+    std::vector<std::pair<std::string, JsonValue>> m_Object;
+};
+
+} // namespace Diligent
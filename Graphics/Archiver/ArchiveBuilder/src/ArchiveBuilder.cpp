@@ -0,0 +1,560 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ArchiveBuilder.hpp"
+
+#include <unordered_set>
+#include <sstream>
+
+#include "APIInfo.h"
+#include "Archiver.h"
+#include "SerializationDevice.h"
+#include "ShaderMacroHelper.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileWrapper.hpp"
+#include "FileSystem.hpp"
+#include "GraphicsAccessories.hpp"
+#include "BasicMath.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Increment the version when the format of the per-object archives or the way hashes are computed changes
+constexpr Uint32 ArchiveBuilderVersion = 1;
+
+constexpr char DatabaseHeader[] = "DiligentArchiveBuilder";
+
+RefCntAutoPtr<IDataBlob> ReadFileData(const std::string& Path)
+{
+    FileWrapper File{Path.c_str()};
+    if (!File)
+        return {};
+
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create();
+    if (!File->Read(pData))
+        return {};
+
+    return pData;
+}
+
+bool WriteFileData(const std::string& Path, const IDataBlob* pData)
+{
+    FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+    return File && File->Write(pData->GetConstDataPtr(), pData->GetSize());
+}
+
+const char* GetObjectTypeName(char Prefix)
+{
+    switch (Prefix)
+    {
+        case 's': return "shader";
+        case 'r': return "resource signature";
+        case 'p': return "pipeline";
+        default:
+            UNEXPECTED("Unexpected object type prefix");
+            return "object";
+    }
+}
+
+} // namespace
+
+ArchiveBuilder::ArchiveBuilder(IArchiverFactory*             pArchiverFactory,
+                               const ArchiveManifest&        Manifest,
+                               const ArchiveBuilderSettings& Settings) noexcept(false) :
+    m_pArchiverFactory{pArchiverFactory},
+    m_Manifest{Manifest},
+    m_OutputPath{!Settings.OutputPath.empty() ? Settings.OutputPath : Manifest.OutputPath},
+    m_CacheDirectory{!Settings.CacheDirectory.empty() ? Settings.CacheDirectory : m_OutputPath + ".cache"},
+    m_DatabasePath{m_CacheDirectory + FileSystem::SlashSymbol + "ArchiveBuilder.db"},
+    m_Settings{Settings}
+{
+    if (m_pArchiverFactory == nullptr)
+        LOG_ERROR_AND_THROW("Archiver factory must not be null");
+
+    if (m_OutputPath.empty())
+        LOG_ERROR_AND_THROW("Output path is not specified in the manifest or in the command line");
+
+    std::string SearchDirectories;
+    for (const std::string& Dir : m_Manifest.SearchDirectories)
+    {
+        if (!SearchDirectories.empty())
+            SearchDirectories += ';';
+        SearchDirectories += Dir;
+    }
+    m_pArchiverFactory->CreateDefaultShaderSourceStreamFactory(SearchDirectories.c_str(), &m_pShaderSourceFactory);
+    if (!m_pShaderSourceFactory)
+        LOG_ERROR_AND_THROW("Failed to create shader source stream factory");
+}
+
+ShaderCreateInfo ArchiveBuilder::GetShaderCreateInfo(const ArchiveManifest::ShaderInfo& Shader, ShaderMacroArray Macros) const
+{
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Desc.Name                       = Shader.Name.c_str();
+    ShaderCI.Desc.ShaderType                 = Shader.Type;
+    ShaderCI.Desc.UseCombinedTextureSamplers = Shader.UseCombinedTextureSamplers;
+    ShaderCI.FilePath                        = Shader.FilePath.c_str();
+    ShaderCI.EntryPoint                      = Shader.EntryPoint.c_str();
+    ShaderCI.SourceLanguage                  = Shader.SourceLanguage;
+    ShaderCI.ShaderCompiler                  = Shader.Compiler;
+    ShaderCI.Macros                          = Macros;
+    ShaderCI.pShaderSourceStreamFactory      = m_pShaderSourceFactory;
+    return ShaderCI;
+}
+
+void ArchiveBuilder::ComputeHashes() noexcept(false)
+{
+    // Every object hash starts with the parameters that affect all objects
+    auto InitHasher = [this](XXH128State& Hasher, char Prefix) {
+        Hasher.Update(ArchiveBuilderVersion, DILIGENT_API_VERSION, m_Manifest.DeviceFlags, m_Manifest.ContentVersion, Prefix);
+    };
+
+    auto AddObject = [this](ObjectType Type, size_t Index, char Prefix, const XXH128Hash& Hash) {
+        ObjectInfo Object;
+        Object.Type      = Type;
+        Object.Index     = Index;
+        Object.Hash      = Hash;
+        Object.CacheFile = std::string{Prefix} + '_' + Hash.ToString() + ".bin";
+        Object.IsCached  = !m_Settings.ForceRebuild && FileSystem::FileExists((m_CacheDirectory + FileSystem::SlashSymbol + Object.CacheFile).c_str());
+        m_Objects.emplace_back(std::move(Object));
+    };
+
+    for (size_t i = 0; i < m_Manifest.Shaders.size(); ++i)
+    {
+        const ArchiveManifest::ShaderInfo& Shader = m_Manifest.Shaders[i];
+
+        ShaderMacroHelper Macros;
+        for (const auto& Macro : Shader.Macros)
+            Macros.Add(Macro.first.c_str(), Macro.second.c_str());
+
+        // The hash includes the content of the source file and all files it includes
+        XXH128State Hasher;
+        InitHasher(Hasher, 's');
+        Hasher.Update(GetShaderCreateInfo(Shader, Macros), &m_SourceCache);
+
+        const XXH128Hash Hash = Hasher.Digest();
+        m_ShaderHashes.emplace(Shader.Name, Hash);
+        if (Shader.Archive)
+            AddObject(ObjectType::Shader, i, 's', Hash);
+    }
+
+    for (size_t i = 0; i < m_Manifest.Signatures.size(); ++i)
+    {
+        const PipelineResourceSignatureDescX& Desc = m_Manifest.Signatures[i];
+
+        XXH128State Hasher;
+        InitHasher(Hasher, 'r');
+        Hasher.Update(static_cast<const PipelineResourceSignatureDesc&>(Desc));
+
+        const XXH128Hash Hash = Hasher.Digest();
+        m_SignatureHashes.emplace(Desc.Name, Hash);
+        AddObject(ObjectType::Signature, i, 'r', Hash);
+    }
+
+    for (size_t i = 0; i < m_Manifest.Pipelines.size(); ++i)
+    {
+        const ArchiveManifest::PipelineInfo& Pipeline = m_Manifest.Pipelines[i];
+
+        XXH128State Hasher;
+        InitHasher(Hasher, 'p');
+        Hasher.Update(Pipeline.Type, Pipeline.ArchiveFlags);
+        if (Pipeline.Type == PIPELINE_TYPE_COMPUTE)
+            Hasher.Update(static_cast<const ComputePipelineStateCreateInfo&>(Pipeline.ComputeCI));
+        else
+            Hasher.Update(static_cast<const GraphicsPipelineStateCreateInfo&>(Pipeline.GraphicsCI));
+
+        // Pipeline create infos in the manifest do not reference shaders and signatures,
+        // so combine the hashes of the objects the pipeline depends on.
+        for (const auto& Shader : Pipeline.Shaders)
+        {
+            const XXH128Hash& ShaderHash = m_ShaderHashes.at(Shader.second);
+            Hasher.Update(Shader.first, ShaderHash.LowPart, ShaderHash.HighPart);
+        }
+        for (const std::string& Sign : Pipeline.Signatures)
+        {
+            const XXH128Hash& SignHash = m_SignatureHashes.at(Sign);
+            Hasher.Update(SignHash.LowPart, SignHash.HighPart);
+        }
+
+        AddObject(ObjectType::Pipeline, i, 'p', Hasher.Digest());
+    }
+
+    m_Stats.NumObjects = static_cast<Uint32>(m_Objects.size());
+}
+
+IShader* ArchiveBuilder::GetShader(const std::string& Name) noexcept(false)
+{
+    auto it = m_Shaders.find(Name);
+    if (it != m_Shaders.end())
+        return it->second;
+
+    const ArchiveManifest::ShaderInfo* pShaderInfo = m_Manifest.FindShader(Name);
+    VERIFY(pShaderInfo != nullptr, "Shader references must have been validated when the manifest was loaded");
+
+    ShaderMacroHelper Macros;
+    for (const auto& Macro : pShaderInfo->Macros)
+        Macros.Add(Macro.first.c_str(), Macro.second.c_str());
+
+    // Shaders are compiled in the serialization device thread pool. The archiver waits
+    // for the compilation to finish when the shader or a pipeline that uses it is serialized.
+    ShaderCreateInfo ShaderCI = GetShaderCreateInfo(*pShaderInfo, Macros);
+    ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
+    RefCntAutoPtr<IShader> pShader;
+    m_pSerializationDevice->CreateShader(ShaderCI, ShaderArchiveInfo{m_Manifest.DeviceFlags}, &pShader);
+    if (!pShader)
+        LOG_ERROR_AND_THROW("Failed to create shader '", Name, "'");
+
+    return m_Shaders.emplace(Name, std::move(pShader)).first->second;
+}
+
+IPipelineResourceSignature* ArchiveBuilder::GetSignature(const std::string& Name) noexcept(false)
+{
+    auto it = m_Signatures.find(Name);
+    if (it != m_Signatures.end())
+        return it->second;
+
+    const PipelineResourceSignatureDescX* pDesc = m_Manifest.FindSignature(Name);
+    VERIFY(pDesc != nullptr, "Signature references must have been validated when the manifest was loaded");
+
+    RefCntAutoPtr<IPipelineResourceSignature> pSignature;
+    m_pSerializationDevice->CreatePipelineResourceSignature(*pDesc, ResourceSignatureArchiveInfo{m_Manifest.DeviceFlags}, &pSignature);
+    if (!pSignature)
+        LOG_ERROR_AND_THROW("Failed to create resource signature '", Name, "'");
+
+    return m_Signatures.emplace(Name, std::move(pSignature)).first->second;
+}
+
+RefCntAutoPtr<IObject> ArchiveBuilder::CreateObject(const ObjectInfo& Object) noexcept(false)
+{
+    switch (Object.Type)
+    {
+        case ObjectType::Shader:
+            return RefCntAutoPtr<IObject>{GetShader(m_Manifest.Shaders[Object.Index].Name)};
+
+        case ObjectType::Signature:
+            return RefCntAutoPtr<IObject>{GetSignature(m_Manifest.Signatures[Object.Index].Name)};
+
+        case ObjectType::Pipeline:
+        {
+            const ArchiveManifest::PipelineInfo& Pipeline = m_Manifest.Pipelines[Object.Index];
+
+            PipelineStateArchiveInfo ArchiveInfo;
+            ArchiveInfo.DeviceFlags = m_Manifest.DeviceFlags;
+            ArchiveInfo.PSOFlags    = Pipeline.ArchiveFlags;
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            if (Pipeline.Type == PIPELINE_TYPE_COMPUTE)
+            {
+                ComputePipelineStateCreateInfoX PSOCreateInfo{Pipeline.ComputeCI};
+                for (const auto& Shader : Pipeline.Shaders)
+                    PSOCreateInfo.AddShader(GetShader(Shader.second));
+                for (const std::string& Sign : Pipeline.Signatures)
+                    PSOCreateInfo.AddSignature(GetSignature(Sign));
+                PSOCreateInfo.Flags |= PSO_CREATE_FLAG_ASYNCHRONOUS;
+                m_pSerializationDevice->CreateComputePipelineState(PSOCreateInfo, ArchiveInfo, &pPSO);
+            }
+            else
+            {
+                GraphicsPipelineStateCreateInfoX PSOCreateInfo{Pipeline.GraphicsCI};
+                for (const auto& Shader : Pipeline.Shaders)
+                    PSOCreateInfo.AddShader(GetShader(Shader.second));
+                for (const std::string& Sign : Pipeline.Signatures)
+                    PSOCreateInfo.AddSignature(GetSignature(Sign));
+                PSOCreateInfo.Flags |= PSO_CREATE_FLAG_ASYNCHRONOUS;
+                m_pSerializationDevice->CreateGraphicsPipelineState(PSOCreateInfo, ArchiveInfo, &pPSO);
+            }
+
+            if (!pPSO)
+                LOG_ERROR_AND_THROW("Failed to create pipeline '", Pipeline.GetName(), "'");
+
+            return RefCntAutoPtr<IObject>{pPSO};
+        }
+
+        default:
+            UNEXPECTED("Unexpected object type");
+            return {};
+    }
+}
+
+bool ArchiveBuilder::SerializeObject(const ObjectInfo& Object, IObject* pObject) noexcept(false)
+{
+    RefCntAutoPtr<IArchiver> pArchiver;
+    m_pArchiverFactory->CreateArchiver(m_pSerializationDevice, &pArchiver);
+    if (!pArchiver)
+        LOG_ERROR_AND_THROW("Failed to create archiver");
+
+    bool Added = false;
+    switch (Object.Type)
+    {
+        case ObjectType::Shader:
+            Added = pArchiver->AddShader(RefCntAutoPtr<IShader>{pObject, IID_Shader});
+            break;
+
+        case ObjectType::Signature:
+            Added = pArchiver->AddPipelineResourceSignature(RefCntAutoPtr<IPipelineResourceSignature>{pObject, IID_PipelineResourceSignature});
+            break;
+
+        case ObjectType::Pipeline:
+            Added = pArchiver->AddPipelineState(RefCntAutoPtr<IPipelineState>{pObject, IID_PipelineState});
+            break;
+
+        default:
+            UNEXPECTED("Unexpected object type");
+    }
+
+    // SerializeToBlob waits only for the object in this archiver, while the
+    // remaining objects continue to compile in the thread pool.
+    RefCntAutoPtr<IDataBlob> pArchive;
+    if (!Added || !pArchiver->SerializeToBlob(m_Manifest.ContentVersion, &pArchive) || !pArchive)
+        return false;
+
+    const std::string CachePath = m_CacheDirectory + FileSystem::SlashSymbol + Object.CacheFile;
+    if (!WriteFileData(CachePath, pArchive))
+        LOG_ERROR_AND_THROW("Failed to write '", CachePath, "'");
+
+    return true;
+}
+
+bool ArchiveBuilder::WriteOutput() noexcept(false)
+{
+    std::vector<RefCntAutoPtr<IDataBlob>> Archives;
+    Archives.reserve(m_Objects.size());
+    for (const ObjectInfo& Object : m_Objects)
+    {
+        const std::string CachePath = m_CacheDirectory + FileSystem::SlashSymbol + Object.CacheFile;
+
+        RefCntAutoPtr<IDataBlob> pArchive = ReadFileData(CachePath);
+        if (!pArchive)
+            LOG_ERROR_AND_THROW("Failed to read '", CachePath, "'");
+        Archives.emplace_back(std::move(pArchive));
+    }
+
+    RefCntAutoPtr<IDataBlob> pOutput;
+    if (!Archives.empty())
+    {
+        std::vector<const IDataBlob*> pArchives{Archives.begin(), Archives.end()};
+        if (!m_pArchiverFactory->MergeArchives(pArchives.data(), static_cast<Uint32>(pArchives.size()), &pOutput))
+        {
+            LOG_ERROR_MESSAGE("Failed to merge object archives");
+            return false;
+        }
+    }
+    else
+    {
+        // Write a valid empty archive
+        RefCntAutoPtr<IArchiver> pArchiver;
+        m_pArchiverFactory->CreateArchiver(m_pSerializationDevice, &pArchiver);
+        if (!pArchiver || !pArchiver->SerializeToBlob(m_Manifest.ContentVersion, &pOutput))
+        {
+            LOG_ERROR_MESSAGE("Failed to serialize empty archive");
+            return false;
+        }
+    }
+
+    if (!WriteFileData(m_OutputPath, pOutput))
+    {
+        LOG_ERROR_MESSAGE("Failed to write archive '", m_OutputPath, "'");
+        return false;
+    }
+
+    return true;
+}
+
+bool ArchiveBuilder::LoadDatabase(XXH128Hash& OutputHash, std::vector<std::string>& CacheFiles) const
+{
+    RefCntAutoPtr<IDataBlob> pData = ReadFileData(m_DatabasePath);
+    if (!pData)
+        return false;
+
+    std::istringstream Stream{std::string{pData->GetConstDataPtr<char>(), pData->GetSize()}};
+
+    std::string Header;
+    Uint32      Version = 0;
+    if (!(Stream >> Header >> Version) || Header != DatabaseHeader || Version != ArchiveBuilderVersion)
+        return false;
+
+    std::string Key;
+    while (Stream >> Key)
+    {
+        if (Key == "output")
+        {
+            if (!(Stream >> std::hex >> OutputHash.HighPart >> OutputHash.LowPart >> std::dec))
+                return false;
+        }
+        else if (Key == "file")
+        {
+            std::string File;
+            if (!(Stream >> File))
+                return false;
+            CacheFiles.emplace_back(std::move(File));
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ArchiveBuilder::SaveDatabase(const XXH128Hash& OutputHash) const noexcept(false)
+{
+    std::ostringstream Stream;
+    Stream << DatabaseHeader << ' ' << ArchiveBuilderVersion << '\n';
+    Stream << "output " << std::hex << OutputHash.HighPart << ' ' << OutputHash.LowPart << std::dec << '\n';
+    for (const ObjectInfo& Object : m_Objects)
+        Stream << "file " << Object.CacheFile << '\n';
+
+    const std::string Data = Stream.str();
+
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create(Data.size(), Data.data());
+    if (!WriteFileData(m_DatabasePath, pData))
+        LOG_ERROR_AND_THROW("Failed to write '", m_DatabasePath, "'");
+}
+
+bool ArchiveBuilder::Build() noexcept(false)
+{
+    ComputeHashes();
+
+    XXH128Hash OutputHash;
+    {
+        XXH128State Hasher;
+        Hasher.Update(ArchiveBuilderVersion, m_Manifest.ContentVersion);
+        for (const ObjectInfo& Object : m_Objects)
+            Hasher.Update(Object.Hash.LowPart, Object.Hash.HighPart);
+        OutputHash = Hasher.Digest();
+    }
+
+    XXH128Hash               PrevOutputHash;
+    std::vector<std::string> PrevCacheFiles;
+    const bool               HasDatabase = LoadDatabase(PrevOutputHash, PrevCacheFiles);
+
+    bool AllCached = true;
+    for (const ObjectInfo& Object : m_Objects)
+        AllCached = AllCached && Object.IsCached;
+
+    if (HasDatabase && AllCached && PrevOutputHash == OutputHash && FileSystem::FileExists(m_OutputPath.c_str()))
+    {
+        m_Stats.NumCached = m_Stats.NumObjects;
+        m_Stats.UpToDate  = true;
+        LOG_INFO_MESSAGE("Archive '", m_OutputPath, "' is up to date");
+        return true;
+    }
+
+    if (!FileSystem::PathExists(m_CacheDirectory.c_str()) && !FileSystem::CreateDirectory(m_CacheDirectory.c_str()))
+        LOG_ERROR_AND_THROW("Failed to create cache directory '", m_CacheDirectory, "'");
+
+    {
+        SerializationDeviceCreateInfo DeviceCI;
+        DeviceCI.NumAsyncShaderCompilationThreads = m_Settings.NumThreads;
+        m_pArchiverFactory->CreateSerializationDevice(DeviceCI, &m_pSerializationDevice);
+        if (!m_pSerializationDevice)
+            LOG_ERROR_AND_THROW("Failed to create serialization device");
+
+        ARCHIVE_DEVICE_DATA_FLAGS UnsupportedFlags = m_Manifest.DeviceFlags & ~m_pSerializationDevice->GetSupportedDeviceFlags();
+        if (UnsupportedFlags != ARCHIVE_DEVICE_DATA_FLAG_NONE)
+        {
+            std::string Devices;
+            while (UnsupportedFlags != ARCHIVE_DEVICE_DATA_FLAG_NONE)
+            {
+                if (!Devices.empty())
+                    Devices += ", ";
+                Devices += GetArchiveDeviceDataFlagString(ExtractLSB(UnsupportedFlags));
+            }
+            LOG_ERROR_AND_THROW("The following devices are not supported by this build of the archiver: ", Devices);
+        }
+    }
+
+    bool Succeeded = true;
+
+    // Create all objects first so that shaders and pipelines are compiled in parallel.
+    std::vector<RefCntAutoPtr<IObject>> Objects(m_Objects.size());
+    for (size_t i = 0; i < m_Objects.size(); ++i)
+    {
+        if (m_Objects[i].IsCached)
+            continue;
+
+        try
+        {
+            Objects[i] = CreateObject(m_Objects[i]);
+        }
+        catch (...)
+        {
+            Succeeded = false;
+        }
+    }
+
+    for (size_t i = 0; i < m_Objects.size(); ++i)
+    {
+        const ObjectInfo& Object = m_Objects[i];
+        if (Object.IsCached)
+        {
+            ++m_Stats.NumCached;
+            continue;
+        }
+
+        if (!Objects[i])
+            continue;
+
+        const char Prefix = Object.CacheFile[0];
+        if (SerializeObject(Object, Objects[i]))
+        {
+            ++m_Stats.NumCompiled;
+            LOG_INFO_MESSAGE("Compiled ", GetObjectTypeName(Prefix), " ", Object.CacheFile);
+        }
+        else
+        {
+            LOG_ERROR_MESSAGE("Failed to serialize ", GetObjectTypeName(Prefix), " ", Object.CacheFile);
+            Succeeded = false;
+        }
+    }
+
+    if (!Succeeded)
+        return false;
+
+    if (!WriteOutput())
+        return false;
+
+    SaveDatabase(OutputHash);
+
+    // Remove archives of the objects that are no longer produced by the manifest
+    std::unordered_set<std::string> CacheFiles;
+    for (const ObjectInfo& Object : m_Objects)
+        CacheFiles.emplace(Object.CacheFile);
+    for (const std::string& File : PrevCacheFiles)
+    {
+        if (CacheFiles.find(File) == CacheFiles.end())
+            FileSystem::DeleteFile((m_CacheDirectory + FileSystem::SlashSymbol + File).c_str());
+    }
+
+    return true;
+}
+
+} // namespace Diligent
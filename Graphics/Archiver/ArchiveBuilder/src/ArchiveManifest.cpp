@@ -0,0 +1,601 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ArchiveManifest.hpp"
+
+#include <unordered_set>
+
+#include "JsonValue.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileWrapper.hpp"
+#include "FileSystem.hpp"
+#include "GraphicsAccessories.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+template <typename EnumType>
+struct EnumName
+{
+    const char* Name;
+    EnumType    Value;
+};
+
+// clang-format off
+const EnumName<ARCHIVE_DEVICE_DATA_FLAGS> DeviceNames[] =
+{
+    {"d3d11",       ARCHIVE_DEVICE_DATA_FLAG_D3D11},
+    {"d3d12",       ARCHIVE_DEVICE_DATA_FLAG_D3D12},
+    {"gl",          ARCHIVE_DEVICE_DATA_FLAG_GL},
+    {"gles",        ARCHIVE_DEVICE_DATA_FLAG_GLES},
+    {"vulkan",      ARCHIVE_DEVICE_DATA_FLAG_VULKAN},
+    {"metal_macos", ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS},
+    {"metal_ios",   ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS},
+    {"webgpu",      ARCHIVE_DEVICE_DATA_FLAG_WEBGPU},
+};
+
+const EnumName<SHADER_TYPE> ShaderStageNames[] =
+{
+    {"vs",  SHADER_TYPE_VERTEX},
+    {"ps",  SHADER_TYPE_PIXEL},
+    {"gs",  SHADER_TYPE_GEOMETRY},
+    {"hs",  SHADER_TYPE_HULL},
+    {"ds",  SHADER_TYPE_DOMAIN},
+    {"cs",  SHADER_TYPE_COMPUTE},
+    {"as",  SHADER_TYPE_AMPLIFICATION},
+    {"ms",  SHADER_TYPE_MESH},
+    {"all", SHADER_TYPE_ALL},
+};
+
+const EnumName<SHADER_SOURCE_LANGUAGE> SourceLanguageNames[] =
+{
+    {"default",       SHADER_SOURCE_LANGUAGE_DEFAULT},
+    {"hlsl",          SHADER_SOURCE_LANGUAGE_HLSL},
+    {"glsl",          SHADER_SOURCE_LANGUAGE_GLSL},
+    {"glsl_verbatim", SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM},
+    {"msl",           SHADER_SOURCE_LANGUAGE_MSL},
+    {"msl_verbatim",  SHADER_SOURCE_LANGUAGE_MSL_VERBATIM},
+    {"wgsl",          SHADER_SOURCE_LANGUAGE_WGSL},
+};
+
+const EnumName<SHADER_COMPILER> CompilerNames[] =
+{
+    {"default", SHADER_COMPILER_DEFAULT},
+    {"glslang", SHADER_COMPILER_GLSLANG},
+    {"dxc",     SHADER_COMPILER_DXC},
+    {"fxc",     SHADER_COMPILER_FXC},
+};
+
+const EnumName<SHADER_RESOURCE_TYPE> ResourceTypeNames[] =
+{
+    {"constant_buffer",        SHADER_RESOURCE_TYPE_CONSTANT_BUFFER},
+    {"texture_srv",            SHADER_RESOURCE_TYPE_TEXTURE_SRV},
+    {"buffer_srv",             SHADER_RESOURCE_TYPE_BUFFER_SRV},
+    {"texture_uav",            SHADER_RESOURCE_TYPE_TEXTURE_UAV},
+    {"buffer_uav",             SHADER_RESOURCE_TYPE_BUFFER_UAV},
+    {"sampler",                SHADER_RESOURCE_TYPE_SAMPLER},
+    {"input_attachment",       SHADER_RESOURCE_TYPE_INPUT_ATTACHMENT},
+    {"acceleration_structure", SHADER_RESOURCE_TYPE_ACCEL_STRUCT},
+};
+
+const EnumName<SHADER_RESOURCE_VARIABLE_TYPE> VariableTypeNames[] =
+{
+    {"static",  SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+    {"mutable", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+    {"dynamic", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+};
+
+const EnumName<FILTER_TYPE> FilterNames[] =
+{
+    {"point",       FILTER_TYPE_POINT},
+    {"linear",      FILTER_TYPE_LINEAR},
+    {"anisotropic", FILTER_TYPE_ANISOTROPIC},
+};
+
+const EnumName<TEXTURE_ADDRESS_MODE> AddressModeNames[] =
+{
+    {"wrap",   TEXTURE_ADDRESS_WRAP},
+    {"mirror", TEXTURE_ADDRESS_MIRROR},
+    {"clamp",  TEXTURE_ADDRESS_CLAMP},
+    {"border", TEXTURE_ADDRESS_BORDER},
+};
+
+const EnumName<PRIMITIVE_TOPOLOGY> TopologyNames[] =
+{
+    {"triangle_list",  PRIMITIVE_TOPOLOGY_TRIANGLE_LIST},
+    {"triangle_strip", PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP},
+    {"point_list",     PRIMITIVE_TOPOLOGY_POINT_LIST},
+    {"line_list",      PRIMITIVE_TOPOLOGY_LINE_LIST},
+    {"line_strip",     PRIMITIVE_TOPOLOGY_LINE_STRIP},
+};
+
+const EnumName<CULL_MODE> CullModeNames[] =
+{
+    {"none",  CULL_MODE_NONE},
+    {"front", CULL_MODE_FRONT},
+    {"back",  CULL_MODE_BACK},
+};
+
+const EnumName<VALUE_TYPE> ValueTypeNames[] =
+{
+    {"int8",    VT_INT8},
+    {"int16",   VT_INT16},
+    {"int32",   VT_INT32},
+    {"uint8",   VT_UINT8},
+    {"uint16",  VT_UINT16},
+    {"uint32",  VT_UINT32},
+    {"float16", VT_FLOAT16},
+    {"float32", VT_FLOAT32},
+};
+
+const EnumName<PIPELINE_TYPE> PipelineTypeNames[] =
+{
+    {"graphics", PIPELINE_TYPE_GRAPHICS},
+    {"compute",  PIPELINE_TYPE_COMPUTE},
+    {"mesh",     PIPELINE_TYPE_MESH},
+};
+// clang-format on
+
+// Reads members of a JSON object and reports members that were never read,
+// so that typos in the manifest do not go unnoticed.
+class ObjectReader
+{
+public:
+    ObjectReader(const JsonValue& Value, std::string Path) noexcept(false) :
+        m_Members{Value.AsObject(Path)},
+        m_Path{std::move(Path)},
+        m_Used(m_Members.size())
+    {}
+
+    std::string GetMemberPath(const char* Name) const
+    {
+        return m_Path.empty() ? std::string{Name} : m_Path + '.' + Name;
+    }
+
+    const JsonValue* Find(const char* Name)
+    {
+        for (size_t i = 0; i < m_Members.size(); ++i)
+        {
+            if (m_Members[i].first == Name)
+            {
+                m_Used[i] = true;
+                return &m_Members[i].second;
+            }
+        }
+        return nullptr;
+    }
+
+    const JsonValue& Get(const char* Name) noexcept(false)
+    {
+        const JsonValue* pValue = Find(Name);
+        if (pValue == nullptr)
+            LOG_ERROR_AND_THROW("Required member '", GetMemberPath(Name), "' is missing");
+        return *pValue;
+    }
+
+    const std::string& GetString(const char* Name) noexcept(false)
+    {
+        return Get(Name).AsString(GetMemberPath(Name));
+    }
+
+    std::string GetString(const char* Name, const char* Default) noexcept(false)
+    {
+        const JsonValue* pValue = Find(Name);
+        return pValue != nullptr ? pValue->AsString(GetMemberPath(Name)) : std::string{Default};
+    }
+
+    bool GetBool(const char* Name, bool Default) noexcept(false)
+    {
+        const JsonValue* pValue = Find(Name);
+        return pValue != nullptr ? pValue->AsBool(GetMemberPath(Name)) : Default;
+    }
+
+    Uint32 GetUint(const char* Name, Uint32 Default) noexcept(false)
+    {
+        const JsonValue* pValue = Find(Name);
+        return pValue != nullptr ? pValue->AsUint(GetMemberPath(Name)) : Default;
+    }
+
+    template <typename EnumType, size_t NumNames>
+    EnumType GetEnum(const char* Name, const EnumName<EnumType> (&Names)[NumNames], EnumType Default) noexcept(false)
+    {
+        const JsonValue* pValue = Find(Name);
+        return pValue != nullptr ? ParseEnum(*pValue, GetMemberPath(Name), Names) : Default;
+    }
+
+    // Reads either a single name or an array of names and combines the values
+    template <typename EnumType, size_t NumNames>
+    EnumType GetFlags(const char* Name, const EnumName<EnumType> (&Names)[NumNames], EnumType Default) noexcept(false)
+    {
+        const JsonValue* pValue = Find(Name);
+        if (pValue == nullptr)
+            return Default;
+
+        const std::string Path = GetMemberPath(Name);
+        if (!pValue->IsArray())
+            return ParseEnum(*pValue, Path, Names);
+
+        EnumType Flags = static_cast<EnumType>(0);
+        const std::vector<JsonValue>& Elements = pValue->AsArray(Path);
+        for (size_t i = 0; i < Elements.size(); ++i)
+            Flags |= ParseEnum(Elements[i], Path + '[' + std::to_string(i) + ']', Names);
+        return Flags;
+    }
+
+    void CheckUnusedMembers() const noexcept(false)
+    {
+        for (size_t i = 0; i < m_Members.size(); ++i)
+        {
+            if (!m_Used[i])
+                LOG_ERROR_AND_THROW("Unknown member '", GetMemberPath(m_Members[i].first.c_str()), "'");
+        }
+    }
+
+    template <typename EnumType, size_t NumNames>
+    static EnumType ParseEnum(const JsonValue& Value, const std::string& Path, const EnumName<EnumType> (&Names)[NumNames]) noexcept(false)
+    {
+        const std::string& Str = Value.AsString(Path);
+        for (const EnumName<EnumType>& Name : Names)
+        {
+            if (Str == Name.Name)
+                return Name.Value;
+        }
+
+        std::string ValidNames;
+        for (const EnumName<EnumType>& Name : Names)
+        {
+            if (!ValidNames.empty())
+                ValidNames += ", ";
+            ValidNames += Name.Name;
+        }
+        LOG_ERROR_AND_THROW("'", Str, "' is not a valid value for '", Path, "'. Valid values are: ", ValidNames);
+    }
+
+private:
+    const std::vector<std::pair<std::string, JsonValue>>& m_Members;
+
+    const std::string m_Path;
+
+    std::vector<bool> m_Used;
+};
+
+template <typename HandlerType>
+void ReadArray(ObjectReader& Reader, const char* Name, HandlerType&& Handler) noexcept(false)
+{
+    const JsonValue* pValue = Reader.Find(Name);
+    if (pValue == nullptr)
+        return;
+
+    const std::string              Path     = Reader.GetMemberPath(Name);
+    const std::vector<JsonValue>& Elements = pValue->AsArray(Path);
+    for (size_t i = 0; i < Elements.size(); ++i)
+        Handler(Elements[i], Path + '[' + std::to_string(i) + ']');
+}
+
+TEXTURE_FORMAT ParseTextureFormat(const JsonValue& Value, const std::string& Path) noexcept(false)
+{
+    const std::string& Str = Value.AsString(Path);
+    // Accept both full ("TEX_FORMAT_RGBA8_UNORM") and short ("RGBA8_UNORM") format names
+    const std::string FullName = Str.compare(0, 11, "TEX_FORMAT_") == 0 ? Str : "TEX_FORMAT_" + Str;
+    for (int Fmt = TEX_FORMAT_UNKNOWN + 1; Fmt < TEX_FORMAT_NUM_FORMATS; ++Fmt)
+    {
+        if (FullName == GetTextureFormatAttribs(static_cast<TEXTURE_FORMAT>(Fmt)).Name)
+            return static_cast<TEXTURE_FORMAT>(Fmt);
+    }
+    LOG_ERROR_AND_THROW("'", Str, "' is not a valid texture format for '", Path, "'");
+}
+
+std::string ResolvePath(const std::string& BaseDir, const std::string& Path)
+{
+    if (BaseDir.empty() || FileSystem::IsPathAbsolute(Path.c_str()))
+        return Path;
+
+    return FileSystem::SimplifyPath((BaseDir + FileSystem::SlashSymbol + Path).c_str());
+}
+
+ArchiveManifest::ShaderInfo ReadShader(const JsonValue& Value, const std::string& Path) noexcept(false)
+{
+    ObjectReader Reader{Value, Path};
+
+    ArchiveManifest::ShaderInfo Shader;
+    Shader.Name                       = Reader.GetString("name");
+    Shader.FilePath                   = Reader.GetString("file");
+    Shader.EntryPoint                 = Reader.GetString("entry_point", "main");
+    Shader.Type                       = Reader.GetEnum("type", ShaderStageNames, SHADER_TYPE_UNKNOWN);
+    Shader.SourceLanguage             = Reader.GetEnum("language", SourceLanguageNames, SHADER_SOURCE_LANGUAGE_DEFAULT);
+    Shader.Compiler                   = Reader.GetEnum("compiler", CompilerNames, SHADER_COMPILER_DEFAULT);
+    Shader.UseCombinedTextureSamplers = Reader.GetBool("use_combined_texture_samplers", false);
+    Shader.Archive                    = Reader.GetBool("archive", false);
+
+    if (Shader.Type == SHADER_TYPE_UNKNOWN || !IsPowerOfTwo(Shader.Type))
+        LOG_ERROR_AND_THROW("'", Reader.GetMemberPath("type"), "' must specify a single shader stage");
+
+    if (const JsonValue* pMacros = Reader.Find("macros"))
+    {
+        const std::string MacrosPath = Reader.GetMemberPath("macros");
+        for (const auto& Macro : pMacros->AsObject(MacrosPath))
+        {
+            const std::string MacroPath = MacrosPath + '.' + Macro.first;
+            if (Macro.second.IsNumber())
+            {
+                // Format integer values without the fractional part
+                const double Number = Macro.second.AsNumber(MacroPath);
+                Shader.Macros.emplace_back(Macro.first, Number == static_cast<double>(static_cast<Int64>(Number)) ?
+                                                            std::to_string(static_cast<Int64>(Number)) :
+                                                            std::to_string(Number));
+            }
+            else if (Macro.second.IsBool())
+            {
+                Shader.Macros.emplace_back(Macro.first, Macro.second.AsBool(MacroPath) ? "1" : "0");
+            }
+            else
+            {
+                Shader.Macros.emplace_back(Macro.first, Macro.second.AsString(MacroPath));
+            }
+        }
+    }
+
+    Reader.CheckUnusedMembers();
+    return Shader;
+}
+
+PipelineResourceSignatureDescX ReadSignature(const JsonValue& Value, const std::string& Path) noexcept(false)
+{
+    ObjectReader Reader{Value, Path};
+
+    PipelineResourceSignatureDescX Desc{Reader.GetString("name")};
+    Desc.BindingIndex               = static_cast<Uint8>(Reader.GetUint("binding_index", 0));
+    Desc.UseCombinedTextureSamplers = Reader.GetBool("use_combined_texture_samplers", false);
+
+    ReadArray(Reader, "resources", [&Desc](const JsonValue& Res, const std::string& ResPath) {
+        ObjectReader ResReader{Res, ResPath};
+
+        const std::string Name = ResReader.GetString("name");
+        Desc.AddResource(ResReader.GetFlags("stages", ShaderStageNames, SHADER_TYPE_UNKNOWN),
+                         Name.c_str(),
+                         ResReader.GetUint("array_size", 1),
+                         ResReader.GetEnum("type", ResourceTypeNames, SHADER_RESOURCE_TYPE_UNKNOWN),
+                         ResReader.GetEnum("var_type", VariableTypeNames, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE));
+        ResReader.CheckUnusedMembers();
+    });
+
+    ReadArray(Reader, "immutable_samplers", [&Desc](const JsonValue& Sam, const std::string& SamPath) {
+        ObjectReader SamReader{Sam, SamPath};
+
+        const std::string          Name    = SamReader.GetString("name");
+        const SHADER_TYPE          Stages  = SamReader.GetFlags("stages", ShaderStageNames, SHADER_TYPE_UNKNOWN);
+        const FILTER_TYPE          Filter  = SamReader.GetEnum("filter", FilterNames, FILTER_TYPE_LINEAR);
+        const TEXTURE_ADDRESS_MODE Address = SamReader.GetEnum("address", AddressModeNames, TEXTURE_ADDRESS_CLAMP);
+
+        SamplerDesc SamDesc{Filter, Filter, Filter, Address, Address, Address};
+        SamDesc.MaxAnisotropy = SamReader.GetUint("max_anisotropy", SamDesc.MaxAnisotropy);
+        Desc.AddImmutableSampler(Stages, Name.c_str(), SamDesc);
+        SamReader.CheckUnusedMembers();
+    });
+
+    Reader.CheckUnusedMembers();
+    return Desc;
+}
+
+ArchiveManifest::PipelineInfo ReadPipeline(const JsonValue& Value, const std::string& Path) noexcept(false)
+{
+    ObjectReader Reader{Value, Path};
+
+    ArchiveManifest::PipelineInfo Pipeline;
+    Pipeline.Type = Reader.GetEnum("type", PipelineTypeNames, PIPELINE_TYPE_GRAPHICS);
+
+    const std::string Name = Reader.GetString("name");
+
+    PipelineResourceLayoutDesc ResourceLayout;
+    ResourceLayout.DefaultVariableType = Reader.GetEnum("default_variable_type", VariableTypeNames, SHADER_RESOURCE_VARIABLE_TYPE_STATIC);
+
+    if (Reader.GetBool("strip_reflection", false))
+        Pipeline.ArchiveFlags |= PSO_ARCHIVE_FLAG_STRIP_REFLECTION;
+    if (Reader.GetBool("do_not_pack_signatures", false))
+        Pipeline.ArchiveFlags |= PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES;
+
+    {
+        const std::string              ShadersPath = Reader.GetMemberPath("shaders");
+        ObjectReader                   ShadersReader{Reader.Get("shaders"), ShadersPath};
+        for (const EnumName<SHADER_TYPE>& Stage : ShaderStageNames)
+        {
+            if (Stage.Value == SHADER_TYPE_ALL)
+                continue;
+            if (const JsonValue* pShader = ShadersReader.Find(Stage.Name))
+                Pipeline.Shaders.emplace_back(Stage.Value, pShader->AsString(ShadersReader.GetMemberPath(Stage.Name)));
+        }
+        ShadersReader.CheckUnusedMembers();
+    }
+
+    ReadArray(Reader, "signatures", [&Pipeline](const JsonValue& Sign, const std::string& SignPath) {
+        Pipeline.Signatures.emplace_back(Sign.AsString(SignPath));
+    });
+
+    if (Pipeline.Type == PIPELINE_TYPE_COMPUTE)
+    {
+        Pipeline.ComputeCI.SetName(Name);
+        Pipeline.ComputeCI.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+        Pipeline.ComputeCI.SetResourceLayout(ResourceLayout);
+    }
+    else
+    {
+        GraphicsPipelineStateCreateInfoX& CI = Pipeline.GraphicsCI;
+
+        CI.SetName(Name);
+        CI.PSODesc.PipelineType = Pipeline.Type;
+        CI.SetResourceLayout(ResourceLayout);
+
+        ReadArray(Reader, "rtv_formats", [&CI](const JsonValue& Fmt, const std::string& FmtPath) {
+            CI.AddRenderTarget(ParseTextureFormat(Fmt, FmtPath));
+        });
+        if (const JsonValue* pDSVFormat = Reader.Find("dsv_format"))
+            CI.SetDepthFormat(ParseTextureFormat(*pDSVFormat, Reader.GetMemberPath("dsv_format")));
+
+        CI.SetPrimitiveTopology(Reader.GetEnum("topology", TopologyNames, PRIMITIVE_TOPOLOGY_TRIANGLE_LIST));
+
+        RasterizerStateDesc RSDesc;
+        RSDesc.CullMode = Reader.GetEnum("cull_mode", CullModeNames, RSDesc.CullMode);
+        RSDesc.FrontCounterClockwise = Reader.GetBool("front_counter_clockwise", RSDesc.FrontCounterClockwise);
+        CI.SetRasterizerDesc(RSDesc);
+
+        DepthStencilStateDesc DSDesc;
+        DSDesc.DepthEnable      = Reader.GetBool("depth_enable", DSDesc.DepthEnable);
+        DSDesc.DepthWriteEnable = Reader.GetBool("depth_write", DSDesc.DepthWriteEnable);
+        CI.SetDepthStencilDesc(DSDesc);
+
+        InputLayoutDescX InputLayout;
+        ReadArray(Reader, "input_layout", [&InputLayout](const JsonValue& Elem, const std::string& ElemPath) {
+            ObjectReader ElemReader{Elem, ElemPath};
+
+            LayoutElement Element;
+            Element.InputIndex    = ElemReader.GetUint("input_index", 0);
+            Element.BufferSlot    = ElemReader.GetUint("buffer_slot", 0);
+            Element.NumComponents = ElemReader.GetUint("num_components", 0);
+            Element.ValueType     = ElemReader.GetEnum("value_type", ValueTypeNames, VT_FLOAT32);
+            Element.IsNormalized  = ElemReader.GetBool("normalized", Element.ValueType != VT_FLOAT32 && Element.ValueType != VT_FLOAT16);
+            InputLayout.Add(Element);
+            ElemReader.CheckUnusedMembers();
+        });
+        CI.SetInputLayout(InputLayout);
+    }
+
+    Reader.CheckUnusedMembers();
+    return Pipeline;
+}
+
+} // namespace
+
+ArchiveManifest ArchiveManifest::Load(const char* FilePath) noexcept(false)
+{
+    VERIFY_EXPR(FilePath != nullptr);
+
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create();
+    {
+        FileWrapper File{FilePath};
+        if (!File || !File->Read(pData))
+            LOG_ERROR_AND_THROW("Failed to read manifest file '", FilePath, "'");
+    }
+
+    const JsonValue Root = JsonValue::Parse(pData->GetConstDataPtr<char>(), pData->GetSize(), FilePath);
+
+    std::string ManifestDir;
+    FileSystem::GetPathComponents(FilePath, &ManifestDir, nullptr);
+
+    ArchiveManifest Manifest;
+    ObjectReader    Reader{Root, ""};
+
+    Manifest.OutputPath     = ResolvePath(ManifestDir, Reader.GetString("output", ""));
+    Manifest.ContentVersion = Reader.GetUint("content_version", 0);
+    Manifest.DeviceFlags    = Reader.GetFlags("devices", DeviceNames, ARCHIVE_DEVICE_DATA_FLAG_NONE);
+    if (Manifest.DeviceFlags == ARCHIVE_DEVICE_DATA_FLAG_NONE)
+        LOG_ERROR_AND_THROW("'devices' must specify at least one device type");
+
+    ReadArray(Reader, "search_directories", [&](const JsonValue& Dir, const std::string& Path) {
+        Manifest.SearchDirectories.emplace_back(ResolvePath(ManifestDir, Dir.AsString(Path)));
+    });
+    if (Manifest.SearchDirectories.empty())
+        Manifest.SearchDirectories.emplace_back(ManifestDir.empty() ? "." : ManifestDir);
+
+    ReadArray(Reader, "shaders", [&Manifest](const JsonValue& Shader, const std::string& Path) {
+        Manifest.Shaders.emplace_back(ReadShader(Shader, Path));
+    });
+
+    ReadArray(Reader, "signatures", [&Manifest](const JsonValue& Sign, const std::string& Path) {
+        Manifest.Signatures.emplace_back(ReadSignature(Sign, Path));
+    });
+
+    ReadArray(Reader, "pipelines", [&Manifest](const JsonValue& PSO, const std::string& Path) {
+        Manifest.Pipelines.emplace_back(ReadPipeline(PSO, Path));
+    });
+
+    Reader.CheckUnusedMembers();
+
+    // Validate object names and references
+    std::unordered_set<std::string> Names;
+    for (const ShaderInfo& Shader : Manifest.Shaders)
+    {
+        if (!Names.insert(Shader.Name).second)
+            LOG_ERROR_AND_THROW("Shader name '", Shader.Name, "' is not unique");
+    }
+
+    Names.clear();
+    for (const PipelineResourceSignatureDescX& Sign : Manifest.Signatures)
+    {
+        if (!Names.insert(Sign.Name).second)
+            LOG_ERROR_AND_THROW("Resource signature name '", Sign.Name, "' is not unique");
+    }
+
+    Names.clear();
+    for (const PipelineInfo& Pipeline : Manifest.Pipelines)
+    {
+        if (!Names.insert(Pipeline.GetName()).second)
+            LOG_ERROR_AND_THROW("Pipeline name '", Pipeline.GetName(), "' is not unique");
+
+        for (const auto& Shader : Pipeline.Shaders)
+        {
+            const ShaderInfo* pShader = Manifest.FindShader(Shader.second);
+            if (pShader == nullptr)
+                LOG_ERROR_AND_THROW("Pipeline '", Pipeline.GetName(), "' references unknown shader '", Shader.second, "'");
+            if (pShader->Type != Shader.first)
+                LOG_ERROR_AND_THROW("Shader '", Shader.second, "' is used as ", GetShaderTypeLiteralName(Shader.first),
+                                    " in pipeline '", Pipeline.GetName(), "', but its type is ", GetShaderTypeLiteralName(pShader->Type));
+        }
+
+        for (const std::string& Sign : Pipeline.Signatures)
+        {
+            if (Manifest.FindSignature(Sign) == nullptr)
+                LOG_ERROR_AND_THROW("Pipeline '", Pipeline.GetName(), "' references unknown resource signature '", Sign, "'");
+        }
+    }
+
+    return Manifest;
+}
+
+const ArchiveManifest::ShaderInfo* ArchiveManifest::FindShader(const std::string& Name) const
+{
+    for (const ShaderInfo& Shader : Shaders)
+    {
+        if (Shader.Name == Name)
+            return &Shader;
+    }
+    return nullptr;
+}
+
+const PipelineResourceSignatureDescX* ArchiveManifest::FindSignature(const std::string& Name) const
+{
+    for (const PipelineResourceSignatureDescX& Sign : Signatures)
+    {
+        if (Name == Sign.Name)
+            return &Sign;
+    }
+    return nullptr;
+}
+
+} // namespace Diligent
@@ -0,0 +1,421 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "JsonValue.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+class JsonParser
+{
+public:
+    JsonParser(const char* Text, size_t Length, const char* Location) :
+        m_pCurr{Text},
+        m_pEnd{Text + Length},
+        m_Location{Location != nullptr ? Location : ""}
+    {}
+
+    JsonValue ParseDocument() noexcept(false)
+    {
+        JsonValue Root = ParseValue();
+        SkipWhitespace();
+        if (m_pCurr != m_pEnd)
+            Error("unexpected characters after the end of the document");
+        return Root;
+    }
+
+private:
+    template <typename... ArgsType>
+    [[noreturn]] void Error(const ArgsType&... Args) const noexcept(false)
+    {
+        LOG_ERROR_AND_THROW(m_Location, '(', m_Line, ',', m_Column, "): ", Args...);
+    }
+
+    char Peek() const
+    {
+        return m_pCurr < m_pEnd ? *m_pCurr : '\0';
+    }
+
+    char Get()
+    {
+        if (m_pCurr >= m_pEnd)
+            Error("unexpected end of the document");
+
+        const char c = *m_pCurr++;
+        if (c == '\n')
+        {
+            ++m_Line;
+            m_Column = 1;
+        }
+        else
+        {
+            ++m_Column;
+        }
+        return c;
+    }
+
+    void Expect(char c)
+    {
+        if (Get() != c)
+            Error("'", c, "' expected");
+    }
+
+    void SkipWhitespace()
+    {
+        while (m_pCurr < m_pEnd)
+        {
+            const char c = *m_pCurr;
+            if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+            {
+                Get();
+            }
+            else if (c == '/' && m_pCurr + 1 < m_pEnd && m_pCurr[1] == '/')
+            {
+                while (m_pCurr < m_pEnd && *m_pCurr != '\n')
+                    Get();
+            }
+            else
+            {
+                break;
+            }
+        }
+    }
+
+    JsonValue ParseValue()
+    {
+        SkipWhitespace();
+
+        JsonValue Value;
+        switch (Peek())
+        {
+            case '{':
+                ParseObject(Value);
+                break;
+
+            case '[':
+                ParseArray(Value);
+                break;
+
+            case '"':
+                Value.m_Type   = JsonValue::Type::String;
+                Value.m_String = ParseString();
+                break;
+
+            case 't':
+                ExpectKeyword("true");
+                Value.m_Type = JsonValue::Type::Bool;
+                Value.m_Bool = true;
+                break;
+
+            case 'f':
+                ExpectKeyword("false");
+                Value.m_Type = JsonValue::Type::Bool;
+                Value.m_Bool = false;
+                break;
+
+            case 'n':
+                ExpectKeyword("null");
+                break;
+
+            default:
+                Value.m_Type   = JsonValue::Type::Number;
+                Value.m_Number = ParseNumber();
+        }
+
+        return Value;
+    }
+
+    void ExpectKeyword(const char* Keyword)
+    {
+        for (const char* c = Keyword; *c != '\0'; ++c)
+        {
+            if (Peek() != *c)
+                Error("'", Keyword, "' expected");
+            Get();
+        }
+    }
+
+    void ParseObject(JsonValue& Value)
+    {
+        Value.m_Type = JsonValue::Type::Object;
+
+        Expect('{');
+        SkipWhitespace();
+        if (Peek() == '}')
+        {
+            Get();
+            return;
+        }
+
+        while (true)
+        {
+            SkipWhitespace();
+            if (Peek() != '"')
+                Error("member name expected");
+
+            std::string Name = ParseString();
+            for (const auto& Member : Value.m_Object)
+            {
+                if (Member.first == Name)
+                    Error("duplicate member '", Name, "'");
+            }
+
+            SkipWhitespace();
+            Expect(':');
+            Value.m_Object.emplace_back(std::move(Name), ParseValue());
+
+            SkipWhitespace();
+            const char c = Get();
+            if (c == '}')
+                break;
+            if (c != ',')
+                Error("',' or '}' expected");
+        }
+    }
+
+    void ParseArray(JsonValue& Value)
+    {
+        Value.m_Type = JsonValue::Type::Array;
+
+        Expect('[');
+        SkipWhitespace();
+        if (Peek() == ']')
+        {
+            Get();
+            return;
+        }
+
+        while (true)
+        {
+            Value.m_Array.emplace_back(ParseValue());
+
+            SkipWhitespace();
+            const char c = Get();
+            if (c == ']')
+                break;
+            if (c != ',')
+                Error("',' or ']' expected");
+        }
+    }
+
+    std::string ParseString()
+    {
+        Expect('"');
+
+        std::string Str;
+        while (true)
+        {
+            const char c = Get();
+            if (c == '"')
+                break;
+
+            if (c == '\n')
+                Error("unterminated string");
+
+            if (c != '\\')
+            {
+                Str.push_back(c);
+                continue;
+            }
+
+            const char Esc = Get();
+            switch (Esc)
+            {
+                // clang-format off
+                case '"': Str.push_back('"'); break;
+                case '\\': Str.push_back('\\'); break;
+                case '/': Str.push_back('/'); break;
+                case 'b': Str.push_back('\b'); break;
+                case 'f': Str.push_back('\f'); break;
+                case 'n': Str.push_back('\n'); break;
+                case 'r': Str.push_back('\r'); break;
+                case 't': Str.push_back('\t'); break;
+                // clang-format on
+
+                case 'u':
+                {
+                    Uint32 Code = 0;
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        const char h = Get();
+                        Code <<= 4;
+                        if (h >= '0' && h <= '9')
+                            Code |= h - '0';
+                        else if (h >= 'a' && h <= 'f')
+                            Code |= h - 'a' + 10;
+                        else if (h >= 'A' && h <= 'F')
+                            Code |= h - 'A' + 10;
+                        else
+                            Error("invalid hexadecimal digit in \\u escape sequence");
+                    }
+                    if (Code > 0x7F)
+                        Error("\\u escape sequences are only supported for ASCII characters");
+                    Str.push_back(static_cast<char>(Code));
+                    break;
+                }
+
+                default:
+                    Error("invalid escape sequence '\\", Esc, "'");
+            }
+        }
+
+        return Str;
+    }
+
+    double ParseNumber()
+    {
+        const char* pStart = m_pCurr;
+        if (Peek() == '-')
+            Get();
+
+        if (Peek() < '0' || Peek() > '9')
+            Error("value expected");
+
+        auto SkipDigits = [this]() {
+            while (Peek() >= '0' && Peek() <= '9')
+                Get();
+        };
+
+        SkipDigits();
+        if (Peek() == '.')
+        {
+            Get();
+            SkipDigits();
+        }
+        if (Peek() == 'e' || Peek() == 'E')
+        {
+            Get();
+            if (Peek() == '+' || Peek() == '-')
+                Get();
+            SkipDigits();
+        }
+
+        // The document is not null-terminated, so copy the number to parse it
+        const std::string NumStr{pStart, m_pCurr};
+        return std::strtod(NumStr.c_str(), nullptr);
+    }
+
+private:
+    const char*       m_pCurr = nullptr;
+    const char* const m_pEnd  = nullptr;
+    const std::string m_Location;
+
+    Uint32 m_Line   = 1;
+    Uint32 m_Column = 1;
+};
+
+JsonValue JsonValue::Parse(const char* Text, size_t Length, const char* Location) noexcept(false)
+{
+    return JsonParser{Text, Length, Location}.ParseDocument();
+}
+
+namespace
+{
+
+const char* GetJsonTypeName(JsonValue::Type Type)
+{
+    switch (Type)
+    {
+        // clang-format off
+        case JsonValue::Type::Null: return "null";
+        case JsonValue::Type::Bool: return "boolean";
+        case JsonValue::Type::Number: return "number";
+        case JsonValue::Type::String: return "string";
+        case JsonValue::Type::Array: return "array";
+        case JsonValue::Type::Object: return "object";
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected JSON value type");
+            return "unknown";
+    }
+}
+
+void CheckType(const JsonValue& Value, JsonValue::Type Expected, const std::string& Path)
+{
+    if (Value.GetType() != Expected)
+        LOG_ERROR_AND_THROW("'", Path, "' must be ", GetJsonTypeName(Expected), ", but it is ", GetJsonTypeName(Value.GetType()));
+}
+
+} // namespace
+
+bool JsonValue::AsBool(const std::string& Path) const noexcept(false)
+{
+    CheckType(*this, Type::Bool, Path);
+    return m_Bool;
+}
+
+double JsonValue::AsNumber(const std::string& Path) const noexcept(false)
+{
+    CheckType(*this, Type::Number, Path);
+    return m_Number;
+}
+
+Uint32 JsonValue::AsUint(const std::string& Path) const noexcept(false)
+{
+    const double Number = AsNumber(Path);
+    if (Number < 0 || Number > 0xFFFFFFFFu || std::floor(Number) != Number)
+        LOG_ERROR_AND_THROW("'", Path, "' must be a non-negative 32-bit integer, but it is ", Number);
+    return static_cast<Uint32>(Number);
+}
+
+const std::string& JsonValue::AsString(const std::string& Path) const noexcept(false)
+{
+    CheckType(*this, Type::String, Path);
+    return m_String;
+}
+
+const std::vector<JsonValue>& JsonValue::AsArray(const std::string& Path) const noexcept(false)
+{
+    CheckType(*this, Type::Array, Path);
+    return m_Array;
+}
+
+const std::vector<std::pair<std::string, JsonValue>>& JsonValue::AsObject(const std::string& Path) const noexcept(false)
+{
+    CheckType(*this, Type::Object, Path);
+    return m_Object;
+}
+
+const JsonValue* JsonValue::Find(const char* Name) const
+{
+    if (m_Type != Type::Object)
+        return nullptr;
+
+    for (const auto& Member : m_Object)
+    {
+        if (Member.first == Name)
+            return &Member.second;
+    }
+    return nullptr;
+}
+
+} // namespace Diligent
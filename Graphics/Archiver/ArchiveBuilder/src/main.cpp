@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "ArchiveBuilder.hpp"
+#include "ArchiverFactoryLoader.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+void PrintUsage()
+{
+    std::cout << "Usage: Diligent-ArchiveBuilder [options] <manifest.json>\n"
+                 "Options:\n"
+                 "  -o, --output <path>  Output archive path (overrides the manifest)\n"
+                 "  --cache <dir>        Cache directory (default: <output>.cache)\n"
+                 "  -j <N>               Number of compilation threads (default: auto)\n"
+                 "  --force              Rebuild all objects\n"
+                 "  -h, --help           Print this message\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    ArchiveBuilderSettings Settings;
+    const char*            ManifestPath = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* Arg      = argv[i];
+        auto        GetValue = [&]() -> const char* {
+            if (i + 1 >= argc)
+            {
+                std::cerr << "Missing value for option " << Arg << '\n';
+                std::exit(EXIT_FAILURE);
+            }
+            return argv[++i];
+        };
+
+        if (strcmp(Arg, "-o") == 0 || strcmp(Arg, "--output") == 0)
+            Settings.OutputPath = GetValue();
+        else if (strcmp(Arg, "--cache") == 0)
+            Settings.CacheDirectory = GetValue();
+        else if (strcmp(Arg, "-j") == 0)
+            Settings.NumThreads = static_cast<Uint32>(std::atoi(GetValue()));
+        else if (strcmp(Arg, "--force") == 0)
+            Settings.ForceRebuild = true;
+        else if (strcmp(Arg, "-h") == 0 || strcmp(Arg, "--help") == 0)
+        {
+            PrintUsage();
+            return EXIT_SUCCESS;
+        }
+        else if (Arg[0] == '-')
+        {
+            std::cerr << "Unknown option " << Arg << '\n';
+            PrintUsage();
+            return EXIT_FAILURE;
+        }
+        else if (ManifestPath == nullptr)
+            ManifestPath = Arg;
+        else
+        {
+            std::cerr << "Only one manifest can be specified\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (ManifestPath == nullptr)
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    IArchiverFactory* pArchiverFactory = LoadAndGetArchiverFactory();
+    if (pArchiverFactory == nullptr)
+    {
+        std::cerr << "Failed to load the archiver\n";
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        const ArchiveManifest Manifest = ArchiveManifest::Load(ManifestPath);
+
+        ArchiveBuilder Builder{pArchiverFactory, Manifest, Settings};
+        const bool     Succeeded = Builder.Build();
+
+        const ArchiveBuilder::Statistics& Stats = Builder.GetStatistics();
+        std::cout << Stats.NumObjects << " objects: " << Stats.NumCompiled << " compiled, " << Stats.NumCached << " cached"
+                  << (Stats.UpToDate ? " (up to date)" : "") << '\n';
+
+        return Succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch (...)
+    {
+        // The error has already been logged
+        return EXIT_FAILURE;
+    }
+}
@@ -178,6 +178,10 @@ public:
         return m_RenderDevices[Type];
     }
 
+    // Waits until all tasks are finished. The tasks are run by the threads of the shader compilation
+    // thread pool, so the method must not be called from one of the pool threads.
+    void WaitForCompilationTasks(const std::vector<RefCntAutoPtr<IAsyncTask>>& Tasks) const;
+
 protected:
     static PipelineResourceBinding ResDescToPipelineResBinding(const PipelineResourceDesc& ResDesc, SHADER_TYPE Stages, Uint32 Register, Uint32 Space);
 
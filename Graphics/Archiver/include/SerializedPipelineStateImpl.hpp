@@ -167,6 +167,16 @@ private:
     void Initialize(const PSOCreateInfoType&        CreateInfo,
                     const PipelineStateArchiveInfo& ArchiveInfo);
 
+    // Patches shaders for a single device. Shaders for different devices may be patched in parallel
+    // when the pipeline uses explicit resource signatures.
+    template <typename PSOCreateInfoType>
+    void PatchShaders(const PSOCreateInfoType& CreateInfo, ARCHIVE_DEVICE_DATA_FLAGS DeviceFlag);
+
+    // Initializes the device-independent data after shaders have been patched for all devices.
+    template <typename PSOCreateInfoType>
+    void InitializeCommonData(const PSOCreateInfoType&        CreateInfo,
+                              const PipelineStateArchiveInfo& ArchiveInfo);
+
     template <typename CreateInfoType>
     void PatchShadersVk(const CreateInfoType& CreateInfo) noexcept(false);
 
@@ -227,6 +227,11 @@ struct SerializationDeviceCreateInfo
     SerializationDeviceMtlInfo Metal;
 
     /// An optional thread pool for asynchronous shader and pipeline state compilation.
+
+    /// When the thread pool is available, shaders and pipeline states that target several devices
+    /// are compiled for all devices in parallel, and synchronous creation waits for the pool tasks.
+    /// If the pool has no threads of its own, the application must process its tasks in other
+    /// threads while the objects are created.
     IThreadPool* pAsyncShaderCompilationThreadPool DEFAULT_INITIALIZER(nullptr);
 
     /// The maximum number of threads that can be used to compile shaders.
@@ -196,6 +196,15 @@ void SerializationDeviceImpl::CreateSerializedResourceSignature(SerializedResour
     pSignatureImpl->QueryInterface(IID_PipelineResourceSignature, reinterpret_cast<IObject**>(ppSignature));
 }
 
+void SerializationDeviceImpl::WaitForCompilationTasks(const std::vector<RefCntAutoPtr<IAsyncTask>>& Tasks) const
+{
+    for (const RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+    {
+        if (pTask)
+            pTask->WaitForCompletion();
+    }
+}
+
 void SerializationDeviceImpl::CreateGraphicsPipelineState(const GraphicsPipelineStateCreateInfo& PSOCreateInfo,
                                                           const PipelineStateArchiveInfo&        ArchiveInfo,
                                                           IPipelineState**                       ppPipelineState)
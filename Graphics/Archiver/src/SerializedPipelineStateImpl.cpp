@@ -25,6 +25,8 @@
  */
 
 #include <bitset>
+#include <memory>
+#include <atomic>
 
 #include "SerializedPipelineStateImpl.hpp"
 #include "Constants.h"
@@ -34,6 +36,7 @@
 #include "PSOSerializer.hpp"
 #include "Align.hpp"
 #include "FileSystem.hpp"
+#include "PlatformMisc.hpp"
 
 namespace Diligent
 {
@@ -187,70 +190,71 @@ std::string GetPSODumpFolder(const std::string& Root, const PipelineStateDesc& P
 }
 #endif
 
-} // namespace
-
-template <typename PSOCreateInfoType>
-void SerializedPipelineStateImpl::Initialize(const PSOCreateInfoType&        CreateInfo,
-                                             const PipelineStateArchiveInfo& ArchiveInfo)
+ARCHIVE_DEVICE_DATA_FLAGS GetPatchDeviceFlags(ARCHIVE_DEVICE_DATA_FLAGS DeviceFlags)
 {
-    ARCHIVE_DEVICE_DATA_FLAGS DeviceBits = ArchiveInfo.DeviceFlags;
-    if ((DeviceBits & ARCHIVE_DEVICE_DATA_FLAG_GL) != 0 && (DeviceBits & ARCHIVE_DEVICE_DATA_FLAG_GLES) != 0)
+    if ((DeviceFlags & ARCHIVE_DEVICE_DATA_FLAG_GL) != 0 && (DeviceFlags & ARCHIVE_DEVICE_DATA_FLAG_GLES) != 0)
     {
         // OpenGL and GLES use the same device data. Clear one flag to avoid shader duplication.
-        DeviceBits &= ~ARCHIVE_DEVICE_DATA_FLAG_GLES;
+        DeviceFlags &= ~ARCHIVE_DEVICE_DATA_FLAG_GLES;
     }
+    return DeviceFlags;
+}
 
-    m_Data.Aux.NoShaderReflection = (ArchiveInfo.PSOFlags & PSO_ARCHIVE_FLAG_STRIP_REFLECTION) != 0;
-    while (DeviceBits != 0)
-    {
-        const ARCHIVE_DEVICE_DATA_FLAGS Flag = ExtractLSB(DeviceBits);
+} // namespace
 
-        static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == 1 << 7, "Please update the switch below to handle the new data type");
-        switch (Flag)
-        {
+template <typename PSOCreateInfoType>
+void SerializedPipelineStateImpl::PatchShaders(const PSOCreateInfoType& CreateInfo, ARCHIVE_DEVICE_DATA_FLAGS Flag)
+{
+    static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == 1 << 7, "Please update the switch below to handle the new data type");
+    switch (Flag)
+    {
 #if D3D11_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
-                PatchShadersD3D11(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
+            PatchShadersD3D11(CreateInfo);
+            break;
 #endif
 #if D3D12_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
-                PatchShadersD3D12(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
+            PatchShadersD3D12(CreateInfo);
+            break;
 #endif
 #if GL_SUPPORTED || GLES_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_GL:
-            case ARCHIVE_DEVICE_DATA_FLAG_GLES:
-                PatchShadersGL(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_GL:
+        case ARCHIVE_DEVICE_DATA_FLAG_GLES:
+            PatchShadersGL(CreateInfo);
+            break;
 #endif
 #if VULKAN_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
-                PatchShadersVk(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
+            PatchShadersVk(CreateInfo);
+            break;
 #endif
 #if METAL_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
-            case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
-                PatchShadersMtl(CreateInfo, ArchiveDeviceDataFlagToArchiveDeviceType(Flag),
-                                GetPSODumpFolder(m_pSerializationDevice->GetMtlProperties().DumpFolder, GetDesc(), Flag));
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
+        case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
+            PatchShadersMtl(CreateInfo, ArchiveDeviceDataFlagToArchiveDeviceType(Flag),
+                            GetPSODumpFolder(m_pSerializationDevice->GetMtlProperties().DumpFolder, GetDesc(), Flag));
+            break;
 #endif
 #if WEBGPU_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_WEBGPU:
-                PatchShadersWebGPU(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_WEBGPU:
+            PatchShadersWebGPU(CreateInfo);
+            break;
 #endif
-            case ARCHIVE_DEVICE_DATA_FLAG_NONE:
-                UNEXPECTED("ARCHIVE_DEVICE_DATA_FLAG_NONE (0) should never occur");
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_NONE:
+            UNEXPECTED("ARCHIVE_DEVICE_DATA_FLAG_NONE (0) should never occur");
+            break;
 
-            default:
-                LOG_ERROR_MESSAGE("Unexpected render device type");
-                break;
-        }
+        default:
+            LOG_ERROR_MESSAGE("Unexpected render device type");
+            break;
     }
+}
 
+template <typename PSOCreateInfoType>
+void SerializedPipelineStateImpl::InitializeCommonData(const PSOCreateInfoType&        CreateInfo,
+                                                       const PipelineStateArchiveInfo& ArchiveInfo)
+{
     if (!m_Data.Common)
     {
         if (CreateInfo.ResourceSignaturesCount == 0)
@@ -309,8 +313,19 @@ void SerializedPipelineStateImpl::Initialize(const PSOCreateInfoType&        Cre
             VERIFY_EXPR(Ser.IsEnded());
         }
     }
+}
 
-    m_Status.store(PIPELINE_STATE_STATUS_READY);
+template <typename PSOCreateInfoType>
+void SerializedPipelineStateImpl::Initialize(const PSOCreateInfoType&        CreateInfo,
+                                             const PipelineStateArchiveInfo& ArchiveInfo)
+{
+    ARCHIVE_DEVICE_DATA_FLAGS DeviceBits = GetPatchDeviceFlags(ArchiveInfo.DeviceFlags);
+    while (DeviceBits != 0)
+    {
+        PatchShaders(CreateInfo, ExtractLSB(DeviceBits));
+    }
+
+    InitializeCommonData(CreateInfo, ArchiveInfo);
 }
 
 struct SerializedShaderStageInfo
@@ -383,8 +398,22 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
     ValidatePipelineStateArchiveInfo(CreateInfo, ArchiveInfo, pDevice->GetSupportedDeviceFlags());
     ValidatePSOCreateInfo(pDevice, CreateInfo);
 
+    m_Data.Aux.NoShaderReflection = (ArchiveInfo.PSOFlags & PSO_ARCHIVE_FLAG_STRIP_REFLECTION) != 0;
+
+    IThreadPool* const              pThreadPool = pDevice->GetShaderCompilationThreadPool();
+    const ARCHIVE_DEVICE_DATA_FLAGS DeviceBits  = GetPatchDeviceFlags(ArchiveInfo.DeviceFlags);
+
+    const bool IsAsync = (CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0 && pThreadPool != nullptr;
+    // Shaders for different devices are patched in parallel only when the pipeline uses explicit resource signatures.
+    // The default signature is shared by all devices and its common data is initialized by the device that creates it first,
+    // so the devices must be processed in a deterministic order.
+    const bool PatchInParallel =
+        pThreadPool != nullptr &&
+        CreateInfo.ResourceSignaturesCount != 0 &&
+        PlatformMisc::CountOneBits(static_cast<Uint32>(DeviceBits)) > 1;
+
     m_Status.store(PIPELINE_STATE_STATUS_COMPILING);
-    if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0 && pDevice->GetShaderCompilationThreadPool() != nullptr)
+    if (IsAsync || PatchInParallel)
     {
         // Collect all asynchronous shader compile tasks
         std::vector<SerializedShaderStageInfo> ShaderStages;
@@ -405,14 +434,54 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
                 ShaderCompileTasks.emplace_back(std::move(pCompileTask));
         }
 
+        using CreateInfoXType = typename PipelineStateCreateInfoXTraits<PSOCreateInfoType>::CreateInfoXType;
+        // The create info copy is shared by the patch tasks and the initialization task
+        std::shared_ptr<CreateInfoXType>   pCreateInfo  = std::make_shared<CreateInfoXType>(CreateInfo);
+        std::shared_ptr<std::atomic<bool>> pPatchFailed = std::make_shared<std::atomic<bool>>(false);
+
+        // Pipeline initialization task waits for all patch tasks if shaders are patched in parallel,
+        // or for all shader compile tasks otherwise.
+        std::vector<RefCntAutoPtr<IAsyncTask>> InitPrerequisites;
+        if (PatchInParallel)
+        {
+            std::vector<IAsyncTask*> ShaderCompileTaskPtrs{ShaderCompileTasks.begin(), ShaderCompileTasks.end()};
+            ARCHIVE_DEVICE_DATA_FLAGS Bits = DeviceBits;
+            while (Bits != ARCHIVE_DEVICE_DATA_FLAG_NONE)
+            {
+                const ARCHIVE_DEVICE_DATA_FLAGS Flag = ExtractLSB(Bits);
+                InitPrerequisites.emplace_back(
+                    EnqueueAsyncWork(
+                        pThreadPool,
+                        ShaderCompileTaskPtrs.data(), // Make sure that all asynchronous shader compile tasks are completed first
+                        static_cast<Uint32>(ShaderCompileTaskPtrs.size()),
+                        [this, pCreateInfo, pPatchFailed, Flag](Uint32 ThreadId) {
+                            try
+                            {
+                                PatchShaders(static_cast<const PSOCreateInfoType&>(*pCreateInfo), Flag);
+                            }
+                            catch (...)
+                            {
+                                pPatchFailed->store(true);
+                            }
+                            return ASYNC_TASK_STATUS_COMPLETE;
+                        }));
+            }
+        }
+        else
+        {
+            InitPrerequisites = std::move(ShaderCompileTasks);
+        }
+
         m_AsyncInitializer = AsyncInitializer::Start(
-            pDevice->GetShaderCompilationThreadPool(),
-            ShaderCompileTasks, // Make sure that all asynchronous shader compile tasks are completed first
+            pThreadPool,
+            InitPrerequisites,
             [this,
 #ifdef DILIGENT_DEBUG
              Shaders,
 #endif
-             CreateInfo = typename PipelineStateCreateInfoXTraits<PSOCreateInfoType>::CreateInfoXType{CreateInfo},
+             pCreateInfo,
+             pPatchFailed,
+             PatchInParallel,
              ArchiveInfo](Uint32 ThreadId) mutable //
             {
 #ifdef DILIGENT_DEBUG
@@ -424,7 +493,17 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
 #endif
                 try
                 {
-                    Initialize(static_cast<const PSOCreateInfoType&>(CreateInfo), ArchiveInfo);
+                    const PSOCreateInfoType& CreateInfo = static_cast<const PSOCreateInfoType&>(*pCreateInfo);
+                    if (PatchInParallel)
+                    {
+                        if (pPatchFailed->load())
+                            LOG_ERROR_AND_THROW("Failed to patch shaders for pipeline state '", CreateInfo.PSODesc.Name, "'.");
+                        InitializeCommonData(CreateInfo, ArchiveInfo);
+                    }
+                    else
+                    {
+                        Initialize(CreateInfo, ArchiveInfo);
+                    }
                     m_Status.store(PIPELINE_STATE_STATUS_READY);
                 }
                 catch (...)
@@ -433,8 +512,16 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
                 }
 
                 // Release create info objects
-                CreateInfo.Clear();
+                pCreateInfo->Clear();
             });
+
+        if (!IsAsync)
+        {
+            // Shaders are patched in parallel, but the pipeline was requested to be created synchronously.
+            pDevice->WaitForCompilationTasks({AsyncInitializer::GetAsyncTask(m_AsyncInitializer)});
+            if (GetStatus(/*WaitForCompletion = */ true) != PIPELINE_STATE_STATUS_READY)
+                LOG_ERROR_AND_THROW("Failed to initialize serialized pipeline state '", m_Name, "'.");
+        }
     }
     else
     {
@@ -449,7 +536,10 @@ INSTANTIATE_SERIALIZED_PSO_CTOR(TilePipelineStateCreateInfo);
 INSTANTIATE_SERIALIZED_PSO_CTOR(RayTracingPipelineStateCreateInfo);
 
 SerializedPipelineStateImpl::~SerializedPipelineStateImpl()
-{}
+{
+    // Make sure that the initialization task does not access the object after it is destroyed
+    GetStatus(/*WaitForCompletion = */ true);
+}
 
 void SerializedPipelineStateImpl::SerializeShaderCreateInfo(DeviceType              Type,
                                                             const ShaderCreateInfo& CI)
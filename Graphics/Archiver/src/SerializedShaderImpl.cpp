@@ -72,6 +72,19 @@ SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters
         DeviceFlags &= ~ARCHIVE_DEVICE_DATA_FLAG_GLES;
     }
 
+    // When the shader is compiled for multiple devices, start all compile tasks at once and wait for them
+    // below rather than compiling for one device after another. Compiler output is only available with
+    // synchronous compilation, so the shader is compiled sequentially if it is requested.
+    const bool CompileInParallel =
+        m_pDevice->GetShaderCompilationThreadPool() != nullptr &&
+        (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_ASYNCHRONOUS) == 0 &&
+        ppCompilerOutput == nullptr &&
+        PlatformMisc::CountOneBits(static_cast<Uint32>(DeviceFlags)) > 1;
+
+    ShaderCreateInfo DeviceShaderCI = ShaderCI;
+    if (CompileInParallel)
+        DeviceShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
     while (DeviceFlags != ARCHIVE_DEVICE_DATA_FLAG_NONE)
     {
         const ARCHIVE_DEVICE_DATA_FLAGS Flag = ExtractLSB(DeviceFlags);
@@ -81,39 +94,39 @@ SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters
         {
 #if D3D11_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
-                CreateShaderD3D11(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderD3D11(pRefCounters, DeviceShaderCI, ppCompilerOutput);
                 break;
 #endif
 
 #if D3D12_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
-                CreateShaderD3D12(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderD3D12(pRefCounters, DeviceShaderCI, ppCompilerOutput);
                 break;
 #endif
 
 #if GL_SUPPORTED || GLES_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_GL:
             case ARCHIVE_DEVICE_DATA_FLAG_GLES:
-                CreateShaderGL(pRefCounters, ShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_GL ? RENDER_DEVICE_TYPE_GL : RENDER_DEVICE_TYPE_GLES, ppCompilerOutput);
+                CreateShaderGL(pRefCounters, DeviceShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_GL ? RENDER_DEVICE_TYPE_GL : RENDER_DEVICE_TYPE_GLES, ppCompilerOutput);
                 break;
 #endif
 
 #if VULKAN_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
-                CreateShaderVk(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderVk(pRefCounters, DeviceShaderCI, ppCompilerOutput);
                 break;
 #endif
 
 #if METAL_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
             case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
-                CreateShaderMtl(pRefCounters, ShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS ? DeviceType::Metal_MacOS : DeviceType::Metal_iOS, ppCompilerOutput);
+                CreateShaderMtl(pRefCounters, DeviceShaderCI, Flag == ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS ? DeviceType::Metal_MacOS : DeviceType::Metal_iOS, ppCompilerOutput);
                 break;
 #endif
 
 #if WEBGPU_SUPPORTED
             case ARCHIVE_DEVICE_DATA_FLAG_WEBGPU:
-                CreateShaderWebGPU(pRefCounters, ShaderCI, ppCompilerOutput);
+                CreateShaderWebGPU(pRefCounters, DeviceShaderCI, ppCompilerOutput);
                 break;
 #endif
 
@@ -126,6 +139,13 @@ SerializedShaderImpl::SerializedShaderImpl(IReferenceCounters*      pRefCounters
                 break;
         }
     }
+
+    if (CompileInParallel)
+    {
+        m_pDevice->WaitForCompilationTasks(GetCompileTasks());
+        if (GetStatus(/*WaitForCompletion = */ true) != SHADER_STATUS_READY)
+            LOG_ERROR_AND_THROW("Failed to compile serialized shader '", ShaderCI.Desc.Name, "'.");
+    }
 }
 
 SerializedShaderImpl::~SerializedShaderImpl()
@@ -178,9 +198,14 @@ SerializedData SerializedShaderImpl::GetDeviceData(DeviceType Type) const
     DEV_CHECK_ERR(!IsCompiling(), "Device data is not available until compilation is complete. Use GetStatus() to check the shader status.");
 
     const std::unique_ptr<CompiledShader>& pCompiledShader = m_Shaders[static_cast<size_t>(Type)];
-    return pCompiledShader ?
-        pCompiledShader->Serialize(GetCreateInfo()) :
-        SerializedData{};
+    if (!pCompiledShader)
+        return SerializedData{};
+
+    // The shader name is stored in the named resource key. Exclude it from the device data so that
+    // identical byte code produced by differently named shaders is stored in the archive only once.
+    ShaderCreateInfo ShaderCI = GetCreateInfo();
+    ShaderCI.Desc.Name        = nullptr;
+    return pCompiledShader->Serialize(ShaderCI);
 }
 
 IShader* SerializedShaderImpl::GetDeviceShader(RENDER_DEVICE_TYPE Type) const
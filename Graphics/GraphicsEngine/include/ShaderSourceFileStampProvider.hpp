@@ -0,0 +1,63 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::IShaderSourceFileStampProvider interface
+
+#include <string>
+
+#include "../../GraphicsEngine/interface/Shader.h"
+#include "FileSystem.hpp"
+
+namespace Diligent
+{
+
+// {A72B7F74-460D-4012-82F7-51A73C1809D2}
+static constexpr INTERFACE_ID IID_ShaderSourceFileStampProvider =
+    {0xa72b7f74, 0x460d, 0x4012, {0x82, 0xf7, 0x51, 0xa7, 0x3c, 0x18, 0x9, 0xd2}};
+
+/// Optional interface of a shader source stream factory that loads files from the file system.
+
+/// The interface allows identifying the version of a source file without opening it,
+/// which lets shader source caches validate their entries with a single file stat.
+class IShaderSourceFileStampProvider : public IShaderSourceInputStreamFactory
+{
+public:
+    /// Resolves the file name the same way CreateInputStream does and returns the full path
+    /// to the file along with its modification time and size.
+
+    /// \param [in]  Name     - Source file name.
+    /// \param [out] FullPath - Full path to the file that CreateInputStream will open.
+    /// \param [out] Stat     - File modification time and size.
+    /// \return     true if the file was found and its stamp was retrieved, and false otherwise.
+    ///             In the latter case, the file must be read through CreateInputStream.
+    virtual bool GetFileStamp(const Char* Name, std::string& FullPath, FileStat& Stat) = 0;
+};
+
+} // namespace Diligent
@@ -3687,6 +3687,14 @@ struct EngineGLCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// * On Linux this affects the `DRI_PRIME` environment variable that is used by Mesa drivers that support PRIME.
     ADAPTER_TYPE PreferredAdapterType DEFAULT_INITIALIZER(ADAPTER_TYPE_UNKNOWN);
 
+    /// An optional cache of HLSL to GLSL conversion results, see IHLSL2GLSLConversionCache.
+
+    /// When the cache is provided, HLSL shaders whose source, entry point and conversion
+    /// flags have not changed are not converted again. Use IEngineFactoryOpenGL::CreateHLSL2GLSLConversionCache
+    /// to create the cache and IHLSL2GLSLConversionCache::Load to load the data stored by
+    /// the previous run.
+    struct IHLSL2GLSLConversionCache* pHLSL2GLSLConversionCache DEFAULT_INITIALIZER(nullptr);
+
 #if PLATFORM_WEB
     /// WebGL context attributes.
     WebGLContextAttribs WebGLAttribs;
@@ -4008,17 +4016,54 @@ struct DeviceFeaturesVk
     /// If the extension is not supported, the texture is initialized on the device.
     DEVICE_FEATURE_STATE HostImageCopy DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates whether the device supports VK_EXT_descriptor_buffer extension.
+
+    /// When this feature is enabled, shader resource bindings write descriptors directly into
+    /// host memory, and descriptors are bound from GPU-visible descriptor buffers instead of
+    /// descriptor sets allocated from descriptor pools.
+    /// The feature requires Vulkan 1.3.
+    DEVICE_FEATURE_STATE DescriptorBuffer DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates whether the device supports VK_EXT_graphics_pipeline_library extension.
+
+    /// When this feature is enabled, graphics pipelines are linked from vertex input,
+    /// pre-rasterization shader, fragment shader and fragment output libraries that are
+    /// cached by the device and shared between pipelines with matching state.
+    /// If the device has a shader compilation thread pool, the pipeline is first
+    /// fast-linked and the optimized pipeline is built in the background.
+    DEVICE_FEATURE_STATE GraphicsPipelineLibrary DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates whether the device supports VK_KHR_synchronization2 extension.
+
+    /// When this feature is enabled, pipeline barriers are recorded with vkCmdPipelineBarrier2KHR,
+    /// so that every image barrier keeps its own stage masks, and command buffers are submitted
+    /// with vkQueueSubmit2KHR.
+    /// If the application enables the synchronization2 feature in its own structure passed through
+    /// EngineVkCreateInfo::pDeviceExtensionFeatures, the engine uses the application's structure.
+    DEVICE_FEATURE_STATE Synchronization2 DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates whether the device supports VK_KHR_push_descriptor extension.
+
+    /// When this feature is enabled, the dynamic descriptor set of a resource signature with binding
+    /// index 0 that only contains dynamic variables and at most 32 descriptors is written to the command
+    /// buffer with vkCmdPushDescriptorSetKHR instead of being allocated from the dynamic descriptor pool.
+    /// Push descriptors are not used when DescriptorBuffer feature is enabled.
+    DEVICE_FEATURE_STATE PushDescriptor DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeaturesVk() noexcept {}
 
 #define ENUMERATE_VK_DEVICE_FEATURES(Handler) \
-    Handler(DynamicRendering) \
-    Handler(HostImageCopy)
+    Handler(DynamicRendering)        \
+    Handler(HostImageCopy)           \
+    Handler(DescriptorBuffer)        \
+    Handler(GraphicsPipelineLibrary) \
+    Handler(Synchronization2)        \
+    Handler(PushDescriptor)
 
     explicit constexpr DeviceFeaturesVk(DEVICE_FEATURE_STATE State) noexcept
     {
-        static_assert(sizeof(*this) == 2, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
+        static_assert(sizeof(*this) == 6, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
     #define INIT_FEATURE(Feature) Feature = State;
         ENUMERATE_VK_DEVICE_FEATURES(INIT_FEATURE)
     #undef INIT_FEATURE
@@ -4158,13 +4203,15 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
     /// is recycled. However, it may not became available again until
     /// all command buffers that reference the memory are executed by the GPU
     /// (which typically happens 1-2 frames later). If space in the dynamic
-    /// heap is exhausted, the engine will wait for up to 60 ms for the
-    /// space released from previous frames to become available. If the space
-    /// is still not available, the engine will fail to map the resource
-    /// and return null pointer.
-    /// The dynamic heap is shared by all contexts and cannot be resized
-    /// on the fly. The application should track the amount of dynamic memory
-    /// it needs and set this variable accordingly. When the application exits,
+    /// heap is exhausted, the engine allocates additional overflow buffers
+    /// that are released after they have not been used for several frames.
+    /// Descriptor set data written when the DescriptorBuffer feature is enabled
+    /// is always allocated from the dynamic heap itself: if it is exhausted, the
+    /// engine will wait for up to 60 ms for the space released from previous
+    /// frames to become available.
+    /// Overflow buffers are more expensive than the dynamic heap, so the application
+    /// should track the amount of dynamic memory it needs and set this variable
+    /// accordingly. When the application exits,
     /// the engine prints dynamic heap statistics to the log, for example:
     ///
     ///     Diligent Engine: Info: Dynamic memory manager usage stats:
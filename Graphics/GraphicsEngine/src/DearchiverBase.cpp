@@ -27,6 +27,7 @@
 #include "DearchiverBase.hpp"
 #include "PipelineStateBase.hpp"
 #include "PSOSerializer.hpp"
+#include "CPUProfiler.hpp"
 
 namespace Diligent
 {
@@ -650,6 +651,8 @@ void DearchiverBase::UnpackPipelineStateImpl(const PipelineStateUnpackInfo& Unpa
 
 bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVersion, bool MakeCopy)
 {
+    DILIGENT_PROFILE_SCOPE("DearchiverBase::LoadArchive");
+
     if (pArchiveData == nullptr)
         return false;
 
@@ -698,6 +701,8 @@ bool DearchiverBase::LoadArchive(const IDataBlob* pArchiveData, Uint32 ContentVe
 
 void DearchiverBase::UnpackPipelineState(const PipelineStateUnpackInfo& UnpackInfo, IPipelineState** ppPSO)
 {
+    DILIGENT_PROFILE_SCOPE("DearchiverBase::UnpackPipelineState");
+
     if (!VerifyPipelineStateUnpackInfo(UnpackInfo, ppPSO))
         return;
 
@@ -797,6 +802,11 @@ void DearchiverBase::UnpackShader(const ShaderUnpackInfo& UnpackInfo,
         VERIFY_EXPR(Ser.IsEnded());
     }
 
+    // Standalone shader byte code may be shared by multiple named shaders, in which case
+    // it does not contain the name, and the resource name is used instead.
+    if (ShaderCI.Desc.Name == nullptr || ShaderCI.Desc.Name[0] == '\0')
+        ShaderCI.Desc.Name = UnpackInfo.Name;
+
     if (!ModifyShaderDesc(ShaderCI.Desc, UnpackInfo))
         return;
 
@@ -26,6 +26,7 @@
  */
 
 #include "DefaultShaderSourceStreamFactory.h"
+#include "ShaderSourceFileStampProvider.hpp"
 
 #include "ObjectBase.hpp"
 #include "RefCntAutoPtr.hpp"
@@ -35,7 +36,7 @@
 namespace Diligent
 {
 
-class DefaultShaderSourceStreamFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+class DefaultShaderSourceStreamFactory final : public ObjectBase<IShaderSourceFileStampProvider>
 {
 public:
     DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories);
@@ -46,14 +47,16 @@ public:
                                                        CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
                                                        IFileStream**                           ppStream) override final;
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, ObjectBase<IShaderSourceInputStreamFactory>)
+    virtual bool GetFileStamp(const Char* Name, std::string& FullPath, FileStat& Stat) override final;
+
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_IShaderSourceInputStreamFactory, IID_ShaderSourceFileStampProvider, ObjectBase<IShaderSourceFileStampProvider>)
 
 private:
     std::vector<String> m_SearchDirectories;
 };
 
 DefaultShaderSourceStreamFactory::DefaultShaderSourceStreamFactory(IReferenceCounters* pRefCounters, const Char* SearchDirectories) :
-    ObjectBase<IShaderSourceInputStreamFactory>(pRefCounters)
+    ObjectBase<IShaderSourceFileStampProvider>(pRefCounters)
 {
     FileSystem::SplitPathList(SearchDirectories,
                               [&](const char* Path, size_t Len) //
@@ -120,6 +123,30 @@ void DefaultShaderSourceStreamFactory::CreateInputStream2(const Char*
     }
 }
 
+bool DefaultShaderSourceStreamFactory::GetFileStamp(const Char* Name, std::string& FullPath, FileStat& Stat)
+{
+    // Use the same search order as CreateInputStream2
+    if (FileSystem::IsPathAbsolute(Name))
+    {
+        if (!FileSystem::GetFileStat(Name, Stat))
+            return false;
+        FullPath = Name;
+        return true;
+    }
+
+    for (const std::string& SearchDir : m_SearchDirectories)
+    {
+        std::string Path = SearchDir + ((Name[0] == '\\' || Name[0] == '/') ? Name + 1 : Name);
+        if (FileSystem::GetFileStat(Path.c_str(), Stat))
+        {
+            FullPath = std::move(Path);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void CreateDefaultShaderSourceStreamFactory(const Char*                       SearchDirectories,
                                             IShaderSourceInputStreamFactory** ppShaderSourceStreamFactory)
 {
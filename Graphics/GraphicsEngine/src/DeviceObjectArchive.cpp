@@ -28,6 +28,8 @@
 
 #include <algorithm>
 #include <sstream>
+#include <functional>
+#include <unordered_map>
 
 #include "Shader.h"
 #include "EngineMemory.h"
@@ -567,20 +569,46 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
     IMemoryAllocator&      Allocator = GetRawAllocator();
     DynamicLinearAllocator DynAllocator{Allocator, 512};
 
-    // Copy shaders
-    std::array<Uint32, static_cast<size_t>(DeviceType::Count)> ShaderBaseIndices{};
+    // Copy shaders. Byte code that is already present in this archive is not copied again,
+    // and the source shader index is remapped to the existing entry instead.
+    std::array<std::vector<Uint32>, static_cast<size_t>(DeviceType::Count)> ShaderIndexRemap;
     for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
     {
         const auto& SrcShaders = Src.m_DeviceShaders[i];
         auto&       DstShaders = m_DeviceShaders[i];
-        ShaderBaseIndices[i]   = static_cast<Uint32>(DstShaders.size());
         if (SrcShaders.empty())
             continue;
+
+        // Reserve space upfront so that references to the existing elements stay valid
         DstShaders.reserve(DstShaders.size() + SrcShaders.size());
+
+        std::unordered_map<std::reference_wrapper<const SerializedData>, Uint32, SerializedData::Hasher, std::equal_to<SerializedData>> BytecodeToIdx;
+        BytecodeToIdx.reserve(DstShaders.size() + SrcShaders.size());
+        for (Uint32 idx = 0; idx < DstShaders.size(); ++idx)
+            BytecodeToIdx.emplace(DstShaders[idx], idx);
+
+        std::vector<Uint32>& Remap = ShaderIndexRemap[i];
+        Remap.reserve(SrcShaders.size());
         for (const SerializedData& SrcShader : SrcShaders)
-            DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+        {
+            auto it = BytecodeToIdx.find(SrcShader);
+            if (it == BytecodeToIdx.end())
+            {
+                const Uint32 NewIdx = static_cast<Uint32>(DstShaders.size());
+                DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+                it = BytecodeToIdx.emplace(DstShaders.back(), NewIdx).first;
+            }
+            Remap.push_back(it->second);
+        }
     }
 
+    auto RemapShaderIndex = [&ShaderIndexRemap](size_t DevType, Uint32& Idx) {
+        const std::vector<Uint32>& Remap = ShaderIndexRemap[DevType];
+        if (Idx >= Remap.size())
+            LOG_ERROR_AND_THROW("Shader index ", Idx, " is out of range. Archive file may be corrupted or invalid.");
+        Idx = Remap[Idx];
+    };
+
     // Copy named resources
     for (auto& src_res_it : Src.m_NamedResources)
     {
@@ -609,8 +637,6 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
         {
             for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
             {
-                const Uint32 BaseIdx = ShaderBaseIndices[i];
-
                 SerializedData& DeviceData = it_inserted.first->second.DeviceSpecific[i];
                 if (!DeviceData)
                     continue;
@@ -626,7 +652,7 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
                         VERIFY(Ser.IsEnded(), "No other data besides the shader index is expected");
                     }
 
-                    ShaderIndex += BaseIdx;
+                    RemapShaderIndex(i, ShaderIndex);
 
                     {
                         Serializer<SerializerMode::Write> Ser{DeviceData};
@@ -647,7 +673,7 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
 
                     std::vector<Uint32> NewIndices{ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count};
                     for (Uint32& Idx : NewIndices)
-                        Idx += BaseIdx;
+                        RemapShaderIndex(i, Idx);
 
                     {
                         Serializer<SerializerMode::Write> Ser{DeviceData};
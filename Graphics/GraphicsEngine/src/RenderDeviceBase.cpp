@@ -137,8 +137,12 @@ DeviceFeaturesVk EnableDeviceFeaturesVk(const DeviceFeaturesVk& SupportedFeature
 
     ENABLE_FEATURE(DynamicRendering, "VK_KHR_dynamic_rendering is");
     ENABLE_FEATURE(HostImageCopy, "VK_EXT_host_image_copy is");
+    ENABLE_FEATURE(DescriptorBuffer, "VK_EXT_descriptor_buffer is");
+    ENABLE_FEATURE(GraphicsPipelineLibrary, "VK_EXT_graphics_pipeline_library is");
+    ENABLE_FEATURE(Synchronization2, "VK_KHR_synchronization2 is");
+    ENABLE_FEATURE(PushDescriptor, "VK_KHR_push_descriptor is");
 
-    ASSERT_SIZEOF(DeviceFeaturesVk, 2, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeaturesVk, 6, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
 
     return EnabledFeatures;
 }
@@ -34,8 +34,11 @@
 #include <deque>
 #include <vector>
 #include <atomic>
+#include <algorithm>
 #include "VariableSizeAllocationsManager.hpp"
 #include "RingBuffer.hpp"
+#include "Atomics.hpp"
+#include "Align.hpp"
 
 namespace Diligent
 {
@@ -55,6 +58,11 @@ public:
     using MasterBlock                               = RingBuffer::OffsetType;
     static constexpr const OffsetType InvalidOffset = RingBuffer::InvalidOffset;
 
+    // Master blocks reserved by a cache belong to the frame that was current when they were
+    // reserved and are retired together with it. The cache must not hand them out after the
+    // frame has been finished.
+    static constexpr bool CachedBlocksExpireWithFrame = true;
+
     MasterBlockRingBufferBasedManager(IMemoryAllocator& Allocator,
                                       Uint32            Size) :
         m_RingBuffer{Size, Allocator}
@@ -71,27 +79,129 @@ public:
     {
         std::lock_guard<std::mutex> Lock{m_RingBufferMtx};
         m_RingBuffer.FinishCurrentFrame(FenceValue);
+        // Blocks cached by the contexts now belong to the finished frame
+        m_TrimEpoch.fetch_add(1, std::memory_order_relaxed);
     }
 
     void ReleaseStaleBlocks(Uint64 LastCompletedFenceValue)
     {
         std::lock_guard<std::mutex> Lock{m_RingBufferMtx};
         m_RingBuffer.ReleaseCompletedFrames(LastCompletedFenceValue);
+        m_ReservedSize.store(m_RingBuffer.GetUsedSize(), std::memory_order_relaxed);
     }
 
     OffsetType GetSize() const { return m_RingBuffer.GetMaxSize(); }
-    OffsetType GetUsedSize() const { return m_RingBuffer.GetUsedSize(); }
+
+    // Returns the size of the space that is in use, excluding the master blocks held in caches.
+    // Blocks handed out by a cache are counted when the cache reports them (see MasterBlockCache).
+    OffsetType GetUsedSize() const
+    {
+        const OffsetType CachedSize   = m_CachedSize.load(std::memory_order_relaxed);
+        const OffsetType ReservedSize = m_ReservedSize.load(std::memory_order_relaxed);
+        return ReservedSize > CachedSize ? ReservedSize - CachedSize : 0;
+    }
+
+    OffsetType GetPeakUsedSize() const { return m_PeakUsedSize.load(std::memory_order_relaxed); }
+
+    // Returns the total size of the master blocks held in caches.
+    OffsetType GetCachedSize() const { return m_CachedSize.load(std::memory_order_relaxed); }
+
+    // Incremented every time the current frame is finished and every time the manager fails
+    // to allocate a master block. Master block caches drop their blocks when they see that
+    // the value has changed.
+    Uint32 GetTrimEpoch() const { return m_TrimEpoch.load(std::memory_order_relaxed); }
+
+    static MasterBlock InvalidMasterBlock() { return InvalidOffset; }
 
 protected:
     MasterBlock AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment)
     {
-        std::lock_guard<std::mutex> Lock{m_RingBufferMtx};
-        return m_RingBuffer.Allocate(SizeInBytes, Alignment);
+        MasterBlock NewBlock = InvalidOffset;
+        {
+            std::lock_guard<std::mutex> Lock{m_RingBufferMtx};
+            NewBlock = m_RingBuffer.Allocate(SizeInBytes, Alignment);
+            if (NewBlock != InvalidOffset)
+                m_ReservedSize.store(m_RingBuffer.GetUsedSize(), std::memory_order_relaxed);
+            else
+                m_TrimEpoch.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (NewBlock != InvalidOffset)
+            UpdatePeakUsedSize();
+        return NewBlock;
     }
 
 private:
+    template <typename MasterBlockManagerType>
+    friend class MasterBlockCache;
+
+    // Allocates up to NumBlocks master blocks under a single lock and appends them to Blocks.
+    // The blocks are counted as cached until they are reported by MarkCachedBlocksUsed().
+    // Returns the number of allocated blocks.
+    size_t AllocateMasterBlocks(OffsetType SizeInBytes, OffsetType Alignment, size_t NumBlocks, std::vector<MasterBlock>& Blocks)
+    {
+        std::lock_guard<std::mutex> Lock{m_RingBufferMtx};
+
+        size_t NumAllocated = 0;
+        for (; NumAllocated < NumBlocks; ++NumAllocated)
+        {
+            MasterBlock NewBlock = m_RingBuffer.Allocate(SizeInBytes, Alignment);
+            if (NewBlock == InvalidOffset)
+                break;
+            Blocks.emplace_back(NewBlock);
+        }
+
+        if (NumAllocated > 0)
+        {
+            // Alignment padding between the blocks is counted as used space.
+            // Update the cached size first, so that the blocks never appear to be used.
+            m_CachedSize.fetch_add(AlignUp(SizeInBytes, Alignment) * NumAllocated, std::memory_order_relaxed);
+            m_ReservedSize.store(m_RingBuffer.GetUsedSize(), std::memory_order_relaxed);
+        }
+        else
+        {
+            m_TrimEpoch.fetch_add(1, std::memory_order_relaxed);
+        }
+        return NumAllocated;
+    }
+
+    // Space in the ring buffer can't be returned out of order. Unused cached blocks stay
+    // allocated and are retired together with the frame in which they were reserved.
+    void FreeCachedMasterBlocks(std::vector<MasterBlock>& Blocks, OffsetType SizeInBytes, OffsetType Alignment)
+    {
+        OffsetType FreedSize = 0;
+        for (const MasterBlock& Block : Blocks)
+            FreedSize += GetMasterBlockSize(Block, SizeInBytes, Alignment);
+        Blocks.clear();
+        MarkCachedBlocksUsed(FreedSize);
+    }
+
+    void MarkCachedBlocksUsed(OffsetType Size)
+    {
+        m_CachedSize.fetch_sub(Size, std::memory_order_relaxed);
+        UpdatePeakUsedSize();
+    }
+
+    static OffsetType GetMasterBlockSize(const MasterBlock& /*Block*/, OffsetType SizeInBytes, OffsetType Alignment)
+    {
+        return AlignUp(SizeInBytes, Alignment);
+    }
+
+    void UpdatePeakUsedSize()
+    {
+        AtomicMax(m_PeakUsedSize, GetUsedSize(), std::memory_order_relaxed);
+    }
+
     std::mutex m_RingBufferMtx;
     RingBuffer m_RingBuffer;
+
+    // m_ReservedSize mirrors m_RingBuffer.GetUsedSize() and is updated under m_RingBufferMtx.
+    // m_CachedSize is the size of the blocks held in caches and is decremented without the lock
+    // when a cache reports the blocks it has handed out.
+    std::atomic<OffsetType> m_ReservedSize{0};
+    std::atomic<OffsetType> m_CachedSize{0};
+    std::atomic<OffsetType> m_PeakUsedSize{0};
+
+    std::atomic<Uint32> m_TrimEpoch{0};
 };
 
 
@@ -101,6 +211,9 @@ public:
     using OffsetType  = VariableSizeAllocationsManager::OffsetType;
     using MasterBlock = VariableSizeAllocationsManager::Allocation;
 
+    // Master blocks are freed individually, so cached blocks can be kept across frames.
+    static constexpr bool CachedBlocksExpireWithFrame = false;
+
     MasterBlockListBasedManager(IMemoryAllocator& Allocator,
                                 Uint32            Size) :
         m_AllocationsMgr{Size, Allocator}
@@ -122,52 +235,80 @@ public:
         DEV_CHECK_ERR(m_MasterBlockCounter == 0, m_MasterBlockCounter, " master block(s) have not been returned to the manager");
     }
 
+    // Releases the blocks through the device release queues. The blocks are returned to the
+    // manager when the GPU has finished using them. All blocks are wrapped into a single stale
+    // object, so that the manager is locked once when they are returned.
     template <typename RenderDeviceImplType>
     void ReleaseMasterBlocks(std::vector<MasterBlock>& Blocks, RenderDeviceImplType& Device, Uint64 CmdQueueMask)
     {
-        struct StaleMasterBlock
+        struct StaleMasterBlocks
         {
-            MasterBlock                  Block;
+            std::vector<MasterBlock>     Blocks;
             MasterBlockListBasedManager* Mgr;
 
             // clang-format off
-            StaleMasterBlock(MasterBlock&& _Block, MasterBlockListBasedManager* _Mgr)noexcept :
-                Block {std::move(_Block)},
-                Mgr   {_Mgr             }
+            StaleMasterBlocks(std::vector<MasterBlock>&& _Blocks, MasterBlockListBasedManager* _Mgr)noexcept :
+                Blocks{std::move(_Blocks)},
+                Mgr   {_Mgr              }
             {
             }
 
-            StaleMasterBlock            (const StaleMasterBlock&)  = delete;
-            StaleMasterBlock& operator= (const StaleMasterBlock&)  = delete;
-            StaleMasterBlock& operator= (      StaleMasterBlock&&) = delete;
+            StaleMasterBlocks            (const StaleMasterBlocks&)  = delete;
+            StaleMasterBlocks& operator= (const StaleMasterBlocks&)  = delete;
+            StaleMasterBlocks& operator= (      StaleMasterBlocks&&) = delete;
 
-            StaleMasterBlock(StaleMasterBlock&& rhs)noexcept :
-                Block {std::move(rhs.Block)},
-                Mgr   {rhs.Mgr             }
+            StaleMasterBlocks(StaleMasterBlocks&& rhs)noexcept :
+                Blocks{std::move(rhs.Blocks)},
+                Mgr   {rhs.Mgr              }
             {
-                rhs.Block = MasterBlock{};
-                rhs.Mgr   = nullptr;
+                rhs.Blocks.clear();
+                rhs.Mgr = nullptr;
             }
             // clang-format on
 
-            ~StaleMasterBlock()
+            ~StaleMasterBlocks()
             {
                 if (Mgr != nullptr)
                 {
-                    Mgr->FreeMasterBlock(std::move(Block));
+                    Mgr->FreeMasterBlocks(Blocks);
                 }
             }
         };
-        for (MasterBlock& Block : Blocks)
+
+        if (Blocks.empty())
+            return;
+
+#ifdef DILIGENT_DEVELOPMENT
+        for (const MasterBlock& Block : Blocks)
         {
             DEV_CHECK_ERR(Block.IsValid(), "Attempting to release invalid master block");
-            Device.SafeReleaseDeviceObject(StaleMasterBlock{std::move(Block), this}, CmdQueueMask);
         }
+#endif
+        Device.SafeReleaseDeviceObject(StaleMasterBlocks{std::move(Blocks), this}, CmdQueueMask);
+        Blocks.clear();
     }
 
     OffsetType GetSize() const { return m_AllocationsMgr.GetMaxSize(); }
 
-    OffsetType GetUsedSize() const { return m_UsedSize.load(std::memory_order_relaxed); }
+    // Returns the size of the space that is in use, excluding the master blocks held in caches.
+    // Blocks handed out by a cache are counted when the cache reports them (see MasterBlockCache).
+    OffsetType GetUsedSize() const
+    {
+        const OffsetType CachedSize   = m_CachedSize.load(std::memory_order_relaxed);
+        const OffsetType ReservedSize = m_ReservedSize.load(std::memory_order_relaxed);
+        return ReservedSize > CachedSize ? ReservedSize - CachedSize : 0;
+    }
+
+    OffsetType GetPeakUsedSize() const { return m_PeakUsedSize.load(std::memory_order_relaxed); }
+
+    // Returns the total size of the master blocks held in caches.
+    OffsetType GetCachedSize() const { return m_CachedSize.load(std::memory_order_relaxed); }
+
+    // Incremented every time the manager fails to allocate a master block. Master block caches
+    // return their unused blocks to the manager when they see that the value has changed.
+    Uint32 GetTrimEpoch() const { return m_TrimEpoch.load(std::memory_order_relaxed); }
+
+    static MasterBlock InvalidMasterBlock() { return MasterBlock::InvalidAllocation(); }
 
 #ifdef DILIGENT_DEVELOPMENT
     Int32 GetMasterBlockCounter() const
@@ -179,41 +320,250 @@ public:
 protected:
     MasterBlock AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment)
     {
-        std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
-        MasterBlock                 NewBlock = m_AllocationsMgr.Allocate(SizeInBytes, Alignment);
-        if (NewBlock.IsValid())
+        MasterBlock NewBlock;
         {
+            std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
+            NewBlock = m_AllocationsMgr.Allocate(SizeInBytes, Alignment);
+            if (NewBlock.IsValid())
+            {
 #ifdef DILIGENT_DEVELOPMENT
-            ++m_MasterBlockCounter;
+                ++m_MasterBlockCounter;
 #endif
-            m_UsedSize.store(m_AllocationsMgr.GetUsedSize(), std::memory_order_relaxed);
+                m_ReservedSize.store(m_AllocationsMgr.GetUsedSize(), std::memory_order_relaxed);
+            }
+            else
+            {
+                m_TrimEpoch.fetch_add(1, std::memory_order_relaxed);
+            }
         }
+        if (NewBlock.IsValid())
+            UpdatePeakUsedSize();
         return NewBlock;
     }
 
 private:
-    void FreeMasterBlock(MasterBlock&& Block)
+    template <typename MasterBlockManagerType>
+    friend class MasterBlockCache;
+
+    // Allocates up to NumBlocks master blocks under a single lock and appends them to Blocks.
+    // The blocks are counted as cached until they are reported by MarkCachedBlocksUsed().
+    // Returns the number of allocated blocks.
+    size_t AllocateMasterBlocks(OffsetType SizeInBytes, OffsetType Alignment, size_t NumBlocks, std::vector<MasterBlock>& Blocks)
+    {
+        std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
+
+        size_t     NumAllocated   = 0;
+        OffsetType AllocatedBytes = 0;
+        for (; NumAllocated < NumBlocks; ++NumAllocated)
+        {
+            MasterBlock NewBlock = m_AllocationsMgr.Allocate(SizeInBytes, Alignment);
+            if (!NewBlock.IsValid())
+                break;
+            AllocatedBytes += NewBlock.Size;
+            Blocks.emplace_back(std::move(NewBlock));
+        }
+
+        if (NumAllocated > 0)
+        {
+#ifdef DILIGENT_DEVELOPMENT
+            m_MasterBlockCounter += static_cast<Int32>(NumAllocated);
+#endif
+            // Update the cached size first, so that the blocks never appear to be used
+            m_CachedSize.fetch_add(AllocatedBytes, std::memory_order_relaxed);
+            m_ReservedSize.store(m_AllocationsMgr.GetUsedSize(), std::memory_order_relaxed);
+        }
+        else
+        {
+            m_TrimEpoch.fetch_add(1, std::memory_order_relaxed);
+        }
+        return NumAllocated;
+    }
+
+    void FreeCachedMasterBlocks(std::vector<MasterBlock>& Blocks, OffsetType /*SizeInBytes*/, OffsetType /*Alignment*/)
+    {
+        OffsetType FreedSize = 0;
+        for (const MasterBlock& Block : Blocks)
+            FreedSize += Block.Size;
+        // Update the reserved size first, so that the blocks never appear to be used
+        FreeMasterBlocks(Blocks);
+        m_CachedSize.fetch_sub(FreedSize, std::memory_order_relaxed);
+    }
+
+    void MarkCachedBlocksUsed(OffsetType Size)
+    {
+        m_CachedSize.fetch_sub(Size, std::memory_order_relaxed);
+        UpdatePeakUsedSize();
+    }
+
+    static OffsetType GetMasterBlockSize(const MasterBlock& Block, OffsetType /*SizeInBytes*/, OffsetType /*Alignment*/)
+    {
+        return Block.Size;
+    }
+
+    void FreeMasterBlocks(std::vector<MasterBlock>& Blocks)
     {
         std::lock_guard<std::mutex> Lock{m_AllocationsMgrMtx};
 #ifdef DILIGENT_DEVELOPMENT
-        --m_MasterBlockCounter;
+        m_MasterBlockCounter -= static_cast<Int32>(Blocks.size());
 #endif
-        m_AllocationsMgr.Free(std::move(Block));
-        m_UsedSize.store(m_AllocationsMgr.GetUsedSize(), std::memory_order_relaxed);
+        for (MasterBlock& Block : Blocks)
+            m_AllocationsMgr.Free(std::move(Block));
+        Blocks.clear();
+        m_ReservedSize.store(m_AllocationsMgr.GetUsedSize(), std::memory_order_relaxed);
+    }
+
+    void UpdatePeakUsedSize()
+    {
+        AtomicMax(m_PeakUsedSize, GetUsedSize(), std::memory_order_relaxed);
     }
 
     std::mutex                     m_AllocationsMgrMtx;
     VariableSizeAllocationsManager m_AllocationsMgr;
 
-    // Mirrors m_AllocationsMgr.GetUsedSize() and is updated under m_AllocationsMgrMtx.
-    // This lets statistics queries read the current value without locking the allocation manager.
-    std::atomic<OffsetType> m_UsedSize{0};
+    // m_ReservedSize mirrors m_AllocationsMgr.GetUsedSize() and is updated under m_AllocationsMgrMtx.
+    // m_CachedSize is the size of the blocks held in caches and is decremented without the lock
+    // when a cache reports the blocks it has handed out. This lets statistics queries read the values
+    // without locking the allocation manager.
+    std::atomic<OffsetType> m_ReservedSize{0};
+    std::atomic<OffsetType> m_CachedSize{0};
+    std::atomic<OffsetType> m_PeakUsedSize{0};
+
+    std::atomic<Uint32> m_TrimEpoch{0};
 
 #ifdef DILIGENT_DEVELOPMENT
     std::atomic<Int32> m_MasterBlockCounter;
 #endif
 };
 
+
+// Per-context cache of master blocks of the same size.
+//
+// Master blocks are reserved from the manager in batches, so that a context locks the manager
+// once per batch rather than for every master block it needs. Blocks in the cache have never
+// been used by the GPU and are returned to the manager directly, without going through the
+// release queues. The cache returns all its blocks when any allocation from the manager fails,
+// so that the space reserved by idle contexts becomes available to other contexts.
+// Cached blocks are not counted in the used and peak used sizes of the manager. The blocks the
+// cache hands out are reported to the manager in bulk when the cache is refilled, trimmed, or when
+// the context finishes a frame, so that handing out a block does not touch shared atomics.
+//
+// With MasterBlockRingBufferBasedManager, the cache drops its blocks when the current frame is
+// finished, since the blocks are retired together with the frame in which they were reserved.
+//
+// The cache is not thread-safe and must only be used by the context that owns it.
+template <typename MasterBlockManagerType>
+class MasterBlockCache
+{
+public:
+    using OffsetType  = typename MasterBlockManagerType::OffsetType;
+    using MasterBlock = typename MasterBlockManagerType::MasterBlock;
+
+    MasterBlockCache(MasterBlockManagerType& Mgr,
+                     OffsetType              BlockSize,
+                     OffsetType              Alignment,
+                     Uint32                  BatchSize) :
+        // clang-format off
+        m_Mgr      {Mgr},
+        m_BlockSize{BlockSize},
+        m_Alignment{Alignment},
+        m_BatchSize{std::max(BatchSize, 1u)},
+        m_TrimEpoch{Mgr.GetTrimEpoch()}
+    // clang-format on
+    {
+        m_Blocks.reserve(m_BatchSize);
+    }
+
+    // clang-format off
+    MasterBlockCache            (const MasterBlockCache&)  = delete;
+    MasterBlockCache            (      MasterBlockCache&&) = delete;
+    MasterBlockCache& operator= (const MasterBlockCache&)  = delete;
+    MasterBlockCache& operator= (      MasterBlockCache&&) = delete;
+    // clang-format on
+
+    ~MasterBlockCache()
+    {
+        Trim();
+    }
+
+    // Returns a master block from the cache. If the cache is empty, reserves the next batch of blocks.
+    // Returns an invalid block if the manager has no space.
+    MasterBlock Allocate()
+    {
+        if constexpr (MasterBlockManagerType::CachedBlocksExpireWithFrame)
+        {
+            // Blocks reserved before the current frame was finished must not be used
+            if (m_TrimEpoch != m_Mgr.GetTrimEpoch())
+                TrimIfRequested();
+        }
+
+        if (m_Blocks.empty())
+        {
+            CommitUsedBlocks();
+
+            // Skip the refill while other contexts are trimming their caches
+            const size_t NumBlocks = m_TrimEpoch == m_Mgr.GetTrimEpoch() ? m_BatchSize : 1;
+            if (m_Mgr.AllocateMasterBlocks(m_BlockSize, m_Alignment, NumBlocks, m_Blocks) == 0)
+                return MasterBlockManagerType::InvalidMasterBlock();
+        }
+
+        MasterBlock Block = std::move(m_Blocks.back());
+        m_Blocks.pop_back();
+        m_UsedSize += MasterBlockManagerType::GetMasterBlockSize(Block, m_BlockSize, m_Alignment);
+        return Block;
+    }
+
+    // Reports the blocks handed out since the last call to the manager and returns all cached
+    // blocks to the manager if an allocation from the manager has failed (or, for the ring buffer
+    // based manager, the frame has been finished) since the last call.
+    // Should be called when the context finishes a frame, before it releases the blocks.
+    void TrimIfRequested()
+    {
+        CommitUsedBlocks();
+
+        const Uint32 TrimEpoch = m_Mgr.GetTrimEpoch();
+        if (m_TrimEpoch != TrimEpoch)
+        {
+            Trim();
+            m_TrimEpoch = TrimEpoch;
+        }
+    }
+
+    // Returns all cached blocks to the manager.
+    void Trim()
+    {
+        CommitUsedBlocks();
+        if (!m_Blocks.empty())
+            m_Mgr.FreeCachedMasterBlocks(m_Blocks, m_BlockSize, m_Alignment);
+    }
+
+    size_t GetNumCachedBlocks() const { return m_Blocks.size(); }
+
+    OffsetType GetBlockSize() const { return m_BlockSize; }
+
+private:
+    // Reports the blocks handed out since the last call to the manager
+    void CommitUsedBlocks()
+    {
+        if (m_UsedSize != 0)
+        {
+            m_Mgr.MarkCachedBlocksUsed(m_UsedSize);
+            m_UsedSize = 0;
+        }
+    }
+
+    MasterBlockManagerType& m_Mgr;
+    const OffsetType        m_BlockSize;
+    const OffsetType        m_Alignment;
+    const Uint32            m_BatchSize;
+
+    Uint32 m_TrimEpoch = 0;
+
+    // The size of the blocks handed out since the last call to CommitUsedBlocks()
+    OffsetType m_UsedSize = 0;
+
+    std::vector<MasterBlock> m_Blocks;
+};
+
 } // namespace DynamicHeap
 
 } // namespace Diligent
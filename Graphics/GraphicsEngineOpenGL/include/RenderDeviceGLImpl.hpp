@@ -36,6 +36,7 @@
 #include "BaseInterfacesGL.h"
 #include "FBOCache.hpp"
 #include "GLProgramCache.hpp"
+#include "HLSL2GLSLConverter.h"
 
 namespace Diligent
 {
@@ -251,6 +252,8 @@ protected:
 
     GLProgramCache m_ProgramCache;
 
+    RefCntAutoPtr<IHLSL2GLSLConversionCache> m_pHLSL2GLSLConversionCache;
+
 private:
     virtual void TestTextureFormat(TEXTURE_FORMAT TexFormat) override final;
     bool         CheckExtension(const Char* ExtensionString) const;
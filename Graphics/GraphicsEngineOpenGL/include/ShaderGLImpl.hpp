@@ -35,6 +35,8 @@
 namespace Diligent
 {
 
+struct IHLSL2GLSLConversionCache;
+
 /// Shader object implementation in OpenGL backend.
 class ShaderGLImpl final : public ShaderBase<EngineGLImplTraits>
 {
@@ -49,6 +51,8 @@ public:
         const RenderDeviceInfo&    DeviceInfo;
         const GraphicsAdapterInfo& AdapterInfo;
         IDataBlob** const          ppCompilerOutput;
+
+        IHLSL2GLSLConversionCache* const pConversionCache = nullptr;
     };
 
     ShaderGLImpl(IReferenceCounters*     pRefCounters,
@@ -94,6 +94,13 @@ DILIGENT_BEGIN_INTERFACE(IEngineFactoryOpenGL, IEngineFactory)
     VIRTUAL void METHOD(CreateHLSL2GLSLConverter)(THIS_
                                                   IHLSL2GLSLConverter** ppConverter) PURE;
 
+    /// Creates a HLSL2GLSL conversion cache, see EngineGLCreateInfo::pHLSL2GLSLConversionCache.
+
+    /// \param [out] ppCache - Address of the memory location where pointer to
+    ///                        the created conversion cache will be written.
+    VIRTUAL void METHOD(CreateHLSL2GLSLConversionCache)(THIS_
+                                                        IHLSL2GLSLConversionCache** ppCache) PURE;
+
     /// Attaches to the active GL context in the thread.
 
     /// \param [in]  EngineCI           - Engine creation info, see EngineGLCreateInfo.
@@ -118,6 +125,7 @@ DILIGENT_END_INTERFACE
 
 #    define IEngineFactoryOpenGL_CreateDeviceAndSwapChainGL(This, ...) CALL_IFACE_METHOD(EngineFactoryOpenGL, CreateDeviceAndSwapChainGL, This, __VA_ARGS__)
 #    define IEngineFactoryOpenGL_CreateHLSL2GLSLConverter(This, ...)   CALL_IFACE_METHOD(EngineFactoryOpenGL, CreateHLSL2GLSLConverter,   This, __VA_ARGS__)
+#    define IEngineFactoryOpenGL_CreateHLSL2GLSLConversionCache(This, ...) CALL_IFACE_METHOD(EngineFactoryOpenGL, CreateHLSL2GLSLConversionCache, This, __VA_ARGS__)
 #    define IEngineFactoryOpenGL_AttachToActiveGLContext(This, ...)    CALL_IFACE_METHOD(EngineFactoryOpenGL, AttachToActiveGLContext,    This, __VA_ARGS__)
 
 // clang-format on
@@ -97,6 +97,8 @@ public:
 
     virtual void DILIGENT_CALL_TYPE CreateHLSL2GLSLConverter(IHLSL2GLSLConverter** ppConverter) override final;
 
+    virtual void DILIGENT_CALL_TYPE CreateHLSL2GLSLConversionCache(IHLSL2GLSLConversionCache** ppCache) override final;
+
     virtual void DILIGENT_CALL_TYPE AttachToActiveGLContext(const EngineGLCreateInfo& EngineCI,
                                                             IRenderDevice**           ppDevice,
                                                             IDeviceContext**          ppImmediateContext) override final;
@@ -409,6 +411,15 @@ void EngineFactoryOpenGLImpl::CreateHLSL2GLSLConverter(IHLSL2GLSLConverter** ppC
 #endif
 }
 
+void EngineFactoryOpenGLImpl::CreateHLSL2GLSLConversionCache(IHLSL2GLSLConversionCache** ppCache)
+{
+#if DILIGENT_NO_HLSL
+    LOG_ERROR_MESSAGE("Unable to create HLSL2GLSL conversion cache: HLSL support is disabled.");
+#else
+    Diligent::CreateHLSL2GLSLConversionCache(ppCache);
+#endif
+}
+
 #if PLATFORM_ANDROID
 void EngineFactoryOpenGLImpl::InitAndroidFileSystem(struct AAssetManager* AssetManager,
                                                     const char*           ExternalFilesDir,
@@ -201,7 +201,8 @@ RenderDeviceGLImpl::RenderDeviceGLImpl(IReferenceCounters*       pRefCounters,
         GraphicsAdapterInfo{} // Adapter properties can only be queried after GL context is initialized
     },
     // Device caps must be filled in before the constructor of Pipeline Cache is called!
-    m_GLContext{EngineCI, m_DeviceInfo.Type, m_DeviceInfo.APIVersion, pSCDesc}
+    m_GLContext{EngineCI, m_DeviceInfo.Type, m_DeviceInfo.APIVersion, pSCDesc},
+    m_pHLSL2GLSLConversionCache{EngineCI.pHLSL2GLSLConversionCache}
 // clang-format on
 {
     VerifyEngineGLCreateInfo(EngineCI);
@@ -411,6 +412,7 @@ void RenderDeviceGLImpl::CreateShader(const ShaderCreateInfo& ShaderCreateInfo,
         GetDeviceInfo(),
         GetAdapterInfo(),
         ppCompilerOutput,
+        m_pHLSL2GLSLConversionCache,
     };
     CreateShaderImpl(ppShader, ShaderCreateInfo, GLShaderCI, bIsDeviceInternal);
 }
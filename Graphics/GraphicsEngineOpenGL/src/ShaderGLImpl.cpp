@@ -235,6 +235,9 @@ ShaderGLImpl::ShaderGLImpl(IReferenceCounters*     pRefCounters,
             DeviceInfo.MaxShaderVersion,
             TargetGLSLCompiler::driver,
             DeviceInfo.NDC.MinZ == 0,
+            nullptr, // ExtraDefinitions
+            nullptr, // ppConversionStream
+            GLShaderCI.pConversionCache,
         });
 
     const SHADER_SOURCE_LANGUAGE SourceLang = ParseShaderSourceLanguageDefinition(m_GLSLSourceString);
@@ -113,6 +113,9 @@ private:
 
     VulkanUtilities::BufferWrapper    m_VulkanBuffer;
     VulkanUtilities::MemoryAllocation m_MemoryAllocation;
+
+    // Device address of the buffer created with VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT.
+    VkDeviceAddress m_VkDeviceAddress = 0;
 };
 
 } // namespace Diligent
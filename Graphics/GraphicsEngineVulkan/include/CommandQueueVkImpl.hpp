@@ -33,6 +33,7 @@
 #include <mutex>
 #include <deque>
 #include <atomic>
+#include <vector>
 
 #include "EngineVkImplTraits.hpp"
 #include "ObjectBase.hpp"
@@ -94,6 +95,12 @@ private:
 
 
 /// Implementation of the Diligent::ICommandQueueVk interface
+
+/// Submissions from multiple threads are batched: every submission is first added to the pending list,
+/// and the thread that acquires the queue lock submits all pending submissions with a single
+/// vkQueueSubmit2 (or vkQueueSubmit) call. Threads whose submissions have been submitted by another
+/// thread find them done when they acquire the lock. Submissions are executed and assigned fence
+/// values in the order they were added to the pending list.
 class CommandQueueVkImpl final : public ObjectBase<ICommandQueueVk>
 {
 public:
@@ -155,9 +162,61 @@ public:
         return m_LastSyncPoint;
     }
 
+    struct PendingSubmission
+    {
+        explicit PendingSubmission(const VkSubmitInfo& _SubmitInfo) noexcept :
+            SubmitInfo{_SubmitInfo}
+        {}
+
+        // The submit info and all arrays it references must remain valid until WaitSubmission() returns.
+        const VkSubmitInfo& SubmitInfo;
+
+        // The members below are written by the thread that submits the batch while holding the queue lock.
+        Uint64 FenceValue = 0;
+        bool   Submitted  = false;
+    };
+
+    // Adds the submission to the pending list.
+    void EnqueueSubmission(PendingSubmission& Submission);
+
+    // Submits all pending submissions, unless this one has already been submitted by another thread,
+    // and returns the fence value associated with the submission.
+    Uint64 WaitSubmission(PendingSubmission& Submission);
+
+    struct SubmissionStatistics
+    {
+        Uint32 NumSubmissions  = 0; // Number of submissions
+        Uint32 NumQueueSubmits = 0; // Number of vkQueueSubmit/vkQueueSubmit2 calls issued for them
+
+        Uint32 GetNumSavedSubmits() const { return NumSubmissions - NumQueueSubmits; }
+    };
+    SubmissionStatistics GetSubmissionStatistics() const
+    {
+        SubmissionStatistics Stats;
+        Stats.NumSubmissions  = m_NumSubmissions.load();
+        Stats.NumQueueSubmits = m_NumQueueSubmits.load();
+        return Stats;
+    }
+    void ResetSubmissionStatistics()
+    {
+        m_NumSubmissions.store(0);
+        m_NumQueueSubmits.store(0);
+    }
+
 private:
     SyncPointVkPtr CreateSyncPoint(Uint64 dbgValue);
 
+    // Submits all pending submissions. m_QueueMutex must be locked by the caller.
+    void FlushPendingSubmissions();
+
+    // Submits m_SubmitBatch with vkQueueSubmit. Sync point semaphores from m_TempSignalSemaphores
+    // are signaled by the last submit info.
+    VkResult SubmitBatch(VkFence vkFence);
+#if DILIGENT_USE_VOLK
+    // Same as SubmitBatch, but uses vkQueueSubmit2
+    VkResult SubmitBatch2(VkFence vkFence);
+#endif
+
     void InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore, Uint64 Value);
 
     std::shared_ptr<VulkanUtilities::LogicalDevice> m_LogicalDevice;
@@ -166,6 +225,7 @@ private:
     const HardwareQueueIndex m_QueueFamilyIndex;
     const SoftwareQueueIndex m_CommandQueueId;
     const bool               m_SupportedTimelineSemaphore;
+    const bool               m_UseSynchronization2;
     const Uint8              m_NumCommandQueues;
 
     // Fence is signaled right after a command buffer has been
@@ -183,6 +243,23 @@ private:
     // Array used to merge semaphores from SubmitInfo and from SyncPointVk
     std::vector<VkSemaphore> m_TempSignalSemaphores;
 
+    // Protects access to m_PendingSubmissions
+    std::mutex                      m_PendingSubmissionsMtx;
+    std::vector<PendingSubmission*> m_PendingSubmissions;
+
+    // Submissions that are being submitted and the arrays used to build submit infos.
+    // Protected by m_QueueMutex.
+    std::vector<PendingSubmission*> m_SubmitBatch;
+    std::vector<VkSubmitInfo>       m_SubmitInfos;
+#if DILIGENT_USE_VOLK
+    std::vector<VkSubmitInfo2KHR>             m_SubmitInfos2;
+    std::vector<VkSemaphoreSubmitInfoKHR>     m_SemaphoreInfos;
+    std::vector<VkCommandBufferSubmitInfoKHR> m_CmdBufferInfos;
+#endif
+
+    std::atomic<Uint32> m_NumSubmissions{0};
+    std::atomic<Uint32> m_NumQueueSubmits{0};
+
     // Protects access to the m_LastSyncPoint
     Threading::SpinLock m_LastSyncPointLock;
 
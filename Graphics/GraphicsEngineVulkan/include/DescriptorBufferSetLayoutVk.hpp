@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::DescriptorBufferSetLayoutVk class
+
+#include <vector>
+
+#include "VulkanUtilities/LogicalDevice.hpp"
+
+namespace Diligent
+{
+
+// Describes how descriptors of a descriptor set are laid out in the descriptor buffer memory
+// when VK_EXT_descriptor_buffer is used instead of descriptor pools.
+//
+//   Set data:  |  Binding 0: Descr[0] | ... | Descr[N-1]  |  Binding 1: Descr[0] | ...  |
+//              A                        A
+//              |                        |
+//          Binding offset      Binding offset + i * DescriptorSize
+//
+// Descriptors are addressed by the SRB resource cache offset, so that ShaderResourceCacheVk
+// can write them without knowing the binding indices. Binding offsets are queried from the
+// driver as they are implementation-defined.
+class DescriptorBufferSetLayoutVk
+{
+public:
+    struct BindingInfo
+    {
+        Uint32           BindingIndex       = 0;
+        Uint32           CacheOffset        = ~0u; // SRB cache offset of the first array element, or ~0u for separate immutable samplers
+        Uint32           ArraySize          = 0;
+        VkDescriptorType vkType             = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+        const VkSampler* pImmutableSamplers = nullptr;
+    };
+
+    // Initializes the layout. vkLayout must have been created with VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT.
+    void Initialize(const VulkanUtilities::LogicalDevice&               LogicalDevice,
+                    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props,
+                    VkDescriptorSetLayout                                vkLayout,
+                    const std::vector<BindingInfo>&                      Bindings,
+                    Uint32                                               NumCacheResources);
+
+    bool IsInitialized() const { return m_DataSize != 0; }
+
+    Uint32 GetDataSize() const { return m_DataSize; }
+
+    // Initializes the set data with the immutable sampler descriptors.
+    void InitializeData(void* pSetData) const;
+
+    // Returns the immutable sampler of the combined image sampler at the given cache offset.
+    VkSampler GetImmutableSampler(Uint32 CacheOffset) const
+    {
+        VERIFY_EXPR(CacheOffset < m_Descriptors.size());
+        return m_Descriptors[CacheOffset].ImmutableSampler;
+    }
+
+    // Writes the descriptor of the resource at the given cache offset to the set data.
+    void WriteDescriptor(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                         Uint32                                CacheOffset,
+                         const VkDescriptorGetInfoEXT&         GetInfo,
+                         Uint8*                                pSetData) const;
+
+    // Clears the descriptor at the given cache offset.
+    void ClearDescriptor(Uint32 CacheOffset, Uint8* pSetData) const;
+
+    static constexpr Uint32 MaxDescriptorSize = 256;
+
+private:
+    struct DescriptorInfo
+    {
+        Uint32 Offset = 0; // Offset of the descriptor in the set data
+        Uint16 Size   = 0; // Descriptor size
+
+        // If the implementation requires arrays of combined image samplers to be written
+        // as an array of images followed by an array of samplers, the size of the image part
+        // and the offset of the sampler part. Otherwise, zero.
+        Uint16 ImageSize     = 0;
+        Uint32 SamplerOffset = 0;
+
+        VkSampler ImmutableSampler = VK_NULL_HANDLE;
+    };
+
+    static void GetDescriptor(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                              const DescriptorInfo&                 Descr,
+                              const VkDescriptorGetInfoEXT&         GetInfo,
+                              Uint8*                                pSetData);
+
+    Uint32 m_DataSize = 0;
+
+    // Descriptor info for each resource in the SRB cache
+    std::vector<DescriptorInfo> m_Descriptors;
+
+    // Set data with the immutable sampler descriptors, or empty if there are none
+    std::vector<Uint8> m_InitialData;
+};
+
+} // namespace Diligent
@@ -47,6 +47,7 @@
 #include "TopLevelASVkImpl.hpp"
 #include "ShaderBindingTableVkImpl.hpp"
 #include "ShaderResourceBindingVkImpl.hpp"
+#include "CommandQueueVkImpl.hpp"
 
 #include "PipelineLayoutVk.hpp"
 #include "VulkanUtilities/CommandBufferPool.hpp"
@@ -321,6 +322,15 @@ public:
     /// Implementation of IDeviceContextVk::GetVkCommandBuffer().
     virtual VkCommandBuffer DILIGENT_CALL_TYPE GetVkCommandBuffer() override final;
 
+    /// Implementation of IDeviceContextVk::GetDescriptorSetStatistics().
+    virtual void DILIGENT_CALL_TYPE GetDescriptorSetStatistics(DescriptorSetStatisticsVk& Stats) const override final;
+
+    /// Implementation of IDeviceContextVk::GetBarrierStatistics().
+    virtual void DILIGENT_CALL_TYPE GetBarrierStatistics(BarrierStatisticsVk& Stats) const override final;
+
+    /// Implementation of IDeviceContextVk::GetSubmissionStatistics().
+    virtual void DILIGENT_CALL_TYPE GetSubmissionStatistics(SubmissionStatisticsVk& Stats) const override final;
+
     // Transitions BLAS state from OldState to NewState, and optionally updates internal state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal BLAS state is used as old state.
     void TransitionBLASState(BottomLevelASVkImpl& BLAS,
@@ -378,10 +388,16 @@ public:
 
     size_t GetNumCommandsInCtx() const { return m_State.NumCommands; }
 
+    // Returns submission statistics of the context's command queue collected during the last finished frame.
+    // Only collected by immediate contexts.
+    const CommandQueueVkImpl::SubmissionStatistics& GetLastFrameSubmissionStatistics() const { return m_LastFrameSubmissionStats; }
+
+    // Pending barriers are not flushed here: commands that access resources flush them when recorded.
+    // This lets barriers issued before and after state-setting commands (push constants, push descriptors)
+    // be coalesced into a single pipeline barrier.
     __forceinline VulkanUtilities::CommandBuffer& GetCommandBuffer()
     {
         EnsureVkCmdBuffer();
-        m_CommandBuffer.FlushBarriers();
         return m_CommandBuffer;
     }
 
@@ -400,13 +416,26 @@ public:
         return m_DynamicDescrSetAllocator.Allocate(SetLayout, DebugName);
     }
 
-    VulkanDynamicAllocation AllocateDynamicSpace(Uint64 SizeInBytes, Uint32 Alignment);
+    // If AllowOverflow is true, the allocation may be placed outside of the primary dynamic heap chunk
+    // and the Vulkan buffer must be taken from the allocation.
+    VulkanDynamicAllocation AllocateDynamicSpace(Uint64 SizeInBytes, Uint32 Alignment, bool AllowOverflow);
 
     virtual void ResetRenderTargets() override final;
 
     QueryManagerVk* GetQueryManager() { return m_pQueryMgr; }
 
-    __forceinline size_t GetDynamicBufferOffset(const BufferVkImpl* pBuffer, bool VerifyAllocation = true);
+    __forceinline size_t GetDynamicBufferOffset(const BufferVkImpl* pBuffer, bool VerifyAllocation = true) const;
+
+    // Returns the current dynamic allocation of a dynamic buffer that has no backing Vulkan resource,
+    // or null if the buffer has a backing resource or has not been mapped in this context.
+    __forceinline const VulkanDynamicAllocation* GetDynamicBufferAllocation(const BufferVkImpl* pBuffer) const;
+
+    // Returns the Vulkan buffer that holds the data of pBuffer in this context. For dynamic buffers
+    // without backing resource, this is the buffer of the dynamic heap chunk the data was allocated from.
+    __forceinline VkBuffer GetDynamicBufferVkBuffer(const BufferVkImpl* pBuffer) const;
+
+    // Returns the device address of the data of pBuffer in this context, see GetDynamicBufferVkBuffer().
+    VkDeviceAddress GetDynamicBufferDeviceAddress(const BufferVkImpl* pBuffer) const;
 
 #ifdef DILIGENT_DEVELOPMENT
     void DvpVerifyDynamicAllocation(const BufferVkImpl* pBuffer) const;
@@ -543,6 +572,23 @@ private:
             // Index of the first dynamic offset in m_DynamicBufferOffsets
             Uint16 FirstDynamicOffset = 0;
 
+            // Whether the dynamic descriptor set is updated with push descriptors, given by pSignature->UsePushDescriptors()
+            bool UsePushDescriptors = false;
+
+            // Bit mask of the sets in vkOverflowSets that have been written in frame OverflowSetsFrame
+            Uint8 OverflowSetMask = 0;
+
+            // Descriptor sets that are bound instead of vkSets when dynamic buffers are allocated from overflow
+            // chunks of the dynamic heap, see CommitDescriptorSets(). The sets are allocated from the dynamic
+            // descriptor pool and are only valid in the frame they were written in.
+            std::array<VkDescriptorSet, MAX_DESCR_SET_PER_SIGNATURE> vkOverflowSets = {};
+
+            Uint64 OverflowSetsFrame = 0;
+
+            // Offsets of the descriptor set data in the descriptor buffer (only used
+            // when descriptor buffers are enabled)
+            std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE> DescrBufferOffsets = {};
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
@@ -561,6 +607,10 @@ private:
 
     __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
 
+    void CommitDescriptorBufferOffsets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+
+    void CommitPushDescriptors(ResourceBindInfo& BindInfo);
+
     void CommitInlineConstants(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -573,9 +623,22 @@ private:
     /// Memory to store dynamic buffer offsets for descriptor sets.
     std::vector<Uint32> m_DynamicBufferOffsets;
 
+    /// Indices of the dynamic heap chunks the buffers in m_DynamicBufferOffsets are allocated from.
+    std::vector<Uint32> m_DynamicBufferChunks;
+
     /// Temporary array used by CommitDescriptorSets
     std::array<VkDescriptorSet, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> m_DescriptorSets = {};
 
+    /// Descriptor set statistics of the current frame and of the last finished frame
+    DescriptorSetStatisticsVk m_DescriptorSetStats;
+    DescriptorSetStatisticsVk m_LastFrameDescriptorSetStats;
+
+    /// Barrier statistics of the command buffer collected during the last finished frame
+    VulkanUtilities::CommandBuffer::BarrierStatistics m_LastFrameBarrierStats;
+
+    /// Submission statistics of the command queue collected during the last finished frame
+    CommandQueueVkImpl::SubmissionStatistics m_LastFrameSubmissionStats;
+
     /// Render pass that matches currently bound render targets.
     /// This render pass may or may not be currently set in the command buffer
     VkRenderPass m_vkRenderPass = VK_NULL_HANDLE;
@@ -664,7 +727,7 @@ private:
 };
 
 
-__forceinline size_t DeviceContextVkImpl::GetDynamicBufferOffset(const BufferVkImpl* pBuffer, bool VerifyAllocation)
+__forceinline size_t DeviceContextVkImpl::GetDynamicBufferOffset(const BufferVkImpl* pBuffer, bool VerifyAllocation) const
 {
     VERIFY_EXPR(pBuffer != nullptr);
 
@@ -685,4 +748,29 @@ __forceinline size_t DeviceContextVkImpl::GetDynamicBufferOffset(const BufferVkI
         0;
 }
 
+__forceinline const VulkanDynamicAllocation* DeviceContextVkImpl::GetDynamicBufferAllocation(const BufferVkImpl* pBuffer) const
+{
+    VERIFY_EXPR(pBuffer != nullptr);
+
+    if (pBuffer->m_VulkanBuffer != VK_NULL_HANDLE)
+        return nullptr;
+
+    const Uint32 DynamicBufferId = pBuffer->GetDynamicBufferId();
+    VERIFY(DynamicBufferId != ~0u, "Dynamic buffer '", pBuffer->GetDesc().Name, "' does not have dynamic buffer ID");
+    if (DynamicBufferId >= m_MappedBuffers.size())
+        return nullptr;
+
+    const VulkanDynamicAllocation& Allocation = m_MappedBuffers[DynamicBufferId].Allocation;
+    return Allocation ? &Allocation : nullptr;
+}
+
+__forceinline VkBuffer DeviceContextVkImpl::GetDynamicBufferVkBuffer(const BufferVkImpl* pBuffer) const
+{
+    if (const VulkanDynamicAllocation* pAllocation = GetDynamicBufferAllocation(pBuffer))
+        return pAllocation->GetVkBuffer();
+
+    // Buffers with backing resource and dynamic buffers that have not been mapped
+    return pBuffer->GetVkBuffer();
+}
+
 } // namespace Diligent
@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineLibraryCacheVk class
+
+#include <array>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include <type_traits>
+
+#include "RenderPass.h"
+#include "RefCntAutoPtr.hpp"
+#include "VulkanUtilities/LogicalDevice.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+class PipelineResourceSignatureVkImpl;
+
+/// Cache of graphics pipeline libraries (VK_EXT_graphics_pipeline_library).
+
+/// Every graphics pipeline is split into vertex input, pre-rasterization shader, fragment shader and
+/// fragment output libraries. Libraries are keyed by the state they are created from, so pipelines that
+/// share any of the parts reuse the compiled library and only need to be linked.
+class PipelineLibraryCacheVk
+{
+public:
+    enum LIBRARY_PART : Uint32
+    {
+        LIBRARY_PART_VERTEX_INPUT = 0,
+        LIBRARY_PART_PRE_RASTERIZATION,
+        LIBRARY_PART_FRAGMENT_SHADER,
+        LIBRARY_PART_FRAGMENT_OUTPUT,
+        LIBRARY_PART_COUNT
+    };
+    using LibraryArrayType = std::array<VkPipeline, LIBRARY_PART_COUNT>;
+
+    struct GraphicsPipelineInfo
+    {
+        /// Create info of the complete pipeline.
+        const VkGraphicsPipelineCreateInfo& PipelineCI;
+
+        /// SPIR-V code of every stage in PipelineCI.pStages.
+        const std::vector<const std::vector<uint32_t>*>& StagesSPIRV;
+
+        /// Resource signatures the pipeline layout is created from. Pipeline layouts are created by
+        /// every pipeline, so libraries are matched by the descriptions of the signatures.
+        const RefCntAutoPtr<PipelineResourceSignatureVkImpl>* ppSignatures = nullptr;
+
+        Uint32 SignatureCount = 0;
+
+        /// Render pass description if PipelineCI.renderPass is not null.
+        const RenderPassDesc* pRenderPassDesc = nullptr;
+
+        VkPipelineCache vkPipelineCache = VK_NULL_HANDLE;
+
+        const char* Name = nullptr;
+    };
+
+    explicit PipelineLibraryCacheVk(RenderDeviceVkImpl& DeviceVk) noexcept;
+
+    // clang-format off
+    PipelineLibraryCacheVk             (const PipelineLibraryCacheVk&) = delete;
+    PipelineLibraryCacheVk             (PipelineLibraryCacheVk&&)      = delete;
+    PipelineLibraryCacheVk& operator = (const PipelineLibraryCacheVk&) = delete;
+    PipelineLibraryCacheVk& operator = (PipelineLibraryCacheVk&&)      = delete;
+    // clang-format on
+
+    ~PipelineLibraryCacheVk();
+
+    /// Finds the libraries of the pipeline in the cache and creates the ones that are missing.
+    LibraryArrayType GetLibraries(const GraphicsPipelineInfo& Info) noexcept(false);
+
+    /// Links the libraries into an executable pipeline.
+
+    /// \param [in] Optimize - Whether to perform link-time optimization. An optimized pipeline takes longer
+    ///                        to link, but is as efficient as a pipeline created without libraries.
+    VulkanUtilities::PipelineWrapper LinkPipeline(const LibraryArrayType& Libraries,
+                                                  VkPipelineLayout        vkLayout,
+                                                  VkPipelineCreateFlags   Flags,
+                                                  bool                    Optimize,
+                                                  VkPipelineCache         vkPipelineCache,
+                                                  const char*             Name) const noexcept(false);
+
+    /// Returns true if the device can link libraries without link-time optimization fast enough
+    /// to do it at draw time.
+    bool IsFastLinkingSupported() const;
+
+private:
+    // Binary representation of the state a library is created from
+    class LibraryKey
+    {
+    public:
+        template <typename T>
+        void Add(const T& Val)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be added to the key");
+            AddBytes(&Val, sizeof(Val));
+        }
+        void AddBytes(const void* pData, size_t Size);
+        void AddString(const char* Str);
+
+        // Adds everything that affects the layouts of the descriptor sets and push constants
+        void AddPipelineLayout(const RefCntAutoPtr<PipelineResourceSignatureVkImpl>* ppSignatures, Uint32 SignatureCount);
+
+        // Adds the render pass description except for the object name
+        void AddRenderPass(const RenderPassDesc& Desc);
+
+        bool operator==(const LibraryKey& RHS) const noexcept
+        {
+            return GetHash() == RHS.GetHash() && m_Data == RHS.m_Data;
+        }
+
+        size_t GetHash() const noexcept;
+
+        struct Hasher
+        {
+            size_t operator()(const LibraryKey& Key) const noexcept
+            {
+                return Key.GetHash();
+            }
+        };
+
+    private:
+        std::vector<Uint8> m_Data;
+        mutable size_t     m_Hash = 0;
+    };
+
+    VkPipeline GetLibrary(LIBRARY_PART                        Part,
+                          LibraryKey&&                        Key,
+                          const VkGraphicsPipelineCreateInfo& LibraryCI,
+                          VkPipelineCache                     vkPipelineCache,
+                          const char*                         Name) noexcept(false);
+
+private:
+    RenderDeviceVkImpl& m_DeviceVk;
+
+    struct PartCache
+    {
+        std::mutex                                                                           Mtx;
+        std::unordered_map<LibraryKey, VulkanUtilities::PipelineWrapper, LibraryKey::Hasher> Libraries;
+    };
+    std::array<PartCache, LIBRARY_PART_COUNT> m_Parts;
+};
+
+} // namespace Diligent
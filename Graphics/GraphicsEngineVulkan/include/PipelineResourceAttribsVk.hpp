@@ -199,5 +199,18 @@ inline VkDescriptorType DescriptorTypeToVkDescriptorType(DescriptorType Type)
     }
 }
 
+// Descriptor set layouts used with descriptor buffers or push descriptors must not contain dynamic
+// uniform or storage buffers. Dynamic offsets are applied to the buffer descriptors instead.
+inline VkDescriptorType DescriptorTypeToVkNonDynamicDescriptorType(DescriptorType Type)
+{
+    const VkDescriptorType vkType = DescriptorTypeToVkDescriptorType(Type);
+    switch (vkType)
+    {
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC: return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        default: return vkType;
+    }
+}
+
 
 } // namespace Diligent
@@ -145,6 +145,22 @@ public:
     bool   HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
     Uint32 GetDescriptorSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorSetSizes[SetId]; }
 
+    // Returns true if the signature uses descriptor buffers instead of descriptor sets.
+    bool UseDescriptorBuffers() const { return m_DescrBufferSetLayouts[0].IsInitialized(); }
+
+    // Returns descriptor buffer layouts indexed by the descriptor set index, or null if descriptor buffers are not used.
+    const DescriptorBufferSetLayoutVk* GetDescriptorBufferSetLayouts() const
+    {
+        return UseDescriptorBuffers() ? m_DescrBufferSetLayouts.data() : nullptr;
+    }
+
+    // The maximum number of descriptors in the dynamic set that is updated with push descriptors
+    static constexpr Uint32 MaxPushDescriptorSetSize = 32;
+
+    // Returns true if the dynamic descriptor set is updated with push descriptors instead of being
+    // allocated from the dynamic descriptor pool, see CreateSetLayouts().
+    bool UsePushDescriptors() const { return m_UsePushDescriptors; }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -156,6 +172,22 @@ public:
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                 VkDescriptorSet              vkDynamicDescriptorSet) const;
 
+    // Pushes dynamic resources from ResourceCache to the command buffer of the context using
+    // vkCmdPushDescriptorSetKHR. Current dynamic buffer offsets are written to the descriptors.
+    void PushDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                              DeviceContextVkImpl&         Ctx,
+                              VkPipelineBindPoint          vkBindPoint,
+                              VkPipelineLayout             vkPipelineLayout,
+                              Uint32                       SetIndex) const;
+
+    // Writes all resources of the descriptor set with index SetIndex in ResourceCache to vkDescriptorSet,
+    // which must have been allocated with the layout of this set. Unlike the sets referenced by the SRB,
+    // buffers with dynamic offsets reference the dynamic heap chunks of their current allocations in Ctx.
+    void WriteOverflowDescriptorSet(const ShaderResourceCacheVk& ResourceCache,
+                                    Uint32                       SetIndex,
+                                    VkDescriptorSet              vkDescriptorSet,
+                                    const DeviceContextVkImpl&   Ctx) const;
+
     struct CommitInlineConstantsAttribs
     {
         DeviceContextVkImpl&         Ctx;
@@ -212,6 +244,16 @@ private:
 
     void CreateSetLayouts(bool IsSerialized);
 
+    // Writes all resources of the descriptor set SetId from ResourceCache to VkWriteDescriptorSet structures and
+    // passes them to FlushWrites in batches. If pCtx is not null, buffers with dynamic offsets reference the
+    // dynamic heap chunks of their current allocations in the context rather than the primary chunk.
+    template <bool IsPushDescriptorSet, typename FlushWritesType>
+    void WriteDescriptorSetResources(const ShaderResourceCacheVk& ResourceCache,
+                                     DESCRIPTOR_SET_ID            SetId,
+                                     VkDescriptorSet              vkDescriptorSet,
+                                     const DeviceContextVkImpl*   pCtx,
+                                     FlushWritesType              FlushWrites) const;
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
@@ -221,12 +263,18 @@ private:
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
+    // Descriptor buffer layouts indexed by the descriptor set index (only initialized when descriptor buffers are used)
+    std::array<DescriptorBufferSetLayoutVk, MAX_DESCRIPTOR_SETS> m_DescrBufferSetLayouts;
+
     // The total number of uniform buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicUniformBufferCount = 0;
     // The total number storage buffers with dynamic offsets in both descriptor sets,
     // accounting for array size.
     Uint16 m_DynamicStorageBufferCount = 0;
+
+    // Whether the dynamic descriptor set layout is a push descriptor set layout
+    bool m_UsePushDescriptors = false;
 };
 
 template <> Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE>() const;
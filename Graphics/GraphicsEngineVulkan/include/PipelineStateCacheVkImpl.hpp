@@ -29,8 +29,12 @@
 /// \file
 /// Declaration of Diligent::PipelineStateCacheVkImpl class
 
+#include <mutex>
+#include <shared_mutex>
+
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateCacheBase.hpp"
+#include "SharedMutex.hpp"
 
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "VulkanUtilities/LogicalDevice.hpp"
@@ -57,8 +61,30 @@ public:
     /// Implementation of IPipelineStateCacheVk::GetVkPipelineCache().
     virtual VkPipelineCache DILIGENT_CALL_TYPE GetVkPipelineCache() const override final { return m_PipelineStateCache; }
 
+    /// Implementation of IPipelineStateCacheVk::SaveToStream().
+    virtual bool DILIGENT_CALL_TYPE SaveToStream(IFileStream* pStream) override final;
+
+    /// Implementation of IPipelineStateCacheVk::LoadFromStream().
+    virtual bool DILIGENT_CALL_TYPE LoadFromStream(IFileStream* pStream) override final;
+
+    /// Implementation of IPipelineStateCacheVk::Merge().
+    virtual bool DILIGENT_CALL_TYPE Merge(Uint32 NumSrcCaches, IPipelineStateCache* const* ppSrcCaches) override final;
+
+    // Locks the cache for pipeline creation. Pipelines may be created with the cache by
+    // several threads at once, but not while other caches are merged into it.
+    std::shared_lock<Threading::SharedMutex> LockForPipelineCreation() { return std::shared_lock<Threading::SharedMutex>{m_Mtx}; }
+
+private:
+    bool MergeData(const void* pData, size_t DataSize);
+
 private:
     VulkanUtilities::PipelineCacheWrapper m_PipelineStateCache;
+
+    // vkMergePipelineCaches requires external synchronization of the destination cache:
+    // no other thread may access the cache while it is being merged into.
+    // Merge() and LoadFromStream() lock the cache exclusively. Pipeline creation,
+    // reading the cache data and merging the cache into other caches lock it for shared access.
+    Threading::SharedMutex m_Mtx;
 };
 
 } // namespace Diligent
@@ -32,6 +32,7 @@
 
 #include <array>
 #include <memory>
+#include <atomic>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateBase.hpp"
@@ -41,6 +42,7 @@
 #include "FixedBlockMemoryAllocator.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "PipelineLayoutVk.hpp"
+#include "PipelineLibraryCacheVk.hpp"
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "VulkanUtilities/CommandBuffer.hpp"
 
@@ -74,7 +76,12 @@ public:
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return GetRenderPassPtr().RawPtr<IRenderPassVk>(); }
 
     /// Implementation of IPipelineStateVk::GetVkPipeline().
-    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final { return m_Pipeline; }
+    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final
+    {
+        // Use the optimized pipeline as soon as it has been linked in the background
+        const VkPipeline vkOptimizedPipeline = m_vkOptimizedPipeline.load();
+        return vkOptimizedPipeline != VK_NULL_HANDLE ? vkOptimizedPipeline : static_cast<VkPipeline>(m_Pipeline);
+    }
 
     const PipelineLayoutVk& GetPipelineLayout() const { return m_PipelineLayout; }
 
@@ -146,6 +153,11 @@ private:
     void InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo);
     void InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo);
 
+    void LinkOptimizedPipelineAsync(IThreadPool*                                    pThreadPool,
+                                    const PipelineLibraryCacheVk::LibraryArrayType& Libraries,
+                                    VkPipelineCreateFlags                           Flags,
+                                    IPipelineStateCache*                            pPSOCache);
+
     // TPipelineStateBase::Construct needs access to InitializePipeline
     friend TPipelineStateBase;
 
@@ -154,6 +166,12 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // Graphics pipeline linked with link-time optimization from the same libraries as m_Pipeline.
+    // It is built in the background when m_Pipeline is fast-linked.
+    VulkanUtilities::PipelineWrapper m_OptimizedPipeline;
+    std::atomic<VkPipeline>          m_vkOptimizedPipeline{VK_NULL_HANDLE};
+    RefCntAutoPtr<IAsyncTask>        m_OptimizedPipelineTask;
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
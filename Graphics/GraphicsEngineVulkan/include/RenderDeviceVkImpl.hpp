@@ -30,6 +30,7 @@
 /// \file
 /// Declaration of Diligent::RenderDeviceVkImpl class
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -51,6 +52,7 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "PipelineLibraryCacheVk.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
 
@@ -235,12 +237,34 @@ public:
         return m_pDxCompiler.get();
     }
 
+    /// Implementation of IRenderDeviceVk::GetDynamicHeapChunkStats().
+    virtual void DILIGENT_CALL_TYPE GetDynamicHeapChunkStats(Uint32& NumChunks, DynamicHeapChunkStatsVk* pStats) const override final;
+
+    /// Implementation of IRenderDeviceVk::GetMemoryBudget().
+    virtual void DILIGENT_CALL_TYPE GetMemoryBudget(MemoryBudgetVk& Budget) override final;
+
+    /// Implementation of IRenderDeviceVk::SetMemoryBudgetCallback().
+    virtual void DILIGENT_CALL_TYPE SetMemoryBudgetCallback(MemoryBudgetCallbackVkType Callback,
+                                                            void*                      pUserData,
+                                                            float                      Threshold) override final;
+
     DescriptorSetAllocation AllocateDescriptorSet(Uint64 CommandQueueMask, VkDescriptorSetLayout SetLayout, const char* DebugName = "")
     {
         return m_DescriptorSetAllocator.Allocate(CommandQueueMask, SetLayout, DebugName);
     }
     DescriptorPoolManager& GetDynamicDescriptorPool() { return m_DynamicDescriptorPool; }
 
+    // Returns true if shader resources are bound through descriptor buffers (VK_EXT_descriptor_buffer)
+    // rather than descriptor sets.
+    bool UseDescriptorBuffers() const { return m_LogicalDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE; }
+
+    // Returns true if small dynamic descriptor sets may be updated with push descriptors (VK_KHR_push_descriptor).
+    // Push descriptors are not used together with descriptor buffers.
+    bool UsePushDescriptors() const { return m_LogicalDevice->GetEnabledExtFeatures().PushDescriptor && !UseDescriptorBuffers(); }
+
+    // Returns true if pipeline barriers are recorded with vkCmdPipelineBarrier2KHR (VK_KHR_synchronization2).
+    bool UseSynchronization2() const { return m_LogicalDevice->GetEnabledExtFeatures().Synchronization2.synchronization2 != VK_FALSE; }
+
     std::shared_ptr<const VulkanUtilities::Instance> GetInstance() const { return m_Instance; }
 
     const VulkanUtilities::PhysicalDevice& GetPhysicalDevice() const { return *m_PhysicalDevice; }
@@ -249,6 +273,9 @@ public:
     FramebufferCache* GetFramebufferCache() { return m_FramebufferCache.get(); }
     RenderPassCache*  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache.get(); }
 
+    // Returns null if graphics pipeline libraries are not enabled
+    PipelineLibraryCacheVk* GetPipelineLibraryCache() { return m_PipelineLibraryCache.get(); }
+
     VulkanUtilities::MemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
     {
         return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags);
@@ -312,6 +339,8 @@ private:
     std::unique_ptr<FramebufferCache> m_FramebufferCache;
     std::unique_ptr<RenderPassCache>  m_ImplicitRenderPassCache;
 
+    std::unique_ptr<PipelineLibraryCacheVk> m_PipelineLibraryCache;
+
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
 
@@ -325,6 +354,25 @@ private:
 
     VulkanUtilities::MemoryManager m_MemoryMgr;
 
+    // Updates memory heap budgets and invokes the memory budget callback for
+    // the heaps whose usage has reached the threshold.
+    void UpdateMemoryBudget();
+
+    void GetMemoryHeapBudget(Uint32 HeapIndex, MemoryHeapBudgetVk& Budget) const;
+
+    struct MemoryBudgetCallbackInfo
+    {
+        MemoryBudgetCallbackVkType Callback  = nullptr;
+        void*                      pUserData = nullptr;
+        float                      Threshold = 1.f;
+
+        // Heaps whose usage is above the threshold. The callback is only invoked
+        // when the heap usage crosses the threshold.
+        Uint32 HeapsAboveThresholdMask = 0;
+    };
+    std::mutex               m_MemoryBudgetCallbackMtx;
+    MemoryBudgetCallbackInfo m_MemoryBudgetCallback;
+
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
@@ -52,6 +52,12 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// When descriptor buffers are used, there are no Vulkan descriptor sets. Instead, every set
+// keeps the descriptor data that is written when resources are bound and is copied to the descriptor
+// buffer when the set is committed:
+//
+//  | DescriptorSet[0] | ... | DescriptorSet[Ns-1] | Resources | Inline constant values | Set data[0] | ... | Set data[Ns-1] |
 
 #include <vector>
 #include <memory>
@@ -61,6 +67,7 @@
 #include "BufferVkImpl.hpp"
 #include "ShaderResourceCacheCommon.hpp"
 #include "PipelineResourceAttribsVk.hpp"
+#include "DescriptorBufferSetLayoutVk.hpp"
 #include "VulkanUtilities/LogicalDevice.hpp"
 
 namespace Diligent
@@ -89,17 +96,20 @@ public:
 
     ~ShaderResourceCacheVk();
 
-    static size_t GetRequiredMemorySize(Uint32        NumSets,
-                                        const Uint32* SetSizes,
-                                        Uint32        TotalInlineConstants);
+    static size_t GetRequiredMemorySize(Uint32                             NumSets,
+                                        const Uint32*                      SetSizes,
+                                        Uint32                             TotalInlineConstants,
+                                        const DescriptorBufferSetLayoutVk* DescrBufferLayouts = nullptr);
 
     // Allocates memory for descriptor sets and resources, including space for inline constants.
+    // If DescrBufferLayouts is not null, also allocates the descriptor data for every set.
     // IMPORTANT: This function only allocates memory. After calling InitializeSets(), you must
     //            call InitializeResources/InitializeInlineConstantBuffer to construct Resource objects.
-    void InitializeSets(IMemoryAllocator& MemAllocator,
-                        Uint32            NumSets,
-                        const Uint32*     SetSizes,
-                        Uint32            TotalInlineConstants = 0);
+    void InitializeSets(IMemoryAllocator&                  MemAllocator,
+                        Uint32                             NumSets,
+                        const Uint32*                      SetSizes,
+                        Uint32                             TotalInlineConstants = 0,
+                        const DescriptorBufferSetLayoutVk* DescrBufferLayouts   = nullptr);
 
     void InitializeResources(Uint32         Set,
                              Uint32         Offset,
@@ -162,6 +172,11 @@ public:
         VkDescriptorImageInfo  GetSamplerDescriptorWriteInfo()                           const;
         VkDescriptorImageInfo  GetInputAttachmentDescriptorWriteInfo()                   const;
         VkWriteDescriptorSetAccelerationStructureKHR GetAccelerationStructureWriteInfo() const;
+
+        // Descriptor buffer address info. BufferOffset is added to the address of uniform and storage buffers.
+        VkDescriptorAddressInfoEXT GetUniformBufferAddressInfo(Uint64 BufferOffset)      const;
+        VkDescriptorAddressInfoEXT GetStorageBufferAddressInfo(Uint64 BufferOffset)      const;
+        VkDescriptorAddressInfoEXT GetTexelBufferAddressInfo()                           const;
         // clang-format on
 
         template <DescriptorType DescrType>
@@ -175,14 +190,19 @@ public:
         explicit operator bool() const { return !IsNull(); }
     };
 
-    // sizeof(DescriptorSet) == 48 (x64, msvc, Release)
+    // sizeof(DescriptorSet) == 64 (x64, msvc, Release)
     class DescriptorSet
     {
     public:
         // clang-format off
-        DescriptorSet(Uint32 NumResources, Resource *pResources) :
-            m_NumResources  {NumResources},
-            m_pResources    {pResources  }
+        DescriptorSet(Uint32                             NumResources,
+                      Resource*                          pResources,
+                      const DescriptorBufferSetLayoutVk* pDescrBufferLayout = nullptr,
+                      Uint8*                             pDescriptorData    = nullptr) :
+            m_NumResources      {NumResources      },
+            m_pResources        {pResources        },
+            m_pDescrBufferLayout{pDescrBufferLayout},
+            m_pDescriptorData   {pDescriptorData   }
         {}
 
         DescriptorSet             (const DescriptorSet&) = delete;
@@ -204,12 +224,19 @@ public:
             return m_DescriptorSetAllocation.GetVkDescriptorSet();
         }
 
+        // Descriptor data of the set when descriptor buffers are used, or null otherwise.
+        const Uint8* GetDescriptorData() const { return m_pDescriptorData; }
+
+        const DescriptorBufferSetLayoutVk* GetDescriptorBufferLayout() const { return m_pDescrBufferLayout; }
+
     private:
         // clang-format off
-/* 0 */ const Uint32            m_NumResources = 0;
-/* 8 */ Resource* const         m_pResources   = nullptr;
-/*16 */ DescriptorSetAllocation m_DescriptorSetAllocation;
-/*48 */ // End of structure
+/* 0 */ const Uint32                             m_NumResources       = 0;
+/* 8 */ Resource* const                          m_pResources         = nullptr;
+/*16 */ DescriptorSetAllocation                  m_DescriptorSetAllocation;
+/*48 */ const DescriptorBufferSetLayoutVk* const m_pDescrBufferLayout = nullptr;
+/*56 */ Uint8* const                             m_pDescriptorData    = nullptr;
+/*64 */ // End of structure
         // clang-format on
 
     private:
@@ -320,12 +347,25 @@ public:
     {
         Uint32 NumOffsetsWritten = 0;
         Uint32 NumOffsetsChanged = 0;
+        // The number of buffers whose dynamic heap chunk has changed
+        Uint32 NumChunksChanged = 0;
+        // Bit mask of the descriptor sets that contain buffers allocated from overflow chunks of the dynamic heap
+        Uint32 OverflowSetMask = 0;
     };
+    // Writes the current dynamic offsets of all buffers with dynamic offsets to Offsets and the indices
+    // of the dynamic heap chunks the buffers are allocated from to Chunks, starting at StartInd.
     WriteDynamicBufferOffsetsResult WriteDynamicBufferOffsets(
         DeviceContextVkImpl*   pCtx,
         std::vector<uint32_t>& Offsets,
+        std::vector<Uint32>&   Chunks,
         Uint32                 StartInd) const;
 
+    // Copies the descriptor data of the set to pDstData (descriptor buffer memory) and writes
+    // the descriptors of the buffers bound to dynamic descriptors using their current offsets.
+    void WriteDescriptorBufferData(DeviceContextVkImpl* pCtx,
+                                   Uint32               SetIndex,
+                                   Uint8*               pDstData) const;
+
 private:
     Resource* GetFirstResourcePtr()
     {
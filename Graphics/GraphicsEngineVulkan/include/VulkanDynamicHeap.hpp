@@ -29,6 +29,8 @@
 
 #include <atomic>
 #include <mutex>
+#include <memory>
+#include <vector>
 #include "VulkanUtilities/VulkanHeaders.h"
 #include "VulkanUtilities/MemoryManager.hpp"
 #include "VulkanUtilities/LogicalDevice.hpp"
@@ -45,7 +47,7 @@ namespace Diligent
 
 class RenderDeviceVkImpl;
 class VulkanRingBuffer;
-class VulkanDynamicMemoryManager;
+class VulkanDynamicMemoryChunk;
 
 // sizeof(VulkanDynamicAllocation) must be at least 16 to avoid false cache line sharing problems
 struct VulkanDynamicAllocation
@@ -53,8 +55,8 @@ struct VulkanDynamicAllocation
     VulkanDynamicAllocation() noexcept {}
 
     // clang-format off
-    VulkanDynamicAllocation(VulkanDynamicMemoryManager& _DynamicMemMgr, size_t _AlignedOffset, size_t _Size) noexcept :
-        pDynamicMemMgr{&_DynamicMemMgr},
+    VulkanDynamicAllocation(VulkanDynamicMemoryChunk& _Chunk, size_t _AlignedOffset, size_t _Size) noexcept :
+        pChunk        {&_Chunk        },
         AlignedOffset {_AlignedOffset },
         Size          {_Size          }
     {}
@@ -63,14 +65,14 @@ struct VulkanDynamicAllocation
     VulkanDynamicAllocation& operator = (const VulkanDynamicAllocation&) = delete;
 
     VulkanDynamicAllocation             (VulkanDynamicAllocation&& rhs)noexcept :
-        pDynamicMemMgr{rhs.pDynamicMemMgr},
+        pChunk        {rhs.pChunk        },
         AlignedOffset {rhs.AlignedOffset },
         Size          {rhs.Size          }
 #ifdef DILIGENT_DEVELOPMENT
         , dvpFrameNumber{rhs.dvpFrameNumber}
 #endif
     {
-        rhs.pDynamicMemMgr = nullptr;
+        rhs.pChunk         = nullptr;
         rhs.AlignedOffset  = 0;
         rhs.Size           = 0;
 #ifdef DILIGENT_DEVELOPMENT
@@ -81,7 +83,7 @@ struct VulkanDynamicAllocation
 
     bool IsValid() const
     {
-        return pDynamicMemMgr != nullptr;
+        return pChunk != nullptr;
     }
     explicit operator bool() const
     {
@@ -90,10 +92,10 @@ struct VulkanDynamicAllocation
 
     VulkanDynamicAllocation& operator=(VulkanDynamicAllocation&& rhs) noexcept // Must be noexcept on MSVC, so can't use = default
     {
-        pDynamicMemMgr     = rhs.pDynamicMemMgr;
+        pChunk             = rhs.pChunk;
         AlignedOffset      = rhs.AlignedOffset;
         Size               = rhs.Size;
-        rhs.pDynamicMemMgr = nullptr;
+        rhs.pChunk         = nullptr;
         rhs.AlignedOffset  = 0;
         rhs.Size           = 0;
 #ifdef DILIGENT_DEVELOPMENT
@@ -103,33 +105,107 @@ struct VulkanDynamicAllocation
         return *this;
     }
 
-    VulkanDynamicMemoryManager* pDynamicMemMgr = nullptr;
-    size_t                      AlignedOffset  = 0; // Offset from the start of the buffer
-    size_t                      Size           = 0; // Reserved size of this allocation
+    VkBuffer GetVkBuffer() const;
+    Uint8*   GetCPUAddress() const;
+
+    VulkanDynamicMemoryChunk* pChunk        = nullptr; // Chunk the allocation was made from
+    size_t                    AlignedOffset = 0;       // Offset from the start of the chunk buffer
+    size_t                    Size          = 0;       // Reserved size of this allocation
 #ifdef DILIGENT_DEVELOPMENT
     Uint64 dvpFrameNumber = 0;
 #endif
 };
 
 
-// VulkanDynamicMemoryManager manages allocation of master blocks from global dynamic buffer
+// VulkanDynamicMemoryChunk is a persistently mapped Vulkan buffer from which master blocks are suballocated
+class VulkanDynamicMemoryChunk : public DynamicHeap::MasterBlockListBasedManager
+{
+public:
+    using TBase       = DynamicHeap::MasterBlockListBasedManager;
+    using OffsetType  = TBase::OffsetType;
+    using MasterBlock = TBase::MasterBlock;
+
+    VulkanDynamicMemoryChunk(IMemoryAllocator&   Allocator,
+                             RenderDeviceVkImpl& DeviceVk,
+                             Uint32              Size,
+                             Uint32              Index) noexcept(false);
+    ~VulkanDynamicMemoryChunk();
+
+    // clang-format off
+    VulkanDynamicMemoryChunk            (const VulkanDynamicMemoryChunk&)  = delete;
+    VulkanDynamicMemoryChunk            (      VulkanDynamicMemoryChunk&&) = delete;
+    VulkanDynamicMemoryChunk& operator= (const VulkanDynamicMemoryChunk&)  = delete;
+    VulkanDynamicMemoryChunk& operator= (      VulkanDynamicMemoryChunk&&) = delete;
+
+    VkBuffer        GetVkBuffer()     const{return m_VkBuffer;}
+    Uint8*          GetCPUAddress()   const{return m_CPUAddress;}
+    VkDeviceAddress GetDeviceAddress()const{return m_DeviceAddress;}
+    Uint32          GetIndex()        const{return m_Index;}
+    bool            IsResident()      const{return m_VkBuffer != VK_NULL_HANDLE;}
+    // clang-format on
+
+    // Creates the Vulkan buffer and maps its memory.
+    void Create() noexcept(false);
+
+    // Moves the Vulkan buffer and memory into the release queues. The chunk can be created again later.
+    void Destroy(Uint64 CmdQueueMask);
+
+    // Allocates the master block without waiting for the space to become available.
+    MasterBlock TryAllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment);
+
+private:
+    friend class VulkanDynamicMemoryManager;
+
+    RenderDeviceVkImpl&                  m_DeviceVk;
+    const Uint32                         m_Index;
+    VulkanUtilities::BufferWrapper       m_VkBuffer;
+    VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
+    Uint8*                               m_CPUAddress = nullptr;
+
+    // Device address of the buffer. Only available for the primary chunk when descriptor buffers are used.
+    VkDeviceAddress m_DeviceAddress = 0;
+
+    // The number of consecutive frames the overflow chunk has been empty.
+    // Protected by VulkanDynamicMemoryManager::m_OverflowChunksMtx.
+    Uint32 m_IdleFrameCount = 0;
+};
+
+
+// VulkanDynamicMemoryManager manages allocation of master blocks from global dynamic buffers
 //
 //   _______________________________________________________________________
 //  |                                                                       |
 //  |                      VulkanDynamicMemoryManager                       |
 //  |                                                                       |
-//  |  || - - - - - - - - - - Dynamic Memory Buffer- - - - - - - - - -||    |
+//  |  || - - - - - - - - - - - - Primary chunk - - - - - - - - - - - ||    |
 //  |  || MasterBlock[0] | MasterBlock[1] |  ...   | MasterBlock[N-1] ||    |
+//  |                                                                       |
+//  |  || - - - - Overflow chunk 1 - - - - ||  ...                          |
 //  |_______________________________________________________________________|
 //
 // We cannot use global memory manager for dynamic resources because they
-// need to use the same Vulkan buffer
-class VulkanDynamicMemoryManager : public DynamicHeap::MasterBlockListBasedManager
+// need to use the same Vulkan buffer.
+//
+// When descriptor buffers are used, the primary chunk is also the descriptor buffer that
+// holds descriptor set data of committed SRBs, which must always be allocated from it.
+// All other allocations, including the data of dynamic buffers, carry their chunk with them and
+// may be placed in overflow chunks that are created on demand when the primary chunk is exhausted,
+// instead of stalling on the GPU. The device context takes the Vulkan buffer of a dynamic buffer
+// from its current allocation and rewrites descriptor sets that reference overflow chunks.
+// Overflow chunks are released after they have been idle for OverflowChunkRetireFrames frames.
+class VulkanDynamicMemoryManager
 {
 public:
-    using TBase       = DynamicHeap::MasterBlockListBasedManager;
-    using OffsetType  = TBase::OffsetType;
-    using MasterBlock = TBase::MasterBlock;
+    using OffsetType  = VulkanDynamicMemoryChunk::OffsetType;
+    using MasterBlock = VulkanDynamicMemoryChunk::MasterBlock;
+
+    struct ChunkMasterBlock
+    {
+        VulkanDynamicMemoryChunk* pChunk = nullptr;
+        MasterBlock               Block;
+
+        bool IsValid() const { return pChunk != nullptr && Block.IsValid(); }
+    };
 
     VulkanDynamicMemoryManager(IMemoryAllocator&         Allocator,
                                class RenderDeviceVkImpl& DeviceVk,
@@ -143,26 +219,76 @@ public:
     VulkanDynamicMemoryManager& operator= (const VulkanDynamicMemoryManager&)  = delete;
     VulkanDynamicMemoryManager& operator= (      VulkanDynamicMemoryManager&&) = delete;
 
-    VkBuffer GetVkBuffer()  const{return m_VkBuffer;}
-    Uint8*   GetCPUAddress()const{return m_CPUAddress;}
+    // Returns the buffer of the primary chunk. Dynamic buffers without backing resource report it as their
+    // Vulkan buffer, but the data may be allocated from an overflow chunk (see VulkanDynamicAllocation::GetVkBuffer()).
+    VkBuffer        GetVkBuffer()     const{return m_PrimaryChunk.GetVkBuffer();}
+    VkDeviceAddress GetDeviceAddress()const{return m_PrimaryChunk.GetDeviceAddress();}
+    OffsetType      GetSize()         const{return m_PrimaryChunk.GetSize();}
+
+    VulkanDynamicMemoryChunk& GetPrimaryChunk(){return m_PrimaryChunk;}
     // clang-format on
 
     void Destroy();
 
     static constexpr const Uint32 MasterBlockAlignment = 1024;
-    MasterBlock                   AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment);
+
+    // The number of frames an overflow chunk must remain empty before it is released.
+    static constexpr const Uint32 OverflowChunkRetireFrames = 120;
+
+    // Allocates a master block. If AllowOverflow is false, the block is allocated from the
+    // primary chunk, waiting for the GPU if necessary. Otherwise, when the primary chunk is
+    // exhausted, the block is allocated from an overflow chunk.
+    ChunkMasterBlock AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment, bool AllowOverflow);
+
+    void ReleaseMasterBlocks(std::vector<ChunkMasterBlock>& Blocks, RenderDeviceVkImpl& Device, Uint64 CmdQueueMask);
+
+    struct ChunkStats
+    {
+        Uint32     Index        = 0; // 0 is the primary chunk
+        OffsetType Size         = 0;
+        OffsetType UsedSize     = 0;
+        OffsetType PeakUsedSize = 0;
+        bool       IsResident   = false;
+    };
+    // Returns the usage statistics of the primary chunk followed by all overflow chunks.
+    // Pages reserved by the dynamic heaps but not yet used are not counted.
+    std::vector<ChunkStats> GetChunkStats() const;
+
+#ifdef DILIGENT_DEVELOPMENT
+    Int32 GetMasterBlockCounter();
+#endif
 
 private:
-    RenderDeviceVkImpl&                  m_DeviceVk;
-    VulkanUtilities::BufferWrapper       m_VkBuffer;
-    VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
-    Uint8*                               m_CPUAddress;
-    const VkDeviceSize                   m_DefaultAlignment;
-    const Uint64                         m_CommandQueueMask;
-    // Updated by dynamic heaps from multiple device contexts when they allocate master blocks.
-    std::atomic<OffsetType> m_TotalPeakSize{0};
+    MasterBlock      AllocateFromPrimaryChunk(OffsetType SizeInBytes, OffsetType Alignment);
+    ChunkMasterBlock AllocateFromOverflowChunk(OffsetType SizeInBytes, OffsetType Alignment);
+
+    void RetireIdleChunks();
+
+private:
+    IMemoryAllocator&   m_Allocator;
+    RenderDeviceVkImpl& m_DeviceVk;
+    const Uint64        m_CommandQueueMask;
+
+    VulkanDynamicMemoryChunk m_PrimaryChunk;
+
+    mutable std::mutex                                     m_OverflowChunksMtx;
+    std::vector<std::unique_ptr<VulkanDynamicMemoryChunk>> m_OverflowChunks;
+    // The number of overflow chunks that currently own Vulkan buffers.
+    std::atomic<Uint32> m_NumResidentOverflowChunks{0};
 };
 
+inline VkBuffer VulkanDynamicAllocation::GetVkBuffer() const
+{
+    VERIFY_EXPR(pChunk != nullptr);
+    return pChunk->GetVkBuffer();
+}
+
+inline Uint8* VulkanDynamicAllocation::GetCPUAddress() const
+{
+    VERIFY_EXPR(pChunk != nullptr);
+    return pChunk->GetCPUAddress() + AlignedOffset;
+}
+
 
 
 // Dynamic heap is used by a device context to allocate dynamic space when
@@ -187,9 +313,11 @@ private:
 //             V                               |                              |
 //                                             |  VulkanDynamicMemoryManager  |
 //                                             |                              |
-//                                             |   |Global dynamic buffer|    |
+//                                             |   |Global dynamic buffers|   |
 //                                             |______________________________|
 //
+// The heap keeps separate current master blocks for the primary chunk and the overflow
+// chunks so that allocations that do not allow overflow always stay in the primary chunk.
 class VulkanDynamicHeap
 {
 public:
@@ -197,6 +325,7 @@ public:
     VulkanDynamicHeap(VulkanDynamicMemoryManager& DynamicMemMgr, std::string HeapName, Uint32 PageSize) :
         m_GlobalDynamicMemMgr{DynamicMemMgr},
         m_HeapName           {std::move(HeapName)},
+        m_PrimaryBlockCache  {DynamicMemMgr.GetPrimaryChunk(), PageSize, VulkanDynamicMemoryManager::MasterBlockAlignment, GetMasterBlockCacheBatchSize(DynamicMemMgr, PageSize)},
         m_MasterBlockSize    (PageSize)
     {}
 
@@ -208,7 +337,9 @@ public:
 
     ~VulkanDynamicHeap();
 
-    VulkanDynamicAllocation Allocate(Uint32 SizeInBytes, Uint32 Alignment);
+    // If AllowOverflow is true, the allocation may be placed in an overflow chunk of the
+    // dynamic memory manager. Users must then take the Vulkan buffer from the allocation.
+    VulkanDynamicAllocation Allocate(Uint32 SizeInBytes, Uint32 Alignment, bool AllowOverflow);
 
     // Releases all master blocks that are later returned to the global dynamic memory manager.
     // CmdQueueMask indicates which command queues the allocations from this heap were used
@@ -217,22 +348,39 @@ public:
     // be destroyed before the blocks are actually returned to the global dynamic memory manager.
     void ReleaseMasterBlocks(RenderDeviceVkImpl& DeviceVkImpl, Uint64 CmdQueueMask);
 
-    using OffsetType  = VulkanDynamicMemoryManager::OffsetType;
-    using MasterBlock = VulkanDynamicMemoryManager::MasterBlock;
+    using OffsetType       = VulkanDynamicMemoryManager::OffsetType;
+    using MasterBlock      = VulkanDynamicMemoryManager::MasterBlock;
+    using ChunkMasterBlock = VulkanDynamicMemoryManager::ChunkMasterBlock;
 
     static constexpr OffsetType InvalidOffset = static_cast<OffsetType>(-1);
 
     size_t GetAllocatedMasterBlockCount() const { return m_MasterBlocks.size(); }
 
 private:
+    static Uint32 GetMasterBlockCacheBatchSize(const VulkanDynamicMemoryManager& DynamicMemMgr, Uint32 PageSize);
+
+    // Master block from which allocations are made in a linear fashion
+    struct CurrentBlock
+    {
+        VulkanDynamicMemoryChunk* pChunk        = nullptr;
+        OffsetType                Offset        = InvalidOffset;
+        Uint32                    AvailableSize = 0;
+
+        OffsetType Allocate(Uint32 SizeInBytes, Uint32 Alignment, OffsetType& AlignedSize);
+    };
+
     VulkanDynamicMemoryManager& m_GlobalDynamicMemMgr;
     const std::string           m_HeapName;
 
-    std::vector<MasterBlock> m_MasterBlocks;
+    std::vector<ChunkMasterBlock> m_MasterBlocks;
+
+    // Pages of the primary chunk reserved by this context. Pages are reserved in batches
+    // so that the context does not lock the primary chunk every time it needs a new page.
+    DynamicHeap::MasterBlockCache<DynamicHeap::MasterBlockListBasedManager> m_PrimaryBlockCache;
 
-    OffsetType   m_CurrOffset = InvalidOffset;
+    CurrentBlock m_PrimaryBlock;
+    CurrentBlock m_OverflowBlock;
     const Uint32 m_MasterBlockSize;
-    Uint32       m_AvailableSize = 0;
 
     Uint32 m_CurrAlignedSize   = 0;
     Uint32 m_CurrUsedSize      = 0;
@@ -393,6 +393,7 @@ public:
         vkEndCommandBuffer(m_VkCmdBuffer);
     }
 
+    // Note that barrier statistics and Synchronization2 mode are not reset.
     __forceinline void Reset()
     {
         m_VkCmdBuffer = VK_NULL_HANDLE;
@@ -504,6 +505,58 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
+    // Binds the descriptor buffer that holds descriptor set data (VK_EXT_descriptor_buffer).
+    // The binding is cached, so the command is only recorded when the buffer changes.
+    __forceinline void BindDescriptorBuffer(VkDeviceAddress Address, VkBufferUsageFlags Usage)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR(Address != 0);
+        if (m_State.DescriptorBufferAddress != Address)
+        {
+            VkDescriptorBufferBindingInfoEXT BindingInfo{};
+            BindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+            BindingInfo.address = Address;
+            BindingInfo.usage   = Usage;
+            vkCmdBindDescriptorBuffersEXT(m_VkCmdBuffer, 1, &BindingInfo);
+            m_State.DescriptorBufferAddress = Address;
+        }
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint,
+                                                  VkPipelineLayout    layout,
+                                                  uint32_t            firstSet,
+                                                  uint32_t            setCount,
+                                                  const uint32_t*     pBufferIndices,
+                                                  const VkDeviceSize* pOffsets)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(m_State.DescriptorBufferAddress != 0, "No descriptor buffer bound");
+        vkCmdSetDescriptorBufferOffsetsEXT(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+#else
+        UNSUPPORTED("Descriptor buffers are not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void PushDescriptorSet(VkPipelineBindPoint         pipelineBindPoint,
+                                         VkPipelineLayout            layout,
+                                         uint32_t                    set,
+                                         uint32_t                    descriptorWriteCount,
+                                         const VkWriteDescriptorSet* pDescriptorWrites)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR(descriptorWriteCount > 0 && pDescriptorWrites != nullptr);
+        vkCmdPushDescriptorSetKHR(m_VkCmdBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+#else
+        UNSUPPORTED("Push descriptors are not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void PushConstants(VkPipelineLayout   layout,
                                      VkShaderStageFlags stageFlags,
                                      uint32_t           offset,
@@ -826,6 +879,26 @@ public:
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_Barrier.SupportedStagesMask; }
     VkAccessFlags        GetSupportedAccessMask() const { return m_Barrier.SupportedAccessMask; }
 
+    // When enabled, barriers are recorded with vkCmdPipelineBarrier2KHR (VK_KHR_synchronization2),
+    // which allows every image barrier to use its own stage masks instead of the union of all stages.
+    void SetUseSynchronization2(bool UseSync2) { m_UseSync2 = UseSync2; }
+    bool GetUseSynchronization2() const { return m_UseSync2; }
+
+    struct BarrierStatistics
+    {
+        // The number of vkCmdPipelineBarrier/vkCmdPipelineBarrier2KHR commands recorded.
+        uint32_t NumPipelineBarriers = 0;
+
+        // The number of image layout transitions and memory barriers requested by the user.
+        uint32_t NumRequestedBarriers = 0;
+
+        // The number of image layout transitions that were merged into a pending
+        // transition of the same subresource range instead of being recorded separately.
+        uint32_t NumMergedTransitions = 0;
+    };
+    const BarrierStatistics& GetBarrierStatistics() const { return m_BarrierStats; }
+    void                     ResetBarrierStatistics() { m_BarrierStats = {}; }
+
     struct StateCache
     {
         VkRenderPass  RenderPass           = VK_NULL_HANDLE;
@@ -841,6 +914,8 @@ public:
         uint32_t      InsidePassQueries    = 0;
         uint32_t      OutsidePassQueries   = 0;
         size_t        DynamicRenderingHash = 0;
+
+        VkDeviceAddress DescriptorBufferAddress = 0;
     };
 
     __forceinline bool IsInRenderScope() const { return m_State.RenderPass != VK_NULL_HANDLE || m_State.DynamicRenderingHash != 0; }
@@ -862,11 +937,18 @@ private:
         VkAccessFlags        SupportedAccessMask = ~0u;
     };
 
-    VkCommandBuffer m_VkCmdBuffer = VK_NULL_HANDLE;
-    StateCache      m_State;
-    PipelineBarrier m_Barrier;
+    VkCommandBuffer   m_VkCmdBuffer = VK_NULL_HANDLE;
+    StateCache        m_State;
+    PipelineBarrier   m_Barrier;
+    BarrierStatistics m_BarrierStats;
+    bool              m_UseSync2 = false;
+
+    // Pending image barriers. Every barrier keeps its own stage masks that are used by
+    // Synchronization2 path. Legacy path uses the union of all stages stored in m_Barrier.
+    std::vector<VkImageMemoryBarrier2KHR> m_ImageBarriers;
 
-    std::vector<VkImageMemoryBarrier> m_ImageBarriers;
+    // Scratch space to convert pending image barriers for vkCmdPipelineBarrier
+    std::vector<VkImageMemoryBarrier> m_LegacyImageBarriers;
 };
 
 } // namespace VulkanUtilities
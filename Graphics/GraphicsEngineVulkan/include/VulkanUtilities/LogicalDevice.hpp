@@ -240,6 +240,12 @@ public:
     VkResult CopyMemoryToImage(const VkCopyMemoryToImageInfoEXT& CopyInfo) const;
     VkResult HostTransitionImageLayout(const VkHostImageLayoutTransitionInfoEXT& TransitionInfo) const;
 
+    VkDeviceSize GetDescriptorSetLayoutSize(VkDescriptorSetLayout Layout) const;
+    VkDeviceSize GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout Layout, uint32_t Binding) const;
+    void         GetDescriptor(const VkDescriptorGetInfoEXT& GetInfo, size_t DataSize, void* pDescriptor) const;
+
+    VkDeviceAddress GetBufferDeviceAddress(VkBuffer Buffer) const;
+
     void GetAccelerationStructureBuildSizes(const VkAccelerationStructureBuildGeometryInfoKHR& BuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR& SizeInfo) const;
 
     VkResult GetRayTracingShaderGroupHandles(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const;
@@ -32,12 +32,15 @@
 #include <unordered_map>
 #include <atomic>
 #include <string>
+#include <vector>
+#include <memory>
 #include "MemoryAllocator.h"
 #include "VariableSizeAllocationsManager.hpp"
 #include "VulkanUtilities/PhysicalDevice.hpp"
 #include "VulkanUtilities/LogicalDevice.hpp"
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "HashUtils.hpp"
+#include "SharedMutex.hpp"
 
 namespace VulkanUtilities
 {
@@ -108,30 +111,33 @@ public:
                VkDeviceSize          PageSize,
                uint32_t              MemoryTypeIndex,
                bool                  IsHostVisible,
-               VkMemoryAllocateFlags AllocateFlags);
+               VkMemoryAllocateFlags AllocateFlags,
+               bool                  IsDedicated = false);
     ~MemoryPage();
 
     // clang-format off
-    MemoryPage(MemoryPage&& rhs)noexcept :
-        m_ParentMemoryMgr {rhs.m_ParentMemoryMgr         },
-        m_AllocationMgr   {std::move(rhs.m_AllocationMgr)},
-        m_VkMemory        {std::move(rhs.m_VkMemory)     },
-        m_CPUMemory       {rhs.m_CPUMemory               }
-    {
-        rhs.m_CPUMemory = nullptr;
-    }
-
     MemoryPage            (const MemoryPage&) = delete;
-    MemoryPage& operator= (MemoryPage&)       = delete;
-    MemoryPage& operator= (MemoryPage&& rhs)  = delete;
+    MemoryPage            (MemoryPage&&)      = delete;
+    MemoryPage& operator= (const MemoryPage&) = delete;
+    MemoryPage& operator= (MemoryPage&&)      = delete;
 
     bool IsEmpty() const { return m_AllocationMgr.IsEmpty(); }
     bool IsFull()  const { return m_AllocationMgr.IsFull();  }
     VkDeviceSize GetPageSize() const { return m_AllocationMgr.GetMaxSize();  }
     VkDeviceSize GetUsedSize() const { return m_AllocationMgr.GetUsedSize(); }
 
+    // Dedicated pages hold a single large allocation and are never used for sub-allocation.
+    bool IsDedicated() const { return m_IsDedicated; }
     // clang-format on
 
+    // Returns the size of the largest free block in the page. The value is updated
+    // under the page mutex, but is read without locking it, so it is only a hint:
+    // when it is smaller than the requested size, the allocation will certainly fail.
+    VkDeviceSize GetMaxFreeBlockSizeHint() const { return m_MaxFreeBlockSize.load(std::memory_order_relaxed); }
+
+    // Returns true if the page has no allocations. Unlike IsEmpty(), this method locks the page mutex.
+    bool IsUnused();
+
     MemoryAllocation Allocate(VkDeviceSize size, VkDeviceSize alignment);
 
     VkDeviceMemory GetVkMemory() const { return m_VkMemory; }
@@ -149,9 +155,28 @@ private:
     std::mutex                               m_Mutex;
     Diligent::VariableSizeAllocationsManager m_AllocationMgr;
     VulkanUtilities::DeviceMemoryWrapper     m_VkMemory;
-    void*                                    m_CPUMemory = nullptr;
+    void*                                    m_CPUMemory   = nullptr;
+    const bool                               m_IsDedicated = false;
+
+    std::atomic<VkDeviceSize> m_MaxFreeBlockSize{0};
 };
 
+// Memory manager keeps a separate list of pages for every combination of memory type index,
+// host visibility and allocation flags:
+//
+//    m_PageLists
+//   |  {Type 0, device-local}   |  ---> [Page 0] [Page 1] ... (shared lock to search, unique lock to add/remove)
+//   |  {Type 1, host-visible}   |  ---> [Page 0] ...
+//
+// Allocations in different lists do not contend with each other. Threads that allocate
+// from the same list only hold the list lock in shared mode while searching for a page,
+// and skip pages whose free block hint is too small without locking them.
+// Allocations that do not fit into a regular page get their own dedicated page.
+//
+// The manager also keeps track of the budget of every memory heap. When VK_EXT_memory_budget
+// is enabled, the budget and usage are reported by the driver and refreshed by UpdateMemoryBudget();
+// between the updates, the usage is estimated from the memory allocated by the manager itself.
+// When a heap approaches its budget, new pages are made smaller and reserved pages are released.
 class MemoryManager
 {
 public:
@@ -172,38 +197,16 @@ public:
         m_HostVisiblePageSize   {HostVisiblePageSize   },
         m_DeviceLocalReserveSize{DeviceLocalReserveSize},
         m_HostVisibleReserveSize{HostVisibleReserveSize}
-    {}
-
-
-    // We have to write this constructor because on msvc default
-    // constructor is not labeled with noexcept, which makes all
-    // std containers use copy instead of move
-    MemoryManager(MemoryManager&& rhs)noexcept :
-        m_MgrName         {std::move(rhs.m_MgrName)},
-        m_LogicalDevice   {rhs.m_LogicalDevice     },
-        m_PhysicalDevice  {rhs.m_PhysicalDevice    },
-        m_Allocator       {rhs.m_Allocator         },
-        m_Pages           {std::move(rhs.m_Pages)  },
-
-        m_DeviceLocalPageSize    {rhs.m_DeviceLocalPageSize   },
-        m_HostVisiblePageSize    {rhs.m_HostVisiblePageSize   },
-        m_DeviceLocalReserveSize {rhs.m_DeviceLocalReserveSize},
-        m_HostVisibleReserveSize {rhs.m_HostVisibleReserveSize},
-
-        //m_CurrUsedSize      {rhs.m_CurrUsedSize},
-        m_PeakUsedSize      {rhs.m_PeakUsedSize     },
-        m_CurrAllocatedSize {rhs.m_CurrAllocatedSize},
-        m_PeakAllocatedSize {rhs.m_PeakAllocatedSize}
     {
-        // clang-format on
-        for (size_t i = 0; i < m_CurrUsedSize.size(); ++i)
-            m_CurrUsedSize[i].store(rhs.m_CurrUsedSize[i].load());
+        UpdateMemoryBudget();
     }
+    // clang-format on
 
     ~MemoryManager();
 
     // clang-format off
     MemoryManager            (const MemoryManager&) = delete;
+    MemoryManager            (MemoryManager&&)      = delete;
     MemoryManager& operator= (const MemoryManager&) = delete;
     MemoryManager& operator= (MemoryManager&&)      = delete;
     // clang-format on
@@ -212,6 +215,26 @@ public:
     MemoryAllocation Allocate(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProps, VkMemoryAllocateFlags AllocateFlags);
     void             ShrinkMemory();
 
+    struct HeapBudget
+    {
+        VkDeviceSize Budget    = 0; // Memory that the process can use from the heap
+        VkDeviceSize Usage     = 0; // Estimated memory used by the process
+        VkDeviceSize Allocated = 0; // Memory allocated by this manager
+    };
+
+    // Queries heap budgets from the driver. If VK_EXT_memory_budget is not enabled, the budget
+    // is estimated as a fraction of the heap size and the usage is the memory allocated by the manager.
+    void UpdateMemoryBudget();
+
+    // Returns the budget of the given heap as of the last UpdateMemoryBudget() call, with the usage
+    // adjusted by the memory allocated or released since then.
+    HeapBudget GetHeapBudget(uint32_t HeapIndex) const;
+
+    bool IsMemoryBudgetReported() const { return m_LogicalDevice.GetEnabledExtFeatures().MemoryBudget; }
+
+    // Fraction of the budget after which the heap is considered to be close to its budget.
+    static constexpr float BudgetTrimThreshold = 0.9f;
+
 protected:
     friend class MemoryPage;
 
@@ -225,7 +248,6 @@ protected:
 
     Diligent::IMemoryAllocator& m_Allocator;
 
-    std::mutex m_PagesMtx;
     struct MemoryPageIndex
     {
         const uint32_t              MemoryTypeIndex;
@@ -257,7 +279,35 @@ protected:
             }
         };
     };
-    std::unordered_multimap<MemoryPageIndex, MemoryPage, MemoryPageIndex::Hasher> m_Pages;
+
+    struct PageList
+    {
+        // Shared lock is used to search for a page, unique lock is used to add or remove pages
+        Threading::SharedMutex                   Mtx;
+        std::vector<std::unique_ptr<MemoryPage>> Pages;
+    };
+
+    // Returns the page list for the given index, creating it if necessary.
+    // Page lists are never removed, so the reference remains valid for the lifetime of the manager.
+    PageList& GetPageList(const MemoryPageIndex& PageIdx);
+
+    // Searches the list for a page that can accommodate the allocation. The list must be locked by the caller.
+    static MemoryAllocation AllocateFromPages(PageList& List, VkDeviceSize Size, VkDeviceSize Alignment);
+
+    // Adds a new page to the list. The list must be locked in exclusive mode by the caller.
+    MemoryPage& AddPage(PageList& List, const MemoryPageIndex& PageIdx, std::unique_ptr<MemoryPage>&& pPage);
+
+    uint32_t GetHeapIndex(uint32_t MemoryTypeIndex) const { return m_PhysicalDevice.GetMemoryProperties().memoryTypes[MemoryTypeIndex].heapIndex; }
+
+    bool IsHeapOverBudget(uint32_t HeapIndex) const { return (m_OverBudgetHeapMask.load() & (1u << HeapIndex)) != 0; }
+
+    // Returns the size of a new page. When the heap is close to its budget, the page
+    // size is reduced, but never below MinSize.
+    VkDeviceSize GetBudgetAwarePageSize(uint32_t MemoryTypeIndex, VkDeviceSize PageSize, VkDeviceSize MinSize) const;
+
+    // Page list lookup is the only operation that requires this mutex
+    std::mutex                                                                        m_PageListsMtx;
+    std::unordered_map<MemoryPageIndex, std::unique_ptr<PageList>, MemoryPageIndex::Hasher> m_PageLists;
 
     const VkDeviceSize m_DeviceLocalPageSize;
     const VkDeviceSize m_HostVisiblePageSize;
@@ -267,12 +317,19 @@ protected:
     void OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible);
 
     // 0 == Device local, 1 == Host-visible
-    std::array<std::atomic<int64_t>, 2> m_CurrUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_PeakUsedSize      = {};
-    std::array<VkDeviceSize, 2>         m_CurrAllocatedSize = {};
-    std::array<VkDeviceSize, 2>         m_PeakAllocatedSize = {};
-
-    // If adding new member, do not forget to update move ctor
+    std::array<std::atomic<int64_t>, 2>      m_CurrUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakUsedSize      = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_CurrAllocatedSize = {};
+    std::array<std::atomic<VkDeviceSize>, 2> m_PeakAllocatedSize = {};
+    std::array<std::atomic<uint32_t>, 2>     m_NumDedicatedPages = {};
+
+    // Per-heap budget state
+    std::mutex                                                 m_BudgetMtx;
+    std::array<std::atomic<VkDeviceSize>, VK_MAX_MEMORY_HEAPS> m_HeapAllocatedSize     = {}; // Memory currently allocated by the manager
+    std::array<std::atomic<VkDeviceSize>, VK_MAX_MEMORY_HEAPS> m_HeapBudget            = {}; // Budget as of the last update
+    std::array<std::atomic<VkDeviceSize>, VK_MAX_MEMORY_HEAPS> m_HeapUsage             = {}; // Usage as of the last update
+    std::array<std::atomic<VkDeviceSize>, VK_MAX_MEMORY_HEAPS> m_HeapAllocatedAtUpdate = {}; // Allocated size as of the last update
+    std::atomic<uint32_t>                                      m_OverBudgetHeapMask{0};
 };
 
 } // namespace VulkanUtilities
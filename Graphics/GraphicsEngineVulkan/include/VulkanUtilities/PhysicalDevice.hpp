@@ -70,6 +70,9 @@ public:
         VkPhysicalDeviceDynamicRenderingFeaturesKHR          DynamicRendering          = {};
         VkPhysicalDeviceHostImageCopyFeaturesEXT             HostImageCopy             = {};
         VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR FragmentShaderBarycentric = {};
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT          DescriptorBuffer          = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT   GraphicsPipelineLibrary   = {};
+        VkPhysicalDeviceSynchronization2FeaturesKHR          Synchronization2          = {};
 
 
         bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
@@ -78,6 +81,8 @@ public:
         bool HasPortabilitySubset = false;
         bool RenderPass2          = false;
         bool DrawIndirectCount    = false;
+        bool PushDescriptor       = false;
+        bool MemoryBudget         = false;
     };
 
     struct ExtensionProperties
@@ -98,6 +103,9 @@ public:
         VkPhysicalDeviceMultiDrawPropertiesEXT                 MultiDraw                 = {};
         VkPhysicalDeviceHostImageCopyPropertiesEXT             HostImageCopy             = {};
         VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR FragmentShaderBarycentric = {};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT          DescriptorBuffer          = {};
+        VkPhysicalDevicePushDescriptorPropertiesKHR            PushDescriptor            = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT   GraphicsPipelineLibrary   = {};
 
         std::unique_ptr<VkImageLayout[]> HostImageCopyLayouts;
     };
@@ -133,6 +141,10 @@ public:
 
     bool IsUMA() const;
 
+    // Queries current heap budgets and usage from the driver.
+    // Returns false if VK_EXT_memory_budget extension is not supported.
+    bool GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const;
+
 private:
     PhysicalDevice(const CreateInfo& CI);
 
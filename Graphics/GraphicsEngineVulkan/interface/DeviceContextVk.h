@@ -39,6 +39,49 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_DeviceContextVk =
     {0x72aeb1ba, 0xc6ad, 0x42ec, {0x88, 0x11, 0x7e, 0xd9, 0xc7, 0x21, 0x76, 0xbb}};
 
+/// Descriptor set statistics of a Vulkan device context, see IDeviceContextVk::GetDescriptorSetStatistics().
+struct DescriptorSetStatisticsVk
+{
+    /// The number of descriptor sets for dynamic resources of committed SRBs
+    /// that were allocated from the dynamic descriptor pool.
+    Uint32 NumDynamicSetAllocations DEFAULT_INITIALIZER(0);
+
+    /// The number of dynamic descriptor set allocations that were avoided by
+    /// writing the descriptors to the command buffer with push descriptors
+    /// (see DeviceFeaturesVk::PushDescriptor).
+    Uint32 NumAvoidedDynamicSetAllocations DEFAULT_INITIALIZER(0);
+};
+typedef struct DescriptorSetStatisticsVk DescriptorSetStatisticsVk;
+
+/// Pipeline barrier statistics of a Vulkan device context, see IDeviceContextVk::GetBarrierStatistics().
+struct BarrierStatisticsVk
+{
+    /// The number of vkCmdPipelineBarrier or vkCmdPipelineBarrier2KHR commands recorded.
+    Uint32 NumPipelineBarriers DEFAULT_INITIALIZER(0);
+
+    /// The number of image layout transitions and memory barriers requested by the engine.
+    Uint32 NumRequestedBarriers DEFAULT_INITIALIZER(0);
+
+    /// The number of image layout transitions that were merged into a pending transition
+    /// of the same subresource range instead of being recorded separately
+    /// (for example, A -> B followed by B -> C is recorded as A -> C).
+    Uint32 NumMergedTransitions DEFAULT_INITIALIZER(0);
+};
+typedef struct BarrierStatisticsVk BarrierStatisticsVk;
+
+/// Command queue submission statistics of a Vulkan device context, see IDeviceContextVk::GetSubmissionStatistics().
+struct SubmissionStatisticsVk
+{
+    /// The number of command buffer submissions made to the context's command queue.
+    Uint32 NumSubmissions DEFAULT_INITIALIZER(0);
+
+    /// The number of vkQueueSubmit or vkQueueSubmit2KHR calls issued for these submissions.
+    /// Submissions made by several threads at the same time are batched into a single call,
+    /// so this number may be less than NumSubmissions.
+    Uint32 NumQueueSubmits DEFAULT_INITIALIZER(0);
+};
+typedef struct SubmissionStatisticsVk SubmissionStatisticsVk;
+
 #define DILIGENT_INTERFACE_NAME IDeviceContextVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -84,6 +127,38 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
     /// calling IDeviceContext::InvalidateState() and then manually restore all required states via
     /// appropriate Diligent API calls.
     VIRTUAL VkCommandBuffer METHOD(GetVkCommandBuffer)(THIS) PURE;
+
+    /// Returns the descriptor set statistics collected during the last finished frame
+
+    /// \param [out] Stats - Descriptor set statistics, see Diligent::DescriptorSetStatisticsVk.
+    ///
+    /// \remarks The statistics are collected between two consecutive calls to
+    ///          IDeviceContext::FinishFrame(). Before the first frame is finished,
+    ///          all counters are zero.
+    VIRTUAL void METHOD(GetDescriptorSetStatistics)(THIS_
+                                                    DescriptorSetStatisticsVk REF Stats) CONST PURE;
+
+    /// Returns the pipeline barrier statistics collected during the last finished frame
+
+    /// \param [out] Stats - Barrier statistics, see Diligent::BarrierStatisticsVk.
+    ///
+    /// \remarks The statistics are collected between two consecutive calls to
+    ///          IDeviceContext::FinishFrame(). Before the first frame is finished,
+    ///          all counters are zero.
+    VIRTUAL void METHOD(GetBarrierStatistics)(THIS_
+                                              BarrierStatisticsVk REF Stats) CONST PURE;
+
+    /// Returns the command queue submission statistics collected during the last finished frame
+
+    /// \param [out] Stats - Submission statistics, see Diligent::SubmissionStatisticsVk.
+    ///
+    /// \remarks The statistics include submissions from all threads that use the context's
+    ///          command queue, e.g. transient command buffers submitted by resource creation
+    ///          threads. They are collected between two consecutive calls to
+    ///          IDeviceContext::FinishFrame() on the immediate context. Deferred contexts
+    ///          do not collect the statistics and always report zero counters.
+    VIRTUAL void METHOD(GetSubmissionStatistics)(THIS_
+                                                 SubmissionStatisticsVk REF Stats) CONST PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -93,8 +168,11 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
-#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
+#    define IDeviceContextVk_TransitionImageLayout(This, ...)      CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout,      This, __VA_ARGS__)
+#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)        CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,        This, __VA_ARGS__)
+#    define IDeviceContextVk_GetDescriptorSetStatistics(This, ...) CALL_IFACE_METHOD(DeviceContextVk, GetDescriptorSetStatistics, This, __VA_ARGS__)
+#    define IDeviceContextVk_GetBarrierStatistics(This, ...)       CALL_IFACE_METHOD(DeviceContextVk, GetBarrierStatistics,       This, __VA_ARGS__)
+#    define IDeviceContextVk_GetSubmissionStatistics(This, ...)    CALL_IFACE_METHOD(DeviceContextVk, GetSubmissionStatistics,    This, __VA_ARGS__)
 
 // clang-format on
 
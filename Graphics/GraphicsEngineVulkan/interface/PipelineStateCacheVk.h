@@ -29,6 +29,7 @@
 /// \file
 /// Definition of the Diligent::IPipelineStateCacheVk interface
 
+#include "../../../Primitives/interface/FileStream.h"
 #include "../../GraphicsEngine/interface/PipelineStateCache.h"
 
 DILIGENT_BEGIN_NAMESPACE(Diligent)
@@ -52,6 +53,61 @@ DILIGENT_BEGIN_INTERFACE(IPipelineStateCacheVk, IPipelineStateCache)
 {
     /// Returns a Vulkan handle of the internal pipeline cache object.
     VIRTUAL VkPipelineCache METHOD(GetVkPipelineCache)(THIS) CONST PURE;
+
+    /// Writes the cache contents to the stream.
+
+    /// \param [in] pStream - Stream to write the cache data to.
+    ///
+    /// \return     true if the data was successfully written, and false otherwise.
+    ///
+    /// \remarks    The data is prefixed with a header that records the vendor ID, device ID,
+    ///             driver version and pipeline cache UUID of the physical device. The header
+    ///             is validated by LoadFromStream() and when the data is passed to
+    ///             IRenderDevice::CreatePipelineStateCache() as PipelineStateCacheCreateInfo::pCacheData.
+    VIRTUAL bool METHOD(SaveToStream)(THIS_
+                                      IFileStream* pStream) PURE;
+
+    /// Reads the cache data previously written by SaveToStream() and merges it into this cache.
+
+    /// \param [in] pStream - Stream to read the cache data from.
+    ///
+    /// \return     true if the data was successfully merged, and false otherwise.
+    ///
+    /// \remarks    If the header does not match the current physical device or driver,
+    ///             or the data is corrupted, the stream contents are ignored and the
+    ///             cache is left unchanged.
+    ///
+    ///             The method may be called while other threads create pipeline states with this cache:
+    ///             it waits until pipeline creation that uses the cache is complete (including optimized
+    ///             pipelines that are linked in the background) and blocks new pipeline creation until
+    ///             the data is merged.
+    VIRTUAL bool METHOD(LoadFromStream)(THIS_
+                                        IFileStream* pStream) PURE;
+
+    /// Merges the contents of the source caches into this cache.
+
+    /// \param [in] NumSrcCaches - The number of elements in ppSrcCaches array.
+    /// \param [in] ppSrcCaches  - An array of source caches. The caches must have been created by the same
+    ///                            render device. Caches that were created by another device are skipped.
+    ///
+    /// \return     true if all compatible caches were successfully merged, and false otherwise.
+    ///
+    /// \remarks    This method is intended to combine per-thread caches used during parallel
+    ///             pipeline state creation into a single cache that can be saved to disk.
+    ///
+    ///             vkMergePipelineCaches requires exclusive access to the destination cache.
+    ///             The method waits until pipeline creation that uses this cache is complete
+    ///             (including optimized pipelines that are linked in the background) and blocks
+    ///             new pipeline creation with this cache until the merge is complete.
+    ///             Source caches are only locked for shared access and may be used concurrently
+    ///             for pipeline creation. Caches may be merged into each other by several threads
+    ///             at once.
+    ///
+    ///             Vulkan commands that the application issues directly with the handle returned
+    ///             by GetVkPipelineCache() are not synchronized with this method.
+    VIRTUAL bool METHOD(Merge)(THIS_
+                               Uint32                      NumSrcCaches,
+                               IPipelineStateCache* const* ppSrcCaches) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -59,7 +115,14 @@ DILIGENT_END_INTERFACE
 
 #if DILIGENT_C_INTERFACE
 
-#    define IPipelineStateCacheVk_GetVkPipelineCache(This)  CALL_IFACE_METHOD(PipelineStateCacheVk, GetVkPipelineCache, This)
+// clang-format off
+
+#    define IPipelineStateCacheVk_GetVkPipelineCache(This)   CALL_IFACE_METHOD(PipelineStateCacheVk, GetVkPipelineCache, This)
+#    define IPipelineStateCacheVk_SaveToStream(This, ...)    CALL_IFACE_METHOD(PipelineStateCacheVk, SaveToStream,       This, __VA_ARGS__)
+#    define IPipelineStateCacheVk_LoadFromStream(This, ...)  CALL_IFACE_METHOD(PipelineStateCacheVk, LoadFromStream,     This, __VA_ARGS__)
+#    define IPipelineStateCacheVk_Merge(This, ...)           CALL_IFACE_METHOD(PipelineStateCacheVk, Merge,              This, __VA_ARGS__)
+
+// clang-format on
 
 #endif
 
@@ -38,6 +38,85 @@ DILIGENT_BEGIN_NAMESPACE(Diligent)
 static DILIGENT_CONSTEXPR INTERFACE_ID IID_RenderDeviceVk =
     {0xab8cf3a6, 0xd959, 0x41c1, {0xae, 0x0, 0xa5, 0x8a, 0xe9, 0x82, 0xe, 0x6a}};
 
+/// Usage statistics of a dynamic heap chunk, see IRenderDeviceVk::GetDynamicHeapChunkStats().
+struct DynamicHeapChunkStatsVk
+{
+    /// Chunk index. Index 0 is the primary chunk whose size is given by EngineVkCreateInfo::DynamicHeapSize,
+    /// other chunks are overflow chunks allocated when the primary chunk is exhausted.
+    Uint32 Index DEFAULT_INITIALIZER(0);
+
+    /// Whether the chunk currently owns a Vulkan buffer.
+    /// Overflow chunks release their buffers after they have not been used for several frames.
+    Bool IsResident DEFAULT_INITIALIZER(False);
+
+    /// Chunk size, in bytes.
+    Uint64 Size DEFAULT_INITIALIZER(0);
+
+    /// The amount of memory currently allocated from the chunk, in bytes.
+    /// Pages that device contexts have reserved but not yet used are not counted.
+    Uint64 UsedSize DEFAULT_INITIALIZER(0);
+
+    /// The peak amount of memory allocated from the chunk, in bytes.
+    Uint64 PeakUsedSize DEFAULT_INITIALIZER(0);
+};
+typedef struct DynamicHeapChunkStatsVk DynamicHeapChunkStatsVk;
+
+/// Maximum number of memory heaps, equal to VK_MAX_MEMORY_HEAPS.
+#define DILIGENT_MAX_MEMORY_HEAPS_VK 16
+
+static DILIGENT_CONSTEXPR Uint32 MAX_MEMORY_HEAPS_VK = DILIGENT_MAX_MEMORY_HEAPS_VK;
+
+/// Budget of a Vulkan memory heap
+struct MemoryHeapBudgetVk
+{
+    /// Heap size, in bytes.
+    Uint64 Size DEFAULT_INITIALIZER(0);
+
+    /// Estimated amount of memory, in bytes, that the process can use from the heap
+    /// before allocations may fail or cause performance degradation.
+
+    /// If VK_EXT_memory_budget extension is not supported, the budget is estimated
+    /// as 80% of the heap size.
+    Uint64 Budget DEFAULT_INITIALIZER(0);
+
+    /// Estimated amount of memory, in bytes, that is currently used by the process in this heap.
+
+    /// If VK_EXT_memory_budget extension is not supported, this is the memory
+    /// allocated by the engine's memory manager.
+    Uint64 Usage DEFAULT_INITIALIZER(0);
+
+    /// Amount of memory, in bytes, allocated from this heap by the engine's memory manager.
+    Uint64 EngineAllocated DEFAULT_INITIALIZER(0);
+
+    /// Vulkan memory heap flags, see VkMemoryHeapFlags.
+    Uint32 Flags DEFAULT_INITIALIZER(0);
+};
+typedef struct MemoryHeapBudgetVk MemoryHeapBudgetVk;
+
+/// Budget of all Vulkan memory heaps
+struct MemoryBudgetVk
+{
+    /// The number of valid elements in the Heaps array.
+    Uint32 NumHeaps DEFAULT_INITIALIZER(0);
+
+    /// Indicates whether the budget and usage are reported by the driver
+    /// through VK_EXT_memory_budget extension.
+    Bool DriverReported DEFAULT_INITIALIZER(False);
+
+    /// Memory heap budgets.
+    MemoryHeapBudgetVk Heaps[DILIGENT_MAX_MEMORY_HEAPS_VK] DEFAULT_INITIALIZER({});
+};
+typedef struct MemoryBudgetVk MemoryBudgetVk;
+
+/// Memory budget callback function type, see IRenderDeviceVk::SetMemoryBudgetCallback().
+
+/// \param [in] HeapIndex  - Index of the memory heap whose usage has reached the threshold.
+/// \param [in] pBudget    - Pointer to the current budget of the heap.
+/// \param [in] pUserData  - User data pointer that was passed to SetMemoryBudgetCallback().
+typedef void(DILIGENT_CALL_TYPE* MemoryBudgetCallbackVkType)(Uint32                    HeapIndex,
+                                                              const MemoryHeapBudgetVk* pBudget,
+                                                              void*                     pUserData);
+
 #define DILIGENT_INTERFACE_NAME IRenderDeviceVk
 #include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
 
@@ -169,6 +248,44 @@ DILIGENT_BEGIN_INTERFACE(IRenderDeviceVk, IRenderDevice)
 
     /// Returns DX compiler interface, or null if the compiler is not loaded.
     VIRTUAL struct IDXCompiler* METHOD(GetDXCompiler)(THIS) CONST PURE;
+
+    /// Returns usage statistics of the dynamic heap chunks shared by all device contexts.
+
+    /// \param [in, out] NumChunks - If pStats is null, receives the number of dynamic heap chunks.
+    ///                              Otherwise, specifies the number of elements in the pStats array
+    ///                              and receives the number of elements written.
+    /// \param [out]     pStats    - Pointer to the array that receives the statistics of the primary chunk
+    ///                              followed by all overflow chunks, see Diligent::DynamicHeapChunkStatsVk.
+    VIRTUAL void METHOD(GetDynamicHeapChunkStats)(THIS_
+                                                  Uint32 REF               NumChunks,
+                                                  DynamicHeapChunkStatsVk* pStats) CONST PURE;
+
+    /// Returns the current budget and usage of every memory heap.
+
+    /// \param [out] Budget - Memory budget, see Diligent::MemoryBudgetVk.
+    ///
+    /// \note  The method queries the budget from the driver, so the application
+    ///        should not call it more often than once per frame.
+    VIRTUAL void METHOD(GetMemoryBudget)(THIS_
+                                         MemoryBudgetVk REF Budget) PURE;
+
+    /// Sets the callback that is invoked when a memory heap approaches its budget.
+
+    /// \param [in] Callback  - Callback function. Pass null to remove the callback.
+    /// \param [in] pUserData - User data pointer that is passed to the callback.
+    /// \param [in] Threshold - Fraction of the heap budget, in (0, 1], at which the callback is invoked.
+    ///
+    /// \remarks  Heap budgets are updated by IRenderDevice::ReleaseStaleResources(), which is
+    ///           also called by the swap chain when the frame is presented. The callback is invoked
+    ///           from that method once the heap usage reaches the threshold, and is not invoked again
+    ///           for the same heap until its usage drops below the threshold.
+    ///           Streaming systems can use the callback to evict resources.
+    ///
+    /// \note  The callback must not call SetMemoryBudgetCallback().
+    VIRTUAL void METHOD(SetMemoryBudgetCallback)(THIS_
+                                                 MemoryBudgetCallbackVkType Callback,
+                                                 void*                      pUserData,
+                                                 float                      Threshold) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -188,6 +305,9 @@ DILIGENT_END_INTERFACE
 #    define IRenderDeviceVk_CreateFenceFromVulkanResource(This, ...)  CALL_IFACE_METHOD(RenderDeviceVk, CreateFenceFromVulkanResource,  This, __VA_ARGS__)
 #    define IRenderDeviceVk_GetDeviceFeaturesVk(This, ...)            CALL_IFACE_METHOD(RenderDeviceVk, GetDeviceFeaturesVk,            This, __VA_ARGS__)
 #    define IRenderDeviceVk_GetDXCompiler(This)                       CALL_IFACE_METHOD(RenderDeviceVk, GetDXCompiler,                  This)
+#    define IRenderDeviceVk_GetDynamicHeapChunkStats(This, ...)       CALL_IFACE_METHOD(RenderDeviceVk, GetDynamicHeapChunkStats,       This, __VA_ARGS__)
+#    define IRenderDeviceVk_GetMemoryBudget(This, ...)                CALL_IFACE_METHOD(RenderDeviceVk, GetMemoryBudget,                This, __VA_ARGS__)
+#    define IRenderDeviceVk_SetMemoryBudgetCallback(This, ...)        CALL_IFACE_METHOD(RenderDeviceVk, SetMemoryBudgetCallback,        This, __VA_ARGS__)
 
 // clang-format on
 
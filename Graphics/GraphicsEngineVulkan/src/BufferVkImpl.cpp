@@ -180,6 +180,19 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
         ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
 
+    if (pRenderDeviceVk->UseDescriptorBuffers() && m_Desc.Usage != USAGE_SPARSE && (m_Desc.Usage != USAGE_DYNAMIC || RequiresBackingBuffer))
+    {
+        // Descriptors in descriptor buffers reference buffers by their device addresses.
+        // Dynamic buffers without backing buffers use the address of the dynamic heap.
+        constexpr VkBufferUsageFlags DescriptorUsage =
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+            VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+        if ((VkBuffCI.usage & DescriptorUsage) != 0)
+            VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -319,6 +332,12 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
 
         VERIFY(!AlignToNonCoherentAtomSize || (m_BufferMemoryAlignedOffset + MemReqs.size) % DeviceLimits.nonCoherentAtomSize == 0, "End offset is not properly aligned");
 
+        if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+        {
+            m_VkDeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VulkanBuffer);
+            VERIFY_EXPR(m_VkDeviceAddress != 0);
+        }
+
 #ifdef DILIGENT_DEBUG
         if ((m_Desc.BindFlags & BIND_RAY_TRACING) != 0)
         {
@@ -563,7 +582,17 @@ VkDeviceAddress BufferVkImpl::GetVkDeviceAddress() const
 {
     constexpr BIND_FLAGS DeviceAddressFlags = BIND_RAY_TRACING;
 
-    if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
+    if (m_VkDeviceAddress != 0)
+    {
+        return m_VkDeviceAddress;
+    }
+    else if (m_VulkanBuffer == VK_NULL_HANDLE && m_Desc.Usage == USAGE_DYNAMIC && m_pDevice->UseDescriptorBuffers())
+    {
+        // Dynamic buffer suballocated from the dynamic heap, see GetVkBuffer().
+        // The offset is context-specific and is returned by DeviceContextVkImpl::GetDynamicBufferOffset().
+        return m_pDevice->GetDynamicMemoryManager().GetDeviceAddress();
+    }
+    else if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
     {
 #if DILIGENT_USE_VOLK
         VkBufferDeviceAddressInfoKHR BufferInfo = {};
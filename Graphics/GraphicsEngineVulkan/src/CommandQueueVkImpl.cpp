@@ -35,6 +35,51 @@
 namespace Diligent
 {
 
+namespace
+{
+
+const VkTimelineSemaphoreSubmitInfo* FindTimelineSemaphoreSubmitInfo(const VkSubmitInfo& SubmitInfo)
+{
+    for (const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(SubmitInfo.pNext); pStruct != nullptr; pStruct = pStruct->pNext)
+    {
+        if (pStruct->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+            return reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(pStruct);
+    }
+    return nullptr;
+}
+
+bool IsEmptySubmitInfo(const VkSubmitInfo& SubmitInfo)
+{
+    return SubmitInfo.waitSemaphoreCount == 0 && SubmitInfo.commandBufferCount == 0 && SubmitInfo.signalSemaphoreCount == 0;
+}
+
+#if DILIGENT_USE_VOLK
+// Submit info can be converted to VkSubmitInfo2 if timeline semaphore submit info
+// is the only structure in its pNext chain.
+bool IsConvertibleToSubmitInfo2(const VkSubmitInfo& SubmitInfo)
+{
+    for (const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(SubmitInfo.pNext); pStruct != nullptr; pStruct = pStruct->pNext)
+    {
+        if (pStruct->sType != VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+            return false;
+    }
+    return true;
+}
+
+VkSemaphoreSubmitInfoKHR GetSemaphoreSubmitInfo(VkSemaphore Semaphore, Uint64 Value, VkPipelineStageFlags2KHR StageMask)
+{
+    VkSemaphoreSubmitInfoKHR SemaphoreInfo{};
+    SemaphoreInfo.sType       = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO_KHR;
+    SemaphoreInfo.semaphore   = Semaphore;
+    SemaphoreInfo.value       = Value;
+    SemaphoreInfo.stageMask   = StageMask;
+    SemaphoreInfo.deviceIndex = 0;
+    return SemaphoreInfo;
+}
+#endif
+
+} // namespace
+
 CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*                             pRefCounters,
                                        std::shared_ptr<VulkanUtilities::LogicalDevice> LogicalDevice,
                                        SoftwareQueueIndex                              CommandQueueId,
@@ -48,6 +93,7 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
     m_QueueFamilyIndex          {CreateInfo.QueueId},
     m_CommandQueueId            {static_cast<Uint8>(CommandQueueId)},
     m_SupportedTimelineSemaphore{LogicalDevice->GetEnabledExtFeatures().TimelineSemaphore.timelineSemaphore == VK_TRUE},
+    m_UseSynchronization2       {LogicalDevice->GetEnabledExtFeatures().Synchronization2.synchronization2 != VK_FALSE},
     m_NumCommandQueues          {static_cast<Uint8>(m_SupportedTimelineSemaphore ? 1u : NumCommandQueues)},
     m_NextFenceValue            {1},
     m_SyncObjectManager         {std::make_shared<VulkanUtilities::SyncObjectManager>(*LogicalDevice)},
@@ -61,6 +107,8 @@ CommandQueueVkImpl::CommandQueueVkImpl(IReferenceCounters*
         VulkanUtilities::SetQueueName(m_LogicalDevice->GetVkDevice(), m_VkQueue, CreateInfo.Name);
 
     m_TempSignalSemaphores.reserve(16);
+    m_PendingSubmissions.reserve(16);
+    m_SubmitBatch.reserve(16);
 }
 
 CommandQueueVkImpl::~CommandQueueVkImpl()
@@ -147,61 +195,201 @@ __forceinline SyncPointVkPtr CommandQueueVkImpl::CreateSyncPoint(Uint64 dbgValue
     return {new (ptr) SyncPointVk{m_CommandQueueId, m_NumCommandQueues, *m_SyncObjectManager, m_LogicalDevice->GetVkDevice(), dbgValue}, std::move(Deleter)};
 }
 
-Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
+void CommandQueueVkImpl::EnqueueSubmission(PendingSubmission& Submission)
+{
+    VERIFY_EXPR(!Submission.Submitted);
+    std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+    m_PendingSubmissions.push_back(&Submission);
+}
+
+Uint64 CommandQueueVkImpl::WaitSubmission(PendingSubmission& Submission)
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
 
-    // Increment the value before submitting the buffer to be overly safe
-    const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
+    // The submission may have been submitted by another thread while we were waiting for the lock
+    if (!Submission.Submitted)
+        FlushPendingSubmissions();
 
-    SyncPointVkPtr NewSyncPoint = CreateSyncPoint(FenceValue);
+    VERIFY_EXPR(Submission.Submitted);
+    return Submission.FenceValue;
+}
 
-    m_TempSignalSemaphores.clear();
-    NewSyncPoint->GetSemaphores(m_TempSignalSemaphores);
+Uint64 CommandQueueVkImpl::Submit(const VkSubmitInfo& InSubmitInfo)
+{
+    PendingSubmission Submission{InSubmitInfo};
+    EnqueueSubmission(Submission);
+    return WaitSubmission(Submission);
+}
 
-#ifdef DILIGENT_DEBUG
-    const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(InSubmitInfo.pNext);
-    for (; pStruct != nullptr;)
+void CommandQueueVkImpl::FlushPendingSubmissions()
+{
+    m_SubmitBatch.clear();
     {
-        if (pStruct->sType == VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
-        {
-            VERIFY(m_TempSignalSemaphores.empty(), "Can not append semaphores when timeline semaphores are used");
-            break;
-        }
-        pStruct = pStruct->pNext;
+        std::lock_guard<std::mutex> Lock{m_PendingSubmissionsMtx};
+        if (m_PendingSubmissions.empty())
+            return;
+        m_SubmitBatch.swap(m_PendingSubmissions);
     }
-#endif
 
-    for (uint32_t s = 0; s < InSubmitInfo.signalSemaphoreCount; ++s)
-        m_TempSignalSemaphores.push_back(InSubmitInfo.pSignalSemaphores[s]);
+    // Fence values are assigned in the order the submissions were enqueued.
+    // Increment the values before submitting the buffers to be overly safe.
+    for (PendingSubmission* pSubmission : m_SubmitBatch)
+        pSubmission->FenceValue = m_NextFenceValue.fetch_add(1);
+    const Uint64 LastFenceValue = m_SubmitBatch.back()->FenceValue;
 
-    VkSubmitInfo SubmitInfo         = InSubmitInfo;
-    SubmitInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
-    SubmitInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
+    // All submissions in the batch share the sync point that is signaled when the batch is complete
+    SyncPointVkPtr NewSyncPoint = CreateSyncPoint(LastFenceValue);
 
-    const uint32_t SubmitCount =
-        (SubmitInfo.waitSemaphoreCount != 0 ||
-         SubmitInfo.commandBufferCount != 0 ||
-         SubmitInfo.signalSemaphoreCount != 0) ?
-        1 :
-        0;
+    m_TempSignalSemaphores.clear();
+    NewSyncPoint->GetSemaphores(m_TempSignalSemaphores);
 
-    VkResult err = vkQueueSubmit(m_VkQueue, SubmitCount, &SubmitInfo, NewSyncPoint->GetFence());
-    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffer to the command queue");
+#if DILIGENT_USE_VOLK
+    const bool UseSubmit2 = m_UseSynchronization2 &&
+        std::all_of(m_SubmitBatch.begin(), m_SubmitBatch.end(), [](const PendingSubmission* pSubmission) {
+            return IsConvertibleToSubmitInfo2(pSubmission->SubmitInfo);
+        });
+    VkResult err = UseSubmit2 ? SubmitBatch2(NewSyncPoint->GetFence()) : SubmitBatch(NewSyncPoint->GetFence());
+#else
+    VkResult err = SubmitBatch(NewSyncPoint->GetFence());
+#endif
+    DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit command buffers to the command queue");
     (void)err;
 
+    // The fence is only signaled when the whole batch is complete, so the last fence value is
+    // sufficient to track completion of all submissions in the batch.
     VERIFY(m_pFence != nullptr, "Command queue fence has not been initialized");
-    m_pFence->AddPendingSyncPoint(m_CommandQueueId, FenceValue, NewSyncPoint);
+    m_pFence->AddPendingSyncPoint(m_CommandQueueId, LastFenceValue, NewSyncPoint);
+
+    for (PendingSubmission* pSubmission : m_SubmitBatch)
+        pSubmission->Submitted = true;
+
+    m_NumSubmissions.fetch_add(static_cast<Uint32>(m_SubmitBatch.size()));
+    m_NumQueueSubmits.fetch_add(1);
 
     // Update the last sync point
     {
         Threading::SpinLockGuard SyncPointGuard{m_LastSyncPointLock};
         m_LastSyncPoint = std::move(NewSyncPoint);
     }
+}
 
-    return FenceValue;
+VkResult CommandQueueVkImpl::SubmitBatch(VkFence vkFence)
+{
+    m_SubmitInfos.clear();
+    for (const PendingSubmission* pSubmission : m_SubmitBatch)
+    {
+        if (!IsEmptySubmitInfo(pSubmission->SubmitInfo))
+            m_SubmitInfos.push_back(pSubmission->SubmitInfo);
+    }
+
+    if (!m_TempSignalSemaphores.empty())
+    {
+        // Signal operations of the last submit info are executed after all previous command buffers
+        // in the queue have completed, so the sync point semaphores are added to this submit info.
+        if (m_SubmitInfos.empty())
+        {
+            VkSubmitInfo SignalInfo{};
+            SignalInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            m_SubmitInfos.push_back(SignalInfo);
+        }
+
+        VkSubmitInfo& LastInfo = m_SubmitInfos.back();
+        VERIFY(FindTimelineSemaphoreSubmitInfo(LastInfo) == nullptr, "Can not append semaphores when timeline semaphores are used");
+
+        for (uint32_t s = 0; s < LastInfo.signalSemaphoreCount; ++s)
+            m_TempSignalSemaphores.push_back(LastInfo.pSignalSemaphores[s]);
+
+        LastInfo.signalSemaphoreCount = static_cast<Uint32>(m_TempSignalSemaphores.size());
+        LastInfo.pSignalSemaphores    = m_TempSignalSemaphores.data();
+    }
+
+    return vkQueueSubmit(m_VkQueue, static_cast<uint32_t>(m_SubmitInfos.size()), m_SubmitInfos.data(), vkFence);
 }
 
+#if DILIGENT_USE_VOLK
+VkResult CommandQueueVkImpl::SubmitBatch2(VkFence vkFence)
+{
+    size_t NumSemaphores = m_TempSignalSemaphores.size();
+    size_t NumCmdBuffers = 0;
+    for (const PendingSubmission* pSubmission : m_SubmitBatch)
+    {
+        NumSemaphores += size_t{pSubmission->SubmitInfo.waitSemaphoreCount} + size_t{pSubmission->SubmitInfo.signalSemaphoreCount};
+        NumCmdBuffers += pSubmission->SubmitInfo.commandBufferCount;
+    }
+
+    // Reserve the arrays so that pointers to their elements remain valid while the arrays are filled
+    m_SubmitInfos2.clear();
+    m_SemaphoreInfos.clear();
+    m_CmdBufferInfos.clear();
+    m_SubmitInfos2.reserve(m_SubmitBatch.size() + 1);
+    m_SemaphoreInfos.reserve(NumSemaphores);
+    m_CmdBufferInfos.reserve(NumCmdBuffers);
+
+    for (const PendingSubmission* pSubmission : m_SubmitBatch)
+    {
+        const VkSubmitInfo& SubmitInfo = pSubmission->SubmitInfo;
+        if (IsEmptySubmitInfo(SubmitInfo))
+            continue;
+
+        const VkTimelineSemaphoreSubmitInfo* pTimelineInfo = FindTimelineSemaphoreSubmitInfo(SubmitInfo);
+
+        VkSubmitInfo2KHR SubmitInfo2{};
+        SubmitInfo2.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+
+        SubmitInfo2.waitSemaphoreInfoCount = SubmitInfo.waitSemaphoreCount;
+        SubmitInfo2.pWaitSemaphoreInfos    = m_SemaphoreInfos.data() + m_SemaphoreInfos.size();
+        for (uint32_t s = 0; s < SubmitInfo.waitSemaphoreCount; ++s)
+        {
+            const Uint64 Value = (pTimelineInfo != nullptr && s < pTimelineInfo->waitSemaphoreValueCount) ? pTimelineInfo->pWaitSemaphoreValues[s] : 0;
+            m_SemaphoreInfos.push_back(GetSemaphoreSubmitInfo(SubmitInfo.pWaitSemaphores[s], Value, SubmitInfo.pWaitDstStageMask[s]));
+        }
+
+        SubmitInfo2.commandBufferInfoCount = SubmitInfo.commandBufferCount;
+        SubmitInfo2.pCommandBufferInfos    = m_CmdBufferInfos.data() + m_CmdBufferInfos.size();
+        for (uint32_t c = 0; c < SubmitInfo.commandBufferCount; ++c)
+        {
+            VkCommandBufferSubmitInfoKHR CmdBufferInfo{};
+            CmdBufferInfo.sType         = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO_KHR;
+            CmdBufferInfo.commandBuffer = SubmitInfo.pCommandBuffers[c];
+            CmdBufferInfo.deviceMask    = 0;
+            m_CmdBufferInfos.push_back(CmdBufferInfo);
+        }
+
+        SubmitInfo2.signalSemaphoreInfoCount = SubmitInfo.signalSemaphoreCount;
+        SubmitInfo2.pSignalSemaphoreInfos    = m_SemaphoreInfos.data() + m_SemaphoreInfos.size();
+        for (uint32_t s = 0; s < SubmitInfo.signalSemaphoreCount; ++s)
+        {
+            const Uint64 Value = (pTimelineInfo != nullptr && s < pTimelineInfo->signalSemaphoreValueCount) ? pTimelineInfo->pSignalSemaphoreValues[s] : 0;
+            m_SemaphoreInfos.push_back(GetSemaphoreSubmitInfo(SubmitInfo.pSignalSemaphores[s], Value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR));
+        }
+
+        m_SubmitInfos2.push_back(SubmitInfo2);
+    }
+
+    if (!m_TempSignalSemaphores.empty())
+    {
+        if (m_SubmitInfos2.empty())
+        {
+            VkSubmitInfo2KHR SignalInfo{};
+            SignalInfo.sType                 = VK_STRUCTURE_TYPE_SUBMIT_INFO_2_KHR;
+            SignalInfo.pSignalSemaphoreInfos = m_SemaphoreInfos.data() + m_SemaphoreInfos.size();
+            m_SubmitInfos2.push_back(SignalInfo);
+        }
+
+        // Signal semaphore infos of the last submit info are at the end of m_SemaphoreInfos,
+        // so the sync point semaphores can be appended to them.
+        VkSubmitInfo2KHR& LastInfo = m_SubmitInfos2.back();
+        VERIFY_EXPR(LastInfo.pSignalSemaphoreInfos + LastInfo.signalSemaphoreInfoCount == m_SemaphoreInfos.data() + m_SemaphoreInfos.size());
+        for (VkSemaphore vkSemaphore : m_TempSignalSemaphores)
+            m_SemaphoreInfos.push_back(GetSemaphoreSubmitInfo(vkSemaphore, 0, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR));
+        LastInfo.signalSemaphoreInfoCount += static_cast<uint32_t>(m_TempSignalSemaphores.size());
+    }
+    VERIFY_EXPR(m_SemaphoreInfos.size() <= NumSemaphores && m_CmdBufferInfos.size() <= NumCmdBuffers);
+
+    return vkQueueSubmit2KHR(m_VkQueue, static_cast<uint32_t>(m_SubmitInfos2.size()), m_SubmitInfos2.data(), vkFence);
+}
+#endif
+
 Uint64 CommandQueueVkImpl::SubmitCmdBuffer(VkCommandBuffer cmdBuffer)
 {
     VkSubmitInfo SubmitInfo{};
@@ -225,6 +413,9 @@ Uint64 CommandQueueVkImpl::WaitForIdle()
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
 
+    // Pending submissions must be assigned fence values before the queue is idled
+    FlushPendingSubmissions();
+
     // Update last completed fence value to unlock all waiting events.
     const Uint64 FenceValue = m_NextFenceValue.fetch_add(1);
 
@@ -246,6 +437,7 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
     DEV_CHECK_ERR(vkFence != VK_NULL_HANDLE, "vkFence must not be null");
 
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    FlushPendingSubmissions();
 
     VkResult err = vkQueueSubmit(m_VkQueue, 0, nullptr, vkFence);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to submit fence signal command to the command queue");
@@ -255,6 +447,7 @@ void CommandQueueVkImpl::EnqueueSignalFence(VkFence vkFence)
 void CommandQueueVkImpl::EnqueueSignal(VkSemaphore vkTimelineSemaphore, Uint64 Value)
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    FlushPendingSubmissions();
     InternalSignalSemaphore(vkTimelineSemaphore, Value);
 }
 
@@ -287,6 +480,7 @@ void CommandQueueVkImpl::InternalSignalSemaphore(VkSemaphore vkTimelineSemaphore
 VkResult CommandQueueVkImpl::Present(const VkPresentInfoKHR& PresentInfo)
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
+    FlushPendingSubmissions();
     return vkQueuePresentKHR(m_VkQueue, &PresentInfo);
 }
 
@@ -294,6 +488,9 @@ Uint64 CommandQueueVkImpl::BindSparse(const VkBindSparseInfo& InBindInfo)
 {
     std::lock_guard<std::mutex> QueueGuard{m_QueueMutex};
 
+    // Sparse binding must be ordered after all previously enqueued submissions
+    FlushPendingSubmissions();
+
     // Increment the value before submitting the buffer to be overly safe
     const uint64_t FenceValue = m_NextFenceValue.fetch_add(1);
 
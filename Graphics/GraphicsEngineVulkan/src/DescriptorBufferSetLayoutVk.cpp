@@ -0,0 +1,209 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "DescriptorBufferSetLayoutVk.hpp"
+
+#include <cstring>
+
+namespace Diligent
+{
+
+static Uint32 GetDescriptorSize(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props,
+                                VkDescriptorType                                     vkType,
+                                bool                                                 RobustBufferAccess)
+{
+    switch (vkType)
+    {
+        // clang-format off
+        case VK_DESCRIPTOR_TYPE_SAMPLER:                    return static_cast<Uint32>(Props.samplerDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     return static_cast<Uint32>(Props.combinedImageSamplerDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              return static_cast<Uint32>(Props.sampledImageDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:              return static_cast<Uint32>(Props.storageImageDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       return static_cast<Uint32>(RobustBufferAccess ? Props.robustUniformTexelBufferDescriptorSize : Props.uniformTexelBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       return static_cast<Uint32>(RobustBufferAccess ? Props.robustStorageTexelBufferDescriptorSize : Props.storageTexelBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             return static_cast<Uint32>(RobustBufferAccess ? Props.robustUniformBufferDescriptorSize : Props.uniformBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:             return static_cast<Uint32>(RobustBufferAccess ? Props.robustStorageBufferDescriptorSize : Props.storageBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           return static_cast<Uint32>(Props.inputAttachmentDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: return static_cast<Uint32>(Props.accelerationStructureDescriptorSize);
+        // clang-format on
+        default:
+            UNEXPECTED("Descriptor type ", vkType, " is not supported in descriptor buffers");
+            return 0;
+    }
+}
+
+void DescriptorBufferSetLayoutVk::Initialize(const VulkanUtilities::LogicalDevice&               LogicalDevice,
+                                             const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props,
+                                             VkDescriptorSetLayout                                vkLayout,
+                                             const std::vector<BindingInfo>&                      Bindings,
+                                             Uint32                                               NumCacheResources)
+{
+    VERIFY(!IsInitialized(), "The layout has already been initialized");
+    VERIFY_EXPR(vkLayout != VK_NULL_HANDLE);
+
+    const bool RobustBufferAccess = LogicalDevice.GetEnabledFeatures().robustBufferAccess != VK_FALSE;
+
+    m_DataSize = StaticCast<Uint32>(LogicalDevice.GetDescriptorSetLayoutSize(vkLayout));
+    m_Descriptors.resize(NumCacheResources);
+
+    bool HasImmutableSamplers = false;
+    for (const BindingInfo& Binding : Bindings)
+    {
+        const Uint32 BindingOffset  = StaticCast<Uint32>(LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkLayout, Binding.BindingIndex));
+        const Uint32 DescriptorSize = GetDescriptorSize(Props, Binding.vkType, RobustBufferAccess);
+        VERIFY(DescriptorSize <= MaxDescriptorSize, "Descriptor size (", DescriptorSize, ") exceeds the maximum supported size (", MaxDescriptorSize, ")");
+
+        // Arrays of combined image samplers may need to be stored as an array of images followed by an array of samplers.
+        const bool SplitCombinedSampler =
+            Binding.vkType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER &&
+            Binding.ArraySize > 1 &&
+            Props.combinedImageSamplerDescriptorSingleArray == VK_FALSE;
+
+        if (Binding.pImmutableSamplers != nullptr && Binding.vkType == VK_DESCRIPTOR_TYPE_SAMPLER)
+            HasImmutableSamplers = true;
+
+        if (Binding.CacheOffset == ~0u)
+        {
+            // Separate immutable sampler that does not have a resource in the cache
+            VERIFY(Binding.vkType == VK_DESCRIPTOR_TYPE_SAMPLER && Binding.pImmutableSamplers != nullptr,
+                   "Only immutable samplers may have no resources in the cache");
+            continue;
+        }
+
+        for (Uint32 elem = 0; elem < Binding.ArraySize; ++elem)
+        {
+            VERIFY_EXPR(Binding.CacheOffset + elem < NumCacheResources);
+            DescriptorInfo& Descr = m_Descriptors[Binding.CacheOffset + elem];
+
+            Descr.Size = static_cast<Uint16>(DescriptorSize);
+            if (SplitCombinedSampler)
+            {
+                const Uint32 ImageSize = static_cast<Uint32>(Props.sampledImageDescriptorSize);
+                VERIFY_EXPR(ImageSize < DescriptorSize);
+                Descr.Offset        = BindingOffset + elem * ImageSize;
+                Descr.ImageSize     = static_cast<Uint16>(ImageSize);
+                Descr.SamplerOffset = BindingOffset + Binding.ArraySize * ImageSize + elem * (DescriptorSize - ImageSize);
+            }
+            else
+            {
+                Descr.Offset = BindingOffset + elem * DescriptorSize;
+            }
+
+            if (Binding.pImmutableSamplers != nullptr && Binding.vkType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+                Descr.ImmutableSampler = Binding.pImmutableSamplers[elem];
+
+            VERIFY(Descr.Offset + (SplitCombinedSampler ? Descr.ImageSize : Descr.Size) <= m_DataSize &&
+                       Descr.SamplerOffset + (SplitCombinedSampler ? (Descr.Size - Descr.ImageSize) : 0u) <= m_DataSize,
+                   "Descriptor is out of the set data bounds");
+        }
+    }
+
+    if (HasImmutableSamplers)
+    {
+        // Immutable samplers are not written to the set data by the implementation, so we
+        // write them once here and copy the data to every new set.
+        m_InitialData.resize(m_DataSize);
+        for (const BindingInfo& Binding : Bindings)
+        {
+            if (Binding.pImmutableSamplers == nullptr || Binding.vkType != VK_DESCRIPTOR_TYPE_SAMPLER)
+                continue;
+
+            const Uint32 BindingOffset  = StaticCast<Uint32>(LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkLayout, Binding.BindingIndex));
+            const Uint32 DescriptorSize = static_cast<Uint32>(Props.samplerDescriptorSize);
+            for (Uint32 elem = 0; elem < Binding.ArraySize; ++elem)
+            {
+                VkDescriptorGetInfoEXT GetInfo{};
+                GetInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+                GetInfo.type          = VK_DESCRIPTOR_TYPE_SAMPLER;
+                GetInfo.data.pSampler = &Binding.pImmutableSamplers[elem];
+                LogicalDevice.GetDescriptor(GetInfo, DescriptorSize, &m_InitialData[size_t{BindingOffset} + elem * DescriptorSize]);
+            }
+        }
+    }
+}
+
+void DescriptorBufferSetLayoutVk::InitializeData(void* pSetData) const
+{
+    VERIFY_EXPR(pSetData != nullptr);
+    if (!m_InitialData.empty())
+    {
+        VERIFY_EXPR(m_InitialData.size() == m_DataSize);
+        memcpy(pSetData, m_InitialData.data(), m_DataSize);
+    }
+    else
+    {
+        memset(pSetData, 0, m_DataSize);
+    }
+}
+
+void DescriptorBufferSetLayoutVk::GetDescriptor(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                                const DescriptorInfo&                 Descr,
+                                                const VkDescriptorGetInfoEXT&         GetInfo,
+                                                Uint8*                                pSetData)
+{
+    if (Descr.ImageSize == 0)
+    {
+        LogicalDevice.GetDescriptor(GetInfo, Descr.Size, pSetData + Descr.Offset);
+    }
+    else
+    {
+        Uint8 Data[MaxDescriptorSize];
+        LogicalDevice.GetDescriptor(GetInfo, Descr.Size, Data);
+        memcpy(pSetData + Descr.Offset, Data, Descr.ImageSize);
+        memcpy(pSetData + Descr.SamplerOffset, Data + Descr.ImageSize, Descr.Size - Descr.ImageSize);
+    }
+}
+
+void DescriptorBufferSetLayoutVk::WriteDescriptor(const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                                  Uint32                                CacheOffset,
+                                                  const VkDescriptorGetInfoEXT&         GetInfo,
+                                                  Uint8*                                pSetData) const
+{
+    VERIFY_EXPR(CacheOffset < m_Descriptors.size() && pSetData != nullptr);
+    const DescriptorInfo& Descr = m_Descriptors[CacheOffset];
+    VERIFY(Descr.Size > 0, "Descriptor at cache offset ", CacheOffset, " is not initialized");
+    GetDescriptor(LogicalDevice, Descr, GetInfo, pSetData);
+}
+
+void DescriptorBufferSetLayoutVk::ClearDescriptor(Uint32 CacheOffset, Uint8* pSetData) const
+{
+    VERIFY_EXPR(CacheOffset < m_Descriptors.size() && pSetData != nullptr);
+    const DescriptorInfo& Descr = m_Descriptors[CacheOffset];
+    if (Descr.ImageSize == 0)
+    {
+        memset(pSetData + Descr.Offset, 0, Descr.Size);
+    }
+    else
+    {
+        memset(pSetData + Descr.Offset, 0, Descr.ImageSize);
+        memset(pSetData + Descr.SamplerOffset, 0, Descr.Size - Descr.ImageSize);
+    }
+}
+
+} // namespace Diligent
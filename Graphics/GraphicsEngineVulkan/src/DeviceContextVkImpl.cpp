@@ -46,6 +46,7 @@
 #include "GenerateMipsVkHelper.hpp"
 #include "QueryManagerVk.hpp"
 #include "CommandQueueVkImpl.hpp"
+#include "CPUProfiler.hpp"
 
 namespace Diligent
 {
@@ -100,6 +101,8 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*      pRefCounters,
     }
 // clang-format on
 {
+    m_CommandBuffer.SetUseSynchronization2(pDeviceVkImpl->UseSynchronization2());
+
     if (!IsDeferred())
     {
         PrepareCommandPool(GetCommandQueueId());
@@ -386,12 +389,15 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
         SetInfo.BaseInd            = Layout.GetFirstDescrSetIndex(pSignature->GetDesc().BindingIndex);
         SetInfo.DynamicOffsetCount = static_cast<Uint16>(pSignature->GetDynamicOffsetCount());
         SetInfo.FirstDynamicOffset = TotalDynamicOffsetCount;
+        SetInfo.UsePushDescriptors = pSignature->UsePushDescriptors();
         TotalDynamicOffsetCount += SetInfo.DynamicOffsetCount;
     }
 
     // Reserve space to store all dynamic buffer offsets
     m_DynamicBufferOffsets.resize(TotalDynamicOffsetCount);
     std::fill(m_DynamicBufferOffsets.begin(), m_DynamicBufferOffsets.end(), 0);
+    m_DynamicBufferChunks.resize(TotalDynamicOffsetCount);
+    std::fill(m_DynamicBufferChunks.begin(), m_DynamicBufferChunks.end(), 0);
 }
 
 DeviceContextVkImpl::ResourceBindInfo& DeviceContextVkImpl::GetBindInfo(PIPELINE_TYPE Type)
@@ -464,8 +470,25 @@ void DeviceContextVkImpl::CommitInlineConstants(ResourceBindInfo& BindInfo, Uint
 
 void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
 {
+    DILIGENT_PROFILE_SCOPE("DeviceContextVkImpl::CommitDescriptorSets");
+
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        CommitDescriptorBufferOffsets(BindInfo, CommitSRBMask);
+        return;
+    }
+
+    // Only the signature with binding index 0 may use push descriptors
+    if ((CommitSRBMask & 1u) != 0 && BindInfo.SetInfo[0].UsePushDescriptors)
+    {
+        CommitPushDescriptors(BindInfo);
+        CommitSRBMask &= ~1u;
+        if (CommitSRBMask == 0)
+            return;
+    }
+
     const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
@@ -502,23 +525,62 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
         const ShaderResourceCacheVk* pResourceCache = BindInfo.ResourceCaches[sign];
         DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null, but corresponding descriptor set is not");
 
-        m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[0];
-        if (SetInfo.vkSets[1] != VK_NULL_HANDLE)
-            m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[1];
-
+        Uint32 OverflowSetMask = 0;
+        bool   ChunksChanged   = false;
         if (SetInfo.DynamicOffsetCount > 0)
         {
             VERIFY(m_DynamicBufferOffsets.size() >= size_t{FirstDynamicOffset} + size_t{DynamicOffsetCount} + size_t{SetInfo.DynamicOffsetCount},
                    "m_DynamicBufferOffsets must've been resized by SetPipelineState() to have enough space");
 
-            auto WriteResult = pResourceCache->WriteDynamicBufferOffsets(this, m_DynamicBufferOffsets, FirstDynamicOffset + DynamicOffsetCount);
+            auto WriteResult = pResourceCache->WriteDynamicBufferOffsets(this, m_DynamicBufferOffsets, m_DynamicBufferChunks, FirstDynamicOffset + DynamicOffsetCount);
             VERIFY_EXPR(WriteResult.NumOffsetsWritten == SetInfo.DynamicOffsetCount);
             DynamicOffsetCount += SetInfo.DynamicOffsetCount;
 
-            if (WriteResult.NumOffsetsChanged > 0)
+            ChunksChanged   = WriteResult.NumChunksChanged > 0;
+            OverflowSetMask = WriteResult.OverflowSetMask;
+            if (WriteResult.NumOffsetsChanged > 0 || ChunksChanged)
                 DynamicOffsetsChanged = true;
         }
 
+        if (OverflowSetMask != 0)
+        {
+            // Descriptors in the SRB sets reference the primary chunk of the dynamic heap. When a buffer with
+            // dynamic offset is allocated from an overflow chunk, the sets that contain it are written again
+            // with the chunk buffers. The sets are reused while the chunks stay the same within the frame.
+            const bool ReuseOverflowSets =
+                (BindInfo.StaleSRBMask & (1u << sign)) == 0 &&
+                !ChunksChanged &&
+                SetInfo.OverflowSetMask == OverflowSetMask &&
+                SetInfo.OverflowSetsFrame == GetFrameNumber();
+            if (!ReuseOverflowSets)
+            {
+                const PipelineResourceSignatureVkImpl* pSignature = m_pPipelineState->GetResourceSignature(sign);
+                VERIFY_EXPR(pSignature != nullptr);
+                for (Uint32 s = 0; s < MAX_DESCR_SET_PER_SIGNATURE; ++s)
+                {
+                    if ((OverflowSetMask & (1u << s)) == 0)
+                        continue;
+
+                    VERIFY_EXPR(SetInfo.vkSets[s] != VK_NULL_HANDLE);
+                    const PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID SetId =
+                        (s == 0 && pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE)) ?
+                        PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE :
+                        PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC;
+
+                    SetInfo.vkOverflowSets[s] = AllocateDynamicDescriptorSet(pSignature->GetVkDescriptorSetLayout(SetId), "Dynamic Heap Overflow Descriptor Set");
+                    pSignature->WriteOverflowDescriptorSet(*pResourceCache, s, SetInfo.vkOverflowSets[s], *this);
+                }
+                SetInfo.OverflowSetsFrame = GetFrameNumber();
+                // Sets must be rebound even if the dynamic offsets are the same
+                DynamicOffsetsChanged = true;
+            }
+        }
+        SetInfo.OverflowSetMask = static_cast<Uint8>(OverflowSetMask);
+
+        m_DescriptorSets[TotalSetCount++] = (OverflowSetMask & 1u) != 0 ? SetInfo.vkOverflowSets[0] : SetInfo.vkSets[0];
+        if (SetInfo.vkSets[1] != VK_NULL_HANDLE)
+            m_DescriptorSets[TotalSetCount++] = (OverflowSetMask & 2u) != 0 ? SetInfo.vkOverflowSets[1] : SetInfo.vkSets[1];
+
 #ifdef DILIGENT_DEVELOPMENT
         SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
 #endif
@@ -526,8 +588,9 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
 
     if ((BindInfo.StaleSRBMask & BindInfo.ActiveSRBMask) != 0 || DynamicOffsetsChanged)
     {
-        // Note that there is one global dynamic buffer from which all dynamic resources are suballocated in Vulkan back-end,
-        // and this buffer is not resizable, so the buffer handle can never change.
+        // Note that dynamic buffers are suballocated from the chunks of the global dynamic heap in Vulkan back-end.
+        // Descriptor sets that reference buffers in overflow chunks have been replaced with vkOverflowSets above,
+        // so besides that only dynamic offsets need to be updated.
 
         // vkCmdBindDescriptorSets causes the sets numbered [firstSet .. firstSet+descriptorSetCount-1] to use the
         // bindings stored in pDescriptorSets[0 .. descriptorSetCount-1] for subsequent rendering commands
@@ -542,6 +605,120 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
 }
 
+void DeviceContextVkImpl::CommitPushDescriptors(ResourceBindInfo& BindInfo)
+{
+    ResourceBindInfo::DescriptorSetInfo& SetInfo        = BindInfo.SetInfo[0];
+    const ShaderResourceCacheVk*         pResourceCache = BindInfo.ResourceCaches[0];
+    VERIFY_EXPR(SetInfo.UsePushDescriptors);
+    DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index 0 is null");
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
+    bool PushDescriptors = (BindInfo.StaleSRBMask & 1u) != 0;
+    if (SetInfo.DynamicOffsetCount > 0)
+    {
+        // Push descriptor sets do not use dynamic offsets as buffer offsets are written directly
+        // to the descriptors. The offsets are only tracked to detect changes.
+        VERIFY(m_DynamicBufferOffsets.size() >= size_t{SetInfo.FirstDynamicOffset} + size_t{SetInfo.DynamicOffsetCount},
+               "m_DynamicBufferOffsets must've been resized by SetPipelineState() to have enough space");
+
+        auto WriteResult = pResourceCache->WriteDynamicBufferOffsets(this, m_DynamicBufferOffsets, m_DynamicBufferChunks, SetInfo.FirstDynamicOffset);
+        VERIFY_EXPR(WriteResult.NumOffsetsWritten == SetInfo.DynamicOffsetCount);
+        if (WriteResult.NumOffsetsChanged > 0 || WriteResult.NumChunksChanged > 0)
+            PushDescriptors = true;
+    }
+
+    if (PushDescriptors)
+    {
+        const PipelineResourceSignatureVkImpl* pSignature = m_pPipelineState->GetResourceSignature(0);
+        VERIFY_EXPR(pSignature != nullptr && pSignature->UsePushDescriptors());
+        pSignature->PushDynamicResources(*pResourceCache, *this, m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd);
+    }
+
+#ifdef DILIGENT_DEVELOPMENT
+    SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+
+    BindInfo.StaleSRBMask &= ~1u;
+}
+
+void DeviceContextVkImpl::CommitDescriptorBufferOffsets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    DILIGENT_PROFILE_SCOPE("DeviceContextVkImpl::CommitDescriptorBufferOffsets");
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
+
+    // Descriptor set data of all SRBs is suballocated from the primary chunk of the global dynamic heap,
+    // which is the only descriptor buffer that is ever bound. Redundant bindings are skipped by the command buffer.
+    VulkanDynamicMemoryManager& DynamicMemMgr = m_pDevice->GetDynamicMemoryManager();
+    m_CommandBuffer.BindDescriptorBuffer(DynamicMemMgr.GetDeviceAddress(),
+                                         VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+                                             VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT |
+                                             VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT);
+
+    const Uint32 DescrBufferOffsetAlignment =
+        StaticCast<Uint32>(m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment);
+
+    // All descriptor sets use the same descriptor buffer
+    static constexpr std::array<uint32_t, MAX_DESCR_SET_PER_SIGNATURE> BufferIndices = {};
+
+    // Unlike descriptor sets, descriptor buffer offsets can be set independently for each signature:
+    // only the signatures whose SRB is stale or whose dynamic buffers have been reallocated are updated.
+    while (CommitSRBMask != 0)
+    {
+        const Uint32 sign = PlatformMisc::GetLSB(CommitSRBMask);
+        CommitSRBMask &= ~(1u << sign);
+        VERIFY_EXPR(sign < m_pPipelineState->GetResourceSignatureCount());
+
+        ResourceBindInfo::DescriptorSetInfo& SetInfo        = BindInfo.SetInfo[sign];
+        const ShaderResourceCacheVk*         pResourceCache = BindInfo.ResourceCaches[sign];
+        DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null");
+
+        bool UpdateSetData = (BindInfo.StaleSRBMask & (1u << sign)) != 0;
+        if (SetInfo.DynamicOffsetCount > 0)
+        {
+            // Dynamic offsets are not used with descriptor buffers as dynamic buffer addresses are
+            // written directly to the descriptors. The offsets are only tracked to detect changes.
+            VERIFY(m_DynamicBufferOffsets.size() >= size_t{SetInfo.FirstDynamicOffset} + size_t{SetInfo.DynamicOffsetCount},
+                   "m_DynamicBufferOffsets must've been resized by SetPipelineState() to have enough space");
+
+            auto WriteResult = pResourceCache->WriteDynamicBufferOffsets(this, m_DynamicBufferOffsets, m_DynamicBufferChunks, SetInfo.FirstDynamicOffset);
+            VERIFY_EXPR(WriteResult.NumOffsetsWritten == SetInfo.DynamicOffsetCount);
+            if (WriteResult.NumOffsetsChanged > 0 || WriteResult.NumChunksChanged > 0)
+                UpdateSetData = true;
+        }
+
+        if (!UpdateSetData)
+            continue;
+
+        const Uint32 NumSets = pResourceCache->GetNumDescriptorSets();
+        VERIFY_EXPR(NumSets > 0 && NumSets <= MAX_DESCR_SET_PER_SIGNATURE);
+        for (Uint32 s = 0; s < NumSets; ++s)
+        {
+            const DescriptorBufferSetLayoutVk* pLayout = pResourceCache->GetDescriptorSet(s).GetDescriptorBufferLayout();
+            VERIFY_EXPR(pLayout != nullptr);
+
+            // Overflow chunks are not bound as descriptor buffers, so the set data must be allocated from the primary chunk
+            VulkanDynamicAllocation Allocation = AllocateDynamicSpace(pLayout->GetDataSize(), DescrBufferOffsetAlignment, /*AllowOverflow = */ false);
+            if (!Allocation)
+            {
+                LOG_ERROR_MESSAGE("Failed to allocate space for descriptor set data in the descriptor buffer. Increase the dynamic heap size.");
+                return;
+            }
+            VERIFY_EXPR(Allocation.pChunk == &DynamicMemMgr.GetPrimaryChunk());
+
+            pResourceCache->WriteDescriptorBufferData(this, s, Allocation.GetCPUAddress());
+            SetInfo.DescrBufferOffsets[s] = Allocation.AlignedOffset;
+        }
+
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, NumSets,
+                                                   BufferIndices.data(), SetInfo.DescrBufferOffsets.data());
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+}
+
 #ifdef DILIGENT_DEVELOPMENT
 void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo)
 {
@@ -561,7 +738,8 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
 
         const ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[i];
         const Uint32                               DSCount = pSign->GetNumDescriptorSets();
-        for (Uint32 s = 0; s < DSCount; ++s)
+        // Descriptor sets are not allocated when descriptor buffers or push descriptors are used
+        for (Uint32 s = 0; s < DSCount && !m_pDevice->UseDescriptorBuffers() && !SetInfo.UsePushDescriptors; ++s)
         {
             DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
                           "descriptor set with index ", s, " is not bound for resource signature '",
@@ -629,10 +807,17 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     BindInfo.Set(SRBIndex, pResBindingVkImpl);
     // We must not clear entire ResInfo as DescriptorSetBaseInd and DynamicOffsetCount
     // are set by SetPipelineState().
-    SetInfo.vkSets = {};
+    SetInfo.vkSets          = {};
+    SetInfo.OverflowSetMask = 0;
     VERIFY((BindInfo.DynamicSRBMask & BindInfo.InlineConstantsSRBMask) == BindInfo.InlineConstantsSRBMask,
            "SRBs with inline constants must also be marked as dynamic.");
 
+    if (m_pDevice->UseDescriptorBuffers())
+    {
+        // Descriptor set data is written to the descriptor buffer by CommitDescriptorBufferOffsets()
+        return;
+    }
+
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
@@ -648,6 +833,16 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
 
+        if (pSignature->UsePushDescriptors())
+        {
+            // Dynamic resources are pushed to the command buffer by CommitPushDescriptors()
+            VERIFY_EXPR(DSIndex == 0 && SRBIndex == 0);
+            ++m_DescriptorSetStats.NumAvoidedDynamicSetAllocations;
+            ++DSIndex;
+            VERIFY_EXPR(DSIndex == ResourceCache.GetNumDescriptorSets());
+            return;
+        }
+
         const VkDescriptorSetLayout vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
 
         VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
@@ -661,6 +856,7 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
 #endif
         // Allocate vulkan descriptor set for dynamic resources
         vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
+        ++m_DescriptorSetStats.NumDynamicSetAllocations;
 
         // Write all dynamic resource descriptors
         pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
@@ -716,7 +912,7 @@ void DeviceContextVkImpl::CommitVkVertexBuffers()
 
             // Device context keeps strong references to all vertex buffers.
 
-            vkVertexBuffers[slot] = pBufferVk->GetVkBuffer();
+            vkVertexBuffers[slot] = GetDynamicBufferVkBuffer(pBufferVk);
             Offsets[slot]         = CurrStream.Offset + GetDynamicBufferOffset(pBufferVk);
         }
         else
@@ -906,7 +1102,7 @@ void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE Ind
 #endif
     DEV_CHECK_ERR(IndexType == VT_UINT16 || IndexType == VT_UINT32, "Unsupported index format. Only R16_UINT and R32_UINT are allowed.");
     VkIndexType vkIndexType = TypeToVkIndexType(IndexType);
-    m_CommandBuffer.BindIndexBuffer(m_pIndexBuffer->GetVkBuffer(), m_IndexDataStartOffset + GetDynamicBufferOffset(m_pIndexBuffer), vkIndexType);
+    m_CommandBuffer.BindIndexBuffer(GetDynamicBufferVkBuffer(m_pIndexBuffer), m_IndexDataStartOffset + GetDynamicBufferOffset(m_pIndexBuffer), vkIndexType);
 }
 
 void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
@@ -1038,15 +1234,15 @@ void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
     {
         if (Attribs.pCounterBuffer == nullptr)
         {
-            m_CommandBuffer.DrawIndirect(pIndirectDrawAttribsVk->GetVkBuffer(),
+            m_CommandBuffer.DrawIndirect(GetDynamicBufferVkBuffer(pIndirectDrawAttribsVk),
                                          GetDynamicBufferOffset(pIndirectDrawAttribsVk) + Attribs.DrawArgsOffset,
                                          Attribs.DrawCount, Attribs.DrawCount > 1 ? Attribs.DrawArgsStride : 0);
         }
         else
         {
-            m_CommandBuffer.DrawIndirectCount(pIndirectDrawAttribsVk->GetVkBuffer(),
+            m_CommandBuffer.DrawIndirectCount(GetDynamicBufferVkBuffer(pIndirectDrawAttribsVk),
                                               GetDynamicBufferOffset(pIndirectDrawAttribsVk) + Attribs.DrawArgsOffset,
-                                              pCountBufferVk->GetVkBuffer(),
+                                              GetDynamicBufferVkBuffer(pCountBufferVk),
                                               GetDynamicBufferOffset(pCountBufferVk) + Attribs.CounterOffset,
                                               Attribs.DrawCount,
                                               Attribs.DrawArgsStride);
@@ -1073,15 +1269,15 @@ void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
     {
         if (Attribs.pCounterBuffer == nullptr)
         {
-            m_CommandBuffer.DrawIndexedIndirect(pIndirectDrawAttribsVk->GetVkBuffer(),
+            m_CommandBuffer.DrawIndexedIndirect(GetDynamicBufferVkBuffer(pIndirectDrawAttribsVk),
                                                 GetDynamicBufferOffset(pIndirectDrawAttribsVk) + Attribs.DrawArgsOffset,
                                                 Attribs.DrawCount, Attribs.DrawCount > 1 ? Attribs.DrawArgsStride : 0);
         }
         else
         {
-            m_CommandBuffer.DrawIndexedIndirectCount(pIndirectDrawAttribsVk->GetVkBuffer(),
+            m_CommandBuffer.DrawIndexedIndirectCount(GetDynamicBufferVkBuffer(pIndirectDrawAttribsVk),
                                                      GetDynamicBufferOffset(pIndirectDrawAttribsVk) + Attribs.DrawArgsOffset,
-                                                     pCountBufferVk->GetVkBuffer(),
+                                                     GetDynamicBufferVkBuffer(pCountBufferVk),
                                                      GetDynamicBufferOffset(pCountBufferVk) + Attribs.CounterOffset,
                                                      Attribs.DrawCount,
                                                      Attribs.DrawArgsStride);
@@ -1121,16 +1317,16 @@ void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attrib
     {
         if (Attribs.pCounterBuffer == nullptr)
         {
-            m_CommandBuffer.DrawMeshIndirect(pIndirectDrawAttribsVk->GetVkBuffer(),
+            m_CommandBuffer.DrawMeshIndirect(GetDynamicBufferVkBuffer(pIndirectDrawAttribsVk),
                                              GetDynamicBufferOffset(pIndirectDrawAttribsVk) + Attribs.DrawArgsOffset,
                                              Attribs.CommandCount,
                                              DrawMeshIndirectCommandStride);
         }
         else
         {
-            m_CommandBuffer.DrawMeshIndirectCount(pIndirectDrawAttribsVk->GetVkBuffer(),
+            m_CommandBuffer.DrawMeshIndirectCount(GetDynamicBufferVkBuffer(pIndirectDrawAttribsVk),
                                                   GetDynamicBufferOffset(pIndirectDrawAttribsVk) + Attribs.DrawArgsOffset,
-                                                  pCountBufferVk->GetVkBuffer(),
+                                                  GetDynamicBufferVkBuffer(pCountBufferVk),
                                                   GetDynamicBufferOffset(pCountBufferVk) + Attribs.CounterOffset,
                                                   Attribs.CommandCount,
                                                   DrawMeshIndirectCommandStride);
@@ -1235,7 +1431,7 @@ void DeviceContextVkImpl::DispatchComputeIndirect(const DispatchComputeIndirectA
     TransitionOrVerifyBufferState(*pBufferVk, Attribs.AttribsBufferStateTransitionMode, RESOURCE_STATE_INDIRECT_ARGUMENT,
                                   VK_ACCESS_INDIRECT_COMMAND_READ_BIT, "Indirect dispatch (DeviceContextVkImpl::DispatchCompute)");
 
-    m_CommandBuffer.DispatchIndirect(pBufferVk->GetVkBuffer(), GetDynamicBufferOffset(pBufferVk) + Attribs.DispatchArgsByteOffset);
+    m_CommandBuffer.DispatchIndirect(GetDynamicBufferVkBuffer(pBufferVk), GetDynamicBufferOffset(pBufferVk) + Attribs.DispatchArgsByteOffset);
     ++m_State.NumCommands;
 }
 
@@ -1546,6 +1742,20 @@ void DeviceContextVkImpl::FinishFrame()
     // be destroyed before the pools are actually returned to the global pool manager.
     m_DynamicDescrSetAllocator.ReleasePools(QueueMask);
 
+    m_LastFrameDescriptorSetStats = m_DescriptorSetStats;
+    m_DescriptorSetStats          = {};
+
+    m_LastFrameBarrierStats = m_CommandBuffer.GetBarrierStatistics();
+    m_CommandBuffer.ResetBarrierStatistics();
+
+    if (!IsDeferred())
+    {
+        CommandQueueVkImpl* pQueueVk = ClassPtrCast<CommandQueueVkImpl>(LockCommandQueue());
+        m_LastFrameSubmissionStats   = pQueueVk->GetSubmissionStatistics();
+        pQueueVk->ResetSubmissionStatistics();
+        UnlockCommandQueue();
+    }
+
     EndFrame();
 }
 
@@ -1557,6 +1767,8 @@ void DeviceContextVkImpl::Flush()
 void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
                                 ICommandList* const* ppCommandLists)
 {
+    DILIGENT_PROFILE_SCOPE("DeviceContextVkImpl::Flush");
+
     DEV_CHECK_ERR(!IsDeferred(), "Flush() should only be called for immediate contexts.");
 
     DEV_CHECK_ERR(m_ActiveQueriesCounter == 0,
@@ -1611,6 +1823,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
         VERIFY(vkCmdBuffs.back() != VK_NULL_HANDLE, "Trying to execute empty command buffer");
         VERIFY_EXPR(DeferredCtxs.back() != nullptr);
     }
+    DILIGENT_PROFILE_COUNTER("Vulkan submitted command buffers", vkCmdBuffs.size());
 
     VERIFY_EXPR(m_VkWaitSemaphores.size() == m_WaitManagedSemaphores.size() + m_WaitRecycledSemaphores.size());
     VERIFY_EXPR(m_VkSignalSemaphores.size() == m_SignalManagedSemaphores.size());
@@ -2271,7 +2484,7 @@ void DeviceContextVkImpl::CopyBuffer(IBuffer*                       pSrcBuffer,
     CopyRegion.size      = Size;
     VERIFY(pDstBuffVk->m_VulkanBuffer != VK_NULL_HANDLE, "Copy destination buffer must not be suballocated");
     VERIFY_EXPR(GetDynamicBufferOffset(pDstBuffVk) == 0);
-    m_CommandBuffer.CopyBuffer(pSrcBuffVk->GetVkBuffer(), pDstBuffVk->GetVkBuffer(), 1, &CopyRegion);
+    m_CommandBuffer.CopyBuffer(GetDynamicBufferVkBuffer(pSrcBuffVk), pDstBuffVk->GetVkBuffer(), 1, &CopyRegion);
     ++m_State.NumCommands;
 }
 
@@ -2316,7 +2529,10 @@ void DeviceContextVkImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAG
 #endif
             if ((MapFlags & MAP_FLAG_DISCARD) != 0 || !DynAllocation)
             {
-                DynAllocation = AllocateDynamicSpace(BuffDesc.Size, pBufferVk->m_DynamicOffsetAlignment);
+                // Buffers without backing Vulkan resource may be allocated from an overflow chunk of the dynamic heap.
+                // In this case, descriptor sets that reference them are rewritten by CommitDescriptorSets() and all other
+                // commands take the Vulkan buffer from the allocation (see GetDynamicBufferVkBuffer()).
+                DynAllocation = AllocateDynamicSpace(BuffDesc.Size, pBufferVk->m_DynamicOffsetAlignment, /*AllowOverflow = */ true);
             }
             else
             {
@@ -2336,8 +2552,7 @@ void DeviceContextVkImpl::MapBuffer(IBuffer* pBuffer, MAP_TYPE MapType, MAP_FLAG
 
             if (DynAllocation)
             {
-                Uint8* CPUAddress = DynAllocation.pDynamicMemMgr->GetCPUAddress();
-                pMappedData       = CPUAddress + DynAllocation.AlignedOffset;
+                pMappedData = DynAllocation.GetCPUAddress();
             }
             else
             {
@@ -2393,7 +2608,7 @@ void DeviceContextVkImpl::UnmapBuffer(IBuffer* pBuffer, MAP_TYPE MapType)
                 if (DynamicBufferId < m_MappedBuffers.size())
                 {
                     VulkanDynamicAllocation& DynAlloc  = m_MappedBuffers[DynamicBufferId].Allocation;
-                    VkBuffer                 vkSrcBuff = DynAlloc.pDynamicMemMgr->GetVkBuffer();
+                    VkBuffer                 vkSrcBuff = DynAlloc.GetVkBuffer();
                     UpdateBufferRegion(pBufferVk, 0, BuffDesc.Size, vkSrcBuff, DynAlloc.AlignedOffset, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
                 }
                 else
@@ -2426,7 +2641,7 @@ void DeviceContextVkImpl::DvpVerifyDynamicAllocation(const BufferVkImpl* pBuffer
     }
 
     const MappedBuffer& MappedBuff = m_MappedBuffers[DynamicBufferId];
-    DEV_CHECK_ERR(MappedBuff.Allocation.pDynamicMemMgr != nullptr, "Dynamic buffer '", BuffDesc.Name, "' has not been mapped before its first use. Context Id: ", GetContextId(),
+    DEV_CHECK_ERR(MappedBuff.Allocation.pChunk != nullptr, "Dynamic buffer '", BuffDesc.Name, "' has not been mapped before its first use. Context Id: ", GetContextId(),
                   ". Note: memory for dynamic buffers is allocated when a buffer is mapped.");
 
     DEV_CHECK_ERR(MappedBuff.Allocation.dvpFrameNumber == GetFrameNumber(), "Dynamic allocation of dynamic buffer '", BuffDesc.Name, "' in frame ", GetFrameNumber(),
@@ -2859,9 +3074,9 @@ void DeviceContextVkImpl::MapTextureSubresource(ITexture*                 pTextu
         {
             Alignment = std::max(Alignment, VkDeviceSize{FmtAttribs.ComponentSize});
         }
-        if (VulkanDynamicAllocation Allocation = AllocateDynamicSpace(CopyInfo.MemorySize, static_cast<Uint32>(Alignment)))
+        if (VulkanDynamicAllocation Allocation = AllocateDynamicSpace(CopyInfo.MemorySize, static_cast<Uint32>(Alignment), /*AllowOverflow = */ true))
         {
-            MappedData.pData       = reinterpret_cast<Uint8*>(Allocation.pDynamicMemMgr->GetCPUAddress()) + Allocation.AlignedOffset;
+            MappedData.pData       = Allocation.GetCPUAddress();
             MappedData.Stride      = CopyInfo.RowStride;
             MappedData.DepthStride = CopyInfo.DepthStride;
 
@@ -2934,7 +3149,7 @@ void DeviceContextVkImpl::UnmapTextureSubresource(ITexture* pTexture,
         if (UploadSpaceIt != m_MappedTextures.end())
         {
             MappedTexture& MappedTex = UploadSpaceIt->second;
-            CopyBufferToTexture(MappedTex.Allocation.pDynamicMemMgr->GetVkBuffer(),
+            CopyBufferToTexture(MappedTex.Allocation.GetVkBuffer(),
                                 MappedTex.Allocation.AlignedOffset,
                                 MappedTex.CopyInfo.RowStrideInTexels,
                                 TextureVk,
@@ -3282,6 +3497,24 @@ VkCommandBuffer DeviceContextVkImpl::GetVkCommandBuffer()
     return m_CommandBuffer.GetVkCmdBuffer();
 }
 
+void DeviceContextVkImpl::GetDescriptorSetStatistics(DescriptorSetStatisticsVk& Stats) const
+{
+    Stats = m_LastFrameDescriptorSetStats;
+}
+
+void DeviceContextVkImpl::GetBarrierStatistics(BarrierStatisticsVk& Stats) const
+{
+    Stats.NumPipelineBarriers  = m_LastFrameBarrierStats.NumPipelineBarriers;
+    Stats.NumRequestedBarriers = m_LastFrameBarrierStats.NumRequestedBarriers;
+    Stats.NumMergedTransitions = m_LastFrameBarrierStats.NumMergedTransitions;
+}
+
+void DeviceContextVkImpl::GetSubmissionStatistics(SubmissionStatisticsVk& Stats) const
+{
+    Stats.NumSubmissions  = m_LastFrameSubmissionStats.NumSubmissions;
+    Stats.NumQueueSubmits = m_LastFrameSubmissionStats.NumQueueSubmits;
+}
+
 void DeviceContextVkImpl::TransitionBufferState(BufferVkImpl& BufferVk, RESOURCE_STATE OldState, RESOURCE_STATE NewState, bool UpdateBufferState)
 {
     VERIFY(m_pActiveRenderPass == nullptr, "State transitions are not allowed inside a render pass");
@@ -3490,12 +3723,24 @@ void DeviceContextVkImpl::TransitionOrVerifyTLASState(TopLevelASVkImpl&
 #endif
 }
 
-VulkanDynamicAllocation DeviceContextVkImpl::AllocateDynamicSpace(Uint64 SizeInBytes, Uint32 Alignment)
+VkDeviceAddress DeviceContextVkImpl::GetDynamicBufferDeviceAddress(const BufferVkImpl* pBuffer) const
+{
+    if (const VulkanDynamicAllocation* pAllocation = GetDynamicBufferAllocation(pBuffer))
+    {
+        const VkDeviceAddress ChunkAddress = pAllocation->pChunk->GetDeviceAddress();
+        VERIFY(ChunkAddress != 0, "Dynamic heap chunk does not have a device address");
+        return ChunkAddress + pAllocation->AlignedOffset;
+    }
+
+    return pBuffer->GetVkDeviceAddress();
+}
+
+VulkanDynamicAllocation DeviceContextVkImpl::AllocateDynamicSpace(Uint64 SizeInBytes, Uint32 Alignment, bool AllowOverflow)
 {
     DEV_CHECK_ERR(SizeInBytes < std::numeric_limits<Uint32>::max(),
                   "Dynamic allocation size must be less than 2^32");
 
-    VulkanDynamicAllocation DynAlloc = m_DynamicHeap.Allocate(static_cast<Uint32>(SizeInBytes), Alignment);
+    VulkanDynamicAllocation DynAlloc = m_DynamicHeap.Allocate(static_cast<Uint32>(SizeInBytes), Alignment, AllowOverflow);
 #ifdef DILIGENT_DEVELOPMENT
     DynAlloc.dvpFrameNumber = GetFrameNumber();
 #endif
@@ -30,6 +30,7 @@
 
 #include "pch.h"
 #include <array>
+#include <algorithm>
 #include "EngineFactoryVk.h"
 #include "RenderDeviceVkImpl.hpp"
 #include "DeviceContextVkImpl.hpp"
@@ -56,6 +57,17 @@ namespace Diligent
 namespace
 {
 
+// Returns the first structure of the given type in the pNext chain, or null if there is no such structure
+const VkBaseInStructure* FindStructureInChain(const void* pNext, VkStructureType sType)
+{
+    for (const VkBaseInStructure* pStruct = static_cast<const VkBaseInStructure*>(pNext); pStruct != nullptr; pStruct = pStruct->pNext)
+    {
+        if (pStruct->sType == sType)
+            return pStruct;
+    }
+    return nullptr;
+}
+
 /// Engine factory for Vk implementation
 class EngineFactoryVkImpl final : public EngineFactoryBase<IEngineFactoryVk>
 {
@@ -1289,6 +1301,79 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.HostImageCopy.pNext;
             }
 
+            if (EnabledFeaturesVk.DescriptorBuffer)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME));
+                VERIFY_EXPR(DeviceExtFeatures.BufferDeviceAddress.bufferDeviceAddress != VK_FALSE);
+                DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+                // Descriptor buffers are bound by their device addresses.
+                // Buffer device address feature may have already been enabled for ray tracing.
+                if (EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE)
+                {
+                    DeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+                    EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                    *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                    NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                }
+
+                EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                // disable unused features
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay   = VK_FALSE;
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors = VK_FALSE;
+
+                *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+            }
+
+            if (EnabledFeaturesVk.GraphicsPipelineLibrary)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+                DeviceExtensions.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+                EnabledExtFeats.GraphicsPipelineLibrary = DeviceExtFeatures.GraphicsPipelineLibrary;
+
+                *NextExt = &EnabledExtFeats.GraphicsPipelineLibrary;
+                NextExt  = &EnabledExtFeats.GraphicsPipelineLibrary.pNext;
+            }
+
+            if (EnabledFeaturesVk.Synchronization2)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+
+                // The same feature structure must not be chained twice, and VkPhysicalDeviceVulkan13Features
+                // must not be chained together with VkPhysicalDeviceSynchronization2Features.
+                // If the application provides either of them, use the feature state it requested.
+                if (const VkBaseInStructure* pUserSync2 = FindStructureInChain(EngineCI.pDeviceExtensionFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR))
+                {
+                    EnabledExtFeats.Synchronization2.synchronization2 = reinterpret_cast<const VkPhysicalDeviceSynchronization2FeaturesKHR*>(pUserSync2)->synchronization2;
+                }
+                else if (const VkBaseInStructure* pUserVk13 = FindStructureInChain(EngineCI.pDeviceExtensionFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES))
+                {
+                    EnabledExtFeats.Synchronization2.synchronization2 = reinterpret_cast<const VkPhysicalDeviceVulkan13Features*>(pUserVk13)->synchronization2;
+                }
+                else
+                {
+                    EnabledExtFeats.Synchronization2 = DeviceExtFeatures.Synchronization2;
+
+                    *NextExt = &EnabledExtFeats.Synchronization2;
+                    NextExt  = &EnabledExtFeats.Synchronization2.pNext;
+                }
+
+                if (EnabledExtFeats.Synchronization2.synchronization2 == VK_FALSE)
+                {
+                    if (EngineCI.FeaturesVk.Synchronization2 == DEVICE_FEATURE_STATE_ENABLED)
+                        LOG_ERROR_AND_THROW("VK_KHR_synchronization2 is required, but the synchronization2 feature is disabled by the structure in pDeviceExtensionFeatures");
+
+                    LOG_INFO_MESSAGE("VK_KHR_synchronization2 is not used as the synchronization2 feature is disabled by the structure in pDeviceExtensionFeatures");
+                }
+            }
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
@@ -1320,6 +1405,29 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
             }
         }
 
+        // Push descriptors are used for small dynamic descriptor sets to avoid allocating them from the descriptor pool.
+        // Note that the extension may have already been enabled for DLSS.
+        if (EnabledFeaturesVk.PushDescriptor)
+        {
+            VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME));
+            const bool Enabled = std::any_of(DeviceExtensions.begin(), DeviceExtensions.end(), [](const char* ExtName) {
+                return std::strcmp(ExtName, VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) == 0;
+            });
+            if (!Enabled)
+                DeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+
+            EnabledExtFeats.PushDescriptor = true;
+        }
+
+        // Memory budget is used by the memory manager to select page sizes and release reserved memory
+        // when a heap approaches its budget.
+        if (DeviceExtFeatures.MemoryBudget)
+        {
+            VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME));
+            DeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+            EnabledExtFeats.MemoryBudget = true;
+        }
+
         ASSERT_SIZEOF(DeviceFeatures, 50, "Did you add a new feature to DeviceFeatures? Please handle its status here.");
 
         for (Uint32 i = 0; i < EngineCI.DeviceExtensionCount; ++i)
@@ -134,8 +134,12 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl*                             pD
                 DescSetLayouts[DescSetLayoutCount++] = pSignature->GetVkDescriptorSetLayout(SetId);
         }
 
-        DynamicUniformBufferCount += pSignature->GetDynamicUniformBufferCount();
-        DynamicStorageBufferCount += pSignature->GetDynamicStorageBufferCount();
+        // Push descriptor sets do not contain dynamic buffers
+        if (!pSignature->UsePushDescriptors())
+        {
+            DynamicUniformBufferCount += pSignature->GetDynamicUniformBufferCount();
+            DynamicStorageBufferCount += pSignature->GetDynamicStorageBufferCount();
+        }
 #ifdef DILIGENT_DEBUG
         m_DbgMaxBindIndex = std::max(m_DbgMaxBindIndex, Uint32{pSignature->GetDesc().BindingIndex});
 #endif
@@ -149,13 +153,15 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl*                             pD
                             ") used by the pipeline layout exceeds device limit (", Limits.maxBoundDescriptorSets, ")");
     }
 
-    if (DynamicUniformBufferCount > Limits.maxDescriptorSetUniformBuffersDynamic)
+    // Dynamic buffers are bound as regular uniform and storage buffers when descriptor buffers are used
+    const bool UseDynamicDescriptors = !pDeviceVk->UseDescriptorBuffers();
+    if (UseDynamicDescriptors && DynamicUniformBufferCount > Limits.maxDescriptorSetUniformBuffersDynamic)
     {
         LOG_ERROR_AND_THROW("The number of dynamic uniform buffers  (", DynamicUniformBufferCount,
                             ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetUniformBuffersDynamic, ")");
     }
 
-    if (DynamicStorageBufferCount > Limits.maxDescriptorSetStorageBuffersDynamic)
+    if (UseDynamicDescriptors && DynamicStorageBufferCount > Limits.maxDescriptorSetStorageBuffersDynamic)
     {
         LOG_ERROR_AND_THROW("The number of dynamic storage buffers (", DynamicStorageBufferCount,
                             ") used by the pipeline layout exceeds device limit (", Limits.maxDescriptorSetStorageBuffersDynamic, ")");
@@ -0,0 +1,573 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+
+#include "PipelineLibraryCacheVk.hpp"
+
+#include <cstring>
+#include <string>
+
+#include "RenderDeviceVkImpl.hpp"
+#include "PipelineResourceSignatureVkImpl.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Returns the bit mask of library parts the dynamic state belongs to
+Uint32 GetDynamicStateLibraryParts(VkDynamicState State)
+{
+    switch (State)
+    {
+        case VK_DYNAMIC_STATE_VIEWPORT:
+        case VK_DYNAMIC_STATE_SCISSOR:
+        case VK_DYNAMIC_STATE_LINE_WIDTH:
+        case VK_DYNAMIC_STATE_DEPTH_BIAS:
+            return 1u << PipelineLibraryCacheVk::LIBRARY_PART_PRE_RASTERIZATION;
+
+        case VK_DYNAMIC_STATE_DEPTH_BOUNDS:
+        case VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK:
+        case VK_DYNAMIC_STATE_STENCIL_WRITE_MASK:
+        case VK_DYNAMIC_STATE_STENCIL_REFERENCE:
+            return 1u << PipelineLibraryCacheVk::LIBRARY_PART_FRAGMENT_SHADER;
+
+        case VK_DYNAMIC_STATE_BLEND_CONSTANTS:
+            return 1u << PipelineLibraryCacheVk::LIBRARY_PART_FRAGMENT_OUTPUT;
+
+        case VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR:
+            return (1u << PipelineLibraryCacheVk::LIBRARY_PART_PRE_RASTERIZATION) |
+                (1u << PipelineLibraryCacheVk::LIBRARY_PART_FRAGMENT_SHADER);
+
+        default:
+            UNEXPECTED("Unexpected dynamic state");
+            return (1u << PipelineLibraryCacheVk::LIBRARY_PART_COUNT) - 1u;
+    }
+}
+
+} // namespace
+
+void PipelineLibraryCacheVk::LibraryKey::AddBytes(const void* pData, size_t Size)
+{
+    VERIFY(m_Hash == 0, "The key must not be modified after the hash has been computed");
+    if (Size == 0)
+        return;
+
+    const Uint8* pBytes = static_cast<const Uint8*>(pData);
+    m_Data.insert(m_Data.end(), pBytes, pBytes + Size);
+}
+
+void PipelineLibraryCacheVk::LibraryKey::AddString(const char* Str)
+{
+    if (Str == nullptr)
+        Str = "";
+    // Include the terminating null to separate the string from the data that follows
+    AddBytes(Str, strlen(Str) + 1);
+}
+
+void PipelineLibraryCacheVk::LibraryKey::AddPipelineLayout(const RefCntAutoPtr<PipelineResourceSignatureVkImpl>* ppSignatures, Uint32 SignatureCount)
+{
+    // Libraries can only be linked with layouts that are identically defined to the layouts they were
+    // created with, so the key must contain everything the descriptor set layouts are created from.
+    // The hash of the signatures is not enough as the library would be reused in case of a collision.
+    Add(SignatureCount);
+    for (Uint32 i = 0; i < SignatureCount; ++i)
+    {
+        const PipelineResourceSignatureVkImpl* pSignature = ppSignatures[i];
+        if (pSignature == nullptr)
+        {
+            Add(Uint32{0});
+            continue;
+        }
+
+        const PipelineResourceSignatureDesc& Desc = pSignature->GetDesc();
+        Add(Uint32{1});
+        Add(Desc.BindingIndex);
+
+        Add(Desc.NumResources);
+        for (Uint32 r = 0; r < Desc.NumResources; ++r)
+        {
+            const PipelineResourceDesc&      Res  = Desc.Resources[r];
+            const PipelineResourceAttribsVk& Attr = pSignature->GetResourceAttribs(r);
+            Add(Res.ShaderStages);
+            Add(Res.ArraySize);
+            Add(Res.ResourceType);
+            Add(Res.VarType);
+            Add(Res.Flags);
+            Add(Uint32{Attr.BindingIndex});
+            Add(Uint32{Attr.ArraySize});
+            Add(Uint32{Attr.DescrType});
+            Add(Uint32{Attr.DescrSet});
+            Add(Uint32{Attr.ImtblSamplerAssigned});
+        }
+
+        Add(Desc.NumImmutableSamplers);
+        for (Uint32 s = 0; s < Desc.NumImmutableSamplers; ++s)
+        {
+            const ImmutableSamplerDesc&      ImtblSam = Desc.ImmutableSamplers[s];
+            const ImmutableSamplerAttribsVk& Attr     = pSignature->GetImmutableSamplerAttribs(s);
+            const SamplerDesc&               SamDesc  = ImtblSam.Desc;
+            Add(ImtblSam.ShaderStages);
+            Add(Attr.DescrSet);
+            Add(Attr.BindingIndex);
+            // Add members one by one to skip the name and the padding
+            Add(SamDesc.MinFilter);
+            Add(SamDesc.MagFilter);
+            Add(SamDesc.MipFilter);
+            Add(SamDesc.AddressU);
+            Add(SamDesc.AddressV);
+            Add(SamDesc.AddressW);
+            Add(SamDesc.Flags);
+            Add(SamDesc.UnnormalizedCoords);
+            Add(SamDesc.MipLODBias);
+            Add(SamDesc.MaxAnisotropy);
+            Add(SamDesc.ComparisonFunc);
+            Add(SamDesc.BorderColor);
+            Add(SamDesc.MinLOD);
+            Add(SamDesc.MaxLOD);
+        }
+    }
+}
+
+void PipelineLibraryCacheVk::LibraryKey::AddRenderPass(const RenderPassDesc& Desc)
+{
+    const auto AddAttachmentRefs = [this](const AttachmentReference* pRefs, Uint32 Count) {
+        Add(Uint32{pRefs != nullptr ? Count : 0});
+        if (pRefs != nullptr)
+            AddBytes(pRefs, sizeof(AttachmentReference) * Count);
+    };
+
+    Add(Desc.AttachmentCount);
+    for (Uint32 i = 0; i < Desc.AttachmentCount; ++i)
+    {
+        const RenderPassAttachmentDesc& Attachment = Desc.pAttachments[i];
+        Add(Attachment.Format);
+        Add(Attachment.SampleCount);
+        Add(Attachment.LoadOp);
+        Add(Attachment.StoreOp);
+        Add(Attachment.StencilLoadOp);
+        Add(Attachment.StencilStoreOp);
+        Add(Attachment.InitialState);
+        Add(Attachment.FinalState);
+    }
+
+    Add(Desc.SubpassCount);
+    for (Uint32 i = 0; i < Desc.SubpassCount; ++i)
+    {
+        const SubpassDesc& Subpass = Desc.pSubpasses[i];
+        AddAttachmentRefs(Subpass.pInputAttachments, Subpass.InputAttachmentCount);
+        AddAttachmentRefs(Subpass.pRenderTargetAttachments, Subpass.RenderTargetAttachmentCount);
+        AddAttachmentRefs(Subpass.pResolveAttachments, Subpass.RenderTargetAttachmentCount);
+        AddAttachmentRefs(Subpass.pDepthStencilAttachment, 1);
+        Add(Subpass.PreserveAttachmentCount);
+        AddBytes(Subpass.pPreserveAttachments, sizeof(Uint32) * Subpass.PreserveAttachmentCount);
+        if (const ShadingRateAttachment* pShadingRate = Subpass.pShadingRateAttachment)
+        {
+            Add(Uint32{1});
+            Add(*pShadingRate);
+        }
+        else
+        {
+            Add(Uint32{0});
+        }
+    }
+
+    Add(Desc.DependencyCount);
+    AddBytes(Desc.pDependencies, sizeof(SubpassDependencyDesc) * Desc.DependencyCount);
+}
+
+size_t PipelineLibraryCacheVk::LibraryKey::GetHash() const noexcept
+{
+    if (m_Hash == 0)
+    {
+        m_Hash = ComputeHashRaw(m_Data.data(), m_Data.size());
+    }
+    return m_Hash;
+}
+
+PipelineLibraryCacheVk::PipelineLibraryCacheVk(RenderDeviceVkImpl& DeviceVk) noexcept :
+    m_DeviceVk{DeviceVk}
+{}
+
+// Libraries are never referenced by command buffers (only the linked pipelines are),
+// so they are destroyed immediately rather than through the release queues.
+PipelineLibraryCacheVk::~PipelineLibraryCacheVk()
+{
+}
+
+bool PipelineLibraryCacheVk::IsFastLinkingSupported() const
+{
+    return m_DeviceVk.GetPhysicalDevice().GetExtProperties().GraphicsPipelineLibrary.graphicsPipelineLibraryFastLinking != VK_FALSE;
+}
+
+VkPipeline PipelineLibraryCacheVk::GetLibrary(LIBRARY_PART                        Part,
+                                              LibraryKey&&                        Key,
+                                              const VkGraphicsPipelineCreateInfo& LibraryCI,
+                                              VkPipelineCache                     vkPipelineCache,
+                                              const char*                         Name) noexcept(false)
+{
+    PartCache& Cache = m_Parts[Part];
+    {
+        std::lock_guard<std::mutex> Lock{Cache.Mtx};
+
+        auto it = Cache.Libraries.find(Key);
+        if (it != Cache.Libraries.end())
+            return it->second;
+    }
+
+    static constexpr std::array<const char*, LIBRARY_PART_COUNT> PartNames = {
+        "vertex input",
+        "pre-rasterization",
+        "fragment shader",
+        "fragment output",
+    };
+    const std::string LibraryName = std::string{Name != nullptr ? Name : ""} + " - " + PartNames[Part] + " library";
+
+    // Create the library without holding the lock so that different libraries can be compiled in parallel
+    VulkanUtilities::PipelineWrapper Library = m_DeviceVk.GetLogicalDevice().CreateGraphicsPipeline(LibraryCI, vkPipelineCache, LibraryName.c_str());
+
+    std::lock_guard<std::mutex> Lock{Cache.Mtx};
+    // If another thread has created the same library in the meantime, the existing one is
+    // returned and the new library is destroyed.
+    auto it = Cache.Libraries.emplace(std::move(Key), std::move(Library)).first;
+    return it->second;
+}
+
+PipelineLibraryCacheVk::LibraryArrayType PipelineLibraryCacheVk::GetLibraries(const GraphicsPipelineInfo& Info) noexcept(false)
+{
+    const VkGraphicsPipelineCreateInfo& PipelineCI = Info.PipelineCI;
+    VERIFY_EXPR(Info.StagesSPIRV.size() == PipelineCI.stageCount);
+    VERIFY_EXPR(PipelineCI.pVertexInputState != nullptr && PipelineCI.pInputAssemblyState != nullptr);
+    VERIFY_EXPR(PipelineCI.pViewportState != nullptr && PipelineCI.pRasterizationState != nullptr);
+    VERIFY_EXPR(PipelineCI.pMultisampleState != nullptr && PipelineCI.pDepthStencilState != nullptr);
+    VERIFY_EXPR(PipelineCI.pColorBlendState != nullptr && PipelineCI.pDynamicState != nullptr);
+
+    // When render pass is null, the pipeline uses dynamic rendering, and the rendering
+    // info is the first structure in the pNext chain.
+    const VkPipelineRenderingCreateInfoKHR* pRenderingCI = nullptr;
+    if (PipelineCI.renderPass == VK_NULL_HANDLE)
+    {
+        pRenderingCI = static_cast<const VkPipelineRenderingCreateInfoKHR*>(PipelineCI.pNext);
+        VERIFY_EXPR(pRenderingCI != nullptr && pRenderingCI->sType == VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR);
+    }
+
+    const auto AddRenderPass = [&](LibraryKey& Key, bool AddFormats) {
+        if (pRenderingCI == nullptr)
+        {
+            VERIFY_EXPR(Info.pRenderPassDesc != nullptr);
+            Key.AddRenderPass(*Info.pRenderPassDesc);
+            Key.Add(PipelineCI.subpass);
+        }
+        else
+        {
+            Key.Add(pRenderingCI->viewMask);
+            if (AddFormats)
+            {
+                Key.Add(pRenderingCI->colorAttachmentCount);
+                Key.AddBytes(pRenderingCI->pColorAttachmentFormats, sizeof(VkFormat) * pRenderingCI->colorAttachmentCount);
+                Key.Add(pRenderingCI->depthAttachmentFormat);
+                Key.Add(pRenderingCI->stencilAttachmentFormat);
+            }
+        }
+    };
+
+    const auto AddShaderStage = [&](LibraryKey& Key, Uint32 StageIdx) {
+        const VkPipelineShaderStageCreateInfo& Stage = PipelineCI.pStages[StageIdx];
+        const std::vector<uint32_t>&           SPIRV = *Info.StagesSPIRV[StageIdx];
+
+        Key.Add(Stage.flags);
+        Key.Add(Stage.stage);
+        Key.AddString(Stage.pName);
+        Key.Add(SPIRV.size());
+        Key.AddBytes(SPIRV.data(), SPIRV.size() * sizeof(uint32_t));
+
+        if (const VkSpecializationInfo* pSpecInfo = Stage.pSpecializationInfo)
+        {
+            Key.Add(pSpecInfo->mapEntryCount);
+            for (Uint32 i = 0; i < pSpecInfo->mapEntryCount; ++i)
+            {
+                const VkSpecializationMapEntry& Entry = pSpecInfo->pMapEntries[i];
+                Key.Add(Entry.constantID);
+                Key.Add(Entry.offset);
+                Key.Add(Entry.size);
+            }
+            Key.Add(pSpecInfo->dataSize);
+            Key.AddBytes(pSpecInfo->pData, pSpecInfo->dataSize);
+        }
+        else
+        {
+            Key.Add(Uint32{0});
+        }
+    };
+
+    const VkPipelineMultisampleStateCreateInfo& MSStateCI = *PipelineCI.pMultisampleState;
+
+    const auto AddMultisampleState = [&](LibraryKey& Key) {
+        Key.Add(MSStateCI.rasterizationSamples);
+        Key.Add(MSStateCI.sampleShadingEnable);
+        Key.Add(MSStateCI.minSampleShading);
+        if (MSStateCI.pSampleMask != nullptr)
+            Key.AddBytes(MSStateCI.pSampleMask, sizeof(VkSampleMask) * ((MSStateCI.rasterizationSamples + 31) / 32));
+        Key.Add(MSStateCI.alphaToCoverageEnable);
+        Key.Add(MSStateCI.alphaToOneEnable);
+    };
+
+    // Split stages and dynamic states between the libraries
+    std::vector<VkPipelineShaderStageCreateInfo> PreRasterStages;
+    std::vector<VkPipelineShaderStageCreateInfo> FragmentStages;
+    std::array<LibraryKey, LIBRARY_PART_COUNT>   Keys;
+    for (LibraryKey& Key : Keys)
+        Key.Add(PipelineCI.flags);
+
+    for (Uint32 i = 0; i < PipelineCI.stageCount; ++i)
+    {
+        const VkPipelineShaderStageCreateInfo& Stage = PipelineCI.pStages[i];
+        if (Stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+        {
+            FragmentStages.push_back(Stage);
+            AddShaderStage(Keys[LIBRARY_PART_FRAGMENT_SHADER], i);
+        }
+        else
+        {
+            PreRasterStages.push_back(Stage);
+            AddShaderStage(Keys[LIBRARY_PART_PRE_RASTERIZATION], i);
+        }
+    }
+
+    std::array<std::vector<VkDynamicState>, LIBRARY_PART_COUNT> DynamicStates;
+    for (Uint32 i = 0; i < PipelineCI.pDynamicState->dynamicStateCount; ++i)
+    {
+        const VkDynamicState State = PipelineCI.pDynamicState->pDynamicStates[i];
+        const Uint32         Parts = GetDynamicStateLibraryParts(State);
+        for (Uint32 Part = 0; Part < LIBRARY_PART_COUNT; ++Part)
+        {
+            if ((Parts & (1u << Part)) != 0)
+            {
+                DynamicStates[Part].push_back(State);
+                Keys[Part].Add(State);
+            }
+        }
+    }
+
+    std::array<VkPipelineDynamicStateCreateInfo, LIBRARY_PART_COUNT> DynamicStateCIs{};
+    for (Uint32 Part = 0; Part < LIBRARY_PART_COUNT; ++Part)
+    {
+        DynamicStateCIs[Part].sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+        DynamicStateCIs[Part].dynamicStateCount = static_cast<uint32_t>(DynamicStates[Part].size());
+        DynamicStateCIs[Part].pDynamicStates    = DynamicStates[Part].data();
+    }
+
+    // Vertex input interface
+    {
+        LibraryKey& Key = Keys[LIBRARY_PART_VERTEX_INPUT];
+
+        const VkPipelineVertexInputStateCreateInfo& VertexInputCI = *PipelineCI.pVertexInputState;
+        Key.Add(VertexInputCI.vertexBindingDescriptionCount);
+        Key.AddBytes(VertexInputCI.pVertexBindingDescriptions, sizeof(VkVertexInputBindingDescription) * VertexInputCI.vertexBindingDescriptionCount);
+        Key.Add(VertexInputCI.vertexAttributeDescriptionCount);
+        Key.AddBytes(VertexInputCI.pVertexAttributeDescriptions, sizeof(VkVertexInputAttributeDescription) * VertexInputCI.vertexAttributeDescriptionCount);
+        if (const VkPipelineVertexInputDivisorStateCreateInfoEXT* pDivisorCI = static_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT*>(VertexInputCI.pNext))
+        {
+            VERIFY_EXPR(pDivisorCI->sType == VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT);
+            Key.Add(pDivisorCI->vertexBindingDivisorCount);
+            Key.AddBytes(pDivisorCI->pVertexBindingDivisors, sizeof(VkVertexInputBindingDivisorDescriptionEXT) * pDivisorCI->vertexBindingDivisorCount);
+        }
+        Key.Add(PipelineCI.pInputAssemblyState->topology);
+        Key.Add(PipelineCI.pInputAssemblyState->primitiveRestartEnable);
+    }
+
+    // Pre-rasterization shaders
+    {
+        LibraryKey& Key = Keys[LIBRARY_PART_PRE_RASTERIZATION];
+        Key.AddPipelineLayout(Info.ppSignatures, Info.SignatureCount);
+
+        const VkPipelineViewportStateCreateInfo& ViewportCI = *PipelineCI.pViewportState;
+        Key.Add(ViewportCI.viewportCount);
+        Key.Add(ViewportCI.scissorCount);
+        if (ViewportCI.pScissors != nullptr)
+            Key.AddBytes(ViewportCI.pScissors, sizeof(VkRect2D) * ViewportCI.scissorCount);
+
+        const VkPipelineRasterizationStateCreateInfo& RasterizerCI = *PipelineCI.pRasterizationState;
+        Key.Add(RasterizerCI.depthClampEnable);
+        Key.Add(RasterizerCI.rasterizerDiscardEnable);
+        Key.Add(RasterizerCI.polygonMode);
+        Key.Add(RasterizerCI.cullMode);
+        Key.Add(RasterizerCI.frontFace);
+        Key.Add(RasterizerCI.depthBiasEnable);
+        Key.Add(RasterizerCI.depthBiasConstantFactor);
+        Key.Add(RasterizerCI.depthBiasClamp);
+        Key.Add(RasterizerCI.depthBiasSlopeFactor);
+        Key.Add(RasterizerCI.lineWidth);
+
+        if (PipelineCI.pTessellationState != nullptr)
+            Key.Add(PipelineCI.pTessellationState->patchControlPoints);
+
+        AddRenderPass(Key, /*AddFormats = */ false);
+    }
+
+    // Fragment shader
+    {
+        LibraryKey& Key = Keys[LIBRARY_PART_FRAGMENT_SHADER];
+        Key.AddPipelineLayout(Info.ppSignatures, Info.SignatureCount);
+
+        AddMultisampleState(Key);
+
+        const VkPipelineDepthStencilStateCreateInfo& DepthStencilCI = *PipelineCI.pDepthStencilState;
+        Key.Add(DepthStencilCI.depthTestEnable);
+        Key.Add(DepthStencilCI.depthWriteEnable);
+        Key.Add(DepthStencilCI.depthCompareOp);
+        Key.Add(DepthStencilCI.depthBoundsTestEnable);
+        Key.Add(DepthStencilCI.stencilTestEnable);
+        Key.Add(DepthStencilCI.front);
+        Key.Add(DepthStencilCI.back);
+        Key.Add(DepthStencilCI.minDepthBounds);
+        Key.Add(DepthStencilCI.maxDepthBounds);
+
+        AddRenderPass(Key, /*AddFormats = */ true);
+    }
+
+    // Fragment output interface
+    {
+        LibraryKey& Key = Keys[LIBRARY_PART_FRAGMENT_OUTPUT];
+
+        const VkPipelineColorBlendStateCreateInfo& BlendCI = *PipelineCI.pColorBlendState;
+        Key.Add(BlendCI.logicOpEnable);
+        Key.Add(BlendCI.logicOp);
+        Key.Add(BlendCI.attachmentCount);
+        Key.AddBytes(BlendCI.pAttachments, sizeof(VkPipelineColorBlendAttachmentState) * BlendCI.attachmentCount);
+        Key.Add(BlendCI.blendConstants);
+
+        AddMultisampleState(Key);
+
+        AddRenderPass(Key, /*AddFormats = */ true);
+    }
+
+    static constexpr std::array<VkGraphicsPipelineLibraryFlagsEXT, LIBRARY_PART_COUNT> PartFlags = {
+        VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+    };
+
+    LibraryArrayType Libraries{};
+    for (Uint32 Part = 0; Part < LIBRARY_PART_COUNT; ++Part)
+    {
+        VkGraphicsPipelineLibraryCreateInfoEXT GPLibraryCI{};
+        GPLibraryCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+        GPLibraryCI.flags = PartFlags[Part];
+
+        VkGraphicsPipelineCreateInfo LibraryCI{};
+        LibraryCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+        LibraryCI.pNext = &GPLibraryCI;
+
+        // All parts except for the vertex input interface need the rendering info when dynamic rendering is used
+        VkPipelineRenderingCreateInfoKHR RenderingCI{};
+        if (pRenderingCI != nullptr && Part != LIBRARY_PART_VERTEX_INPUT)
+        {
+            RenderingCI       = *pRenderingCI;
+            RenderingCI.pNext = &GPLibraryCI;
+            LibraryCI.pNext   = &RenderingCI;
+        }
+        // Retain link-time optimization info so that the optimized pipeline can be linked from the same libraries
+        LibraryCI.flags             = PipelineCI.flags | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+        LibraryCI.pDynamicState     = &DynamicStateCIs[Part];
+        LibraryCI.basePipelineIndex = -1;
+
+        switch (Part)
+        {
+            case LIBRARY_PART_VERTEX_INPUT:
+                LibraryCI.pVertexInputState   = PipelineCI.pVertexInputState;
+                LibraryCI.pInputAssemblyState = PipelineCI.pInputAssemblyState;
+                break;
+
+            case LIBRARY_PART_PRE_RASTERIZATION:
+                LibraryCI.stageCount          = static_cast<uint32_t>(PreRasterStages.size());
+                LibraryCI.pStages             = PreRasterStages.data();
+                LibraryCI.layout              = PipelineCI.layout;
+                LibraryCI.pViewportState      = PipelineCI.pViewportState;
+                LibraryCI.pRasterizationState = PipelineCI.pRasterizationState;
+                LibraryCI.pTessellationState  = PipelineCI.pTessellationState;
+                LibraryCI.renderPass          = PipelineCI.renderPass;
+                LibraryCI.subpass             = PipelineCI.subpass;
+                break;
+
+            case LIBRARY_PART_FRAGMENT_SHADER:
+                LibraryCI.stageCount         = static_cast<uint32_t>(FragmentStages.size());
+                LibraryCI.pStages            = !FragmentStages.empty() ? FragmentStages.data() : nullptr;
+                LibraryCI.layout             = PipelineCI.layout;
+                LibraryCI.pMultisampleState  = PipelineCI.pMultisampleState;
+                LibraryCI.pDepthStencilState = PipelineCI.pDepthStencilState;
+                LibraryCI.renderPass         = PipelineCI.renderPass;
+                LibraryCI.subpass            = PipelineCI.subpass;
+                break;
+
+            case LIBRARY_PART_FRAGMENT_OUTPUT:
+                LibraryCI.pColorBlendState  = PipelineCI.pColorBlendState;
+                LibraryCI.pMultisampleState = PipelineCI.pMultisampleState;
+                LibraryCI.renderPass        = PipelineCI.renderPass;
+                LibraryCI.subpass           = PipelineCI.subpass;
+                break;
+
+            default:
+                UNEXPECTED("Unexpected library part");
+        }
+
+        Libraries[Part] = GetLibrary(static_cast<LIBRARY_PART>(Part), std::move(Keys[Part]), LibraryCI, Info.vkPipelineCache, Info.Name);
+    }
+
+    return Libraries;
+}
+
+VulkanUtilities::PipelineWrapper PipelineLibraryCacheVk::LinkPipeline(const LibraryArrayType& Libraries,
+                                                                      VkPipelineLayout        vkLayout,
+                                                                      VkPipelineCreateFlags   Flags,
+                                                                      bool                    Optimize,
+                                                                      VkPipelineCache         vkPipelineCache,
+                                                                      const char*             Name) const noexcept(false)
+{
+    VkPipelineLibraryCreateInfoKHR LinkCI{};
+    LinkCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LinkCI.libraryCount = static_cast<uint32_t>(Libraries.size());
+    LinkCI.pLibraries   = Libraries.data();
+
+    VkGraphicsPipelineCreateInfo PipelineCI{};
+    PipelineCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    PipelineCI.pNext = &LinkCI;
+    PipelineCI.flags = Flags;
+    if (Optimize)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+    // The layout must be compatible with the layouts the libraries were created with
+    PipelineCI.layout            = vkLayout;
+    PipelineCI.basePipelineIndex = -1;
+
+    return m_DeviceVk.GetLogicalDevice().CreateGraphicsPipeline(PipelineCI, vkPipelineCache, Name);
+}
+
+} // namespace Diligent
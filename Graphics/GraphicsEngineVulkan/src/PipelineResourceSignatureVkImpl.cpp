@@ -158,7 +158,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_TotalInlineConstants);
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_TotalInlineConstants, GetDescriptorBufferSetLayouts());
             });
     }
     catch (...)
@@ -224,6 +224,27 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         VERIFY_EXPR(Idx <= MAX_DESCRIPTOR_SETS);
     }
 
+    // Small dynamic descriptor sets of signatures that only contain dynamic variables are updated with
+    // push descriptors, which avoids allocating the set from the dynamic descriptor pool on every commit.
+    // A pipeline layout may contain only one push descriptor set, so only the signature with binding
+    // index 0 is eligible.
+    if (HasDevice() &&
+        GetDevice()->UsePushDescriptors() &&
+        m_Desc.BindingIndex == 0 &&
+        DSMapping[DESCRIPTOR_SET_ID_STATIC_MUTABLE] >= MAX_DESCRIPTOR_SETS &&
+        DSMapping[DESCRIPTOR_SET_ID_DYNAMIC] < MAX_DESCRIPTOR_SETS)
+    {
+        // Separate immutable samplers are also added to the dynamic set
+        const Uint32 NumDescriptors =
+            CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR] +
+            CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR] +
+            CacheGroupSizes[CACHE_GROUP_OTHER_DYN_VAR] +
+            m_Desc.NumImmutableSamplers;
+        const Uint32 MaxPushDescriptors = GetDevice()->GetPhysicalDevice().GetExtProperties().PushDescriptor.maxPushDescriptors;
+
+        m_UsePushDescriptors = NumDescriptors <= std::min(MaxPushDescriptorSetSize, MaxPushDescriptors);
+    }
+
     // Resource bindings as well as cache offsets are ordered by CACHE_GROUP in each descriptor set:
     //
     //      static/mutable vars set: |  Dynamic UBs  |  Dynamic SBs  |   The rest    |
@@ -264,6 +285,12 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS> vkSetLayoutBindings;
 
+    // When descriptor buffers are used, dynamic uniform and storage buffers are not allowed in set layouts,
+    // and descriptors are addressed by SRB cache offsets.
+    const bool UseDescriptorBuffers = HasDevice() && GetDevice()->UseDescriptorBuffers();
+
+    std::array<std::vector<DescriptorBufferSetLayoutVk::BindingInfo>, DESCRIPTOR_SET_ID_NUM_SETS> DescrBufferBindings;
+
     DynamicLinearAllocator TempAllocator{GetRawAllocator(), 256};
 
     std::vector<bool> ImmutableSamplerWithResource(m_Desc.NumImmutableSamplers, false);
@@ -356,9 +383,22 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.descriptorCount    = DescriptorCount;
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
-        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        vkSetLayoutBinding.descriptorType     = (UseDescriptorBuffers || m_UsePushDescriptors) ?
+            DescriptorTypeToVkNonDynamicDescriptorType(pAttribs->GetDescriptorType()) :
+            DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
 
+        if (UseDescriptorBuffers)
+        {
+            DescriptorBufferSetLayoutVk::BindingInfo BindingInfo;
+            BindingInfo.BindingIndex       = vkSetLayoutBinding.binding;
+            BindingInfo.CacheOffset        = pAttribs->SRBCacheOffset;
+            BindingInfo.ArraySize          = DescriptorCount;
+            BindingInfo.vkType             = vkSetLayoutBinding.descriptorType;
+            BindingInfo.pImmutableSamplers = pVkImmutableSamplers;
+            DescrBufferBindings[SetId].push_back(BindingInfo);
+        }
+
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
         {
             VERIFY(pAttribs->DescrSet == 0, "Static resources must always be allocated in descriptor set 0");
@@ -486,6 +526,16 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.descriptorType     = VK_DESCRIPTOR_TYPE_SAMPLER;
         vkSetLayoutBinding.pImmutableSamplers = TempAllocator.Construct<VkSampler>(pSamplerVk ? pSamplerVk->GetVkSampler() : VK_NULL_HANDLE);
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
+
+        if (UseDescriptorBuffers)
+        {
+            DescriptorBufferSetLayoutVk::BindingInfo BindingInfo;
+            BindingInfo.BindingIndex       = vkSetLayoutBinding.binding;
+            BindingInfo.ArraySize          = 1;
+            BindingInfo.vkType             = VK_DESCRIPTOR_TYPE_SAMPLER;
+            BindingInfo.pImmutableSamplers = vkSetLayoutBinding.pImmutableSamplers;
+            DescrBufferBindings[SetId].push_back(BindingInfo);
+        }
     }
 
     Uint32 NumSets = 0;
@@ -518,6 +568,10 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
     SetLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     SetLayoutCI.pNext = nullptr;
     SetLayoutCI.flags = 0;
+    if (UseDescriptorBuffers)
+        SetLayoutCI.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+    if (m_UsePushDescriptors)
+        SetLayoutCI.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
 
     if (HasDevice())
     {
@@ -532,6 +586,13 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             SetLayoutCI.bindingCount = StaticCast<uint32_t>(vkSetLayoutBinding.size());
             SetLayoutCI.pBindings    = vkSetLayoutBinding.data();
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
+
+            if (UseDescriptorBuffers)
+            {
+                const Uint32 SetIdx = DSMapping[i];
+                m_DescrBufferSetLayouts[SetIdx].Initialize(LogicalDevice, GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer,
+                                                           m_VkDescrSetLayouts[i], DescrBufferBindings[i], m_DescriptorSetSizes[SetIdx]);
+            }
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
     }
@@ -562,9 +623,12 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
 #endif
 
     IMemoryAllocator& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
-    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data(), m_TotalInlineConstants);
+    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data(), m_TotalInlineConstants, GetDescriptorBufferSetLayouts());
 
-    if (VkDescriptorSetLayout vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+    // When descriptor buffers are used, descriptors are written to the resource cache and
+    // no descriptor sets need to be allocated.
+    VkDescriptorSetLayout vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE);
+    if (vkLayout != VK_NULL_HANDLE && !UseDescriptorBuffers())
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
 #ifdef DILIGENT_DEVELOPMENT
@@ -721,12 +785,17 @@ Uint32 PipelineResourceSignatureVkImpl::GetDescriptorSetIndex<PipelineResourceSi
     return HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) ? 1 : 0;
 }
 
-void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
-                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+template <bool IsPushDescriptorSet, typename FlushWritesType>
+void PipelineResourceSignatureVkImpl::WriteDescriptorSetResources(const ShaderResourceCacheVk& ResourceCache,
+                                                                  DESCRIPTOR_SET_ID            SetId,
+                                                                  VkDescriptorSet              vkDescriptorSet,
+                                                                  const DeviceContextVkImpl*   pCtx,
+                                                                  FlushWritesType              FlushWrites) const
 {
-    VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
-    VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
+    VERIFY(HasDescriptorSet(SetId), "This signature does not contain descriptor set ", Uint32{SetId});
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+    // dstSet is ignored for push descriptors
+    VERIFY_EXPR(IsPushDescriptorSet ? (vkDescriptorSet == VK_NULL_HANDLE && pCtx != nullptr && SetId == DESCRIPTOR_SET_ID_DYNAMIC) : vkDescriptorSet != VK_NULL_HANDLE);
 
 #ifdef DILIGENT_DEBUG
     static constexpr size_t ImgUpdateBatchSize          = 4;
@@ -755,14 +824,20 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     auto AccelStructIt   = DescrAccelStructArr.begin();
     auto WriteDescrSetIt = WriteDescrSetArr.begin();
 
-    const Uint32                                DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
-    const ShaderResourceCacheVk::DescriptorSet& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const VulkanUtilities::LogicalDevice&       LogicalDevice  = GetDevice()->GetLogicalDevice();
-    const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    const Uint32 SetIdx = SetId == DESCRIPTOR_SET_ID_DYNAMIC ?
+        GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>() :
+        GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>();
+    const ShaderResourceCacheVk::DescriptorSet& SetResources = ResourceCache.GetDescriptorSet(SetIdx);
+
+    // Resources are sorted by variable type, so static and mutable resources form a single range
+    static_assert(SHADER_RESOURCE_VARIABLE_TYPE_STATIC + 1 == SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE, "Static and mutable resources are expected to be adjacent");
+    const std::pair<Uint32, Uint32> ResIdxRange = SetId == DESCRIPTOR_SET_ID_DYNAMIC ?
+        GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC) :
+        std::make_pair(GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_STATIC).first, GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE).second);
 
     constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
 
-    for (Uint32 ResIdx = DynResIdxRange.first, ArrElem = 0; ResIdx < DynResIdxRange.second;)
+    for (Uint32 ResIdx = ResIdxRange.first, ArrElem = 0; ResIdx < ResIdxRange.second;)
     {
         const PipelineResourceAttribsType& Attr        = GetResourceAttribs(ResIdx);
         const Uint32                       CacheOffset = Attr.CacheOffset(CacheType);
@@ -773,20 +848,23 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         {
             const PipelineResourceDesc& Res = GetResourceDesc(ResIdx);
             VERIFY_EXPR(ArraySize == GetResourceDesc(ResIdx).GetArraySize());
-            VERIFY_EXPR(Res.VarType == SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+            VERIFY_EXPR(VarTypeToDescriptorSetId(Res.VarType) == SetId);
+            VERIFY_EXPR(Attr.DescrSet == SetIdx);
         }
 #endif
 
         WriteDescrSetIt->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         WriteDescrSetIt->pNext = nullptr;
-        VERIFY(SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
-        WriteDescrSetIt->dstSet = vkDynamicDescriptorSet;
-        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
+        VERIFY(SetId != DESCRIPTOR_SET_ID_DYNAMIC || SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE,
+               "Dynamic descriptor set must not be assigned to the resource cache");
+        WriteDescrSetIt->dstSet          = vkDescriptorSet;
         WriteDescrSetIt->dstBinding      = Attr.BindingIndex;
         WriteDescrSetIt->dstArrayElement = ArrElem;
         // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
         // The type of the descriptor also controls which array the descriptors are taken from. (13.2.4)
-        WriteDescrSetIt->descriptorType  = DescriptorTypeToVkDescriptorType(DescrType);
+        WriteDescrSetIt->descriptorType = IsPushDescriptorSet ?
+            DescriptorTypeToVkNonDynamicDescriptorType(DescrType) :
+            DescriptorTypeToVkDescriptorType(DescrType);
         WriteDescrSetIt->descriptorCount = 0;
         // Zero-initialize array pointers as some implementations (e.g. Android Emulator) still check them even
         // if they are not used.
@@ -801,6 +879,31 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
                 if (const ShaderResourceCacheVk::Resource& CachedRes = SetResources.GetResource(CacheOffset + (ArrElem++)))
                 {
                     *DescrIt = CachedRes.GetDescriptorWriteInfo<DescrType>();
+                    if constexpr (std::is_same_v<std::decay_t<decltype(*DescrIt)>, VkDescriptorBufferInfo>)
+                    {
+                        const BufferVkImpl* pBufferVk = nullptr;
+                        if (pCtx != nullptr && CachedRes.Type == DescriptorType::UniformBufferDynamic)
+                        {
+                            pBufferVk = CachedRes.pObject.ConstPtr<BufferVkImpl>();
+                        }
+                        else if (pCtx != nullptr &&
+                                 (CachedRes.Type == DescriptorType::StorageBufferDynamic ||
+                                  CachedRes.Type == DescriptorType::StorageBufferDynamic_ReadOnly))
+                        {
+                            pBufferVk = CachedRes.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+                        }
+
+                        if (pBufferVk != nullptr)
+                        {
+                            DescrIt->buffer = pCtx->GetDynamicBufferVkBuffer(pBufferVk);
+                            if (IsPushDescriptorSet)
+                            {
+                                // Push descriptor sets cannot contain dynamic buffers, so the current offset
+                                // of the dynamic allocation is written to the descriptor.
+                                DescrIt->offset += pCtx->GetDynamicBufferOffset(pBufferVk, /*VerifyAllocation = */ false) + CachedRes.BufferDynamicOffset;
+                            }
+                        }
+                    }
                     ++DescrIt;
                     ++WriteDescrSetIt->descriptorCount;
                 }
@@ -897,7 +1000,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         {
             Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
             if (DescrWriteCount > 0)
-                LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+                FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
 
             DescrImgIt      = DescrImgInfoArr.begin();
             DescrBuffIt     = DescrBuffInfoArr.begin();
@@ -909,7 +1012,57 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
     if (DescrWriteCount > 0)
-        LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+        FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
+}
+
+void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                             VkDescriptorSet              vkDynamicDescriptorSet) const
+{
+    VERIFY(!m_UsePushDescriptors, "Dynamic resources of this signature must be pushed with PushDynamicResources()");
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+    WriteDescriptorSetResources</*IsPushDescriptorSet = */ false>(
+        ResourceCache, DESCRIPTOR_SET_ID_DYNAMIC, vkDynamicDescriptorSet, nullptr,
+        [&LogicalDevice](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescrWrites) {
+            LogicalDevice.UpdateDescriptorSets(DescrWriteCount, pDescrWrites, 0, nullptr);
+        });
+}
+
+void PipelineResourceSignatureVkImpl::PushDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                           DeviceContextVkImpl&         Ctx,
+                                                           VkPipelineBindPoint          vkBindPoint,
+                                                           VkPipelineLayout             vkPipelineLayout,
+                                                           Uint32                       SetIndex) const
+{
+    VERIFY(m_UsePushDescriptors, "This signature does not use push descriptors");
+
+    VulkanUtilities::CommandBuffer& CmdBuffer = Ctx.GetCommandBuffer();
+    WriteDescriptorSetResources</*IsPushDescriptorSet = */ true>(
+        ResourceCache, DESCRIPTOR_SET_ID_DYNAMIC, VK_NULL_HANDLE, &Ctx,
+        [&](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescrWrites) {
+            // Consecutive pushes to the same set update only the bindings that are written
+            CmdBuffer.PushDescriptorSet(vkBindPoint, vkPipelineLayout, SetIndex, DescrWriteCount, pDescrWrites);
+        });
+}
+
+void PipelineResourceSignatureVkImpl::WriteOverflowDescriptorSet(const ShaderResourceCacheVk& ResourceCache,
+                                                                 Uint32                       SetIndex,
+                                                                 VkDescriptorSet              vkDescriptorSet,
+                                                                 const DeviceContextVkImpl&   Ctx) const
+{
+    VERIFY(!m_UsePushDescriptors || SetIndex != GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>(),
+           "Dynamic resources of this signature are pushed with PushDynamicResources()");
+
+    const DESCRIPTOR_SET_ID SetId = (HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE) && SetIndex == 0) ?
+        DESCRIPTOR_SET_ID_STATIC_MUTABLE :
+        DESCRIPTOR_SET_ID_DYNAMIC;
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+    WriteDescriptorSetResources</*IsPushDescriptorSet = */ false>(
+        ResourceCache, SetId, vkDescriptorSet, &Ctx,
+        [&LogicalDevice](Uint32 DescrWriteCount, const VkWriteDescriptorSet* pDescrWrites) {
+            LogicalDevice.UpdateDescriptorSets(DescrWriteCount, pDescrWrites, 0, nullptr);
+        });
 }
 
 
@@ -1080,7 +1233,7 @@ PipelineResourceSignatureVkImpl::PipelineResourceSignatureVkImpl(IReferenceCount
             },
             [this]() //
             {
-                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_TotalInlineConstants);
+                return ShaderResourceCacheVk::GetRequiredMemorySize(GetNumDescriptorSets(), m_DescriptorSetSizes.data(), m_TotalInlineConstants, GetDescriptorBufferSetLayouts());
             });
     }
     catch (...)
@@ -26,13 +26,115 @@
 
 #include "pch.h"
 #include "PipelineStateCacheVkImpl.hpp"
+
+#include <algorithm>
+
 #include "RenderDeviceVkImpl.hpp"
 #include "VulkanTypeConversions.hpp"
 #include "DataBlobImpl.hpp"
+#include "HashUtils.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Header that precedes the Vulkan pipeline cache data written by SaveToStream().
+// In addition to the fields of VkPipelineCacheHeaderVersionOne, it records the driver
+// version as some drivers do not invalidate the cache UUID when the driver is updated.
+struct PipelineCacheFileHeader
+{
+    static constexpr Uint32 ExpectedMagic   = 0x43505644; // 'DVPC'
+    static constexpr Uint32 ExpectedVersion = 1;
+
+    Uint32 Magic         = ExpectedMagic;
+    Uint32 Version       = ExpectedVersion;
+    Uint32 VendorID      = 0;
+    Uint32 DeviceID      = 0;
+    Uint32 DriverVersion = 0;
+    Uint32 Reserved      = 0;
+    Uint8  PipelineCacheUUID[VK_UUID_SIZE]{};
+    Uint64 DataSize = 0;
+    Uint64 DataHash = 0;
+};
+static_assert(sizeof(PipelineCacheFileHeader) == 56, "Did you add new members to PipelineCacheFileHeader? Please bump ExpectedVersion.");
+
+bool IsCacheFileData(const void* pData, size_t DataSize)
+{
+    if (pData == nullptr || DataSize < sizeof(PipelineCacheFileHeader))
+        return false;
+
+    Uint32 Magic = 0;
+    std::memcpy(&Magic, pData, sizeof(Magic));
+    return Magic == PipelineCacheFileHeader::ExpectedMagic;
+}
+
+// Checks that the header matches the physical device and the driver.
+bool IsCompatibleHeader(const VkPhysicalDeviceProperties& Props, const PipelineCacheFileHeader& Header, const char* CacheName)
+{
+    const char* Reason = nullptr;
+    if (Header.Magic != PipelineCacheFileHeader::ExpectedMagic)
+        Reason = "invalid magic number";
+    else if (Header.Version != PipelineCacheFileHeader::ExpectedVersion)
+        Reason = "format version mismatch";
+    else if (Header.VendorID != Props.vendorID)
+        Reason = "vendor ID mismatch";
+    else if (Header.DeviceID != Props.deviceID)
+        Reason = "device ID mismatch";
+    else if (Header.DriverVersion != Props.driverVersion)
+        Reason = "driver version mismatch";
+    else if (std::memcmp(Header.PipelineCacheUUID, Props.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+        Reason = "pipeline cache UUID mismatch";
+
+    if (Reason != nullptr)
+    {
+        LOG_INFO_MESSAGE("Pipeline cache data for '", (CacheName != nullptr ? CacheName : ""), "' is ignored: ", Reason, '.');
+        return false;
+    }
+
+    return true;
+}
+
+// Validates the data produced by SaveToStream() and returns the pointer to and the size of Vulkan cache data.
+bool ValidateCacheFileData(const VkPhysicalDeviceProperties& Props, const void*& pData, size_t& DataSize, const char* CacheName)
+{
+    PipelineCacheFileHeader Header;
+    std::memcpy(&Header, pData, sizeof(Header));
+    if (!IsCompatibleHeader(Props, Header, CacheName))
+        return false;
+
+    const Uint8* pVkData = static_cast<const Uint8*>(pData) + sizeof(Header);
+    if (Header.DataSize != DataSize - sizeof(Header) ||
+        Header.DataHash != ComputeHashRaw(pVkData, static_cast<size_t>(Header.DataSize)))
+    {
+        LOG_WARNING_MESSAGE("Pipeline cache data for '", (CacheName != nullptr ? CacheName : ""), "' is corrupted and will be ignored.");
+        return false;
+    }
+
+    pData    = pVkData;
+    DataSize = static_cast<size_t>(Header.DataSize);
+    return true;
+}
+
+// Checks the header of the raw Vulkan pipeline cache data.
+bool IsCompatibleVkCacheData(const VkPhysicalDeviceProperties& Props, const void* pData, size_t DataSize)
+{
+    if (pData == nullptr || DataSize <= sizeof(VkPipelineCacheHeaderVersionOne))
+        return false;
+
+    VkPipelineCacheHeaderVersionOne HeaderVersion;
+    std::memcpy(&HeaderVersion, pData, sizeof(HeaderVersion));
+
+    return (HeaderVersion.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+            HeaderVersion.headerSize == 32 && // from specs
+            HeaderVersion.deviceID == Props.deviceID &&
+            HeaderVersion.vendorID == Props.vendorID &&
+            std::memcmp(HeaderVersion.pipelineCacheUUID, Props.pipelineCacheUUID, sizeof(HeaderVersion.pipelineCacheUUID)) == 0);
+}
+
+} // namespace
+
 PipelineStateCacheVkImpl::PipelineStateCacheVkImpl(IReferenceCounters*                 pRefCounters,
                                                    RenderDeviceVkImpl*                 pRenderDeviceVk,
                                                    const PipelineStateCacheCreateInfo& CreateInfo) :
@@ -52,21 +154,23 @@ PipelineStateCacheVkImpl::PipelineStateCacheVkImpl(IReferenceCounters*
     VkPipelineCacheCreateInfo VkPipelineStateCacheCI{};
     VkPipelineStateCacheCI.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
 
-    if (CreateInfo.pCacheData != nullptr && CreateInfo.CacheDataSize > sizeof(VkPipelineCacheHeaderVersionOne))
+    if (CreateInfo.pCacheData != nullptr)
     {
         const VkPhysicalDeviceProperties& Props = GetDevice()->GetPhysicalDevice().GetProperties();
 
-        VkPipelineCacheHeaderVersionOne HeaderVersion;
-        std::memcpy(&HeaderVersion, CreateInfo.pCacheData, sizeof(HeaderVersion));
+        // The data may either be produced by SaveToStream() or be raw Vulkan cache data returned by GetData().
+        const void* pCacheData    = CreateInfo.pCacheData;
+        size_t      CacheDataSize = CreateInfo.CacheDataSize;
+        if (IsCacheFileData(pCacheData, CacheDataSize))
+        {
+            if (!ValidateCacheFileData(Props, pCacheData, CacheDataSize, m_Desc.Name))
+                pCacheData = nullptr;
+        }
 
-        if (HeaderVersion.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
-            HeaderVersion.headerSize == 32 && // from specs
-            HeaderVersion.deviceID == Props.deviceID &&
-            HeaderVersion.vendorID == Props.vendorID &&
-            std::memcmp(HeaderVersion.pipelineCacheUUID, Props.pipelineCacheUUID, sizeof(HeaderVersion.pipelineCacheUUID)) == 0)
+        if (pCacheData != nullptr && IsCompatibleVkCacheData(Props, pCacheData, CacheDataSize))
         {
-            VkPipelineStateCacheCI.initialDataSize = CreateInfo.CacheDataSize;
-            VkPipelineStateCacheCI.pInitialData    = CreateInfo.pCacheData;
+            VkPipelineStateCacheCI.initialDataSize = CacheDataSize;
+            VkPipelineStateCacheCI.pInitialData    = pCacheData;
         }
     }
 
@@ -87,6 +191,8 @@ void PipelineStateCacheVkImpl::GetData(IDataBlob** ppBlob)
 
     const VkDevice vkDevice = m_pDevice->GetLogicalDevice().GetVkDevice();
 
+    std::shared_lock<Threading::SharedMutex> Lock{m_Mtx};
+
     size_t DataSize = 0;
     if (vkGetPipelineCacheData(vkDevice, m_PipelineStateCache, &DataSize, nullptr) != VK_SUCCESS)
         return;
@@ -99,4 +205,174 @@ void PipelineStateCacheVkImpl::GetData(IDataBlob** ppBlob)
     *ppBlob = pDataBlob.Detach();
 }
 
+bool PipelineStateCacheVkImpl::SaveToStream(IFileStream* pStream)
+{
+    DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
+    if (pStream == nullptr || !pStream->IsValid())
+        return false;
+
+    RefCntAutoPtr<IDataBlob> pData;
+    GetData(&pData);
+    if (!pData)
+    {
+        LOG_ERROR_MESSAGE("Failed to get the data of pipeline cache '", m_Desc.Name, "'.");
+        return false;
+    }
+
+    const VkPhysicalDeviceProperties& Props = GetDevice()->GetPhysicalDevice().GetProperties();
+
+    PipelineCacheFileHeader Header;
+    Header.VendorID      = Props.vendorID;
+    Header.DeviceID      = Props.deviceID;
+    Header.DriverVersion = Props.driverVersion;
+    std::memcpy(Header.PipelineCacheUUID, Props.pipelineCacheUUID, VK_UUID_SIZE);
+    Header.DataSize = pData->GetSize();
+    Header.DataHash = ComputeHashRaw(pData->GetConstDataPtr(), pData->GetSize());
+
+    if (!pStream->Write(&Header, sizeof(Header)) ||
+        !pStream->Write(pData->GetConstDataPtr(), pData->GetSize()))
+    {
+        LOG_ERROR_MESSAGE("Failed to write the data of pipeline cache '", m_Desc.Name, "' to the stream.");
+        return false;
+    }
+
+    return true;
+}
+
+bool PipelineStateCacheVkImpl::LoadFromStream(IFileStream* pStream)
+{
+    DEV_CHECK_ERR(pStream != nullptr, "pStream must not be null");
+    if (pStream == nullptr || !pStream->IsValid())
+        return false;
+
+    const size_t StreamSize = pStream->GetSize();
+    const size_t StreamPos  = pStream->GetPos();
+    if (StreamPos > StreamSize || StreamSize - StreamPos < sizeof(PipelineCacheFileHeader))
+        return false;
+
+    PipelineCacheFileHeader Header;
+    if (!pStream->Read(&Header, sizeof(Header)))
+        return false;
+
+    const VkPhysicalDeviceProperties& Props = GetDevice()->GetPhysicalDevice().GetProperties();
+    if (!IsCompatibleHeader(Props, Header, m_Desc.Name))
+        return false;
+
+    // Do not trust the size in the header before checking it against the stream size
+    if (Header.DataSize > StreamSize - StreamPos - sizeof(Header))
+    {
+        LOG_WARNING_MESSAGE("Pipeline cache data for '", m_Desc.Name, "' is truncated and will be ignored.");
+        return false;
+    }
+
+    std::vector<Uint8> Data(static_cast<size_t>(Header.DataSize));
+    if (!pStream->Read(Data.data(), Data.size()))
+        return false;
+
+    if (Header.DataHash != ComputeHashRaw(Data.data(), Data.size()))
+    {
+        LOG_WARNING_MESSAGE("Pipeline cache data for '", m_Desc.Name, "' is corrupted and will be ignored.");
+        return false;
+    }
+
+    if (!IsCompatibleVkCacheData(Props, Data.data(), Data.size()))
+        return false;
+
+    return MergeData(Data.data(), Data.size());
+}
+
+bool PipelineStateCacheVkImpl::MergeData(const void* pData, size_t DataSize)
+{
+    VkPipelineCacheCreateInfo VkPipelineStateCacheCI{};
+    VkPipelineStateCacheCI.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    VkPipelineStateCacheCI.initialDataSize = DataSize;
+    VkPipelineStateCacheCI.pInitialData    = pData;
+
+    VulkanUtilities::PipelineCacheWrapper TmpCache;
+    try
+    {
+        TmpCache = m_pDevice->GetLogicalDevice().CreatePipelineCache(VkPipelineStateCacheCI);
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    const VkPipelineCache vkSrcCache = TmpCache;
+
+    std::unique_lock<Threading::SharedMutex> Lock{m_Mtx};
+
+    const VkResult err = vkMergePipelineCaches(m_pDevice->GetLogicalDevice().GetVkDevice(), m_PipelineStateCache, 1, &vkSrcCache);
+    if (err != VK_SUCCESS)
+    {
+        LOG_WARNING_MESSAGE("Failed to merge pipeline cache data into '", m_Desc.Name, "': ", VulkanUtilities::VkResultToString(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool PipelineStateCacheVkImpl::Merge(Uint32 NumSrcCaches, IPipelineStateCache* const* ppSrcCaches)
+{
+    DEV_CHECK_ERR(NumSrcCaches == 0 || ppSrcCaches != nullptr, "ppSrcCaches must not be null");
+
+    std::vector<PipelineStateCacheVkImpl*> SrcCaches;
+    SrcCaches.reserve(NumSrcCaches);
+    for (Uint32 i = 0; i < NumSrcCaches; ++i)
+    {
+        IPipelineStateCache* pSrcCache = ppSrcCaches[i];
+        if (pSrcCache == nullptr || pSrcCache == this)
+            continue;
+
+        RefCntAutoPtr<IPipelineStateCacheVk> pSrcCacheVk{pSrcCache, IID_PipelineStateCacheVk};
+        if (!pSrcCacheVk || ClassPtrCast<PipelineStateCacheVkImpl>(pSrcCacheVk.RawPtr())->GetDevice() != GetDevice())
+        {
+            LOG_WARNING_MESSAGE("Pipeline cache '", pSrcCache->GetDesc().Name, "' was not created by the same Vulkan device as '",
+                                m_Desc.Name, "' and will not be merged.");
+            continue;
+        }
+
+        SrcCaches.push_back(ClassPtrCast<PipelineStateCacheVkImpl>(pSrcCacheVk.RawPtr()));
+    }
+
+    if (SrcCaches.empty())
+        return true;
+
+    // Lock this cache exclusively and the source caches for shared access. The locks are acquired
+    // in address order so that merges between the same caches in opposite directions do not deadlock.
+    std::vector<PipelineStateCacheVkImpl*> LockOrder = SrcCaches;
+    LockOrder.push_back(this);
+    std::sort(LockOrder.begin(), LockOrder.end());
+    LockOrder.erase(std::unique(LockOrder.begin(), LockOrder.end()), LockOrder.end());
+
+    std::unique_lock<Threading::SharedMutex>              Lock{m_Mtx, std::defer_lock};
+    std::vector<std::shared_lock<Threading::SharedMutex>> SrcLocks;
+    SrcLocks.reserve(LockOrder.size());
+    for (PipelineStateCacheVkImpl* pCache : LockOrder)
+    {
+        if (pCache == this)
+            Lock.lock();
+        else
+            SrcLocks.emplace_back(pCache->m_Mtx);
+    }
+
+    std::vector<VkPipelineCache> vkSrcCaches;
+    vkSrcCaches.reserve(LockOrder.size());
+    for (PipelineStateCacheVkImpl* pCache : LockOrder)
+    {
+        if (pCache != this)
+            vkSrcCaches.push_back(pCache->GetVkPipelineCache());
+    }
+
+    const VkResult err = vkMergePipelineCaches(m_pDevice->GetLogicalDevice().GetVkDevice(), m_PipelineStateCache,
+                                               static_cast<uint32_t>(vkSrcCaches.size()), vkSrcCaches.data());
+    if (err != VK_SUCCESS)
+    {
+        LOG_WARNING_MESSAGE("Failed to merge pipeline caches into '", m_Desc.Name, "': ", VulkanUtilities::VkResultToString(err));
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace Diligent
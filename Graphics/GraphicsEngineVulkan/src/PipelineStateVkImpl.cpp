@@ -38,10 +38,12 @@
 #include "RenderPassVkImpl.hpp"
 #include "ShaderResourceBindingVkImpl.hpp"
 #include "PipelineStateCacheVkImpl.hpp"
+#include "PipelineLibraryCacheVk.hpp"
 
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
 #include "StringTools.hpp"
+#include "CPUProfiler.hpp"
 
 #if !DILIGENT_NO_HLSL
 #    include "SPIRVTools.hpp"
@@ -231,6 +233,8 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
@@ -241,6 +245,25 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 }
 
 
+// Parameters of a graphics pipeline that is linked from pipeline libraries
+struct GraphicsPipelineLibraryParams
+{
+    const PipelineStateVkImpl::TShaderStages& ShaderStages;
+
+    // Resource signatures the pipeline layout is created from
+    const RefCntAutoPtr<PipelineResourceSignatureVkImpl>* ppSignatures;
+    const Uint32                                          SignatureCount;
+
+    // Whether to link the pipeline without link-time optimization
+    const bool FastLink;
+
+    // [out] Libraries the pipeline is linked from
+    PipelineLibraryCacheVk::LibraryArrayType Libraries = {};
+
+    // [out] Pipeline create flags
+    VkPipelineCreateFlags Flags = 0;
+};
+
 void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
                             std::vector<VkPipelineShaderStageCreateInfo>& Stages,
                             const PipelineLayoutVk&                       Layout,
@@ -248,7 +271,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
                             const GraphicsPipelineDesc&                   GraphicsPipeline,
                             VulkanUtilities::PipelineWrapper&             Pipeline,
                             RefCntAutoPtr<IRenderPass>&                   pRenderPass,
-                            VkPipelineCache                               vkPSOCache)
+                            VkPipelineCache                               vkPSOCache,
+                            GraphicsPipelineLibraryParams*                pLibraryParams = nullptr)
 {
     const VulkanUtilities::LogicalDevice&  LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const VulkanUtilities::PhysicalDevice& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
@@ -259,6 +283,8 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     VkPipelineRenderingCreateInfoKHR PipelineRenderingCI{};
     std::vector<VkFormat>            ColorAttachmentFormats;
@@ -472,7 +498,37 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    if (pLibraryParams != nullptr)
+    {
+        PipelineLibraryCacheVk* pLibraryCache = pDeviceVk->GetPipelineLibraryCache();
+        VERIFY_EXPR(pLibraryCache != nullptr);
+
+        // Stages have one entry per ShaderStageInfo::Item across all stages
+        std::vector<const std::vector<uint32_t>*> StagesSPIRV;
+        for (const PipelineStateVkImpl::ShaderStageInfo& Stage : pLibraryParams->ShaderStages)
+        {
+            for (const PipelineStateVkImpl::ShaderStageInfo::Item& StageItem : Stage.Items)
+                StagesSPIRV.push_back(&StageItem.SPIRV);
+        }
+        VERIFY_EXPR(StagesSPIRV.size() == Stages.size());
+
+        PipelineLibraryCacheVk::GraphicsPipelineInfo LibraryInfo{PipelineCI, StagesSPIRV};
+        LibraryInfo.ppSignatures    = pLibraryParams->ppSignatures;
+        LibraryInfo.SignatureCount  = pLibraryParams->SignatureCount;
+        LibraryInfo.pRenderPassDesc = pRenderPass ? &pRenderPass->GetDesc() : nullptr;
+        LibraryInfo.vkPipelineCache = vkPSOCache;
+        LibraryInfo.Name            = PSODesc.Name;
+
+        pLibraryParams->Libraries = pLibraryCache->GetLibraries(LibraryInfo);
+        pLibraryParams->Flags     = PipelineCI.flags;
+
+        Pipeline = pLibraryCache->LinkPipeline(pLibraryParams->Libraries, PipelineCI.layout, PipelineCI.flags,
+                                               /*Optimize = */ !pLibraryParams->FastLink, vkPSOCache, PSODesc.Name);
+    }
+    else
+    {
+        Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    }
 }
 
 
@@ -493,6 +549,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -698,6 +756,19 @@ MergedPushConstantMapType MergePushConstants(const PipelineStateVkImpl::TShaderS
     return MergedPushConstants;
 }
 
+// Returns the Vulkan handle of the pipeline state cache and locks the cache for pipeline creation
+// so that other caches are not merged into it while the pipeline is being created.
+VkPipelineCache LockPipelineStateCache(IPipelineStateCache* pPSOCache, std::shared_lock<Threading::SharedMutex>& Lock)
+{
+    if (pPSOCache == nullptr)
+        return VK_NULL_HANDLE;
+
+    PipelineStateCacheVkImpl* pPSOCacheVk = ClassPtrCast<PipelineStateCacheVkImpl>(pPSOCache);
+
+    Lock = pPSOCacheVk->LockForPipelineCreation();
+    return pPSOCacheVk->GetVkPipelineCache();
+}
+
 } // namespace
 
 
@@ -1105,30 +1176,88 @@ PipelineStateVkImpl::TShaderStages PipelineStateVkImpl::InitInternalObjects(
 
 void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_SCOPE("PipelineStateVkImpl::InitializePipeline");
+
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
     std::vector<ShaderStageSpecializationData>        SpecDataPerStage;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules, SpecDataPerStage);
+    const TShaderStages ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules, SpecDataPerStage);
 
-    const VkPipelineCache vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+    std::shared_lock<Threading::SharedMutex> CacheLock;
+    const VkPipelineCache                    vkSPOCache = LockPipelineStateCache(CreateInfo.pPSOCache, CacheLock);
+
+    // Mesh pipelines and pipelines with variable rate shading are always created as monolithic pipelines
+    PipelineLibraryCacheVk* pLibraryCache = m_pDevice->GetPipelineLibraryCache();
+    if (pLibraryCache != nullptr &&
+        m_Desc.PipelineType == PIPELINE_TYPE_GRAPHICS &&
+        m_pGraphicsPipelineData->Desc.ShadingRateFlags == PIPELINE_SHADING_RATE_FLAG_NONE)
+    {
+        // If the device has a shader compilation thread pool, fast-link the pipeline now and
+        // build the optimized pipeline in the background.
+        IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+        const bool   FastLink    = pThreadPool != nullptr && pLibraryCache->IsFastLinkingSupported();
+
+        GraphicsPipelineLibraryParams LibraryParams{ShaderStages, m_Signatures, m_SignatureCount, FastLink};
+        CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache, &LibraryParams);
+
+        if (FastLink)
+        {
+            LinkOptimizedPipelineAsync(pThreadPool, LibraryParams.Libraries, LibraryParams.Flags, CreateInfo.pPSOCache);
+        }
+    }
+    else
+    {
+        CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+    }
+}
+
+void PipelineStateVkImpl::LinkOptimizedPipelineAsync(IThreadPool*                                    pThreadPool,
+                                                     const PipelineLibraryCacheVk::LibraryArrayType& Libraries,
+                                                     VkPipelineCreateFlags                           Flags,
+                                                     IPipelineStateCache*                            pPSOCache)
+{
+    VERIFY_EXPR(!m_OptimizedPipelineTask);
+    m_OptimizedPipelineTask = EnqueueAsyncWork(
+        pThreadPool,
+        [this, Libraries, Flags, pPSOCacheVk = RefCntAutoPtr<PipelineStateCacheVkImpl>{ClassPtrCast<PipelineStateCacheVkImpl>(pPSOCache)}](Uint32 ThreadId) //
+        {
+            try
+            {
+                std::shared_lock<Threading::SharedMutex> CacheLock;
+                const VkPipelineCache                    vkSPOCache = LockPipelineStateCache(pPSOCacheVk.RawPtr(), CacheLock);
+
+                m_OptimizedPipeline = m_pDevice->GetPipelineLibraryCache()->LinkPipeline(Libraries, m_PipelineLayout.GetVkPipelineLayout(), Flags,
+                                                                                         /*Optimize = */ true, vkSPOCache, m_Desc.Name);
+                m_vkOptimizedPipeline.store(m_OptimizedPipeline);
+            }
+            catch (...)
+            {
+                LOG_WARNING_MESSAGE("Failed to link optimized pipeline '", m_Desc.Name, "'. The fast-linked pipeline will be used.");
+            }
+            return ASYNC_TASK_STATUS_COMPLETE;
+        });
 }
 
 void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_SCOPE("PipelineStateVkImpl::InitializePipeline");
+
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
     std::vector<ShaderStageSpecializationData>        SpecDataPerStage;
 
     InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules, SpecDataPerStage);
 
-    const VkPipelineCache vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+    std::shared_lock<Threading::SharedMutex> CacheLock;
+    const VkPipelineCache                    vkSPOCache = LockPipelineStateCache(CreateInfo.pPSOCache, CacheLock);
     CreateComputePipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_Pipeline, vkSPOCache);
 }
 
 void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreateInfo& CreateInfo)
 {
+    DILIGENT_PROFILE_SCOPE("PipelineStateVkImpl::InitializePipeline");
+
     const VulkanUtilities::LogicalDevice& LogicalDevice = m_pDevice->GetLogicalDevice();
 
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
@@ -1138,7 +1267,9 @@ void PipelineStateVkImpl::InitializePipeline(const RayTracingPipelineStateCreate
     const TShaderStages ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules, SpecDataPerStage);
 
     const std::vector<VkRayTracingShaderGroupCreateInfoKHR> vkShaderGroups = BuildRTShaderGroupDescription(CreateInfo, m_pRayTracingPipelineData->NameToGroupIndex, ShaderStages);
-    const VkPipelineCache                                   vkSPOCache     = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
+
+    std::shared_lock<Threading::SharedMutex> CacheLock;
+    const VkPipelineCache                    vkSPOCache = LockPipelineStateCache(CreateInfo.pPSOCache, CacheLock);
 
     CreateRayTracingPipeline(m_pDevice, vkShaderStages, vkShaderGroups, m_PipelineLayout, m_Desc, m_pRayTracingPipelineData->Desc, m_Pipeline, vkSPOCache);
 
@@ -1191,7 +1322,16 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
 
 void PipelineStateVkImpl::Destruct()
 {
+    if (m_OptimizedPipelineTask)
+    {
+        // The task references the pipeline object
+        m_OptimizedPipelineTask->Cancel();
+        m_OptimizedPipelineTask->WaitForCompletion();
+        m_OptimizedPipelineTask.Release();
+    }
+
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.ImmediateContextMask);
+    m_pDevice->SafeReleaseDeviceObject(std::move(m_OptimizedPipeline), m_Desc.ImmediateContextMask);
     m_PipelineLayout.Release(m_pDevice, m_Desc.ImmediateContextMask);
 
     TPipelineStateBase::Destruct();
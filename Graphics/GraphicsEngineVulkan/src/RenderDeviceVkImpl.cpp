@@ -156,6 +156,11 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         m_ImplicitRenderPassCache = std::make_unique<RenderPassCache>(*this);
     }
 
+    if (m_LogicalDevice->GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE)
+    {
+        m_PipelineLibraryCache = std::make_unique<PipelineLibraryCacheVk>(*this);
+    }
+
     static_assert(sizeof(VulkanDescriptorPoolSize) == sizeof(Uint32) * 11, "Please add new descriptors to m_DescriptorSetAllocator and m_DynamicDescriptorPool constructors");
 
     const uint32_t vkVersion = m_PhysicalDevice->GetVkVersion();
@@ -283,6 +288,7 @@ void RenderDeviceVkImpl::AllocateTransientCmdPool(SoftwareQueueIndex
     DEV_CHECK_ERR(err == VK_SUCCESS, "vkBeginCommandBuffer() failed");
     (void)err;
 
+    CmdBuffer.SetUseSynchronization2(UseSynchronization2());
     CmdBuffer.SetVkCmdBuffer(vkCmdBuff,
                              m_LogicalDevice->GetSupportedStagesMask(QueueFamilyIndex),
                              m_LogicalDevice->GetSupportedAccessMask(QueueFamilyIndex));
@@ -323,14 +329,24 @@ void RenderDeviceVkImpl::ExecuteAndDisposeTransientCmdBuff(SoftwareQueueIndex
     //              |            |    F < SubmittedFenceValue==F+1        |                                      |
     //
     // Since transient command buffers do not count as real command buffers, submit them directly to the queue
-    // to avoid interference with the command buffer counter
-    Uint64 FenceValue = 0;
+    // to avoid interference with the command buffer counter.
+    // The submission is enqueued while the queue is locked, but the thread waits for it outside of the lock,
+    // so that transient command buffers submitted by multiple threads are batched (see CommandQueueVkImpl).
+    VkSubmitInfo SubmitInfo{};
+    SubmitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    SubmitInfo.commandBufferCount = 1;
+    SubmitInfo.pCommandBuffers    = &vkCmdBuff;
+
+    CommandQueueVkImpl::PendingSubmission Submission{SubmitInfo};
+    CommandQueueVkImpl*                   pQueueVk = nullptr;
     LockCmdQueueAndRun(CommandQueueId,
                        [&](ICommandQueueVk* pCmdQueueVk) //
                        {
-                           FenceValue = pCmdQueueVk->SubmitCmdBuffer(vkCmdBuff);
+                           pQueueVk = ClassPtrCast<CommandQueueVkImpl>(pCmdQueueVk);
+                           pQueueVk->EnqueueSubmission(Submission);
                        } //
     );
+    const Uint64 FenceValue = pQueueVk->WaitSubmission(Submission);
 
     class TransientCmdPoolRecycler
     {
@@ -410,15 +426,28 @@ void RenderDeviceVkImpl::SubmitCommandBuffer(SoftwareQueueIndex
                                              std::vector<std::pair<Uint64, RefCntAutoPtr<FenceVkImpl>>>* pSignalFences           // List of fences to signal
 )
 {
-    // Submit the command list to the queue
-    SubmittedCommandBufferInfo CmbBuffInfo = TRenderDeviceBase::SubmitCommandBuffer(CommandQueueId, true, SubmitInfo);
-    SubmittedFenceValue                    = CmbBuffInfo.FenceValue;
-    SubmittedCmdBuffNumber                 = CmbBuffInfo.CmdBufferNumber;
+    // Submit the command list to the queue.
+    // This is the same as TRenderDeviceBase::SubmitCommandBuffer(), except that the queue is only locked to
+    // assign the command buffer number and enqueue the submission in the same order. The thread waits for
+    // the submission outside of the lock, so that command buffers submitted by multiple threads are batched.
+    CommandQueue&       Queue    = m_CommandQueues[CommandQueueId];
+    CommandQueueVkImpl* pQueueVk = Queue.CmdQueue.RawPtr<CommandQueueVkImpl>();
+
+    CommandQueueVkImpl::PendingSubmission Submission{SubmitInfo};
+    {
+        std::lock_guard<std::mutex> Lock{Queue.Mtx};
+        SubmittedCmdBuffNumber = Queue.NextCmdBufferNumber.fetch_add(1);
+        pQueueVk->EnqueueSubmission(Submission);
+    }
+    SubmittedFenceValue = pQueueVk->WaitSubmission(Submission);
+
+    // Move stale objects into the release queue, see TRenderDeviceBase::SubmitCommandBuffer()
+    Queue.ReleaseQueue.DiscardStaleResources(SubmittedCmdBuffNumber, SubmittedFenceValue);
 
     if (pSignalFences != nullptr && !pSignalFences->empty())
     {
-        CommandQueueVkImpl* pQueue     = m_CommandQueues[CommandQueueId].CmdQueue.RawPtr<CommandQueueVkImpl>();
-        SyncPointVkPtr      pSyncPoint = pQueue->GetLastSyncPoint();
+        // Note that the last sync point may belong to a later batch, which is safe as it is signaled after this one
+        SyncPointVkPtr pSyncPoint = pQueueVk->GetLastSyncPoint();
 
         for (auto& val_fence : *pSignalFences)
         {
@@ -460,6 +489,7 @@ void RenderDeviceVkImpl::FlushStaleResources(SoftwareQueueIndex CmdQueueIndex)
 
 void RenderDeviceVkImpl::ReleaseStaleResources(bool ForceRelease)
 {
+    UpdateMemoryBudget();
     m_MemoryMgr.ShrinkMemory();
     PurgeReleaseQueues(ForceRelease);
 }
@@ -839,4 +869,103 @@ void RenderDeviceVkImpl::GetDeviceFeaturesVk(DeviceFeaturesVk& FeaturesVk) const
     FeaturesVk = PhysicalDeviceFeaturesToDeviceFeaturesVk(m_LogicalDevice->GetEnabledExtFeatures());
 }
 
+void RenderDeviceVkImpl::GetDynamicHeapChunkStats(Uint32& NumChunks, DynamicHeapChunkStatsVk* pStats) const
+{
+    const std::vector<VulkanDynamicMemoryManager::ChunkStats> ChunkStats = m_DynamicMemoryManager.GetChunkStats();
+    if (pStats == nullptr)
+    {
+        NumChunks = static_cast<Uint32>(ChunkStats.size());
+        return;
+    }
+
+    NumChunks = std::min(NumChunks, static_cast<Uint32>(ChunkStats.size()));
+    for (Uint32 i = 0; i < NumChunks; ++i)
+    {
+        const VulkanDynamicMemoryManager::ChunkStats& Src = ChunkStats[i];
+
+        DynamicHeapChunkStatsVk& Dst = pStats[i];
+        Dst.Index                    = Src.Index;
+        Dst.IsResident               = Src.IsResident;
+        Dst.Size                     = Src.Size;
+        Dst.UsedSize                 = Src.UsedSize;
+        Dst.PeakUsedSize             = Src.PeakUsedSize;
+    }
+}
+
+void RenderDeviceVkImpl::GetMemoryHeapBudget(Uint32 HeapIndex, MemoryHeapBudgetVk& Budget) const
+{
+    const VkMemoryHeap&                              vkHeap     = m_PhysicalDevice->GetMemoryProperties().memoryHeaps[HeapIndex];
+    const VulkanUtilities::MemoryManager::HeapBudget HeapBudget = m_MemoryMgr.GetHeapBudget(HeapIndex);
+
+    Budget.Size            = vkHeap.size;
+    Budget.Budget          = HeapBudget.Budget;
+    Budget.Usage           = HeapBudget.Usage;
+    Budget.EngineAllocated = HeapBudget.Allocated;
+    Budget.Flags           = vkHeap.flags;
+}
+
+void RenderDeviceVkImpl::GetMemoryBudget(MemoryBudgetVk& Budget)
+{
+    static_assert(MAX_MEMORY_HEAPS_VK == VK_MAX_MEMORY_HEAPS, "MAX_MEMORY_HEAPS_VK must be equal to VK_MAX_MEMORY_HEAPS");
+
+    m_MemoryMgr.UpdateMemoryBudget();
+
+    Budget                = {};
+    Budget.NumHeaps       = m_PhysicalDevice->GetMemoryProperties().memoryHeapCount;
+    Budget.DriverReported = m_MemoryMgr.IsMemoryBudgetReported();
+    for (Uint32 HeapIndex = 0; HeapIndex < Budget.NumHeaps; ++HeapIndex)
+        GetMemoryHeapBudget(HeapIndex, Budget.Heaps[HeapIndex]);
+}
+
+void RenderDeviceVkImpl::SetMemoryBudgetCallback(MemoryBudgetCallbackVkType Callback, void* pUserData, float Threshold)
+{
+    DEV_CHECK_ERR(Callback == nullptr || (Threshold > 0 && Threshold <= 1), "Memory budget threshold (", Threshold, ") must be in (0, 1] range");
+
+    std::lock_guard<std::mutex> Lock{m_MemoryBudgetCallbackMtx};
+    m_MemoryBudgetCallback.Callback  = Callback;
+    m_MemoryBudgetCallback.pUserData = pUserData;
+    m_MemoryBudgetCallback.Threshold = Threshold;
+    // Notify the application about the heaps that are already above the threshold
+    m_MemoryBudgetCallback.HeapsAboveThresholdMask = 0;
+}
+
+void RenderDeviceVkImpl::UpdateMemoryBudget()
+{
+    m_MemoryMgr.UpdateMemoryBudget();
+
+    std::array<MemoryHeapBudgetVk, VK_MAX_MEMORY_HEAPS> HeapBudgets{};
+
+    Uint32                   NotifyHeapMask = 0;
+    MemoryBudgetCallbackInfo CallbackInfo;
+    {
+        std::lock_guard<std::mutex> Lock{m_MemoryBudgetCallbackMtx};
+        if (m_MemoryBudgetCallback.Callback == nullptr)
+            return;
+
+        const Uint32 NumHeaps = m_PhysicalDevice->GetMemoryProperties().memoryHeapCount;
+
+        Uint32 HeapsAboveThresholdMask = 0;
+        for (Uint32 HeapIndex = 0; HeapIndex < NumHeaps; ++HeapIndex)
+        {
+            MemoryHeapBudgetVk& Budget = HeapBudgets[HeapIndex];
+            GetMemoryHeapBudget(HeapIndex, Budget);
+            if (Budget.Budget > 0 && static_cast<double>(Budget.Usage) >= static_cast<double>(Budget.Budget) * m_MemoryBudgetCallback.Threshold)
+                HeapsAboveThresholdMask |= 1u << HeapIndex;
+        }
+
+        NotifyHeapMask = HeapsAboveThresholdMask & ~m_MemoryBudgetCallback.HeapsAboveThresholdMask;
+
+        m_MemoryBudgetCallback.HeapsAboveThresholdMask = HeapsAboveThresholdMask;
+        CallbackInfo                                   = m_MemoryBudgetCallback;
+    }
+
+    // Invoke the callback outside of the lock
+    while (NotifyHeapMask != 0)
+    {
+        const Uint32 HeapIndex = PlatformMisc::GetLSB(NotifyHeapMask);
+        NotifyHeapMask &= ~(1u << HeapIndex);
+        CallbackInfo.Callback(HeapIndex, &HeapBudgets[HeapIndex], CallbackInfo.pUserData);
+    }
+}
+
 } // namespace Diligent
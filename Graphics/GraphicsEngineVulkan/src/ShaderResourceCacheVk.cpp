@@ -41,22 +41,36 @@
 namespace Diligent
 {
 
-size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32        NumSets,
-                                                    const Uint32* SetSizes,
-                                                    Uint32        TotalInlineConstants)
+static size_t GetTotalDescriptorDataSize(Uint32 NumSets, const DescriptorBufferSetLayoutVk* DescrBufferLayouts)
+{
+    size_t DataSize = 0;
+    if (DescrBufferLayouts != nullptr)
+    {
+        for (Uint32 t = 0; t < NumSets; ++t)
+            DataSize += DescrBufferLayouts[t].GetDataSize();
+    }
+    return DataSize;
+}
+
+size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32                             NumSets,
+                                                    const Uint32*                      SetSizes,
+                                                    Uint32                             TotalInlineConstants,
+                                                    const DescriptorBufferSetLayoutVk* DescrBufferLayouts)
 {
     Uint32 TotalResources = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
         TotalResources += SetSizes[t];
 
     size_t MemorySize = NumSets * sizeof(DescriptorSet) + TotalResources * sizeof(Resource) + TotalInlineConstants * sizeof(Uint32);
+    MemorySize += GetTotalDescriptorDataSize(NumSets, DescrBufferLayouts);
     return MemorySize;
 }
 
-void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator,
-                                           Uint32            NumSets,
-                                           const Uint32*     SetSizes,
-                                           Uint32            TotalInlineConstants)
+void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator&                  MemAllocator,
+                                           Uint32                             NumSets,
+                                           const Uint32*                      SetSizes,
+                                           Uint32                             TotalInlineConstants,
+                                           const DescriptorBufferSetLayoutVk* DescrBufferLayouts)
 {
     VERIFY(!m_pMemory, "Memory has already been allocated");
 
@@ -65,10 +79,11 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator,
     //  m_pMemory
     //  |
     //  V
-    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  | Inline constant values ||
+    // ||  DescriptorSet[0]  |   ....    |  DescriptorSet[Ns-1]  |  Res[0]  |  ... |  Res[n-1]  |    ....     | Res[0]  |  ... |  Res[m-1]  | Inline constant values | Set data[0] | ... | Set data[Ns-1] ||
     //
     //
     //  Ns = m_NumSets
+    //  Set data is only allocated when descriptor buffers are used
 
     m_NumSets = static_cast<Uint16>(NumSets);
     VERIFY(m_NumSets == NumSets, "NumSets (", NumSets, ") exceed maximum representable value");
@@ -80,8 +95,9 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator,
         m_TotalResources += SetSizes[t];
     }
 
-    const size_t MemorySize = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource) + TotalInlineConstants * sizeof(Uint32);
-    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes, TotalInlineConstants));
+    const size_t DescriptorDataSize = GetTotalDescriptorDataSize(NumSets, DescrBufferLayouts);
+    const size_t MemorySize         = NumSets * sizeof(DescriptorSet) + m_TotalResources * sizeof(Resource) + TotalInlineConstants * sizeof(Uint32) + DescriptorDataSize;
+    VERIFY_EXPR(MemorySize == GetRequiredMemorySize(NumSets, SetSizes, TotalInlineConstants, DescrBufferLayouts));
 #ifdef DILIGENT_DEBUG
     m_DbgInitializedResources.resize(m_NumSets);
     m_DbgAssignedInlineConstants.resize(TotalInlineConstants);
@@ -95,16 +111,29 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator,
         VERIFY((reinterpret_cast<size_t>(m_pMemory.get()) % std::max(alignof(DescriptorSet), alignof(Resource))) == 0, "Resource cache buffer is not properly aligned");
         memset(m_pMemory.get(), 0, MemorySize);
 
-        Resource* pCurrResPtr = GetFirstResourcePtr();
+        Resource* pCurrResPtr       = GetFirstResourcePtr();
+        Uint8*    pCurrDescrDataPtr = reinterpret_cast<Uint8*>(pCurrResPtr + m_TotalResources) + TotalInlineConstants * sizeof(Uint32);
         for (Uint32 t = 0; t < NumSets; ++t)
         {
-            new (&GetDescriptorSet(t)) DescriptorSet{SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr};
+            const DescriptorBufferSetLayoutVk* pDescrBufferLayout = DescrBufferLayouts != nullptr ? &DescrBufferLayouts[t] : nullptr;
+
+            Uint8* pDescriptorData = nullptr;
+            if (pDescrBufferLayout != nullptr)
+            {
+                VERIFY(pDescrBufferLayout->IsInitialized(), "Descriptor buffer layout of set ", t, " is not initialized");
+                pDescriptorData = pCurrDescrDataPtr;
+                pDescrBufferLayout->InitializeData(pDescriptorData);
+                pCurrDescrDataPtr += pDescrBufferLayout->GetDataSize();
+            }
+
+            new (&GetDescriptorSet(t)) DescriptorSet{SetSizes[t], SetSizes[t] > 0 ? pCurrResPtr : nullptr, pDescrBufferLayout, pDescriptorData};
             pCurrResPtr += SetSizes[t];
 #ifdef DILIGENT_DEBUG
             m_DbgInitializedResources[t].resize(SetSizes[t]);
 #endif
         }
-        VERIFY_EXPR(reinterpret_cast<Uint8*>(pCurrResPtr) + TotalInlineConstants * sizeof(Uint32) == reinterpret_cast<Uint8*>(m_pMemory.get()) + MemorySize);
+        VERIFY_EXPR(reinterpret_cast<Uint8*>(pCurrResPtr) + TotalInlineConstants * sizeof(Uint32) + DescriptorDataSize == reinterpret_cast<Uint8*>(m_pMemory.get()) + MemorySize);
+        VERIFY_EXPR(pCurrDescrDataPtr == reinterpret_cast<Uint8*>(m_pMemory.get()) + MemorySize);
     }
 
     m_HasInlineConstants = TotalInlineConstants > 0 ? 1 : 0;
@@ -358,6 +387,100 @@ void ShaderResourceCacheVk::Resource::SetStorageBuffer(RefCntAutoPtr<IDeviceObje
 #endif
 }
 
+// Writes the descriptor of the resource to the descriptor buffer set data.
+// BufferOffset is added to the address of uniform and storage buffers.
+static void WriteDescriptorToSetData(const VulkanUtilities::LogicalDevice&  LogicalDevice,
+                                     const DescriptorBufferSetLayoutVk&     Layout,
+                                     Uint32                                 CacheOffset,
+                                     const ShaderResourceCacheVk::Resource& Res,
+                                     Uint64                                 BufferOffset,
+                                     Uint8*                                 pSetData)
+{
+    VERIFY_EXPR(Res.pObject);
+
+    VkDescriptorGetInfoEXT GetInfo{};
+    GetInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    GetInfo.type  = DescriptorTypeToVkNonDynamicDescriptorType(Res.Type);
+
+    // Do not zero-initialize!
+    union
+    {
+        VkSampler                  vkSampler;
+        VkDescriptorImageInfo      vkDescrImageInfo;
+        VkDescriptorAddressInfoEXT vkDescrAddressInfo;
+    };
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::Sampler:
+            vkSampler             = Res.GetSamplerDescriptorWriteInfo().sampler;
+            GetInfo.data.pSampler = &vkSampler;
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+            vkDescrImageInfo = Res.GetImageDescriptorWriteInfo();
+            if (Res.HasImmutableSampler)
+            {
+                // Unlike descriptor sets, immutable samplers must be explicitly provided
+                vkDescrImageInfo.sampler = Layout.GetImmutableSampler(CacheOffset);
+            }
+            GetInfo.data.pCombinedImageSampler = &vkDescrImageInfo;
+            break;
+
+        case DescriptorType::SeparateImage:
+            vkDescrImageInfo           = Res.GetImageDescriptorWriteInfo();
+            GetInfo.data.pSampledImage = &vkDescrImageInfo;
+            break;
+
+        case DescriptorType::StorageImage:
+            vkDescrImageInfo           = Res.GetImageDescriptorWriteInfo();
+            GetInfo.data.pStorageImage = &vkDescrImageInfo;
+            break;
+
+        case DescriptorType::UniformTexelBuffer:
+            vkDescrAddressInfo               = Res.GetTexelBufferAddressInfo();
+            GetInfo.data.pUniformTexelBuffer = &vkDescrAddressInfo;
+            break;
+
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            vkDescrAddressInfo               = Res.GetTexelBufferAddressInfo();
+            GetInfo.data.pStorageTexelBuffer = &vkDescrAddressInfo;
+            break;
+
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            vkDescrAddressInfo          = Res.GetUniformBufferAddressInfo(BufferOffset);
+            GetInfo.data.pUniformBuffer = &vkDescrAddressInfo;
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+            vkDescrAddressInfo          = Res.GetStorageBufferAddressInfo(BufferOffset);
+            GetInfo.data.pStorageBuffer = &vkDescrAddressInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            vkDescrImageInfo                   = Res.GetInputAttachmentDescriptorWriteInfo();
+            GetInfo.data.pInputAttachmentImage = &vkDescrImageInfo;
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            GetInfo.data.accelerationStructure = Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+            break;
+
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return;
+    }
+
+    Layout.WriteDescriptor(LogicalDevice, CacheOffset, GetInfo, pSetData);
+}
+
 const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     const VulkanUtilities::LogicalDevice* pLogicalDevice,
     Uint32                                DescrSetIndex,
@@ -398,6 +521,31 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
         ++m_NumDynamicBuffers;
     }
 
+    if (DescrSet.m_pDescriptorData != nullptr)
+    {
+        VERIFY_EXPR(DescrSet.GetVkDescriptorSet() == VK_NULL_HANDLE);
+
+        // Descriptors of buffers bound to dynamic descriptors depend on the dynamic offsets and
+        // are written by WriteDescriptorBufferData() when the set is committed.
+        // Immutable sampler descriptors are written when the set data is initialized.
+        const bool SkipDescriptor =
+            IsDynamicDescriptorType(DstRes.Type) ||
+            (DstRes.Type == DescriptorType::Sampler && DstRes.HasImmutableSampler);
+        if (!SkipDescriptor)
+        {
+            const DescriptorBufferSetLayoutVk& Layout = *DescrSet.m_pDescrBufferLayout;
+            if (DstRes.pObject)
+            {
+                VERIFY(pLogicalDevice != nullptr, "Logical device must not be null to write descriptor to the set data");
+                WriteDescriptorToSetData(*pLogicalDevice, Layout, CacheOffset, DstRes, 0, DescrSet.m_pDescriptorData);
+            }
+            else
+            {
+                Layout.ClearDescriptor(CacheOffset, DescrSet.m_pDescriptorData);
+            }
+        }
+    }
+
     VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
     if (vkSet != VK_NULL_HANDLE && DstRes.pObject)
     {
@@ -940,11 +1088,60 @@ VkWriteDescriptorSetAccelerationStructureKHR ShaderResourceCacheVk::Resource::Ge
     return DescrAS;
 }
 
+VkDescriptorAddressInfoEXT ShaderResourceCacheVk::Resource::GetUniformBufferAddressInfo(Uint64 BufferOffset) const
+{
+    // Reuse the validation in GetUniformBufferDescriptorWriteInfo()
+    const VkDescriptorBufferInfo DescrBuffInfo = GetUniformBufferDescriptorWriteInfo();
+    const BufferVkImpl*          pBuffVk       = pObject.ConstPtr<BufferVkImpl>();
+
+    VkDescriptorAddressInfoEXT AddressInfo{};
+    AddressInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    AddressInfo.address = pBuffVk->GetVkDeviceAddress() + DescrBuffInfo.offset + BufferOffset;
+    AddressInfo.range   = DescrBuffInfo.range;
+    AddressInfo.format  = VK_FORMAT_UNDEFINED;
+    return AddressInfo;
+}
+
+VkDescriptorAddressInfoEXT ShaderResourceCacheVk::Resource::GetStorageBufferAddressInfo(Uint64 BufferOffset) const
+{
+    const VkDescriptorBufferInfo DescrBuffInfo = GetStorageBufferDescriptorWriteInfo();
+    const BufferVkImpl*          pBuffVk       = pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+
+    VkDescriptorAddressInfoEXT AddressInfo{};
+    AddressInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    AddressInfo.address = pBuffVk->GetVkDeviceAddress() + DescrBuffInfo.offset + BufferOffset;
+    AddressInfo.range   = DescrBuffInfo.range;
+    AddressInfo.format  = VK_FORMAT_UNDEFINED;
+    return AddressInfo;
+}
+
+VkDescriptorAddressInfoEXT ShaderResourceCacheVk::Resource::GetTexelBufferAddressInfo() const
+{
+    VERIFY((Type == DescriptorType::UniformTexelBuffer ||
+            Type == DescriptorType::StorageTexelBuffer ||
+            Type == DescriptorType::StorageTexelBuffer_ReadOnly),
+           "Uniform or storage texel buffer resource is expected");
+    DEV_CHECK_ERR(pObject != nullptr, "Unable to get texel buffer address info: cached object is null");
+
+    const BufferViewVkImpl* pBuffViewVk = pObject.ConstPtr<BufferViewVkImpl>();
+    const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+    const BufferVkImpl*     pBuffVk     = pBuffViewVk->GetBuffer<const BufferVkImpl>();
+
+    VkDescriptorAddressInfoEXT AddressInfo{};
+    AddressInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+    AddressInfo.address = pBuffVk->GetVkDeviceAddress() + ViewDesc.ByteOffset;
+    AddressInfo.range   = ViewDesc.ByteWidth;
+    // Must match the format of the buffer view, see BufferVkImpl::CreateView()
+    AddressInfo.format = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+    return AddressInfo;
+}
+
 
 
 ShaderResourceCacheVk::WriteDynamicBufferOffsetsResult ShaderResourceCacheVk::WriteDynamicBufferOffsets(
     DeviceContextVkImpl*   pCtx,
     std::vector<uint32_t>& Offsets,
+    std::vector<Uint32>&   Chunks,
     Uint32                 StartInd) const
 {
     WriteDynamicBufferOffsetsResult Result;
@@ -961,14 +1158,21 @@ ShaderResourceCacheVk::WriteDynamicBufferOffsetsResult ShaderResourceCacheVk::Wr
     // (DescriptorType::StorageBufferDynamic and DescriptorType::StorageBufferDynamic_ReadOnly) for every shader stage,
     // followed by all other resources.
     Uint32 OffsetInd = StartInd;
+    Uint32 SetBit    = 0;
+
+    VERIFY_EXPR(Chunks.size() == Offsets.size());
 
     auto WriteOffset = [&](const BufferVkImpl* pBufferVk, Uint32 BufferDynamicOffset) {
         // Do not verify dynamic allocation here as there may be some buffers that are not used by the PSO.
         // The allocations of the buffers that are actually used will be verified by
         // PipelineResourceSignatureVkImpl::DvpValidateCommittedResource().
-        Uint32 Offset = (pBufferVk != nullptr) ?
-            StaticCast<Uint32>(pCtx->GetDynamicBufferOffset(pBufferVk, /*VerifyAllocation = */ false)) :
-            0;
+        const VulkanDynamicAllocation* pAllocation = (pBufferVk != nullptr) ?
+            pCtx->GetDynamicBufferAllocation(pBufferVk) :
+            nullptr;
+
+        Uint32 Offset = (pAllocation != nullptr) ? StaticCast<Uint32>(pAllocation->AlignedOffset) : 0;
+        // Buffers with backing resource and buffers that have not been mapped use the primary chunk
+        const Uint32 Chunk = (pAllocation != nullptr) ? pAllocation->pChunk->GetIndex() : 0;
 
         // The effective offset used for dynamic uniform and storage buffer bindings is the sum of the relative
         // offset taken from pDynamicOffsets, and the base address of the buffer plus base offset in the descriptor set.
@@ -976,11 +1180,19 @@ ShaderResourceCacheVk::WriteDynamicBufferOffsetsResult ShaderResourceCacheVk::Wr
         Offset += BufferDynamicOffset;
 
         Result.NumOffsetsChanged += (Offsets[OffsetInd] != Offset) ? 1 : 0;
-        Offsets[OffsetInd++] = Offset;
+        Result.NumChunksChanged += (Chunks[OffsetInd] != Chunk) ? 1 : 0;
+        if (Chunk != 0)
+            Result.OverflowSetMask |= SetBit;
+
+        Offsets[OffsetInd] = Offset;
+        Chunks[OffsetInd]  = Chunk;
+        ++OffsetInd;
     };
 
     for (Uint32 set = 0; set < m_NumSets; ++set)
     {
+        SetBit = 1u << set;
+
         const DescriptorSet& DescrSet = GetDescriptorSet(set);
         const Uint32         SetSize  = DescrSet.GetSize();
 
@@ -1028,6 +1240,44 @@ ShaderResourceCacheVk::WriteDynamicBufferOffsetsResult ShaderResourceCacheVk::Wr
     return Result;
 }
 
+void ShaderResourceCacheVk::WriteDescriptorBufferData(DeviceContextVkImpl* pCtx,
+                                                      Uint32               SetIndex,
+                                                      Uint8*               pDstData) const
+{
+    const DescriptorSet& DescrSet = GetDescriptorSet(SetIndex);
+    VERIFY(DescrSet.m_pDescriptorData != nullptr && DescrSet.m_pDescrBufferLayout != nullptr,
+           "Descriptor data is only available when descriptor buffers are used");
+
+    const DescriptorBufferSetLayoutVk& Layout = *DescrSet.m_pDescrBufferLayout;
+    memcpy(pDstData, DescrSet.m_pDescriptorData, Layout.GetDataSize());
+
+    const VulkanUtilities::LogicalDevice& LogicalDevice = pCtx->GetDevice()->GetLogicalDevice();
+
+    // Similar to dynamic offsets, all buffers bound to dynamic descriptors go first in each set,
+    // see WriteDynamicBufferOffsets().
+    const Uint32 SetSize = DescrSet.GetSize();
+    for (Uint32 res = 0; res < SetSize; ++res)
+    {
+        const Resource& Res = DescrSet.GetResource(res);
+        if (!IsDynamicDescriptorType(Res.Type))
+            break;
+
+        if (!Res.pObject)
+            continue;
+
+        const BufferVkImpl* pBufferVk = Res.Type == DescriptorType::UniformBufferDynamic ?
+            Res.pObject.ConstPtr<BufferVkImpl>() :
+            Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+
+        // Do not verify dynamic allocation here as there may be some buffers that are not used by the PSO.
+        // The offset is relative to the address of the buffer, which for dynamic buffers without backing resource
+        // is the address of the primary dynamic heap chunk (see BufferVkImpl::GetVkDeviceAddress()), while
+        // the data may have been allocated from an overflow chunk.
+        const Uint64 BufferOffset = pCtx->GetDynamicBufferDeviceAddress(pBufferVk) - pBufferVk->GetVkDeviceAddress() + Res.BufferDynamicOffset;
+        WriteDescriptorToSetData(LogicalDevice, Layout, res, Res, BufferOffset, pDstData);
+    }
+}
+
 
 void ShaderResourceCacheVk::SetInlineConstants(Uint32      DescrSetIndex,
                                                Uint32      CacheOffset,
@@ -29,40 +29,38 @@
 
 #include "VulkanDynamicHeap.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
-#include "Atomics.hpp"
 #include "RenderDeviceVkImpl.hpp"
 
 namespace Diligent
 {
 
-static VkDeviceSize GetDefaultAlignment(const VulkanUtilities::PhysicalDevice& PhysicalDevice)
+VulkanDynamicMemoryChunk::VulkanDynamicMemoryChunk(IMemoryAllocator&   Allocator,
+                                                   RenderDeviceVkImpl& DeviceVk,
+                                                   Uint32              Size,
+                                                   Uint32              Index) :
+    // clang-format off
+    TBase     {Allocator, Size},
+    m_DeviceVk{DeviceVk},
+    m_Index   {Index}
+// clang-format on
 {
-    const VkPhysicalDeviceProperties& Props  = PhysicalDevice.GetProperties();
-    const VkPhysicalDeviceLimits&     Limits = Props.limits;
-    return std::max(std::max(Limits.minUniformBufferOffsetAlignment, Limits.minTexelBufferOffsetAlignment), Limits.minStorageBufferOffsetAlignment);
+    VERIFY((Size & (VulkanDynamicMemoryManager::MasterBlockAlignment - 1)) == 0, "Heap size (", Size, " is not aligned by the master block alignment (", Uint32{VulkanDynamicMemoryManager::MasterBlockAlignment}, ")");
+    Create();
 }
 
-VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Allocator,
-                                                       RenderDeviceVkImpl& DeviceVk,
-                                                       Uint32              Size,
-                                                       Uint64              CommandQueueMask) :
-    // clang-format off
-    TBase             {Allocator, Size},
-    m_DeviceVk        {DeviceVk},
-    m_DefaultAlignment{GetDefaultAlignment(DeviceVk.GetPhysicalDevice())},
-    m_CommandQueueMask{CommandQueueMask}
-// clang-format on
+void VulkanDynamicMemoryChunk::Create()
 {
-    VERIFY((Size & (MasterBlockAlignment - 1)) == 0, "Heap size (", Size, " is not aligned by the master block alignment (", Uint32{MasterBlockAlignment}, ")");
+    VERIFY(!IsResident(), "The chunk has already been created");
 
     VkBufferCreateInfo VkBuffCI{};
     VkBuffCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     VkBuffCI.pNext = nullptr;
     VkBuffCI.flags = 0; // VK_BUFFER_CREATE_SPARSE_BINDING_BIT, VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT, VK_BUFFER_CREATE_SPARSE_ALIASED_BIT
-    VkBuffCI.size  = Size;
+    VkBuffCI.size  = GetSize();
     VkBuffCI.usage =
         VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
         VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
@@ -70,21 +68,54 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
         VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
         VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
         VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    if (m_DeviceVk.UseDescriptorBuffers())
+    {
+        // Descriptors of dynamic buffers are written using their device addresses, and
+        // dynamic buffers may be allocated from any chunk.
+        VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+    if (m_Index == 0 && m_DeviceVk.UseDescriptorBuffers())
+    {
+        // The primary chunk is bound as the descriptor buffer: descriptor set data is
+        // written to the dynamic heap when shader resources are committed.
+        const VkPhysicalDeviceDescriptorBufferPropertiesEXT& DescrBuffProps = m_DeviceVk.GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+
+        const VkDeviceSize MaxDescrBufferRange = std::min({DescrBuffProps.maxResourceDescriptorBufferRange,
+                                                           DescrBuffProps.maxSamplerDescriptorBufferRange,
+                                                           DescrBuffProps.descriptorBufferAddressSpaceSize});
+        if (GetSize() > MaxDescrBufferRange)
+        {
+            LOG_ERROR_AND_THROW("Dynamic heap size (", GetSize(), ") exceeds the maximum descriptor buffer range (", MaxDescrBufferRange,
+                                ") supported by the device. Reduce EngineVkCreateInfo::DynamicHeapSize or disable the DescriptorBuffer feature.");
+        }
+
+        VkBuffCI.usage |=
+            VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT |
+            VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT;
+    }
     VkBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
     VkBuffCI.queueFamilyIndexCount = 0;
     VkBuffCI.pQueueFamilyIndices   = nullptr;
 
-    const VulkanUtilities::LogicalDevice& LogicalDevice = DeviceVk.GetLogicalDevice();
-    m_VkBuffer                                          = LogicalDevice.CreateBuffer(VkBuffCI, "Dynamic heap buffer");
+    const VulkanUtilities::LogicalDevice& LogicalDevice = m_DeviceVk.GetLogicalDevice();
+    m_VkBuffer                                          = LogicalDevice.CreateBuffer(VkBuffCI, m_Index == 0 ? "Dynamic heap buffer" : "Dynamic heap overflow buffer");
     VkMemoryRequirements MemReqs                        = LogicalDevice.GetBufferMemoryRequirements(m_VkBuffer);
 
-    const VulkanUtilities::PhysicalDevice& PhysicalDevice = DeviceVk.GetPhysicalDevice();
+    const VulkanUtilities::PhysicalDevice& PhysicalDevice = m_DeviceVk.GetPhysicalDevice();
 
     VkMemoryAllocateInfo MemAlloc{};
     MemAlloc.pNext          = nullptr;
     MemAlloc.sType          = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize = MemReqs.size;
 
+    VkMemoryAllocateFlagsInfo FlagsInfo{};
+    if (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+    {
+        FlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        FlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        MemAlloc.pNext  = &FlagsInfo;
+    }
+
     // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
     // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
     // to the host (10.2)
@@ -112,48 +143,118 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
     err = LogicalDevice.BindBufferMemory(m_VkBuffer, m_BufferMemory, 0 /*offset*/);
     CHECK_VK_ERROR_AND_THROW(err, "Failed to bind buffer memory");
 
-    LOG_INFO_MESSAGE("GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
+    m_DeviceAddress = (VkBuffCI.usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT) != 0 ?
+        LogicalDevice.GetBufferDeviceAddress(m_VkBuffer) :
+        0;
+
+    m_IdleFrameCount = 0;
 }
 
-void VulkanDynamicMemoryManager::Destroy()
+void VulkanDynamicMemoryChunk::Destroy(Uint64 CmdQueueMask)
 {
     if (m_VkBuffer)
     {
         m_DeviceVk.GetLogicalDevice().UnmapMemory(m_BufferMemory);
-        m_DeviceVk.SafeReleaseDeviceObject(std::move(m_VkBuffer), m_CommandQueueMask);
-        m_DeviceVk.SafeReleaseDeviceObject(std::move(m_BufferMemory), m_CommandQueueMask);
+        m_DeviceVk.SafeReleaseDeviceObject(std::move(m_VkBuffer), CmdQueueMask);
+        m_DeviceVk.SafeReleaseDeviceObject(std::move(m_BufferMemory), CmdQueueMask);
     }
-    m_CPUAddress = nullptr;
+    m_CPUAddress    = nullptr;
+    m_DeviceAddress = 0;
 }
 
-VulkanDynamicMemoryManager::~VulkanDynamicMemoryManager()
+VulkanDynamicMemoryChunk::~VulkanDynamicMemoryChunk()
 {
     VERIFY(m_BufferMemory == VK_NULL_HANDLE && m_VkBuffer == VK_NULL_HANDLE, "Vulkan resources must be explicitly released with Destroy()");
-    OffsetType Size          = GetSize();
-    OffsetType TotalPeakSize = m_TotalPeakSize.load(std::memory_order_relaxed);
-    LOG_INFO_MESSAGE("Dynamic memory manager usage stats:\n"
-                     "                       Total size: ",
-                     FormatMemorySize(Size, 2),
-                     ". Peak allocated size: ", FormatMemorySize(TotalPeakSize, 2, Size),
-                     ". Peak utilization: ",
-                     std::fixed, std::setprecision(1), static_cast<double>(TotalPeakSize) / static_cast<double>(std::max(Size, size_t{1})) * 100.0, '%');
 }
 
+VulkanDynamicMemoryChunk::MasterBlock VulkanDynamicMemoryChunk::TryAllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment)
+{
+    VERIFY(IsResident(), "Allocating master block from a chunk that has been destroyed");
+    return TBase::AllocateMasterBlock(SizeInBytes, Alignment);
+}
 
-VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment)
+
+VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Allocator,
+                                                       RenderDeviceVkImpl& DeviceVk,
+                                                       Uint32              Size,
+                                                       Uint64              CommandQueueMask) :
+    // clang-format off
+    m_Allocator       {Allocator},
+    m_DeviceVk        {DeviceVk},
+    m_CommandQueueMask{CommandQueueMask},
+    m_PrimaryChunk    {Allocator, DeviceVk, Size, 0}
+// clang-format on
 {
-    if (Alignment == 0)
-        Alignment = MasterBlockAlignment;
+    LOG_INFO_MESSAGE("GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
+}
 
-    if (SizeInBytes > GetSize())
+void VulkanDynamicMemoryManager::Destroy()
+{
+    m_PrimaryChunk.Destroy(m_CommandQueueMask);
+
+    std::lock_guard<std::mutex> Lock{m_OverflowChunksMtx};
+    for (std::unique_ptr<VulkanDynamicMemoryChunk>& pChunk : m_OverflowChunks)
+        pChunk->Destroy(m_CommandQueueMask);
+    m_NumResidentOverflowChunks.store(0);
+}
+
+VulkanDynamicMemoryManager::~VulkanDynamicMemoryManager()
+{
+    for (const ChunkStats& Stats : GetChunkStats())
     {
-        LOG_ERROR("Requested dynamic allocation size ", SizeInBytes,
-                  " exceeds maximum dynamic memory size ", GetSize(),
-                  ". The app should increase dynamic heap size.");
-        return MasterBlock{};
+        LOG_INFO_MESSAGE("Dynamic memory manager ", (Stats.Index == 0 ? "primary chunk" : "overflow chunk "), (Stats.Index == 0 ? "" : std::to_string(Stats.Index)),
+                         " usage stats:\n"
+                         "                       Total size: ",
+                         FormatMemorySize(Stats.Size, 2),
+                         ". Peak allocated size: ", FormatMemorySize(Stats.PeakUsedSize, 2, Stats.Size),
+                         ". Peak utilization: ",
+                         std::fixed, std::setprecision(1), static_cast<double>(Stats.PeakUsedSize) / static_cast<double>(std::max(Stats.Size, size_t{1})) * 100.0, '%');
     }
+    if (!m_OverflowChunks.empty())
+    {
+        LOG_INFO_MESSAGE("The dynamic heap overflowed into ", m_OverflowChunks.size(), (m_OverflowChunks.size() == 1 ? " additional chunk" : " additional chunks"),
+                         ". Consider increasing EngineVkCreateInfo::DynamicHeapSize.");
+    }
+}
+
+std::vector<VulkanDynamicMemoryManager::ChunkStats> VulkanDynamicMemoryManager::GetChunkStats() const
+{
+    auto GetStats = [](const VulkanDynamicMemoryChunk& Chunk) {
+        ChunkStats Stats;
+        Stats.Index        = Chunk.GetIndex();
+        Stats.Size         = Chunk.GetSize();
+        Stats.UsedSize     = Chunk.GetUsedSize();
+        Stats.PeakUsedSize = Chunk.GetPeakUsedSize();
+        Stats.IsResident   = Chunk.IsResident();
+        return Stats;
+    };
+
+    std::lock_guard<std::mutex> Lock{m_OverflowChunksMtx};
+
+    std::vector<ChunkStats> Stats;
+    Stats.reserve(1 + m_OverflowChunks.size());
+    Stats.emplace_back(GetStats(m_PrimaryChunk));
+    for (const std::unique_ptr<VulkanDynamicMemoryChunk>& pChunk : m_OverflowChunks)
+        Stats.emplace_back(GetStats(*pChunk));
+
+    return Stats;
+}
+
+#ifdef DILIGENT_DEVELOPMENT
+Int32 VulkanDynamicMemoryManager::GetMasterBlockCounter()
+{
+    std::lock_guard<std::mutex> Lock{m_OverflowChunksMtx};
+
+    Int32 Counter = m_PrimaryChunk.GetMasterBlockCounter();
+    for (const std::unique_ptr<VulkanDynamicMemoryChunk>& pChunk : m_OverflowChunks)
+        Counter += pChunk->GetMasterBlockCounter();
+    return Counter;
+}
+#endif
 
-    MasterBlock Block = TBase::AllocateMasterBlock(SizeInBytes, Alignment);
+VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateFromPrimaryChunk(OffsetType SizeInBytes, OffsetType Alignment)
+{
+    MasterBlock Block = m_PrimaryChunk.TryAllocateMasterBlock(SizeInBytes, Alignment);
     if (!Block.IsValid())
     {
         // Allocation failed. Try to wait for GPU to finish pending frames to release some space
@@ -165,7 +266,7 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
         while (!Block.IsValid() && IdleDuration < MaxIdleDuration)
         {
             m_DeviceVk.PurgeReleaseQueues();
-            Block = TBase::AllocateMasterBlock(SizeInBytes, Alignment);
+            Block = m_PrimaryChunk.TryAllocateMasterBlock(SizeInBytes, Alignment);
             if (!Block.IsValid())
             {
                 std::this_thread::sleep_for(SleepPeriod);
@@ -180,7 +281,7 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
         {
             // Last resort - idle GPU (there seems to have been a driver bug at some point: vkQueueWaitIdle() would deadlock and never return)
             m_DeviceVk.IdleGPU();
-            Block = TBase::AllocateMasterBlock(SizeInBytes, Alignment);
+            Block = m_PrimaryChunk.TryAllocateMasterBlock(SizeInBytes, Alignment);
             if (!Block.IsValid())
             {
                 LOG_ERROR_MESSAGE("Space in dynamic heap is exhausted! After idling for ",
@@ -213,66 +314,229 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
         }
     }
 
-    if (Block.IsValid())
+    return Block;
+}
+
+VulkanDynamicMemoryManager::ChunkMasterBlock VulkanDynamicMemoryManager::AllocateFromOverflowChunk(OffsetType SizeInBytes, OffsetType Alignment)
+{
+    std::lock_guard<std::mutex> Lock{m_OverflowChunksMtx};
+
+    for (std::unique_ptr<VulkanDynamicMemoryChunk>& pChunk : m_OverflowChunks)
     {
-        AtomicMax(m_TotalPeakSize, GetUsedSize(), std::memory_order_relaxed);
+        if (!pChunk->IsResident() || pChunk->GetSize() < SizeInBytes)
+            continue;
+
+        MasterBlock Block = pChunk->TryAllocateMasterBlock(SizeInBytes, Alignment);
+        if (Block.IsValid())
+            return {pChunk.get(), std::move(Block)};
     }
 
-    return Block;
+    // All overflow chunks are full. Re-create a released chunk that is large enough or add a new one.
+    // Chunk objects are never deleted while the manager is alive because stale master blocks in the
+    // release queues keep references to them.
+    try
+    {
+        VulkanDynamicMemoryChunk* pChunk = nullptr;
+        for (std::unique_ptr<VulkanDynamicMemoryChunk>& pReleasedChunk : m_OverflowChunks)
+        {
+            if (!pReleasedChunk->IsResident() && pReleasedChunk->GetSize() >= SizeInBytes)
+            {
+                pReleasedChunk->Create();
+                pChunk = pReleasedChunk.get();
+                break;
+            }
+        }
+
+        if (pChunk == nullptr)
+        {
+            const Uint32 ChunkSize = static_cast<Uint32>(AlignUp(std::max(m_PrimaryChunk.GetSize(), SizeInBytes), OffsetType{MasterBlockAlignment}));
+            m_OverflowChunks.emplace_back(std::make_unique<VulkanDynamicMemoryChunk>(m_Allocator, m_DeviceVk, ChunkSize, static_cast<Uint32>(m_OverflowChunks.size() + 1)));
+            pChunk = m_OverflowChunks.back().get();
+        }
+        m_NumResidentOverflowChunks.fetch_add(1);
+
+        LOG_INFO_MESSAGE("Dynamic heap is exhausted. Created overflow chunk ", pChunk->GetIndex(), " (", FormatMemorySize(pChunk->GetSize(), 2), ").");
+
+        return {pChunk, pChunk->TryAllocateMasterBlock(SizeInBytes, Alignment)};
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to create dynamic heap overflow chunk");
+        return {};
+    }
+}
+
+VulkanDynamicMemoryManager::ChunkMasterBlock VulkanDynamicMemoryManager::AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment, bool AllowOverflow)
+{
+    if (Alignment == 0)
+        Alignment = MasterBlockAlignment;
+
+    if (!AllowOverflow && SizeInBytes > GetSize())
+    {
+        LOG_ERROR("Requested dynamic allocation size ", SizeInBytes,
+                  " exceeds maximum dynamic memory size ", GetSize(),
+                  ". The app should increase dynamic heap size.");
+        return {};
+    }
+
+    if (AllowOverflow)
+    {
+        // Try the primary chunk first without waiting for the GPU
+        if (SizeInBytes <= GetSize())
+        {
+            MasterBlock Block = m_PrimaryChunk.TryAllocateMasterBlock(SizeInBytes, Alignment);
+            if (Block.IsValid())
+                return {&m_PrimaryChunk, std::move(Block)};
+        }
+
+        ChunkMasterBlock Block = AllocateFromOverflowChunk(SizeInBytes, Alignment);
+        if (Block.IsValid() || SizeInBytes > GetSize())
+            return Block;
+
+        // Failed to create overflow chunk - fall back to waiting for space in the primary chunk
+    }
+
+    MasterBlock Block = AllocateFromPrimaryChunk(SizeInBytes, Alignment);
+    if (!Block.IsValid())
+        return {};
+
+    return {&m_PrimaryChunk, std::move(Block)};
 }
 
+void VulkanDynamicMemoryManager::ReleaseMasterBlocks(std::vector<ChunkMasterBlock>& Blocks, RenderDeviceVkImpl& Device, Uint64 CmdQueueMask)
+{
+    // Master blocks are typically allocated from the primary chunk, so release them in groups
+    // of consecutive blocks that belong to the same chunk.
+    std::vector<MasterBlock> ChunkBlocks;
+    for (size_t i = 0; i < Blocks.size();)
+    {
+        VulkanDynamicMemoryChunk* pChunk = Blocks[i].pChunk;
+        VERIFY_EXPR(pChunk != nullptr);
+
+        ChunkBlocks.clear();
+        for (; i < Blocks.size() && Blocks[i].pChunk == pChunk; ++i)
+            ChunkBlocks.emplace_back(std::move(Blocks[i].Block));
+
+        pChunk->ReleaseMasterBlocks(ChunkBlocks, Device, CmdQueueMask);
+    }
+
+    RetireIdleChunks();
+}
 
-VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 Alignment)
+void VulkanDynamicMemoryManager::RetireIdleChunks()
+{
+    if (m_NumResidentOverflowChunks.load() == 0)
+        return;
+
+    std::lock_guard<std::mutex> Lock{m_OverflowChunksMtx};
+    for (std::unique_ptr<VulkanDynamicMemoryChunk>& pChunk : m_OverflowChunks)
+    {
+        if (!pChunk->IsResident())
+            continue;
+
+        // Master blocks are returned to the chunk only after the GPU has finished using them,
+        // so the chunk that has no allocated blocks is not referenced by any command buffer.
+        if (pChunk->GetUsedSize() != 0)
+        {
+            pChunk->m_IdleFrameCount = 0;
+            continue;
+        }
+
+        if (++pChunk->m_IdleFrameCount >= OverflowChunkRetireFrames)
+        {
+            pChunk->Destroy(m_CommandQueueMask);
+            m_NumResidentOverflowChunks.fetch_sub(1);
+        }
+    }
+}
+
+
+Uint32 VulkanDynamicHeap::GetMasterBlockCacheBatchSize(const VulkanDynamicMemoryManager& DynamicMemMgr, Uint32 PageSize)
+{
+    // Every context may keep up to one batch of unused pages, so limit the batch
+    // to a small fraction of the primary chunk to not starve other contexts.
+    constexpr Uint32 MaxBatchSize = 4;
+    const size_t     MaxPages     = DynamicMemMgr.GetSize() / (size_t{PageSize} * 16);
+    return static_cast<Uint32>(std::min(std::max(MaxPages, size_t{1}), size_t{MaxBatchSize}));
+}
+
+VulkanDynamicHeap::OffsetType VulkanDynamicHeap::CurrentBlock::Allocate(Uint32 SizeInBytes, Uint32 Alignment, OffsetType& AlignedSize)
+{
+    if (Offset == InvalidOffset)
+        return InvalidOffset;
+
+    const OffsetType AlignedOffset = AlignUp(Offset, size_t{Alignment});
+    AlignedSize                    = SizeInBytes + (AlignedOffset - Offset);
+    if (AlignedSize > AvailableSize)
+        return InvalidOffset;
+
+    AvailableSize -= static_cast<Uint32>(AlignedSize);
+    Offset += static_cast<Uint32>(AlignedSize);
+    return AlignedOffset;
+}
+
+VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 Alignment, bool AllowOverflow)
 {
     VERIFY_EXPR(Alignment > 0);
     VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be power of 2");
 
-    OffsetType AlignedOffset = InvalidOffset;
-    OffsetType AlignedSize   = 0;
+    VulkanDynamicMemoryChunk* pChunk        = nullptr;
+    OffsetType                AlignedOffset = InvalidOffset;
+    OffsetType                AlignedSize   = 0;
     if (SizeInBytes > m_MasterBlockSize / 2)
     {
         // Allocate directly from the memory manager
-        MasterBlock Block = m_GlobalDynamicMemMgr.AllocateMasterBlock(SizeInBytes, Alignment);
+        ChunkMasterBlock Block = m_GlobalDynamicMemMgr.AllocateMasterBlock(SizeInBytes, Alignment, AllowOverflow);
         if (Block.IsValid())
         {
-            AlignedOffset = AlignUp(Block.UnalignedOffset, size_t{Alignment});
-            AlignedSize   = Block.Size;
-            VERIFY_EXPR(Block.Size >= SizeInBytes + (AlignedOffset - Block.UnalignedOffset));
-            m_CurrAllocatedSize += static_cast<Uint32>(Block.Size);
-            m_MasterBlocks.emplace_back(Block);
+            pChunk        = Block.pChunk;
+            AlignedOffset = AlignUp(Block.Block.UnalignedOffset, size_t{Alignment});
+            AlignedSize   = Block.Block.Size;
+            VERIFY_EXPR(Block.Block.Size >= SizeInBytes + (AlignedOffset - Block.Block.UnalignedOffset));
+            m_CurrAllocatedSize += static_cast<Uint32>(Block.Block.Size);
+            m_MasterBlocks.emplace_back(std::move(Block));
         }
     }
     else
     {
-        if (m_CurrOffset == InvalidOffset || SizeInBytes + (AlignUp(m_CurrOffset, size_t{Alignment}) - m_CurrOffset) > m_AvailableSize)
+        AlignedOffset = m_PrimaryBlock.Allocate(SizeInBytes, Alignment, AlignedSize);
+        if (AlignedOffset != InvalidOffset)
         {
-            MasterBlock Block = m_GlobalDynamicMemMgr.AllocateMasterBlock(m_MasterBlockSize, 0);
-            if (Block.IsValid())
-            {
-                m_CurrOffset = Block.UnalignedOffset;
-                m_CurrAllocatedSize += static_cast<Uint32>(Block.Size);
-                m_AvailableSize = static_cast<Uint32>(Block.Size);
-                m_MasterBlocks.emplace_back(Block);
-            }
+            pChunk = m_PrimaryBlock.pChunk;
         }
-
-        if (m_CurrOffset != InvalidOffset)
+        else if (AllowOverflow && (AlignedOffset = m_OverflowBlock.Allocate(SizeInBytes, Alignment, AlignedSize)) != InvalidOffset)
         {
-            AlignedOffset = AlignUp(m_CurrOffset, size_t{Alignment});
-            AlignedSize   = SizeInBytes + (AlignedOffset - m_CurrOffset);
-            if (AlignedSize <= m_AvailableSize)
+            pChunk = m_OverflowBlock.pChunk;
+        }
+        else
+        {
+            // Take the page from the cache first. This does not lock the memory manager unless the cache needs to be refilled.
+            ChunkMasterBlock Block{&m_GlobalDynamicMemMgr.GetPrimaryChunk(), m_PrimaryBlockCache.Allocate()};
+            if (!Block.IsValid())
+                Block = m_GlobalDynamicMemMgr.AllocateMasterBlock(m_MasterBlockSize, 0, AllowOverflow);
+            if (Block.IsValid())
             {
-                m_AvailableSize -= static_cast<Uint32>(AlignedSize);
-                m_CurrOffset += static_cast<Uint32>(AlignedSize);
+                CurrentBlock& CurrBlock = Block.pChunk->GetIndex() == 0 ? m_PrimaryBlock : m_OverflowBlock;
+
+                CurrBlock.pChunk        = Block.pChunk;
+                CurrBlock.Offset        = Block.Block.UnalignedOffset;
+                CurrBlock.AvailableSize = static_cast<Uint32>(Block.Block.Size);
+                m_CurrAllocatedSize += static_cast<Uint32>(Block.Block.Size);
+                m_MasterBlocks.emplace_back(std::move(Block));
+
+                AlignedOffset = CurrBlock.Allocate(SizeInBytes, Alignment, AlignedSize);
+                if (AlignedOffset != InvalidOffset)
+                    pChunk = CurrBlock.pChunk;
             }
-            else
-                AlignedOffset = InvalidOffset;
         }
     }
 
     // Every device context uses its own dynamic heap, so there is no need to lock
     if (AlignedOffset != InvalidOffset)
     {
+        VERIFY_EXPR(pChunk != nullptr);
+        VERIFY(AllowOverflow || pChunk->GetIndex() == 0, "Allocations that do not allow overflow must be made from the primary chunk");
+
         m_CurrAlignedSize += static_cast<Uint32>(AlignedSize);
         m_CurrUsedSize += SizeInBytes;
         m_PeakAlignedSize   = std::max(m_PeakAlignedSize, m_CurrAlignedSize);
@@ -280,7 +544,7 @@ VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 A
         m_PeakAllocatedSize = std::max(m_PeakAllocatedSize, m_CurrAllocatedSize);
 
         VERIFY_EXPR((AlignedOffset & (Alignment - 1)) == 0);
-        return VulkanDynamicAllocation{m_GlobalDynamicMemMgr, AlignedOffset, SizeInBytes};
+        return VulkanDynamicAllocation{*pChunk, AlignedOffset, SizeInBytes};
     }
     else
         return VulkanDynamicAllocation{};
@@ -288,11 +552,15 @@ VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 A
 
 void VulkanDynamicHeap::ReleaseMasterBlocks(RenderDeviceVkImpl& DeviceVkImpl, Uint64 CmdQueueMask)
 {
+    // Report the pages used in this frame to the primary chunk statistics before they are released,
+    // and return reserved pages if another context ran out of space.
+    m_PrimaryBlockCache.TrimIfRequested();
+
     m_GlobalDynamicMemMgr.ReleaseMasterBlocks(m_MasterBlocks, DeviceVkImpl, CmdQueueMask);
     m_MasterBlocks.clear();
 
-    m_CurrOffset    = InvalidOffset;
-    m_AvailableSize = 0;
+    m_PrimaryBlock  = {};
+    m_OverflowBlock = {};
 
     m_CurrUsedSize      = 0;
     m_CurrAlignedSize   = 0;
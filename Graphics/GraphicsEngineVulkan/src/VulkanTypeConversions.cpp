@@ -2082,10 +2082,15 @@ DeviceFeaturesVk PhysicalDeviceFeaturesToDeviceFeaturesVk(const VulkanUtilities:
 
     INIT_FEATURE(DynamicRendering, ExtFeatures.DynamicRendering.dynamicRendering != VK_FALSE);
     INIT_FEATURE(HostImageCopy, ExtFeatures.HostImageCopy.hostImageCopy != VK_FALSE);
+    // Descriptor buffers are bound by their device addresses
+    INIT_FEATURE(DescriptorBuffer, ExtFeatures.DescriptorBuffer.descriptorBuffer != VK_FALSE && ExtFeatures.BufferDeviceAddress.bufferDeviceAddress != VK_FALSE);
+    INIT_FEATURE(GraphicsPipelineLibrary, ExtFeatures.GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE);
+    INIT_FEATURE(Synchronization2, ExtFeatures.Synchronization2.synchronization2 != VK_FALSE);
+    INIT_FEATURE(PushDescriptor, ExtFeatures.PushDescriptor);
 
 #undef INIT_FEATURE
 
-    ASSERT_SIZEOF(DeviceFeaturesVk, 2, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
+    ASSERT_SIZEOF(DeviceFeaturesVk, 6, "Did you add a new feature to DeviceFeaturesVk? Please handle its status here (if necessary).");
 
     return FeaturesVk;
 }
@@ -140,6 +140,17 @@ static VkAccessFlags AccessMaskFromImageLayout(VkImageLayout Layout,
     return AccessMask;
 }
 
+static bool IsSameSubresourceRange(const VkImageSubresourceRange& Range0, const VkImageSubresourceRange& Range1)
+{
+    // clang-format off
+    return Range0.aspectMask     == Range1.aspectMask     &&
+           Range0.baseMipLevel   == Range1.baseMipLevel   &&
+           Range0.levelCount     == Range1.levelCount     &&
+           Range0.baseArrayLayer == Range1.baseArrayLayer &&
+           Range0.layerCount     == Range1.layerCount;
+    // clang-format on
+}
+
 } // namespace
 
 
@@ -162,6 +173,8 @@ void CommandBuffer::TransitionImageLayout(VkImage                        Image,
     VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
     VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
 
+    ++m_BarrierStats.NumRequestedBarriers;
+
     if (OldLayout == NewLayout)
     {
         m_Barrier.MemorySrcStages |= SrcStages;
@@ -172,10 +185,13 @@ void CommandBuffer::TransitionImageLayout(VkImage                        Image,
         return;
     }
 
+    const VkAccessFlags SrcAccess = AccessMaskFromImageLayout(OldLayout, false) & m_Barrier.SupportedAccessMask;
+    const VkAccessFlags DstAccess = AccessMaskFromImageLayout(NewLayout, true) & m_Barrier.SupportedAccessMask;
+
     // Check overlapping subresources
     for (size_t i = 0; i < m_ImageBarriers.size(); ++i)
     {
-        const VkImageMemoryBarrier& ImgBarrier = m_ImageBarriers[i];
+        VkImageMemoryBarrier2KHR& ImgBarrier = m_ImageBarriers[i];
         if (ImgBarrier.image != Image)
             continue;
 
@@ -194,10 +210,27 @@ void CommandBuffer::TransitionImageLayout(VkImage                        Image,
         const bool SlicesOverlap = Diligent::CheckLineSectionOverlap<true>(StartLayer0, EndLayer0, StartLayer1, EndLayer1);
         const bool MipsOverlap   = Diligent::CheckLineSectionOverlap<true>(StartMip0, EndMip0, StartMip1, EndMip1);
 
-        // If the range overlaps with any of the existing barriers, we need to
-        // flush them.
         if (SlicesOverlap && MipsOverlap)
         {
+            // Commands that access resources always flush pending barriers, so no such command has been
+            // recorded since the pending barrier was added. If it transitions exactly the same subresources
+            // to the layout this transition starts from, the two transitions can be merged into one
+            // (A -> B followed by B -> C becomes A -> C). Stages and access masks are combined conservatively.
+            if (ImgBarrier.newLayout == OldLayout && IsSameSubresourceRange(OtherRange, SubresRange))
+            {
+                ImgBarrier.newLayout = NewLayout;
+                ImgBarrier.srcStageMask |= SrcStages & m_Barrier.SupportedStagesMask;
+                ImgBarrier.dstStageMask |= DstStages & m_Barrier.SupportedStagesMask;
+                ImgBarrier.dstAccessMask |= DstAccess;
+
+                m_Barrier.ImageSrcStages |= SrcStages;
+                m_Barrier.ImageDstStages |= DstStages;
+
+                ++m_BarrierStats.NumMergedTransitions;
+                return;
+            }
+
+            // Otherwise, we need to flush the existing barriers.
             FlushBarriers();
             break;
         }
@@ -206,15 +239,17 @@ void CommandBuffer::TransitionImageLayout(VkImage                        Image,
     m_Barrier.ImageSrcStages |= SrcStages;
     m_Barrier.ImageDstStages |= DstStages;
 
-    VkImageMemoryBarrier ImgBarrier{};
-    ImgBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    VkImageMemoryBarrier2KHR ImgBarrier{};
+    ImgBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
     ImgBarrier.pNext               = nullptr;
+    ImgBarrier.srcStageMask        = SrcStages & m_Barrier.SupportedStagesMask;
+    ImgBarrier.srcAccessMask       = SrcAccess;
+    ImgBarrier.dstStageMask        = DstStages & m_Barrier.SupportedStagesMask;
+    ImgBarrier.dstAccessMask       = DstAccess;
     ImgBarrier.oldLayout           = OldLayout;
     ImgBarrier.newLayout           = NewLayout;
     ImgBarrier.image               = Image;
     ImgBarrier.subresourceRange    = SubresRange;
-    ImgBarrier.srcAccessMask       = AccessMaskFromImageLayout(OldLayout, false) & m_Barrier.SupportedAccessMask;
-    ImgBarrier.dstAccessMask       = AccessMaskFromImageLayout(NewLayout, true) & m_Barrier.SupportedAccessMask;
     ImgBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED; // source queue family for a queue family ownership transfer.
     ImgBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED; // destination queue family for a queue family ownership transfer.
     m_ImageBarriers.emplace_back(ImgBarrier);
@@ -230,6 +265,8 @@ void CommandBuffer::MemoryBarrier(VkAccessFlags        srcAccessMask,
     VERIFY_EXPR((SrcStages & m_Barrier.SupportedStagesMask) != 0);
     VERIFY_EXPR((DstStages & m_Barrier.SupportedStagesMask) != 0);
 
+    ++m_BarrierStats.NumRequestedBarriers;
+
     m_Barrier.MemorySrcStages |= SrcStages;
     m_Barrier.MemoryDstStages |= DstStages;
 
@@ -246,30 +283,80 @@ void CommandBuffer::FlushBarriers()
 
     VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
 
-    VkMemoryBarrier vkMemBarrier{};
-    vkMemBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
-    vkMemBarrier.pNext         = nullptr;
-    vkMemBarrier.srcAccessMask = m_Barrier.MemorySrcAccess & m_Barrier.SupportedAccessMask;
-    vkMemBarrier.dstAccessMask = m_Barrier.MemoryDstAccess & m_Barrier.SupportedAccessMask;
-
-    const bool HasMemoryBarrier =
-        m_Barrier.MemorySrcStages != 0 && m_Barrier.MemoryDstStages != 0 &&
-        m_Barrier.MemorySrcAccess != 0 && m_Barrier.MemoryDstAccess != 0;
-
-    const VkPipelineStageFlags SrcStages = (m_Barrier.ImageSrcStages | m_Barrier.MemorySrcStages) & m_Barrier.SupportedStagesMask;
-    const VkPipelineStageFlags DstStages = (m_Barrier.ImageDstStages | m_Barrier.MemoryDstStages) & m_Barrier.SupportedStagesMask;
-    VERIFY_EXPR(SrcStages != 0 && DstStages != 0);
-
-    vkCmdPipelineBarrier(m_VkCmdBuffer,
-                         SrcStages,
-                         DstStages,
-                         0,
-                         HasMemoryBarrier ? 1 : 0,
-                         HasMemoryBarrier ? &vkMemBarrier : nullptr,
-                         0,
-                         nullptr,
-                         static_cast<uint32_t>(m_ImageBarriers.size()),
-                         m_ImageBarriers.empty() ? nullptr : m_ImageBarriers.data());
+#if DILIGENT_USE_VOLK
+    if (m_UseSync2)
+    {
+        // With Synchronization2, every barrier carries its own stage masks, so batching
+        // barriers together does not widen the synchronization scope of each of them.
+        VkMemoryBarrier2KHR vkMemBarrier{};
+        vkMemBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+        vkMemBarrier.pNext         = nullptr;
+        vkMemBarrier.srcStageMask  = m_Barrier.MemorySrcStages & m_Barrier.SupportedStagesMask;
+        vkMemBarrier.srcAccessMask = m_Barrier.MemorySrcAccess & m_Barrier.SupportedAccessMask;
+        vkMemBarrier.dstStageMask  = m_Barrier.MemoryDstStages & m_Barrier.SupportedStagesMask;
+        vkMemBarrier.dstAccessMask = m_Barrier.MemoryDstAccess & m_Barrier.SupportedAccessMask;
+
+        // Memory barrier with empty access masks is still required as an execution dependency
+        const bool HasMemoryBarrier = vkMemBarrier.srcStageMask != 0 && vkMemBarrier.dstStageMask != 0;
+
+        VkDependencyInfoKHR DependencyInfo{};
+        DependencyInfo.sType                   = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        DependencyInfo.pNext                   = nullptr;
+        DependencyInfo.dependencyFlags         = 0;
+        DependencyInfo.memoryBarrierCount      = HasMemoryBarrier ? 1 : 0;
+        DependencyInfo.pMemoryBarriers         = HasMemoryBarrier ? &vkMemBarrier : nullptr;
+        DependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(m_ImageBarriers.size());
+        DependencyInfo.pImageMemoryBarriers    = m_ImageBarriers.empty() ? nullptr : m_ImageBarriers.data();
+
+        vkCmdPipelineBarrier2KHR(m_VkCmdBuffer, &DependencyInfo);
+    }
+    else
+#endif
+    {
+        VkMemoryBarrier vkMemBarrier{};
+        vkMemBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        vkMemBarrier.pNext         = nullptr;
+        vkMemBarrier.srcAccessMask = m_Barrier.MemorySrcAccess & m_Barrier.SupportedAccessMask;
+        vkMemBarrier.dstAccessMask = m_Barrier.MemoryDstAccess & m_Barrier.SupportedAccessMask;
+
+        const bool HasMemoryBarrier =
+            m_Barrier.MemorySrcStages != 0 && m_Barrier.MemoryDstStages != 0 &&
+            m_Barrier.MemorySrcAccess != 0 && m_Barrier.MemoryDstAccess != 0;
+
+        const VkPipelineStageFlags SrcStages = (m_Barrier.ImageSrcStages | m_Barrier.MemorySrcStages) & m_Barrier.SupportedStagesMask;
+        const VkPipelineStageFlags DstStages = (m_Barrier.ImageDstStages | m_Barrier.MemoryDstStages) & m_Barrier.SupportedStagesMask;
+        VERIFY_EXPR(SrcStages != 0 && DstStages != 0);
+
+        m_LegacyImageBarriers.clear();
+        for (const VkImageMemoryBarrier2KHR& ImgBarrier2 : m_ImageBarriers)
+        {
+            VkImageMemoryBarrier ImgBarrier{};
+            ImgBarrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            ImgBarrier.pNext               = nullptr;
+            ImgBarrier.srcAccessMask       = static_cast<VkAccessFlags>(ImgBarrier2.srcAccessMask);
+            ImgBarrier.dstAccessMask       = static_cast<VkAccessFlags>(ImgBarrier2.dstAccessMask);
+            ImgBarrier.oldLayout           = ImgBarrier2.oldLayout;
+            ImgBarrier.newLayout           = ImgBarrier2.newLayout;
+            ImgBarrier.srcQueueFamilyIndex = ImgBarrier2.srcQueueFamilyIndex;
+            ImgBarrier.dstQueueFamilyIndex = ImgBarrier2.dstQueueFamilyIndex;
+            ImgBarrier.image               = ImgBarrier2.image;
+            ImgBarrier.subresourceRange    = ImgBarrier2.subresourceRange;
+            m_LegacyImageBarriers.emplace_back(ImgBarrier);
+        }
+
+        vkCmdPipelineBarrier(m_VkCmdBuffer,
+                             SrcStages,
+                             DstStages,
+                             0,
+                             HasMemoryBarrier ? 1 : 0,
+                             HasMemoryBarrier ? &vkMemBarrier : nullptr,
+                             0,
+                             nullptr,
+                             static_cast<uint32_t>(m_LegacyImageBarriers.size()),
+                             m_LegacyImageBarriers.empty() ? nullptr : m_LegacyImageBarriers.data());
+    }
+
+    ++m_BarrierStats.NumPipelineBarriers;
 
     m_ImageBarriers.clear();
     m_Barrier.ImageSrcStages  = 0;
@@ -749,6 +749,55 @@ VkResult LogicalDevice::HostTransitionImageLayout(const VkHostImageLayoutTransit
 #endif
 }
 
+VkDeviceSize LogicalDevice::GetDescriptorSetLayoutSize(VkDescriptorSetLayout Layout) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE);
+    VkDeviceSize Size = 0;
+    vkGetDescriptorSetLayoutSizeEXT(m_VkDevice, Layout, &Size);
+    return Size;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutSizeEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+VkDeviceSize LogicalDevice::GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout Layout, uint32_t Binding) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE);
+    VkDeviceSize Offset = 0;
+    vkGetDescriptorSetLayoutBindingOffsetEXT(m_VkDevice, Layout, Binding, &Offset);
+    return Offset;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutBindingOffsetEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+void LogicalDevice::GetDescriptor(const VkDescriptorGetInfoEXT& GetInfo, size_t DataSize, void* pDescriptor) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE);
+    vkGetDescriptorEXT(m_VkDevice, &GetInfo, DataSize, pDescriptor);
+#else
+    UNSUPPORTED("vkGetDescriptorEXT is only available through Volk");
+#endif
+}
+
+VkDeviceAddress LogicalDevice::GetBufferDeviceAddress(VkBuffer Buffer) const
+{
+#if DILIGENT_USE_VOLK
+    VkBufferDeviceAddressInfoKHR BufferInfo{};
+    BufferInfo.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    BufferInfo.buffer = Buffer;
+    return vkGetBufferDeviceAddressKHR(m_VkDevice, &BufferInfo);
+#else
+    UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
+    return VkDeviceAddress{};
+#endif
+}
+
 VkResult LogicalDevice::GetRayTracingShaderGroupHandles(VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void* pData) const
 {
 #if DILIGENT_USE_VOLK
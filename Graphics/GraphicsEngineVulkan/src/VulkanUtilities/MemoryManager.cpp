@@ -40,14 +40,36 @@ MemoryAllocation::~MemoryAllocation()
     }
 }
 
+namespace
+{
+
+template <typename T>
+void UpdateAtomicMax(std::atomic<T>& Max, T Value)
+{
+    T CurrMax = Max.load();
+    while (CurrMax < Value && !Max.compare_exchange_weak(CurrMax, Value))
+    {
+    }
+}
+
+bool IsCloseToBudget(VkDeviceSize Usage, VkDeviceSize Budget)
+{
+    return static_cast<double>(Usage) > static_cast<double>(Budget) * MemoryManager::BudgetTrimThreshold;
+}
+
+} // namespace
+
 MemoryPage::MemoryPage(MemoryManager&        ParentMemoryMgr,
                        VkDeviceSize          PageSize,
                        uint32_t              MemoryTypeIndex,
                        bool                  IsHostVisible,
-                       VkMemoryAllocateFlags AllocateFlags) :
+                       VkMemoryAllocateFlags AllocateFlags,
+                       bool                  IsDedicated) :
     // clang-format off
-    m_ParentMemoryMgr{ParentMemoryMgr},
-    m_AllocationMgr  {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator}
+    m_ParentMemoryMgr {ParentMemoryMgr},
+    m_AllocationMgr   {static_cast<AllocationsMgrOffsetType>(PageSize), ParentMemoryMgr.m_Allocator},
+    m_IsDedicated     {IsDedicated},
+    m_MaxFreeBlockSize{PageSize}
 // clang-format on
 {
     VERIFY(PageSize <= std::numeric_limits<AllocationsMgrOffsetType>::max(),
@@ -70,7 +92,8 @@ MemoryPage::MemoryPage(MemoryManager&        ParentMemoryMgr,
         MemFlagInfo.flags = AllocateFlags;
     }
 
-    std::string MemoryName = Diligent::FormatString("Device memory page. Size: ", Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
+    std::string MemoryName = Diligent::FormatString(IsDedicated ? "Dedicated device memory page. Size: " : "Device memory page. Size: ",
+                                                    Diligent::FormatMemorySize(PageSize, 2), ", type: ", MemoryTypeIndex);
     m_VkMemory             = ParentMemoryMgr.m_LogicalDevice.AllocateDeviceMemory(MemAlloc, MemoryName.c_str());
 
     if (IsHostVisible)
@@ -96,6 +119,12 @@ MemoryPage::~MemoryPage()
     VERIFY(IsEmpty(), "Destroying a page with not all allocations released");
 }
 
+bool MemoryPage::IsUnused()
+{
+    std::lock_guard<std::mutex> Lock{m_Mutex};
+    return m_AllocationMgr.IsEmpty();
+}
+
 MemoryAllocation MemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
 {
     std::lock_guard<std::mutex> Lock{m_Mutex};
@@ -106,6 +135,8 @@ MemoryAllocation MemoryPage::Allocate(VkDeviceSize size, VkDeviceSize alignment)
         m_AllocationMgr.Allocate(static_cast<AllocationsMgrOffsetType>(size), static_cast<AllocationsMgrOffsetType>(alignment));
     if (Allocation.IsValid())
     {
+        m_MaxFreeBlockSize.store(m_AllocationMgr.GetMaxFreeBlockSize(), std::memory_order_relaxed);
+
         // Offset may not necessarily be aligned, but the allocation is guaranteed to be large enough
         // to accommodate requested alignment
         VERIFY_EXPR(Diligent::AlignUp(VkDeviceSize{Allocation.UnalignedOffset}, alignment) - Allocation.UnalignedOffset + size <= Allocation.Size);
@@ -124,6 +155,7 @@ void MemoryPage::Free(MemoryAllocation&& Allocation)
     VERIFY_EXPR(Allocation.UnalignedOffset <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     VERIFY_EXPR(Allocation.Size <= std::numeric_limits<AllocationsMgrOffsetType>::max());
     m_AllocationMgr.Free(static_cast<AllocationsMgrOffsetType>(Allocation.UnalignedOffset), static_cast<AllocationsMgrOffsetType>(Allocation.Size));
+    m_MaxFreeBlockSize.store(m_AllocationMgr.GetMaxFreeBlockSize(), std::memory_order_relaxed);
     Allocation = MemoryAllocation{};
 }
 
@@ -159,6 +191,56 @@ MemoryAllocation MemoryManager::Allocate(const VkMemoryRequirements& MemReqs, Vk
     return Allocate(MemReqs.size, MemReqs.alignment, MemoryTypeIndex, HostVisible, AllocateFlags);
 }
 
+MemoryManager::PageList& MemoryManager::GetPageList(const MemoryPageIndex& PageIdx)
+{
+    std::lock_guard<std::mutex> Lock{m_PageListsMtx};
+
+    std::unique_ptr<PageList>& pList = m_PageLists[PageIdx];
+    if (!pList)
+        pList = std::make_unique<PageList>();
+    return *pList;
+}
+
+MemoryAllocation MemoryManager::AllocateFromPages(PageList& List, VkDeviceSize Size, VkDeviceSize Alignment)
+{
+    for (std::unique_ptr<MemoryPage>& pPage : List.Pages)
+    {
+        // Skip pages that certainly can't accommodate the allocation without locking them
+        if (pPage->IsDedicated() || pPage->GetMaxFreeBlockSizeHint() < Size)
+            continue;
+
+        MemoryAllocation Allocation = pPage->Allocate(Size, Alignment);
+        if (Allocation.Page != nullptr)
+            return Allocation;
+    }
+
+    return MemoryAllocation{};
+}
+
+MemoryPage& MemoryManager::AddPage(PageList& List, const MemoryPageIndex& PageIdx, std::unique_ptr<MemoryPage>&& pPage)
+{
+    const size_t       stat_ind  = PageIdx.IsHostVisible ? 1 : 0;
+    const VkDeviceSize PageSize  = pPage->GetPageSize();
+    const bool         Dedicated = pPage->IsDedicated();
+
+    List.Pages.emplace_back(std::move(pPage));
+    MemoryPage& NewPage = *List.Pages.back();
+
+    m_HeapAllocatedSize[GetHeapIndex(PageIdx.MemoryTypeIndex)].fetch_add(PageSize);
+
+    const VkDeviceSize CurrAllocatedSize = m_CurrAllocatedSize[stat_ind].fetch_add(PageSize) + PageSize;
+    UpdateAtomicMax(m_PeakAllocatedSize[stat_ind], CurrAllocatedSize);
+    if (Dedicated)
+        m_NumDedicatedPages[stat_ind].fetch_add(1);
+
+    LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': created new ", (Dedicated ? "dedicated " : ""), (PageIdx.IsHostVisible ? "host-visible" : "device-local"),
+                     " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", PageIdx.MemoryTypeIndex,
+                     "). Current allocated size: ", Diligent::FormatMemorySize(CurrAllocatedSize, 2));
+    OnNewPageCreated(NewPage);
+
+    return NewPage;
+}
+
 MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, uint32_t MemoryTypeIndex, bool HostVisible, VkMemoryAllocateFlags AllocateFlags)
 {
     MemoryAllocation Allocation;
@@ -170,34 +252,45 @@ MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignme
     // even though on integrated GPUs same pages can be used for both GPU-only and staging
     // allocations. Staging allocations are short-living and will be released when upload is
     // complete, while GPU-only allocations are expected to be long-living.
-    MemoryPageIndex             PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
+    const MemoryPageIndex PageIdx{MemoryTypeIndex, HostVisible, AllocateFlags};
+    PageList&             List = GetPageList(PageIdx);
 
-    auto range = m_Pages.equal_range(PageIdx);
-    for (auto page_it = range.first; page_it != range.second; ++page_it)
+    const VkDeviceSize PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
+    if (Diligent::AlignUp(Size, Alignment) > PageSize)
     {
-        Allocation = page_it->second.Allocate(Size, Alignment);
-        if (Allocation.Page != nullptr)
-            break;
-    }
+        // Allocations that do not fit into a regular page get a dedicated page of the exact size.
+        // The page is released by the first ShrinkMemory() call after the allocation is freed.
+        // Device memory is allocated before the list is locked so that other threads are not blocked.
+        std::unique_ptr<MemoryPage> pPage = std::make_unique<MemoryPage>(*this, Diligent::AlignUp(Size, Alignment), MemoryTypeIndex, HostVisible, AllocateFlags, /*IsDedicated = */ true);
+
+        Allocation = pPage->Allocate(Size, Alignment);
+        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate memory from a dedicated page");
 
-    size_t stat_ind = HostVisible ? 1 : 0;
-    if (Allocation.Page == nullptr)
+        std::unique_lock<Threading::SharedMutex> Lock{List.Mtx};
+        AddPage(List, PageIdx, std::move(pPage));
+    }
+    else
     {
-        VkDeviceSize PageSize = HostVisible ? m_HostVisiblePageSize : m_DeviceLocalPageSize;
-        while (PageSize < Size)
-            PageSize *= 2;
-
-        m_CurrAllocatedSize[stat_ind] += PageSize;
-        m_PeakAllocatedSize[stat_ind] = std::max(m_PeakAllocatedSize[stat_ind], m_CurrAllocatedSize[stat_ind]);
-
-        auto it = m_Pages.emplace(PageIdx, MemoryPage{*this, PageSize, MemoryTypeIndex, HostVisible, AllocateFlags});
-        LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': created new ", (HostVisible ? "host-visible" : "device-local"),
-                         " page. (", Diligent::FormatMemorySize(PageSize, 2), ", type idx: ", MemoryTypeIndex,
-                         "). Current allocated size: ", Diligent::FormatMemorySize(m_CurrAllocatedSize[stat_ind], 2));
-        OnNewPageCreated(it->second);
-        Allocation = it->second.Allocate(Size, Alignment);
-        DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+        {
+            std::shared_lock<Threading::SharedMutex> Lock{List.Mtx};
+            Allocation = AllocateFromPages(List, Size, Alignment);
+        }
+
+        if (Allocation.Page == nullptr)
+        {
+            std::unique_lock<Threading::SharedMutex> Lock{List.Mtx};
+
+            // Another thread may have created a new page or released memory while we were waiting for the lock
+            Allocation = AllocateFromPages(List, Size, Alignment);
+            if (Allocation.Page == nullptr)
+            {
+                const VkDeviceSize NewPageSize = GetBudgetAwarePageSize(MemoryTypeIndex, PageSize, Diligent::AlignUp(Size, Alignment));
+
+                MemoryPage& NewPage = AddPage(List, PageIdx, std::make_unique<MemoryPage>(*this, NewPageSize, MemoryTypeIndex, HostVisible, AllocateFlags));
+                Allocation          = NewPage.Allocate(Size, Alignment);
+                DEV_CHECK_ERR(Allocation.Page != nullptr, "Failed to allocate new memory page");
+            }
+        }
     }
 
     if (Allocation.Page != nullptr)
@@ -205,40 +298,145 @@ MemoryAllocation MemoryManager::Allocate(VkDeviceSize Size, VkDeviceSize Alignme
         VERIFY_EXPR(Size + Diligent::AlignUp(Allocation.UnalignedOffset, Alignment) - Allocation.UnalignedOffset <= Allocation.Size);
     }
 
-    m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size);
-    m_PeakUsedSize[stat_ind] = std::max(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(m_CurrUsedSize[stat_ind].load()));
+    const size_t  stat_ind     = HostVisible ? 1 : 0;
+    const int64_t CurrUsedSize = m_CurrUsedSize[stat_ind].fetch_add(Allocation.Size) + static_cast<int64_t>(Allocation.Size);
+    UpdateAtomicMax(m_PeakUsedSize[stat_ind], static_cast<VkDeviceSize>(CurrUsedSize));
 
     return Allocation;
 }
 
 void MemoryManager::ShrinkMemory()
 {
-    std::lock_guard<std::mutex> Lock{m_PagesMtx};
-    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize)
+    if (m_CurrAllocatedSize[0] <= m_DeviceLocalReserveSize && m_CurrAllocatedSize[1] <= m_HostVisibleReserveSize &&
+        m_NumDedicatedPages[0] == 0 && m_NumDedicatedPages[1] == 0 && m_OverBudgetHeapMask == 0)
         return;
 
-    auto it = m_Pages.begin();
-    while (it != m_Pages.end())
+    std::vector<std::pair<PageList*, uint32_t>> Lists;
     {
-        auto curr_it = it;
-        ++it;
-        MemoryPage&  Page          = curr_it->second;
-        bool         IsHostVisible = Page.GetCPUMemory() != nullptr;
-        VkDeviceSize ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
-        if (Page.IsEmpty() && m_CurrAllocatedSize[IsHostVisible ? 1 : 0] > ReserveSize)
+        std::lock_guard<std::mutex> Lock{m_PageListsMtx};
+        Lists.reserve(m_PageLists.size());
+        for (auto& it : m_PageLists)
+            Lists.emplace_back(it.second.get(), GetHeapIndex(it.first.MemoryTypeIndex));
+    }
+
+    for (const auto& list_it : Lists)
+    {
+        PageList*      pList     = list_it.first;
+        const uint32_t HeapIndex = list_it.second;
+        // When the heap is close to its budget, all empty pages are released regardless of the reserve size
+        const bool TrimReserve = IsHeapOverBudget(HeapIndex);
+
+        std::unique_lock<Threading::SharedMutex> Lock{pList->Mtx};
+
+        auto it = pList->Pages.begin();
+        while (it != pList->Pages.end())
         {
-            VkDeviceSize PageSize = Page.GetPageSize();
-            m_CurrAllocatedSize[IsHostVisible ? 1 : 0] -= PageSize;
-            LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': destroying ", (IsHostVisible ? "host-visible" : "device-local"),
-                             " page (", Diligent::FormatMemorySize(PageSize, 2),
-                             "). Current allocated size: ",
-                             Diligent::FormatMemorySize(m_CurrAllocatedSize[IsHostVisible ? 1 : 0], 2));
-            OnPageDestroy(Page);
-            m_Pages.erase(curr_it);
+            MemoryPage&  Page          = **it;
+            const bool   IsHostVisible = Page.GetCPUMemory() != nullptr;
+            const size_t stat_ind      = IsHostVisible ? 1 : 0;
+            VkDeviceSize ReserveSize   = IsHostVisible ? m_HostVisibleReserveSize : m_DeviceLocalReserveSize;
+            // No new allocations can be made from the page while the list is locked in exclusive mode,
+            // so the page remains unused once the check succeeds.
+            if ((Page.IsDedicated() || TrimReserve || m_CurrAllocatedSize[stat_ind] > ReserveSize) && Page.IsUnused())
+            {
+                VkDeviceSize PageSize          = Page.GetPageSize();
+                VkDeviceSize CurrAllocatedSize = m_CurrAllocatedSize[stat_ind].fetch_sub(PageSize) - PageSize;
+                m_HeapAllocatedSize[HeapIndex].fetch_sub(PageSize);
+                if (Page.IsDedicated())
+                    m_NumDedicatedPages[stat_ind].fetch_sub(1);
+                LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': destroying ", (Page.IsDedicated() ? "dedicated " : ""), (IsHostVisible ? "host-visible" : "device-local"),
+                                 " page (", Diligent::FormatMemorySize(PageSize, 2),
+                                 "). Current allocated size: ",
+                                 Diligent::FormatMemorySize(CurrAllocatedSize, 2));
+                OnPageDestroy(Page);
+                it = pList->Pages.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
         }
     }
 }
 
+void MemoryManager::UpdateMemoryBudget()
+{
+    const VkPhysicalDeviceMemoryProperties& MemProps = m_PhysicalDevice.GetMemoryProperties();
+
+    std::lock_guard<std::mutex> Lock{m_BudgetMtx};
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT DriverBudget{};
+    const bool                                IsReported = IsMemoryBudgetReported() && m_PhysicalDevice.GetMemoryBudget(DriverBudget);
+
+    uint32_t OverBudgetHeapMask = 0;
+    for (uint32_t HeapIndex = 0; HeapIndex < MemProps.memoryHeapCount; ++HeapIndex)
+    {
+        const VkDeviceSize Allocated = m_HeapAllocatedSize[HeapIndex].load();
+
+        VkDeviceSize Budget = 0;
+        VkDeviceSize Usage  = 0;
+        if (IsReported)
+        {
+            Budget = DriverBudget.heapBudget[HeapIndex];
+            Usage  = DriverBudget.heapUsage[HeapIndex];
+        }
+        else
+        {
+            // Without the extension, assume that 80% of the heap is available to the process
+            // and that this manager is the only user of the heap.
+            Budget = MemProps.memoryHeaps[HeapIndex].size / 10 * 8;
+            Usage  = Allocated;
+        }
+
+        m_HeapBudget[HeapIndex].store(Budget);
+        m_HeapUsage[HeapIndex].store(Usage);
+        m_HeapAllocatedAtUpdate[HeapIndex].store(Allocated);
+
+        if (IsCloseToBudget(Usage, Budget))
+            OverBudgetHeapMask |= 1u << HeapIndex;
+    }
+
+    const uint32_t PrevOverBudgetHeapMask = m_OverBudgetHeapMask.exchange(OverBudgetHeapMask);
+    if ((OverBudgetHeapMask & ~PrevOverBudgetHeapMask) != 0)
+    {
+        LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "': memory usage is close to the budget in one or more heaps. Reserved pages will be released.");
+    }
+}
+
+MemoryManager::HeapBudget MemoryManager::GetHeapBudget(uint32_t HeapIndex) const
+{
+    VERIFY_EXPR(HeapIndex < m_PhysicalDevice.GetMemoryProperties().memoryHeapCount);
+
+    HeapBudget Budget;
+    Budget.Budget    = m_HeapBudget[HeapIndex].load();
+    Budget.Allocated = m_HeapAllocatedSize[HeapIndex].load();
+
+    // Account for the pages that have been created or released since the last update
+    const VkDeviceSize Usage             = m_HeapUsage[HeapIndex].load();
+    const VkDeviceSize AllocatedAtUpdate = m_HeapAllocatedAtUpdate[HeapIndex].load();
+    if (Budget.Allocated >= AllocatedAtUpdate)
+        Budget.Usage = Usage + (Budget.Allocated - AllocatedAtUpdate);
+    else
+        Budget.Usage = Usage - std::min(Usage, AllocatedAtUpdate - Budget.Allocated);
+
+    return Budget;
+}
+
+VkDeviceSize MemoryManager::GetBudgetAwarePageSize(uint32_t MemoryTypeIndex, VkDeviceSize PageSize, VkDeviceSize MinSize) const
+{
+    const HeapBudget   Budget    = GetHeapBudget(GetHeapIndex(MemoryTypeIndex));
+    const VkDeviceSize Available = Budget.Budget > Budget.Usage ? Budget.Budget - Budget.Usage : 0;
+
+    // Do not reduce the page size by more than 8 times to keep the number of pages reasonable
+    const VkDeviceSize MinPageSize = std::max(MinSize, PageSize / 8);
+
+    VkDeviceSize NewPageSize = PageSize;
+    while (NewPageSize > Available && NewPageSize / 2 >= MinPageSize)
+        NewPageSize /= 2;
+
+    return NewPageSize;
+}
+
 void MemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
 {
     m_CurrUsedSize[IsHostVisible ? 1 : 0].fetch_add(-static_cast<int64_t>(Size));
@@ -246,20 +444,26 @@ void MemoryManager::OnFreeAllocation(VkDeviceSize Size, bool IsHostVisible)
 
 MemoryManager::~MemoryManager()
 {
-    VkDeviceSize PeakDeviceLocalPages = m_PeakAllocatedSize[0] / m_DeviceLocalPageSize;
-    VkDeviceSize PeakHostVisiblePages = m_PeakAllocatedSize[1] / m_HostVisiblePageSize;
+    const VkDeviceSize PeakAllocatedSize[] = {m_PeakAllocatedSize[0].load(), m_PeakAllocatedSize[1].load()};
+    const VkDeviceSize PeakUsedSize[]      = {m_PeakUsedSize[0].load(), m_PeakUsedSize[1].load()};
+
+    VkDeviceSize PeakDeviceLocalPages = PeakAllocatedSize[0] / m_DeviceLocalPageSize;
+    VkDeviceSize PeakHostVisiblePages = PeakAllocatedSize[1] / m_HostVisiblePageSize;
     LOG_INFO_MESSAGE("MemoryManager '", m_MgrName, "' stats:\n"
                                                    "                       Peak used/allocated device-local memory size: ",
-                     Diligent::FormatMemorySize(m_PeakUsedSize[0], 2, m_PeakAllocatedSize[0]), " / ",
-                     Diligent::FormatMemorySize(m_PeakAllocatedSize[0], 2, m_PeakAllocatedSize[0]),
+                     Diligent::FormatMemorySize(PeakUsedSize[0], 2, PeakAllocatedSize[0]), " / ",
+                     Diligent::FormatMemorySize(PeakAllocatedSize[0], 2, PeakAllocatedSize[0]),
                      " (", PeakDeviceLocalPages, (PeakDeviceLocalPages == 1 ? " page)" : " pages)"),
                      "\n                       Peak used/allocated host-visible memory size: ",
-                     Diligent::FormatMemorySize(m_PeakUsedSize[1], 2, m_PeakAllocatedSize[1]), " / ",
-                     Diligent::FormatMemorySize(m_PeakAllocatedSize[1], 2, m_PeakAllocatedSize[1]),
+                     Diligent::FormatMemorySize(PeakUsedSize[1], 2, PeakAllocatedSize[1]), " / ",
+                     Diligent::FormatMemorySize(PeakAllocatedSize[1], 2, PeakAllocatedSize[1]),
                      " (", PeakHostVisiblePages, (PeakHostVisiblePages == 1 ? " page)" : " pages)"));
 
-    for (auto it = m_Pages.begin(); it != m_Pages.end(); ++it)
-        VERIFY(it->second.IsEmpty(), "The page contains outstanding allocations");
+    for (auto& it : m_PageLists)
+    {
+        for (const std::unique_ptr<MemoryPage>& pPage : it.second->Pages)
+            VERIFY(pPage->IsEmpty(), "The page contains outstanding allocations");
+    }
     VERIFY(m_CurrUsedSize[0] == 0 && m_CurrUsedSize[1] == 0, "Not all allocations have been released");
 }
 
@@ -309,6 +309,21 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
             m_ExtFeatures.DrawIndirectCount = true;
         }
 
+        if (IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+        {
+            m_ExtFeatures.PushDescriptor = true;
+
+            *NextProp = &m_ExtProperties.PushDescriptor;
+            NextProp  = &m_ExtProperties.PushDescriptor.pNext;
+
+            m_ExtProperties.PushDescriptor.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR;
+        }
+
+        if (IsExtensionSupported(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+        {
+            m_ExtFeatures.MemoryBudget = true;
+        }
+
         if (IsExtensionSupported(VK_KHR_MAINTENANCE3_EXTENSION_NAME))
         {
             *NextProp = &m_ExtProperties.Maintenance3;
@@ -365,6 +380,43 @@ PhysicalDevice::PhysicalDevice(const CreateInfo& CI) :
             m_ExtProperties.HostImageCopy.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
         }
 
+        // VK_EXT_descriptor_buffer depends on VK_KHR_buffer_device_address, VK_KHR_synchronization2 and
+        // VK_EXT_descriptor_indexing. We only use it on Vulkan 1.3 devices where all of them are core.
+        if (IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME) && m_vkVersion >= VK_API_VERSION_1_3)
+        {
+            *NextFeat = &m_ExtFeatures.DescriptorBuffer;
+            NextFeat  = &m_ExtFeatures.DescriptorBuffer.pNext;
+
+            m_ExtFeatures.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.DescriptorBuffer;
+            NextProp  = &m_ExtProperties.DescriptorBuffer.pNext;
+
+            m_ExtProperties.DescriptorBuffer.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+        }
+
+        // VK_EXT_graphics_pipeline_library depends on VK_KHR_pipeline_library
+        if (IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) && IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.GraphicsPipelineLibrary;
+            NextFeat  = &m_ExtFeatures.GraphicsPipelineLibrary.pNext;
+
+            m_ExtFeatures.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+
+            *NextProp = &m_ExtProperties.GraphicsPipelineLibrary;
+            NextProp  = &m_ExtProperties.GraphicsPipelineLibrary.pNext;
+
+            m_ExtProperties.GraphicsPipelineLibrary.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+        }
+
+        if (IsExtensionSupported(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME))
+        {
+            *NextFeat = &m_ExtFeatures.Synchronization2;
+            NextFeat  = &m_ExtFeatures.Synchronization2.pNext;
+
+            m_ExtFeatures.Synchronization2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR;
+        }
+
         // make sure that last pNext is null
         *NextFeat = nullptr;
         *NextProp = nullptr;
@@ -578,4 +630,23 @@ bool PhysicalDevice::IsUMA() const
     return m_MemoryProperties.memoryHeapCount == 1;
 }
 
+bool PhysicalDevice::GetMemoryBudget(VkPhysicalDeviceMemoryBudgetPropertiesEXT& Budget) const
+{
+    Budget = {};
+#if DILIGENT_USE_VOLK
+    if (m_ExtFeatures.MemoryBudget)
+    {
+        Budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+        VkPhysicalDeviceMemoryProperties2 MemProps2{};
+        MemProps2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        MemProps2.pNext = &Budget;
+        vkGetPhysicalDeviceMemoryProperties2KHR(m_vkDevice, &MemProps2);
+        Budget.pNext = nullptr;
+        return true;
+    }
+#endif
+    return false;
+}
+
 } // namespace VulkanUtilities
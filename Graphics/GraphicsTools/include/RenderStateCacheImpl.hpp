@@ -29,15 +29,14 @@
 /// \file
 /// Definition of the Diligent::RenderStateCacheImpl class
 
-#include <unordered_map>
-#include <mutex>
-
 #include "RenderStateCache.h"
 #include "SerializationDevice.h"
 #include "Archiver.h"
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
+#include "WeakObjectCache.hpp"
 #include "XXH128Hasher.hpp"
+#include "ShaderToolsCommon.hpp"
 
 namespace Diligent
 {
@@ -141,17 +140,18 @@ private:
     RefCntAutoPtr<IArchiver>                       m_pArchiver;
     RefCntAutoPtr<IDearchiver>                     m_pDearchiver;
 
-    std::mutex                                             m_ShadersMtx;
-    std::unordered_map<XXH128Hash, RefCntWeakPtr<IShader>> m_Shaders;
-
-    std::mutex                                                   m_ReloadableShadersMtx;
-    std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IShader>> m_ReloadableShaders;
-
-    std::mutex                                                    m_PipelinesMtx;
-    std::unordered_map<XXH128Hash, RefCntWeakPtr<IPipelineState>> m_Pipelines;
-
-    std::mutex                                                          m_ReloadablePipelinesMtx;
-    std::unordered_map<UniqueIdentifier, RefCntWeakPtr<IPipelineState>> m_ReloadablePipelines;
+    // Render states are typically requested from many loader threads at once.
+    // Sharded caches let concurrent lookups proceed without serializing on a single lock.
+    // Shaders and pipelines are keyed by their hash strings, reloadable wrappers by
+    // the unique ID of the wrapped object.
+    WeakObjectCache<IShader>        m_Shaders;
+    WeakObjectCache<IShader>        m_ReloadableShaders;
+    WeakObjectCache<IPipelineState> m_Pipelines;
+    WeakObjectCache<IPipelineState> m_ReloadablePipelines;
+
+    // Source files used in RENDER_STATE_CACHE_FILE_HASH_MODE_BY_CONTENT mode.
+    // Unchanged files are validated by their modification time and size and are not read again.
+    ShaderIncludeCache m_SourceCache;
 
     Uint32 m_ReloadVersion = 0;
 };
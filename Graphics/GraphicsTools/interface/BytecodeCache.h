@@ -59,6 +59,13 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
 
     /// \param [in] pData - A pointer to the cache data.
     /// \return     true if the data was loaded successfully, and false otherwise.
+    ///
+    /// \remarks    The data produced by Store is used in place: the cache keeps a reference
+    ///             to the data blob and the byte code returned by GetBytecode references
+    ///             its memory. The blob must not be modified after it has been loaded.
+    ///
+    ///             Byte code that is already in the cache, either added by AddBytecode or
+    ///             loaded earlier, is not replaced by the byte code from the data.
     VIRTUAL bool METHOD(Load)(THIS_
                               IDataBlob* pData) PURE;
 
@@ -69,6 +76,8 @@ DILIGENT_BEGIN_INTERFACE(IBytecodeCache, IObject)
     ///                           data blob containing the byte code will be written.
     ///                           The function calls AddRef(), so that the new object will have
     ///                           one reference.
+    ///
+    /// \remarks    The returned data blob must be treated as read-only.
     VIRTUAL void METHOD(GetBytecode)(THIS_
                                      const ShaderCreateInfo REF ShaderCI,
                                      IDataBlob**                ppByteCode) PURE;
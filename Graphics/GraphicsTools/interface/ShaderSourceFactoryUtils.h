@@ -179,6 +179,22 @@ void DILIGENT_GLOBAL_FUNCTION(CreateMemoryShaderSourceFactory)(const MemoryShade
                                                                IShaderSourceInputStreamFactory**             ppFactory);
 
 
+/// Creates a shader source factory that caches the files loaded through another factory.
+
+/// \param [in]  pSourceFactory - The factory to load the files from.
+/// \param [out] ppFactory      - Address of the memory location where the pointer to the created factory will be written.
+///
+/// The factory keeps the content of every file it loads in memory and serves subsequent requests
+/// from the cache, so that shader permutations that share include files do not read them from the
+/// disk again. Cached files are validated by their modification time and size, which requires the
+/// source factory to provide file stamps (the default shader source stream factory and compound
+/// factories that wrap it do). Files from other factories are not cached.
+///
+/// The factory is thread-safe if the source factory is.
+void DILIGENT_GLOBAL_FUNCTION(CreateCachingShaderSourceFactory)(IShaderSourceInputStreamFactory*  pSourceFactory,
+                                                                IShaderSourceInputStreamFactory** ppFactory);
+
+
 #include "../../../Primitives/interface/UndefGlobalFuncHelperMacros.h"
 
 DILIGENT_END_NAMESPACE // namespace Diligent
@@ -274,4 +274,11 @@ inline RefCntAutoPtr<IShaderSourceInputStreamFactory> CreateCompoundShaderSource
     return CreateCompoundShaderSourceFactory(CI);
 }
 
+inline RefCntAutoPtr<IShaderSourceInputStreamFactory> CreateCachingShaderSourceFactory(IShaderSourceInputStreamFactory* pSourceFactory)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory;
+    CreateCachingShaderSourceFactory(pSourceFactory, &pFactory);
+    return pFactory;
+}
+
 } // namespace Diligent
@@ -30,11 +30,16 @@
 #include <functional>
 #include <vector>
 #include <string>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <algorithm>
 
 #include "../../GraphicsEngine/interface/RenderDevice.h"
 #include "../../GraphicsEngine/interface/DeviceContext.h"
 #include "../../GraphicsEngine/interface/Buffer.h"
 #include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/Align.hpp"
 #include "MapHelper.hpp"
 
 namespace Diligent
@@ -47,6 +52,16 @@ struct StreamingBufferCreateInfo
     std::function<void(IBuffer*)> OnBufferResizeCallback = nullptr;
     Uint32                        NumContexts            = 1;
     bool                          AllowPersistentMapping = false;
+
+    /// Whether multiple threads may allocate space from the buffer at the same time, see StreamingBuffer::Allocate().
+
+    /// In this mode, the buffer is split into persistently mapped chunks of BuffDesc.Size bytes.
+    /// The buffer usage must be USAGE_UNIFIED. When a chunk is exhausted, allocations continue
+    /// in a free chunk. The chunks are created and mapped by the context that owns the buffer,
+    /// see StreamingBuffer::ReserveChunks(). Chunks are recycled once the GPU has finished
+    /// using them, see StreamingBuffer::FinishCurrentFrame() and StreamingBuffer::ReleaseCompletedFrames().
+    /// OnBufferResizeCallback is called for every new chunk buffer.
+    bool AllowConcurrentAllocation = false;
 };
 
 class StreamingBuffer
@@ -62,11 +77,26 @@ public:
         m_MapInfo(CI.NumContexts)
     {
         VERIFY_EXPR(CI.pDevice != nullptr);
-        VERIFY_EXPR(CI.BuffDesc.Usage == USAGE_DYNAMIC);
+        if (CI.AllowConcurrentAllocation)
+        {
+            VERIFY(CI.BuffDesc.Usage == USAGE_UNIFIED, "Streaming buffer that allows concurrent allocation must use USAGE_UNIFIED");
+            VERIFY((CI.BuffDesc.CPUAccessFlags & CPU_ACCESS_WRITE) != 0, "Streaming buffer that allows concurrent allocation must have CPU_ACCESS_WRITE flag");
+            m_pConcurrentState = std::make_unique<ConcurrentState>(CI.pDevice, CI.BuffDesc.Size);
+        }
+        else
+        {
+            VERIFY_EXPR(CI.BuffDesc.Usage == USAGE_DYNAMIC);
+        }
         CI.pDevice->CreateBuffer(CI.BuffDesc, nullptr, &m_pBuffer);
         VERIFY_EXPR(m_pBuffer);
         if (m_OnBufferResizeCallback)
             m_OnBufferResizeCallback(m_pBuffer);
+
+        if (m_pConcurrentState)
+        {
+            // The first chunk uses the buffer created above. It is mapped by the first ReserveChunks() call.
+            m_pConcurrentState->Chunks.emplace_back(std::make_unique<Chunk>(m_pBuffer));
+        }
     }
 
     StreamingBuffer(const StreamingBuffer&) = delete;
@@ -83,10 +113,223 @@ public:
         }
     }
 
+    /// Allocation in the streaming buffer returned by Allocate().
+    struct Allocation
+    {
+        /// Buffer that contains the allocation. This is the buffer to bind to the pipeline.
+        IBuffer* pBuffer = nullptr;
+
+        /// Offset of the allocation in the buffer.
+        Uint64 Offset = 0;
+
+        /// CPU address of the allocation. The data may be written to this address directly.
+        void* pCPUAddress = nullptr;
+
+        explicit operator bool() const { return pBuffer != nullptr; }
+    };
+
+    /// Creates and maps the chunks of the buffer created with AllowConcurrentAllocation flag.
+
+    /// \param pCtx          - Device context that owns the buffer. The chunks are only mapped by this method,
+    ///                        so that the context is never used by the threads that call Allocate().
+    /// \param MinFreeChunks - The minimum number of free chunks to make available for allocations.
+    ///
+    /// \remarks   The method makes sure that at least MinFreeChunks free chunks are mapped and ready,
+    ///            and at least as many as were used by the previous frame. If an allocation failed
+    ///            because it did not fit into a chunk, the new chunks are large enough to hold it.
+    ///
+    ///            The method must be called before the first allocation and then at the start of every
+    ///            frame, after ReleaseCompletedFrames(). It must not be called while other threads allocate
+    ///            from the buffer. The chunks stay mapped until the buffer is destroyed.
+    void ReserveChunks(IDeviceContext* pCtx, Uint32 MinFreeChunks = 1)
+    {
+        VERIFY(m_pConcurrentState, "Streaming buffer was not created with AllowConcurrentAllocation flag");
+        VERIFY_EXPR(pCtx != nullptr);
+        ConcurrentState& State = *m_pConcurrentState;
+
+        std::lock_guard<std::mutex> Lock{State.Mtx};
+
+        // Map the chunks that have not been used yet
+        for (std::unique_ptr<Chunk>& pChunk : State.Chunks)
+        {
+            if (pChunk->MappedData)
+                continue;
+
+            pChunk->MappedData.Map(pCtx, pChunk->pBuffer, MAP_WRITE, MAP_FLAG_NONE);
+            if (!pChunk->MappedData)
+            {
+                LOG_ERROR_MESSAGE("Failed to map a chunk of streaming buffer '", pChunk->pBuffer->GetDesc().Name, "'");
+                continue;
+            }
+            State.FreeChunks.push_back(pChunk.get());
+        }
+
+        size_t NumFreeChunks = 0;
+        for (const Chunk* pChunk : State.FreeChunks)
+        {
+            if (pChunk->Size >= State.ChunkSize)
+                ++NumFreeChunks;
+        }
+
+        const size_t NumRequiredChunks = (std::max)(size_t{MinFreeChunks}, State.PrevFrameChunkCount);
+        while (NumFreeChunks < NumRequiredChunks)
+        {
+            BufferDesc BuffDesc = m_pBuffer->GetDesc();
+            BuffDesc.Size       = State.ChunkSize;
+
+            RefCntAutoPtr<IBuffer> pBuffer;
+            State.pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+            if (!pBuffer)
+            {
+                LOG_ERROR_MESSAGE("Failed to create a new chunk of streaming buffer '", BuffDesc.Name, "'");
+                return;
+            }
+            if (m_OnBufferResizeCallback)
+                m_OnBufferResizeCallback(pBuffer);
+
+            std::unique_ptr<Chunk> pChunk = std::make_unique<Chunk>(pBuffer);
+            pChunk->MappedData.Map(pCtx, pChunk->pBuffer, MAP_WRITE, MAP_FLAG_NONE);
+            if (!pChunk->MappedData)
+            {
+                LOG_ERROR_MESSAGE("Failed to map a chunk of streaming buffer '", BuffDesc.Name, "'");
+                return;
+            }
+
+            State.FreeChunks.push_back(pChunk.get());
+            State.Chunks.emplace_back(std::move(pChunk));
+            ++NumFreeChunks;
+            LOG_INFO_MESSAGE("Added ", BuffDesc.Size, "-byte chunk to streaming buffer '", BuffDesc.Name, "'. Total chunk count: ", State.Chunks.size());
+        }
+    }
+
+    /// Allocates Size bytes aligned by Alignment in the buffer created with AllowConcurrentAllocation flag.
+
+    /// \param Size      - Allocation size, in bytes.
+    /// \param Alignment - Allocation alignment. Must be a power of two.
+    ///
+    /// \remarks   The method is thread-safe and does not lock a mutex unless the current chunk
+    ///            is exhausted. In this case, the allocation continues in a free chunk reserved by
+    ///            ReserveChunks(). If there is no free chunk that can hold the allocation, the method
+    ///            fails and returns an empty allocation. The next ReserveChunks() call then creates
+    ///            enough chunks. The method never uses a device context and never waits for the GPU.
+    ///
+    ///            The allocation stays valid until the frame is finished by FinishCurrentFrame()
+    ///            and the GPU has reached the frame fence value.
+    Allocation Allocate(Uint64 Size, Uint64 Alignment = 16)
+    {
+        VERIFY(m_pConcurrentState, "Streaming buffer was not created with AllowConcurrentAllocation flag");
+        VERIFY_EXPR(Size > 0);
+        VERIFY(IsPowerOfTwo(Alignment), "Alignment (", Alignment, ") must be a power of two");
+
+        ConcurrentState& State = *m_pConcurrentState;
+        while (true)
+        {
+            Chunk* pChunk = State.pCurrChunk.load(std::memory_order_acquire);
+            if (pChunk != nullptr)
+            {
+                Uint64 Offset = pChunk->Offset.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    const Uint64 AlignedOffset = AlignUp(Offset, Alignment);
+                    if (AlignedOffset + Size > pChunk->Size)
+                        break;
+
+                    if (pChunk->Offset.compare_exchange_weak(Offset, AlignedOffset + Size, std::memory_order_relaxed))
+                        return Allocation{pChunk->pBuffer, AlignedOffset, static_cast<Uint8*>(pChunk->MappedData) + AlignedOffset};
+                }
+            }
+
+            // Free chunks are empty, so the allocation offset in a new chunk is always aligned
+            if (!SwitchChunk(pChunk, Size))
+                return {};
+        }
+    }
+
+    /// Finishes the current frame in the buffer created with AllowConcurrentAllocation flag.
+
+    /// \param FenceValue - Fence value that will be signaled after the GPU has finished
+    ///                     executing the commands that use the current frame allocations.
+    ///
+    /// \remarks   The method must not be called while other threads allocate from the buffer.
+    ///            If the chunk memory is not host-coherent, the frame data is flushed, so the
+    ///            method must be called before the command lists that use it are submitted.
+    void FinishCurrentFrame(Uint64 FenceValue)
+    {
+        VERIFY(m_pConcurrentState, "Streaming buffer was not created with AllowConcurrentAllocation flag");
+        ConcurrentState& State = *m_pConcurrentState;
+
+        std::lock_guard<std::mutex> Lock{State.Mtx};
+        VERIFY(FenceValue >= State.LastFenceValue, "Current frame fence value (", FenceValue, ") is lower than the fence value of the previous frame (", State.LastFenceValue, ")");
+        State.LastFenceValue = FenceValue;
+
+        // Chunks that were exhausted during the frame are retired with the frame fence value.
+        for (Chunk* pChunk : State.FrameChunks)
+        {
+            pChunk->FlushFrameData();
+            pChunk->FenceValue = FenceValue;
+            State.RetiredChunks.push_back(pChunk);
+        }
+
+        // The current chunk keeps serving allocations in the next frame, but it can't
+        // be recycled until the GPU has finished this frame as well.
+        Chunk* pCurrChunk = State.pCurrChunk.load(std::memory_order_relaxed);
+        if (pCurrChunk != nullptr)
+        {
+            pCurrChunk->FlushFrameData();
+            pCurrChunk->FenceValue = FenceValue;
+        }
+
+        // If the frame ran out of free chunks, reserve twice as many chunks for the next frame
+        const size_t NumFrameChunks = State.FrameChunks.size() + (pCurrChunk != nullptr ? 1 : 0);
+        State.PrevFrameChunkCount   = State.ChunkRequestFailed ? (std::max)(NumFrameChunks * 2, size_t{2}) : NumFrameChunks;
+        State.ChunkRequestFailed    = false;
+        State.FrameChunks.clear();
+    }
+
+    /// Recycles the chunks that the GPU has finished using.
+
+    /// \param CompletedFenceValue - The last fence value completed by the GPU.
+    ///
+    /// \remarks   The method is thread-safe.
+    void ReleaseCompletedFrames(Uint64 CompletedFenceValue)
+    {
+        VERIFY(m_pConcurrentState, "Streaming buffer was not created with AllowConcurrentAllocation flag");
+        ConcurrentState& State = *m_pConcurrentState;
+
+        std::lock_guard<std::mutex> Lock{State.Mtx};
+        // Chunks retired by Reset() may be out of fence value order, so check all chunks
+        size_t NumRetiredChunks = 0;
+        for (Chunk* pChunk : State.RetiredChunks)
+        {
+            if (pChunk->FenceValue <= CompletedFenceValue)
+            {
+                pChunk->Offset.store(0, std::memory_order_relaxed);
+                pChunk->FlushedOffset = 0;
+                State.FreeChunks.push_back(pChunk);
+            }
+            else
+            {
+                State.RetiredChunks[NumRetiredChunks++] = pChunk;
+            }
+        }
+        State.RetiredChunks.resize(NumRetiredChunks);
+    }
+
+    /// Returns the number of chunks in the buffer created with AllowConcurrentAllocation flag.
+    size_t GetChunkCount() const
+    {
+        if (!m_pConcurrentState)
+            return 0;
+
+        std::lock_guard<std::mutex> Lock{m_pConcurrentState->Mtx};
+        return m_pConcurrentState->Chunks.size();
+    }
+
     // Returns offset of the allocated region
     Uint32 Map(IDeviceContext* pCtx, IRenderDevice* pDevice, Uint32 Size, size_t CtxNum = 0)
     {
         VERIFY_EXPR(Size > 0);
+        VERIFY(!m_pConcurrentState, "Streaming buffer created with AllowConcurrentAllocation flag must use Allocate() method");
 
         auto& MapInfo = m_MapInfo[CtxNum];
         // Check if there is enough space in the buffer
@@ -164,6 +407,34 @@ public:
     {
         for (Uint32 ctx = 0; ctx < m_MapInfo.size(); ++ctx)
             Flush(ctx);
+
+        if (m_pConcurrentState)
+        {
+            // Discard the allocations of the current frame. This must be done when no other thread
+            // allocates from the buffer. The chunks that may still be used by the GPU are retired
+            // with the fence value of the last frame they served, and are recycled by
+            // ReleaseCompletedFrames(). The chunks stay mapped.
+            ConcurrentState& State = *m_pConcurrentState;
+
+            std::lock_guard<std::mutex> Lock{State.Mtx};
+            if (Chunk* pCurrChunk = State.pCurrChunk.exchange(nullptr, std::memory_order_relaxed))
+                State.FrameChunks.push_back(pCurrChunk);
+            for (Chunk* pChunk : State.FrameChunks)
+            {
+                if (pChunk->FenceValue != 0)
+                {
+                    State.RetiredChunks.push_back(pChunk);
+                }
+                else
+                {
+                    // The chunk has not been used by any finished frame
+                    pChunk->Offset.store(0, std::memory_order_relaxed);
+                    pChunk->FlushedOffset = 0;
+                    State.FreeChunks.push_back(pChunk);
+                }
+            }
+            State.FrameChunks.clear();
+        }
     }
 
     IBuffer* GetBuffer() const { return m_pBuffer; }
@@ -189,6 +460,112 @@ private:
     };
     // We need to keep track of mapped data for every context
     std::vector<MapInfo> m_MapInfo;
+
+    struct Chunk
+    {
+        explicit Chunk(IBuffer* _pBuffer) :
+            pBuffer{_pBuffer},
+            Size{_pBuffer->GetDesc().Size}
+        {}
+
+        void FlushFrameData()
+        {
+            const Uint64 CurrOffset = (std::min)(Offset.load(std::memory_order_relaxed), Size);
+            if (MappedData && CurrOffset > FlushedOffset && (pBuffer->GetMemoryProperties() & MEMORY_PROPERTY_HOST_COHERENT) == 0)
+                pBuffer->FlushMappedRange(FlushedOffset, CurrOffset - FlushedOffset);
+            FlushedOffset = CurrOffset;
+        }
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        MapHelper<Uint8, true> MappedData;
+        const Uint64           Size;
+        std::atomic<Uint64>    Offset{0};
+        Uint64                 FlushedOffset = 0;
+        Uint64                 FenceValue    = 0;
+    };
+
+    // Replaces the exhausted chunk pExhaustedChunk with a free chunk that has at least MinSize bytes.
+    // Free chunks are mapped by ReserveChunks(), so no device context is used here.
+    bool SwitchChunk(Chunk* pExhaustedChunk, Uint64 MinSize)
+    {
+        ConcurrentState& State = *m_pConcurrentState;
+
+        std::lock_guard<std::mutex> Lock{State.Mtx};
+        if (State.pCurrChunk.load(std::memory_order_relaxed) != pExhaustedChunk)
+        {
+            // Another thread has already replaced the chunk
+            return true;
+        }
+
+        Chunk* pNewChunk = nullptr;
+        for (auto it = State.FreeChunks.begin(); it != State.FreeChunks.end(); ++it)
+        {
+            if ((*it)->Size >= MinSize)
+            {
+                pNewChunk = *it;
+                State.FreeChunks.erase(it);
+                break;
+            }
+        }
+
+        if (pNewChunk == nullptr)
+        {
+            // Make the next ReserveChunks() call create more chunks that are large enough
+            while (State.ChunkSize < MinSize)
+                State.ChunkSize *= 2;
+            State.ChunkRequestFailed = true;
+
+            LOG_ERROR_MESSAGE("Streaming buffer '", m_pBuffer->GetDesc().Name, "' has no free chunk for a ", MinSize,
+                              "-byte allocation. Call ReserveChunks() at the start of every frame to reserve enough chunks.");
+            return false;
+        }
+
+        if (pExhaustedChunk != nullptr)
+        {
+            // The exhausted chunk may contain allocations of the current frame and is retired by FinishCurrentFrame().
+            State.FrameChunks.push_back(pExhaustedChunk);
+        }
+        State.pCurrChunk.store(pNewChunk, std::memory_order_release);
+        return true;
+    }
+
+    struct ConcurrentState
+    {
+        ConcurrentState(IRenderDevice* _pDevice, Uint64 _ChunkSize) :
+            pDevice{_pDevice},
+            ChunkSize{_ChunkSize}
+        {}
+
+        RefCntAutoPtr<IRenderDevice> pDevice;
+
+        // Size of the chunks created by ReserveChunks()
+        Uint64 ChunkSize = 0;
+
+        // The number of chunks that served allocations in the previous frame
+        size_t PrevFrameChunkCount = 0;
+
+        // Whether an allocation in the current frame failed because there was no free chunk
+        bool ChunkRequestFailed = false;
+
+        Uint64 LastFenceValue = 0;
+
+        // Chunk that serves allocations. Only changed under the mutex.
+        std::atomic<Chunk*> pCurrChunk{nullptr};
+
+        mutable std::mutex Mtx;
+
+        std::vector<std::unique_ptr<Chunk>> Chunks;
+
+        // Chunks exhausted during the current frame
+        std::vector<Chunk*> FrameChunks;
+
+        // Chunks waiting for the GPU to reach their fence values
+        std::vector<Chunk*> RetiredChunks;
+
+        // Mapped chunks available for allocations
+        std::vector<Chunk*> FreeChunks;
+    };
+    std::unique_ptr<ConcurrentState> m_pConcurrentState;
 };
 
 } // namespace Diligent
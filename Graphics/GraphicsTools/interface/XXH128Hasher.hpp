@@ -39,6 +39,8 @@ struct XXH3_state_s;
 namespace Diligent
 {
 
+class ShaderIncludeCache;
+
 struct XXH128Hash
 {
     Uint64 LowPart  = {};
@@ -50,6 +52,11 @@ struct XXH128Hash
     {
         return LowPart == RHS.LowPart && HighPart == RHS.HighPart;
     }
+
+    constexpr bool operator!=(const XXH128Hash& RHS) const noexcept
+    {
+        return !(*this == RHS);
+    }
 };
 
 struct XXH128State final
@@ -124,7 +131,12 @@ struct XXH128State final
         return Update(Args...);
     }
 
-    XXH128State& Update(const ShaderCreateInfo& ShaderCI) noexcept;
+    /// Hashes the shader create info, including the content of the shader source file and all files it includes.
+
+    /// \param [in] ShaderCI     - Shader create info to hash.
+    /// \param [in] pSourceCache - Optional shader include cache. If provided, source files
+    ///                            that have not changed since they were last hashed are not read again.
+    XXH128State& Update(const ShaderCreateInfo& ShaderCI, ShaderIncludeCache* pSourceCache = nullptr) noexcept;
 
     template <typename T>
     typename std::enable_if<(std::is_same<typename std::remove_cv<T>::type, SamplerDesc>::value ||
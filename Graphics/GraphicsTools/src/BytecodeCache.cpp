@@ -24,19 +24,53 @@
  *  of the possibility of such damages.
  */
 
+#include <algorithm>
 #include <unordered_map>
+#include <vector>
 
 #include "RefCntAutoPtr.hpp"
 #include "DataBlobImpl.hpp"
+#include "ProxyDataBlob.hpp"
 #include "ObjectBase.hpp"
 #include "Serializer.hpp"
 #include "BytecodeCache.h"
 #include "XXH128Hasher.hpp"
+#include "ShaderToolsCommon.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 
 namespace Diligent
 {
 
+// Starting with version 3, the cache data consists of two sorted index tables followed by the
+// byte code. The tables are used in place, so loading the cache requires neither parsing
+// every element nor copying the byte code.
+//
+//  | Header | AliasCount | BytecodeIndexEntry[ElementCount] | AliasIndexEntry[AliasCount] | Byte code ... |
+//
+struct BytecodeIndexEntry
+{
+    // Byte code hash
+    XXH128Hash Hash = {};
+    // Offset of the byte code from the beginning of the cache data
+    Uint64 Offset = 0;
+    Uint64 Size   = 0;
+};
+DECL_TRIVIALLY_SERIALIZABLE(BytecodeIndexEntry);
+
+struct BytecodeAliasIndexEntry
+{
+    // Shader create info hash
+    XXH128Hash CIHash = {};
+    // Index of the byte code in the byte code index table
+    Uint64 BytecodeIndex = 0;
+};
+DECL_TRIVIALLY_SERIALIZABLE(BytecodeAliasIndexEntry);
+
+static bool HashLess(const XXH128Hash& LHS, const XXH128Hash& RHS)
+{
+    return LHS.HighPart < RHS.HighPart || (LHS.HighPart == RHS.HighPart && LHS.LowPart < RHS.LowPart);
+}
+
 /// Implementation of IBytecodeCache
 class BytecodeCacheImpl final : public ObjectBase<IBytecodeCache>
 {
@@ -46,7 +80,7 @@ public:
     struct BytecodeCacheHeader
     {
         static constexpr Uint32 HeaderMagic   = 0x7ADECACE;
-        static constexpr Uint32 HeaderVersion = 1;
+        static constexpr Uint32 HeaderVersion = 3;
 
         Uint32 Magic   = HeaderMagic;
         Uint32 Version = HeaderVersion;
@@ -60,6 +94,7 @@ public:
         }
     };
 
+    // Element header used by versions 1 and 2
     struct BytecodeCacheElementHeader
     {
         XXH128Hash Hash     = {};
@@ -72,6 +107,25 @@ public:
         }
     };
 
+    // Maps the shader create info hash to the byte code hash (version 2)
+    struct BytecodeCacheAliasHeader
+    {
+        XXH128Hash CIHash       = {};
+        XXH128Hash BytecodeHash = {};
+
+        template <typename SerType>
+        void Serialize(SerType& Stream)
+        {
+            Stream(CIHash.LowPart, CIHash.HighPart, BytecodeHash.LowPart, BytecodeHash.HighPart);
+        }
+    };
+
+    // Size of the header and the alias count in the version 3 data
+    static constexpr Uint64 IndexedHeaderSize = sizeof(Uint32) * 2 + sizeof(Uint64) * 2;
+
+    // Alignment of the byte code in the version 3 data
+    static constexpr Uint64 BytecodeAlignment = 16;
+
 public:
     BytecodeCacheImpl(IReferenceCounters*            pRefCounters,
                       const BytecodeCacheCreateInfo& CreateInfo) :
@@ -100,12 +154,19 @@ public:
             return false;
         }
 
-        if (Header.Version != BytecodeCacheHeader::HeaderVersion)
+        if (Header.Version == 3)
+            return LoadIndexed(pDataBlob, Header.ElementCount);
+
+        if (Header.Version != 2 && Header.Version != 1)
         {
             LOG_ERROR_MESSAGE("Incorrect bytecode header version (", Header.Version, "). ", Uint32{BytecodeCacheHeader::HeaderVersion}, " is expected.");
             return false;
         }
 
+        // In version 1, every element is keyed by the create info hash.
+        // In version 2, elements are keyed by the byte code hash and
+        // are followed by the list of create info hash aliases.
+        // Byte code that is already in the cache is not replaced.
         for (Uint64 ItemID = 0; ItemID < Header.ElementCount; ItemID++)
         {
             BytecodeCacheElementHeader ElementHeader;
@@ -113,7 +174,44 @@ public:
 
             RefCntAutoPtr<DataBlobImpl> pBytecode = DataBlobImpl::Create(ElementHeader.DataSize);
             Stream.CopyBytes(pBytecode->GetDataPtr(), ElementHeader.DataSize);
-            m_HashMap.emplace(ElementHeader.Hash, pBytecode);
+            if (Header.Version == 1)
+            {
+                if (!HasBytecode(ElementHeader.Hash))
+                    AddBytecodeInternal(ElementHeader.Hash, pBytecode);
+            }
+            else
+            {
+                m_Bytecodes.emplace(ElementHeader.Hash, BytecodeData{pBytecode});
+            }
+        }
+
+        if (Header.Version == 2)
+        {
+            Uint64 AliasCount = 0;
+            Stream(AliasCount);
+            for (Uint64 AliasID = 0; AliasID < AliasCount; AliasID++)
+            {
+                BytecodeCacheAliasHeader AliasHeader;
+                AliasHeader.Serialize(Stream);
+
+                auto bytecode_it = m_Bytecodes.find(AliasHeader.BytecodeHash);
+                if (bytecode_it == m_Bytecodes.end())
+                {
+                    LOG_ERROR_MESSAGE("Byte code referenced by the create info hash ", AliasHeader.CIHash.ToString(), " is not found. The cache data may be corrupted.");
+                    return false;
+                }
+                if (!HasBytecode(AliasHeader.CIHash))
+                    SetAlias(AliasHeader.CIHash, bytecode_it);
+            }
+
+            // Release the byte code that is only referenced by the create infos already in the cache
+            for (auto bytecode_it = m_Bytecodes.begin(); bytecode_it != m_Bytecodes.end();)
+            {
+                if (bytecode_it->second.NumAliases == 0)
+                    bytecode_it = m_Bytecodes.erase(bytecode_it);
+                else
+                    ++bytecode_it;
+            }
         }
 
         return true;
@@ -125,10 +223,25 @@ public:
         DEV_CHECK_ERR(*ppByteCode == nullptr, "*ppByteCode is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
         const XXH128Hash Hash = ComputeHash(ShaderCI);
 
-        const auto Iter = m_HashMap.find(Hash);
-        if (Iter != m_HashMap.end())
+        const auto alias_it = m_HashMap.find(Hash);
+        if (alias_it != m_HashMap.end())
+        {
+            const auto bytecode_it = m_Bytecodes.find(alias_it->second);
+            VERIFY(bytecode_it != m_Bytecodes.end(), "Byte code referenced by an alias must always be present in the cache");
+            if (bytecode_it != m_Bytecodes.end())
+            {
+                RefCntAutoPtr<IDataBlob> pObject = bytecode_it->second.pBytecode;
+                *ppByteCode                      = pObject.Detach();
+            }
+            return;
+        }
+
+        const LoadedData*         pData  = nullptr;
+        const BytecodeIndexEntry* pEntry = FindLoadedBytecode(Hash, pData);
+        if (pEntry != nullptr)
         {
-            RefCntAutoPtr<IDataBlob> pObject = Iter->second;
+            // Return a view into the loaded data without copying the byte code
+            RefCntAutoPtr<IDataBlob> pObject = ProxyDataBlob::Create(pData->GetBytecodePtr(*pEntry), StaticCast<size_t>(pEntry->Size), pData->pData);
             *ppByteCode                      = pObject.Detach();
         }
     }
@@ -136,17 +249,29 @@ public:
     virtual void DILIGENT_CALL_TYPE AddBytecode(const ShaderCreateInfo& ShaderCI, IDataBlob* pByteCode) override final
     {
         DEV_CHECK_ERR(pByteCode != nullptr, "pByteCode must not be null.");
-        const XXH128Hash Hash = ComputeHash(ShaderCI);
-
-        const auto Iter = m_HashMap.emplace(Hash, pByteCode);
-        if (!Iter.second)
-            Iter.first->second = pByteCode;
+        AddBytecodeInternal(ComputeHash(ShaderCI), pByteCode);
     }
 
     virtual void DILIGENT_CALL_TYPE RemoveBytecode(const ShaderCreateInfo& ShaderCI) override final
     {
         const XXH128Hash Hash = ComputeHash(ShaderCI);
-        m_HashMap.erase(Hash);
+
+        const auto alias_it = m_HashMap.find(Hash);
+        if (alias_it != m_HashMap.end())
+        {
+            ReleaseBytecode(alias_it->second);
+            m_HashMap.erase(alias_it);
+        }
+
+        for (const LoadedData& Data : m_LoadedData)
+        {
+            if (Data.FindBytecode(Hash) != nullptr)
+            {
+                // Data loaded later may add this create info again
+                m_RemovedAliases[Hash] = m_LoadedData.size();
+                break;
+            }
+        }
     }
 
     virtual void DILIGENT_CALL_TYPE Store(IDataBlob** ppDataBlob) override final
@@ -154,27 +279,95 @@ public:
         DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
         DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
 
+        // Collect the create info hash -> byte code mapping from the loaded data and the byte code added afterwards
+        struct LoadedAlias
+        {
+            const LoadedData*         pData  = nullptr;
+            const BytecodeIndexEntry* pEntry = nullptr;
+        };
+        std::unordered_map<XXH128Hash, LoadedAlias> LoadedAliases;
+        for (size_t DataIdx = 0; DataIdx < m_LoadedData.size(); ++DataIdx)
+        {
+            const LoadedData& Data = m_LoadedData[DataIdx];
+            for (size_t i = 0; i < Data.NumAliases; ++i)
+            {
+                const BytecodeAliasIndexEntry& Alias = Data.pAliases[i];
+                if (!IsRemoved(Alias.CIHash, DataIdx) && m_HashMap.find(Alias.CIHash) == m_HashMap.end())
+                    LoadedAliases.emplace(Alias.CIHash, LoadedAlias{&Data, &Data.pBytecodes[Alias.BytecodeIndex]});
+            }
+        }
+
+        struct BytecodeInfo
+        {
+            XXH128Hash  Hash;
+            const void* pData;
+            Uint64      Size;
+        };
+        std::vector<BytecodeInfo> Bytecodes;
+        Bytecodes.reserve(m_Bytecodes.size() + LoadedAliases.size());
+        for (const auto& it : m_Bytecodes)
+            Bytecodes.push_back({it.first, it.second.pBytecode->GetConstDataPtr(), it.second.pBytecode->GetSize()});
+        for (const auto& it : LoadedAliases)
+        {
+            const BytecodeIndexEntry& Entry = *it.second.pEntry;
+            if (m_Bytecodes.find(Entry.Hash) == m_Bytecodes.end())
+                Bytecodes.push_back({Entry.Hash, it.second.pData->GetBytecodePtr(Entry), Entry.Size});
+        }
+
+        std::sort(Bytecodes.begin(), Bytecodes.end(), [](const BytecodeInfo& LHS, const BytecodeInfo& RHS) { return HashLess(LHS.Hash, RHS.Hash); });
+        Bytecodes.erase(std::unique(Bytecodes.begin(), Bytecodes.end(), [](const BytecodeInfo& LHS, const BytecodeInfo& RHS) { return LHS.Hash == RHS.Hash; }), Bytecodes.end());
+        std::unordered_map<XXH128Hash, Uint64> BytecodeIndices;
+        for (size_t i = 0; i < Bytecodes.size(); ++i)
+            BytecodeIndices.emplace(Bytecodes[i].Hash, i);
+
+        std::vector<BytecodeAliasIndexEntry> Aliases;
+        Aliases.reserve(m_HashMap.size() + LoadedAliases.size());
+        for (const auto& it : m_HashMap)
+            Aliases.push_back({it.first, BytecodeIndices[it.second]});
+        for (const auto& it : LoadedAliases)
+            Aliases.push_back({it.first, BytecodeIndices[it.second.pEntry->Hash]});
+        std::sort(Aliases.begin(), Aliases.end(), [](const BytecodeAliasIndexEntry& LHS, const BytecodeAliasIndexEntry& RHS) { return HashLess(LHS.CIHash, RHS.CIHash); });
+
+        // Compute the byte code offsets
+        std::vector<BytecodeIndexEntry> Index(Bytecodes.size());
+        Uint64 Offset = IndexedHeaderSize + sizeof(BytecodeIndexEntry) * Index.size() + sizeof(BytecodeAliasIndexEntry) * Aliases.size();
+        for (size_t i = 0; i < Bytecodes.size(); ++i)
+        {
+            Offset          = AlignUp(Offset, BytecodeAlignment);
+            Index[i].Hash   = Bytecodes[i].Hash;
+            Index[i].Offset = Offset;
+            Index[i].Size   = Bytecodes[i].Size;
+            Offset += Bytecodes[i].Size;
+        }
+
         auto WriteData = [&](auto& Stream) //
         {
             BytecodeCacheHeader Header{};
-            Header.ElementCount = m_HashMap.size();
+            Header.ElementCount = Index.size();
             Header.Serialize(Stream);
 
-            for (auto const& Pair : m_HashMap)
-            {
-                const RefCntAutoPtr<IDataBlob>& pBytecode = Pair.second;
+            Uint64 AliasCount = Aliases.size();
+            Stream(AliasCount);
 
-                BytecodeCacheElementHeader ElementHeader;
-                ElementHeader.Hash     = Pair.first;
-                ElementHeader.DataSize = pBytecode->GetSize();
-                ElementHeader.Serialize(Stream);
+            for (const BytecodeIndexEntry& Entry : Index)
+                Stream(Entry);
+            for (const BytecodeAliasIndexEntry& Alias : Aliases)
+                Stream(Alias);
 
-                Stream.CopyBytes(pBytecode->GetConstDataPtr(), ElementHeader.DataSize);
+            // Every unique byte code is written only once
+            for (size_t i = 0; i < Index.size(); ++i)
+            {
+                static constexpr Uint8 Padding[BytecodeAlignment] = {};
+                VERIFY_EXPR(Index[i].Offset >= Stream.GetSize() && Index[i].Offset - Stream.GetSize() < BytecodeAlignment);
+                if (const size_t PaddingSize = StaticCast<size_t>(Index[i].Offset - Stream.GetSize()))
+                    Stream.CopyBytes(Padding, PaddingSize);
+                Stream.CopyBytes(Bytecodes[i].pData, StaticCast<size_t>(Bytecodes[i].Size));
             }
         };
 
         Serializer<SerializerMode::Measure> MeasureStream{};
         WriteData(MeasureStream);
+        VERIFY_EXPR(MeasureStream.GetSize() == Offset);
 
         const SerializedData Memory = MeasureStream.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
 
@@ -188,20 +381,215 @@ public:
     virtual void DILIGENT_CALL_TYPE Clear() override final
     {
         m_HashMap.clear();
+        m_Bytecodes.clear();
+        m_LoadedData.clear();
+        m_RemovedAliases.clear();
     }
 
 private:
+    struct BytecodeData
+    {
+        RefCntAutoPtr<IDataBlob> pBytecode;
+
+        // The number of create info hashes that reference this byte code
+        Uint32 NumAliases = 0;
+    };
+    using BytecodeMapType = std::unordered_map<XXH128Hash, BytecodeData>;
+
+    // Version 3 cache data that is used in place
+    struct LoadedData
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+
+        const BytecodeIndexEntry*      pBytecodes   = nullptr;
+        size_t                         NumBytecodes = 0;
+        const BytecodeAliasIndexEntry* pAliases     = nullptr;
+        size_t                         NumAliases   = 0;
+
+        const BytecodeIndexEntry* FindBytecode(const XXH128Hash& CIHash) const
+        {
+            const BytecodeAliasIndexEntry* pAliasesEnd = pAliases + NumAliases;
+
+            const BytecodeAliasIndexEntry* pAlias = std::lower_bound(pAliases, pAliasesEnd, CIHash,
+                                                                     [](const BytecodeAliasIndexEntry& Alias, const XXH128Hash& Hash) {
+                                                                         return HashLess(Alias.CIHash, Hash);
+                                                                     });
+            return (pAlias != pAliasesEnd && pAlias->CIHash == CIHash) ? &pBytecodes[pAlias->BytecodeIndex] : nullptr;
+        }
+
+        const void* GetBytecodePtr(const BytecodeIndexEntry& Entry) const
+        {
+            return pData->GetConstDataPtr<Uint8>() + Entry.Offset;
+        }
+    };
+
+    bool LoadIndexed(IDataBlob* pDataBlob, Uint64 ElementCount)
+    {
+        RefCntAutoPtr<IDataBlob> pData{pDataBlob};
+        if (reinterpret_cast<size_t>(pData->GetConstDataPtr()) % alignof(BytecodeIndexEntry) != 0)
+        {
+            // The index tables are accessed in place and must be properly aligned
+            pData = DataBlobImpl::Create(pDataBlob->GetSize(), pDataBlob->GetConstDataPtr());
+        }
+
+        Serializer<SerializerMode::Read> Stream{SerializedData{pData->GetDataPtr(), pData->GetSize()}};
+
+        BytecodeCacheHeader Header;
+        Header.Serialize(Stream);
+        Uint64 AliasCount = 0;
+        Stream(AliasCount);
+
+        const Uint64 DataSize = pData->GetSize();
+        if (ElementCount > Stream.GetRemainingSize() / sizeof(BytecodeIndexEntry) ||
+            AliasCount > (Stream.GetRemainingSize() - ElementCount * sizeof(BytecodeIndexEntry)) / sizeof(BytecodeAliasIndexEntry))
+        {
+            LOG_ERROR_MESSAGE("Not enough data to read the byte code cache index. The cache data may be corrupted.");
+            return false;
+        }
+
+        LoadedData Data;
+        Data.NumBytecodes = StaticCast<size_t>(ElementCount);
+        Data.NumAliases   = StaticCast<size_t>(AliasCount);
+        Data.pBytecodes   = static_cast<const BytecodeIndexEntry*>(Stream.GetCurrentPtr());
+        Data.pAliases     = reinterpret_cast<const BytecodeAliasIndexEntry*>(Data.pBytecodes + Data.NumBytecodes);
+
+        // Validate the index without copying it. Lookups rely on the tables being sorted.
+        for (size_t i = 0; i < Data.NumBytecodes; ++i)
+        {
+            const BytecodeIndexEntry& Entry = Data.pBytecodes[i];
+            if (Entry.Offset > DataSize || Entry.Size > DataSize - Entry.Offset || (i > 0 && !HashLess(Data.pBytecodes[i - 1].Hash, Entry.Hash)))
+            {
+                LOG_ERROR_MESSAGE("Byte code index entry ", i, " is invalid. The cache data may be corrupted.");
+                return false;
+            }
+        }
+        for (size_t i = 0; i < Data.NumAliases; ++i)
+        {
+            const BytecodeAliasIndexEntry& Alias = Data.pAliases[i];
+            if (Alias.BytecodeIndex >= ElementCount || (i > 0 && !HashLess(Data.pAliases[i - 1].CIHash, Alias.CIHash)))
+            {
+                LOG_ERROR_MESSAGE("Byte code alias entry ", i, " is invalid. The cache data may be corrupted.");
+                return false;
+            }
+        }
+
+        // Byte code that is already in the cache is not replaced: the byte code added
+        // earlier and the data loaded earlier take precedence in GetBytecode and Store.
+        Data.pData = std::move(pData);
+        m_LoadedData.emplace_back(std::move(Data));
+
+        return true;
+    }
+
+    bool IsRemoved(const XXH128Hash& CIHash, size_t DataIdx) const
+    {
+        const auto removed_it = m_RemovedAliases.find(CIHash);
+        return removed_it != m_RemovedAliases.end() && DataIdx < removed_it->second;
+    }
+
+    // Finds the byte code for the create info hash in the loaded data.
+    // The data that was loaded first takes precedence.
+    const BytecodeIndexEntry* FindLoadedBytecode(const XXH128Hash& CIHash, const LoadedData*& pData) const
+    {
+        for (size_t DataIdx = 0; DataIdx < m_LoadedData.size(); ++DataIdx)
+        {
+            if (IsRemoved(CIHash, DataIdx))
+                continue;
+
+            if (const BytecodeIndexEntry* pEntry = m_LoadedData[DataIdx].FindBytecode(CIHash))
+            {
+                pData = &m_LoadedData[DataIdx];
+                return pEntry;
+            }
+        }
+        return nullptr;
+    }
+
+    bool HasBytecode(const XXH128Hash& CIHash) const
+    {
+        if (m_HashMap.find(CIHash) != m_HashMap.end())
+            return true;
+
+        const LoadedData* pData = nullptr;
+        return FindLoadedBytecode(CIHash, pData) != nullptr;
+    }
+
     XXH128Hash ComputeHash(const ShaderCreateInfo& ShaderCI) const
     {
         XXH128State Hasher;
-        Hasher.Update(ShaderCI, m_DeviceType);
+        Hasher.Update(ShaderCI, &m_SourceCache);
+        Hasher.Update(m_DeviceType);
         return Hasher.Digest();
     }
 
+    static XXH128Hash ComputeBytecodeHash(IDataBlob* pByteCode)
+    {
+        XXH128State Hasher;
+        Hasher.UpdateRaw(pByteCode->GetConstDataPtr(), pByteCode->GetSize());
+        return Hasher.Digest();
+    }
+
+    void AddBytecodeInternal(const XXH128Hash& CIHash, IDataBlob* pByteCode)
+    {
+        const XXH128Hash BytecodeHash = ComputeBytecodeHash(pByteCode);
+
+        auto bytecode_it = m_Bytecodes.emplace(BytecodeHash, BytecodeData{RefCntAutoPtr<IDataBlob>{pByteCode}}).first;
+        SetAlias(CIHash, bytecode_it);
+    }
+
+    void SetAlias(const XXH128Hash& CIHash, BytecodeMapType::iterator bytecode_it)
+    {
+        auto alias_it = m_HashMap.emplace(CIHash, bytecode_it->first);
+        if (!alias_it.second)
+        {
+            if (alias_it.first->second == bytecode_it->first)
+                return;
+
+            // Byte code for this create info is replaced
+            const XXH128Hash PrevBytecodeHash = alias_it.first->second;
+            alias_it.first->second            = bytecode_it->first;
+            ++bytecode_it->second.NumAliases;
+            ReleaseBytecode(PrevBytecodeHash);
+        }
+        else
+        {
+            ++bytecode_it->second.NumAliases;
+        }
+    }
+
+    void ReleaseBytecode(const XXH128Hash& BytecodeHash)
+    {
+        auto bytecode_it = m_Bytecodes.find(BytecodeHash);
+        if (bytecode_it == m_Bytecodes.end())
+        {
+            UNEXPECTED("Byte code is not found in the cache");
+            return;
+        }
+
+        VERIFY_EXPR(bytecode_it->second.NumAliases > 0);
+        if (--bytecode_it->second.NumAliases == 0)
+            m_Bytecodes.erase(bytecode_it);
+    }
+
 private:
     RENDER_DEVICE_TYPE m_DeviceType;
 
-    std::unordered_map<XXH128Hash, RefCntAutoPtr<IDataBlob>> m_HashMap;
+    // Create info hash -> byte code hash
+    std::unordered_map<XXH128Hash, XXH128Hash> m_HashMap;
+
+    // Byte code hash -> byte code. Identical byte code produced from
+    // different create infos is stored only once.
+    BytecodeMapType m_Bytecodes;
+
+    // Cache data loaded in the indexed format. The byte code is returned as views into this data.
+    std::vector<LoadedData> m_LoadedData;
+
+    // Create info hash removed from the loaded data -> the number of loaded data
+    // blobs it was removed from. Data loaded afterwards may add it again.
+    std::unordered_map<XXH128Hash, size_t> m_RemovedAliases;
+
+    // Source files are not part of the cache data and only speed up hashing of file-based shaders
+    mutable ShaderIncludeCache m_SourceCache;
 };
 
 void CreateBytecodeCache(const BytecodeCacheCreateInfo& CreateInfo,
@@ -29,6 +29,7 @@
 #include "Align.hpp"
 #include "Atomics.hpp"
 #include "GraphicsAccessories.hpp"
+#include "CPUProfiler.hpp"
 
 #include <vector>
 #include <cstring>
@@ -1346,6 +1347,8 @@ GPUUploadManagerImpl::~GPUUploadManagerImpl()
 
 void GPUUploadManagerImpl::RenderThreadUpdate(IDeviceContext* pContext)
 {
+    DILIGENT_PROFILE_SCOPE("GPUUploadManagerImpl::RenderThreadUpdate");
+
     if (m_Stopping.load(std::memory_order_acquire))
     {
         DEV_ERROR("GPU upload manager has been stopped");
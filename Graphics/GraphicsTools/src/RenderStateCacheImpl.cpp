@@ -49,6 +49,7 @@
 #include "GraphicsUtilities.h"
 #include "ShaderSourceFactoryUtils.hpp"
 #include "DXCompiler.hpp"
+#include "CPUProfiler.hpp"
 
 namespace Diligent
 {
@@ -100,25 +101,16 @@ void RenderStateCacheImpl::Reset()
 {
     m_pDearchiver->Reset();
     m_pArchiver->Reset();
-    m_Shaders.clear();
-    m_ReloadableShaders.clear();
-    m_Pipelines.clear();
-    m_ReloadablePipelines.clear();
+    m_Shaders.Clear();
+    m_ReloadableShaders.Clear();
+    m_Pipelines.Clear();
+    m_ReloadablePipelines.Clear();
+    m_SourceCache.Clear();
 }
 
 RefCntAutoPtr<IShader> RenderStateCacheImpl::FindReloadableShader(IShader* pShader)
 {
-    std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
-
-    auto it = m_ReloadableShaders.find(pShader->GetUniqueID());
-    if (it == m_ReloadableShaders.end())
-        return {};
-
-    auto pReloadableShader = it->second.Lock();
-    if (!pReloadableShader)
-        m_ReloadableShaders.erase(it);
-
-    return pReloadableShader;
+    return m_ReloadableShaders.Get(std::to_string(pShader->GetUniqueID()).c_str());
 }
 
 std::string RenderStateCacheImpl::MakeHashStr(const char* Name, const XXH128Hash& Hash)
@@ -157,8 +149,7 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
     // clang-format off
     m_pDevice      {CreateInfo.pDevice},
     m_DeviceType   {CreateInfo.pDevice != nullptr ? CreateInfo.pDevice->GetDeviceInfo().Type : RENDER_DEVICE_TYPE_UNDEFINED},
-    m_CI           {CreateInfo},
-    m_pReloadSource{CreateInfo.pReloadSource}
+    m_CI           {CreateInfo}
 // clang-format on
 {
     if (CreateInfo.pDevice == nullptr)
@@ -166,6 +157,13 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
         LOG_ERROR_AND_THROW("CreateInfo.pDevice must not be null");
     }
 
+    if (CreateInfo.pReloadSource != nullptr)
+    {
+        // Reloaded shaders typically share most of their include files, so keep the files
+        // loaded from the reload source in memory and only re-read the ones that changed.
+        m_pReloadSource = CreateCachingShaderSourceFactory(CreateInfo.pReloadSource);
+    }
+
     if (CreateInfo.pArchiverFactory == nullptr)
     {
         LOG_ERROR_AND_THROW("CreateInfo.pArchiverFactory must not be null. Use LoadAndGetArchiverFactory() from ArchiverFactoryLoader.h to create the factory.");
@@ -259,18 +257,9 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
     if (m_CI.EnableHotReload)
     {
         // Wrap shader in a reloadable shader object
-        {
-            std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
-
-            auto it = m_ReloadableShaders.find(pShader->GetUniqueID());
-            if (it != m_ReloadableShaders.end())
-            {
-                if (RefCntAutoPtr<IShader> pReloadableShader = it->second.Lock())
-                    *ppShader = pReloadableShader.Detach();
-                else
-                    m_ReloadableShaders.erase(it);
-            }
-        }
+        const std::string ReloadableKey = std::to_string(pShader->GetUniqueID());
+        if (RefCntAutoPtr<IShader> pReloadableShader = m_ReloadableShaders.Get(ReloadableKey.c_str()))
+            *ppShader = pReloadableShader.Detach();
 
         if (*ppShader == nullptr)
         {
@@ -292,10 +281,13 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
                     _ShaderCI.pShaderSourceStreamFactory = m_pReloadSource;
                 }
             }
-            ReloadableShader::Create(this, pShader, _ShaderCI, ppShader);
-
-            std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
-            m_ReloadableShaders.emplace(pShader->GetUniqueID(), RefCntWeakPtr<IShader>{*ppShader});
+            RefCntAutoPtr<IShader> pReloadableShader;
+            ReloadableShader::Create(this, pShader, _ShaderCI, &pReloadableShader);
+            if (pReloadableShader)
+            {
+                // Another thread may have wrapped the same shader in the meantime
+                *ppShader = m_ReloadableShaders.Set(ReloadableKey.c_str(), pReloadableShader).Detach();
+            }
         }
     }
     else
@@ -327,6 +319,8 @@ static void HashShaderCIByFileName(XXH128State& Hasher, const ShaderCreateInfo&
 bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI,
                                                 IShader**               ppShader)
 {
+    DILIGENT_PROFILE_SCOPE("RenderStateCacheImpl::CreateShader");
+
     VERIFY_EXPR(ppShader != nullptr && *ppShader == nullptr);
 
     XXH128State Hasher;
@@ -338,7 +332,7 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
     ComputeDeviceAttribsHash(Hasher, m_pDevice);
     if (m_CI.FileHashMode == RENDER_STATE_CACHE_FILE_HASH_MODE_BY_CONTENT)
     {
-        Hasher.Update(ShaderCI);
+        Hasher.Update(ShaderCI, &m_SourceCache);
     }
     else if (m_CI.FileHashMode == RENDER_STATE_CACHE_FILE_HASH_MODE_BY_NAME)
     {
@@ -351,51 +345,46 @@ bool RenderStateCacheImpl::CreateShaderInternal(const ShaderCreateInfo& ShaderCI
     Hasher.Update(IsDebug);
     const XXH128Hash Hash = Hasher.Digest();
 
+    const std::string CacheKey = Hash.ToString();
+
     // First, try to check if the shader has already been requested
+    if (RefCntAutoPtr<IShader> pShader = m_Shaders.Get(CacheKey.c_str()))
     {
-        std::lock_guard<std::mutex> Guard{m_ShadersMtx};
-
-        auto it = m_Shaders.find(Hash);
-        if (it != m_Shaders.end())
-        {
-            if (RefCntAutoPtr<IShader> pShader = it->second.Lock())
-            {
-                *ppShader = pShader.Detach();
-                RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing existing shader '", (ShaderCI.Desc.Name ? ShaderCI.Desc.Name : ""), "'.");
-                return true;
-            }
-            else
-            {
-                m_Shaders.erase(it);
-            }
-        }
+        *ppShader = pShader.Detach();
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing existing shader '", (ShaderCI.Desc.Name ? ShaderCI.Desc.Name : ""), "'.");
+        return true;
     }
 
     class AddShaderHelper
     {
     public:
-        AddShaderHelper(RenderStateCacheImpl& Cache, const XXH128Hash& Hash, IShader** ppShader) :
+        AddShaderHelper(RenderStateCacheImpl& Cache, const std::string& CacheKey, IShader** ppShader) :
             m_Cache{Cache},
-            m_Hash{Hash},
+            m_CacheKey{CacheKey},
             m_ppShader{ppShader}
         {
         }
 
         ~AddShaderHelper()
         {
-            if (*m_ppShader != nullptr)
+            if (*m_ppShader == nullptr)
+                return;
+
+            // If another thread has added the same shader in the meantime, use that shader
+            RefCntAutoPtr<IShader> pShader = m_Cache.m_Shaders.Set(m_CacheKey.c_str(), *m_ppShader);
+            if (pShader.RawPtr() != *m_ppShader)
             {
-                std::lock_guard<std::mutex> Guard{m_Cache.m_ShadersMtx};
-                m_Cache.m_Shaders.emplace(m_Hash, *m_ppShader);
+                (*m_ppShader)->Release();
+                *m_ppShader = pShader.Detach();
             }
         }
 
     private:
         RenderStateCacheImpl& m_Cache;
-        const XXH128Hash&     m_Hash;
+        const std::string&    m_CacheKey;
         IShader** const       m_ppShader;
     };
-    AddShaderHelper AutoAddShader{*this, Hash, ppShader};
+    AddShaderHelper AutoAddShader{*this, CacheKey, ppShader};
 
     const std::string HashStr = MakeHashStr(ShaderCI.Desc.Name, Hash);
 
@@ -742,25 +731,19 @@ bool RenderStateCacheImpl::CreatePipelineState(const CreateInfoType& PSOCreateIn
 
     if (m_CI.EnableHotReload)
     {
-        {
-            std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
-
-            auto it = m_ReloadablePipelines.find(pPSO->GetUniqueID());
-            if (it != m_ReloadablePipelines.end())
-            {
-                if (RefCntAutoPtr<IPipelineState> pReloadablePSO = it->second.Lock())
-                    *ppPipelineState = pReloadablePSO.Detach();
-                else
-                    m_ReloadablePipelines.erase(it);
-            }
-        }
+        const std::string ReloadableKey = std::to_string(pPSO->GetUniqueID());
+        if (RefCntAutoPtr<IPipelineState> pReloadablePSO = m_ReloadablePipelines.Get(ReloadableKey.c_str()))
+            *ppPipelineState = pReloadablePSO.Detach();
 
         if (*ppPipelineState == nullptr)
         {
-            ReloadablePipelineState::Create(this, pPSO, PSOCreateInfo, ppPipelineState);
-
-            std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
-            m_ReloadablePipelines.emplace(pPSO->GetUniqueID(), RefCntWeakPtr<IPipelineState>(*ppPipelineState));
+            RefCntAutoPtr<IPipelineState> pReloadablePSO;
+            ReloadablePipelineState::Create(this, pPSO, PSOCreateInfo, &pReloadablePSO);
+            if (pReloadablePSO)
+            {
+                // Another thread may have wrapped the same pipeline in the meantime
+                *ppPipelineState = m_ReloadablePipelines.Set(ReloadableKey.c_str(), pReloadablePSO).Detach();
+            }
         }
     }
     else
@@ -775,6 +758,8 @@ template <typename CreateInfoType>
 bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSOCreateInfo,
                                                        IPipelineState**      ppPipelineState)
 {
+    DILIGENT_PROFILE_SCOPE("RenderStateCacheImpl::CreatePipelineState");
+
     VERIFY_EXPR(ppPipelineState != nullptr && *ppPipelineState == nullptr);
 
     const SHADER_STATUS ShadersStatus = GetPipelineStateCreateInfoShadersStatus<CreateInfoType>(PSOCreateInfo);
@@ -799,24 +784,14 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
     Hasher.Update(PSOCreateInfo);
     const auto Hash = Hasher.Digest();
 
+    const std::string CacheKey = Hash.ToString();
+
     // First, try to check if the PSO has already been requested
+    if (RefCntAutoPtr<IPipelineState> pPSO = m_Pipelines.Get(CacheKey.c_str()))
     {
-        std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
-
-        auto it = m_Pipelines.find(Hash);
-        if (it != m_Pipelines.end())
-        {
-            if (RefCntAutoPtr<IPipelineState> pPSO = it->second.Lock())
-            {
-                *ppPipelineState = pPSO.Detach();
-                RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing existing pipeline '", (PSOCreateInfo.PSODesc.Name ? PSOCreateInfo.PSODesc.Name : ""), "'.");
-                return true;
-            }
-            else
-            {
-                m_Pipelines.erase(it);
-            }
-        }
+        *ppPipelineState = pPSO.Detach();
+        RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing existing pipeline '", (PSOCreateInfo.PSODesc.Name ? PSOCreateInfo.PSODesc.Name : ""), "'.");
+        return true;
     }
 
     const std::string HashStr = MakeHashStr(PSOCreateInfo.PSODesc.Name, Hash);
@@ -879,8 +854,16 @@ bool RenderStateCacheImpl::CreatePipelineStateInternal(const CreateInfoType& PSO
     }
 
     {
-        std::lock_guard<std::mutex> Guard{m_PipelinesMtx};
-        m_Pipelines.emplace(Hash, *ppPipelineState);
+        // If another thread has added the same pipeline in the meantime, use that pipeline
+        RefCntAutoPtr<IPipelineState> pPSO = m_Pipelines.Set(CacheKey.c_str(), *ppPipelineState);
+        if (pPSO.RawPtr() != *ppPipelineState)
+        {
+            (*ppPipelineState)->Release();
+            *ppPipelineState = pPSO.Detach();
+            // The thread that added the pipeline to the cache is responsible for archiving it
+            RENDER_STATE_CACHE_LOG(RENDER_STATE_CACHE_LOG_LEVEL_VERBOSE, "Reusing pipeline '", HashStr, "' created by another thread.");
+            return true;
+        }
     }
 
     if (FoundInCache)
@@ -928,47 +911,36 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
 
     Uint32 NumStatesReloaded = 0;
 
-    // Reload all shaders first
+    // Reload all shaders first.
+    // Note that the objects are reloaded without holding any map locks.
+    for (const RefCntAutoPtr<IShader>& pShader : m_ReloadableShaders.GetLiveObjects())
     {
-        std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
-        for (auto shader_it : m_ReloadableShaders)
+        RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
+        if (pReloadableShader)
         {
-            if (RefCntAutoPtr<IShader> pShader = shader_it.second.Lock())
-            {
-                RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
-                if (pReloadableShader)
-                {
-                    if (pReloadableShader->Reload())
-                        ++NumStatesReloaded;
-                }
-                else
-                {
-                    UNEXPECTED("Shader object is not a ReloadableShader");
-                }
-            }
+            if (pReloadableShader->Reload())
+                ++NumStatesReloaded;
+        }
+        else
+        {
+            UNEXPECTED("Shader object is not a ReloadableShader");
         }
     }
 
     // Reload pipelines.
     // Note that create info structs reference reloadable shaders, so that when pipelines
     // are re-created, they will automatically use reloaded shaders.
+    for (const RefCntAutoPtr<IPipelineState>& pPSO : m_ReloadablePipelines.GetLiveObjects())
     {
-        std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
-        for (auto pso_it : m_ReloadablePipelines)
+        RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
+        if (pReloadablePSO)
         {
-            if (RefCntAutoPtr<IPipelineState> pPSO = pso_it.second.Lock())
-            {
-                RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
-                if (pPSO)
-                {
-                    if (pReloadablePSO->Reload(ReloadGraphicsPipeline, pUserData))
-                        ++NumStatesReloaded;
-                }
-                else
-                {
-                    UNEXPECTED("Pipeline state object is not a ReloadablePipelineState");
-                }
-            }
+            if (pReloadablePSO->Reload(ReloadGraphicsPipeline, pUserData))
+                ++NumStatesReloaded;
+        }
+        else
+        {
+            UNEXPECTED("Pipeline state object is not a ReloadablePipelineState");
         }
     }
 
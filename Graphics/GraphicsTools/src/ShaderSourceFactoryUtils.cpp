@@ -35,14 +35,16 @@
 #include "RefCntAutoPtr.hpp"
 #include "StringDataBlobImpl.hpp"
 #include "MemoryFileStream.hpp"
+#include "ShaderSourceFileStampProvider.hpp"
+#include "ShaderToolsCommon.hpp"
 
 namespace Diligent
 {
 
-class CompoundShaderSourceFactory : public ObjectBase<IShaderSourceInputStreamFactory>
+class CompoundShaderSourceFactory : public ObjectBase<IShaderSourceFileStampProvider>
 {
 public:
-    using TBase = ObjectBase<IShaderSourceInputStreamFactory>;
+    using TBase = ObjectBase<IShaderSourceFileStampProvider>;
 
     static RefCntAutoPtr<IShaderSourceInputStreamFactory> Create(const CompoundShaderSourceFactoryCreateInfo& CreateInfo)
     {
@@ -71,7 +73,7 @@ public:
         }
     }
 
-    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, TBase)
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_IShaderSourceInputStreamFactory, IID_ShaderSourceFileStampProvider, TBase)
 
     virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char*   Name,
                                                       IFileStream** ppStream) override final
@@ -84,12 +86,7 @@ public:
                                                        IFileStream**                           ppStream) override final
     {
         VERIFY_EXPR(ppStream != nullptr && *ppStream == nullptr);
-        if (!m_FileSubstituteMap.empty())
-        {
-            auto it = m_FileSubstituteMap.find(Name);
-            if (it != m_FileSubstituteMap.end())
-                Name = it->second.c_str();
-        }
+        Name = SubstituteFileName(Name);
 
         for (size_t i = 0; i < m_pFactories.size() && *ppStream == nullptr; ++i)
         {
@@ -103,6 +100,46 @@ public:
         }
     }
 
+    virtual bool GetFileStamp(const Char* Name, std::string& FullPath, FileStat& Stat) override final
+    {
+        Name = SubstituteFileName(Name);
+
+        for (const RefCntAutoPtr<IShaderSourceInputStreamFactory>& pFactory : m_pFactories)
+        {
+            if (!pFactory)
+                continue;
+
+            if (RefCntAutoPtr<IShaderSourceFileStampProvider> pStampProvider{pFactory, IID_ShaderSourceFileStampProvider})
+            {
+                if (pStampProvider->GetFileStamp(Name, FullPath, Stat))
+                    return true;
+            }
+            else
+            {
+                // If a factory that can't provide file stamps has the file, it will take precedence
+                // in CreateInputStream, so the stamp of the file from the next factories is not valid.
+                RefCntAutoPtr<IFileStream> pStream;
+                pFactory->CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pStream);
+                if (pStream)
+                    return false;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    const Char* SubstituteFileName(const Char* Name) const
+    {
+        if (!m_FileSubstituteMap.empty())
+        {
+            auto it = m_FileSubstituteMap.find(Name);
+            if (it != m_FileSubstituteMap.end())
+                return it->second.c_str();
+        }
+        return Name;
+    }
+
 private:
     std::vector<RefCntAutoPtr<IShaderSourceInputStreamFactory>> m_pFactories;
 
@@ -200,6 +237,80 @@ void CreateMemoryShaderSourceFactory(const MemoryShaderSourceFactoryCreateInfo&
 }
 
 
+
+class CachingShaderSourceFactory final : public ObjectBase<IShaderSourceFileStampProvider>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceFileStampProvider>;
+
+    static RefCntAutoPtr<IShaderSourceInputStreamFactory> Create(IShaderSourceInputStreamFactory* pSourceFactory)
+    {
+        return RefCntAutoPtr<IShaderSourceInputStreamFactory>{MakeNewRCObj<CachingShaderSourceFactory>()(pSourceFactory)};
+    }
+
+    CachingShaderSourceFactory(IReferenceCounters*              pRefCounters,
+                               IShaderSourceInputStreamFactory* pSourceFactory) :
+        TBase{pRefCounters},
+        m_pSourceFactory{pSourceFactory},
+        m_pStampProvider{pSourceFactory, IID_ShaderSourceFileStampProvider}
+    {
+    }
+
+    IMPLEMENT_QUERY_INTERFACE2_IN_PLACE(IID_IShaderSourceInputStreamFactory, IID_ShaderSourceFileStampProvider, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char*   Name,
+                                                      IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        VERIFY_EXPR(ppStream != nullptr && *ppStream == nullptr);
+        if (!m_pStampProvider)
+        {
+            // Files can't be validated, so there is nothing to cache
+            m_pSourceFactory->CreateInputStream2(Name, Flags, ppStream);
+            return;
+        }
+
+        if (std::shared_ptr<const ShaderIncludeCache::FileData> pFile = m_Cache.GetFile(m_pSourceFactory, Name))
+        {
+            // All streams share the cached blob, so opening a cached file only costs copying its content
+            RefCntAutoPtr<MemoryFileStream> pMemStream{MakeNewRCObj<MemoryFileStream>()(pFile->pData.RawPtr())};
+            pMemStream->QueryInterface(IID_FileStream, ppStream);
+        }
+        else if ((Flags & CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT) == 0)
+        {
+            LOG_ERROR("Failed to create input stream for source file ", Name);
+        }
+    }
+
+    virtual bool GetFileStamp(const Char* Name, std::string& FullPath, FileStat& Stat) override final
+    {
+        return m_pStampProvider && m_pStampProvider->GetFileStamp(Name, FullPath, Stat);
+    }
+
+private:
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pSourceFactory;
+    RefCntAutoPtr<IShaderSourceFileStampProvider>  m_pStampProvider;
+
+    ShaderIncludeCache m_Cache;
+};
+
+void CreateCachingShaderSourceFactory(IShaderSourceInputStreamFactory* pSourceFactory, IShaderSourceInputStreamFactory** ppFactory)
+{
+    DEV_CHECK_ERR(pSourceFactory != nullptr, "Source factory must not be null");
+    DEV_CHECK_ERR(ppFactory != nullptr && *ppFactory == nullptr, "ppFactory must not be null and must point to a null pointer");
+    if (pSourceFactory == nullptr || ppFactory == nullptr)
+        return;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pFactory = CachingShaderSourceFactory::Create(pSourceFactory);
+    pFactory->QueryInterface(IID_IShaderSourceInputStreamFactory, ppFactory);
+}
+
 } // namespace Diligent
 
 extern "C"
@@ -215,4 +326,10 @@ extern "C"
     {
         Diligent::CreateMemoryShaderSourceFactory(CreateInfo, ppFactory);
     }
+
+    void Diligent_CreateCachingShaderSourceFactory(Diligent::IShaderSourceInputStreamFactory*  pSourceFactory,
+                                                   Diligent::IShaderSourceInputStreamFactory** ppFactory)
+    {
+        Diligent::CreateCachingShaderSourceFactory(pSourceFactory, ppFactory);
+    }
 }
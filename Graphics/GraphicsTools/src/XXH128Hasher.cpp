@@ -26,6 +26,9 @@
 
 #include "XXH128Hasher.hpp"
 
+#include <cstring>
+#include <unordered_set>
+
 #include "xxhash.h"
 
 #include "DebugUtilities.hpp"
@@ -77,7 +80,74 @@ XXH128Hash XXH128State::Digest() noexcept
     return {Hash.low64, Hash.high64};
 }
 
-XXH128State& XXH128State::Update(const ShaderCreateInfo& ShaderCI) noexcept
+namespace
+{
+
+using SourceFileData = ShaderIncludeCache::FileData;
+
+// Walks the include graph of a shader in the same depth-first order as ProcessShaderIncludes
+// and hashes the content hash of every source file. The result is the same whether or not
+// the include cache is used.
+class ShaderSourceTreeHasher
+{
+public:
+    ShaderSourceTreeHasher(const ShaderCreateInfo& ShaderCI, ShaderIncludeCache* pCache) :
+        m_pFactory{ShaderCI.pShaderSourceStreamFactory},
+        m_pCache{pCache}
+    {}
+
+    void Hash(const ShaderCreateInfo& ShaderCI, XXH128State& Hasher) noexcept(false)
+    {
+        std::shared_ptr<const SourceFileData> pFile = ShaderCI.Source != nullptr ?
+            ShaderIncludeCache::ParseSource(ShaderCI.Source, ShaderCI.SourceLength != 0 ? ShaderCI.SourceLength : strlen(ShaderCI.Source)) :
+            GetFile(ShaderCI.FilePath);
+        HashTree(*pFile, Hasher);
+    }
+
+private:
+    std::shared_ptr<const SourceFileData> GetFile(const char* FilePath) noexcept(false)
+    {
+        if (m_pCache != nullptr && m_pFactory != nullptr)
+        {
+            std::shared_ptr<const SourceFileData> pFile = m_pCache->GetFile(m_pFactory, FilePath);
+            if (!pFile)
+                LOG_ERROR_AND_THROW("Failed to load shader source file '", FilePath, '\'');
+            return pFile;
+        }
+
+        ShaderSourceFileData SourceData = ReadShaderSourceFile(nullptr, 0, m_pFactory, FilePath);
+        return ShaderIncludeCache::ParseSource(SourceData.Source, SourceData.SourceLength, std::move(SourceData.pFileData));
+    }
+
+    void HashTree(const SourceFileData& File, XXH128State& Hasher) noexcept(false)
+    {
+        if (!File.ParseError.empty())
+            LOG_ERROR_AND_THROW("Failed to find includes: ", File.ParseError);
+
+        for (const ShaderIncludeCache::IncludeDirective& Include : File.Includes)
+        {
+            if (!m_Visited.insert(Include.FilePath).second)
+                continue;
+
+            std::shared_ptr<const SourceFileData> pIncludeFile = GetFile(Include.FilePath.c_str());
+            HashTree(*pIncludeFile, Hasher);
+        }
+
+        XXH128Hash ContentHash;
+        if (File.SourceLength > 0)
+            ContentHash = XXH128State{}.UpdateRaw(File.Source, File.SourceLength).Digest();
+        Hasher.Update(ContentHash.LowPart, ContentHash.HighPart);
+    }
+
+private:
+    IShaderSourceInputStreamFactory* const m_pFactory;
+    ShaderIncludeCache* const              m_pCache;
+    std::unordered_set<std::string>        m_Visited;
+};
+
+} // namespace
+
+XXH128State& XXH128State::Update(const ShaderCreateInfo& ShaderCI, ShaderIncludeCache* pSourceCache) noexcept
 {
     ASSERT_SIZEOF64(ShaderCI, 152, "Did you add new members to ShaderCreateInfo? Please handle them here.");
 
@@ -97,9 +167,14 @@ XXH128State& XXH128State::Update(const ShaderCreateInfo& ShaderCI) noexcept
     if (ShaderCI.Source != nullptr || ShaderCI.FilePath != nullptr)
     {
         DEV_CHECK_ERR(ShaderCI.ByteCode == nullptr, "ShaderCI.ByteCode must be null when either Source or FilePath is specified");
-        ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& ProcessInfo) {
-            UpdateStr(ProcessInfo.Source, ProcessInfo.SourceLength);
-        });
+        try
+        {
+            ShaderSourceTreeHasher{ShaderCI, pSourceCache}.Hash(ShaderCI, *this);
+        }
+        catch (...)
+        {
+            LOG_ERROR_MESSAGE("Failed to hash the source of shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""), "'.");
+        }
     }
     else if (ShaderCI.ByteCode != nullptr && ShaderCI.ByteCodeSize != 0)
     {
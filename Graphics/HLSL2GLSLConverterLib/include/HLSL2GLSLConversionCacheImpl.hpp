@@ -0,0 +1,118 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::HLSL2GLSLConversionCacheImpl class
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "HLSL2GLSLConverter.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "XXH128Hasher.hpp"
+
+namespace Diligent
+{
+
+/// Implementation of the Diligent::IHLSL2GLSLConversionCache interface
+class HLSL2GLSLConversionCacheImpl final : public ObjectBase<IHLSL2GLSLConversionCache>
+{
+public:
+    using TBase = ObjectBase<IHLSL2GLSLConversionCache>;
+
+    explicit HLSL2GLSLConversionCacheImpl(IReferenceCounters* pRefCounters) :
+        TBase{pRefCounters}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_HLSL2GLSLConversionCache, TBase)
+
+    virtual bool DILIGENT_CALL_TYPE Load(IDataBlob* pData) override final;
+
+    virtual void DILIGENT_CALL_TYPE Store(IDataBlob** ppDataBlob) override final;
+
+    virtual void DILIGENT_CALL_TYPE Clear() override final;
+
+    /// Finds the GLSL source for the given conversion hash.
+
+    /// \param [in]  Hash       - Conversion hash.
+    /// \param [out] GLSLSource - The GLSL source, if it was found.
+    /// \return     true if the conversion was found in the cache, and false otherwise.
+    template <typename StringType>
+    bool Find(const XXH128Hash& Hash, StringType& GLSLSource) const
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        const char* pSource = nullptr;
+        size_t      Length  = 0;
+        if (!FindInternal(Hash, pSource, Length))
+            return false;
+
+        GLSLSource.assign(pSource, Length);
+        return true;
+    }
+
+    /// Adds the GLSL source for the given conversion hash to the cache.
+    void Add(const XXH128Hash& Hash, const char* GLSLSource, size_t Length);
+
+private:
+    // Index entry of the loaded cache data
+    struct IndexEntry
+    {
+        XXH128Hash Hash;
+
+        // Offset of the GLSL source from the beginning of the cache data
+        Uint64 Offset = 0;
+        Uint64 Size   = 0;
+    };
+
+    // Cache data that is used in place
+    struct LoadedData
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+
+        const IndexEntry* pEntries   = nullptr;
+        size_t            NumEntries = 0;
+
+        const IndexEntry* Find(const XXH128Hash& Hash) const;
+    };
+
+    bool FindInternal(const XXH128Hash& Hash, const char*& pSource, size_t& Length) const;
+
+private:
+    mutable std::mutex m_Mtx;
+
+    // Conversions added after the data was loaded
+    std::unordered_map<XXH128Hash, std::string> m_Sources;
+
+    std::vector<LoadedData> m_LoadedData;
+};
+
+} // namespace Diligent
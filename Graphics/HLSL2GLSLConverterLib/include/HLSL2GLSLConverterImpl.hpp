@@ -32,6 +32,7 @@
 #include <unordered_map>
 #include <vector>
 #include <array>
+#include <memory>
 
 #include "HLSL2GLSLConverter.h"
 #include "ObjectBase.hpp"
@@ -138,6 +139,10 @@ public:
 
         /// Whether to add layot(row_major) qualifier to uniform blocks.
         bool                                UseRowMajorMatrices        = false;
+
+        /// Optional conversion cache. If the conversion is found in the cache, the HLSL source
+        /// is not parsed. The cache is not used when ppConversionStream is not null.
+        IHLSL2GLSLConversionCache*          pCache                     = nullptr;
     };
 
     // clang-format on
@@ -251,6 +256,19 @@ private:
                          size_t                           NumSymbols,
                          bool                             bPreserveTokens);
 
+        /// Creates the conversion stream from the source with all includes already expanded, see LoadSource().
+        ConversionStream(IReferenceCounters*           pRefCounters,
+                         const HLSL2GLSLConverterImpl& Converter,
+                         const char*                   InputFileName,
+                         const String&                 Source,
+                         bool                          bPreserveTokens);
+
+        /// Loads the HLSL source and expands all includes.
+        static String LoadSource(const char*                      InputFileName,
+                                 IShaderSourceInputStreamFactory* pInputStreamFactory,
+                                 const Char*                      HLSLSource,
+                                 size_t                           NumSymbols);
+
         StringAlloc Convert(const Char* EntryPoint,
                             SHADER_TYPE ShaderType,
                             bool        IncludeDefintions,
@@ -271,7 +289,7 @@ private:
         const String& GetInputFileName() const { return m_InputFileName; }
 
     private:
-        void InsertIncludes(String& GLSLSource, IShaderSourceInputStreamFactory* pSourceStreamFactory);
+        static void InsertIncludes(String& GLSLSource, IShaderSourceInputStreamFactory* pSourceStreamFactory);
 
         using SamplerHashType = std::unordered_map<String, bool>;
 
@@ -460,6 +478,9 @@ private:
 
         StringAlloc BuildGLSLSource();
 
+        // Arena that holds the tokens and their text. It must be destroyed after the token list.
+        std::unique_ptr<Parsing::HLSLTokenArena> m_pTokenArena;
+
         // Tokenized source code
         TokenListType m_Tokens;
 
@@ -488,6 +509,8 @@ private:
         const String m_InputFileName;
     };
 
+    StringAlloc ConvertWithCache(ConversionAttribs& Attribs) const;
+
     Parsing::HLSLTokenizer m_HLSLTokenizer;
 
     // Set of all GLSL image types (image1D, uimage1D, iimage1D, image2D, ... )
@@ -114,4 +114,65 @@ DILIGENT_END_INTERFACE
 
 void DILIGENT_GLOBAL_FUNCTION(CreateHLSL2GLSLConverter)(IHLSL2GLSLConverter** ppConverter);
 
+
+// {6C1C5E2B-3A8D-4F0E-9B4C-2D7E1A5F8C93}
+static DILIGENT_CONSTEXPR INTERFACE_ID IID_HLSL2GLSLConversionCache =
+    {0x6c1c5e2b, 0x3a8d, 0x4f0e, {0x9b, 0x4c, 0x2d, 0x7e, 0x1a, 0x5f, 0x8c, 0x93}};
+
+#define DILIGENT_INTERFACE_NAME IHLSL2GLSLConversionCache
+#include "../../../Primitives/interface/DefineInterfaceHelperMacros.h"
+
+#define IHLSL2GLSLConversionCacheInclusiveMethods \
+    IObjectInclusiveMethods;                      \
+    IHLSL2GLSLConversionCacheMethods HLSL2GLSLConversionCache
+
+// clang-format off
+
+/// HLSL to GLSL conversion cache interface.
+
+/// The cache keeps the GLSL source produced by the converter. The key is the hash of the HLSL source
+/// with all includes expanded, the entry point, the shader type and the conversion flags.
+/// When the conversion is found in the cache, the HLSL source is not parsed.
+DILIGENT_BEGIN_INTERFACE(IHLSL2GLSLConversionCache, IObject)
+{
+    /// Loads the cache data from the binary blob.
+
+    /// \param [in] pData - A pointer to the cache data produced by Store().
+    /// \return     true if the data was loaded successfully, and false otherwise.
+    ///
+    /// \remarks    The data is used in place: the cache keeps a reference to the data blob.
+    ///             The blob must not be modified after it has been loaded.
+    VIRTUAL bool METHOD(Load)(THIS_
+                              IDataBlob* pData) PURE;
+
+    /// Writes the cache data to the binary data blob.
+
+    /// \param [out] ppDataBlob - Address of the memory location where a pointer to the
+    ///                           data blob containing the cache data will be written.
+    ///                           The function calls AddRef(), so that the new object will have
+    ///                           one reference.
+    VIRTUAL void METHOD(Store)(THIS_
+                               IDataBlob** ppDataBlob) PURE;
+
+    /// Clears the cache.
+    VIRTUAL void METHOD(Clear)(THIS) PURE;
+};
+DILIGENT_END_INTERFACE
+
+#include "../../../Primitives/interface/UndefInterfaceHelperMacros.h"
+
+#if DILIGENT_C_INTERFACE
+
+// clang-format off
+
+#    define IHLSL2GLSLConversionCache_Load(This, ...)  CALL_IFACE_METHOD(HLSL2GLSLConversionCache, Load,  This, __VA_ARGS__)
+#    define IHLSL2GLSLConversionCache_Store(This, ...) CALL_IFACE_METHOD(HLSL2GLSLConversionCache, Store, This, __VA_ARGS__)
+#    define IHLSL2GLSLConversionCache_Clear(This)      CALL_IFACE_METHOD(HLSL2GLSLConversionCache, Clear, This)
+
+// clang-format on
+
+#endif
+
+void DILIGENT_GLOBAL_FUNCTION(CreateHLSL2GLSLConversionCache)(IHLSL2GLSLConversionCache** ppCache);
+
 DILIGENT_END_NAMESPACE // namespace Diligent
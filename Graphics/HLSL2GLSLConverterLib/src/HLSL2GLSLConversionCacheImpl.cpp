@@ -0,0 +1,286 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "pch.h"
+#include "HLSL2GLSLConversionCacheImpl.hpp"
+
+#include <algorithm>
+
+#include "DataBlobImpl.hpp"
+#include "Serializer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// The cache data consists of the sorted index table followed by the GLSL sources.
+// The table is used in place, so loading the cache requires neither parsing every
+// element nor copying the sources.
+//
+//  | Header | IndexEntry[ElementCount] | GLSL sources ... |
+//
+struct HLSL2GLSLConversionCacheHeader
+{
+    static constexpr Uint32 HeaderMagic   = 0x4C534C47; // GLSL
+    static constexpr Uint32 HeaderVersion = 1;
+
+    Uint32 Magic   = HeaderMagic;
+    Uint32 Version = HeaderVersion;
+
+    Uint64 ElementCount = 0;
+
+    template <typename SerType>
+    void Serialize(SerType& Stream)
+    {
+        Stream(Magic, Version, ElementCount);
+    }
+};
+
+// Defines the order of the entries in the index table
+bool HashLess(const XXH128Hash& LHS, const XXH128Hash& RHS)
+{
+    return LHS.HighPart < RHS.HighPart || (LHS.HighPart == RHS.HighPart && LHS.LowPart < RHS.LowPart);
+}
+
+} // namespace
+
+const HLSL2GLSLConversionCacheImpl::IndexEntry* HLSL2GLSLConversionCacheImpl::LoadedData::Find(const XXH128Hash& Hash) const
+{
+    const IndexEntry* pEntriesEnd = pEntries + NumEntries;
+
+    const IndexEntry* pEntry = std::lower_bound(pEntries, pEntriesEnd, Hash,
+                                                [](const IndexEntry& Entry, const XXH128Hash& Hash) {
+                                                    return HashLess(Entry.Hash, Hash);
+                                                });
+    return (pEntry != pEntriesEnd && pEntry->Hash == Hash) ? pEntry : nullptr;
+}
+
+bool HLSL2GLSLConversionCacheImpl::FindInternal(const XXH128Hash& Hash, const char*& pSource, size_t& Length) const
+{
+    // Conversions added after the data was loaded take precedence
+    auto it = m_Sources.find(Hash);
+    if (it != m_Sources.end())
+    {
+        pSource = it->second.data();
+        Length  = it->second.length();
+        return true;
+    }
+
+    // Later loaded data overrides the earlier one
+    for (auto data_it = m_LoadedData.rbegin(); data_it != m_LoadedData.rend(); ++data_it)
+    {
+        if (const IndexEntry* pEntry = data_it->Find(Hash))
+        {
+            pSource = data_it->pData->GetConstDataPtr<char>() + pEntry->Offset;
+            Length  = StaticCast<size_t>(pEntry->Size);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void HLSL2GLSLConversionCacheImpl::Add(const XXH128Hash& Hash, const char* GLSLSource, size_t Length)
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_Sources[Hash].assign(GLSLSource, Length);
+}
+
+bool HLSL2GLSLConversionCacheImpl::Load(IDataBlob* pDataBlob)
+{
+    if (pDataBlob == nullptr)
+    {
+        DEV_ERROR("Data blob must not be null");
+        return false;
+    }
+
+    RefCntAutoPtr<IDataBlob> pData{pDataBlob};
+    if (reinterpret_cast<size_t>(pData->GetConstDataPtr()) % alignof(IndexEntry) != 0)
+    {
+        // The index table is accessed in place and must be properly aligned
+        pData = DataBlobImpl::Create(pDataBlob->GetSize(), pDataBlob->GetConstDataPtr());
+    }
+
+    Serializer<SerializerMode::Read> Stream{SerializedData{pData->GetDataPtr(), pData->GetSize()}};
+
+    if (Stream.GetRemainingSize() < sizeof(HLSL2GLSLConversionCacheHeader))
+    {
+        LOG_ERROR_MESSAGE("Not enough data to read the HLSL2GLSL conversion cache header");
+        return false;
+    }
+
+    HLSL2GLSLConversionCacheHeader Header;
+    Header.Serialize(Stream);
+    if (Header.Magic != HLSL2GLSLConversionCacheHeader::HeaderMagic)
+    {
+        LOG_ERROR_MESSAGE("Incorrect HLSL2GLSL conversion cache header magic number");
+        return false;
+    }
+    if (Header.Version != HLSL2GLSLConversionCacheHeader::HeaderVersion)
+    {
+        LOG_ERROR_MESSAGE("Incorrect HLSL2GLSL conversion cache version (", Header.Version, "). ", Uint32{HLSL2GLSLConversionCacheHeader::HeaderVersion}, " is expected.");
+        return false;
+    }
+    if (Header.ElementCount > Stream.GetRemainingSize() / sizeof(IndexEntry))
+    {
+        LOG_ERROR_MESSAGE("Not enough data to read the HLSL2GLSL conversion cache index. The cache data may be corrupted.");
+        return false;
+    }
+
+    LoadedData Data;
+    Data.NumEntries = StaticCast<size_t>(Header.ElementCount);
+    Data.pEntries   = static_cast<const IndexEntry*>(Stream.GetCurrentPtr());
+
+    // Validate the index without copying it. Lookups rely on the table being sorted.
+    const Uint64 DataSize = pData->GetSize();
+    for (size_t i = 0; i < Data.NumEntries; ++i)
+    {
+        const IndexEntry& Entry = Data.pEntries[i];
+        if (Entry.Offset > DataSize || Entry.Size > DataSize - Entry.Offset || (i > 0 && !HashLess(Data.pEntries[i - 1].Hash, Entry.Hash)))
+        {
+            LOG_ERROR_MESSAGE("HLSL2GLSL conversion cache index entry ", i, " is invalid. The cache data may be corrupted.");
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    // The loaded data overrides the sources added earlier
+    for (auto it = m_Sources.begin(); it != m_Sources.end();)
+    {
+        if (Data.Find(it->first) != nullptr)
+            it = m_Sources.erase(it);
+        else
+            ++it;
+    }
+
+    Data.pData = std::move(pData);
+    m_LoadedData.emplace_back(std::move(Data));
+
+    return true;
+}
+
+void HLSL2GLSLConversionCacheImpl::Store(IDataBlob** ppDataBlob)
+{
+    DEV_CHECK_ERR(ppDataBlob != nullptr, "ppDataBlob must not be null.");
+    DEV_CHECK_ERR(*ppDataBlob == nullptr, "*ppDataBlob is not null. Make sure you are not overwriting reference to an existing object as this may result in memory leaks.");
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    struct SourceInfo
+    {
+        XXH128Hash  Hash;
+        const char* pData;
+        Uint64      Size;
+    };
+    std::vector<SourceInfo> Sources;
+    Sources.reserve(m_Sources.size());
+    for (const auto& it : m_Sources)
+        Sources.push_back({it.first, it.second.data(), it.second.length()});
+    // Later loaded data overrides the earlier one, and both are overridden by the added sources
+    for (auto data_it = m_LoadedData.rbegin(); data_it != m_LoadedData.rend(); ++data_it)
+    {
+        for (size_t i = 0; i < data_it->NumEntries; ++i)
+        {
+            const IndexEntry& Entry = data_it->pEntries[i];
+            Sources.push_back({Entry.Hash, data_it->pData->GetConstDataPtr<char>() + Entry.Offset, Entry.Size});
+        }
+    }
+
+    // Stable sort keeps the first occurrence of every hash, which is the one with the highest precedence
+    std::stable_sort(Sources.begin(), Sources.end(), [](const SourceInfo& LHS, const SourceInfo& RHS) { return HashLess(LHS.Hash, RHS.Hash); });
+    Sources.erase(std::unique(Sources.begin(), Sources.end(), [](const SourceInfo& LHS, const SourceInfo& RHS) { return LHS.Hash == RHS.Hash; }), Sources.end());
+
+    std::vector<IndexEntry> Index(Sources.size());
+
+    Uint64 Offset = sizeof(HLSL2GLSLConversionCacheHeader) + sizeof(IndexEntry) * Index.size();
+    for (size_t i = 0; i < Sources.size(); ++i)
+    {
+        Index[i].Hash   = Sources[i].Hash;
+        Index[i].Offset = Offset;
+        Index[i].Size   = Sources[i].Size;
+        Offset += Sources[i].Size;
+    }
+
+    auto WriteData = [&](auto& Stream) //
+    {
+        HLSL2GLSLConversionCacheHeader Header{};
+        Header.ElementCount = Index.size();
+        Header.Serialize(Stream);
+
+        for (const IndexEntry& Entry : Index)
+            Stream(Entry.Hash.LowPart, Entry.Hash.HighPart, Entry.Offset, Entry.Size);
+
+        for (const SourceInfo& Source : Sources)
+            Stream.CopyBytes(Source.pData, StaticCast<size_t>(Source.Size));
+    };
+
+    Serializer<SerializerMode::Measure> MeasureStream{};
+    WriteData(MeasureStream);
+    VERIFY_EXPR(MeasureStream.GetSize() == Offset);
+
+    const SerializedData Memory = MeasureStream.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+
+    Serializer<SerializerMode::Write> WriteStream{Memory};
+    WriteData(WriteStream);
+    VERIFY_EXPR(WriteStream.IsEnded());
+
+    *ppDataBlob = DataBlobImpl::Create(Memory.Size(), Memory.Ptr()).Detach();
+}
+
+void HLSL2GLSLConversionCacheImpl::Clear()
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_Sources.clear();
+    m_LoadedData.clear();
+}
+
+void CreateHLSL2GLSLConversionCache(IHLSL2GLSLConversionCache** ppCache)
+{
+    try
+    {
+        RefCntAutoPtr<HLSL2GLSLConversionCacheImpl> pCache{MakeNewRCObj<HLSL2GLSLConversionCacheImpl>()()};
+        pCache->QueryInterface(IID_HLSL2GLSLConversionCache, ppCache);
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to create the HLSL2GLSL conversion cache");
+    }
+}
+
+} // namespace Diligent
+
+extern "C"
+{
+    void Diligent_CreateHLSL2GLSLConversionCache(Diligent::IHLSL2GLSLConversionCache** ppCache)
+    {
+        Diligent::CreateHLSL2GLSLConversionCache(ppCache);
+    }
+}
@@ -380,6 +380,8 @@
 #include "ParsingTools.hpp"
 #include "EngineMemory.h"
 #include "GLSLParsingTools.hpp"
+#include "Align.hpp"
+#include "HLSL2GLSLConversionCacheImpl.hpp"
 
 using namespace std;
 
@@ -393,6 +395,10 @@ static const Char* g_GLSLDefinitions =
 #include "GLSLDefinitions_inc.h"
 };
 
+// Version of the conversion rules that is included into the conversion cache key.
+// Increment it whenever the converter output changes for the same input.
+static constexpr Uint32 ConversionCacheVersion = 1;
+
 
 const HLSL2GLSLConverterImpl& HLSL2GLSLConverterImpl::GetInstance()
 {
@@ -3521,8 +3527,7 @@ void HLSL2GLSLConverterImpl::ConversionStream::ProcessShaderAttributes(TokenList
         VERIFY_PARSER_STATE(TmpToken, TmpToken != m_Tokens.end() && TmpToken->Type == TokenType::Identifier, "Identifier expected");
         // [domain("quad")]
         //  ^
-        auto& Attrib = TmpToken->Literal;
-        StrToLowerInPlace(Attrib);
+        String Attrib = StrToLower(TmpToken->Literal);
 
         ++TmpToken;
         VERIFY_PARSER_STATE(TmpToken, TmpToken != m_Tokens.end(), "Unexpected end of file");
@@ -4423,19 +4428,10 @@ StringAlloc HLSL2GLSLConverterImpl::ConversionStream::BuildGLSLSource()
     return Output;
 }
 
-HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*              pRefCounters,
-                                                           const HLSL2GLSLConverterImpl&    Converter,
-                                                           const char*                      InputFileName,
-                                                           IShaderSourceInputStreamFactory* pInputStreamFactory,
-                                                           const Char*                      HLSLSource,
-                                                           size_t                           NumSymbols,
-                                                           bool                             bPreserveTokens) :
-    // clang-format off
-    TBase            {pRefCounters   },
-    m_bPreserveTokens{bPreserveTokens},
-    m_Converter      {Converter      },
-    m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"}
-// clang-format on
+String HLSL2GLSLConverterImpl::ConversionStream::LoadSource(const char*                      InputFileName,
+                                                            IShaderSourceInputStreamFactory* pInputStreamFactory,
+                                                            const Char*                      HLSLSource,
+                                                            size_t                           NumSymbols)
 {
     RefCntAutoPtr<IDataBlob> pFileData;
     if (HLSLSource == nullptr)
@@ -4461,9 +4457,91 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
 
     InsertIncludes(Source, pInputStreamFactory);
 
-    m_Tokens = m_Converter.m_HLSLTokenizer.Tokenize(Source);
+    return Source;
 }
 
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*              pRefCounters,
+                                                           const HLSL2GLSLConverterImpl&    Converter,
+                                                           const char*                      InputFileName,
+                                                           IShaderSourceInputStreamFactory* pInputStreamFactory,
+                                                           const Char*                      HLSLSource,
+                                                           size_t                           NumSymbols,
+                                                           bool                             bPreserveTokens) :
+    ConversionStream{pRefCounters, Converter, InputFileName, LoadSource(InputFileName, pInputStreamFactory, HLSLSource, NumSymbols), bPreserveTokens}
+{
+}
+
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*           pRefCounters,
+                                                           const HLSL2GLSLConverterImpl& Converter,
+                                                           const char*                   InputFileName,
+                                                           const String&                 Source,
+                                                           bool                          bPreserveTokens) :
+    // clang-format off
+    TBase            {pRefCounters   },
+    m_bPreserveTokens{bPreserveTokens},
+    m_Converter      {Converter      },
+    m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"}
+// clang-format on
+{
+    // Allocate tokens from the arena rather than individually from the heap.
+    // Pick the block size so that typical sources fit into a few blocks.
+    constexpr size_t MinArenaBlockSize = size_t{64} << 10;
+    constexpr size_t MaxArenaBlockSize = size_t{16} << 20;
+    const size_t     ArenaBlockSize    = AlignUpToPowerOfTwo((std::min)((std::max)(Source.length() * 32, MinArenaBlockSize), MaxArenaBlockSize));
+
+    m_pTokenArena = std::make_unique<Parsing::HLSLTokenArena>(GetRawAllocator(), static_cast<Uint32>(ArenaBlockSize));
+    m_Tokens      = m_Converter.m_HLSLTokenizer.Tokenize(Source, *m_pTokenArena);
+}
+
+
+StringAlloc HLSL2GLSLConverterImpl::ConvertWithCache(ConversionAttribs& Attribs) const
+{
+    VERIFY_EXPR(Attribs.pCache != nullptr && Attribs.ppConversionStream == nullptr);
+    HLSL2GLSLConversionCacheImpl* pCache = ClassPtrCast<HLSL2GLSLConversionCacheImpl>(Attribs.pCache);
+
+    // Expanding the includes is much cheaper than parsing the source
+    const String Source = ConversionStream::LoadSource(Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols);
+
+    XXH128Hash Hash;
+    {
+        XXH128State State;
+
+        auto UpdateStr = [&State](const char* Str) {
+            // Include the terminating null so that adjacent strings can't produce the same hash
+            if (Str == nullptr)
+                Str = "";
+            State.UpdateRaw(Str, strlen(Str) + 1);
+        };
+
+        State.Update(Uint32{ConversionCacheVersion}, Uint64{Source.length()});
+        State.UpdateRaw(Source.data(), Source.length());
+        UpdateStr(Attribs.EntryPoint);
+        State.Update(Attribs.ShaderType);
+        UpdateStr(Attribs.SamplerSuffix);
+        State.Update(Attribs.IncludeDefinitions, Attribs.UseInOutLocationQualifiers, Attribs.UseRowMajorMatrices);
+        if (Attribs.IncludeDefinitions)
+        {
+            // The definitions change when the engine is updated
+            UpdateStr(g_GLSLDefinitions);
+        }
+
+        Hash = State.Digest();
+    }
+
+    StringAlloc GLSLSource{STD_ALLOCATOR_RAW_MEM(Char, GetRawAllocator(), "Allocator for String")};
+    if (pCache->Find(Hash, GLSLSource))
+        return GLSLSource;
+
+    ConversionStream Stream{nullptr, *this, Attribs.InputFileName, Source, false};
+
+    GLSLSource = Stream.Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
+                                Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
+                                Attribs.UseRowMajorMatrices);
+    if (!GLSLSource.empty())
+        pCache->Add(Hash, GLSLSource.data(), GLSLSource.length());
+
+    return GLSLSource;
+}
 
 StringAlloc HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
 {
@@ -4471,6 +4549,9 @@ StringAlloc HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
     {
         try
         {
+            if (Attribs.pCache != nullptr)
+                return ConvertWithCache(Attribs);
+
             ConversionStream Stream(nullptr, *this, Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols, false);
             return Stream.Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
                                   Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
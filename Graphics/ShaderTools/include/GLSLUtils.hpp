@@ -45,6 +45,7 @@ enum class TargetGLSLCompiler
 };
 
 struct IHLSL2GLSLConversionStream;
+struct IHLSL2GLSLConversionCache;
 
 // If HLSL->GLSL converter is used to convert HLSL shader source to
 // GLSL, this member can provide pointer to the conversion stream. It is useful
@@ -55,6 +56,9 @@ struct IHLSL2GLSLConversionStream;
 // the first time and will use it in all subsequent times.
 // For all subsequent conversions, FilePath member must be the same, or
 // new stream will be created and warning message will be displayed.
+//
+// pConversionCache is an optional HLSL->GLSL conversion cache. It is only used when
+// ppConversionStream is null.
 struct BuildGLSLSourceStringAttribs
 {
     const ShaderCreateInfo&       ShaderCI;
@@ -66,6 +70,7 @@ struct BuildGLSLSourceStringAttribs
     bool                          ZeroToOneClipZ     = false;
     const char*                   ExtraDefinitions   = nullptr;
     IHLSL2GLSLConversionStream**  ppConversionStream = nullptr;
+    IHLSL2GLSLConversionCache*    pConversionCache   = nullptr;
 };
 
 String BuildGLSLSourceString(const BuildGLSLSourceStringAttribs& Attribs) noexcept(false);
@@ -34,6 +34,9 @@
 namespace Diligent
 {
 
+struct IThreadPool;
+class ShaderIncludeCache;
+
 namespace GLSLangUtils
 {
 
@@ -74,6 +77,78 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       const char*             ExtraDefinitions,
                                       IDataBlob**             ppCompilerOutput);
 
+/// Per-stage compilation statistics. All times are in seconds.
+struct SPIRVCompileStats
+{
+    /// Time spent reading shader source and include files.
+    double ReadSourceTime = 0;
+
+    /// Time spent parsing the shader.
+    double ParseTime = 0;
+
+    /// Time spent linking the program.
+    double LinkTime = 0;
+
+    /// Time spent generating SPIR-V from glslang intermediate representation.
+    double CodeGenTime = 0;
+
+    /// Time spent legalizing and optimizing SPIR-V with SPIRV-Tools.
+    double OptimizeTime = 0;
+
+    /// The number of source and include files read from the input stream factory.
+    Uint32 NumFileReads = 0;
+
+    /// The number of source and include files served from the include cache.
+    Uint32 NumFileCacheHits = 0;
+
+    SPIRVCompileStats& operator+=(const SPIRVCompileStats& RHS);
+};
+
+struct SPIRVBatchCompileAttribs
+{
+    /// Shaders to compile.
+    /// HLSL shaders are compiled the same way as HLSLtoSPIRV does.
+    /// GLSL shaders are compiled as is, the same way as GLSLtoSPIRV does.
+    const ShaderCreateInfo* pShaders = nullptr;
+
+    /// The number of elements in pShaders array.
+    Uint32 NumShaders = 0;
+
+    SpirvVersion Version = SpirvVersion::Vk100;
+
+    /// Extra definitions added to all HLSL shaders.
+    const char* ExtraDefinitions = nullptr;
+
+    /// Optional thread pool to compile the shaders in.
+    /// If null, the shaders are compiled sequentially in the calling thread.
+    ///
+    /// \warning The pool must have worker threads (or be serviced by the application)
+    ///          and the function must not be called from one of the pool's worker threads.
+    IThreadPool* pThreadPool = nullptr;
+
+    /// Optional array of NumShaders compiler output pointers.
+    IDataBlob** ppCompilerOutputs = nullptr;
+
+    /// Optional include cache to read the source and include files through.
+    /// The cache may be shared between batches. If null, a cache that lives
+    /// for the duration of the batch is used.
+    ShaderIncludeCache* pIncludeCache = nullptr;
+
+    /// Optional statistics summed over all shaders in the batch.
+    SPIRVCompileStats* pStats = nullptr;
+};
+
+/// Compiles a batch of shaders to SPIR-V.
+///
+/// Source and include files are read through ShaderIncludeCache and shared between all shaders.
+/// Only files that are loaded through a factory that implements IShaderSourceFileStampProvider
+/// can be shared; other files are read for every shader.
+/// When the thread pool is provided, shaders are compiled in parallel.
+///
+/// \return An array of NumShaders SPIR-V byte codes. The byte code is empty if the
+///         corresponding shader failed to compile.
+std::vector<std::vector<unsigned int>> CompileSPIRVBatch(const SPIRVBatchCompileAttribs& Attribs);
+
 } // namespace GLSLangUtils
 
 } // namespace Diligent
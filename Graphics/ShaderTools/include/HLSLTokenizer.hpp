@@ -28,10 +28,14 @@
 
 #include <unordered_map>
 #include <list>
+#include <memory>
+#include <string_view>
+#include <algorithm>
 
 #include "ParsingTools.hpp"
 #include "HLSLKeywords.h"
 #include "HashUtils.hpp"
+#include "DynamicLinearAllocator.hpp"
 
 namespace Diligent
 {
@@ -74,21 +78,378 @@ enum class HLSLTokenType
 };
 // clang-format on
 
+/// Text of an HLSL token literal or delimiter.
+
+/// The string either references null-terminated text that it does not own (e.g. the text
+/// stored in HLSLTokenArena), or owns its text. A referencing string makes a copy of the
+/// text the first time it is modified.
+class HLSLTokenString
+{
+public:
+    static constexpr size_t npos = String::npos;
+
+    HLSLTokenString() noexcept {}
+
+    HLSLTokenString(const Char* Str) :
+        m_Owned{Str}
+    {
+        UpdateOwnedText();
+    }
+
+    HLSLTokenString(String Str) noexcept :
+        m_Owned{std::move(Str)}
+    {
+        UpdateOwnedText();
+    }
+
+    HLSLTokenString(const HLSLTokenString& Other) :
+        m_Str{Other.m_Str},
+        m_Len{Other.m_Len}
+    {
+        if (Other.IsOwned())
+        {
+            m_Owned = Other.m_Owned;
+            UpdateOwnedText();
+        }
+    }
+
+    HLSLTokenString(HLSLTokenString&& Other) noexcept :
+        m_Str{Other.m_Str},
+        m_Len{Other.m_Len}
+    {
+        if (Other.IsOwned())
+        {
+            m_Owned = std::move(Other.m_Owned);
+            UpdateOwnedText();
+        }
+        Other.Reset();
+    }
+
+    HLSLTokenString& operator=(const HLSLTokenString& Other)
+    {
+        if (this != &Other)
+        {
+            if (Other.IsOwned())
+            {
+                m_Owned = Other.m_Owned;
+                UpdateOwnedText();
+            }
+            else
+            {
+                m_Str = Other.m_Str;
+                m_Len = Other.m_Len;
+            }
+        }
+        return *this;
+    }
+
+    HLSLTokenString& operator=(HLSLTokenString&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            if (Other.IsOwned())
+            {
+                m_Owned = std::move(Other.m_Owned);
+                UpdateOwnedText();
+            }
+            else
+            {
+                m_Str = Other.m_Str;
+                m_Len = Other.m_Len;
+            }
+            Other.Reset();
+        }
+        return *this;
+    }
+
+    HLSLTokenString& operator=(const Char* Str)
+    {
+        m_Owned = Str;
+        UpdateOwnedText();
+        return *this;
+    }
+
+    HLSLTokenString& operator=(String Str)
+    {
+        m_Owned = std::move(Str);
+        UpdateOwnedText();
+        return *this;
+    }
+
+    /// Creates a string that references the null-terminated text Str of length Len without copying it.
+    /// The text must outlive the string and all its copies.
+    static HLSLTokenString MakeReference(const Char* Str, size_t Len) noexcept
+    {
+        VERIFY_EXPR(Str != nullptr && Str[Len] == '\0');
+        HLSLTokenString RefStr;
+        RefStr.m_Str = Str;
+        RefStr.m_Len = Len;
+        return RefStr;
+    }
+
+    // clang-format off
+    const Char* c_str()  const noexcept { return m_Str; }
+    const Char* data()   const noexcept { return m_Str; }
+    size_t      length() const noexcept { return m_Len; }
+    size_t      size()   const noexcept { return m_Len; }
+    bool        empty()  const noexcept { return m_Len == 0; }
+    const Char* begin()  const noexcept { return m_Str; }
+    const Char* end()    const noexcept { return m_Str + m_Len; }
+    // clang-format on
+
+    Char back() const
+    {
+        VERIFY_EXPR(m_Len > 0);
+        return m_Str[m_Len - 1];
+    }
+
+    size_t find_first_of(const Char* Chars, size_t Pos = 0) const
+    {
+        return std::string_view{m_Str, m_Len}.find_first_of(Chars, Pos);
+    }
+
+    operator String() const
+    {
+        return String{m_Str, m_Len};
+    }
+
+    HLSLTokenString& append(const Char* Str, size_t Len)
+    {
+        MakeOwned();
+        m_Owned.append(Str, Len);
+        UpdateOwnedText();
+        return *this;
+    }
+
+    HLSLTokenString& append(const Char* Str)
+    {
+        return append(Str, strlen(Str));
+    }
+
+    HLSLTokenString& append(const String& Str)
+    {
+        return append(Str.c_str(), Str.length());
+    }
+
+    HLSLTokenString& append(const HLSLTokenString& Str)
+    {
+        return append(Str.c_str(), Str.length());
+    }
+
+    void push_back(Char c)
+    {
+        append(&c, 1);
+    }
+
+    void pop_back()
+    {
+        VERIFY_EXPR(m_Len > 0);
+        MakeOwned();
+        m_Owned.pop_back();
+        UpdateOwnedText();
+    }
+
+    void clear()
+    {
+        m_Owned.clear();
+        UpdateOwnedText();
+    }
+
+private:
+    bool IsOwned() const noexcept
+    {
+        return m_Str == m_Owned.c_str();
+    }
+
+    void MakeOwned()
+    {
+        if (!IsOwned())
+            m_Owned.assign(m_Str, m_Len);
+    }
+
+    void UpdateOwnedText() noexcept
+    {
+        m_Str = m_Owned.c_str();
+        m_Len = m_Owned.length();
+    }
+
+    void Reset() noexcept
+    {
+        m_Owned.clear();
+        m_Str = "";
+        m_Len = 0;
+    }
+
+private:
+    const Char* m_Str = "";
+    size_t      m_Len = 0;
+    String      m_Owned;
+};
+
+// clang-format off
+inline bool operator==(const HLSLTokenString& Str1, const HLSLTokenString& Str2) { return std::string_view{Str1.data(), Str1.length()} == std::string_view{Str2.data(), Str2.length()}; }
+inline bool operator==(const HLSLTokenString& Str1, const String&          Str2) { return std::string_view{Str1.data(), Str1.length()} == Str2; }
+inline bool operator==(const String&          Str1, const HLSLTokenString& Str2) { return Str2 == Str1; }
+inline bool operator==(const HLSLTokenString& Str1, const Char*            Str2) { return std::string_view{Str1.data(), Str1.length()} == Str2; }
+inline bool operator==(const Char*            Str1, const HLSLTokenString& Str2) { return Str2 == Str1; }
+inline bool operator!=(const HLSLTokenString& Str1, const HLSLTokenString& Str2) { return !(Str1 == Str2); }
+inline bool operator!=(const HLSLTokenString& Str1, const String&          Str2) { return !(Str1 == Str2); }
+inline bool operator!=(const String&          Str1, const HLSLTokenString& Str2) { return !(Str1 == Str2); }
+inline bool operator!=(const HLSLTokenString& Str1, const Char*            Str2) { return !(Str1 == Str2); }
+inline bool operator!=(const Char*            Str1, const HLSLTokenString& Str2) { return !(Str1 == Str2); }
+
+inline String operator+(const HLSLTokenString& Str1, const HLSLTokenString& Str2) { return String{Str1}.append(Str2.data(), Str2.length()); }
+inline String operator+(const String&          Str1, const HLSLTokenString& Str2) { return String{Str1}.append(Str2.data(), Str2.length()); }
+inline String operator+(const HLSLTokenString& Str1, const String&          Str2) { return String{Str1}.append(Str2); }
+inline String operator+(const HLSLTokenString& Str1, const Char*            Str2) { return String{Str1}.append(Str2); }
+inline String operator+(const Char*            Str1, const HLSLTokenString& Str2) { return String{Str1}.append(Str2.data(), Str2.length()); }
+inline String operator+(const HLSLTokenString& Str1, Char                   Str2) { return String{Str1} + Str2; }
+// clang-format on
+
+inline std::ostream& operator<<(std::ostream& os, const HLSLTokenString& Str)
+{
+    return os.write(Str.data(), static_cast<std::streamsize>(Str.length()));
+}
+
+
+/// Memory arena that keeps tokens produced by HLSLTokenizer::Tokenize() in arena mode.
+
+/// Token text and token list nodes are allocated from a DynamicLinearAllocator. Nodes released
+/// by the list are recycled by the following node allocations, while the token text is only
+/// released when the arena is destroyed.
+class HLSLTokenArena
+{
+public:
+    explicit HLSLTokenArena(IMemoryAllocator& RawAllocator, Uint32 BlockSize = 64 << 10) :
+        m_Allocator{RawAllocator, BlockSize}
+    {}
+
+    // clang-format off
+    HLSLTokenArena           (const HLSLTokenArena&) = delete;
+    HLSLTokenArena           (HLSLTokenArena&&)      = delete;
+    HLSLTokenArena& operator=(const HLSLTokenArena&) = delete;
+    HLSLTokenArena& operator=(HLSLTokenArena&&)      = delete;
+    // clang-format on
+
+    void* Allocate(size_t Size, size_t Alignment)
+    {
+        if (Size == m_FreeBlockSize && m_pFreeBlocks != nullptr)
+        {
+            FreeBlock* pBlock = m_pFreeBlocks;
+            m_pFreeBlocks     = pBlock->pNext;
+            VERIFY_EXPR(reinterpret_cast<size_t>(pBlock) % Alignment == 0);
+            return pBlock;
+        }
+        return m_Allocator.Allocate(Size, (std::max)(Alignment, alignof(FreeBlock)));
+    }
+
+    void Free(void* Ptr, size_t Size)
+    {
+        if (Ptr == nullptr || Size < sizeof(FreeBlock))
+            return;
+
+        // Token lists only allocate nodes of a single size
+        if (m_FreeBlockSize == 0)
+            m_FreeBlockSize = Size;
+
+        if (Size == m_FreeBlockSize)
+        {
+            FreeBlock* pBlock = static_cast<FreeBlock*>(Ptr);
+            pBlock->pNext     = m_pFreeBlocks;
+            m_pFreeBlocks     = pBlock;
+        }
+    }
+
+    /// Copies the text in the [Start, End) range to the arena and returns a pointer to the null-terminated copy.
+    template <typename IteratorType>
+    const Char* CopyString(const IteratorType& Start, const IteratorType& End)
+    {
+        const size_t Len = static_cast<size_t>(End - Start);
+        Char*        Str = m_Allocator.Allocate<Char>(Len + 1);
+        std::copy(Start, End, Str);
+        Str[Len] = '\0';
+        return Str;
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* pNext;
+    };
+
+    DynamicLinearAllocator m_Allocator;
+
+    FreeBlock* m_pFreeBlocks   = nullptr;
+    size_t     m_FreeBlockSize = 0;
+};
+
+
+/// STL allocator that allocates memory from HLSLTokenArena, or from the default heap if the arena is null.
+template <typename T>
+struct HLSLTokenAllocator
+{
+    using value_type = T;
+
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    HLSLTokenAllocator() noexcept {}
+
+    explicit HLSLTokenAllocator(HLSLTokenArena* _pArena) noexcept :
+        pArena{_pArena}
+    {}
+
+    template <typename U>
+    HLSLTokenAllocator(const HLSLTokenAllocator<U>& Other) noexcept :
+        pArena{Other.pArena}
+    {}
+
+    T* allocate(size_t Count)
+    {
+        return pArena != nullptr ?
+            static_cast<T*>(pArena->Allocate(sizeof(T) * Count, alignof(T))) :
+            std::allocator<T>{}.allocate(Count);
+    }
+
+    void deallocate(T* Ptr, size_t Count)
+    {
+        if (pArena != nullptr)
+            pArena->Free(Ptr, sizeof(T) * Count);
+        else
+            std::allocator<T>{}.deallocate(Ptr, Count);
+    }
+
+    HLSLTokenArena* pArena = nullptr;
+};
+
+template <typename T, typename U>
+bool operator==(const HLSLTokenAllocator<T>& Alloc1, const HLSLTokenAllocator<U>& Alloc2) noexcept
+{
+    return Alloc1.pArena == Alloc2.pArena;
+}
+
+template <typename T, typename U>
+bool operator!=(const HLSLTokenAllocator<T>& Alloc1, const HLSLTokenAllocator<U>& Alloc2) noexcept
+{
+    return !(Alloc1 == Alloc2);
+}
+
+
 struct HLSLTokenInfo
 {
     using TokenType = HLSLTokenType;
 
-    TokenType Type = TokenType::Undefined;
-    String    Literal;
-    String    Delimiter;
-    size_t    Idx = ~size_t{0};
+    TokenType       Type = TokenType::Undefined;
+    HLSLTokenString Literal;
+    HLSLTokenString Delimiter;
+    size_t          Idx = ~size_t{0};
 
     HLSLTokenInfo() {}
 
-    HLSLTokenInfo(TokenType   _Type,
-                  std::string _Literal,
-                  std::string _Delimiter = "",
-                  size_t      _Idx       = ~size_t{0}) :
+    HLSLTokenInfo(TokenType       _Type,
+                  HLSLTokenString _Literal,
+                  HLSLTokenString _Delimiter = "",
+                  size_t          _Idx       = ~size_t{0}) :
         Type{_Type},
         Literal{std::move(_Literal)},
         Delimiter{std::move(_Delimiter)},
@@ -119,7 +480,7 @@ struct HLSLTokenInfo
     void ExtendLiteral(const std::string::const_iterator& Start,
                        const std::string::const_iterator& End)
     {
-        Literal.append(Start, End);
+        Literal.append(&*Start, static_cast<size_t>(End - Start));
     }
 
     bool IsBuiltInType() const
@@ -146,6 +507,23 @@ struct HLSLTokenInfo
         return HLSLTokenInfo{_Type, std::string{LiteralStart, LiteralEnd}, std::string{DelimStart, DelimEnd}, Idx};
     }
 
+    /// Creates a token whose literal and delimiter are stored in the arena.
+    static HLSLTokenInfo Create(HLSLTokenArena&                    Arena,
+                                TokenType                          _Type,
+                                const std::string::const_iterator& DelimStart,
+                                const std::string::const_iterator& DelimEnd,
+                                const std::string::const_iterator& LiteralStart,
+                                const std::string::const_iterator& LiteralEnd,
+                                size_t                             Idx)
+    {
+        return HLSLTokenInfo{
+            _Type,
+            HLSLTokenString::MakeReference(Arena.CopyString(LiteralStart, LiteralEnd), static_cast<size_t>(LiteralEnd - LiteralStart)),
+            HLSLTokenString::MakeReference(Arena.CopyString(DelimStart, DelimEnd), static_cast<size_t>(DelimEnd - DelimStart)),
+            Idx,
+        };
+    }
+
     size_t GetDelimiterLen() const
     {
         return Delimiter.length();
@@ -186,9 +564,19 @@ public:
         return it != m_Keywords.end() ? &it->second : nullptr;
     }
 
-    using TokenListType = std::list<HLSLTokenInfo>;
+    using TokenListType = std::list<HLSLTokenInfo, HLSLTokenAllocator<HLSLTokenInfo>>;
+
+    /// Tokenizes the source. Every token owns its literal and delimiter.
     TokenListType Tokenize(const String& Source) const;
 
+    /// Tokenizes the source in arena mode: token list nodes as well as the literals and
+    /// delimiters are allocated from the arena, which must outlive the returned list.
+    TokenListType Tokenize(const String& Source, HLSLTokenArena& Arena) const;
+
+private:
+    template <typename CreateTokenFuncType>
+    TokenListType TokenizeImpl(const String& Source, CreateTokenFuncType&& CreateToken, TokenListType&& Tokens) const;
+
 private:
     // HLSL keyword -> token info hash map
     // Example: "Texture2D" -> TokenInfo{TokenType::Texture2D, "Texture2D"}
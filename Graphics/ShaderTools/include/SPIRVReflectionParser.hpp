@@ -0,0 +1,318 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::SPIRVReflectionParser class
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Lightweight single-pass SPIR-V reflection parser.
+
+/// The parser walks the module declarations (everything before the first function) once and
+/// records only the information SPIRVShaderResources needs: names, a handful of decorations
+/// with their binary offsets, types, global variables, entry points and specialization constants.
+/// Function bodies are never visited.
+///
+/// The type model intentionally mirrors that of SPIRV-Cross (e.g. pointer and array types inherit
+/// the fields of the type they are derived from), so that the reflection results are identical.
+/// Parse() returns false for modules that use constructs the parser does not handle (decoration
+/// groups, forward pointers, specialization-constant-sized arrays, etc.). In this case, the caller
+/// is expected to fall back to SPIRV-Cross.
+class SPIRVReflectionParser
+{
+public:
+    enum class BaseType : Uint8
+    {
+        Unknown,
+        Void,
+        Boolean,
+        SByte,
+        UByte,
+        Short,
+        UShort,
+        Int,
+        UInt,
+        Int64,
+        UInt64,
+        AtomicCounter,
+        Half,
+        Float,
+        Double,
+        Struct,
+        Image,
+        SampledImage,
+        Sampler,
+        AccelerationStructure,
+        RayQuery
+    };
+
+    struct ImageInfo
+    {
+        Uint32 Dim     = 0; // spv::Dim
+        Uint32 Sampled = 0;
+        bool   Depth   = false;
+        bool   Arrayed = false;
+        bool   MS      = false;
+    };
+
+    struct TypeInfo
+    {
+        BaseType  Base    = BaseType::Unknown;
+        Uint32    Width   = 0;
+        Uint32    VecSize = 1;
+        Uint32    Columns = 1;
+        ImageInfo Image;
+
+        // Array dimensions, innermost first. Runtime arrays have zero size.
+        std::vector<Uint32> Array;
+        std::vector<Uint32> MemberTypes;
+
+        // Id of the type that defines the layout (e.g. the struct type for
+        // a pointer to an array of structs).
+        Uint32 Self       = 0;
+        Uint32 ParentType = 0;
+
+        bool   Pointer      = false;
+        Uint32 PointerDepth = 0;
+        Uint32 Storage      = 0; // spv::StorageClass
+    };
+
+    enum DECORATION_FLAGS : Uint32
+    {
+        DECORATION_FLAG_NONE           = 0u,
+        DECORATION_FLAG_BLOCK          = 1u << 0u,
+        DECORATION_FLAG_BUFFER_BLOCK   = 1u << 1u,
+        DECORATION_FLAG_BUILTIN        = 1u << 2u,
+        DECORATION_FLAG_NON_WRITABLE   = 1u << 3u,
+        DECORATION_FLAG_ROW_MAJOR      = 1u << 4u,
+        DECORATION_FLAG_COL_MAJOR      = 1u << 5u,
+        DECORATION_FLAG_BINDING        = 1u << 6u,
+        DECORATION_FLAG_DESCRIPTOR_SET = 1u << 7u,
+        DECORATION_FLAG_LOCATION       = 1u << 8u,
+        DECORATION_FLAG_SPEC_ID        = 1u << 9u,
+        DECORATION_FLAG_ARRAY_STRIDE   = 1u << 10u,
+        DECORATION_FLAG_OFFSET         = 1u << 11u,
+        DECORATION_FLAG_MATRIX_STRIDE  = 1u << 12u,
+        DECORATION_FLAG_HLSL_SEMANTIC  = 1u << 13u,
+    };
+
+    struct MemberMeta
+    {
+        const char* Name         = nullptr;
+        Uint32      Flags        = DECORATION_FLAG_NONE;
+        Uint32      Offset       = 0;
+        Uint32      MatrixStride = 0;
+    };
+
+    struct Variable
+    {
+        Uint32 Id      = 0;
+        Uint32 TypeId  = 0;
+        Uint32 Storage = 0; // spv::StorageClass
+    };
+
+    struct EntryPoint
+    {
+        const char*   Name            = nullptr;
+        Uint32        Id              = 0;
+        Uint32        Model           = 0; // spv::ExecutionModel
+        const Uint32* pInterface      = nullptr;
+        Uint32        NumInterface    = 0;
+        Uint32        LocalSize[3]    = {};
+        bool          UsesLocalSizeId = false;
+    };
+
+    struct SpecializationConstant
+    {
+        Uint32 Id     = 0;
+        Uint32 TypeId = 0;
+    };
+
+    // Mirrors diligent_spirv_cross::Resource
+    struct Resource
+    {
+        Uint32      Id         = 0;
+        Uint32      TypeId     = 0;
+        Uint32      BaseTypeId = 0;
+        std::string Name;
+    };
+
+    // Mirrors the subset of diligent_spirv_cross::ShaderResources used by SPIRVShaderResources
+    struct ShaderResources
+    {
+        std::vector<Resource> UniformBuffers;
+        std::vector<Resource> StorageBuffers;
+        std::vector<Resource> StageInputs;
+        std::vector<Resource> SubpassInputs;
+        std::vector<Resource> StorageImages;
+        std::vector<Resource> SampledImages;
+        std::vector<Resource> AtomicCounters;
+        std::vector<Resource> AccelerationStructures;
+        std::vector<Resource> PushConstantBuffers;
+        std::vector<Resource> SeparateImages;
+        std::vector<Resource> SeparateSamplers;
+    };
+
+    /// Parses the SPIR-V module. Returns false if the module is invalid or uses constructs the parser
+    /// does not support.
+    ///
+    /// \note   The parser keeps pointers to the strings in the binary, so the binary must outlive the parser.
+    bool Parse(const Uint32* pSPIRV, size_t NumWords);
+
+    /// Collects resources referenced by the interface of the given entry point in declaration order.
+    void GetShaderResources(const EntryPoint& EP, ShaderResources& Resources) const;
+
+    /// Computes the declared size of the struct type. Returns false if the size can't be determined.
+    bool GetDeclaredStructSize(const TypeInfo& Type, size_t& Size) const;
+
+    /// Computes the declared struct size assuming the runtime array in the last member has ArraySize elements.
+    bool GetDeclaredStructSizeRuntimeArray(const TypeInfo& Type, size_t ArraySize, size_t& Size) const;
+
+    /// Returns the Offset decoration of the struct member. Returns false if the decoration is missing.
+    bool GetMemberOffset(const TypeInfo& StructType, Uint32 Index, Uint32& Offset) const;
+
+    /// Returns the combined decoration flags of the buffer block variable (see ParsedIR::get_buffer_block_flags).
+    Uint32 GetBufferBlockFlags(const Variable& Var) const;
+
+    const TypeInfo* GetType(Uint32 Id) const
+    {
+        return (Id < m_Ids.size() && m_Ids[Id].TypeIdx != InvalidIndex) ? &m_Types[m_Ids[Id].TypeIdx] : nullptr;
+    }
+
+    const Variable* GetVariable(Uint32 Id) const
+    {
+        return (Id < m_Ids.size() && m_Ids[Id].VarIdx != InvalidIndex) ? &m_Variables[m_Ids[Id].VarIdx] : nullptr;
+    }
+
+    const char* GetName(Uint32 Id) const
+    {
+        return (Id < m_Ids.size() && m_Ids[Id].Name != nullptr) ? m_Ids[Id].Name : "";
+    }
+
+    const char* GetMemberName(Uint32 TypeId, Uint32 Index) const
+    {
+        const MemberMeta* pMeta = GetMemberMeta(TypeId, Index);
+        return (pMeta != nullptr && pMeta->Name != nullptr) ? pMeta->Name : "";
+    }
+
+    Uint32 GetMemberDecorationFlags(Uint32 TypeId, Uint32 Index) const
+    {
+        const MemberMeta* pMeta = GetMemberMeta(TypeId, Index);
+        return pMeta != nullptr ? pMeta->Flags : DECORATION_FLAG_NONE;
+    }
+
+    const MemberMeta* GetMemberMeta(Uint32 TypeId, Uint32 Index) const;
+
+    bool HasDecoration(Uint32 Id, DECORATION_FLAGS Flag) const
+    {
+        return Id < m_Ids.size() && (m_Ids[Id].Flags & Flag) != 0;
+    }
+
+    Uint32 GetDecorationFlags(Uint32 Id) const
+    {
+        return Id < m_Ids.size() ? m_Ids[Id].Flags : DECORATION_FLAG_NONE;
+    }
+
+    // Returns the offset, in words, of the decoration literal in the SPIR-V binary, or 0 if
+    // the decoration is not present.
+    Uint32 GetBindingDecorationOffset(Uint32 Id) const { return Id < m_Ids.size() ? m_Ids[Id].BindingOffset : 0; }
+    Uint32 GetDescriptorSetDecorationOffset(Uint32 Id) const { return Id < m_Ids.size() ? m_Ids[Id].DescriptorSetOffset : 0; }
+    Uint32 GetLocationDecorationOffset(Uint32 Id) const { return Id < m_Ids.size() ? m_Ids[Id].LocationOffset : 0; }
+
+    Uint32 GetSpecId(Uint32 Id) const { return Id < m_Ids.size() ? m_Ids[Id].SpecId : 0; }
+
+    const char* GetHlslSemantic(Uint32 Id) const
+    {
+        return (Id < m_Ids.size() && m_Ids[Id].HlslSemantic != nullptr) ? m_Ids[Id].HlslSemantic : "";
+    }
+
+    // clang-format off
+    const std::vector<EntryPoint>&             GetEntryPoints()             const { return m_EntryPoints; }
+    const std::vector<Variable>&               GetVariables()               const { return m_Variables; }
+    const std::vector<SpecializationConstant>& GetSpecializationConstants() const { return m_SpecConstants; }
+    // clang-format on
+
+    Uint32 GetVersion() const { return m_Version; }
+    Uint32 GetSourceLanguage() const { return m_SourceLanguage; }
+    bool   IsHLSLSource() const { return m_IsHLSLSource; }
+    bool   HasHlslFunctionality1() const { return m_HlslFunctionality1; }
+
+private:
+    bool GetDeclaredStructMemberSize(const TypeInfo& StructType, Uint32 Index, size_t& Size) const;
+    bool GetArrayStride(Uint32 TypeId, Uint32& Stride) const;
+    bool IsBuiltinVariable(const Variable& Var) const;
+    std::string GetBlockName(const Variable& Var, const TypeInfo& Type) const;
+
+    bool AddType(Uint32 Id, TypeInfo&& Type);
+
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    struct IdInfo
+    {
+        const char* Name         = nullptr;
+        const char* HlslSemantic = nullptr;
+
+        Uint32 Flags = DECORATION_FLAG_NONE;
+
+        Uint32 BindingOffset       = 0;
+        Uint32 DescriptorSetOffset = 0;
+        Uint32 LocationOffset      = 0;
+        Uint32 SpecId              = 0;
+        Uint32 ArrayStride         = 0;
+
+        Uint32 TypeIdx = InvalidIndex;
+        Uint32 VarIdx  = InvalidIndex;
+
+        // Value of a literal integer constant (OpConstant)
+        Uint32 ConstantValue = 0;
+        bool   IsConstant    = false;
+    };
+
+    std::vector<IdInfo>                                 m_Ids;
+    std::vector<TypeInfo>                               m_Types;
+    std::vector<Variable>                               m_Variables;
+    std::vector<EntryPoint>                             m_EntryPoints;
+    std::vector<SpecializationConstant>                 m_SpecConstants;
+    std::unordered_map<Uint32, std::vector<MemberMeta>> m_MemberMeta;
+
+    Uint32 m_Version        = 0;
+    Uint32 m_SourceLanguage = 0; // spv::SourceLanguage
+    bool   m_IsHLSLSource   = false;
+
+    bool m_HlslFunctionality1 = false;
+};
+
+} // namespace Diligent
@@ -129,6 +129,16 @@ struct SPIRVShaderResourceAttribs
                                ResourceType _Type,
                                Uint32       _BufferStaticSize) noexcept;
 
+    SPIRVShaderResourceAttribs(const char*        _Name,
+                               ResourceType       _Type,
+                               Uint16             _ArraySize,
+                               RESOURCE_DIMENSION _ResourceDim,
+                               bool               _IsMS,
+                               uint32_t           _BindingDecorationOffset,
+                               uint32_t           _DescriptorSetDecorationOffset,
+                               Uint32             _BufferStaticSize,
+                               Uint32             _BufferStride) noexcept;
+
     ShaderResourceDesc GetResourceDesc() const
     {
         return ShaderResourceDesc{Name, GetShaderResourceType(Type), ArraySize};
@@ -226,6 +236,10 @@ public:
         const char* CombinedSamplerSuffix       = nullptr;
         bool        LoadShaderStageInputs       = false;
         bool        LoadUniformBufferReflection = false;
+
+        // Use SPIRV-Cross for reflection instead of the lightweight direct parser.
+        // SPIRV-Cross is also used automatically when the parser does not support the module.
+        bool UseSPIRVCross = false;
     };
     SPIRVShaderResources(IMemoryAllocator&     Allocator,
                          std::vector<uint32_t> spirv_binary,
@@ -471,6 +485,9 @@ public:
 
     bool IsHLSLSource() const { return m_IsHLSLSource; }
 
+    // Returns true if the resources were loaded using SPIRV-Cross rather than the direct parser.
+    bool IsReflectedWithSPIRVCross() const { return m_ReflectedWithSPIRVCross; }
+
     // Sets the input location decorations using the HLSL semantic names.
     void MapHLSLVertexShaderInputs(std::vector<uint32_t>& SPIRV) const;
 
@@ -481,6 +498,16 @@ public:
     const SPIRVShaderResourceAttribs* GetResourceByName(const char* Name) const noexcept;
 
 private:
+    bool LoadDirect(IMemoryAllocator&            Allocator,
+                    const std::vector<uint32_t>& spirv_binary,
+                    const CreateInfo&            CI,
+                    std::string&                 EntryPoint) noexcept(false);
+
+    void LoadWithSPIRVCross(IMemoryAllocator&     Allocator,
+                            std::vector<uint32_t> spirv_binary,
+                            const CreateInfo&     CI,
+                            std::string&          EntryPoint) noexcept(false);
+
     void Initialize(IMemoryAllocator&       Allocator,
                     const ResourceCounters& Counters,
                     Uint32                  NumShaderStageInputs,
@@ -544,6 +571,8 @@ private:
 
     // Indicates if the shader was compiled from HLSL source.
     bool m_IsHLSLSource = false;
+
+    bool m_ReflectedWithSPIRVCross = false;
 };
 
 } // namespace Diligent
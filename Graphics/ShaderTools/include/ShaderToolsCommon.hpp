@@ -27,9 +27,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "GraphicsTypes.h"
 #include "Shader.h"
@@ -37,6 +40,7 @@
 #include "DataBlob.h"
 #include "FixedLinearAllocator.hpp"
 #include "STDAllocator.hpp"
+#include "SharedMutex.hpp"
 
 namespace Diligent
 {
@@ -132,13 +136,112 @@ struct ShaderIncludePreprocessInfo
     std::string FilePath;
 };
 
+/// Caches shader source files along with the include directives they contain.
+
+/// Shader permutations typically share most of their include files. The cache lets
+/// ProcessShaderIncludes, UnrollShaderIncludes and shader source hashing (XXH128State)
+/// read and parse every such file once:
+/// each entry is keyed by the full path of the file and is validated by the file's
+/// modification time and size, so a cache hit costs one file stat.
+///
+/// Only files that are loaded through a shader source stream factory that implements
+/// IShaderSourceFileStampProvider can be cached. Other files are read and parsed every time.
+///
+/// The class is thread-safe.
+class ShaderIncludeCache
+{
+public:
+    ShaderIncludeCache() = default;
+
+    // clang-format off
+    ShaderIncludeCache           (const ShaderIncludeCache&) = delete;
+    ShaderIncludeCache& operator=(const ShaderIncludeCache&) = delete;
+    // clang-format on
+
+    /// Include directive found in a source file.
+    struct IncludeDirective
+    {
+        /// The name of the included file, as it appears in the directive.
+        std::string FilePath;
+
+        /// Offset of the first character of the directive in the source.
+        size_t Start = 0;
+
+        /// Offset of the character that follows the directive.
+        size_t End = 0;
+    };
+
+    /// Content of a single source file.
+    struct FileData
+    {
+        /// Data blob that keeps the source alive. May be null if the source is owned by the caller.
+        RefCntAutoPtr<IDataBlob> pData;
+
+        const Char* Source       = nullptr;
+        size_t      SourceLength = 0;
+
+        /// Hash of the source content.
+        size_t ContentHash = 0;
+
+        /// Include directives in the order they appear in the source.
+        std::vector<IncludeDirective> Includes;
+
+        /// Error message if the include directives could not be parsed.
+        /// In this case, Includes contains the directives found before the error.
+        std::string ParseError;
+    };
+
+    /// Parses the include directives in the source and returns the file data.
+    /// The source is not copied, so pData must keep it alive if the data outlives the caller's buffer.
+    static std::shared_ptr<const FileData> ParseSource(const Char* Source, size_t SourceLength, RefCntAutoPtr<IDataBlob> pData = {});
+
+    /// Returns the data of the file, reading and parsing it only if it is not in the cache or
+    /// the cached entry is out of date. Returns null if the file could not be opened.
+    /// If pFromCache is not null, it is set to true if the data was served from the cache.
+    std::shared_ptr<const FileData> GetFile(IShaderSourceInputStreamFactory* pFactory, const Char* FilePath, bool* pFromCache = nullptr);
+
+    /// Removes all entries from the cache.
+    void Clear();
+
+    /// Returns the number of files in the cache.
+    size_t GetFileCount() const;
+
+    /// Returns the number of requests that were served from the cache.
+    Uint64 GetHitCount() const { return m_NumHits.load(); }
+
+    /// Returns the number of requests that required reading the file.
+    Uint64 GetMissCount() const { return m_NumMisses.load(); }
+
+private:
+    struct FileEntry
+    {
+        Uint64                          ModificationTime = 0;
+        Uint64                          Size             = 0;
+        std::shared_ptr<const FileData> pData;
+    };
+
+    mutable Threading::SharedMutex             m_Mtx;
+    std::unordered_map<std::string, FileEntry> m_Files;
+
+    std::atomic<Uint64> m_NumHits{0};
+    std::atomic<Uint64> m_NumMisses{0};
+};
+
 /// The function recursively finds all include files in the shader and calls the
 /// IncludeHandler function for all source files, including the original one.
 /// Includes are processed in a depth-first order such that original source file is processed last.
-bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept;
-
-///  Unrolls all include files into a single file
-std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false);
+/// If pCache is not null, source files are read and parsed through the cache.
+bool ProcessShaderIncludes(const ShaderCreateInfo&                                  ShaderCI,
+                           std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler,
+                           ShaderIncludeCache*                                      pCache = nullptr) noexcept;
+
+///  Unrolls all include files into a single file.
+///  If pCache is not null, source files are read and parsed through the cache.
+std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI, ShaderIncludeCache* pCache = nullptr) noexcept(false);
+
+/// Finds all include directives in the source code and returns the names of the included
+/// files in the order they appear. Included files are not processed.
+std::vector<std::string> FindShaderIncludes(const char* Source, size_t SourceLength) noexcept(false);
 
 std::string GetShaderCodeTypeName(SHADER_CODE_BASIC_TYPE     BasicType,
                                   SHADER_CODE_VARIABLE_CLASS Class,
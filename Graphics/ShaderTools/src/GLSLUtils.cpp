@@ -374,6 +374,7 @@ String BuildGLSLSourceString(const BuildGLSLSourceStringAttribs& Attribs) noexce
         HLSL2GLSLConverterImpl::ConversionAttribs ConvertAttribs;
         ConvertAttribs.pSourceStreamFactory = ShaderCI.pShaderSourceStreamFactory;
         ConvertAttribs.ppConversionStream   = Attribs.ppConversionStream;
+        ConvertAttribs.pCache               = Attribs.pConversionCache;
         ConvertAttribs.HLSLSource           = SourceData.Source;
         ConvertAttribs.NumSymbols           = SourceData.SourceLength;
         ConvertAttribs.EntryPoint           = ShaderCI.EntryPoint;
@@ -47,6 +47,9 @@
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
+#include "CPUProfiler.hpp"
 #ifdef USE_SPIRV_TOOLS
 #    include "SPIRVTools.hpp"
 #    include "spirv-tools/libspirv.h"
@@ -75,6 +78,18 @@ void FinalizeGlslang()
     ::glslang::FinalizeProcess();
 }
 
+SPIRVCompileStats& SPIRVCompileStats::operator+=(const SPIRVCompileStats& RHS)
+{
+    ReadSourceTime += RHS.ReadSourceTime;
+    ParseTime += RHS.ParseTime;
+    LinkTime += RHS.LinkTime;
+    CodeGenTime += RHS.CodeGenTime;
+    OptimizeTime += RHS.OptimizeTime;
+    NumFileReads += RHS.NumFileReads;
+    NumFileCacheHits += RHS.NumFileCacheHits;
+    return *this;
+}
+
 namespace
 {
 
@@ -230,6 +245,88 @@ TBuiltInResource InitResources()
     return Resources;
 }
 
+// Adds the time elapsed since construction to the given statistics member.
+class ScopedStageTimer
+{
+public:
+    ScopedStageTimer(SPIRVCompileStats* pStats, double SPIRVCompileStats::*pStageTime) :
+        m_pTime{pStats != nullptr ? &(pStats->*pStageTime) : nullptr}
+    {}
+
+    ~ScopedStageTimer()
+    {
+        if (m_pTime != nullptr)
+            *m_pTime += m_Timer.GetElapsedTime();
+    }
+
+    // clang-format off
+    ScopedStageTimer           (const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+    // clang-format on
+
+private:
+    double* const m_pTime;
+    Timer         m_Timer;
+};
+
+struct CompileContext
+{
+    ShaderIncludeCache* pIncludeCache = nullptr;
+    SPIRVCompileStats*  pStats        = nullptr;
+};
+
+// Reads the file from the input stream factory or takes it from the include cache.
+RefCntAutoPtr<IDataBlob> ReadSourceFile(IShaderSourceInputStreamFactory* pFactory,
+                                        const char*                      FilePath,
+                                        const CompileContext&            Ctx)
+{
+    ScopedStageTimer ReadTimer{Ctx.pStats, &SPIRVCompileStats::ReadSourceTime};
+
+    if (Ctx.pIncludeCache != nullptr)
+    {
+        bool FromCache = false;
+
+        std::shared_ptr<const ShaderIncludeCache::FileData> pFile = Ctx.pIncludeCache->GetFile(pFactory, FilePath, &FromCache);
+        if (!pFile)
+            return {};
+
+        if (Ctx.pStats != nullptr)
+            ++(FromCache ? Ctx.pStats->NumFileCacheHits : Ctx.pStats->NumFileReads);
+
+        // Files read by the cache are always backed by a data blob
+        VERIFY_EXPR(pFile->pData);
+        return pFile->pData;
+    }
+
+    RefCntAutoPtr<IFileStream> pSourceStream;
+    pFactory->CreateInputStream(FilePath, &pSourceStream);
+    if (pSourceStream == nullptr)
+        return {};
+
+    RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
+    pSourceStream->ReadBlob(pFileData);
+    if (Ctx.pStats != nullptr)
+        ++Ctx.pStats->NumFileReads;
+
+    return RefCntAutoPtr<IDataBlob>{pFileData};
+}
+
+// Same as ReadShaderSourceFile(), but reads the source file through the include cache.
+ShaderSourceFileData ReadShaderSource(const ShaderCreateInfo& ShaderCI, const CompileContext& Ctx) noexcept(false)
+{
+    if (ShaderCI.Source != nullptr || ShaderCI.pShaderSourceStreamFactory == nullptr || ShaderCI.FilePath == nullptr)
+        return ReadShaderSourceFile(ShaderCI);
+
+    ShaderSourceFileData SourceData;
+    SourceData.pFileData = ReadSourceFile(ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath, Ctx);
+    if (SourceData.pFileData == nullptr)
+        LOG_ERROR_AND_THROW("Failed to load shader source file '", ShaderCI.FilePath, '\'');
+
+    SourceData.Source       = SourceData.pFileData->GetConstDataPtr<char>();
+    SourceData.SourceLength = StaticCast<Uint32>(SourceData.pFileData->GetSize());
+    return SourceData;
+}
+
 void LogCompilerError(const char* DebugOutputMessage,
                       const char* InfoLog,
                       const char* InfoDebugLog,
@@ -262,29 +359,42 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
                                                 size_t                        SourceCodeLen,
                                                 bool                          AssignBindings,
                                                 ::EProfile                    shProfile,
-                                                IDataBlob**                   ppCompilerOutput)
+                                                IDataBlob**                   ppCompilerOutput,
+                                                SPIRVCompileStats*            pStats)
 {
     Shader.setAutoMapBindings(true);
     Shader.setAutoMapLocations(true);
-    TBuiltInResource Resources = InitResources();
 
-    bool ParseResult = pIncluder != nullptr ?
-        Shader.parse(&Resources, 100, shProfile, false, false, messages, *pIncluder) :
-        Shader.parse(&Resources, 100, shProfile, false, false, messages);
-    if (!ParseResult)
+    // The resource limits never change, so initialize them once for all threads
+    static const TBuiltInResource Resources = InitResources();
+
     {
-        LogCompilerError("Failed to parse shader source: \n", Shader.getInfoLog(), Shader.getInfoDebugLog(), ShaderSource, SourceCodeLen, ppCompilerOutput);
-        return {};
+        ScopedStageTimer ParseTimer{pStats, &SPIRVCompileStats::ParseTime};
+
+        bool ParseResult = pIncluder != nullptr ?
+            Shader.parse(&Resources, 100, shProfile, false, false, messages, *pIncluder) :
+            Shader.parse(&Resources, 100, shProfile, false, false, messages);
+        if (!ParseResult)
+        {
+            LogCompilerError("Failed to parse shader source: \n", Shader.getInfoLog(), Shader.getInfoDebugLog(), ShaderSource, SourceCodeLen, ppCompilerOutput);
+            return {};
+        }
     }
 
     ::glslang::TProgram Program;
-    Program.addShader(&Shader);
-    if (!Program.link(messages))
     {
-        LogCompilerError("Failed to link program: \n", Program.getInfoLog(), Program.getInfoDebugLog(), ShaderSource, SourceCodeLen, ppCompilerOutput);
-        return {};
+        ScopedStageTimer LinkTimer{pStats, &SPIRVCompileStats::LinkTime};
+
+        Program.addShader(&Shader);
+        if (!Program.link(messages))
+        {
+            LogCompilerError("Failed to link program: \n", Program.getInfoLog(), Program.getInfoDebugLog(), ShaderSource, SourceCodeLen, ppCompilerOutput);
+            return {};
+        }
     }
 
+    ScopedStageTimer CodeGenTimer{pStats, &SPIRVCompileStats::CodeGenTime};
+
     // This step is essential to set bindings and descriptor sets
     if (AssignBindings)
         Program.mapIO();
@@ -299,8 +409,10 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
 class IncluderImpl : public ::glslang::TShader::Includer
 {
 public:
-    IncluderImpl(IShaderSourceInputStreamFactory* pInputStreamFactory) :
-        m_pInputStreamFactory(pInputStreamFactory)
+    IncluderImpl(IShaderSourceInputStreamFactory* pInputStreamFactory,
+                 const CompileContext&            Ctx) :
+        m_pInputStreamFactory(pInputStreamFactory),
+        m_Ctx{Ctx}
     {}
 
     // For the "system" or <>-style includes; search the "system" paths.
@@ -309,16 +421,13 @@ public:
                                          size_t /*inclusionDepth*/)
     {
         DEV_CHECK_ERR(m_pInputStreamFactory != nullptr, "The shader source contains #include directives, but no input stream factory was provided");
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pInputStreamFactory->CreateInputStream(headerName, &pSourceStream);
-        if (pSourceStream == nullptr)
+        RefCntAutoPtr<IDataBlob> pFileData = ReadSourceFile(m_pInputStreamFactory, headerName, m_Ctx);
+        if (pFileData == nullptr)
         {
             LOG_ERROR("Failed to open shader include file '", headerName, "'. Check that the file exists");
             return nullptr;
         }
 
-        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
-        pSourceStream->ReadBlob(pFileData);
         IncludeResult* pNewInclude =
             new IncludeResult{
                 headerName,
@@ -350,6 +459,7 @@ public:
 
 private:
     IShaderSourceInputStreamFactory* const                       m_pInputStreamFactory;
+    const CompileContext                                         m_Ctx;
     std::unordered_set<std::unique_ptr<IncludeResult>>           m_IncludeRes;
     std::unordered_map<IncludeResult*, RefCntAutoPtr<IDataBlob>> m_DataBlobs;
 };
@@ -438,10 +548,11 @@ static SPIRV_OPTIMIZATION_FLAGS GetSpirvPerformanceFlag(SHADER_OPTIMIZATION_LEVE
 }
 #endif
 
-std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
-                                      SpirvVersion            Version,
-                                      const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput)
+static std::vector<unsigned int> HLSLtoSPIRVImpl(const ShaderCreateInfo& ShaderCI,
+                                                 SpirvVersion            Version,
+                                                 const char*             ExtraDefinitions,
+                                                 IDataBlob**             ppCompilerOutput,
+                                                 const CompileContext&   Ctx)
 {
     EShLanguage        ShLang = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
     ::glslang::TShader Shader{ShLang};
@@ -461,7 +572,7 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     Shader.setEntryPoint(ShaderCI.EntryPoint);
     Shader.setEnvTargetHlslFunctionality1();
 
-    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+    const ShaderSourceFileData SourceData = ReadShaderSource(ShaderCI, Ctx);
 
     std::string Preamble;
     if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0)
@@ -490,9 +601,9 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     // Make the behavior consistent with DX:
     Shader.setDxPositionW(true);
 
-    IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory};
+    IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory, Ctx};
 
-    std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, SourceData.Source, SourceData.SourceLength, true, shProfile, ppCompilerOutput);
+    std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, SourceData.Source, SourceData.SourceLength, true, shProfile, ppCompilerOutput, Ctx.pStats);
     if (SPIRV.empty())
         return SPIRV;
 
@@ -501,7 +612,11 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     // turn it into a valid vulkan SPIR-V shader. Legalization is always applied for correctness;
     // the performance pass is gated by the shader optimization level.
     const SPIRV_OPTIMIZATION_FLAGS OptimizationFlags = SPIRV_OPTIMIZATION_FLAG_LEGALIZATION | GetSpirvPerformanceFlag(ShaderCI.ShaderOptimizationLevel);
-    std::vector<uint32_t>          LegalizedSPIRV    = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Version), OptimizationFlags);
+    std::vector<uint32_t>          LegalizedSPIRV;
+    {
+        ScopedStageTimer OptimizeTimer{Ctx.pStats, &SPIRVCompileStats::OptimizeTime};
+        LegalizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Version), OptimizationFlags);
+    }
     if (!LegalizedSPIRV.empty())
     {
         return LegalizedSPIRV;
@@ -514,7 +629,15 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     return SPIRV;
 }
 
-std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
+                                      SpirvVersion            Version,
+                                      const char*             ExtraDefinitions,
+                                      IDataBlob**             ppCompilerOutput)
+{
+    return HLSLtoSPIRVImpl(ShaderCI, Version, ExtraDefinitions, ppCompilerOutput, CompileContext{});
+}
+
+static std::vector<unsigned int> GLSLtoSPIRVImpl(const GLSLtoSPIRVAttribs& Attribs, const CompileContext& Ctx)
 {
     VERIFY_EXPR(Attribs.ShaderSource != nullptr && Attribs.SourceCodeLen > 0);
 
@@ -541,9 +664,9 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
         AppendShaderMacros(Preamble, Attribs.Macros);
     Shader.setPreamble(Preamble.c_str());
 
-    IncluderImpl Includer{Attribs.pShaderSourceStreamFactory};
+    IncluderImpl Includer{Attribs.pShaderSourceStreamFactory, Ctx};
 
-    std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, Attribs.ShaderSource, Attribs.SourceCodeLen, Attribs.AssignBindings, shProfile, Attribs.ppCompilerOutput);
+    std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, Attribs.ShaderSource, Attribs.SourceCodeLen, Attribs.AssignBindings, shProfile, Attribs.ppCompilerOutput, Ctx.pStats);
     if (SPIRV.empty())
         return SPIRV;
 
@@ -551,7 +674,11 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
     const SPIRV_OPTIMIZATION_FLAGS OptimizationFlags = GetSpirvPerformanceFlag(Attribs.OptimizationLevel);
     if (OptimizationFlags != SPIRV_OPTIMIZATION_FLAG_NONE)
     {
-        std::vector<uint32_t> OptimizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Attribs.Version), OptimizationFlags);
+        std::vector<uint32_t> OptimizedSPIRV;
+        {
+            ScopedStageTimer OptimizeTimer{Ctx.pStats, &SPIRVCompileStats::OptimizeTime};
+            OptimizedSPIRV = OptimizeSPIRV(SPIRV, SpirvVersionToSpvTargetEnv(Attribs.Version), OptimizationFlags);
+        }
         if (!OptimizedSPIRV.empty())
         {
             return OptimizedSPIRV;
@@ -565,6 +692,111 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
     return SPIRV;
 }
 
+std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+{
+    return GLSLtoSPIRVImpl(Attribs, CompileContext{});
+}
+
+static std::vector<unsigned int> CompileShaderInBatch(const ShaderCreateInfo& ShaderCI,
+                                                      SpirvVersion            Version,
+                                                      const char*             ExtraDefinitions,
+                                                      IDataBlob**             ppCompilerOutput,
+                                                      const CompileContext&   Ctx) noexcept
+{
+    try
+    {
+        switch (ShaderCI.SourceLanguage)
+        {
+            case SHADER_SOURCE_LANGUAGE_HLSL:
+                return HLSLtoSPIRVImpl(ShaderCI, Version, ExtraDefinitions, ppCompilerOutput, Ctx);
+
+            case SHADER_SOURCE_LANGUAGE_GLSL:
+            case SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM:
+            {
+                const ShaderSourceFileData SourceData = ReadShaderSource(ShaderCI, Ctx);
+
+                GLSLtoSPIRVAttribs Attribs;
+                Attribs.ShaderType                 = ShaderCI.Desc.ShaderType;
+                Attribs.ShaderSource               = SourceData.Source;
+                Attribs.SourceCodeLen              = static_cast<int>(SourceData.SourceLength);
+                Attribs.Macros                     = ShaderCI.Macros;
+                Attribs.pShaderSourceStreamFactory = ShaderCI.pShaderSourceStreamFactory;
+                Attribs.Version                    = Version;
+                Attribs.ppCompilerOutput           = ppCompilerOutput;
+                Attribs.UseRowMajorMatrices        = (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0;
+                Attribs.OptimizationLevel          = ShaderCI.ShaderOptimizationLevel;
+                return GLSLtoSPIRVImpl(Attribs, Ctx);
+            }
+
+            default:
+                LOG_ERROR_MESSAGE("Shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""),
+                                  "': only HLSL and GLSL shaders can be compiled to SPIR-V with glslang");
+                return {};
+        }
+    }
+    catch (...)
+    {
+        LOG_ERROR_MESSAGE("Failed to compile shader '", (ShaderCI.Desc.Name != nullptr ? ShaderCI.Desc.Name : ""), "' to SPIR-V");
+        return {};
+    }
+}
+
+std::vector<std::vector<unsigned int>> CompileSPIRVBatch(const SPIRVBatchCompileAttribs& Attribs)
+{
+    DILIGENT_PROFILE_SCOPE("GLSLangUtils::CompileSPIRVBatch");
+
+    std::vector<std::vector<unsigned int>> SPIRVs(Attribs.NumShaders);
+    if (Attribs.NumShaders == 0)
+        return SPIRVs;
+
+    DEV_CHECK_ERR(Attribs.pShaders != nullptr, "pShaders must not be null when NumShaders is not zero");
+
+    // Files are shared by the shaders in the batch even if the application does not provide a cache
+    ShaderIncludeCache  BatchIncludeCache;
+    ShaderIncludeCache* pIncludeCache = Attribs.pIncludeCache != nullptr ? Attribs.pIncludeCache : &BatchIncludeCache;
+
+    // Every shader writes its own statistics, so no synchronization is required
+    std::vector<SPIRVCompileStats> ShaderStats(Attribs.pStats != nullptr ? Attribs.NumShaders : 0);
+
+    auto CompileShader = [&](Uint32 i) {
+        CompileContext Ctx;
+        Ctx.pIncludeCache = pIncludeCache;
+        Ctx.pStats        = !ShaderStats.empty() ? &ShaderStats[i] : nullptr;
+
+        IDataBlob** ppCompilerOutput = Attribs.ppCompilerOutputs != nullptr ? &Attribs.ppCompilerOutputs[i] : nullptr;
+        SPIRVs[i]                    = CompileShaderInBatch(Attribs.pShaders[i], Attribs.Version, Attribs.ExtraDefinitions, ppCompilerOutput, Ctx);
+    };
+
+    if (Attribs.pThreadPool != nullptr)
+    {
+        std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(Attribs.NumShaders);
+        for (Uint32 i = 0; i < Attribs.NumShaders; ++i)
+        {
+            Tasks[i] = EnqueueAsyncWork(Attribs.pThreadPool,
+                                        [&CompileShader, i](Uint32 /*ThreadId*/) {
+                                            CompileShader(i);
+                                            return ASYNC_TASK_STATUS_COMPLETE;
+                                        });
+        }
+
+        for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+            pTask->WaitForCompletion();
+    }
+    else
+    {
+        for (Uint32 i = 0; i < Attribs.NumShaders; ++i)
+            CompileShader(i);
+    }
+
+    if (Attribs.pStats != nullptr)
+    {
+        for (const SPIRVCompileStats& Stats : ShaderStats)
+            *Attribs.pStats += Stats;
+    }
+
+    return SPIRVs;
+}
+
 } // namespace GLSLangUtils
 
 } // namespace Diligent
@@ -27,6 +27,7 @@
 #include "HLSLParsingTools.hpp"
 #include "HLSLTokenizer.hpp"
 #include "GLSLParsingTools.hpp"
+#include "EngineMemory.h"
 
 namespace Diligent
 {
@@ -86,7 +87,8 @@ static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLToken
 std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ExtractGLSLImageFormatsFromHLSL(const std::string& HLSLSource)
 {
     HLSLTokenizer                      Tokenizer;
-    const HLSLTokenizer::TokenListType Tokens = Tokenizer.Tokenize(HLSLSource);
+    HLSLTokenArena                     Arena{GetRawAllocator()};
+    const HLSLTokenizer::TokenListType Tokens = Tokenizer.Tokenize(HLSLSource, Arena);
 
     std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ImageFormats;
 
@@ -40,21 +40,14 @@ HLSLTokenizer::HLSLTokenizer()
 #undef DEFINE_KEYWORD
 }
 
-HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
+template <typename CreateTokenFuncType>
+HLSLTokenizer::TokenListType HLSLTokenizer::TokenizeImpl(const String& Source, CreateTokenFuncType&& CreateToken, TokenListType&& Tokens) const
 {
     try
     {
-        size_t TokenIdx = 0;
         return Parsing::Tokenize<HLSLTokenInfo, TokenListType>(
             Source.begin(), Source.end(),
-            [&TokenIdx](HLSLTokenType                      Type,
-                        const std::string::const_iterator& DelimStart,
-                        const std::string::const_iterator& DelimEnd,
-                        const std::string::const_iterator& LiteralStart,
-                        const std::string::const_iterator& LiteralEnd) //
-            {
-                return HLSLTokenInfo::Create(Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd, TokenIdx++);
-            },
+            std::forward<CreateTokenFuncType>(CreateToken),
             [&](const std::string::const_iterator& Start, const std::string::const_iterator& End) //
             {
                 auto KeywordIt = m_Keywords.find(HashMapStringKey{std::string{Start, End}});
@@ -64,14 +57,47 @@ HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
                     return KeywordIt->second.Type;
                 }
                 return HLSLTokenType::Identifier;
-            });
+            },
+            std::move(Tokens));
     }
     catch (...)
     {
-        return {};
+        return TokenListType{Tokens.get_allocator()};
     }
 }
 
+HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
+{
+    size_t TokenIdx = 0;
+    return TokenizeImpl(
+        Source,
+        [&TokenIdx](HLSLTokenType                      Type,
+                    const std::string::const_iterator& DelimStart,
+                    const std::string::const_iterator& DelimEnd,
+                    const std::string::const_iterator& LiteralStart,
+                    const std::string::const_iterator& LiteralEnd) //
+        {
+            return HLSLTokenInfo::Create(Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd, TokenIdx++);
+        },
+        TokenListType{});
+}
+
+HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source, HLSLTokenArena& Arena) const
+{
+    size_t TokenIdx = 0;
+    return TokenizeImpl(
+        Source,
+        [&TokenIdx, &Arena](HLSLTokenType                      Type,
+                            const std::string::const_iterator& DelimStart,
+                            const std::string::const_iterator& DelimEnd,
+                            const std::string::const_iterator& LiteralStart,
+                            const std::string::const_iterator& LiteralEnd) //
+        {
+            return HLSLTokenInfo::Create(Arena, Type, DelimStart, DelimEnd, LiteralStart, LiteralEnd, TokenIdx++);
+        },
+        TokenListType{HLSLTokenAllocator<HLSLTokenInfo>{&Arena}});
+}
+
 } // namespace Parsing
 
 } // namespace Diligent
@@ -0,0 +1,887 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVReflectionParser.hpp"
+
+#include <cstring>
+
+#include "spirv.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Returns the null-terminated literal string that starts at pWords, or nullptr if the
+// string is not terminated within NumWords words.
+const char* GetLiteralString(const Uint32* pWords, size_t NumWords, Uint32& NumStringWords)
+{
+    const char*  Str    = reinterpret_cast<const char*>(pWords);
+    const size_t MaxLen = NumWords * sizeof(Uint32);
+    const void*  pNull  = std::memchr(Str, 0, MaxLen);
+    if (pNull == nullptr)
+        return nullptr;
+
+    NumStringWords = static_cast<Uint32>((static_cast<const char*>(pNull) - Str) / sizeof(Uint32) + 1);
+    return Str;
+}
+
+} // namespace
+
+bool SPIRVReflectionParser::AddType(Uint32 Id, TypeInfo&& Type)
+{
+    IdInfo& Info = m_Ids[Id];
+    if (Info.TypeIdx != InvalidIndex)
+        return false;
+
+    Info.TypeIdx = static_cast<Uint32>(m_Types.size());
+    m_Types.emplace_back(std::move(Type));
+    return true;
+}
+
+bool SPIRVReflectionParser::Parse(const Uint32* pSPIRV, size_t NumWords)
+{
+    // Module header: magic number, version, generator, bound, schema
+    constexpr size_t HeaderSize = 5;
+    if (pSPIRV == nullptr || NumWords < HeaderSize || pSPIRV[0] != spv::MagicNumber)
+        return false;
+
+    m_Version = pSPIRV[1];
+
+    // Guard against malformed bounds that would make us allocate huge amounts of memory
+    const Uint32 Bound = pSPIRV[3];
+    if (Bound == 0 || Bound > NumWords * 4)
+        return false;
+    m_Ids.resize(Bound);
+
+    auto IsValidId = [Bound](Uint32 Id) {
+        return Id != 0 && Id < Bound;
+    };
+
+    auto GetMemberMetaRef = [this](Uint32 TypeId, Uint32 Index) -> MemberMeta& {
+        std::vector<MemberMeta>& Members = m_MemberMeta[TypeId];
+        if (Index >= Members.size())
+            Members.resize(size_t{Index} + 1);
+        return Members[Index];
+    };
+
+    size_t Offset = HeaderSize;
+    while (Offset < NumWords)
+    {
+        const Uint32 WordCount = pSPIRV[Offset] >> spv::WordCountShift;
+        const Uint32 OpCode    = pSPIRV[Offset] & spv::OpCodeMask;
+        if (WordCount == 0 || Offset + WordCount > NumWords)
+            return false;
+
+        // All declarations the reflection needs precede the first function definition
+        if (OpCode == spv::OpFunction)
+            break;
+
+        const Uint32* Ops    = pSPIRV + Offset + 1;
+        const Uint32  NumOps = WordCount - 1;
+
+        switch (OpCode)
+        {
+            case spv::OpSource:
+            {
+                if (NumOps < 1)
+                    return false;
+
+                // Same logic as in SPIRV-Cross parser
+                m_SourceLanguage = Ops[0];
+                if (m_SourceLanguage == spv::SourceLanguageHLSL)
+                    m_IsHLSLSource = true;
+                else if (m_SourceLanguage == spv::SourceLanguageESSL || m_SourceLanguage == spv::SourceLanguageGLSL)
+                    m_IsHLSLSource = false;
+                break;
+            }
+
+            case spv::OpExtension:
+            {
+                Uint32      NumStrWords = 0;
+                const char* Ext         = GetLiteralString(Ops, NumOps, NumStrWords);
+                if (Ext == nullptr)
+                    return false;
+                if (std::strcmp(Ext, "SPV_GOOGLE_hlsl_functionality1") == 0)
+                    m_HlslFunctionality1 = true;
+                break;
+            }
+
+            case spv::OpName:
+            {
+                Uint32      NumStrWords = 0;
+                const char* Name        = NumOps >= 2 ? GetLiteralString(Ops + 1, NumOps - 1, NumStrWords) : nullptr;
+                if (Name == nullptr || !IsValidId(Ops[0]))
+                    return false;
+                m_Ids[Ops[0]].Name = Name;
+                break;
+            }
+
+            case spv::OpMemberName:
+            {
+                Uint32      NumStrWords = 0;
+                const char* Name        = NumOps >= 3 ? GetLiteralString(Ops + 2, NumOps - 2, NumStrWords) : nullptr;
+                if (Name == nullptr || !IsValidId(Ops[0]))
+                    return false;
+                GetMemberMetaRef(Ops[0], Ops[1]).Name = Name;
+                break;
+            }
+
+            case spv::OpEntryPoint:
+            {
+                Uint32      NumStrWords = 0;
+                const char* Name        = NumOps >= 3 ? GetLiteralString(Ops + 2, NumOps - 2, NumStrWords) : nullptr;
+                if (Name == nullptr || !IsValidId(Ops[1]))
+                    return false;
+
+                EntryPoint EP;
+                EP.Model        = Ops[0];
+                EP.Id           = Ops[1];
+                EP.Name         = Name;
+                EP.pInterface   = Ops + 2 + NumStrWords;
+                EP.NumInterface = NumOps - 2 - NumStrWords;
+                m_EntryPoints.push_back(EP);
+                break;
+            }
+
+            case spv::OpExecutionMode:
+            case spv::OpExecutionModeId:
+            {
+                if (NumOps < 2)
+                    return false;
+
+                for (EntryPoint& EP : m_EntryPoints)
+                {
+                    if (EP.Id != Ops[0])
+                        continue;
+
+                    if (Ops[1] == spv::ExecutionModeLocalSizeId)
+                    {
+                        EP.UsesLocalSizeId = true;
+                    }
+                    else if (Ops[1] == spv::ExecutionModeLocalSize && OpCode == spv::OpExecutionMode)
+                    {
+                        if (NumOps < 5)
+                            return false;
+                        EP.LocalSize[0] = Ops[2];
+                        EP.LocalSize[1] = Ops[3];
+                        EP.LocalSize[2] = Ops[4];
+                    }
+                }
+                break;
+            }
+
+            case spv::OpDecorate:
+            {
+                if (NumOps < 2 || !IsValidId(Ops[0]))
+                    return false;
+
+                IdInfo& Info = m_Ids[Ops[0]];
+                // Offset of the first decoration literal in the binary
+                const Uint32 LiteralOffset = static_cast<Uint32>(Offset + 3);
+                switch (Ops[1])
+                {
+                    // clang-format off
+                    case spv::DecorationBlock:       Info.Flags |= DECORATION_FLAG_BLOCK;        break;
+                    case spv::DecorationBufferBlock: Info.Flags |= DECORATION_FLAG_BUFFER_BLOCK; break;
+                    case spv::DecorationBuiltIn:     Info.Flags |= DECORATION_FLAG_BUILTIN;      break;
+                    case spv::DecorationNonWritable: Info.Flags |= DECORATION_FLAG_NON_WRITABLE; break;
+                    case spv::DecorationRowMajor:    Info.Flags |= DECORATION_FLAG_ROW_MAJOR;    break;
+                    case spv::DecorationColMajor:    Info.Flags |= DECORATION_FLAG_COL_MAJOR;    break;
+                    // clang-format on
+
+                    case spv::DecorationBinding:
+                    case spv::DecorationDescriptorSet:
+                    case spv::DecorationLocation:
+                    case spv::DecorationSpecId:
+                    case spv::DecorationArrayStride:
+                        if (NumOps < 3)
+                            return false;
+
+                        if (Ops[1] == spv::DecorationBinding)
+                        {
+                            Info.Flags |= DECORATION_FLAG_BINDING;
+                            Info.BindingOffset = LiteralOffset;
+                        }
+                        else if (Ops[1] == spv::DecorationDescriptorSet)
+                        {
+                            Info.Flags |= DECORATION_FLAG_DESCRIPTOR_SET;
+                            Info.DescriptorSetOffset = LiteralOffset;
+                        }
+                        else if (Ops[1] == spv::DecorationLocation)
+                        {
+                            Info.Flags |= DECORATION_FLAG_LOCATION;
+                            Info.LocationOffset = LiteralOffset;
+                        }
+                        else if (Ops[1] == spv::DecorationSpecId)
+                        {
+                            Info.Flags |= DECORATION_FLAG_SPEC_ID;
+                            Info.SpecId = Ops[2];
+                        }
+                        else
+                        {
+                            Info.Flags |= DECORATION_FLAG_ARRAY_STRIDE;
+                            Info.ArrayStride = Ops[2];
+                        }
+                        break;
+
+                    default:
+                        break;
+                }
+                break;
+            }
+
+            case spv::OpDecorateString:
+            {
+                if (NumOps < 3 || !IsValidId(Ops[0]))
+                    return false;
+
+                if (Ops[1] == spv::DecorationHlslSemanticGOOGLE)
+                {
+                    Uint32      NumStrWords = 0;
+                    const char* Semantic    = GetLiteralString(Ops + 2, NumOps - 2, NumStrWords);
+                    if (Semantic == nullptr)
+                        return false;
+
+                    IdInfo& Info = m_Ids[Ops[0]];
+                    Info.Flags |= DECORATION_FLAG_HLSL_SEMANTIC;
+                    Info.HlslSemantic = Semantic;
+                }
+                break;
+            }
+
+            case spv::OpMemberDecorate:
+            {
+                if (NumOps < 3 || !IsValidId(Ops[0]))
+                    return false;
+
+                switch (Ops[2])
+                {
+                    case spv::DecorationBuiltIn:
+                        GetMemberMetaRef(Ops[0], Ops[1]).Flags |= DECORATION_FLAG_BUILTIN;
+                        break;
+
+                    case spv::DecorationNonWritable:
+                        GetMemberMetaRef(Ops[0], Ops[1]).Flags |= DECORATION_FLAG_NON_WRITABLE;
+                        break;
+
+                    case spv::DecorationRowMajor:
+                        GetMemberMetaRef(Ops[0], Ops[1]).Flags |= DECORATION_FLAG_ROW_MAJOR;
+                        break;
+
+                    case spv::DecorationColMajor:
+                        GetMemberMetaRef(Ops[0], Ops[1]).Flags |= DECORATION_FLAG_COL_MAJOR;
+                        break;
+
+                    case spv::DecorationOffset:
+                    case spv::DecorationMatrixStride:
+                    {
+                        if (NumOps < 4)
+                            return false;
+
+                        MemberMeta& Member = GetMemberMetaRef(Ops[0], Ops[1]);
+                        if (Ops[2] == spv::DecorationOffset)
+                        {
+                            Member.Flags |= DECORATION_FLAG_OFFSET;
+                            Member.Offset = Ops[3];
+                        }
+                        else
+                        {
+                            Member.Flags |= DECORATION_FLAG_MATRIX_STRIDE;
+                            Member.MatrixStride = Ops[3];
+                        }
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+                break;
+            }
+
+            case spv::OpDecorationGroup:
+            case spv::OpGroupDecorate:
+            case spv::OpGroupMemberDecorate:
+            case spv::OpTypeForwardPointer:
+                // Not supported by the direct parser
+                return false;
+
+            case spv::OpTypeVoid:
+            case spv::OpTypeBool:
+            case spv::OpTypeSampler:
+            case spv::OpTypeAccelerationStructureKHR:
+            case spv::OpTypeRayQueryKHR:
+            {
+                if (NumOps < 1 || !IsValidId(Ops[0]))
+                    return false;
+
+                TypeInfo Type;
+                Type.Self = Ops[0];
+                switch (OpCode)
+                {
+                    // clang-format off
+                    case spv::OpTypeVoid:                     Type.Base = BaseType::Void;                  break;
+                    case spv::OpTypeBool:                     Type.Base = BaseType::Boolean; Type.Width = 1; break;
+                    case spv::OpTypeSampler:                  Type.Base = BaseType::Sampler;               break;
+                    case spv::OpTypeAccelerationStructureKHR: Type.Base = BaseType::AccelerationStructure; break;
+                    case spv::OpTypeRayQueryKHR:              Type.Base = BaseType::RayQuery;              break;
+                    // clang-format on
+                    default:
+                        UNEXPECTED("Unexpected opcode");
+                }
+                if (!AddType(Ops[0], std::move(Type)))
+                    return false;
+                break;
+            }
+
+            case spv::OpTypeInt:
+            case spv::OpTypeFloat:
+            {
+                if (NumOps < 2 || !IsValidId(Ops[0]))
+                    return false;
+
+                TypeInfo Type;
+                Type.Self  = Ops[0];
+                Type.Width = Ops[1];
+                if (OpCode == spv::OpTypeInt)
+                {
+                    if (NumOps < 3)
+                        return false;
+
+                    const bool IsSigned = Ops[2] != 0;
+                    switch (Type.Width)
+                    {
+                        // clang-format off
+                        case  8: Type.Base = IsSigned ? BaseType::SByte : BaseType::UByte;  break;
+                        case 16: Type.Base = IsSigned ? BaseType::Short : BaseType::UShort; break;
+                        case 32: Type.Base = IsSigned ? BaseType::Int   : BaseType::UInt;   break;
+                        case 64: Type.Base = IsSigned ? BaseType::Int64 : BaseType::UInt64; break;
+                        // clang-format on
+                        default: return false;
+                    }
+                }
+                else
+                {
+                    // Floating-point encodings (e.g. BFloat16) are not supported
+                    if (NumOps > 2)
+                        return false;
+
+                    switch (Type.Width)
+                    {
+                        // clang-format off
+                        case 16: Type.Base = BaseType::Half;   break;
+                        case 32: Type.Base = BaseType::Float;  break;
+                        case 64: Type.Base = BaseType::Double; break;
+                        // clang-format on
+                        default: return false;
+                    }
+                }
+                if (!AddType(Ops[0], std::move(Type)))
+                    return false;
+                break;
+            }
+
+            case spv::OpTypeVector:
+            case spv::OpTypeMatrix:
+            {
+                if (NumOps < 3 || !IsValidId(Ops[0]))
+                    return false;
+
+                const TypeInfo* pComponentType = GetType(Ops[1]);
+                if (pComponentType == nullptr)
+                    return false;
+
+                TypeInfo Type = *pComponentType;
+                if (OpCode == spv::OpTypeVector)
+                    Type.VecSize = Ops[2];
+                else
+                    Type.Columns = Ops[2];
+                Type.Self       = Ops[0];
+                Type.ParentType = Ops[1];
+                if (!AddType(Ops[0], std::move(Type)))
+                    return false;
+                break;
+            }
+
+            case spv::OpTypeImage:
+            {
+                if (NumOps < 8 || !IsValidId(Ops[0]))
+                    return false;
+
+                TypeInfo Type;
+                Type.Base          = BaseType::Image;
+                Type.Self          = Ops[0];
+                Type.Image.Dim     = Ops[2];
+                Type.Image.Depth   = Ops[3] == 1;
+                Type.Image.Arrayed = Ops[4] != 0;
+                Type.Image.MS      = Ops[5] != 0;
+                Type.Image.Sampled = Ops[6];
+                if (!AddType(Ops[0], std::move(Type)))
+                    return false;
+                break;
+            }
+
+            case spv::OpTypeSampledImage:
+            {
+                if (NumOps < 2 || !IsValidId(Ops[0]))
+                    return false;
+
+                const TypeInfo* pImageType = GetType(Ops[1]);
+                if (pImageType == nullptr)
+                    return false;
+
+                TypeInfo Type = *pImageType;
+                Type.Base     = BaseType::SampledImage;
+                Type.Self     = Ops[0];
+                if (!AddType(Ops[0], std::move(Type)))
+                    return false;
+                break;
+            }
+
+            case spv::OpTypeArray:
+            case spv::OpTypeRuntimeArray:
+            {
+                if (NumOps < 2 || !IsValidId(Ops[0]))
+                    return false;
+
+                const TypeInfo* pElementType = GetType(Ops[1]);
+                if (pElementType == nullptr)
+                    return false;
+
+                Uint32 ArraySize = 0;
+                if (OpCode == spv::OpTypeArray)
+                {
+                    // Arrays sized by specialization constants are left to SPIRV-Cross
+                    if (NumOps < 3 || !IsValidId(Ops[2]) || !m_Ids[Ops[2]].IsConstant)
+                        return false;
+                    ArraySize = m_Ids[Ops[2]].ConstantValue;
+                }
+
+                // Note that, as in SPIRV-Cross, array types keep the Self id of the element type
+                TypeInfo Type = *pElementType;
+                Type.Array.push_back(ArraySize);
+                Type.ParentType = Ops[1];
+                if (!AddType(Ops[0], std::move(Type)))
+                    return false;
+                break;
+            }
+
+            case spv::OpTypeStruct:
+            {
+                if (NumOps < 1 || !IsValidId(Ops[0]))
+                    return false;
+
+                TypeInfo Type;
+                Type.Base = BaseType::Struct;
+                Type.Self = Ops[0];
+                Type.MemberTypes.assign(Ops + 1, Ops + NumOps);
+                for (Uint32 MemberType : Type.MemberTypes)
+                {
+                    if (GetType(MemberType) == nullptr)
+                        return false;
+                }
+                if (!AddType(Ops[0], std::move(Type)))
+                    return false;
+                break;
+            }
+
+            case spv::OpTypePointer:
+            {
+                if (NumOps < 3 || !IsValidId(Ops[0]))
+                    return false;
+
+                const TypeInfo* pPointeeType = GetType(Ops[2]);
+                if (pPointeeType == nullptr)
+                    return false;
+
+                TypeInfo Type = *pPointeeType;
+                Type.Pointer  = true;
+                Type.PointerDepth += 1;
+                Type.Storage    = Ops[1];
+                Type.ParentType = Ops[2];
+                if (Type.Storage == spv::StorageClassAtomicCounter)
+                    Type.Base = BaseType::AtomicCounter;
+                if (!AddType(Ops[0], std::move(Type)))
+                    return false;
+                break;
+            }
+
+            case spv::OpConstant:
+            {
+                if (NumOps < 3 || !IsValidId(Ops[1]))
+                    return false;
+
+                IdInfo& Info       = m_Ids[Ops[1]];
+                Info.IsConstant    = true;
+                Info.ConstantValue = Ops[2];
+                break;
+            }
+
+            case spv::OpSpecConstantTrue:
+            case spv::OpSpecConstantFalse:
+            case spv::OpSpecConstant:
+            case spv::OpSpecConstantComposite:
+            {
+                if (NumOps < 2 || !IsValidId(Ops[1]) || GetType(Ops[0]) == nullptr)
+                    return false;
+
+                m_SpecConstants.push_back({Ops[1], Ops[0]});
+                break;
+            }
+
+            case spv::OpVariable:
+            {
+                if (NumOps < 3 || !IsValidId(Ops[1]) || GetType(Ops[0]) == nullptr)
+                    return false;
+
+                IdInfo& Info = m_Ids[Ops[1]];
+                if (Info.VarIdx != InvalidIndex)
+                    return false;
+
+                Info.VarIdx = static_cast<Uint32>(m_Variables.size());
+                m_Variables.push_back({Ops[1], Ops[0], Ops[2]});
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        Offset += WordCount;
+    }
+
+    return true;
+}
+
+const SPIRVReflectionParser::MemberMeta* SPIRVReflectionParser::GetMemberMeta(Uint32 TypeId, Uint32 Index) const
+{
+    auto it = m_MemberMeta.find(TypeId);
+    if (it == m_MemberMeta.end() || Index >= it->second.size())
+        return nullptr;
+    return &it->second[Index];
+}
+
+bool SPIRVReflectionParser::GetMemberOffset(const TypeInfo& StructType, Uint32 Index, Uint32& Offset) const
+{
+    const MemberMeta* pMeta = GetMemberMeta(StructType.Self, Index);
+    if (pMeta == nullptr || (pMeta->Flags & DECORATION_FLAG_OFFSET) == 0)
+        return false;
+
+    Offset = pMeta->Offset;
+    return true;
+}
+
+bool SPIRVReflectionParser::GetArrayStride(Uint32 TypeId, Uint32& Stride) const
+{
+    if (!HasDecoration(TypeId, DECORATION_FLAG_ARRAY_STRIDE))
+        return false;
+
+    Stride = m_Ids[TypeId].ArrayStride;
+    return true;
+}
+
+// The size computations below follow Compiler::get_declared_struct_size() and
+// Compiler::get_declared_struct_member_size() in SPIRV-Cross.
+bool SPIRVReflectionParser::GetDeclaredStructSize(const TypeInfo& Type, size_t& Size) const
+{
+    if (Type.MemberTypes.empty())
+        return false;
+
+    // Offsets can be declared out of order, so we need to deduce the actual size
+    // based on the last member instead.
+    Uint32 MemberIndex   = 0;
+    Uint32 HighestOffset = 0;
+    for (Uint32 i = 0; i < static_cast<Uint32>(Type.MemberTypes.size()); ++i)
+    {
+        Uint32 MemberOffset = 0;
+        if (!GetMemberOffset(Type, i, MemberOffset))
+            return false;
+
+        if (MemberOffset > HighestOffset)
+        {
+            HighestOffset = MemberOffset;
+            MemberIndex   = i;
+        }
+    }
+
+    size_t MemberSize = 0;
+    if (!GetDeclaredStructMemberSize(Type, MemberIndex, MemberSize))
+        return false;
+
+    Size = size_t{HighestOffset} + MemberSize;
+    return true;
+}
+
+bool SPIRVReflectionParser::GetDeclaredStructMemberSize(const TypeInfo& StructType, Uint32 Index, size_t& Size) const
+{
+    if (StructType.MemberTypes.empty())
+        return false;
+
+    const Uint32    MemberTypeId = StructType.MemberTypes[Index];
+    const TypeInfo* pType        = GetType(MemberTypeId);
+    if (pType == nullptr)
+        return false;
+
+    switch (pType->Base)
+    {
+        case BaseType::Unknown:
+        case BaseType::Void:
+        case BaseType::Boolean:
+        case BaseType::AtomicCounter:
+        case BaseType::Image:
+        case BaseType::SampledImage:
+        case BaseType::Sampler:
+            // Opaque types have no declared size
+            return false;
+
+        default:
+            break;
+    }
+
+    if (pType->Pointer && pType->Storage == spv::StorageClassPhysicalStorageBuffer)
+    {
+        // Top-level buffer device address pointer, not an array of pointers
+        const TypeInfo* pParentType = GetType(pType->ParentType);
+        if (pParentType != nullptr && pType->PointerDepth > pParentType->PointerDepth)
+        {
+            Size = 8;
+            return true;
+        }
+    }
+
+    if (!pType->Array.empty())
+    {
+        Uint32 ArrayStride = 0;
+        if (!GetArrayStride(MemberTypeId, ArrayStride))
+            return false;
+
+        Size = size_t{ArrayStride} * pType->Array.back();
+        return true;
+    }
+    else if (pType->Base == BaseType::Struct)
+    {
+        return GetDeclaredStructSize(*pType, Size);
+    }
+    else if (pType->Columns == 1)
+    {
+        Size = size_t{pType->VecSize} * (pType->Width / 8);
+        return true;
+    }
+    else
+    {
+        const MemberMeta* pMeta = GetMemberMeta(StructType.Self, Index);
+        if (pMeta == nullptr || (pMeta->Flags & DECORATION_FLAG_MATRIX_STRIDE) == 0)
+            return false;
+
+        // Per SPIR-V spec, matrices must be tightly packed and aligned up for vec3 accesses.
+        if (pMeta->Flags & DECORATION_FLAG_ROW_MAJOR)
+            Size = size_t{pMeta->MatrixStride} * pType->VecSize;
+        else if (pMeta->Flags & DECORATION_FLAG_COL_MAJOR)
+            Size = size_t{pMeta->MatrixStride} * pType->Columns;
+        else
+            return false;
+        return true;
+    }
+}
+
+bool SPIRVReflectionParser::GetDeclaredStructSizeRuntimeArray(const TypeInfo& Type, size_t ArraySize, size_t& Size) const
+{
+    if (!GetDeclaredStructSize(Type, Size))
+        return false;
+
+    const Uint32    LastMemberTypeId = Type.MemberTypes.back();
+    const TypeInfo* pLastType        = GetType(LastMemberTypeId);
+    VERIFY_EXPR(pLastType != nullptr);
+    if (!pLastType->Array.empty() && pLastType->Array[0] == 0) // Runtime array
+    {
+        Uint32 ArrayStride = 0;
+        if (!GetArrayStride(LastMemberTypeId, ArrayStride))
+            return false;
+        Size += ArraySize * ArrayStride;
+    }
+    return true;
+}
+
+Uint32 SPIRVReflectionParser::GetBufferBlockFlags(const Variable& Var) const
+{
+    // Some flags like non-writable are found as member decorations.
+    // If all members have a decoration set, propagate the decoration up as a variable decoration.
+    Uint32 Flags = GetDecorationFlags(Var.Id);
+
+    const TypeInfo* pType = GetType(Var.TypeId);
+    if (pType == nullptr || pType->MemberTypes.empty())
+        return Flags;
+
+    auto it = m_MemberMeta.find(pType->Self);
+    if (it != m_MemberMeta.end() && !it->second.empty())
+    {
+        const std::vector<MemberMeta>& Members = it->second;
+
+        Uint32 AllMembersFlags = Members[0].Flags;
+        for (size_t i = 1; i < pType->MemberTypes.size(); ++i)
+            AllMembersFlags &= i < Members.size() ? Members[i].Flags : DECORATION_FLAG_NONE;
+
+        Flags |= AllMembersFlags;
+    }
+
+    return Flags;
+}
+
+bool SPIRVReflectionParser::IsBuiltinVariable(const Variable& Var) const
+{
+    if (HasDecoration(Var.Id, DECORATION_FLAG_BUILTIN))
+        return true;
+
+    // If one member of a struct is builtin, the struct must also be builtin
+    const TypeInfo* pType = GetType(Var.TypeId);
+    VERIFY_EXPR(pType != nullptr);
+    auto it = m_MemberMeta.find(pType->Self);
+    if (it != m_MemberMeta.end())
+    {
+        for (const MemberMeta& Member : it->second)
+        {
+            if (Member.Flags & DECORATION_FLAG_BUILTIN)
+                return true;
+        }
+    }
+    return false;
+}
+
+std::string SPIRVReflectionParser::GetBlockName(const Variable& Var, const TypeInfo& Type) const
+{
+    // See Compiler::get_remapped_declared_block_name() and Compiler::get_block_fallback_name()
+    const char* BlockName = GetName(Type.Self);
+    if (*BlockName != '\0')
+        return BlockName;
+
+    const char* InstanceName = GetName(Var.Id);
+    if (*InstanceName != '\0')
+        return InstanceName;
+
+    return "_" + std::to_string(Type.Self) + "_" + std::to_string(Var.Id);
+}
+
+void SPIRVReflectionParser::GetShaderResources(const EntryPoint& EP, ShaderResources& Resources) const
+{
+    // In SPIR-V 1.4 and up, every global must be present in the entry point interface list,
+    // not just IO variables.
+    const bool CheckAllGlobals = m_Version >= 0x10400;
+
+    std::vector<bool> IsInterfaceVar(m_Ids.size());
+    for (Uint32 i = 0; i < EP.NumInterface; ++i)
+    {
+        if (EP.pInterface[i] < IsInterfaceVar.size())
+            IsInterfaceVar[EP.pInterface[i]] = true;
+    }
+
+    for (const Variable& Var : m_Variables)
+    {
+        const TypeInfo& Type = *GetType(Var.TypeId);
+        if (Var.Storage == spv::StorageClassFunction || !Type.Pointer)
+            continue;
+
+        if (CheckAllGlobals || Var.Storage == spv::StorageClassInput || Var.Storage == spv::StorageClassOutput)
+        {
+            if (!IsInterfaceVar[Var.Id])
+                continue;
+        }
+
+        if (IsBuiltinVariable(Var))
+            continue;
+
+        // The classification below follows Compiler::get_shader_resources() in SPIRV-Cross
+        Resource Res{Var.Id, Var.TypeId, Type.Self, {}};
+        if (Var.Storage == spv::StorageClassInput)
+        {
+            Res.Name = HasDecoration(Type.Self, DECORATION_FLAG_BLOCK) ? GetBlockName(Var, Type) : GetName(Var.Id);
+            Resources.StageInputs.emplace_back(std::move(Res));
+        }
+        else if (Var.Storage == spv::StorageClassUniformConstant && Type.Image.Dim == spv::DimSubpassData)
+        {
+            Res.Name = GetName(Var.Id);
+            Resources.SubpassInputs.emplace_back(std::move(Res));
+        }
+        else if (Var.Storage == spv::StorageClassOutput)
+        {
+            // Stage outputs are not used
+        }
+        else if (Type.Storage == spv::StorageClassUniform && HasDecoration(Type.Self, DECORATION_FLAG_BLOCK))
+        {
+            Res.Name = GetBlockName(Var, Type);
+            Resources.UniformBuffers.emplace_back(std::move(Res));
+        }
+        else if ((Type.Storage == spv::StorageClassUniform && HasDecoration(Type.Self, DECORATION_FLAG_BUFFER_BLOCK)) ||
+                 Type.Storage == spv::StorageClassStorageBuffer)
+        {
+            Res.Name = GetBlockName(Var, Type);
+            Resources.StorageBuffers.emplace_back(std::move(Res));
+        }
+        else if (Type.Storage == spv::StorageClassPushConstant)
+        {
+            Res.Name = GetName(Var.Id);
+            Resources.PushConstantBuffers.emplace_back(std::move(Res));
+        }
+        else if (Type.Storage == spv::StorageClassAtomicCounter)
+        {
+            Res.Name = GetName(Var.Id);
+            Resources.AtomicCounters.emplace_back(std::move(Res));
+        }
+        else if (Type.Storage == spv::StorageClassUniformConstant)
+        {
+            std::vector<Resource>* pResources = nullptr;
+            if (Type.Base == BaseType::Image)
+            {
+                if (Type.Image.Sampled == 2)
+                    pResources = &Resources.StorageImages;
+                else if (Type.Image.Sampled == 1)
+                    pResources = &Resources.SeparateImages;
+            }
+            else if (Type.Base == BaseType::Sampler)
+            {
+                pResources = &Resources.SeparateSamplers;
+            }
+            else if (Type.Base == BaseType::SampledImage)
+            {
+                pResources = &Resources.SampledImages;
+            }
+            else if (Type.Base == BaseType::AccelerationStructure)
+            {
+                pResources = &Resources.AccelerationStructures;
+            }
+
+            if (pResources != nullptr)
+            {
+                Res.Name = GetName(Var.Id);
+                pResources->emplace_back(std::move(Res));
+            }
+        }
+    }
+}
+
+} // namespace Diligent
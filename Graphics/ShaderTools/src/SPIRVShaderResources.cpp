@@ -32,6 +32,7 @@
 
 #include "spirv_parser.hpp"
 #include "spirv_cross.hpp"
+#include "SPIRVReflectionParser.hpp"
 #include "ShaderBase.hpp"
 #include "GraphicsAccessories.hpp"
 #include "StringTools.hpp"
@@ -153,6 +154,28 @@ SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const char*  _Name,
 // clang-format on
 {}
 
+SPIRVShaderResourceAttribs::SPIRVShaderResourceAttribs(const char*        _Name,
+                                                       ResourceType       _Type,
+                                                       Uint16             _ArraySize,
+                                                       RESOURCE_DIMENSION _ResourceDim,
+                                                       bool               _IsMS,
+                                                       uint32_t           _BindingDecorationOffset,
+                                                       uint32_t           _DescriptorSetDecorationOffset,
+                                                       Uint32             _BufferStaticSize,
+                                                       Uint32             _BufferStride) noexcept :
+    // clang-format off
+    Name                          {_Name},
+    ArraySize                     {_ArraySize},
+    Type                          {_Type},
+    ResourceDim                   {static_cast<Uint8>(_ResourceDim)},
+    IsMS                          {_IsMS ? Uint8{1} : Uint8{0}},
+    BindingDecorationOffset       {_BindingDecorationOffset},
+    DescriptorSetDecorationOffset {_DescriptorSetDecorationOffset},
+    BufferStaticSize              {_BufferStaticSize},
+    BufferStride                  {_BufferStride}
+// clang-format on
+{}
+
 SHADER_RESOURCE_TYPE SPIRVShaderResourceAttribs::GetShaderResourceType(ResourceType Type)
 {
     static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 13, "Please handle the new resource type below");
@@ -471,12 +494,196 @@ ShaderCodeBufferDescX LoadUBReflection(const diligent_spirv_cross::Compiler& Com
     return UBDesc;
 }
 
+static RESOURCE_DIMENSION GetResourceDimension(const SPIRVReflectionParser::TypeInfo& Type)
+{
+    using BaseType = SPIRVReflectionParser::BaseType;
+    if (Type.Base == BaseType::Image || Type.Base == BaseType::SampledImage)
+    {
+        switch (Type.Image.Dim)
+        {
+            // clang-format off
+            case spv::Dim1D:     return Type.Image.Arrayed ? RESOURCE_DIM_TEX_1D_ARRAY : RESOURCE_DIM_TEX_1D;
+            case spv::Dim2D:     return Type.Image.Arrayed ? RESOURCE_DIM_TEX_2D_ARRAY : RESOURCE_DIM_TEX_2D;
+            case spv::Dim3D:     return RESOURCE_DIM_TEX_3D;
+            case spv::DimCube:   return Type.Image.Arrayed ? RESOURCE_DIM_TEX_CUBE_ARRAY : RESOURCE_DIM_TEX_CUBE;
+            case spv::DimBuffer: return RESOURCE_DIM_BUFFER;
+            // clang-format on
+            default: return RESOURCE_DIM_UNDEFINED;
+        }
+    }
+    else if (Type.Base == BaseType::Struct)
+    {
+        // Uniform buffers and storage buffers are Struct types
+        return RESOURCE_DIM_BUFFER;
+    }
+    else
+    {
+        return RESOURCE_DIM_UNDEFINED;
+    }
+}
+
+static bool IsMultisample(const SPIRVReflectionParser::TypeInfo& Type)
+{
+    using BaseType = SPIRVReflectionParser::BaseType;
+    return (Type.Base == BaseType::Image || Type.Base == BaseType::SampledImage) && Type.Image.MS;
+}
+
+static SHADER_CODE_BASIC_TYPE SpirvBaseTypeToShaderCodeBasicType(SPIRVReflectionParser::BaseType SpvBaseType)
+{
+    using BaseType = SPIRVReflectionParser::BaseType;
+    switch (SpvBaseType)
+    {
+        // clang-format off
+        case BaseType::Unknown:               return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+        case BaseType::Void:                  return SHADER_CODE_BASIC_TYPE_VOID;
+        case BaseType::Boolean:               return SHADER_CODE_BASIC_TYPE_BOOL;
+        case BaseType::SByte:                 return SHADER_CODE_BASIC_TYPE_INT8;
+        case BaseType::UByte:                 return SHADER_CODE_BASIC_TYPE_UINT8;
+        case BaseType::Short:                 return SHADER_CODE_BASIC_TYPE_INT16;
+        case BaseType::UShort:                return SHADER_CODE_BASIC_TYPE_UINT16;
+        case BaseType::Int:                   return SHADER_CODE_BASIC_TYPE_INT;
+        case BaseType::UInt:                  return SHADER_CODE_BASIC_TYPE_UINT;
+        case BaseType::Int64:                 return SHADER_CODE_BASIC_TYPE_INT64;
+        case BaseType::UInt64:                return SHADER_CODE_BASIC_TYPE_UINT64;
+        case BaseType::AtomicCounter:         return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+        case BaseType::Half:                  return SHADER_CODE_BASIC_TYPE_FLOAT16;
+        case BaseType::Float:                 return SHADER_CODE_BASIC_TYPE_FLOAT;
+        case BaseType::Double:                return SHADER_CODE_BASIC_TYPE_DOUBLE;
+        case BaseType::Struct:                return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+        case BaseType::Image:                 return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+        case BaseType::SampledImage:          return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+        case BaseType::Sampler:               return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+        case BaseType::AccelerationStructure: return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+        case BaseType::RayQuery:              return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+        // clang-format on
+        default:
+            UNEXPECTED("Unknown SPIRV base type");
+            return SHADER_CODE_BASIC_TYPE_UNKNOWN;
+    }
+}
+
+// Same as LoadShaderCodeVariableDesc() above, but uses the direct parser.
+// Returns false if the type layout can't be determined.
+static bool LoadShaderCodeVariableDesc(const SPIRVReflectionParser& Parser,
+                                       Uint32                       TypeID,
+                                       Uint32                       DecorationFlags,
+                                       bool                         IsHLSLSource,
+                                       ShaderCodeVariableDescX&     TypeDesc)
+{
+    const SPIRVReflectionParser::TypeInfo* pSpvType = Parser.GetType(TypeID);
+    if (pSpvType == nullptr)
+        return false;
+
+    const SPIRVReflectionParser::TypeInfo& SpvType = *pSpvType;
+    if (SpvType.Base == SPIRVReflectionParser::BaseType::Struct)
+    {
+        TypeDesc.Class = SHADER_CODE_VARIABLE_CLASS_STRUCT;
+    }
+    else if (SpvType.VecSize > 1 && SpvType.Columns > 1)
+    {
+        if (DecorationFlags & SPIRVReflectionParser::DECORATION_FLAG_ROW_MAJOR)
+            TypeDesc.Class = IsHLSLSource ? SHADER_CODE_VARIABLE_CLASS_MATRIX_COLUMNS : SHADER_CODE_VARIABLE_CLASS_MATRIX_ROWS;
+        else
+            TypeDesc.Class = IsHLSLSource ? SHADER_CODE_VARIABLE_CLASS_MATRIX_ROWS : SHADER_CODE_VARIABLE_CLASS_MATRIX_COLUMNS;
+    }
+    else if (SpvType.VecSize > 1)
+    {
+        TypeDesc.Class = SHADER_CODE_VARIABLE_CLASS_VECTOR;
+    }
+    else
+    {
+        TypeDesc.Class = SHADER_CODE_VARIABLE_CLASS_SCALAR;
+    }
+
+    if (TypeDesc.Class != SHADER_CODE_VARIABLE_CLASS_STRUCT)
+    {
+        TypeDesc.BasicType  = SpirvBaseTypeToShaderCodeBasicType(SpvType.Base);
+        TypeDesc.NumRows    = StaticCast<decltype(TypeDesc.NumRows)>(SpvType.VecSize);
+        TypeDesc.NumColumns = StaticCast<decltype(TypeDesc.NumColumns)>(SpvType.Columns);
+        if (IsHLSLSource)
+            std::swap(TypeDesc.NumRows, TypeDesc.NumColumns);
+    }
+
+    TypeDesc.SetTypeName(Parser.GetName(TypeID));
+    if (TypeDesc.TypeName == nullptr || TypeDesc.TypeName[0] == '\0')
+        TypeDesc.SetTypeName(Parser.GetName(SpvType.ParentType));
+    if (TypeDesc.TypeName == nullptr || TypeDesc.TypeName[0] == '\0')
+        TypeDesc.SetDefaultTypeName(IsHLSLSource ? SHADER_SOURCE_LANGUAGE_HLSL : SHADER_SOURCE_LANGUAGE_GLSL);
+
+    TypeDesc.ArraySize = !SpvType.Array.empty() ? SpvType.Array[0] : 0;
+
+    for (Uint32 i = 0; i < static_cast<Uint32>(SpvType.MemberTypes.size()); ++i)
+    {
+        ShaderCodeVariableDesc VarDesc;
+        VarDesc.Name = Parser.GetMemberName(TypeID, i);
+        if (VarDesc.Name[0] == '\0')
+            VarDesc.Name = Parser.GetMemberName(SpvType.ParentType, i);
+
+        if (!Parser.GetMemberOffset(SpvType, i, VarDesc.Offset))
+            return false;
+
+        size_t idx = TypeDesc.AddMember(VarDesc);
+        VERIFY_EXPR(idx == i);
+        if (!LoadShaderCodeVariableDesc(Parser, SpvType.MemberTypes[i], Parser.GetMemberDecorationFlags(TypeID, i), IsHLSLSource, TypeDesc.GetMember(idx)))
+            return false;
+    }
+
+    return true;
+}
+
+static bool LoadUBReflection(const SPIRVReflectionParser&           Parser,
+                             const SPIRVReflectionParser::Resource& UB,
+                             bool                                   IsHLSLSource,
+                             ShaderCodeBufferDescX&                 UBDesc)
+{
+    const SPIRVReflectionParser::TypeInfo& SpvType = *Parser.GetType(UB.TypeId);
+
+    size_t Size = 0;
+    if (!Parser.GetDeclaredStructSize(SpvType, Size))
+        return false;
+
+    UBDesc.Size = StaticCast<decltype(UBDesc.Size)>(Size);
+    for (Uint32 i = 0; i < static_cast<Uint32>(SpvType.MemberTypes.size()); ++i)
+    {
+        ShaderCodeVariableDesc VarDesc;
+        VarDesc.Name = Parser.GetMemberName(UB.BaseTypeId, i);
+        if (!Parser.GetMemberOffset(SpvType, i, VarDesc.Offset))
+            return false;
+
+        size_t idx = UBDesc.AddVariable(VarDesc);
+        VERIFY_EXPR(idx == i);
+        if (!LoadShaderCodeVariableDesc(Parser, SpvType.MemberTypes[i], Parser.GetMemberDecorationFlags(SpvType.Self, i), IsHLSLSource, UBDesc.GetVariable(idx)))
+            return false;
+    }
+
+    return true;
+}
+
 
 SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
                                            std::vector<uint32_t> spirv_binary,
                                            const CreateInfo&     CI,
                                            std::string*          pEntryPoint) noexcept(false) :
     m_ShaderType{CI.ShaderType}
+{
+    std::string  EntryPointLocal;
+    std::string& EntryPoint = pEntryPoint != nullptr ? *pEntryPoint : EntryPointLocal;
+
+    // The direct parser only walks the module declarations and is much cheaper than building
+    // the SPIRV-Cross compiler. It produces identical results, and declines the modules it
+    // does not support, in which case we fall back to SPIRV-Cross.
+    if (CI.UseSPIRVCross || !LoadDirect(Allocator, spirv_binary, CI, EntryPoint))
+    {
+        LoadWithSPIRVCross(Allocator, std::move(spirv_binary), CI, EntryPoint);
+        m_ReflectedWithSPIRVCross = true;
+    }
+    //LOG_INFO_MESSAGE(DumpResources());
+}
+
+void SPIRVShaderResources::LoadWithSPIRVCross(IMemoryAllocator&     Allocator,
+                                              std::vector<uint32_t> spirv_binary,
+                                              const CreateInfo&     CI,
+                                              std::string&          EntryPoint) noexcept(false)
 {
     // https://github.com/KhronosGroup/SPIRV-Cross/wiki/Reflection-API-user-guide
     diligent_spirv_cross::Parser parser{std::move(spirv_binary)};
@@ -486,9 +693,6 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
     m_IsHLSLSource = ParsedIRSource.hlsl;
     diligent_spirv_cross::Compiler Compiler{std::move(parser.get_parsed_ir())};
 
-    std::string  EntryPointLocal;
-    std::string& EntryPoint = pEntryPoint != nullptr ? *pEntryPoint : EntryPointLocal;
-
     spv::ExecutionModel ExecutionModel = ShaderTypeToSpvExecutionModel(m_ShaderType);
     auto                EntryPoints    = Compiler.get_entry_points_and_stages();
     for (const diligent_spirv_cross::EntryPoint& CurrEntryPoint : EntryPoints)
@@ -914,7 +1118,400 @@ SPIRVShaderResources::SPIRVShaderResources(IMemoryAllocator&     Allocator,
         VERIFY_EXPR(UBReflections.size() == GetNumUBs());
         m_UBReflectionBuffer = ShaderCodeBufferDescX::PackArray(UBReflections.cbegin(), UBReflections.cend(), GetRawAllocator());
     }
-    //LOG_INFO_MESSAGE(DumpResources());
+}
+
+bool SPIRVShaderResources::LoadDirect(IMemoryAllocator&            Allocator,
+                                      const std::vector<uint32_t>& spirv_binary,
+                                      const CreateInfo&            CI,
+                                      std::string&                 EntryPoint) noexcept(false)
+{
+    using ResourceType = SPIRVShaderResourceAttribs::ResourceType;
+    using SPIRVType    = SPIRVReflectionParser::TypeInfo;
+
+    SPIRVReflectionParser Parser;
+    if (!Parser.Parse(spirv_binary.data(), spirv_binary.size()))
+        return false;
+
+    // Everything that may make us fall back to SPIRV-Cross is done first,
+    // before any state is modified or any message is logged.
+
+    const Uint32 ExecutionModel = static_cast<Uint32>(ShaderTypeToSpvExecutionModel(m_ShaderType));
+
+    const SPIRVReflectionParser::EntryPoint* pEntryPoint = nullptr;
+    for (const SPIRVReflectionParser::EntryPoint& CurrEntryPoint : Parser.GetEntryPoints())
+    {
+        if (CurrEntryPoint.Model == ExecutionModel && (EntryPoint.empty() || EntryPoint == CurrEntryPoint.Name))
+        {
+            pEntryPoint = &CurrEntryPoint;
+            break;
+        }
+    }
+    if (pEntryPoint == nullptr)
+    {
+        // Let SPIRV-Cross report the error
+        return false;
+    }
+
+    if ((m_ShaderType == SHADER_TYPE_COMPUTE || m_ShaderType == SHADER_TYPE_MESH || m_ShaderType == SHADER_TYPE_AMPLIFICATION) &&
+        pEntryPoint->UsesLocalSizeId)
+    {
+        return false;
+    }
+
+    SPIRVReflectionParser::ShaderResources resources;
+    Parser.GetShaderResources(*pEntryPoint, resources);
+
+    const bool IsHLSLSource     = Parser.IsHLSLSource();
+    const bool UseInstanceNames = IsHLSLSource || Parser.GetSourceLanguage() == spv::SourceLanguageSlang;
+
+    struct ResourceInfo
+    {
+        std::string        Name;
+        ResourceType       Type;
+        Uint16             ArraySize;
+        RESOURCE_DIMENSION ResourceDim;
+        bool               IsMS;
+        Uint32             BindingDecorationOffset;
+        Uint32             DescriptorSetDecorationOffset;
+        Uint32             BufferStaticSize;
+        Uint32             BufferStride;
+    };
+    std::array<std::vector<ResourceInfo>, static_cast<size_t>(ResourceClass::NumClasses)> ClassResources;
+
+    auto AddResource = [&](ResourceClass                          ResClass,
+                           const SPIRVReflectionParser::Resource& Res,
+                           std::string                            Name,
+                           ResourceType                           Type,
+                           Uint32                                 BufferStaticSize = 0,
+                           Uint32                                 BufferStride     = 0) {
+        const SPIRVType& SpvType = *Parser.GetType(Res.TypeId);
+
+        uint32_t ArraySize = 1;
+        if (!SpvType.Array.empty())
+        {
+            VERIFY(SpvType.Array.size() == 1, "Only one-dimensional arrays are currently supported");
+            ArraySize = SpvType.Array[0];
+        }
+        VERIFY(ArraySize <= std::numeric_limits<Uint16>::max(), "Array size exceeds maximum representable value ", std::numeric_limits<Uint16>::max());
+
+        ClassResources[static_cast<size_t>(ResClass)].push_back(
+            {
+                std::move(Name),
+                Type,
+                static_cast<Uint16>(ArraySize),
+                Diligent::GetResourceDimension(SpvType),
+                Diligent::IsMultisample(SpvType),
+                Parser.GetBindingDecorationOffset(Res.Id),
+                Parser.GetDescriptorSetDecorationOffset(Res.Id),
+                BufferStaticSize,
+                BufferStride,
+            });
+    };
+
+    auto GetUBOrSBName = [&](const SPIRVReflectionParser::Resource& Res) -> std::string {
+        // See GetUBOrSBName() above for the explanation
+        const char* InstanceName = Parser.GetName(Res.Id);
+        return (UseInstanceNames && *InstanceName != '\0') ? std::string{InstanceName} : Res.Name;
+    };
+
+    for (const SPIRVReflectionParser::Resource& UB : resources.UniformBuffers)
+    {
+        size_t Size = 0;
+        if (!Parser.GetDeclaredStructSize(*Parser.GetType(UB.TypeId), Size))
+            return false;
+        AddResource(ResourceClass::UniformBuffer, UB, GetUBOrSBName(UB), ResourceType::UniformBuffer, static_cast<Uint32>(Size));
+    }
+
+    for (const SPIRVReflectionParser::Resource& SB : resources.StorageBuffers)
+    {
+        const SPIRVType& Type = *Parser.GetType(SB.TypeId);
+
+        size_t Size          = 0;
+        size_t SizeWithArray = 0;
+        if (!Parser.GetDeclaredStructSize(Type, Size) ||
+            !Parser.GetDeclaredStructSizeRuntimeArray(Type, 1, SizeWithArray))
+            return false;
+
+        const Uint32 BufferFlags = Parser.GetBufferBlockFlags(*Parser.GetVariable(SB.Id));
+        const bool   IsReadOnly  = (BufferFlags & SPIRVReflectionParser::DECORATION_FLAG_NON_WRITABLE) != 0;
+
+        AddResource(ResourceClass::StorageBuffer, SB, GetUBOrSBName(SB),
+                    IsReadOnly ? ResourceType::ROStorageBuffer : ResourceType::RWStorageBuffer,
+                    static_cast<Uint32>(Size), static_cast<Uint32>(SizeWithArray - Size));
+    }
+
+    for (const SPIRVReflectionParser::Resource& Img : resources.StorageImages)
+    {
+        const bool IsBuffer = Parser.GetType(Img.TypeId)->Image.Dim == spv::DimBuffer;
+        AddResource(ResourceClass::StorageImage, Img, Img.Name, IsBuffer ? ResourceType::StorageTexelBuffer : ResourceType::StorageImage);
+    }
+
+    for (const SPIRVReflectionParser::Resource& SmplImg : resources.SampledImages)
+    {
+        const bool IsBuffer = Parser.GetType(SmplImg.TypeId)->Image.Dim == spv::DimBuffer;
+        AddResource(ResourceClass::SampledImage, SmplImg, SmplImg.Name, IsBuffer ? ResourceType::UniformTexelBuffer : ResourceType::SampledImage);
+    }
+
+    for (const SPIRVReflectionParser::Resource& AC : resources.AtomicCounters)
+        AddResource(ResourceClass::AtomicCounter, AC, AC.Name, ResourceType::AtomicCounter);
+
+    for (const SPIRVReflectionParser::Resource& SepSam : resources.SeparateSamplers)
+        AddResource(ResourceClass::SeparateSampler, SepSam, SepSam.Name, ResourceType::SeparateSampler);
+
+    for (const SPIRVReflectionParser::Resource& SepImg : resources.SeparateImages)
+    {
+        const bool IsBuffer = Parser.GetType(SepImg.TypeId)->Image.Dim == spv::DimBuffer;
+        AddResource(ResourceClass::SeparateImage, SepImg, SepImg.Name, IsBuffer ? ResourceType::UniformTexelBuffer : ResourceType::SeparateImage);
+    }
+
+    for (const SPIRVReflectionParser::Resource& SubpassInput : resources.SubpassInputs)
+        AddResource(ResourceClass::InputAttachment, SubpassInput, SubpassInput.Name, ResourceType::InputAttachment);
+
+    for (const SPIRVReflectionParser::Resource& AccelStruct : resources.AccelerationStructures)
+        AddResource(ResourceClass::AccelStruct, AccelStruct, AccelStruct.Name, ResourceType::AccelerationStructure);
+
+    for (const SPIRVReflectionParser::Resource& PushConst : resources.PushConstantBuffers)
+    {
+        size_t Size = 0;
+        if (!Parser.GetDeclaredStructSize(*Parser.GetType(PushConst.TypeId), Size))
+            return false;
+
+        // See GetPushConstantName()
+        std::string Name = GetUBOrSBName(PushConst);
+        if (Name.empty())
+            Name = Parser.GetName(PushConst.BaseTypeId);
+
+        // Push constants have no binding or descriptor set decorations and are never arrays
+        ClassResources[static_cast<size_t>(ResourceClass::PushConstant)].push_back(
+            {
+                std::move(Name),
+                ResourceType::PushConstant,
+                Uint16{1},
+                RESOURCE_DIM_BUFFER,
+                false,
+                0u,
+                0u,
+                static_cast<Uint32>(Size),
+                0u,
+            });
+    }
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 13, "Please handle the new resource type here");
+
+    std::vector<ShaderCodeBufferDescX> UBReflections;
+    if (CI.LoadUniformBufferReflection)
+    {
+        UBReflections.resize(resources.UniformBuffers.size());
+        for (size_t i = 0; i < resources.UniformBuffers.size(); ++i)
+        {
+            if (!LoadUBReflection(Parser, resources.UniformBuffers[i], IsHLSLSource, UBReflections[i]))
+                return false;
+        }
+    }
+
+    // From this point on, the direct path can't fail.
+
+    m_IsHLSLSource = IsHLSLSource;
+
+    for (const SPIRVReflectionParser::EntryPoint& CurrEntryPoint : Parser.GetEntryPoints())
+    {
+        if (CurrEntryPoint.Model == ExecutionModel)
+        {
+            if (!EntryPoint.empty())
+            {
+                LOG_WARNING_MESSAGE("More than one entry point of type ", GetShaderTypeLiteralName(m_ShaderType), " found in SPIRV binary for shader '", CI.Name, "'. The first one ('", EntryPoint, "') will be used.");
+            }
+            else
+            {
+                EntryPoint = CurrEntryPoint.Name;
+            }
+        }
+    }
+
+    // Vulkan spec allows only one push_constant buffer per pipeline
+    if (resources.PushConstantBuffers.size() > 1)
+    {
+        LOG_ERROR_AND_THROW("Shader '", CI.Name, "' contains ", resources.PushConstantBuffers.size(),
+                            " push constant buffers, but Vulkan spec allows only one push_constant buffer per pipeline.");
+    }
+
+    size_t ResourceNamesPoolSize = 0;
+    for (const std::vector<ResourceInfo>& Resources : ClassResources)
+    {
+        for (const ResourceInfo& Res : Resources)
+            ResourceNamesPoolSize += Res.Name.length() + 1;
+    }
+
+    if (CI.CombinedSamplerSuffix != nullptr)
+    {
+        ResourceNamesPoolSize += strlen(CI.CombinedSamplerSuffix) + 1;
+    }
+
+    VERIFY_EXPR(CI.Name != nullptr);
+    ResourceNamesPoolSize += strlen(CI.Name) + 1;
+
+    Uint32 NumShaderStageInputs = 0;
+
+    bool LoadShaderStageInputs = CI.LoadShaderStageInputs;
+    if (!m_IsHLSLSource || resources.StageInputs.empty())
+        LoadShaderStageInputs = false;
+    if (LoadShaderStageInputs)
+    {
+        if (Parser.HasHlslFunctionality1())
+        {
+            for (const SPIRVReflectionParser::Resource& Input : resources.StageInputs)
+            {
+                if (Parser.HasDecoration(Input.Id, SPIRVReflectionParser::DECORATION_FLAG_HLSL_SEMANTIC))
+                {
+                    ResourceNamesPoolSize += strlen(Parser.GetHlslSemantic(Input.Id)) + 1;
+                    ++NumShaderStageInputs;
+                }
+                else
+                {
+                    LOG_ERROR_MESSAGE("Shader input '", Input.Name, "' does not have DecorationHlslSemanticGOOGLE decoration, which is unexpected as the shader declares SPV_GOOGLE_hlsl_functionality1 extension");
+                }
+            }
+        }
+        else
+        {
+            LoadShaderStageInputs = false;
+            LOG_WARNING_MESSAGE("SPIRV byte code of shader '", CI.Name,
+                                "' does not use SPV_GOOGLE_hlsl_functionality1 extension. "
+                                "As a result, it is not possible to get semantics of shader inputs and map them to proper locations. "
+                                "The shader will still work correctly if all attributes are declared in ascending order without any gaps. "
+                                "Enable SPV_GOOGLE_hlsl_functionality1 in your compiler to allow proper mapping of vertex shader inputs.");
+        }
+    }
+
+    auto GetClassSize = [&ClassResources](ResourceClass ResClass) {
+        return static_cast<Uint32>(ClassResources[static_cast<size_t>(ResClass)].size());
+    };
+
+    ResourceCounters ResCounters;
+    ResCounters.NumUBs           = GetClassSize(ResourceClass::UniformBuffer);
+    ResCounters.NumSBs           = GetClassSize(ResourceClass::StorageBuffer);
+    ResCounters.NumImgs          = GetClassSize(ResourceClass::StorageImage);
+    ResCounters.NumSmpldImgs     = GetClassSize(ResourceClass::SampledImage);
+    ResCounters.NumACs           = GetClassSize(ResourceClass::AtomicCounter);
+    ResCounters.NumSepSmplrs     = GetClassSize(ResourceClass::SeparateSampler);
+    ResCounters.NumSepImgs       = GetClassSize(ResourceClass::SeparateImage);
+    ResCounters.NumInptAtts      = GetClassSize(ResourceClass::InputAttachment);
+    ResCounters.NumAccelStructs  = GetClassSize(ResourceClass::AccelStruct);
+    ResCounters.NumPushConstants = GetClassSize(ResourceClass::PushConstant);
+    static_assert(Uint32{SPIRVShaderResourceAttribs::ResourceType::NumResourceTypes} == 13, "Please set the new resource type counter here");
+
+    // Specialization constants reflection
+    std::vector<SPIRVSpecializationConstantAttribs> SpecConstants;
+    for (const SPIRVReflectionParser::SpecializationConstant& sc : Parser.GetSpecializationConstants())
+    {
+        if (!Parser.HasDecoration(sc.Id, SPIRVReflectionParser::DECORATION_FLAG_SPEC_ID))
+            continue;
+
+        const SPIRVType& Type   = *Parser.GetType(sc.TypeId);
+        const Uint32     SpecId = Parser.GetSpecId(sc.Id);
+
+        // Only support scalar specialization constants
+        if (Type.VecSize != 1 || Type.Columns != 1)
+        {
+            LOG_WARNING_MESSAGE("Specialization constant '", Parser.GetName(sc.Id),
+                                "' (SpecId=", SpecId, ") in shader '", CI.Name,
+                                "' is not a scalar type and will be skipped.");
+            continue;
+        }
+
+        const char* Name = Parser.GetName(sc.Id);
+        if (*Name == '\0')
+        {
+            LOG_WARNING_MESSAGE("Specialization constant with SpecId=", SpecId,
+                                " in shader '", CI.Name, "' has no name (OpName) and will be skipped.");
+            continue;
+        }
+        ResourceNamesPoolSize += strlen(Name) + 1;
+
+        SpecConstants.emplace_back(
+            Name,
+            SpecId,
+            // Use 4 bytes (VkBool32) for bool specialization constants
+            Type.Base == SPIRVReflectionParser::BaseType::Boolean ? 4 : Type.Width / 8,
+            SpirvBaseTypeToShaderCodeBasicType(Type.Base));
+    }
+    const Uint32 NumSpecConstants = static_cast<Uint32>(SpecConstants.size());
+
+    // Resource names pool is only needed to facilitate string allocation.
+    StringPool ResourceNamesPool;
+    Initialize(Allocator, ResCounters, NumShaderStageInputs, NumSpecConstants, ResourceNamesPoolSize, ResourceNamesPool);
+
+    for (size_t ResClass = 0; ResClass < ClassResources.size(); ++ResClass)
+    {
+        Uint32 CurrRes = 0;
+        for (const ResourceInfo& Res : ClassResources[ResClass])
+        {
+            new (&GetResAttribs(static_cast<ResourceClass>(ResClass), CurrRes++)) SPIRVShaderResourceAttribs //
+                {
+                    ResourceNamesPool.CopyString(Res.Name),
+                    Res.Type,
+                    Res.ArraySize,
+                    Res.ResourceDim,
+                    Res.IsMS,
+                    Res.BindingDecorationOffset,
+                    Res.DescriptorSetDecorationOffset,
+                    Res.BufferStaticSize,
+                    Res.BufferStride //
+                };
+        }
+        VERIFY_EXPR(CurrRes == GetNumResources(static_cast<ResourceClass>(ResClass)));
+    }
+
+    if (CI.CombinedSamplerSuffix != nullptr)
+    {
+        m_CombinedSamplerSuffix = ResourceNamesPool.CopyString(CI.CombinedSamplerSuffix);
+    }
+
+    m_ShaderName = ResourceNamesPool.CopyString(CI.Name);
+
+    if (LoadShaderStageInputs)
+    {
+        Uint32 CurrStageInput = 0;
+        for (const SPIRVReflectionParser::Resource& Input : resources.StageInputs)
+        {
+            if (Parser.HasDecoration(Input.Id, SPIRVReflectionParser::DECORATION_FLAG_HLSL_SEMANTIC))
+            {
+                new (&GetShaderStageInputAttribs(CurrStageInput++)) SPIRVShaderStageInputAttribs //
+                    {
+                        ResourceNamesPool.CopyString(Parser.GetHlslSemantic(Input.Id)),
+                        Parser.GetLocationDecorationOffset(Input.Id) //
+                    };
+            }
+        }
+        VERIFY_EXPR(CurrStageInput == GetNumShaderStageInputs());
+    }
+
+    for (Uint32 i = 0; i < NumSpecConstants; ++i)
+    {
+        const SPIRVSpecializationConstantAttribs& SC = SpecConstants[i];
+        new (&GetSpecConstant(i)) SPIRVSpecializationConstantAttribs //
+            {
+                ResourceNamesPool.CopyString(SC.Name),
+                SC.SpecId,
+                SC.Size,
+                SC.BasicType //
+            };
+    }
+
+    VERIFY(ResourceNamesPool.GetRemainingSize() == 0, "Names pool must be empty");
+
+    if (m_ShaderType == SHADER_TYPE_COMPUTE || m_ShaderType == SHADER_TYPE_MESH || m_ShaderType == SHADER_TYPE_AMPLIFICATION)
+    {
+        for (uint32_t i = 0; i < m_ComputeGroupSize.size(); ++i)
+            m_ComputeGroupSize[i] = pEntryPoint->LocalSize[i];
+    }
+
+    if (!UBReflections.empty())
+    {
+        VERIFY_EXPR(UBReflections.size() == GetNumUBs());
+        m_UBReflectionBuffer = ShaderCodeBufferDescX::PackArray(UBReflections.cbegin(), UBReflections.cend(), GetRawAllocator());
+    }
+
+    return true;
 }
 
 void SPIRVShaderResources::Initialize(IMemoryAllocator&       Allocator,
@@ -28,6 +28,7 @@
 #include "ShaderToolsCommon.hpp"
 
 #include <unordered_set>
+#include <mutex>
 
 #include "BasicFileSystem.hpp"
 #include "DebugUtilities.hpp"
@@ -35,6 +36,8 @@
 #include "StringDataBlobImpl.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ParsingTools.hpp"
+#include "HashUtils.hpp"
+#include "ShaderSourceFileStampProvider.hpp"
 
 namespace Diligent
 {
@@ -424,41 +427,154 @@ static void ProcessIncludeErrorHandler(const ShaderCreateInfo& ShaderCI, const s
     throw std::pair<std::string, std::string>{std::move(FileInfo), Error};
 }
 
-template <typename IncludeHandlerType>
-void ProcessShaderIncludesImpl(const ShaderCreateInfo& ShaderCI, std::unordered_set<std::string>& Includes, IncludeHandlerType&& IncludeHandler) noexcept(false)
+std::shared_ptr<const ShaderIncludeCache::FileData> ShaderIncludeCache::ParseSource(const Char* Source, size_t SourceLength, RefCntAutoPtr<IDataBlob> pData)
 {
-    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
-
-    ShaderIncludePreprocessInfo FileInfo;
-    FileInfo.Source       = SourceData.Source;
-    FileInfo.SourceLength = SourceData.SourceLength;
-    FileInfo.FilePath     = ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "";
+    std::shared_ptr<FileData> pFile = std::make_shared<FileData>();
 
+    pFile->pData        = std::move(pData);
+    pFile->Source       = Source;
+    pFile->SourceLength = SourceLength;
+    pFile->ContentHash  = ComputeHashRaw(Source, SourceLength);
     FindIncludes(
-        FileInfo.Source, FileInfo.SourceLength,
+        Source, SourceLength,
         [&](const std::string& FilePath, size_t Start, size_t End) //
         {
-            if (!Includes.insert(FilePath).second)
-                return;
-
-            ShaderCreateInfo IncludeCI{ShaderCI};
-            IncludeCI.FilePath     = FilePath.c_str();
-            IncludeCI.Source       = nullptr;
-            IncludeCI.SourceLength = 0;
-            ProcessShaderIncludesImpl(IncludeCI, Includes, IncludeHandler);
+            pFile->Includes.push_back({FilePath, Start, End});
         },
-        std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
+        [&](const std::string& Error) //
+        {
+            pFile->ParseError = Error;
+        });
+
+    return pFile;
+}
+
+std::shared_ptr<const ShaderIncludeCache::FileData> ShaderIncludeCache::GetFile(IShaderSourceInputStreamFactory* pFactory, const Char* FilePath, bool* pFromCache)
+{
+    VERIFY_EXPR(pFactory != nullptr && FilePath != nullptr);
+
+    if (pFromCache != nullptr)
+        *pFromCache = false;
+
+    std::string FullPath;
+    FileStat    Stat;
+
+    RefCntAutoPtr<IShaderSourceFileStampProvider> pStampProvider{pFactory, IID_ShaderSourceFileStampProvider};
+
+    const bool HasStamp = pStampProvider && pStampProvider->GetFileStamp(FilePath, FullPath, Stat);
+    if (HasStamp)
+    {
+        std::shared_lock<Threading::SharedMutex> Lock{m_Mtx};
+
+        auto it = m_Files.find(FullPath);
+        if (it != m_Files.end() && it->second.ModificationTime == Stat.ModificationTime && it->second.Size == Stat.Size)
+        {
+            m_NumHits.fetch_add(1);
+            if (pFromCache != nullptr)
+                *pFromCache = true;
+            return it->second.pData;
+        }
+    }
+    m_NumMisses.fetch_add(1);
+
+    RefCntAutoPtr<IFileStream> pSourceStream;
+    pFactory->CreateInputStream2(FilePath, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pSourceStream);
+    if (pSourceStream == nullptr)
+        return {};
+
+    RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
+    pSourceStream->ReadBlob(pFileData);
+
+    const Char* const Source = pFileData->GetConstDataPtr<Char>();
+    const size_t      Length = pFileData->GetSize();
+
+    std::shared_ptr<const FileData> pFile = ParseSource(Source, Length, RefCntAutoPtr<IDataBlob>{pFileData});
+    if (HasStamp)
+    {
+        // The stamp was taken before reading the file, so if the file is modified in between,
+        // the entry will be treated as out of date next time.
+        std::unique_lock<Threading::SharedMutex> Lock{m_Mtx};
+
+        FileEntry& Entry       = m_Files[FullPath];
+        Entry.ModificationTime = Stat.ModificationTime;
+        Entry.Size             = Stat.Size;
+        Entry.pData            = pFile;
+    }
+
+    return pFile;
+}
+
+void ShaderIncludeCache::Clear()
+{
+    std::unique_lock<Threading::SharedMutex> Lock{m_Mtx};
+    m_Files.clear();
+}
+
+size_t ShaderIncludeCache::GetFileCount() const
+{
+    std::shared_lock<Threading::SharedMutex> Lock{m_Mtx};
+    return m_Files.size();
+}
+
+// Reads the shader source through the cache, if one is given, and parses its include directives.
+static std::shared_ptr<const ShaderIncludeCache::FileData> LoadShaderSource(const ShaderCreateInfo& ShaderCI, ShaderIncludeCache* pCache) noexcept(false)
+{
+    std::shared_ptr<const ShaderIncludeCache::FileData> pFile;
+    if (ShaderCI.Source == nullptr && pCache != nullptr && ShaderCI.pShaderSourceStreamFactory != nullptr && ShaderCI.FilePath != nullptr)
+    {
+        pFile = pCache->GetFile(ShaderCI.pShaderSourceStreamFactory, ShaderCI.FilePath);
+        if (!pFile)
+            LOG_ERROR_AND_THROW("Failed to load shader source file '", ShaderCI.FilePath, '\'');
+    }
+    else
+    {
+        ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+        pFile = ShaderIncludeCache::ParseSource(SourceData.Source, SourceData.SourceLength, std::move(SourceData.pFileData));
+    }
+
+    if (!pFile->ParseError.empty())
+        ProcessIncludeErrorHandler(ShaderCI, pFile->ParseError);
+
+    return pFile;
+}
+
+static void ProcessShaderIncludesImpl(const ShaderCreateInfo&                                        ShaderCI,
+                                      std::unordered_set<std::string>&                               Includes,
+                                      ShaderIncludeCache*                                            pCache,
+                                      const std::function<void(const ShaderIncludePreprocessInfo&)>& IncludeHandler) noexcept(false)
+{
+    const std::shared_ptr<const ShaderIncludeCache::FileData> pFile = LoadShaderSource(ShaderCI, pCache);
+
+    for (const ShaderIncludeCache::IncludeDirective& Include : pFile->Includes)
+    {
+        if (!Includes.insert(Include.FilePath).second)
+            continue;
+
+        ShaderCreateInfo IncludeCI{ShaderCI};
+        IncludeCI.FilePath     = Include.FilePath.c_str();
+        IncludeCI.Source       = nullptr;
+        IncludeCI.SourceLength = 0;
+        ProcessShaderIncludesImpl(IncludeCI, Includes, pCache, IncludeHandler);
+    }
 
     if (IncludeHandler)
+    {
+        ShaderIncludePreprocessInfo FileInfo;
+        FileInfo.Source       = pFile->Source;
+        FileInfo.SourceLength = pFile->SourceLength;
+        FileInfo.FilePath     = ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : "";
         IncludeHandler(FileInfo);
+    }
 }
 
-bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler) noexcept
+bool ProcessShaderIncludes(const ShaderCreateInfo&                                  ShaderCI,
+                           std::function<void(const ShaderIncludePreprocessInfo&)> IncludeHandler,
+                           ShaderIncludeCache*                                      pCache) noexcept
 {
     try
     {
         std::unordered_set<std::string> Includes;
-        ProcessShaderIncludesImpl(ShaderCI, Includes, IncludeHandler);
+        ProcessShaderIncludesImpl(ShaderCI, Includes, pCache, IncludeHandler);
         return true;
     }
     catch (const std::pair<std::string, std::string>& ErrInfo)
@@ -473,44 +589,54 @@ bool ProcessShaderIncludes(const ShaderCreateInfo& ShaderCI, std::function<void(
     }
 }
 
-static std::string UnrollShaderIncludesImpl(ShaderCreateInfo ShaderCI, std::unordered_set<std::string>& AllIncludes) noexcept(false)
+std::vector<std::string> FindShaderIncludes(const char* Source, size_t SourceLength) noexcept(false)
 {
-    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+    std::vector<std::string> Includes;
+    FindIncludes(
+        Source, SourceLength,
+        [&](const std::string& FilePath, size_t Start, size_t End) //
+        {
+            Includes.emplace_back(FilePath);
+        },
+        [](const std::string& Error) //
+        {
+            LOG_ERROR_AND_THROW("Failed to find includes: ", Error);
+        });
+    return Includes;
+}
 
-    ShaderCI.Source       = SourceData.Source;
-    ShaderCI.SourceLength = SourceData.SourceLength;
-    ShaderCI.FilePath     = nullptr;
+static void UnrollShaderIncludesImpl(const ShaderCreateInfo&          ShaderCI,
+                                     std::unordered_set<std::string>& AllIncludes,
+                                     ShaderIncludeCache*              pCache,
+                                     std::string&                     Output) noexcept(false)
+{
+    const std::shared_ptr<const ShaderIncludeCache::FileData> pFile = LoadShaderSource(ShaderCI, pCache);
 
-    std::stringstream Stream;
+    const Char* const Source         = pFile->Source;
     size_t            PrevIncludeEnd = 0;
+    for (const ShaderIncludeCache::IncludeDirective& Include : pFile->Includes)
+    {
+        // Insert text before the include start
+        Output.append(Source + PrevIncludeEnd, Include.Start - PrevIncludeEnd);
 
-    FindIncludes(
-        ShaderCI.Source, ShaderCI.SourceLength, [&](const std::string& Path, size_t IncludeStart, size_t IncludeEnd) {
-            // Insert text before the include start
-            Stream.write(ShaderCI.Source + PrevIncludeEnd, IncludeStart - PrevIncludeEnd);
-
-            if (AllIncludes.insert(Path).second)
-            {
-                // Process the #include directive
-                ShaderCreateInfo IncludeCI{ShaderCI};
-                IncludeCI.Source            = nullptr;
-                IncludeCI.SourceLength      = 0;
-                IncludeCI.FilePath          = Path.c_str();
-                std::string UnrolledInclude = UnrollShaderIncludesImpl(IncludeCI, AllIncludes);
-                Stream << UnrolledInclude;
-            }
+        if (AllIncludes.insert(Include.FilePath).second)
+        {
+            // Process the #include directive
+            ShaderCreateInfo IncludeCI{ShaderCI};
+            IncludeCI.Source       = nullptr;
+            IncludeCI.SourceLength = 0;
+            IncludeCI.FilePath     = Include.FilePath.c_str();
+            UnrollShaderIncludesImpl(IncludeCI, AllIncludes, pCache, Output);
+        }
 
-            PrevIncludeEnd = IncludeEnd;
-        },
-        std::bind(ProcessIncludeErrorHandler, ShaderCI, std::placeholders::_1));
+        PrevIncludeEnd = Include.End;
+    }
 
     // Insert text after the last include
-    Stream.write(ShaderCI.Source + PrevIncludeEnd, ShaderCI.SourceLength - PrevIncludeEnd);
-
-    return Stream.str();
+    Output.append(Source + PrevIncludeEnd, pFile->SourceLength - PrevIncludeEnd);
 }
 
-std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(false)
+std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI, ShaderIncludeCache* pCache) noexcept(false)
 {
     std::unordered_set<std::string> Includes;
     if (ShaderCI.FilePath != nullptr)
@@ -518,7 +644,9 @@ std::string UnrollShaderIncludes(const ShaderCreateInfo& ShaderCI) noexcept(fals
 
     try
     {
-        return UnrollShaderIncludesImpl(ShaderCI, Includes);
+        std::string Output;
+        UnrollShaderIncludesImpl(ShaderCI, Includes, pCache, Output);
+        return Output;
     }
     catch (const std::pair<std::string, std::string>& ErrInfo)
     {
@@ -137,6 +137,25 @@ struct FindFileData
     bool   IsDirectory = false;
 };
 
+/// File attributes that identify a particular version of a file.
+struct FileStat
+{
+    /// Last modification time, in platform-specific units.
+    Uint64 ModificationTime = 0;
+
+    /// File size, in bytes.
+    Uint64 Size = 0;
+
+    constexpr bool operator==(const FileStat& RHS) const
+    {
+        return ModificationTime == RHS.ModificationTime && Size == RHS.Size;
+    }
+    constexpr bool operator!=(const FileStat& RHS) const
+    {
+        return !(*this == RHS);
+    }
+};
+
 /// Basic platform-specific file system functions
 struct BasicFileSystem
 {
@@ -157,6 +176,10 @@ public:
 
     static bool FileExists(const Char* strFilePath);
 
+    /// Retrieves the modification time and size of the file without opening it.
+    /// Returns false if the file does not exist or the information is not available on this platform.
+    static bool GetFileStat(const Char* strFilePath, FileStat& Stat);
+
     static void SetWorkingDirectory(const Char* strWorkingDir) { m_strWorkingDirectory = strWorkingDir; }
 
     static const String& GetWorkingDirectory() { return m_strWorkingDirectory; }
@@ -93,6 +93,11 @@ bool BasicFileSystem::FileExists(const Char* strFilePath)
     return false;
 }
 
+bool BasicFileSystem::GetFileStat(const Char* strFilePath, FileStat& Stat)
+{
+    return false;
+}
+
 void BasicFileSystem::CorrectSlashes(String& Path, Char Slash)
 {
     if (Slash != 0)
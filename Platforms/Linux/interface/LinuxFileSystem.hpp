@@ -46,6 +46,7 @@ public:
 
     static bool FileExists(const Char* strFilePath);
     static bool PathExists(const Char* strPath);
+    static bool GetFileStat(const Char* strFilePath, FileStat& Stat);
 
     static bool CreateDirectory(const Char* strPath);
     static bool DeleteDirectory(const Char* strPath);
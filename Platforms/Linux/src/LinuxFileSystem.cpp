@@ -72,6 +72,25 @@ bool LinuxFileSystem::FileExists(const Char* strFilePath)
     return !S_ISDIR(StatBuff.st_mode);
 }
 
+bool LinuxFileSystem::GetFileStat(const Char* strFilePath, FileStat& Stat)
+{
+    std::string path{strFilePath};
+    CorrectSlashes(path);
+
+    struct stat StatBuff;
+    if (stat(path.c_str(), &StatBuff) != 0 || S_ISDIR(StatBuff.st_mode))
+        return false;
+
+#if PLATFORM_APPLE
+    const struct timespec& MTime = StatBuff.st_mtimespec;
+#else
+    const struct timespec& MTime = StatBuff.st_mtim;
+#endif
+    Stat.ModificationTime = static_cast<Uint64>(MTime.tv_sec) * 1000000000ull + static_cast<Uint64>(MTime.tv_nsec);
+    Stat.Size             = static_cast<Uint64>(StatBuff.st_size);
+    return true;
+}
+
 bool LinuxFileSystem::PathExists(const Char* strPath)
 {
     std::string path{strPath};
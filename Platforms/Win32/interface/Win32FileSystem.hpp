@@ -49,6 +49,7 @@ public:
 
     static bool FileExists(const Char* strFilePath);
     static bool PathExists(const Char* strPath);
+    static bool GetFileStat(const Char* strFilePath, FileStat& Stat);
 
     static void SetWorkingDirectory(const Char* strWorkingDir);
 
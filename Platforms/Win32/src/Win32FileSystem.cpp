@@ -122,6 +122,11 @@ public:
         return CALL_WIN_FUNC(GetFileAttributes);
     }
 
+    bool GetFileAttributesEx_(WIN32_FILE_ATTRIBUTE_DATA& Data) const
+    {
+        return CALL_WIN_FUNC(GetFileAttributesEx, GetFileExInfoStandard, &Data) != FALSE;
+    }
+
     bool SetFileAttributes_(DWORD dwAttributes) const
     {
         return CALL_WIN_FUNC(SetFileAttributes, dwAttributes) != FALSE;
@@ -416,6 +421,18 @@ bool WindowsFileSystem::PathExists(const Char* strPath)
     return WndPath.PathFileExists_();
 }
 
+bool WindowsFileSystem::GetFileStat(const Char* strFilePath, FileStat& Stat)
+{
+    const WindowsPathHelper   WndPath{strFilePath};
+    WIN32_FILE_ATTRIBUTE_DATA Data{};
+    if (!WndPath.GetFileAttributesEx_(Data) || (Data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+        return false;
+
+    Stat.ModificationTime = (static_cast<Uint64>(Data.ftLastWriteTime.dwHighDateTime) << 32u) | Data.ftLastWriteTime.dwLowDateTime;
+    Stat.Size             = (static_cast<Uint64>(Data.nFileSizeHigh) << 32u) | Data.nFileSizeLow;
+    return true;
+}
+
 void WindowsFileSystem::SetWorkingDirectory(const Char* strWorkingDir)
 {
     WindowsPathHelper::SetWorkingDirectory(strWorkingDir);
@@ -0,0 +1,113 @@
+layout(r32f, binding=0)uniform imageBuffer      TexBuff_F/*comment*/;
+layout(rg16i, binding=1)uniform IMAGE_WRITEONLY iimageBuffer      TexBuff_I;
+layout(rgba16ui, binding=2)uniform IMAGE_WRITEONLY uimageBuffer  TexBuff_U;
+
+struct StorageBufferStruct
+{
+    float4 Data;
+};
+struct StorageBufferStruct1
+{
+    float4 Data;
+};
+struct StorageBufferStruct2
+{
+    float4 Data;
+};
+
+layout(binding=0) buffer RWStructBuff0{StorageBufferStruct  RWStructBuff0_data[];}/*comment*/;
+#define RWStructBuff0 RWStructBuff0_data
+
+layout(binding=1) buffer RWStructBuff1{StorageBufferStruct1 RWStructBuff1_data[];};
+#define RWStructBuff1 RWStructBuff1_data
+
+layout(binding=2) buffer RWStructBuff2{StorageBufferStruct2 RWStructBuff2_data[];};
+#define RWStructBuff2 RWStructBuff2_data
+
+
+layout(binding=3) buffer RWStructBuff3{/*comment*/ int RWStructBuff3_data[];};
+#define RWStructBuff3 RWStructBuff3_data
+
+
+void TestGetDimensions()
+{
+    //RWBuffer
+    {
+        uint uWidth;
+        int iWidth;
+        float fWidth;
+        GetRWTexBufferDimensions_1( TexBuff_F,uWidth);
+        //TexBuff_I.GetDimensions(iWidth);
+        //TexBuff_U.GetDimensions(fWidth);
+    }
+}
+
+
+void TestLoad()
+{
+    int4 Location = int4(2, 5, 1, 10);
+
+    //Buffer
+    {
+        LoadRWTexBuffer_1( TexBuff_F,Location.x)_SWIZZLE1;
+        LoadRWTexBuffer_1( TexBuff_I,Location.x)_SWIZZLE2;
+        LoadRWTexBuffer_1( TexBuff_U,Location.x)_SWIZZLE4;
+    }
+    StorageBufferStruct  Data0 = RWStructBuff0[Location.x];
+    StorageBufferStruct1 Data1 = RWStructBuff1[Location.y];
+    StorageBufferStruct2 Data2 = RWStructBuff2[Location.w];
+    
+    int Data4 = RWStructBuff3[Location.z];
+}
+
+
+
+void TestStore(uint3 Location)
+{
+    //Buffer
+    {
+        imageStore( TexBuff_F, _ToIvec(Location.x), _ExpandVector( 1.0));
+        imageStore( TexBuff_I, _ToIvec(Location.x), _ExpandVector( int2(1,2)));
+        imageStore( TexBuff_U, _ToIvec(Location.x), _ExpandVector( uint4(1,2,3,4)));
+    }
+    StorageBufferStruct  Data0;
+    StorageBufferStruct1 Data1;
+    StorageBufferStruct2 Data2;
+    Data0.Data = float4(0.0, 1.0, 2.0, 3.0);
+    Data1.Data = float4(0.0, 1.0, 2.0, 3.0);
+    Data2.Data = float4(0.0, 1.0, 2.0, 3.0);
+    RWStructBuff0[Location.x] = Data0;
+    RWStructBuff1[Location.z] = Data1;
+    RWStructBuff2[Location.y] = Data2;
+    RWStructBuff3[Location.x] = 16;
+}
+
+struct CSInputSubstr
+{
+    uint3 DTid;
+};
+struct CSInput
+{
+    uint GroupInd;
+    CSInputSubstr substr;
+};
+
+layout ( local_size_x = 2, local_size_y = 4, local_size_z = 8 ) in;
+
+#define _RETURN_ {\
+return;}
+
+void main()
+{
+    CSInput In;
+    _GET_GL_LOCAL_INVOCATION_INDEX(uint,In.GroupInd);
+    _GET_GL_GLOBAL_INVOCATION_ID(uint3,In.substr.DTid);
+    uint3 Gid;
+    _GET_GL_WORK_GROUP_ID(uint3,Gid);
+    uint3 GTid;
+    _GET_GL_LOCAL_INVOCATION_ID(uint3,GTid);
+
+    TestGetDimensions();
+    TestLoad();
+    TestStore(GTid);
+}
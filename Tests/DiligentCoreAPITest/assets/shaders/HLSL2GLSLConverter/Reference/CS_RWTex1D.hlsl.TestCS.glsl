@@ -0,0 +1,166 @@
+#ifndef _INCLUDE_TEST_FXH_
+#define _INCLUDE_TEST_FXH_
+
+#define PI (3.1415927f)
+
+struct SomeStruct
+{
+    float a;
+    int b;
+};
+
+#endif //_INCLUDE_TEST_FXH_
+
+// # include <- fix commented include
+
+
+//#define TEXTURE2D Texture2D <- Macros do not work currently
+//TEXTURE2D MacroTex2D;
+
+/******//* /* /**** / */
+void EmptyFunc(){}uniform cbTest1{int a;};uniform cbTest2{int b;};/*comment
+test
+
+*/uniform cbTest3{int c;};//Single line comment
+uniform cbTest4{int d;};
+
+uniform cbTest5
+{
+    float4 e;
+};
+
+uniform cbTest6
+{
+    float4 f;
+};
+
+int cbuffer_fake;
+int fakecbuffer;
+
+VK_IMAGE_FORMAT(r32f) layout(r32f, binding=0)uniform image1D Tex1D_F1/*comment*/;
+VK_IMAGE_FORMAT(r32i) layout(rg32i, binding=1)uniform IMAGE_WRITEONLY iimage1D Tex1D_I;
+VK_IMAGE_FORMAT(rgba32ui) layout(rgba32ui, binding=2)uniform IMAGE_WRITEONLY uimage1D Tex1D_U;
+
+layout(r32f, binding=3)uniform image1DArray  Tex1D_F_A;
+layout(rg16i, binding=4)uniform IMAGE_WRITEONLY iimage1DArray   Tex1D_I_A;
+layout(rgba16ui, binding=5)uniform IMAGE_WRITEONLY uimage1DArray  Tex1D_U_A;
+
+void TestGetDimensions()
+{
+    // RWTexture1D
+    {
+        uint uWidth;
+        float fWidth;
+        int iWidth;
+        GetRWTex1DDimensions_1( Tex1D_F1,uWidth);
+        GetRWTex1DDimensions_1( Tex1D_I, uWidth);
+        GetRWTex1DDimensions_1( Tex1D_U, uWidth );
+
+        GetRWTex1DDimensions_1( Tex1D_F1,fWidth);
+        GetRWTex1DDimensions_1( Tex1D_I, fWidth);
+        GetRWTex1DDimensions_1( Tex1D_U, fWidth );
+
+        GetRWTex1DDimensions_1( Tex1D_F1,iWidth);
+        GetRWTex1DDimensions_1( Tex1D_I, iWidth);
+        GetRWTex1DDimensions_1( Tex1D_U, iWidth );
+    }
+
+    // RWTexture1DArray
+    {
+        uint uWidth, uElems;
+        int iWidth, iElems;
+        float fWidth, fElems;
+        GetRWTex1DArrDimensions_2( Tex1D_F_A,uWidth, uElems);
+        GetRWTex1DArrDimensions_2( Tex1D_U_A, uWidth, uElems);
+        GetRWTex1DArrDimensions_2( Tex1D_I_A, uWidth , uElems );
+
+        GetRWTex1DArrDimensions_2( Tex1D_F_A,iWidth, iElems);
+        GetRWTex1DArrDimensions_2( Tex1D_U_A, iWidth, iElems);
+        GetRWTex1DArrDimensions_2( Tex1D_I_A, iWidth , iElems );
+
+        GetRWTex1DArrDimensions_2( Tex1D_F_A,fWidth, fElems);
+        GetRWTex1DArrDimensions_2( Tex1D_U_A, fWidth, fElems);
+        GetRWTex1DArrDimensions_2( Tex1D_I_A, fWidth , fElems );
+    }
+}
+
+void TestLoad()
+{
+    int4 Location = int4(2, 5, 1, 10);
+
+    // Texture1D
+    {
+        float f  = LoadRWTex1D_1( Tex1D_F1,Location.x)_SWIZZLE1;
+        int2 i2  = LoadRWTex1D_1( Tex1D_I,Location.x)_SWIZZLE2.xy;
+        uint4 u4 = LoadRWTex1D_1( Tex1D_U,Location.x)_SWIZZLE4;
+
+#ifndef VULKAN // Only 4-component RW textures can be read with [] in SPIRV
+        f += imageLoad( Tex1D_F1, _ToIvec(Location.x)).x;
+        i2  += imageLoad( Tex1D_I, _ToIvec(Location.x)).xy;
+#endif
+        u4 += imageLoad( Tex1D_U, _ToIvec(Location.x));
+    }
+
+    // Texture1DArray
+    {
+        float f  = LoadRWTex1DArr_1( Tex1D_F_A,Location.xy)_SWIZZLE1;
+        int2 i2  = LoadRWTex1DArr_1( Tex1D_I_A,Location.xy)_SWIZZLE2;
+        uint4 u4 = LoadRWTex1DArr_1( Tex1D_U_A,Location.xy)_SWIZZLE4;
+
+#ifndef VULKAN // Only 4-component RW textures can be read with [] in SPIRV
+        f  += imageLoad( Tex1D_F_A, _ToIvec(Location.xy)).x;
+        i2 += imageLoad( Tex1D_I_A, _ToIvec(Location.xy)).xy;
+#endif
+        u4 += imageLoad( Tex1D_U_A, _ToIvec(Location.xy));
+    }
+}
+
+
+
+void TestStore(uint2 Location)
+{
+    // Texture1D
+    {
+        imageStore( Tex1D_F1, _ToIvec(Location.x), _ExpandVector( 1.0));
+        imageStore( Tex1D_I, _ToIvec( Location.x), _ExpandVector( int2(3,6)));
+        imageStore( Tex1D_U, _ToIvec( Location.x), _ExpandVector( uint4(0,4,7,8)));
+    }
+
+    // Texture1DArray
+    {
+        imageStore( Tex1D_F_A, _ToIvec(Location.xy), _ExpandVector( 3.5));
+        imageStore( Tex1D_U_A, _ToIvec( Location.xy), _ExpandVector( uint4(2,4,2,5)));
+        imageStore( Tex1D_I_A, _ToIvec(Location.xy), _ExpandVector( int2( 13, 19)));
+    }
+}
+
+struct CSInputSubstr
+{
+    uint3 DTid;
+};
+
+struct CSInput
+{
+    uint GroupInd;
+    CSInputSubstr substr;
+};
+
+layout ( local_size_x = 2, local_size_y = 4, local_size_z = 8 ) in;
+
+#define _RETURN_ {\
+return;}
+
+void main()
+{
+    CSInput In;
+    _GET_GL_LOCAL_INVOCATION_INDEX(uint,In.GroupInd);
+    _GET_GL_GLOBAL_INVOCATION_ID(uint3,In.substr.DTid);
+    uint3 Gid;
+    _GET_GL_WORK_GROUP_ID(uint3,Gid);
+    uint3 GTid;
+    _GET_GL_LOCAL_INVOCATION_ID(uint3,GTid);
+
+    TestGetDimensions();
+    TestLoad();
+    TestStore(GTid.xy);
+}
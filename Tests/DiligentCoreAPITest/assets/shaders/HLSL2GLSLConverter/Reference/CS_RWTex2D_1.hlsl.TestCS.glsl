@@ -0,0 +1,316 @@
+#ifndef _INCLUDE_TEST_FXH_
+#define _INCLUDE_TEST_FXH_
+
+#define PI (3.1415927f)
+
+struct SomeStruct
+{
+    float a;
+    int b;
+};
+
+#endif //_INCLUDE_TEST_FXH_
+
+// # include <- fix commented include
+
+
+//#define TEXTURE2D Texture2D <- Macros do not work currently
+//TEXTURE2D MacroTex2D;
+
+/******//* /* /**** / */
+void EmptyFunc(){}uniform cbTest1{int a;};uniform cbTest2/*comment*/{int b;};/*comment
+test
+
+*/uniform cbTest3{int c;};//Single line comment
+uniform cbTest4{int d;};
+
+uniform cbTest5
+{
+    float4 e;
+};
+
+uniform cbTest6
+{
+    float4 f;
+};
+
+int cbuffer_fake;
+int fakecbuffer;
+
+layout(rgba32f, binding=0)uniform IMAGE_WRITEONLY image2D Tex2D_F1/*comment*/;
+layout(rgba32f, binding=0)uniform IMAGE_WRITEONLY image2D Tex2D_F2[2];
+layout(r32f, binding=1)uniform image2D Tex2D_F3;
+layout(r32f, binding=1)uniform image2D/*cmt*/Tex2D_F4;
+layout(r32f, binding=1)uniform image2D  Tex2D_F5;
+VK_IMAGE_FORMAT(rgba16i) layout(rgba16i, binding=2)uniform IMAGE_WRITEONLY iimage2D Tex2D_I;
+VK_IMAGE_FORMAT(r32ui)   layout(r32ui, binding=3)uniform uimage2D Tex2D_U;
+
+
+int GlobalIntVar;uniform sampler2D Tex2D_Test1;uniform sampler2D Tex2D_Test2;/*Comment* / *//* /** Comment2*/uniform sampler2D Tex2D_Test3/*comment*/;
+uniform sampler2D/*comment*/
+//  Comment
+Tex2D_Test4
+;
+
+uniform sampler2D Tex2D_M1;
+uniform sampler2D Tex2D_M2;
+
+groupshared float4 g_f4TestSharedArr[10];
+groupshared int4 g_i4TestSharedArr[10];
+groupshared uint4 g_u4TestSharedArr[10];
+groupshared float4 g_f4TestSharedVar;
+groupshared int4 g_i4TestSharedVar;
+groupshared uint4 g_u4TestSharedVar;
+
+
+void TestGetDimensions()
+{
+    //RWTexture2D
+    {
+        uint uWidth, uHeight;
+        int iWidth, iHeight;
+        float fWidth, fHeight;
+        GetRWTex2DDimensions_2( Tex2D_F1,uWidth, uHeight);
+        GetRWTex2DDimensions_2( Tex2D_F3,uWidth, uHeight);
+        GetRWTex2DDimensions_2( Tex2D_F4,uWidth, uHeight);
+        GetRWTex2DDimensions_2( Tex2D_F2[0], uWidth, uHeight);
+        GetRWTex2DDimensions_2( Tex2D_I,uWidth, uHeight );
+        GetRWTex2DDimensions_2( Tex2D_U, uWidth, uHeight );
+
+        GetRWTex2DDimensions_2( Tex2D_F1,iWidth, iHeight);
+        GetRWTex2DDimensions_2( Tex2D_F2[0], iWidth, iHeight);
+        GetRWTex2DDimensions_2( Tex2D_I,iWidth, iHeight );
+        GetRWTex2DDimensions_2( Tex2D_U, iWidth, iHeight );
+
+        GetRWTex2DDimensions_2( Tex2D_F1,fWidth, fHeight);
+        GetRWTex2DDimensions_2( Tex2D_F2[0], fWidth, fHeight);
+        GetRWTex2DDimensions_2( Tex2D_I,fWidth, fHeight );
+        GetRWTex2DDimensions_2( Tex2D_U, fWidth, fHeight );
+
+        int idx[2];
+        idx[0] = 0;
+        idx[1] = 0;
+        GetRWTex2DDimensions_2( Tex2D_F2[idx[0]], uWidth, uHeight);
+    }
+}
+
+
+void TestLoad()
+{
+    int4 Location = int4(2, 5, 1, 10);
+
+    //Texture2D
+    {
+        float f = LoadRWTex2D_1( Tex2D_F1,Location.xy)_SWIZZLE4.x;
+        f += LoadRWTex2D_1( Tex2D_F1,LoadRWTex2D_1( Tex2D_I,Location.xy)_SWIZZLE4.zw + LoadRWTex2D_1( Tex2D_I,Location.xy)_SWIZZLE4.yx)_SWIZZLE4.y;
+        f += LoadRWTex2D_1( Tex2D_F2[0],Location.xy)_SWIZZLE4.x;
+        f += LoadRWTex2D_1( Tex2D_F2[1],Location.xy)_SWIZZLE4.y;
+        f += LoadRWTex2D_1( Tex2D_F3,Location.xy)_SWIZZLE1;
+        f += LoadRWTex2D_1( Tex2D_F4,Location.xy)_SWIZZLE1;
+        f += LoadRWTex2D_1( Tex2D_F5,Location.xy)_SWIZZLE1;
+
+        int2 i2 = LoadRWTex2D_1( Tex2D_I,Location.xy)_SWIZZLE4.xy;
+        uint u  = LoadRWTex2D_1( Tex2D_U,Location.xy)_SWIZZLE1;
+
+        int idx[2];
+        idx[0] = 0;
+        idx[1] = 0;
+        f += LoadRWTex2D_1( Tex2D_F2[idx[0]],Location.xy)_SWIZZLE4.z;
+        f += LoadRWTex2D_1( Tex2D_F2[idx[1]],Location.xy)_SWIZZLE4.w;
+    }
+
+    {
+        float f = imageLoad( Tex2D_F1, _ToIvec(Location.xy)).x;
+        f += imageLoad( Tex2D_F1, _ToIvec(imageLoad( Tex2D_I, _ToIvec(Location.xy)).xy + imageLoad( Tex2D_I, _ToIvec(Location.xy)).yx)).x;
+
+        int idx[2];
+        idx[0] = 0;
+        idx[1] = 1;
+
+        f += imageLoad( Tex2D_F1, _ToIvec(int2(idx[min(Location.x, 1)], idx[min(Location.y,1)]))).y;
+
+        int2 i2 = imageLoad( Tex2D_I, _ToIvec(Location.xy)).xy;
+
+        f += imageLoad( Tex2D_F2[idx[0]], _ToIvec(int2(idx[min(Location.x,1)], idx[min(Location.y,1)]))).x;
+        f += imageLoad( Tex2D_F2[idx[1]], _ToIvec(int2(idx[min(Location.y,1)], idx[min(Location.x,1)]))).x;
+        f += imageLoad( Tex2D_F2[0], _ToIvec(Location.xy)).x;
+        f += imageLoad( Tex2D_F2[1], _ToIvec(Location.xy)).x;
+
+#ifndef VULKAN // Only 4-component RW textures can be read with [] in SPIRV
+        f += imageLoad( Tex2D_F3, _ToIvec(Location.xy)).x;
+        f += imageLoad( Tex2D_F4, _ToIvec(int2(idx[idx[min(Location.x,1)]],idx[idx[min(Location.y,1)]]))).x;
+        f += imageLoad( Tex2D_F5, _ToIvec(Location.xy)).x;
+
+        uint u  = imageLoad( Tex2D_U, _ToIvec(Location.xy)).x;
+#endif
+    }
+}
+
+
+
+void TestStore(uint2 Location)
+{
+    //Texture2D
+    {
+        imageStore( Tex2D_F1, _ToIvec(Location.xy), _ExpandVector( float4(10.0, 20.0, 30.0, 40.0)));
+        imageStore( Tex2D_F1, _ToIvec(LoadRWTex2D_1( Tex2D_I,Location.xy)_SWIZZLE4.xy + LoadRWTex2D_1( Tex2D_I,Location.xy)_SWIZZLE4.xy), _ExpandVector( float4(20.0, 30.0, 40.0, 50.0)));
+        imageStore( Tex2D_F2[0], _ToIvec(Location.xy), _ExpandVector( float4(1.0, 2.0, 3.0, 4.0)));
+        imageStore( Tex2D_F2[1], _ToIvec(Location.xy), _ExpandVector( float4(2.0, 3.0, 5.0, 7.0)));
+        imageStore( Tex2D_F3, _ToIvec(Location.xy), _ExpandVector( 5.0));
+        imageStore( Tex2D_F4, _ToIvec(Location.xy), _ExpandVector( 7.0));
+        imageStore( Tex2D_F5, _ToIvec(Location.xy), _ExpandVector( 9.0));
+        imageStore( Tex2D_I, _ToIvec(Location.xy), _ExpandVector( int4( 43, 23, 10, 20)));
+        imageStore( Tex2D_U, _ToIvec(Location.xy), _ExpandVector( 3u));
+    }
+    {
+        int2 idx[2];
+        idx[0] = int2(0,0);
+        idx[1] = int2(1,1);
+        imageStore( Tex2D_F1, _ToIvec( idx[ min(Location.x, 1) ]), _ExpandVector( float4(20.0, 30.0, 50.0, 60.0)));
+        imageStore( Tex2D_F1, _ToIvec(imageLoad( Tex2D_I, _ToIvec(Location.xy)).xy + imageLoad( Tex2D_I, _ToIvec(Location.xy)).zw), _ExpandVector( 30.0));
+
+        imageStore( Tex2D_F1, _ToIvec(
+                 idx[
+                     imageLoad( Tex2D_I, _ToIvec(
+                             int2(imageLoad( Tex2D_I, _ToIvec(idx[Location.x])).x, idx[Location.y].y))
+                            ).x
+                    ] +
+                 idx[
+                     imageLoad( Tex2D_I, _ToIvec(
+                             int2(imageLoad( Tex2D_I, _ToIvec(idx[Location.y])).x, idx[Location.x].y))
+                            ).x
+                    ]), _ExpandVector( imageLoad( Tex2D_F2[idx[0].y], _ToIvec(int2(imageLoad( Tex2D_I, _ToIvec(idx[min(Location.x,1)])).x, imageLoad( Tex2D_I, _ToIvec(idx[min(Location.y,1)])).y))).xzyw));
+    }
+}
+
+
+/*
+void TestImageArgs1(RWTexture2D</* format = r32i * /int> in_RWTex, int2 Location)
+{
+    int Width, Height;
+    in_RWTex.GetDimensions (Width, Height );
+    in_RWTex[Location] = Width;
+    InterlockedAdd(in_RWTex[Location], 3);
+    int i  = in_RWTex.Load(Location.xy);
+}
+
+void TestImageArgs2(RWTexture3D<float/*format=r32f* /> in_RWTex)
+{
+    int Width, Height, Depth;
+    in_RWTex.GetDimensions (Width, Height, Depth );
+    float f  = in_RWTex.Load(int3(10,11,23));
+    in_RWTex[int3(1,2,3)] = float4(10.0, 25.0, 26.0, 27.0);
+}
+*/
+
+
+
+int2 GetCoords( uint x, uint y )
+{
+    return int2(x, y);
+}
+
+struct CSInputSubstr
+{
+    uint3 DTid;
+};
+struct CSInput
+{
+    uint GroupInd;
+    CSInputSubstr substr;
+};
+
+layout ( local_size_x = 2, local_size_y = 4, local_size_z = 8 ) in;
+
+#define _RETURN_ {\
+return;}
+
+void main()
+{
+    CSInput In;
+    _GET_GL_LOCAL_INVOCATION_INDEX(uint,In.GroupInd);
+    _GET_GL_GLOBAL_INVOCATION_ID(uint3,In.substr.DTid);
+    uint3 Gid;
+    _GET_GL_WORK_GROUP_ID(uint3,Gid);
+    uint3 GTid;
+    _GET_GL_LOCAL_INVOCATION_ID(uint3,GTid);
+
+    TestGetDimensions();
+    TestLoad();
+    TestStore(GTid.xy);
+
+    uint uOldVal;
+    int iOldVal;
+
+    if( GTid.y == 0u )
+    {
+        g_i4TestSharedVar = int4(0, 0, 0, 0);
+        g_u4TestSharedVar = uint4(0u, 0u, 0u, 0u);
+    }
+    g_i4TestSharedArr[In.GroupInd] = int4(0, 0, 0, 0);
+    g_u4TestSharedArr[In.GroupInd] = uint4(0u, 0u, 0u, 0u);
+
+    InterlockedAddSharedVar_2(g_i4TestSharedVar.x, 1);
+    InterlockedAddSharedVar_2(g_u4TestSharedVar.x, 1u);
+    InterlockedAddSharedVar_3(g_i4TestSharedArr[GTid.x].x, 1, iOldVal);
+    InterlockedAddSharedVar_3(g_u4TestSharedArr[Gid.x].x, 1u, uOldVal);
+    InterlockedAddImage_3(Tex2D_U,Gid.xy, 1u, uOldVal);
+
+    InterlockedAndSharedVar_2(g_i4TestSharedVar.x, 1);
+    InterlockedAndSharedVar_2(g_u4TestSharedVar.x, 1u);
+    InterlockedAndSharedVar_3(g_i4TestSharedArr[GTid.x].x, 1, iOldVal);
+    InterlockedAndSharedVar_3(g_u4TestSharedArr[Gid.x].x, 1u, uOldVal);
+    InterlockedAndImage_3(Tex2D_U,Gid.xy, 1u, uOldVal);
+
+    InterlockedOrSharedVar_2(g_i4TestSharedVar.x, 1);
+    InterlockedOrSharedVar_2(g_u4TestSharedVar.x, 1u);
+    InterlockedOrSharedVar_3(g_i4TestSharedArr[GTid.x].x, 1, iOldVal);
+    InterlockedOrSharedVar_3(g_u4TestSharedArr[Gid.x].x, 1u, uOldVal);
+    InterlockedOrImage_3(Tex2D_U,Gid.xy, 1u, uOldVal);
+
+    InterlockedXorSharedVar_2(g_i4TestSharedVar.x, 1);
+    InterlockedXorSharedVar_2(g_u4TestSharedVar.x, 1u);
+    InterlockedXorSharedVar_3(g_i4TestSharedArr[GTid.x].x, 1, iOldVal);
+    InterlockedXorSharedVar_3(g_u4TestSharedArr[Gid.x].x, 1u, uOldVal);
+    InterlockedXorImage_3(Tex2D_U,Gid.xy, 1u, uOldVal);
+
+    InterlockedMaxSharedVar_2(g_i4TestSharedVar.x, 1);
+    InterlockedMaxSharedVar_2(g_u4TestSharedVar.x, 1u);
+    InterlockedMaxSharedVar_3(g_i4TestSharedArr[GTid.x].x, 1, iOldVal);
+    InterlockedMaxSharedVar_3(g_u4TestSharedArr[Gid.x].x, 1u, uOldVal);
+    InterlockedMaxImage_3(Tex2D_U,Gid.xy, 1u, uOldVal);
+
+    InterlockedMinSharedVar_2(g_i4TestSharedVar.x, 1);
+    InterlockedMinSharedVar_2(g_u4TestSharedVar.x, 1u);
+    InterlockedMinSharedVar_3(g_i4TestSharedArr[GTid.x].x, 1, iOldVal);
+    InterlockedMinSharedVar_3(g_u4TestSharedArr[Gid.x].x, 1u, uOldVal);
+    InterlockedMinImage_3(Tex2D_U,Gid.xy, 1u, uOldVal);
+
+
+    // There is actually no InterlockedExchange() with 2 arguments
+    //InterlockedExchange(g_i4TestSharedVar.x, 1);
+    //InterlockedExchange(g_u4TestSharedVar.x, 1u);
+    InterlockedExchangeSharedVar_3(g_i4TestSharedArr[GTid.x].x, 1, iOldVal);
+    InterlockedExchangeSharedVar_3(g_u4TestSharedArr[Gid.x].x, 1u, uOldVal);
+    InterlockedExchangeImage_3(Tex2D_U,Gid.xy, 1u, uOldVal);
+
+    InterlockedCompareStoreSharedVar_3(g_i4TestSharedVar.x, 1, 10);
+    InterlockedCompareStoreSharedVar_3(g_u4TestSharedVar.x, 1u, 10u);
+    InterlockedCompareExchangeSharedVar_4(g_i4TestSharedArr[GTid.x].x, 1, 10, iOldVal);
+    InterlockedCompareExchangeSharedVar_4(g_u4TestSharedArr[Gid.x].x, 1u, 10u, uOldVal);
+    InterlockedCompareExchangeImage_4(Tex2D_U,Gid.xy, 1u, 10u, uOldVal);
+
+	//uint2 ui2Dim;
+	//g_tex2DTestUAV.GetDimensions(ui2Dim.x, ui2Dim.y);
+	//if( DTid.x >= ui2Dim.x || DTid.y >= ui2Dim.y )return;
+
+	//float2 f2UV = float2(DTid.xy) / float2(ui2Dim);
+	//float DistFromCenter = length(f2UV - float2(0.5,0.5));
+	//g_tex2DTestUAV[DTid.xy] = float4((1-DistFromCenter), abs(f2UV.x-0.5), abs(0.5-f2UV.y), 0);
+    GroupMemoryBarrier();
+    GroupMemoryBarrierWithGroupSync();
+    DeviceMemoryBarrier();
+    DeviceMemoryBarrierWithGroupSync();
+    AllMemoryBarrier();
+    //AllMemoryBarrierWithGroupSync();
+}
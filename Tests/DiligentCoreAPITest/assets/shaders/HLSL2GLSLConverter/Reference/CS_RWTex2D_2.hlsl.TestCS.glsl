@@ -0,0 +1,137 @@
+layout(r32i, binding=0)uniform iimage2D Tex2D_I1;
+layout(r32ui, binding=1)uniform uimage2D Tex2D_U1/*comment*/;
+
+layout(r32f, binding=2)uniform image2DArray  Tex2D_F_A;
+layout(rg8i, binding=3)uniform IMAGE_WRITEONLY iimage2DArray   Tex2D_I_A;
+layout(rgba8ui, binding=4)uniform IMAGE_WRITEONLY uimage2DArray  Tex2D_U_A;
+
+VK_IMAGE_FORMAT(rgba32f)
+layout(rgba32f, binding=5)uniform IMAGE_WRITEONLY image3D Tex3D_F;
+layout(r8i, binding=6)uniform IMAGE_WRITEONLY iimage3D    Tex3D_I;
+layout(rg8ui, binding=7)uniform IMAGE_WRITEONLY uimage3D  Tex3D_U/*comment*/;
+
+void TestGetDimensions()
+{
+    //RWTexture2DArray
+    {
+        uint uWidth, uHeight, uElems;
+        float fWidth, fHeight, fElems;
+        int iWidth, iHeight, iElems;
+        GetRWTex2DArrDimensions_3( Tex2D_F_A,uWidth,uHeight,uElems);
+        GetRWTex2DArrDimensions_3( Tex2D_U_A, uWidth, uHeight, uElems );
+        GetRWTex2DArrDimensions_3( Tex2D_I_A,uWidth , uHeight , uElems ) ;
+
+        GetRWTex2DArrDimensions_3( Tex2D_F_A,iWidth,iHeight,iElems);
+        GetRWTex2DArrDimensions_3( Tex2D_U_A, iWidth, iHeight, iElems );
+        GetRWTex2DArrDimensions_3( Tex2D_I_A,iWidth , iHeight , iElems ) ;
+
+        GetRWTex2DArrDimensions_3( Tex2D_F_A,fWidth,fHeight,fElems);
+        GetRWTex2DArrDimensions_3( Tex2D_U_A, fWidth, fHeight, fElems );
+        GetRWTex2DArrDimensions_3( Tex2D_I_A,fWidth , fHeight , fElems ) ;
+    }
+
+    //RWTexture3D
+    {
+        uint uWidth, uHeight, uDepth;
+        int iWidth, iHeight, iDepth;
+        float fWidth, fHeight, fDepth;
+        GetRWTex3DDimensions_3( Tex3D_F, uWidth, uHeight, uDepth );
+        GetRWTex3DDimensions_3( Tex3D_U,uWidth,uHeight,uDepth);
+        GetRWTex3DDimensions_3( Tex3D_I, uWidth , uHeight , uDepth );
+
+        GetRWTex3DDimensions_3( Tex3D_F, iWidth, iHeight, iDepth );
+        GetRWTex3DDimensions_3( Tex3D_U,iWidth,iHeight,iDepth);
+        GetRWTex3DDimensions_3( Tex3D_I, iWidth , iHeight , iDepth );
+
+        GetRWTex3DDimensions_3( Tex3D_F, fWidth, fHeight, fDepth );
+        GetRWTex3DDimensions_3( Tex3D_U,fWidth,fHeight,fDepth);
+        GetRWTex3DDimensions_3( Tex3D_I, fWidth , fHeight , fDepth );
+    }
+}
+
+
+void TestLoad()
+{
+    int4 Location = int4(2, 5, 1, 10);
+
+    //Texture2DArray
+    {
+        float f  = LoadRWTex2DArr_1( Tex2D_F_A,Location.xyz)_SWIZZLE1;
+        uint4 u4 = LoadRWTex2DArr_1( Tex2D_U_A,Location.xyz)_SWIZZLE4;
+        int2 i2  = LoadRWTex2DArr_1( Tex2D_I_A,Location.xyz)_SWIZZLE2;
+
+        u4 += imageLoad( Tex2D_U_A, _ToIvec(Location.xyz));
+#ifndef VULKAN // Only 4-component RW textures can be read with [] in SPIRV
+        f  += imageLoad( Tex2D_F_A, _ToIvec(Location.xyz)).x;
+        i2 += imageLoad( Tex2D_I_A, _ToIvec(Location.xyz)).xy;
+#endif
+    }
+
+    //Texture3D
+    {
+        float4 f4 = LoadRWTex3D_1( Tex3D_F,Location.xyz)_SWIZZLE4.xyzw;
+        uint2  u2 = LoadRWTex3D_1( Tex3D_U,Location.xyz)_SWIZZLE2.xy;
+        int    i  = LoadRWTex3D_1( Tex3D_I,Location.xyz)_SWIZZLE1;
+
+        f4 += imageLoad( Tex3D_F, _ToIvec(Location.xyz)).xyzw;
+#ifndef VULKAN // Only 4-component RW textures can be read with [] in SPIRV
+        u2 += imageLoad( Tex3D_U, _ToIvec(Location.xyz)).xy;
+        i  += imageLoad( Tex3D_I, _ToIvec(Location.xyz)).x;
+#endif
+    }
+}
+
+
+
+void TestStore(uint3 Location)
+{
+    //Texture2DArray
+    {
+        imageStore( Tex2D_F_A, _ToIvec(Location.xyz), _ExpandVector( 30.0));
+        imageStore( Tex2D_U_A, _ToIvec(Location.xyz), _ExpandVector( uint4(0,5,7,87)));
+        imageStore( Tex2D_I_A, _ToIvec(Location.xyz), _ExpandVector( int2(-3, 5)));
+    }
+
+    //Texture3D
+    {
+        imageStore( Tex3D_F, _ToIvec(Location.xyz), _ExpandVector( float4(10.0, 25.0, 26.0, 27.0)));
+        imageStore( Tex3D_U, _ToIvec(Location.xyz), _ExpandVector( uint2(0,6)));
+        imageStore( Tex3D_I, _ToIvec(Location.xyz), _ExpandVector( -5));
+    }
+}
+
+
+int2 GetCoords( uint x, uint y )
+{
+    return int2(x, y);
+}
+
+struct CSInputSubstr
+{
+    uint3 DTid;
+};
+struct CSInput
+{
+    uint GroupInd;
+    CSInputSubstr substr;
+};
+
+layout ( local_size_x = 2, local_size_y = 4, local_size_z = 8 ) in;
+
+#define _RETURN_ {\
+return;}
+
+void main()
+{
+    CSInput In;
+    _GET_GL_LOCAL_INVOCATION_INDEX(uint,In.GroupInd);
+    _GET_GL_GLOBAL_INVOCATION_ID(uint3,In.substr.DTid);
+    uint3 Gid;
+    _GET_GL_WORK_GROUP_ID(uint3,Gid);
+    uint3 GTid;
+    _GET_GL_LOCAL_INVOCATION_ID(uint3,GTid);
+
+    TestGetDimensions();
+    TestLoad();
+    TestStore(GTid);
+}
@@ -0,0 +1,49 @@
+
+struct VSOutput
+{
+    float4 Pos;
+};
+
+struct GSOutput
+{
+    float4 Pos;
+    uint   PrimId;
+};
+
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 3) out;
+layout(location = 0) flat out uint _gsout_triStream_PrimId;
+#define triStream_Append(VERTEX){\
+_SET_GL_POSITION(VERTEX.Pos);\
+_gsout_triStream_PrimId = VERTEX.PrimId;\
+EmitVertex();}
+
+#define triStream_RestartStrip EndPrimitive
+
+#define _RETURN_ {\
+return;}
+
+void main()
+{
+    const int _NumElements = 3;
+    VSOutput In[_NumElements];
+    for(int i=0; i < _NumElements; ++i)
+    {
+        _GET_GL_POSITION(In[i].Pos);
+    }
+    GSOutput triStream;
+    uint PrimID;
+    _GET_GL_PRIMITIVE_ID(PrimID);
+
+    GSOutput Out;
+    Out.PrimId = PrimID;
+
+    Out.Pos = In[0].Pos;
+    triStream_Append(Out);
+
+    Out.Pos = In[1].Pos;
+    triStream_Append(Out);
+
+    Out.Pos = In[2].Pos;
+    triStream_Append(Out);
+}
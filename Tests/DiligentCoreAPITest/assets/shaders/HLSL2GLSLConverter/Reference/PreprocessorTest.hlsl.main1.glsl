@@ -0,0 +1,51 @@
+struct PSOutput
+{
+    float4 Color;
+};
+
+struct PSInput
+{
+    float4 Pos;
+};
+
+# define PS_OUTPUT PSOutput
+# define PS_INPUT  PSInput
+
+#ifdef MACRO0
+#   define PS_OUTPUT abc
+#elif defined(MACRO1)
+#   define PS_OUTPUT xyz
+#endif
+
+layout(location = 0) out float4 _psout_main1_Color;
+
+#define _RETURN_(_RET_VAL_) {\
+_psout_main1_Color = _RET_VAL_.Color;\
+return;}
+
+void main()
+{
+    PS_INPUT PSIn;
+    _GET_GL_FRAG_COORD(PSIn.Pos);
+
+    PS_OUTPUT PSOut;
+    PSOut.Color = float4(PSIn.Pos.xy, 0.0, 0.0);
+    _RETURN_( PSOut)
+}
+
+#define FLOAT4 float4
+#define FLOAT3 float3
+
+FLOAT4 main2(in PS_INPUT PSIn)
+{
+    return FLOAT4(PSIn.Pos.xy, 0.0, 0.0);
+}
+
+#define VOID void
+#define MACRO1
+
+VOID main3()
+{
+}
+
+#define MACRO2
\ No newline at end of file
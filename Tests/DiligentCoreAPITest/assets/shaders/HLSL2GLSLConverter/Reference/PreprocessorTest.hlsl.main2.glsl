@@ -0,0 +1,51 @@
+struct PSOutput
+{
+    float4 Color;
+};
+
+struct PSInput
+{
+    float4 Pos;
+};
+
+# define PS_OUTPUT PSOutput
+# define PS_INPUT  PSInput
+
+#ifdef MACRO0
+#   define PS_OUTPUT abc
+#elif defined(MACRO1)
+#   define PS_OUTPUT xyz
+#endif
+
+PS_OUTPUT main1(in PS_INPUT PSIn)
+{
+    PS_OUTPUT PSOut;
+    PSOut.Color = float4(PSIn.Pos.xy, 0.0, 0.0);
+    return PSOut;
+}
+
+#define FLOAT4 float4
+#define FLOAT3 float3
+
+layout(location = 0) out float4 _psout_main2;
+
+#define _RETURN_(_RET_VAL_) {\
+_psout_main2 = _RET_VAL_;\
+return;}
+
+void main()
+{
+    PS_INPUT PSIn;
+    _GET_GL_FRAG_COORD(PSIn.Pos);
+
+    _RETURN_( FLOAT4(PSIn.Pos.xy, 0.0, 0.0))
+}
+
+#define VOID void
+#define MACRO1
+
+VOID main3()
+{
+}
+
+#define MACRO2
\ No newline at end of file
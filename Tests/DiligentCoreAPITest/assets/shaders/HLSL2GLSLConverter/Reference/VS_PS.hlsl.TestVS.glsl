@@ -0,0 +1,1394 @@
+#if defined(GL_ES) && (__VERSION__<=300)
+#   define GLES30 1
+#else
+#   define GLES30 0
+#endif
+
+/***//* Some comment * ** * * * / ** //// */ //Another comment
+//
+// Comment
+
+/* More *//*com*///ments/**/
+//
+//
+
+
+#ifndef _INCLUDE_TEST_FXH_
+#define _INCLUDE_TEST_FXH_
+
+#define PI (3.1415927f)
+
+struct SomeStruct
+{
+    float a;
+    int b;
+};
+
+#endif //_INCLUDE_TEST_FXH_
+
+// #include "NonExistingFile.h"
+
+
+//#define TEXTURE2D Texture2D <- Macros do not work currently
+//TEXTURE2D MacroTex2D;
+
+/******//* /* /**** / */
+void EmptyFunc(){}uniform cbTest1/*comment*//*comment*/{int a;};uniform cbTest2{int b;};/*comment
+test
+
+**/uniform cbTest3{int c;};//Single line comment
+uniform cbTest4{int d;};
+
+uniform cbTest5
+{
+    float4 e;
+};
+
+uniform cbTest6
+{
+    float4 f;
+};
+
+
+int cbuffer_fake;
+int fakecbuffer;
+
+int GlobalIntVar;uniform sampler2D Tex2D_Test1/*comment*/;uniform sampler2D Tex2D_Test2;/*Comment* / *//* /** Comment2**/uniform sampler2D Tex2D_Test3;
+
+uniform sampler2D Tex2D_M1;
+uniform sampler2D Tex2D_M2;
+
+// Test texture declaration
+
+#ifndef GL_ES
+
+uniform sampler1D Tex1D_F1;
+uniform sampler1D Tex1D_F2;
+uniform isampler1D Tex1D_I  /*comment*/;
+uniform usampler1D Tex1D_U;
+
+SamplerState Tex1D_F1_sampler  /*comment*/;
+
+uniform sampler1DArray          Tex1D_F_A1;
+uniform sampler1DArray  Tex1D_F_A2;
+uniform isampler1DArray   Tex1D_I_A;
+uniform usampler1DArray  Tex1D_U_A;
+
+SamplerState Tex1D_F_A1_sampler;
+
+uniform sampler1DShadow Tex1DS1;
+uniform sampler1DShadow Tex1DS2;
+uniform sampler1DShadow Tex1DS3;
+SamplerComparisonState Tex1DS1_sampler,
+Tex1DS2_sampler, TestCmpSamplerArr[2], Tex1DS3_sampler;
+
+uniform sampler1DArrayShadow Tex1DAS1;
+SamplerComparisonState Tex1DAS1_sampler, Tex1DAS2_sampler;
+uniform sampler1DArrayShadow Tex1DAS2;
+
+#endif
+
+uniform sampler2D Tex2D_F1;
+uniform sampler2D Tex2D_F3[2];
+uniform sampler2D Tex2D_F2;
+uniform sampler2DShadow Tex2DS_F4;
+uniform sampler2DShadow Tex2DS_F5;
+uniform sampler2D Tex2D_F6;
+uniform isampler2D Tex2D_I;
+uniform usampler2D Tex2D_U;
+
+SamplerState Tex2D_F1_sampler,Tex2D_F6_sampler;
+SamplerComparisonState DummySampler, Tex2DS_F4_sampler,Tex2DS_F5_sampler;
+
+uniform sampler2DArray          Tex2D_F_A1;
+uniform sampler2DArray  Tex2D_F_A2;
+uniform sampler2DArray Tex2D_F_A3;
+uniform isampler2DArray   Tex2D_I_A;
+uniform usampler2DArray  Tex2D_U_A;
+
+SamplerState Tex2D_F_A1_sampler,Tex2D_F_A3_sampler;
+
+#define SAMPLE_COUNT 4
+
+#if !GLES30
+uniform sampler2DMS              Tex2DMS_F1;
+uniform sampler2DMS            Tex2DMS_F2;
+uniform sampler2DMS Tex2DMS_F3;
+uniform isampler2DMS                 Tex2DMS_I;
+uniform usampler2DMS                Tex2DMS_U;
+#endif
+
+#ifndef GL_ES
+uniform sampler2DMSArray             Tex2DMS_F_A1;
+uniform sampler2DMSArray             Tex2DMS_F_A2;
+uniform sampler2DMSArray  Tex2DMS_F_A3;
+uniform isampler2DMSArray              Tex2DMS_I_A;
+uniform usampler2DMSArray              Tex2DMS_U_A;
+#endif
+
+uniform sampler3D           Tex3D_F1;
+uniform sampler3D Tex3D_F2;
+uniform sampler3D Tex3D_F3;
+uniform isampler3D    Tex3D_I;
+uniform usampler3D  Tex3D_U;
+
+SamplerState Tex3D_F1_sampler;
+
+uniform samplerCube          TexC_F1;
+uniform samplerCube TexC_F2;
+uniform isamplerCube   TexC_I;
+uniform usamplerCube   TexC_U;
+
+SamplerState TexC_F1_sampler;
+
+#ifndef GL_ES
+uniform samplerCubeArray            TexC_F_A1;
+uniform samplerCubeArray   TexC_F_A2;
+uniform isamplerCubeArray   TexC_I_A;
+uniform usamplerCubeArray   TexC_U_A;
+
+SamplerState TexC_F_A1_sampler;
+#endif
+
+uniform sampler2DShadow Tex2DS1;
+SamplerComparisonState Tex2DS1_sampler;
+uniform sampler2DShadow Tex2DS2;
+SamplerComparisonState Tex2DS2_sampler;
+
+uniform sampler2DArrayShadow Tex2DAS1;
+SamplerComparisonState Tex2DAS1_sampler;
+uniform sampler2DArrayShadow Tex2DAS2;
+SamplerComparisonState Tex2DAS2_sampler;
+
+uniform samplerCubeShadow TexCS1;
+SamplerComparisonState TexCS1_sampler;
+uniform samplerCubeShadow TexCS2;
+SamplerComparisonState TexCS2_sampler;
+
+#ifndef GL_ES
+uniform samplerCubeArrayShadow TexCAS1;
+SamplerComparisonState TexCAS1_sampler;
+uniform samplerCubeArrayShadow TexCAS2;
+SamplerComparisonState TexCAS2_sampler;
+#endif
+
+uniform samplerBuffer TexBuffer_F1/*comment*/ /*comment*/;
+uniform samplerBuffer TexBuffer_F4;
+uniform isamplerBuffer TexBuffer_I;
+uniform usamplerBuffer TexBuffer_U;
+
+int intvar1;SamplerState Dummy;int intvar2;
+
+int Texture2D_fake, Texture2DArray_fake, fakeTexture2D, fakeTexture2DArray;
+int Texture2DMS_fake;
+int fakeTexture2DMS;
+int Texture2DMSArray_fake;
+int fakeTexture2DMSArray;
+int Texture3D_fake;
+int fakeTexture3D;
+int TextureCube_fake, TextureCubeArray_fake;
+int fakeTextureCube, fakeTextureCubeArray;
+int SamplerState_fake;
+int SamplerComparisonState_fake;
+int fakeSamplerState;
+int fakeSamplerComparisonState;
+int Texture4D;
+int Texture2d;
+int TextureCub;
+int Texture2DArr;
+int Texture2DM;
+int Texture2DMSArr;
+
+void TestGetDimensions()
+{
+#ifndef GL_ES
+    // Texture1D
+    {
+        uint uWidth, uMipLevels;
+        int iWidth, iMipLevels;
+        float fWidth, fMipLevels;
+        GetTex1DDimensions_1( Tex1D_F1,uWidth);
+        GetTex1DDimensions_3( Tex1D_F1,0, uWidth, uMipLevels);
+        GetTex1DDimensions_1( Tex1D_I,uWidth);
+        GetTex1DDimensions_3( Tex1D_I,0, uWidth, uMipLevels);
+        GetTex1DDimensions_1( Tex1D_U,uWidth);
+        GetTex1DDimensions_3( Tex1D_U,0, uWidth, uMipLevels);
+        GetTex1DDimensions_1( Tex1DS1,uWidth);
+        GetTex1DDimensions_3( Tex1DS1,0, uWidth, uMipLevels);
+
+        GetTex1DDimensions_1( Tex1D_F1,fWidth);
+        GetTex1DDimensions_3( Tex1D_F1,0, fWidth, fMipLevels);
+        GetTex1DDimensions_1( Tex1D_I,fWidth);
+        GetTex1DDimensions_3( Tex1D_I,0, fWidth, fMipLevels);
+        GetTex1DDimensions_1( Tex1D_U,fWidth);
+        GetTex1DDimensions_3( Tex1D_U,0, fWidth, fMipLevels);
+        GetTex1DDimensions_1( Tex1DS1,fWidth);
+        GetTex1DDimensions_3( Tex1DS1,0, fWidth, fMipLevels);
+
+        GetTex1DDimensions_1( Tex1D_F1,iWidth);
+        GetTex1DDimensions_3( Tex1D_F1,0, iWidth, iMipLevels);
+        GetTex1DDimensions_1( Tex1D_I,iWidth);
+        GetTex1DDimensions_3( Tex1D_I,0, iWidth, iMipLevels);
+        GetTex1DDimensions_1( Tex1D_U,iWidth);
+        GetTex1DDimensions_3( Tex1D_U,0, iWidth, iMipLevels);
+        GetTex1DDimensions_1( Tex1DS1,iWidth);
+        GetTex1DDimensions_3( Tex1DS1,0, iWidth, iMipLevels);
+    }
+
+    // Texture1DArray
+    {
+        uint uWidth, uMipLevels, uElems;
+        float fWidth, fMipLevels, fElems;
+        int iWidth, iMipLevels, iElems;
+
+        GetTex1DArrDimensions_4( Tex1D_F_A1,0, uWidth, uElems, uMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_F_A1,uWidth, uElems);
+        GetTex1DArrDimensions_4( Tex1D_U_A,0, uWidth, uElems, uMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_U_A,uWidth, uElems);
+        GetTex1DArrDimensions_4( Tex1D_I_A,0, uWidth, uElems, uMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_I_A,uWidth, uElems);
+        GetTex1DArrDimensions_4( Tex1DAS1,0, uWidth, uElems, uMipLevels);
+        GetTex1DArrDimensions_2( Tex1DAS1,uWidth, uElems);
+
+        GetTex1DArrDimensions_4( Tex1D_F_A1,0, iWidth, iElems, iMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_F_A1,iWidth, iElems);
+        GetTex1DArrDimensions_4( Tex1D_U_A,0, iWidth, iElems, iMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_U_A,iWidth, iElems);
+        GetTex1DArrDimensions_4( Tex1D_I_A,0, iWidth, iElems, iMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_I_A,iWidth, iElems);
+        GetTex1DArrDimensions_4( Tex1DAS1,0, iWidth, iElems, iMipLevels);
+        GetTex1DArrDimensions_2( Tex1DAS1,iWidth, iElems);
+
+        GetTex1DArrDimensions_4( Tex1D_F_A1,0, fWidth, fElems, fMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_F_A1,fWidth, fElems);
+        GetTex1DArrDimensions_4( Tex1D_U_A,0, fWidth, fElems, fMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_U_A,fWidth, fElems);
+        GetTex1DArrDimensions_4( Tex1D_I_A,0, fWidth, fElems, fMipLevels);
+        GetTex1DArrDimensions_2( Tex1D_I_A,fWidth, fElems);
+        GetTex1DArrDimensions_4( Tex1DAS1,0, fWidth, fElems, fMipLevels);
+        GetTex1DArrDimensions_2( Tex1DAS1,fWidth, fElems);
+    }
+#endif
+
+    //Texture2D
+    {
+        uint uWidth, uHeight, uMipLevels;
+        int iWidth, iHeight, iMipLevels;
+        float fWidth, fHeight, fMipLevels;
+
+        GetTex2DDimensions_2( Tex2D_F1,uWidth, uHeight);
+        GetTex2DDimensions_4( Tex2D_F1,0, uWidth, uHeight, uMipLevels);
+        GetTex2DDimensions_4( Tex2D_F3[0], 0, uWidth, uHeight, uMipLevels );
+        GetTex2DDimensions_2( Tex2D_I,uWidth, uHeight);
+        GetTex2DDimensions_4( Tex2D_I,0, uWidth, uHeight, uMipLevels);
+        GetTex2DDimensions_2( Tex2D_U,uWidth, uHeight);
+        GetTex2DDimensions_4( Tex2D_U,0, uWidth, uHeight, uMipLevels);
+        GetTex2DDimensions_2( Tex2DS1,uWidth, uHeight);
+        GetTex2DDimensions_4( Tex2DS1,0, uWidth, uHeight, uMipLevels);
+
+        GetTex2DDimensions_2( Tex2D_F1,iWidth, iHeight);
+        GetTex2DDimensions_4( Tex2D_F1,0, iWidth, iHeight, iMipLevels);
+        GetTex2DDimensions_4( Tex2D_F3[0], 0, iWidth, iHeight, iMipLevels );
+        GetTex2DDimensions_2( Tex2D_I,iWidth, iHeight);
+        GetTex2DDimensions_4( Tex2D_I,0, iWidth, iHeight, iMipLevels);
+        GetTex2DDimensions_2( Tex2D_U,iWidth, iHeight);
+        GetTex2DDimensions_4( Tex2D_U,0, iWidth, iHeight, iMipLevels);
+        GetTex2DDimensions_2( Tex2DS1,iWidth, iHeight);
+        GetTex2DDimensions_4( Tex2DS1,0, iWidth, iHeight, iMipLevels);
+
+
+        GetTex2DDimensions_2( Tex2D_F1,fWidth, fHeight);
+        GetTex2DDimensions_4( Tex2D_F1,0, fWidth, fHeight, fMipLevels);
+        GetTex2DDimensions_4( Tex2D_F3[0], 0, fWidth, fHeight, fMipLevels );
+        GetTex2DDimensions_2( Tex2D_I,fWidth, fHeight);
+        GetTex2DDimensions_4( Tex2D_I,0, fWidth, fHeight, fMipLevels);
+        GetTex2DDimensions_2( Tex2D_U,fWidth, fHeight);
+        GetTex2DDimensions_4( Tex2D_U,0, fWidth, fHeight, fMipLevels);
+        GetTex2DDimensions_2( Tex2DS1,fWidth, fHeight);
+        GetTex2DDimensions_4( Tex2DS1,0, fWidth, fHeight, fMipLevels);
+    }
+
+    //Texture2DArray
+    {
+        uint uWidth, uHeight, uMipLevels, uElems;
+        int iWidth, iHeight, iMipLevels, iElems;
+        float fWidth, fHeight, fMipLevels, fElems;
+
+        GetTex2DArrDimensions_5( Tex2D_F_A1,0, uWidth, uHeight, uElems, uMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_F_A1,uWidth, uHeight, uElems);
+        GetTex2DArrDimensions_5( Tex2D_U_A,0, uWidth, uHeight, uElems, uMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_U_A,uWidth, uHeight, uElems);
+        GetTex2DArrDimensions_5( Tex2D_I_A,0, uWidth, uHeight, uElems, uMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_I_A,uWidth, uHeight, uElems);
+        GetTex2DArrDimensions_5( Tex2DAS1,0, uWidth, uHeight, uElems, uMipLevels);
+        GetTex2DArrDimensions_3( Tex2DAS1,uWidth, uHeight, uElems);
+
+        GetTex2DArrDimensions_5( Tex2D_F_A1,0, iWidth, iHeight, iElems, iMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_F_A1,iWidth, iHeight, iElems);
+        GetTex2DArrDimensions_5( Tex2D_U_A,0, iWidth, iHeight, iElems, iMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_U_A,iWidth, iHeight, iElems);
+        GetTex2DArrDimensions_5( Tex2D_I_A,0, iWidth, iHeight, iElems, iMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_I_A,iWidth, iHeight, iElems);
+        GetTex2DArrDimensions_5( Tex2DAS1,0, iWidth, iHeight, iElems, iMipLevels);
+        GetTex2DArrDimensions_3( Tex2DAS1,iWidth, iHeight, iElems);
+
+        GetTex2DArrDimensions_5( Tex2D_F_A1,0, fWidth, fHeight, fElems, fMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_F_A1,fWidth, fHeight, fElems);
+        GetTex2DArrDimensions_5( Tex2D_U_A,0, fWidth, fHeight, fElems, fMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_U_A,fWidth, fHeight, fElems);
+        GetTex2DArrDimensions_5( Tex2D_I_A,0, fWidth, fHeight, fElems, fMipLevels);
+        GetTex2DArrDimensions_3( Tex2D_I_A,fWidth, fHeight, fElems);
+        GetTex2DArrDimensions_5( Tex2DAS1,0, fWidth, fHeight, fElems, fMipLevels);
+        GetTex2DArrDimensions_3( Tex2DAS1,fWidth, fHeight, fElems);
+    }
+
+    //Texture3D
+    {
+        uint uWidth, uHeight, uDepth, uMipLevels;
+        int iWidth, iHeight, iDepth, iMipLevels;
+        float fWidth, fHeight, fDepth, fMipLevels;
+        GetTex3DDimensions_5( Tex3D_F1,0, uWidth, uHeight, uDepth, uMipLevels);
+        GetTex3DDimensions_3( Tex3D_F1,uWidth, uHeight, uDepth);
+        GetTex3DDimensions_5( Tex3D_U,0, uWidth, uHeight, uDepth, uMipLevels);
+        GetTex3DDimensions_3( Tex3D_U,uWidth, uHeight, uDepth);
+        GetTex3DDimensions_5( Tex3D_I,0, uWidth, uHeight, uDepth, uMipLevels);
+        GetTex3DDimensions_3( Tex3D_I,uWidth, uHeight, uDepth);
+
+        GetTex3DDimensions_5( Tex3D_F1,0, iWidth, iHeight, iDepth, iMipLevels);
+        GetTex3DDimensions_3( Tex3D_F1,iWidth, iHeight, iDepth);
+        GetTex3DDimensions_5( Tex3D_U,0, iWidth, iHeight, iDepth, iMipLevels);
+        GetTex3DDimensions_3( Tex3D_U,iWidth, iHeight, iDepth);
+        GetTex3DDimensions_5( Tex3D_I,0, iWidth, iHeight, iDepth, iMipLevels);
+        GetTex3DDimensions_3( Tex3D_I,iWidth, iHeight, iDepth);
+
+        GetTex3DDimensions_5( Tex3D_F1,0, fWidth, fHeight, fDepth, fMipLevels);
+        GetTex3DDimensions_3( Tex3D_F1,fWidth, fHeight, fDepth);
+        GetTex3DDimensions_5( Tex3D_U,0, fWidth, fHeight, fDepth, fMipLevels);
+        GetTex3DDimensions_3( Tex3D_U,fWidth, fHeight, fDepth);
+        GetTex3DDimensions_5( Tex3D_I,0, fWidth, fHeight, fDepth, fMipLevels);
+        GetTex3DDimensions_3( Tex3D_I,fWidth, fHeight, fDepth);
+    }
+
+    //TextureCube ~ Texture2D
+    {
+        uint uWidth, uHeight, uMipLevels;
+        int iWidth, iHeight, iMipLevels;
+        float fWidth, fHeight, fMipLevels;
+
+        GetTex2DDimensions_4( TexC_F1,0, uWidth, uHeight, uMipLevels);
+        GetTex2DDimensions_2( TexC_F1,uWidth, uHeight);
+        GetTex2DDimensions_4( TexC_I,0, uWidth, uHeight, uMipLevels);
+        GetTex2DDimensions_2( TexC_I,uWidth, uHeight);
+        GetTex2DDimensions_4( TexC_U,0, uWidth, uHeight, uMipLevels);
+        GetTex2DDimensions_2( TexC_U,uWidth, uHeight);
+        GetTex2DDimensions_4( TexCS1,0, uWidth, uHeight, uMipLevels);
+        GetTex2DDimensions_2( TexCS1,uWidth, uHeight);
+
+        GetTex2DDimensions_4( TexC_F1,0, iWidth, iHeight, iMipLevels);
+        GetTex2DDimensions_2( TexC_F1,iWidth, iHeight);
+        GetTex2DDimensions_4( TexC_I,0, iWidth, iHeight, iMipLevels);
+        GetTex2DDimensions_2( TexC_I,iWidth, iHeight);
+        GetTex2DDimensions_4( TexC_U,0, iWidth, iHeight, iMipLevels);
+        GetTex2DDimensions_2( TexC_U,iWidth, iHeight);
+        GetTex2DDimensions_4( TexCS1,0, iWidth, iHeight, iMipLevels);
+        GetTex2DDimensions_2( TexCS1,iWidth, iHeight);
+
+        GetTex2DDimensions_4( TexC_F1,0, fWidth, fHeight, fMipLevels);
+        GetTex2DDimensions_2( TexC_F1,fWidth, fHeight);
+        GetTex2DDimensions_4( TexC_I,0, fWidth, fHeight, fMipLevels);
+        GetTex2DDimensions_2( TexC_I,fWidth, fHeight);
+        GetTex2DDimensions_4( TexC_U,0, fWidth, fHeight, fMipLevels);
+        GetTex2DDimensions_2( TexC_U,fWidth, fHeight);
+        GetTex2DDimensions_4( TexCS1,0, fWidth, fHeight, fMipLevels);
+        GetTex2DDimensions_2( TexCS1,fWidth, fHeight);
+    }
+
+#ifndef GL_ES
+    //TextureCubeArray ~ Texture2DArray
+    {
+        uint uWidth, uHeight, uMipLevels, uElems;
+        float fWidth, fHeight, fMipLevels, fElems;
+        int iWidth, iHeight, iMipLevels, iElems;
+
+        GetTex2DArrDimensions_5( TexC_F_A1,0, uWidth, uHeight, uElems, uMipLevels);
+        GetTex2DArrDimensions_3( TexC_F_A1,uWidth, uHeight, uElems);
+        GetTex2DArrDimensions_5( TexC_I_A,0, uWidth, uHeight, uElems, uMipLevels);
+        GetTex2DArrDimensions_3( TexC_I_A,uWidth, uHeight, uElems);
+        GetTex2DArrDimensions_5( TexC_U_A,0, uWidth, uHeight, uElems, uMipLevels);
+        GetTex2DArrDimensions_3( TexC_U_A,uWidth, uHeight, uElems);
+        GetTex2DArrDimensions_5( TexCAS1,0, uWidth, uHeight, uElems, uMipLevels);
+        GetTex2DArrDimensions_3( TexCAS1,uWidth, uHeight, uElems);
+
+        GetTex2DArrDimensions_5( TexC_F_A1,0, iWidth, iHeight, iElems, iMipLevels);
+        GetTex2DArrDimensions_3( TexC_F_A1,iWidth, iHeight, iElems);
+        GetTex2DArrDimensions_5( TexC_I_A,0, iWidth, iHeight, iElems, iMipLevels);
+        GetTex2DArrDimensions_3( TexC_I_A,iWidth, iHeight, iElems);
+        GetTex2DArrDimensions_5( TexC_U_A,0, iWidth, iHeight, iElems, iMipLevels);
+        GetTex2DArrDimensions_3( TexC_U_A,iWidth, iHeight, iElems);
+        GetTex2DArrDimensions_5( TexCAS1,0, iWidth, iHeight, iElems, iMipLevels);
+        GetTex2DArrDimensions_3( TexCAS1,iWidth, iHeight, iElems);
+
+        GetTex2DArrDimensions_5( TexC_F_A1,0, fWidth, fHeight, fElems, fMipLevels);
+        GetTex2DArrDimensions_3( TexC_F_A1,fWidth, fHeight, fElems);
+        GetTex2DArrDimensions_5( TexC_I_A,0, fWidth, fHeight, fElems, fMipLevels);
+        GetTex2DArrDimensions_3( TexC_I_A,fWidth, fHeight, fElems);
+        GetTex2DArrDimensions_5( TexC_U_A,0, fWidth, fHeight, fElems, fMipLevels);
+        GetTex2DArrDimensions_3( TexC_U_A,fWidth, fHeight, fElems);
+        GetTex2DArrDimensions_5( TexCAS1,0, fWidth, fHeight, fElems, fMipLevels);
+        GetTex2DArrDimensions_3( TexCAS1,fWidth, fHeight, fElems);
+    }
+#endif
+
+
+#ifndef GL_ES // This should work on ES3.1, but compiler fails for no reason
+    // Texture2DMS
+    {
+        uint uWidth, uHeight, uNumSamples;
+        float fWidth, fHeight, fNumSamples;
+        int iWidth, iHeight, iNumSamples;
+        GetTex2DMSDimensions_3( Tex2DMS_F1,uWidth, uHeight, uNumSamples);
+        GetTex2DMSDimensions_3( Tex2DMS_I,uWidth, uHeight, uNumSamples);
+        GetTex2DMSDimensions_3( Tex2DMS_U,uWidth, uHeight, uNumSamples);
+
+        GetTex2DMSDimensions_3( Tex2DMS_F1,fWidth, fHeight, fNumSamples);
+        GetTex2DMSDimensions_3( Tex2DMS_I,fWidth, fHeight, fNumSamples);
+        GetTex2DMSDimensions_3( Tex2DMS_U,fWidth, fHeight, fNumSamples);
+
+        GetTex2DMSDimensions_3( Tex2DMS_F1,iWidth, iHeight, iNumSamples);
+        GetTex2DMSDimensions_3( Tex2DMS_I,iWidth, iHeight, iNumSamples);
+        GetTex2DMSDimensions_3( Tex2DMS_U,iWidth, iHeight, iNumSamples);
+    }
+#endif
+
+#ifndef GL_ES
+    // Texture2DMSArray
+    {
+        uint uWidth, uHeight, uElems, uNumSamples;
+        int iWidth, iHeight, iElems, iNumSamples;
+        float fWidth, fHeight, fElems, fNumSamples;
+        GetTex2DMSArrDimensions_4( Tex2DMS_F_A1,uWidth, uHeight, uElems, uNumSamples);
+        GetTex2DMSArrDimensions_4( Tex2DMS_I_A,uWidth, uHeight, uElems, uNumSamples);
+        // OpenGL4.2 only supports 32 texture units and this one is 33rd:
+        // Tex2DMS_U_A.GetDimensions(Width, Height, Elems, NumSamples);
+
+        GetTex2DMSArrDimensions_4( Tex2DMS_F_A1,fWidth, fHeight, fElems, fNumSamples);
+        GetTex2DMSArrDimensions_4( Tex2DMS_I_A,fWidth, fHeight, fElems, fNumSamples);
+
+        GetTex2DMSArrDimensions_4( Tex2DMS_F_A1,iWidth, iHeight, iElems, iNumSamples);
+        GetTex2DMSArrDimensions_4( Tex2DMS_I_A,iWidth, iHeight, iElems, iNumSamples);
+    }
+#endif
+
+    // Buffer
+    {
+        uint uWidth;
+        //int iWidth;
+        //float fWidth;
+        GetTexBufferDimensions_1( TexBuffer_F1,uWidth);
+        //TexBuffer_F4.GetDimensions(iWidth);
+        //TexBuffer_I.GetDimensions(fWidth);
+    }
+}
+
+
+
+void TestSample()
+{
+    float2 f2UV = float2(0.2, 0.3);
+    float3 f3UVW = float3(0.2, 0.3, 0.5);
+    const int3 Offset = int3(3, 6, 2);
+    float4 f4UVWQ = float4(0.2, 0.3, 0.5, 10.0);
+
+#ifndef GL_ES
+    // Texture1D
+    Sample_2( Tex1D_F1,Tex1D_F1_sampler, f3UVW.x)_SWIZZLE0;
+    Sample_3( Tex1D_F1,Tex1D_F1_sampler, f3UVW.x, Offset.x)_SWIZZLE0;
+
+    // Texture1DArray
+    Sample_2( Tex1D_F_A1,Tex1D_F_A1_sampler, f3UVW.xy)_SWIZZLE0;
+    Sample_3( Tex1D_F_A1,Tex1D_F_A1_sampler, f3UVW.xy, Offset.x)_SWIZZLE0;
+#endif
+
+    //Texture2D
+    Sample_2( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy )_SWIZZLE0.xyzw.xyzw;
+    Sample_3( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, Offset.xy )_SWIZZLE0;
+    Sample_2( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, 0.3) )_SWIZZLE0;
+    Sample_3( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, (0.3+0.1) ), int2( (3-1) ,5) )_SWIZZLE0;
+
+    //Texture2DArray
+    Sample_2( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xyz )_SWIZZLE0;
+    Sample_3( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xyz, Offset.xy )_SWIZZLE0;
+
+    //Texture3D
+    Sample_2( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz )_SWIZZLE0;
+    Sample_3( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz, Offset.xyz )_SWIZZLE0;
+
+    //TextureCube
+    Sample_2( TexC_F1,TexC_F1_sampler, f3UVW.xyz )_SWIZZLE0;
+    // Offset not supported
+
+#ifndef GL_ES
+    // TextureCubeArray
+    Sample_2( TexC_F_A1, TexC_F_A1_sampler, f4UVWQ.xyzw )_SWIZZLE0;
+    Sample_2( TexC_F_A1, TexC_F_A1_sampler, float4(0.5, (0.2+(0.01+0.02)), 0.4, 7.0) )_SWIZZLE0;
+    // Offset not supported
+#endif
+}
+
+
+
+void TestSampleBias()
+{
+    float2 f2UV = float2(0.2, 0.3);
+    float3 f3UVW = float3(0.2, 0.3, 0.5);
+    const int3 Offset = int3(3, 6, 2);
+    float4 f4UVWQ = float4(0.2, 0.3, 0.5, 10.0);
+
+#ifndef GL_ES
+    // Texture1D
+    SampleBias_3( Tex1D_F1,Tex1D_F1_sampler, f3UVW.x, 1.5)_SWIZZLE0;
+    SampleBias_4( Tex1D_F1,Tex1D_F1_sampler, f3UVW.x, 1.5, Offset.x)_SWIZZLE0;
+
+    // Texture1DArray
+    SampleBias_3( Tex1D_F_A1,Tex1D_F_A1_sampler, f3UVW.xy, 1.5)_SWIZZLE0;
+    SampleBias_4( Tex1D_F_A1,Tex1D_F_A1_sampler, f3UVW.xy, 1.5, Offset.x)_SWIZZLE0;
+#endif
+
+    //Texture2D
+    SampleBias_3( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, 1.5 )_SWIZZLE0;
+    SampleBias_4( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, 1.5, Offset.xy )_SWIZZLE0;
+    SampleBias_3( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, 0.3), 1.5 )_SWIZZLE0;
+    SampleBias_4( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, (0.3+0.1) ), 1.5, int2( (3-1) ,5) )_SWIZZLE0;
+
+    //Texture2DArray
+    SampleBias_3( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xyz, 1.5 )_SWIZZLE0;
+    SampleBias_4( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xyz, 1.5, Offset.xy )_SWIZZLE0;
+
+    //Texture3D
+    SampleBias_3( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz, 1.5 )_SWIZZLE0;
+    SampleBias_4( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz, 1.5, Offset.xyz )_SWIZZLE0;
+
+    //TextureCube
+    SampleBias_3( TexC_F1,TexC_F1_sampler, f3UVW.xyz, 1.5 )_SWIZZLE0;
+    // Offset not supported
+
+#ifndef GL_ES
+    // TextureCubeArray
+    SampleBias_3( TexC_F_A1, TexC_F_A1_sampler, f4UVWQ.xyzw, 1.5 )_SWIZZLE0;
+    SampleBias_3( TexC_F_A1, TexC_F_A1_sampler, float4(0.5, (0.2+(0.01+0.02)), 0.4, 7.0), 1.6 )_SWIZZLE0;
+    // Offset not supported
+#endif
+}
+
+void TestSampleLevel()
+{
+    float2 f2UV = float2(0.2, 0.3);
+    float3 f3UVW = float3(0.2, 0.3, 0.5);
+    float Level = 1.8;
+    const int3 Offset = int3(3, 6, 2);
+    float4 f4UVWQ = float4(0.2, 0.3, 0.5, 10.0);
+
+#ifndef GL_ES
+    // Texture1D
+    SampleLevel_3( Tex1D_F1,Tex1D_F1_sampler, f3UVW.x, Level)_SWIZZLE0;
+    SampleLevel_4( Tex1D_F1,Tex1D_F1_sampler, f3UVW.x, Level, Offset.x)_SWIZZLE0;
+
+    // Texture1DArray
+    SampleLevel_3( Tex1D_F_A1,Tex1D_F_A1_sampler, f3UVW.xy, Level)_SWIZZLE0;
+    SampleLevel_4( Tex1D_F_A1,Tex1D_F_A1_sampler, f3UVW.xy, Level, Offset.x)_SWIZZLE0;
+#endif
+
+    //Texture2D
+    SampleLevel_3( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, Level )_SWIZZLE0;
+    SampleLevel_3( Tex2D_F1, Tex2D_F1_sampler, SampleLevel_3( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, Level )_SWIZZLE0.xy + SampleLevel_3( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, Level )_SWIZZLE0.xy, Level )_SWIZZLE0;
+    SampleLevel_4( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, Level, Offset.xy )_SWIZZLE0;
+    SampleLevel_3( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, 0.3), 4.0 )_SWIZZLE0;
+    SampleLevel_4( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, (0.3+0.1) ), 4.0, int2( (3-1) ,5) )_SWIZZLE0;
+
+    //Texture2DArray
+    SampleLevel_3( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xyz, Level )_SWIZZLE0;
+    SampleLevel_4( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xyz, Level, Offset.xy )_SWIZZLE0;
+
+    //Texture3D
+    SampleLevel_3( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz, Level )_SWIZZLE0;
+    SampleLevel_4( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz, Level, Offset.xyz )_SWIZZLE0;
+
+    //TextureCube
+    SampleLevel_3( TexC_F1,TexC_F1_sampler, f3UVW.xyz, Level )_SWIZZLE0;
+    // Offset not supported
+
+#ifndef GL_ES
+    // TextureCubeArray
+    SampleLevel_3( TexC_F_A1, TexC_F_A1_sampler, f4UVWQ.xyzw, Level )_SWIZZLE0;
+    SampleLevel_3( TexC_F_A1, TexC_F_A1_sampler, float4(0.5, (0.2+(0.01+0.02)), 0.4, 7.0), 5 )_SWIZZLE0;
+    // Offset not supported
+#endif
+}
+
+
+void TestSampleGrad()
+{
+    float2 f2UV = float2(0.2, 0.3);
+    float2 f2ddxUV = float2(0.01, -0.02);
+    float2 f2ddyUV = float2(-0.01, 0.01);
+    float3 f3UVW = float3(0.2, 0.3, 0.5);
+    float3 f3ddxUVW = float3(-0.02, 0.03, 0.05);
+    float3 f3ddyUVW = float3( 0.01, -0.02, 0.02);
+    const int3 Offset = int3(3, 6, 2);
+    float4 f4UVWQ = float4(0.2, 0.3, 0.5, 10.0);
+
+#ifndef GL_ES
+    // Texture1D
+    SampleGrad_4( Tex1D_F1,Tex1D_F1_sampler, f3UVW.x, f2ddxUV.x, f2ddyUV.x)_SWIZZLE0;
+    SampleGrad_5( Tex1D_F1,Tex1D_F1_sampler, f3UVW.x, f2ddxUV.x, f2ddyUV.x, Offset.x)_SWIZZLE0;
+
+    // Texture1DArray
+    SampleGrad_4( Tex1D_F_A1,Tex1D_F_A1_sampler, f3UVW.xy, f2ddxUV.x, f2ddyUV.x)_SWIZZLE0;
+    SampleGrad_5( Tex1D_F_A1,Tex1D_F_A1_sampler, f3UVW.xy, f2ddxUV.x, f2ddyUV.x, Offset.x)_SWIZZLE0;
+#endif
+
+    //Texture2D
+    SampleGrad_4( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, f2ddxUV.xy, f2ddyUV.xy )_SWIZZLE0;
+    SampleGrad_5( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, f2ddxUV.xy, f2ddyUV.xy, Offset.xy )_SWIZZLE0;
+    SampleGrad_4( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, 0.3), float2(0.01, 0.02), float2(-0.02, 0.01) )_SWIZZLE0;
+    SampleGrad_5( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, (0.3+0.1) ), float2(0.01, 0.02), float2(-0.02, 0.01), int2( (3-1) ,5) )_SWIZZLE0;
+
+    //Texture2DArray
+    SampleGrad_4( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xyz, f2ddxUV.xy, f2ddyUV.xy )_SWIZZLE0;
+    SampleGrad_5( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xyz, f2ddxUV.xy, f2ddyUV.xy, Offset.xy )_SWIZZLE0;
+
+    //Texture3D
+    SampleGrad_4( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz, f3ddxUVW.xyz, f3ddyUVW.xyz )_SWIZZLE0;
+    SampleGrad_5( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz, f3ddxUVW.xyz, f3ddyUVW.xyz, Offset.xyz )_SWIZZLE0;
+
+    //TextureCube
+    SampleGrad_4( TexC_F1,TexC_F1_sampler, f3UVW.xyz, f3ddxUVW.xyz, f3ddyUVW.xyz )_SWIZZLE0;
+    // Offset not supported
+
+#ifndef GL_ES
+    // TextureCubeArray
+    SampleGrad_4( TexC_F_A1, TexC_F_A1_sampler, f4UVWQ.xyzw, f3ddxUVW.xyz, f3ddyUVW.xyz )_SWIZZLE0;
+    SampleGrad_4( TexC_F_A1, TexC_F_A1_sampler, float4(0.5, (0.2+(0.01+0.02)), 0.4, 7.0), float3(0.01,0.02,0.03), float3(-0.01,-0.02,-0.03) )_SWIZZLE0;
+    // Offset not supported
+#endif
+}
+
+
+
+void TestSampleCmp()
+{
+    float3 f3UVW = float3(0.2, 0.3, 0.5);
+    const int3 Offset = int3(3, 6, 2);
+    float4 f4UVWQ = float4(0.2, 0.3, 0.5, 10.0);
+    float CompareVal = 0.7;
+
+#ifndef GL_ES
+    // Texture1D
+    SampleCmpTex1D_3( Tex1DS1,Tex1DS1_sampler, f3UVW.x, CompareVal);
+    SampleCmpTex1D_4( Tex1DS1,Tex1DS1_sampler, f3UVW.x, CompareVal, Offset.x);
+
+    // Texture1DArray
+    SampleCmpTex1DArr_3( Tex1DAS1,Tex1DAS1_sampler, f3UVW.xy, CompareVal);
+    SampleCmpTex1DArr_4( Tex1DAS1,Tex1DAS1_sampler, f3UVW.xy, CompareVal, Offset.x);
+#endif
+
+    //Texture2D
+    SampleCmpTex2D_3( Tex2DS1, Tex2DS1_sampler, f3UVW.xy, CompareVal );
+    SampleCmpTex2D_4( Tex2DS1, Tex2DS1_sampler, f3UVW.xy, CompareVal, Offset.xy );
+    SampleCmpTex2D_3( Tex2DS1, Tex2DS1_sampler, float2(0.1, 0.3), 4.0 );
+    SampleCmpTex2D_4( Tex2DS1, Tex2DS1_sampler, float2(0.1, (0.3+0.1) ), 4.0, int2( (3-1) ,5) );
+    SampleCmpTex2D_3( Tex2DS_F5, Tex2DS_F5_sampler, f3UVW.xy, CompareVal );
+
+    //Texture2DArray
+    SampleCmpTex2DArr_3( Tex2DAS1, Tex2DAS1_sampler, f3UVW.xyz, CompareVal );
+    // This seems to be another bug on Intel driver: the following line does not compile:
+    // Tex2DAS1.SampleCmp( Tex2DAS1_sampler, f3UVW.xyz, CompareVal, Offset.xy );
+
+    //TextureCube
+    SampleCmpTexCube_3( TexCS1,TexCS1_sampler, f3UVW.xyz, CompareVal );
+    // Offset not supported
+
+#ifndef GL_ES
+    // TextureCubeArray
+    SampleCmpTexCubeArr_3( TexCAS1, TexCAS1_sampler, f4UVWQ.xyzw, CompareVal );
+    SampleCmpTexCubeArr_3( TexCAS1, TexCAS1_sampler, float4(0.5, (0.2+(0.01+0.02)), 0.4, 7.0), 0.5 );
+    // Offset not supported
+#endif
+}
+
+
+
+void TestSampleCmpLevelZero()
+{
+    float3 f3UVW = float3(0.2, 0.3, 0.5);
+    const int3 Offset = int3(3, 6, 2);
+    float4 f4UVWQ = float4(0.2, 0.3, 0.5, 10.0);
+    float CompareVal = 0.7;
+
+#ifndef GL_ES
+    // Texture1D
+    SampleCmpLevel0Tex1D_3( Tex1DS1,Tex1DS1_sampler, f3UVW.x, CompareVal);
+    SampleCmpLevel0Tex1D_4( Tex1DS1,Tex1DS1_sampler, f3UVW.x, CompareVal, Offset.x);
+
+    // Texture1DArray
+    SampleCmpLevel0Tex1DArr_3( Tex1DAS1,Tex1DAS1_sampler, f3UVW.xy, CompareVal);
+    SampleCmpLevel0Tex1DArr_4( Tex1DAS1,Tex1DAS1_sampler, f3UVW.xy, CompareVal, Offset.x);
+#endif
+
+    //Texture2D
+    SampleCmpLevel0Tex2D_3( Tex2DS1, Tex2DS1_sampler, f3UVW.xy, CompareVal );
+    SampleCmpLevel0Tex2D_4( Tex2DS1, Tex2DS1_sampler, f3UVW.xy, CompareVal, Offset.xy );
+    SampleCmpLevel0Tex2D_3( Tex2DS1, Tex2DS1_sampler, float2(0.1, 0.3), 4.0 );
+    SampleCmpLevel0Tex2D_4( Tex2DS1, Tex2DS1_sampler, float2(0.1, (0.3+0.1) ), 4.0, int2( (3-1) ,5) );
+
+    //Texture2DArray
+    SampleCmpLevel0Tex2DArr_3( Tex2DAS1, Tex2DAS1_sampler, f3UVW.xyz, CompareVal );
+    // This seems to be another bug on Intel driver: the following line does not compile:
+    // Tex2DAS1.SampleCmpLevelZero( Tex2DAS1_sampler, f3UVW.xyz, CompareVal, Offset.xy );
+
+    //TextureCube
+    SampleCmpLevel0TexCube_3( TexCS1,TexCS1_sampler, f3UVW.xyz, CompareVal );
+    // Offset not supported
+
+#ifndef GL_ES
+    // TextureCubeArray
+    SampleCmpLevel0TexCubeArr_3( TexCAS1, TexCAS1_sampler, f4UVWQ.xyzw, CompareVal );
+    SampleCmpLevel0TexCubeArr_3( TexCAS1, TexCAS1_sampler, float4(0.5, (0.2+(0.01+0.02)), 0.4, 7.0), 0.5 );
+    // Offset not supported
+#endif
+
+#define SAMPLE_SHADOW_MAP(POS) SampleCmpLevel0TexCubeArr_3( TexCAS1, TexCAS1_sampler, POS.xyzw, CompareVal )
+    SAMPLE_SHADOW_MAP(f4UVWQ);
+#undef SAMPLE_SHADOW_MAP
+}
+
+
+
+void TestLoad()
+{
+    int4 Location = int4(2, 5, 1, 10);
+    const int3 Offset = int3(5, 7, -6);
+
+#ifndef GL_ES
+    // Texture1D
+    {
+        LoadTex1D_1( Tex1D_F1,Location.xy)_SWIZZLE0;
+        LoadTex1D_2( Tex1D_F1,Location.xy, Offset.x)_SWIZZLE0;
+        LoadTex1D_1( Tex1D_I,Location.xy)_SWIZZLE2;
+        LoadTex1D_2( Tex1D_I,Location.xy, Offset.x)_SWIZZLE2;
+        LoadTex1D_1( Tex1D_U,Location.xy)_SWIZZLE4;
+        LoadTex1D_2( Tex1D_U,Location.xy, Offset.x)_SWIZZLE4;
+    }
+
+    // Texture1DArray
+    {
+        LoadTex1DArr_1( Tex1D_F_A1,Location.xyz)_SWIZZLE0;
+        LoadTex1DArr_2( Tex1D_F_A1,Location.xyz, Offset.x)_SWIZZLE0;
+        LoadTex1DArr_1( Tex1D_U_A,Location.xyz)_SWIZZLE4;
+        LoadTex1DArr_2( Tex1D_U_A,Location.xyz, Offset.x)_SWIZZLE4;
+        LoadTex1DArr_1( Tex1D_I_A,Location.xyz)_SWIZZLE2;
+        LoadTex1DArr_2( Tex1D_I_A,Location.xyz, Offset.x)_SWIZZLE2;
+    }
+#endif
+
+    //Texture2D
+    {
+        LoadTex2D_1( Tex2D_F1,Location.xyz)_SWIZZLE0;
+        LoadTex2D_2( Tex2D_F1,Location.xyz, Offset.xy)_SWIZZLE0;
+        LoadTex2D_1( Tex2D_F1,LoadTex2D_1( Tex2D_I,Location.xyz)_SWIZZLE3.xyz + LoadTex2D_1( Tex2D_I,Location.xyz)_SWIZZLE3.xyz)_SWIZZLE0;
+        LoadTex2D_1( Tex2D_I,Location.xyz)_SWIZZLE3;
+        LoadTex2D_2( Tex2D_I,Location.xyz, Offset.xy)_SWIZZLE3;
+        LoadTex2D_1( Tex2D_U,Location.xyz)_SWIZZLE4;
+        LoadTex2D_2( Tex2D_U,Location.xyz, Offset.xy)_SWIZZLE4;
+    }
+
+    //Texture2DArray
+    {
+        LoadTex2DArr_1( Tex2D_F_A1,Location.xyzw)_SWIZZLE0;
+        LoadTex2DArr_2( Tex2D_F_A1,Location.xyzw, Offset.xy)_SWIZZLE0;
+        LoadTex2DArr_1( Tex2D_U_A,Location.xyzw)_SWIZZLE4;
+        LoadTex2DArr_2( Tex2D_U_A,Location.xyzw, Offset.xy)_SWIZZLE4;
+        LoadTex2DArr_1( Tex2D_I_A,Location.xyzw)_SWIZZLE2;
+        LoadTex2DArr_2( Tex2D_I_A,Location.xyzw, Offset.xy)_SWIZZLE2;
+    }
+
+    //Texture3D
+    {
+        LoadTex3D_1( Tex3D_F1,Location.xyzw)_SWIZZLE0;
+        LoadTex3D_2( Tex3D_F1,Location.xyzw, Offset.xyz)_SWIZZLE0;
+        LoadTex3D_1( Tex3D_U,Location.xyzw)_SWIZZLE2;
+        LoadTex3D_2( Tex3D_U,Location.xyzw, Offset.xyz)_SWIZZLE2;
+        LoadTex3D_1( Tex3D_I,Location.xyzw)_SWIZZLE1;
+        LoadTex3D_2( Tex3D_I,Location.xyzw, Offset.xyz)_SWIZZLE1;
+    }
+
+#ifndef GL_ES // This should work on ES3.1, but compiler fails for no reason
+    // Texture2DMS
+    {
+        LoadTex2DMS_2( Tex2DMS_F1,Location.xy, 1)_SWIZZLE2;
+        LoadTex2DMS_3( Tex2DMS_F1,Location.xy, 1, Offset.xy)_SWIZZLE2;
+        LoadTex2DMS_2( Tex2DMS_I,Location.xy, 1)_SWIZZLE1;
+        LoadTex2DMS_3( Tex2DMS_I,Location.xy, 1, Offset.xy)_SWIZZLE1;
+        LoadTex2DMS_2( Tex2DMS_U,Location.xy, 1)_SWIZZLE1;
+        LoadTex2DMS_3( Tex2DMS_U,Location.xy, 1, Offset.xy)_SWIZZLE1;
+    }
+#endif
+
+#ifndef GL_ES
+    // Texture2DMSArray
+    {
+        LoadTex2DMSArr_2( Tex2DMS_F_A1,Location.xyz, 1)_SWIZZLE3;
+        LoadTex2DMSArr_3( Tex2DMS_F_A1,Location.xyz, 1, Offset.xy)_SWIZZLE3;
+        LoadTex2DMSArr_2( Tex2DMS_I_A,Location.xyz, 1)_SWIZZLE2;
+        LoadTex2DMSArr_3( Tex2DMS_I_A,Location.xyz, 1, Offset.xy)_SWIZZLE2;
+        LoadTex2DMSArr_2( Tex2DMS_U_A,Location.xyz, 1)_SWIZZLE4;
+        LoadTex2DMSArr_3( Tex2DMS_U_A,Location.xyz, 1, Offset.xy)_SWIZZLE4;
+    }
+#endif
+
+    // Buffer
+    {
+        LoadTexBuffer_1( TexBuffer_F1,Location.x)_SWIZZLE0;
+        LoadTexBuffer_1( TexBuffer_F4,Location.x)_SWIZZLE4;
+        LoadTexBuffer_1( TexBuffer_I,Location.x)_SWIZZLE3;
+        LoadTexBuffer_1( TexBuffer_U,Location.x)_SWIZZLE4;
+    }
+}
+
+
+
+
+void TestGather()
+{
+#if !GLES30 // no textureGather in GLES3.0
+    float4 Location = float4(0.2, 0.5, 0.1, 0.7);
+    const int3 Offset = int3(5, 10, 20);
+
+    float4 Res = float4(0.0, 0.0, 0.0, 0.0);
+    //Texture2D
+    {
+        Res += Gather_2( Tex2D_F1,Tex2D_F1_sampler, Location.xy);
+        Res += Gather_3( Tex2D_F1,Tex2D_F1_sampler, Location.xy, Offset.xy);
+        Res += GatherRed_2( Tex2D_F1,Tex2D_F1_sampler, Location.xy);
+        Res += GatherRed_3( Tex2D_F1,Tex2D_F1_sampler, Location.xy, Offset.xy);
+        Res += GatherGreen_2( Tex2D_F1,Tex2D_F1_sampler, Location.xy);
+        Res += GatherGreen_3( Tex2D_F1,Tex2D_F1_sampler, Location.xy, Offset.xy);
+        Res += GatherBlue_2( Tex2D_F1,Tex2D_F1_sampler, Location.xy);
+        Res += GatherBlue_3( Tex2D_F1,Tex2D_F1_sampler, Location.xy, Offset.xy);
+        Res += GatherAlpha_2( Tex2D_F1,Tex2D_F1_sampler, Location.xy);
+        Res += GatherAlpha_3( Tex2D_F1,Tex2D_F1_sampler, Location.xy, Offset.xy);
+        //Res += Tex2D_I.Gather(Location.xyz);
+        //Res += Tex2D_I.Gather(Location.xyz, Offset.xy);
+        //Res += Tex2D_U.Gather(Location.xyz);
+        //Res += Tex2D_U.Gather(Location.xyz, Offset.xy);
+    }
+
+    //Texture2DArray
+    {
+        Res += Gather_2( Tex2D_F_A1,Tex2D_F_A1_sampler, Location.xyz);
+        Res += Gather_3( Tex2D_F_A1,Tex2D_F_A1_sampler, Location.xyz, Offset.xy);
+        //Res += Tex2D_U_A.Gather(Location.xyzw);
+        //Res += Tex2D_U_A.Gather(Location.xyzw, Offset.xy);
+        //Res += Tex2D_I_A.Gather(Location.xyzw);
+        //Res += Tex2D_I_A.Gather(Location.xyzw, Offset.xy);
+    }
+
+    // TextureCube
+    {
+        Res += Gather_2( TexC_F1,TexC_F1_sampler, Location.xyz);
+        //Res += TexC_I.Gather(Location.xyz);
+        //Res += TexC_U.Gather(Location.xyz);
+    }
+#ifndef GL_ES
+    // TextureCubeArray
+    {
+        Res += Gather_2( TexC_F_A1,TexC_F_A1_sampler, Location.xyzw);
+        //Res += TexC_I_A.Gather(Location.xyzw);
+        //Res += TexC_U_A.Gather(Location.xyzw);
+    }
+#endif
+
+#endif
+}
+
+
+
+void TestGatherCmp()
+{
+#if !GLES30 // no textureGather in GLES3.0
+    float4 Location = float4(0.2, 0.5, 0.1, 0.7);
+    const int3 Offset = int3(5, 10, 20);
+    float CompareVal = 0.01;
+
+    //Texture2D
+    {
+        GatherCmp_3( Tex2DS1,Tex2DS1_sampler, Location.xy, CompareVal);
+        GatherCmp_4( Tex2DS1,Tex2DS1_sampler, Location.xy, CompareVal, Offset.xy);
+    }
+
+    //Texture2DArray
+    {
+        GatherCmp_3( Tex2DAS1,Tex2DAS1_sampler, Location.xyz, CompareVal);
+        GatherCmp_4( Tex2DAS1,Tex2DAS1_sampler, Location.xyz, CompareVal, Offset.xy);
+    }
+
+    // TextureCube
+    {
+        GatherCmp_3( TexCS1,TexCS1_sampler, Location.xyz, CompareVal);
+    }
+#ifndef GL_ES
+    // TextureCubeArray
+    {
+        GatherCmp_3( TexCAS1,TexCAS1_sampler, Location.xyzw, CompareVal);
+    }
+#endif
+
+#endif
+}
+
+#ifdef FRAGMENT_SHADER
+void TestCalculateLevelOfDetail()
+{
+    float2 f2UV = float2(0.2, 0.3);
+    float3 f3UVW = float3(0.2, 0.3, 0.5);
+    float Level = 1.8;
+    const int3 Offset = int3(3, 6, 2);
+    float4 f4UVWQ = float4(0.2, 0.3, 0.5, 10.0);
+    float LOD;
+
+    //Texture2D
+    LOD = CalculateLevelOfDetail_2( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy );
+    LOD = CalculateLevelOfDetail_2( Tex2D_F6, Tex2D_F6_sampler, SampleLevel_3( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, Level )_SWIZZLE0.xy + SampleLevel_3( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy, Level )_SWIZZLE0.xy );
+    LOD = CalculateLevelOfDetail_2( Tex2D_F1, Tex2D_F1_sampler, f3UVW.xy );
+    LOD = CalculateLevelOfDetail_2( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, 0.3) );
+    LOD = CalculateLevelOfDetail_2( Tex2D_F1, Tex2D_F1_sampler, float2(0.1, (0.3+0.1) ) );
+
+    //Texture2DArray
+    LOD = CalculateLevelOfDetail_2( Tex2D_F_A1, Tex2D_F_A1_sampler, f3UVW.xy );
+    LOD = CalculateLevelOfDetail_2( Tex2D_F_A3, Tex2D_F_A3_sampler, f3UVW.xy );
+
+    //Texture3D
+    LOD = CalculateLevelOfDetail_2( Tex3D_F1,Tex3D_F1_sampler, f3UVW.xyz );
+
+    //TextureCube
+    LOD = CalculateLevelOfDetail_2( TexC_F1,TexC_F1_sampler, f3UVW.xyz );
+
+#ifndef GL_ES
+    // TextureCubeArray
+    LOD = CalculateLevelOfDetail_2( TexC_F_A1, TexC_F_A1_sampler, f4UVWQ.xyz );
+    LOD = CalculateLevelOfDetail_2( TexC_F_A1, TexC_F_A1_sampler, float3(0.5, (0.2+(0.01+0.02)), 0.4) );
+#endif
+}
+#endif
+
+
+struct InnerStruct
+{
+    float f[4];
+    int i;
+    uint u;
+    bool b;
+};
+
+struct OuterStruct
+{
+    InnerStruct inner;
+    float f;
+    int i;
+    uint u;
+    bool b;
+};
+
+struct VSInputSubStruct
+{
+    float3 f3Normal;
+    uint VertexId;
+    uint   uiAttrib;
+};
+
+struct VSInput
+{
+    float3 f3PosWS;
+    float2 f2UV;
+    VSInputSubStruct SubStruct;
+};
+
+struct VSOutputSubStruct
+{          float  fAttrib;
+                    float4 f4Attrib; int    iAttrib;
+};
+struct VSOutput
+{
+                    float  fAttrib;          float2 f2Attrib;        float3 f3Attrib;   float4 f4Attrib; uint   uiAttrib;
+                    uint3  ui3Attrib;
+                    int    iAttrib;
+                    float4 f4PosPS;
+    VSOutputSubStruct SubStruct;
+};
+
+layout(location = 0) in float3 _vsin_In_f3PosWS;
+layout(location = 1) in float2 _vsin_In_f2UV;
+layout(location = 2) in float3 _vsin_In_SubStruct_f3Normal;
+layout(location = 3) in uint _vsin_In_SubStruct_uiAttrib;
+layout(location = 4) in float3 _vsin_f3UV;
+layout(location = 0) out float _vsout_Out_fAttrib;
+layout(location = 1) smooth out float2 _vsout_Out_f2Attrib;
+layout(location = 2) centroid out float3 _vsout_Out_f3Attrib;
+layout(location = 3) noperspective out float4 _vsout_Out_f4Attrib;
+layout(location = 4) flat out uint _vsout_Out_uiAttrib;
+layout(location = 5) flat out uint3 _vsout_Out_ui3Attrib;
+layout(location = 6) flat out int _vsout_Out_iAttrib;
+layout(location = 7) sample out float _vsout_Out_SubStruct_fAttrib;
+layout(location = 8) out float4 _vsout_Out_SubStruct_f4Attrib;
+layout(location = 9) flat out int _vsout_Out_SubStruct_iAttrib;
+layout(location = 10) smooth out float _vsout_fAttrib;
+layout(location = 11) flat out int4 _vsout_i4Attrib;
+
+#define _RETURN_ {\
+_vsout_Out_fAttrib = Out.fAttrib;\
+_vsout_Out_f2Attrib = Out.f2Attrib;\
+_vsout_Out_f3Attrib = Out.f3Attrib;\
+_vsout_Out_f4Attrib = Out.f4Attrib;\
+_vsout_Out_uiAttrib = Out.uiAttrib;\
+_vsout_Out_ui3Attrib = Out.ui3Attrib;\
+_vsout_Out_iAttrib = Out.iAttrib;\
+_SET_GL_POSITION(Out.f4PosPS);\
+_vsout_Out_SubStruct_fAttrib = Out.SubStruct.fAttrib;\
+_vsout_Out_SubStruct_f4Attrib = Out.SubStruct.f4Attrib;\
+_vsout_Out_SubStruct_iAttrib = Out.SubStruct.iAttrib;\
+_vsout_fAttrib = fAttrib;\
+_vsout_i4Attrib = i4Attrib;\
+return;}
+
+void main()
+{
+    VSInput In;
+    In.f3PosWS = _vsin_In_f3PosWS;
+    In.f2UV = _vsin_In_f2UV;
+    In.SubStruct.f3Normal = _vsin_In_SubStruct_f3Normal;
+    _GET_GL_VERTEX_ID(In.SubStruct.VertexId);
+    In.SubStruct.uiAttrib = _vsin_In_SubStruct_uiAttrib;
+    float3 f3UV;
+    f3UV = _vsin_f3UV;
+    uint InstID;
+    _GET_GL_INSTANCE_ID(InstID);
+    VSOutput Out;
+    float fAttrib;
+    int4 i4Attrib;
+
+    Out.f4PosPS = float4(1.0, 2.0, 3.0, 4.0);
+    fAttrib = 1.0;
+    Out.fAttrib  = In.f2UV.x + In.f2UV.y;
+    Out.f2Attrib = float2(5.0, 6.0) + In.f2UV;
+    Out.f3Attrib = float3(7.0, 8.0, 9.0) + In.f3PosWS + f3UV + In.SubStruct.f3Normal;
+    Out.f4Attrib = float4(10.0, 11.0, 12.0, 13.0);
+
+    Out.SubStruct.fAttrib  = In.f3PosWS.z;
+    Out.SubStruct.f4Attrib = float4(10.0, 11.0, 12.0, 13.0);
+    Out.uiAttrib = In.SubStruct.uiAttrib;
+    Out.ui3Attrib = uint3(2u, 3u, 4u);
+    Out.iAttrib   = 5;
+    Out.SubStruct.iAttrib = 20;
+    i4Attrib = int4(5, 6, 7, 8);
+
+    if( In.f2UV.x < 0.5 )
+        _RETURN_
+
+    Out.f4Attrib.z = 0.1;
+    Out.SubStruct.f4Attrib.zw = float2(12.0, 31.0);
+    Out.ui3Attrib.y = 2u;
+    i4Attrib.yzw = int3(15, 16, 17);
+_RETURN_
+}
+
+
+void TestFuncArgs1( sampler2D Arg1,
+                    SamplerState Arg1_sampler,
+                    sampler2DShadow Arg2,
+                    SamplerComparisonState Arg2_sampler,
+                    sampler3D Arg3)
+{
+    uint uWidth, uHeight, uMipLevels;
+    GetTex2DDimensions_2( Arg1,uWidth, uHeight);
+
+    SampleCmpTex2D_3( Arg2, Arg2_sampler, float2(0.5,0.5), 0.1 );
+
+    LoadTex3D_1( Arg3, int4(1, 2, 3, 0) )_SWIZZLE1;
+}
+
+void TestFuncArgs2( isampler3D Arg1,
+                    sampler2DArray Arg2,
+                    SamplerState Arg2_sampler,
+                    sampler2D Arg3)
+{
+    LoadTex3D_1( Arg1, int4(1, 2, 3, 0) )_SWIZZLE1;
+
+    uint uWidth, uHeight, uElems;
+    GetTex2DArrDimensions_3( Arg2,uWidth, uHeight, uElems);
+
+    LoadTex2D_1( Arg3,int3(10,15,3) )_SWIZZLE1;
+}
+
+struct PSOutputSubStruct
+{
+    float4 Color4;
+};
+struct PSOutput
+{
+    float4 Color3;
+    PSOutputSubStruct substr;
+};
+
+void TestPS  ( in VSOutput In,
+               out float4 Color,
+               out float3 Color2,
+               out PSOutput Out)
+{
+    float4 Pos = In.f4PosPS;
+
+    Out.Color3 = float4(0.0 + a, 1.0 + b, 2.0 + c, 3.0 + d);
+    Out.substr.Color4 = float4(0.0, 1.0, 2.0, 3.0);
+
+    TestFuncArgs1( Tex2D_F6,
+                   Tex2D_F6_sampler,
+                   Tex2DS_F5,
+                   Tex2DS_F5_sampler,
+                   Tex3D_F3);
+    TestFuncArgs2( Tex3D_I,
+                   Tex2D_F_A3,
+                   Tex2D_F_A3_sampler,
+                   Tex2D_F2);
+    {
+        float2 a = float2(0.0, 0.0);
+        float2 b = float2(1.0, 1.0);
+        float2 c = float2(2.0, 2.0);
+        a += b;
+        a-=b;
+        a *=c;
+        a/= c;
+        float2 d = a;
+
+        int2 x = int2(1, 2);
+        int2 y = int2(2, 1);
+        x %= y;
+        x &= y;
+        x |= y;
+        x ^= y;
+        x >>= y;
+        x <<= y;
+        x = x | y;
+        x = x & y;
+        x = x % y;
+        x = x ^ y;
+        x = ~y;
+        x = x >> y;
+        x = x << y;
+        x++;
+        ++x;
+        y--;
+        --y;
+        if( x.x>= y.x || y.y >=x.y && x.y == y.x && y.y==x.y && !(x.x==y.y) )
+            x += y;
+
+        if(x.x==y.x)
+            x.x=y.x;
+
+        if(x.x==y.x)
+            x.x+=y.x;
+        {
+            for(int i=0;i<10;++i)
+                x.x+=1;
+        }
+
+        {
+            for(int i=0;i<10;++i)
+                y.x+=1;
+        }
+
+        Color =  In.f4Attrib;
+        Color2 = In.f3Attrib;
+        if( Pos.x < 0.2 ) return;
+    }
+
+    {
+        int  i1 = 1;
+        int2 i2 = int2(1, 2);
+        int3 i3 = int3(1, 2, 3);
+        int4 i4 = int4(1,2,3,4);
+
+        float  f1 = 1.0;
+        float2 f2 = float2(1.0, 2.0);
+        float3 f3 = float3(1.0, 2.0, 3.0);
+        float4 f4 = float4(1.0,2.0,3.0,4.0);
+        float  f1_ = 2.0;
+        float2 f2_ = float2(11.0, 12.0);
+        float3 f3_ = float3(11.0, 12.0, 13.0);
+        float4 f4_ = float4(11.0,12.0,13.0,14.0);
+
+        uint  u1  = 1u;
+        uint2 u2 = uint2(1u, 2u);
+        uint3 u3 = uint3(1u, 2u, 3u);
+        uint4 u4 = uint4(1u, 2u,3u,4u);
+
+        bool  b1 = true;
+        bool2 b2 = bool2(true, false);
+        bool3 b3 = bool3(true, false, true);
+        bool4 b4 = bool4(true, false, true, false);
+
+        i1 = abs ( i1 ); i2 = abs ( i2 ); i3 = abs ( i3 ); i4 = abs ( i4 );
+        f1 = abs ( f1 ); f2 = abs ( f2 ); f3 = abs ( f3 ); f4 = abs ( f4 );
+
+                         b1 = all ( b2 ); b1 = all ( b3 ); b1 = all ( b4 );
+                         b1 = any ( b2 ); b1 = any ( b3 ); b1 = any ( b4 );
+
+        f1 = ceil( f1 ); f2 = ceil( f2 ); f3 = ceil( f3 ); f4 = ceil( f4 );
+
+        f1 = clamp(f1,f1,f1); f2 = clamp(f2,f2,f2); f3 = clamp(f3,f3,f3); f4 = clamp(f4,f4,f4);
+        i1 = clamp(i1,i1,i1); i2 = clamp(i2,i2,i2); i3 = clamp(i3,i3,i3); i4 = clamp(i4,i4,i4);
+        u1 = clamp(u1,u1,u1); u2 = clamp(u2,u2,u2); u3 = clamp(u3,u3,u3); u4 = clamp(u4,u4,u4);
+
+        // Trigonometric functions
+        f1 = cos( f1 ); f2 = cos( f2 ); f3 = cos( f3 ); f4 = cos( f4 );
+        f1 = sin( f1 ); f2 = sin( f2 ); f3 = sin( f3 ); f4 = sin( f4 );
+        f1 = tan( f1 ); f2 = tan( f2 ); f3 = tan( f3 ); f4 = tan( f4 );
+        f1 = cosh( f1 ); f2 = cosh( f2 ); f3 = cosh( f3 ); f4 = cosh( f4 );
+        f1 = sinh( f1 ); f2 = sinh( f2 ); f3 = sinh( f3 ); f4 = sinh( f4 );
+        f1 = tanh( f1 ); f2 = tanh( f2 ); f3 = tanh( f3 ); f4 = tanh( f4 );
+        f1 = acos( f1 ); f2 = acos( f2 ); f3 = acos( f3 ); f4 = acos( f4 );
+        f1 = asin( f1 ); f2 = asin( f2 ); f3 = asin( f3 ); f4 = asin( f4 );
+        f1 = atan( f1 ); f2 = atan( f2 ); f3 = atan( f3 ); f4 = atan( f4 );
+        f1 = atan2(f1,f1); f2 = atan2(f2,f2); f3 = atan2(f3,f3); f4 = atan2(f4,f4);
+        f1 = degrees( f1 ); f2 = degrees( f2 ); f3 = degrees( f3 ); f4 = degrees( f4 );
+        f1 = radians( f1 ); f2 = radians( f2 ); f3 = radians( f3 ); f4 = radians( f4 );
+
+        // Exponential functions
+        f1 = pow( f1, f1 ); f2 = pow( f2,f2 ); f3 = pow( f3,f3 ); f4 = pow( f4,f4 );
+        f1 = exp( f1 ); f2 = exp( f2 ); f3 = exp( f3 ); f4 = exp( f4 );
+        f1 = log( f1 ); f2 = log( f2 ); f3 = log( f3 ); f4 = log( f4 );
+        f1 = exp2( f1 ); f2 = exp2( f2 ); f3 = exp2( f3 ); f4 = exp2( f4 );
+        f1 = log2( f1 ); f2 = log2( f2 ); f3 = log2( f3 ); f4 = log2( f4 );
+        f1 = sqrt( f1 ); f2 = sqrt( f2 ); f3 = sqrt( f3 ); f4 = sqrt( f4 );
+        f1 = rsqrt( f1 ); f2 = rsqrt( f2 ); f3 = rsqrt( f3 ); f4 = rsqrt( f4 );
+        f1 = log10( f1 ); f2 = log10( f2 ); f3 = log10( f3 ); f4 = log10( f4 );
+
+        i1 = sign ( i1 ); i2 = sign ( i2 ); i3 = sign ( i3 ); i4 = sign ( i4 );
+        f1 = sign ( f1 ); f2 = sign ( f2 ); f3 = sign ( f3 ); f4 = sign ( f4 );
+        f1 = floor ( f1 ); f2 = floor( f2 ); f3 = floor( f3 ); f4 = floor( f4 );
+        f1 = trunc ( f1 ); f2 = trunc( f2 ); f3 = trunc( f3 ); f4 = trunc( f4 );
+        f1 = round ( f1 ); f2 = round( f2 ); f3 = round( f3 ); f4 = round( f4 );
+        f1 = frac  ( f1 ); f2 = frac ( f2 ); f3 = frac ( f3 ); f4 = frac ( f4 );
+
+        f1 = 1.0;
+        f2 = float2(1.0, 2.0);
+        f3 = float3(1.0, 2.0, 3.0);
+        f4 = float4(1.0,2.0,3.0,4.0);
+        f1 = fmod  ( f1, f1 ); f2 = fmod ( f2, f2 ); f3 = fmod ( f3, f3 ); f4 = fmod ( f4, f4 );
+        f1 = modf  ( f1, f1 ); f2 = modf ( f2, f2 ); f3 = modf ( f3, f3 ); f4 = modf ( f4, f4 );
+
+        f1 = min(f1,f1); f2 = min(f2,f2); f3 = min(f3,f3); f4 = min(f4,f4);
+        i1 = min(i1,i1); i2 = min(i2,i2); i3 = min(i3,i3); i4 = min(i4,i4);
+        u1 = min(u1,u1); u2 = min(u2,u2); u3 = min(u3,u3); u4 = min(u4,u4);
+
+        f1 = max(f1,f1); f2 = max(f2,f2); f3 = max(f3,f3); f4 = max(f4,f4);
+        i1 = max(i1,i1); i2 = max(i2,i2); i3 = max(i3,i3); i4 = max(i4,i4);
+        u1 = max(u1,u1); u2 = max(u2,u2); u3 = max(u3,u3); u4 = max(u4,u4);
+
+        f1 = lerp(f1,f1,f1); f2 = lerp(f2,f2,f2); f3 = lerp(f3,f3,f3); f4 = lerp(f4,f4,f4);
+        f1 = step(f1,f1); f2 = step(f2,f2); f3 = step(f3,f3); f4 = step(f4,f4);
+        f1 = smoothstep(f1,f1_,f1); f2 = smoothstep(f2,f2_,f2); f3 = smoothstep(f3,f3_,f3); f4 = smoothstep(f4,f4_,f4);
+
+        b1 = isnan ( f1/Pos.x ); b2 = isnan( f2/Pos.x ); b3 = isnan( f3/Pos.x ); b4 = isnan( f4/Pos.x );
+        b1 = isinf ( f1/Pos.x ); b2 = isinf( f2/Pos.x ); b3 = isinf( f3/Pos.x ); b4 = isinf( f4/Pos.x );
+        b1 = isfinite ( f1/Pos.x ); b2 = isfinite( f2/Pos.x ); b3 = isfinite( f3/Pos.x ); b4 = isfinite( f4/Pos.x );
+        f1 = mad(f1,f1,f1); f2 = mad(f2,f2,f2); f3 = mad(f3,f3,f3); f4 = mad(f4,f4,f4);
+
+        f1 = distance(f1,f1); f1 = distance(f2,f2); f1 = distance(f3,f3); f1 = distance(f4,f4);
+        f1 = length(f1); f1 = length(f2); f1 = length(f3); f1 = length(f4);
+        f1 = dot(f1,f1); f1 = dot(f2,f2); f1 = dot(f3,f3); f1 = dot(f4,f4);
+        f3 = cross( f3, f3 );
+
+        f1 = 1.0;
+        f2 = float2(1.0, 2.0);
+        f3 = float3(1.0, 2.0, 3.0);
+        f4 = float4(1.0,2.0,3.0,4.0);
+        f2 = normalize(f2); f3 = normalize(f3); f4 = normalize(f4);
+        f2 = reflect(f2,f2); f3 = reflect(f3,f3); f4 = reflect(f4,f4);
+        f2 = refract(f2,f2,1.0); f3 = refract(f3,f3,1.0); f4 = refract(f4,f4,1.0);
+        f2 = faceforward(f2,f2,f2); f3 = faceforward(f3,f3,f3); f4 = faceforward(f4,f4,f4);
+
+        //f1 = dst(f1,f1); f1 = dst(f2,f2); f1 = dst(f3,f3); f1 = dst(f4,f4);
+        f1 = rcp(f1); f2 = rcp(f2); f3 = rcp(f3); f4 = rcp(f4);
+
+        f1 = saturate(f1); f2 = saturate(f2); f3 = saturate(f3); f4 = saturate(f4);
+        sincos(f1,f1,f1_); sincos(f2,f2,f2_); sincos(f3,f3,f3_); sincos(f4,f4,f4_);
+
+        // no bit operations in GLES3.0. SPIRV optimizer also fails to legalize these operations.
+#if !GLES30 && !defined(VULKAN)
+        i1 = countbits(u1); i2 = countbits(u2); i3 = countbits(u3); i4 = countbits(u4);
+        i1 = countbits(i1); i2 = countbits(i2); i3 = countbits(i3); i4 = countbits(i4);
+        i1 = firstbithigh(u1); i2 = firstbithigh(u2); i3 = firstbithigh(u3); i4 = firstbithigh(u4);
+        i1 = firstbithigh(i1); i2 = firstbithigh(i2); i3 = firstbithigh(i3); i4 = firstbithigh(i4);
+        i1 = firstbitlow(u1); i2 = firstbitlow(u2); i3 = firstbitlow(u3); i4 = firstbitlow(u4);
+        i1 = firstbitlow(i1); i2 = firstbitlow(i2); i3 = firstbitlow(i3); i4 = firstbitlow(i4);
+        u1 = reversebits(u1); u2 = reversebits(u2); u3 = reversebits(u3); u4 = reversebits(u4);
+        i1 = reversebits(i1); i2 = reversebits(i2); i3 = reversebits(i3); i4 = reversebits(i4);
+
+        f1 = frexp(f1_, f1); f2 = frexp(f2_, f2); f3 = frexp(f3_, f3); f4 = frexp(f4_, f4);
+        f1 = ldexp(f1, i1); f2 = ldexp(f2, i2); f3 = ldexp(f3, i3); f4 = ldexp(f4, i4);
+#endif
+
+
+        float4x4 f4x4;
+        f4x4[0] = float4(0.0, 1.0/Pos.x, 2.0/Pos.y, 3.0);
+        f4x4[1] = float4(0.0, 1.0/Pos.x, 2.0/Pos.y, 3.0);
+        f4x4[2] = float4(0.0, 1.0/Pos.x, 2.0/Pos.y, 3.0);
+        f4x4[3] = float4(0.0, 1.0/Pos.x, 2.0/Pos.y, 3.0);
+        f4x4 = transpose(f4x4);
+        f1 = determinant( f4x4 );
+
+        float3x3 f3x3;
+        f3x3[0] = float3(0.0, 1.0/Pos.x, 2.0/Pos.y);
+        f3x3[1] = float3(0.0, 1.0/Pos.x, 2.0/Pos.y);
+        f3x3[2] = float3(0.0, 1.0/Pos.x, 2.0/Pos.y);
+        f3x3 = transpose(f3x3);
+        f1 = determinant( f3x3 );
+
+        float2x2 f2x2;
+        f2x2[0] = float2(0.0, 1.0/Pos.x);
+        f2x2[1] = float2(0.0, 1.0/Pos.x);
+        f2x2 = transpose(f2x2);
+        f1 = determinant( f2x2 );
+
+        f1 = ddx( Pos.x ); f2 = ddx( Pos.xy ); f3 = ddx( Pos.xyz ); f4 = ddx( Pos.xyzw );
+        f1 = ddy( Pos.x ); f2 = ddy( Pos.xy ); f3 = ddy( Pos.xyz ); f4 = ddy( Pos.xyzw );
+        f1 = ddx_coarse( Pos.x ); f2 = ddx_coarse( Pos.xy ); f3 = ddx_coarse( Pos.xyz ); f4 = ddx_coarse( Pos.xyzw );
+        f1 = ddy_coarse( Pos.x ); f2 = ddy_coarse( Pos.xy ); f3 = ddy_coarse( Pos.xyz ); f4 = ddy_coarse( Pos.xyzw );
+        f1 = ddx_fine( Pos.x ); f2 = ddx_fine( Pos.xy ); f3 = ddx_fine( Pos.xyz ); f4 = ddx_fine( Pos.xyzw );
+        f1 = ddy_fine( Pos.x ); f2 = ddy_fine( Pos.xy ); f3 = ddy_fine( Pos.xyz ); f4 = ddy_fine( Pos.xyzw );
+#ifdef FRAGMENT_SHADER
+        f1 = fwidth( Pos.x ); f2 = fwidth( Pos.xy ); f3 = fwidth( Pos.xyz ); f4 = fwidth( Pos.xyzw );
+#endif
+
+        f1 = asfloat( f1 ); f2 = asfloat( f2 ); f3 = asfloat( f3 ); f4 = asfloat( f4 );
+        f1 = asfloat( i1 ); f2 = asfloat( i2 ); f3 = asfloat( i3 ); f4 = asfloat( i4 );
+        f1 = asfloat( u1 ); f2 = asfloat( u2 ); f3 = asfloat( u3 ); f4 = asfloat( u4 );
+
+        i1 = asint( f1 ); i2 = asint( f2 ); i3 = asint( f3 ); i4 = asint( f4 );
+        i1 = asint( i1 ); i2 = asint( i2 ); i3 = asint( i3 ); i4 = asint( i4 );
+        i1 = asint( u1 ); i2 = asint( u2 ); i3 = asint( u3 ); i4 = asint( u4 );
+
+        u1 = asuint( f1 ); u2 = asuint( f2 ); u3 = asuint( f3 ); u4 = asuint( f4 );
+        u1 = asuint( i1 ); u2 = asuint( i2 ); u3 = asuint( i3 ); u4 = asuint( i4 );
+        u1 = asuint( u1 ); u2 = asuint( u2 ); u3 = asuint( u3 ); u4 = asuint( u4 );
+
+#if defined(GL_ES) && (__VERSION__>=310) || !defined(GL_ES) && (__VERSION__>=420)
+        f1 = f16tof32( u1 ); f2 = f16tof32( u2 ); f3 = f16tof32( u3 ); f4 = f16tof32( u4 );
+        f1 = f16tof32( i1 ); f2 = f16tof32( i2 ); f3 = f16tof32( i3 ); f4 = f16tof32( i4 );
+        u1 = f32tof16( f1 ); u2 = f32tof16( f2 ); u3 = f32tof16( f3 ); u4 = f32tof16( f4 );
+#endif
+
+#ifndef GL_ES
+        double d = asdouble( u1, u1 );
+#endif
+    }
+}
@@ -1356,7 +1356,7 @@ void CreateComputeShader(IRenderDevice*        pDevice,
     }
 }
 
-void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = false)
+void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = false, bool UseThreadPool = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
     IRenderDevice*         pDevice          = pEnv->GetDevice();
@@ -1391,7 +1391,7 @@ void TestComputePipeline(PSO_ARCHIVE_FLAGS ArchiveFlags, bool CompileAsync = fal
 
     SerializationDeviceCreateInfo SerDeviceCI;
     SerDeviceCI.DeviceInfo.Features.SeparablePrograms = pDevice->GetDeviceInfo().Features.SeparablePrograms;
-    SerDeviceCI.NumAsyncShaderCompilationThreads      = CompileAsync ? 2 : 0;
+    SerDeviceCI.NumAsyncShaderCompilationThreads      = (CompileAsync || UseThreadPool) ? 2 : 0;
     RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
     pArchiverFactory->CreateSerializationDevice(SerDeviceCI, &pSerializationDevice);
     ASSERT_NE(pSerializationDevice, nullptr);
@@ -1612,6 +1612,12 @@ TEST(ArchiveTest, ComputePipeline_SplitArchive_Async)
     TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ true);
 }
 
+// Synchronous shader and pipeline creation that compiles and patches shaders for all devices in parallel
+TEST(ArchiveTest, ComputePipeline_Parallel)
+{
+    TestComputePipeline(PSO_ARCHIVE_FLAG_NONE, /*CompileAsync = */ false, /*UseThreadPool = */ true);
+}
+
 void TestRayTracingPipeline(bool CompileAsync = false, bool UseCurrentDeviceArchiveFlags = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
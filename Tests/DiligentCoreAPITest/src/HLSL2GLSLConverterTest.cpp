@@ -27,6 +27,8 @@
 
 #include "GPUTestingEnvironment.hpp"
 #include "HLSL2GLSLConverter.h"
+#include "HLSL2GLSLConverterImpl.hpp"
+#include "DataBlobImpl.hpp"
 
 #include "gtest/gtest.h"
 
@@ -175,4 +177,121 @@ TEST(HLSL2GLSLConverterTest, Preprocessor)
     }
 }
 
+// Checks that the converter output is byte-identical to the reference output
+// in shaders/HLSL2GLSLConverter/Reference.
+TEST(HLSL2GLSLConverterTest, ReferenceOutput)
+{
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pEnv->GetDevice()->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    struct ShaderInfo
+    {
+        const char* FileName;
+        const char* EntryPoint;
+        SHADER_TYPE ShaderType;
+    };
+    static constexpr ShaderInfo Shaders[] = {
+        {"VS_PS.hlsl", "TestVS", SHADER_TYPE_VERTEX},
+        {"VS_PS.hlsl", "TestPS", SHADER_TYPE_PIXEL},
+        {"CS_RWTex1D.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWTex2D_1.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWTex2D_2.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"CS_RWBuff.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"GS.hlsl", "main", SHADER_TYPE_GEOMETRY},
+        {"PreprocessorTest.hlsl", "main1", SHADER_TYPE_PIXEL},
+        {"PreprocessorTest.hlsl", "main2", SHADER_TYPE_PIXEL},
+        {"PreprocessorTest.hlsl", "main3", SHADER_TYPE_PIXEL},
+    };
+
+    const HLSL2GLSLConverterImpl& Converter = HLSL2GLSLConverterImpl::GetInstance();
+    for (const ShaderInfo& Shader : Shaders)
+    {
+        const std::string RefFileName = std::string{"Reference/"} + Shader.FileName + "." + Shader.EntryPoint + ".glsl";
+
+        RefCntAutoPtr<IFileStream> pRefStream;
+        pShaderSourceFactory->CreateInputStream(RefFileName.c_str(), &pRefStream);
+        ASSERT_NE(pRefStream, nullptr) << RefFileName;
+        std::string RefGLSL(pRefStream->GetSize(), '\0');
+        ASSERT_TRUE(pRefStream->Read(&RefGLSL[0], RefGLSL.size())) << RefFileName;
+
+        HLSL2GLSLConverterImpl::ConversionAttribs Attribs;
+        Attribs.pSourceStreamFactory = pShaderSourceFactory;
+        Attribs.InputFileName        = Shader.FileName;
+        Attribs.EntryPoint           = Shader.EntryPoint;
+        Attribs.ShaderType           = Shader.ShaderType;
+        StringAlloc GLSL             = Converter.Convert(Attribs);
+        EXPECT_TRUE(std::string(GLSL.c_str(), GLSL.length()) == RefGLSL) << "Converted GLSL does not match " << RefFileName;
+    }
+}
+
+TEST(HLSL2GLSLConverterTest, ConversionCache)
+{
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pEnv->GetDevice()->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    const HLSL2GLSLConverterImpl& Converter = HLSL2GLSLConverterImpl::GetInstance();
+
+    auto Convert = [&](const char* EntryPoint, SHADER_TYPE ShaderType, IHLSL2GLSLConversionCache* pCache) {
+        HLSL2GLSLConverterImpl::ConversionAttribs Attribs;
+        Attribs.pSourceStreamFactory = pShaderSourceFactory;
+        Attribs.InputFileName        = "VS_PS.hlsl";
+        Attribs.EntryPoint           = EntryPoint;
+        Attribs.ShaderType           = ShaderType;
+        Attribs.IncludeDefinitions   = true;
+        Attribs.pCache               = pCache;
+        StringAlloc GLSL             = Converter.Convert(Attribs);
+        return std::string{GLSL.c_str(), GLSL.length()};
+    };
+
+    const std::string RefVS = Convert("TestVS", SHADER_TYPE_VERTEX, nullptr);
+    const std::string RefPS = Convert("TestPS", SHADER_TYPE_PIXEL, nullptr);
+    ASSERT_FALSE(RefVS.empty());
+    ASSERT_FALSE(RefPS.empty());
+    ASSERT_NE(RefVS, RefPS);
+
+    RefCntAutoPtr<IHLSL2GLSLConversionCache> pCache;
+    CreateHLSL2GLSLConversionCache(&pCache);
+    ASSERT_NE(pCache, nullptr);
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(Convert("TestVS", SHADER_TYPE_VERTEX, pCache), RefVS);
+        EXPECT_EQ(Convert("TestPS", SHADER_TYPE_PIXEL, pCache), RefPS);
+    }
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pCache->Store(&pData);
+    ASSERT_NE(pData, nullptr);
+
+    RefCntAutoPtr<IHLSL2GLSLConversionCache> pCache2;
+    CreateHLSL2GLSLConversionCache(&pCache2);
+    ASSERT_NE(pCache2, nullptr);
+    ASSERT_TRUE(pCache2->Load(pData));
+
+    RefCntAutoPtr<IDataBlob> pData2;
+    pCache2->Store(&pData2);
+    ASSERT_NE(pData2, nullptr);
+    ASSERT_EQ(pData->GetSize(), pData2->GetSize());
+    EXPECT_EQ(memcmp(pData->GetConstDataPtr(), pData2->GetConstDataPtr(), pData->GetSize()), 0);
+
+    EXPECT_EQ(Convert("TestVS", SHADER_TYPE_VERTEX, pCache2), RefVS);
+    EXPECT_EQ(Convert("TestPS", SHADER_TYPE_PIXEL, pCache2), RefPS);
+
+    pCache2->Clear();
+    RefCntAutoPtr<IDataBlob> pData3;
+    pCache2->Store(&pData3);
+    ASSERT_NE(pData3, nullptr);
+    EXPECT_LT(pData3->GetSize(), pData->GetSize());
+
+    const Uint8 InvalidData[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    pEnv->SetErrorAllowance(1, "No worries, testing invalid cache data...\n");
+    EXPECT_FALSE(pCache2->Load(DataBlobImpl::Create(sizeof(InvalidData), InvalidData)));
+}
+
 } // namespace
@@ -31,6 +31,7 @@
 
 #include "GPUTestingEnvironment.hpp"
 #include "ThreadSignal.hpp"
+#include "Timer.hpp"
 #if D3D12_SUPPORTED
 #    include "D3D12/D3D12DebugLayerSetNameBugWorkaround.hpp"
 #endif
@@ -326,4 +327,80 @@ TEST_F(MultithreadedResourceCreationTest, CreateResources)
         t.join();
 }
 
+
+// Creates many buffers of different sizes from all threads at the same time, which is typical
+// for loading screens. Every thread also releases half of its buffers while other threads
+// are still allocating. First few threads also create a buffer that is larger than the default
+// memory page size.
+TEST(MultithreadedResourceCreation, ParallelBufferCreation)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (pDevice->GetDeviceInfo().IsGLDevice())
+    {
+        GTEST_SKIP() << "Multithreading resource creation is not supported in OpenGL";
+    }
+
+    if (pDevice->GetDeviceInfo().IsWebGPUDevice())
+    {
+        GTEST_SKIP() << "Multithreading resource creation is not supported in WebGPU";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+#ifdef DILIGENT_DEBUG
+    constexpr Uint32 NumBuffersPerThread = 128;
+#else
+    constexpr Uint32 NumBuffersPerThread = 1024;
+#endif
+    constexpr Uint64 LargeBufferSize       = Uint64{24} << 20;
+    constexpr Uint32 NumLargeBufferThreads = 4;
+
+    const Uint32             NumThreads = std::max(std::thread::hardware_concurrency(), 4u);
+    std::vector<std::thread> Threads(NumThreads);
+    std::atomic<Uint32>      NumFailures{0};
+
+    Timer T;
+    for (Uint32 ThreadId = 0; ThreadId < NumThreads; ++ThreadId)
+    {
+        Threads[ThreadId] = std::thread{[&, ThreadId]() {
+            std::vector<RefCntAutoPtr<IBuffer>> Buffers;
+            Buffers.reserve(NumBuffersPerThread);
+            for (Uint32 i = 0; i < NumBuffersPerThread; ++i)
+            {
+                BufferDesc BuffDesc;
+                BuffDesc.Name      = "MT creation test buffer";
+                BuffDesc.Usage     = USAGE_DEFAULT;
+                BuffDesc.BindFlags = (i % 2 == 0) ? BIND_UNIFORM_BUFFER : BIND_VERTEX_BUFFER;
+                // 256 bytes to 16 KB
+                BuffDesc.Size = Uint64{256} << ((i + ThreadId) % 7);
+                if (i == NumBuffersPerThread / 2 && ThreadId < NumLargeBufferThreads)
+                    BuffDesc.Size = LargeBufferSize;
+
+                RefCntAutoPtr<IBuffer> pBuffer;
+                pDevice->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+                if (!pBuffer)
+                    NumFailures.fetch_add(1);
+                Buffers.emplace_back(std::move(pBuffer));
+
+                // Release every other buffer while other threads keep allocating
+                if (i == NumBuffersPerThread / 2)
+                {
+                    for (size_t j = 0; j < Buffers.size(); j += 2)
+                        Buffers[j].Release();
+                }
+            }
+        }};
+    }
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(NumFailures.load(), 0u);
+
+    LOG_INFO_MESSAGE("Created ", NumBuffersPerThread, " buffers by each of ", NumThreads, " threads in ", T.GetElapsedTime() * 1000.0, " ms");
+
+    pEnv->ReleaseResources();
+}
+
 } // namespace
@@ -25,6 +25,8 @@
  */
 
 #include <functional>
+#include <thread>
+#include <vector>
 
 #include "GPUTestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
@@ -945,6 +947,93 @@ TEST(RenderStateCacheTest, CreateComputePSO_Sign_Async)
     TestComputePSO(/*UseSignature = */ true, /*CompileAsync = */ true);
 }
 
+// Requests the same shader and pipeline from many threads at once and checks that
+// all threads get the same objects, and that released objects are re-created.
+TEST(RenderStateCacheTest, ConcurrentRequests)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/RenderStateCache", &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.pShaderSourceStreamFactory     = pShaderSourceFactory;
+    ShaderCI.SourceLanguage                 = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler                 = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.CompileFlags                   = SHADER_COMPILE_FLAG_HLSL_TO_SPIRV_VIA_GLSL;
+    ShaderCI.WebGPUEmulatedArrayIndexSuffix = "_";
+
+    constexpr ShaderMacro Macros[] = {{"EXTERNAL_MACROS", "2"}};
+    ShaderCI.Macros                = {Macros, _countof(Macros)};
+    ShaderCI.Desc                  = {"RenderStateCache - CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.FilePath              = "ComputeShader.csh";
+
+    constexpr ShaderResourceVariableDesc Variables[] //
+        {
+            {SHADER_TYPE_COMPUTE, "g_tex2DUAV", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "cbConstants", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "g_CoordinateScaleBuffer", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "g_OutputBuffer", SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        };
+
+    constexpr Uint32 NumThreads = 16;
+
+    for (Uint32 HotReload = 0; HotReload < 2; ++HotReload)
+    {
+        auto pCache = CreateCache(pDevice, HotReload);
+        ASSERT_TRUE(pCache);
+
+        for (Uint32 Pass = 0; Pass < 2; ++Pass)
+        {
+            // 0: objects are created by the threads
+            // 1: objects from pass 0 are released, so the expired cache entries are replaced
+
+            std::vector<RefCntAutoPtr<IShader>>        Shaders(NumThreads);
+            std::vector<RefCntAutoPtr<IPipelineState>> PSOs(NumThreads);
+
+            std::vector<std::thread> Threads;
+            for (Uint32 t = 0; t < NumThreads; ++t)
+            {
+                Threads.emplace_back([&, t]() {
+                    pCache->CreateShader(ShaderCI, &Shaders[t]);
+                    if (!Shaders[t])
+                        return;
+
+                    ComputePipelineStateCreateInfo PsoCI;
+                    PsoCI.PSODesc.Name                        = "Render State Cache Concurrency Test";
+                    PsoCI.pCS                                 = Shaders[t];
+                    PsoCI.PSODesc.ResourceLayout.Variables    = Variables;
+                    PsoCI.PSODesc.ResourceLayout.NumVariables = _countof(Variables);
+                    pCache->CreateComputePipelineState(PsoCI, &PSOs[t]);
+                });
+            }
+            for (std::thread& Thread : Threads)
+                Thread.join();
+
+            for (Uint32 t = 0; t < NumThreads; ++t)
+            {
+                ASSERT_NE(Shaders[t], nullptr) << "Thread " << t;
+                ASSERT_NE(PSOs[t], nullptr) << "Thread " << t;
+                EXPECT_EQ(Shaders[t], Shaders[0]) << "Thread " << t;
+                EXPECT_EQ(PSOs[t], PSOs[0]) << "Thread " << t;
+            }
+            EXPECT_EQ(PSOs[0]->GetStatus(), PIPELINE_STATE_STATUS_READY);
+            VerifyComputePSO(PSOs[0]);
+        }
+
+        if (HotReload)
+            EXPECT_EQ(pCache->Reload(), 0u);
+    }
+}
+
 
 TEST(RenderStateCacheTest, CacheByFileName)
 {
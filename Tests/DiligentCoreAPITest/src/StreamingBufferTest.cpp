@@ -25,6 +25,9 @@
  *  of the possibility of such damages.
  */
 
+#include <thread>
+#include <vector>
+
 #include "StreamingBuffer.hpp"
 #include "GPUTestingEnvironment.hpp"
 
@@ -101,4 +104,155 @@ TEST(StreamingBufferTest, MapUnmap)
     StreamBuff.Reset();
 }
 
+TEST(StreamingBufferTest, ConcurrentAllocate)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    const auto& DeviceInfo = pDevice->GetDeviceInfo();
+    const auto& MemInfo    = pDevice->GetAdapterInfo().Memory;
+    if (!(DeviceInfo.IsVulkanDevice() || DeviceInfo.IsD3DDevice()) ||
+        MemInfo.UnifiedMemory == 0 || (MemInfo.UnifiedMemoryCPUAccess & CPU_ACCESS_WRITE) == 0)
+    {
+        GTEST_SKIP() << "Unified memory with CPU write access is not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    StreamingBufferCreateInfo CI;
+    CI.pDevice = pDevice;
+
+    CI.BuffDesc.Name           = "Test concurrent streaming buffer";
+    CI.BuffDesc.BindFlags      = BIND_VERTEX_BUFFER;
+    CI.BuffDesc.Usage          = USAGE_UNIFIED;
+    CI.BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+    CI.BuffDesc.Size           = 4096;
+
+    CI.AllowConcurrentAllocation = true;
+
+    StreamingBuffer StreamBuff{CI};
+    ASSERT_TRUE(StreamBuff.GetBuffer() != nullptr);
+    EXPECT_EQ(StreamBuff.GetChunkCount(), size_t{1});
+
+    // Chunks are only mapped by the context that owns the buffer
+    StreamBuff.ReserveChunks(pContext, 2);
+    EXPECT_EQ(StreamBuff.GetChunkCount(), size_t{2});
+
+    {
+        auto Alloc0 = StreamBuff.Allocate(100);
+        ASSERT_TRUE(Alloc0);
+        EXPECT_EQ(Alloc0.pBuffer, StreamBuff.GetBuffer());
+        EXPECT_EQ(Alloc0.Offset, Uint64{0});
+        EXPECT_NE(Alloc0.pCPUAddress, nullptr);
+
+        auto Alloc1 = StreamBuff.Allocate(100, 256);
+        ASSERT_TRUE(Alloc1);
+        EXPECT_EQ(Alloc1.Offset, Uint64{256});
+        EXPECT_EQ(static_cast<Uint8*>(Alloc1.pCPUAddress) - static_cast<Uint8*>(Alloc0.pCPUAddress), 256);
+
+        // Allocation that does not fit into the first chunk goes to the reserved one
+        auto Alloc2 = StreamBuff.Allocate(4000);
+        ASSERT_TRUE(Alloc2);
+        EXPECT_NE(Alloc2.pBuffer, Alloc0.pBuffer);
+        EXPECT_EQ(Alloc2.Offset, Uint64{0});
+        EXPECT_EQ(StreamBuff.GetChunkCount(), size_t{2});
+
+        // There are no free chunks left. Allocate() never creates or maps chunks.
+        pEnv->SetErrorAllowance(2, "No worries, errors are expected: testing streaming buffer chunk exhaustion\n");
+        EXPECT_FALSE(StreamBuff.Allocate(4000));
+        // Allocation that is larger than the chunk size
+        EXPECT_FALSE(StreamBuff.Allocate(8192));
+        EXPECT_EQ(StreamBuff.GetChunkCount(), size_t{2});
+    }
+
+    StreamBuff.FinishCurrentFrame(1);
+    StreamBuff.ReleaseCompletedFrames(0);
+    // Both chunks are used by frame 1, so new chunks that can hold 8192 bytes are created
+    StreamBuff.ReserveChunks(pContext);
+    EXPECT_GT(StreamBuff.GetChunkCount(), size_t{2});
+
+    IBuffer* pFrame2Buffer = nullptr;
+    {
+        auto Alloc = StreamBuff.Allocate(8192);
+        ASSERT_TRUE(Alloc);
+        EXPECT_EQ(Alloc.Offset, Uint64{0});
+        EXPECT_GE(Alloc.pBuffer->GetDesc().Size, Uint64{8192});
+        pFrame2Buffer = Alloc.pBuffer;
+    }
+
+    // Chunks retired by Reset() are not recycled until their fence value is completed
+    StreamBuff.FinishCurrentFrame(2);
+    StreamBuff.Reset();
+    StreamBuff.ReleaseCompletedFrames(1);
+    {
+        // Three of the four large chunks are free
+        for (Uint32 i = 0; i < 3; ++i)
+        {
+            auto Alloc = StreamBuff.Allocate(8192);
+            ASSERT_TRUE(Alloc);
+            EXPECT_NE(Alloc.pBuffer, pFrame2Buffer);
+        }
+        pEnv->SetErrorAllowance(1, "No worries, errors are expected: testing streaming buffer chunk exhaustion\n");
+        EXPECT_FALSE(StreamBuff.Allocate(8192));
+    }
+
+    StreamBuff.FinishCurrentFrame(3);
+    StreamBuff.ReleaseCompletedFrames(3);
+    StreamBuff.ReserveChunks(pContext, 4);
+    {
+        // The chunk used by frame 2 is recycled now
+        auto Alloc = StreamBuff.Allocate(8192);
+        ASSERT_TRUE(Alloc);
+        EXPECT_EQ(Alloc.pBuffer, pFrame2Buffer);
+    }
+    const size_t NumChunksBeforeTest = StreamBuff.GetChunkCount();
+
+    // Allocate from multiple threads and check that allocations do not overlap
+    {
+        constexpr Uint32 NumThreads         = 4;
+        constexpr Uint32 NumAllocsPerThread = 48;
+        constexpr Uint64 AllocSize          = 48;
+        constexpr Uint64 AllocAlignment     = 16;
+
+        std::vector<std::vector<StreamingBuffer::Allocation>> Allocations(NumThreads);
+
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back([&, t]() {
+                for (Uint32 i = 0; i < NumAllocsPerThread; ++i)
+                {
+                    // The reserved chunks have enough space, so no chunks are created here
+                    auto Alloc = StreamBuff.Allocate(AllocSize, AllocAlignment);
+                    if (Alloc)
+                        memset(Alloc.pCPUAddress, static_cast<int>(t + 1), static_cast<size_t>(AllocSize));
+                    Allocations[t].push_back(Alloc);
+                }
+            });
+        }
+        for (std::thread& Thread : Threads)
+            Thread.join();
+
+        EXPECT_EQ(StreamBuff.GetChunkCount(), NumChunksBeforeTest);
+
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            for (const StreamingBuffer::Allocation& Alloc : Allocations[t])
+            {
+                ASSERT_TRUE(Alloc);
+                EXPECT_EQ(Alloc.Offset % AllocAlignment, Uint64{0});
+                const Uint8* pData = static_cast<const Uint8*>(Alloc.pCPUAddress);
+                for (Uint64 i = 0; i < AllocSize; ++i)
+                    ASSERT_EQ(pData[i], t + 1) << "Allocation at offset " << Alloc.Offset << " was overwritten by another thread";
+            }
+        }
+    }
+
+    StreamBuff.FinishCurrentFrame(4);
+    StreamBuff.ReleaseCompletedFrames(4);
+
+    StreamBuff.Reset();
+}
+
 } // namespace
@@ -0,0 +1,147 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "DeviceContextVk.h"
+#include "TextureVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class VkBarrierStatisticsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+        if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "This test is only for Vulkan device";
+        }
+    }
+
+    // Creates a texture in COPY_DEST state and starts a new frame so that
+    // the barrier statistics of the next frame only include the test transitions.
+    static RefCntAutoPtr<ITexture> CreateTestTexture()
+    {
+        GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+        IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Barrier statistics test texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = 64;
+        TexDesc.Height    = 64;
+        TexDesc.MipLevels = 2;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE | BIND_RENDER_TARGET;
+        TexDesc.Usage     = USAGE_DEFAULT;
+
+        RefCntAutoPtr<ITexture> pTexture;
+        pEnv->GetDevice()->CreateTexture(TexDesc, nullptr, &pTexture);
+        if (!pTexture)
+            return {};
+
+        const StateTransitionDesc Barrier{pTexture, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        pContext->TransitionResourceStates(1, &Barrier);
+        pContext->Flush();
+        pContext->FinishFrame();
+
+        return pTexture;
+    }
+};
+
+TEST_F(VkBarrierStatisticsTest, MergeLayoutTransitions)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    IDeviceContext* pContext = GPUTestingEnvironment::GetInstance()->GetDeviceContext();
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_NE(pContextVk, nullptr);
+
+    RefCntAutoPtr<ITexture> pTexture = CreateTestTexture();
+    ASSERT_NE(pTexture, nullptr);
+
+    // COPY_DEST -> RENDER_TARGET -> SHADER_RESOURCE must be recorded as a single
+    // COPY_DEST -> SHADER_RESOURCE transition
+    const StateTransitionDesc Barriers[] = {
+        {pTexture, RESOURCE_STATE_COPY_DEST, RESOURCE_STATE_RENDER_TARGET, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {pTexture, RESOURCE_STATE_RENDER_TARGET, RESOURCE_STATE_SHADER_RESOURCE, STATE_TRANSITION_FLAG_UPDATE_STATE},
+    };
+    pContext->TransitionResourceStates(_countof(Barriers), Barriers);
+    pContext->Flush();
+    pContext->FinishFrame();
+
+    BarrierStatisticsVk Stats;
+    pContextVk->GetBarrierStatistics(Stats);
+    EXPECT_EQ(Stats.NumRequestedBarriers, 2u);
+    EXPECT_EQ(Stats.NumMergedTransitions, 1u);
+    EXPECT_EQ(Stats.NumPipelineBarriers, 1u);
+
+    EXPECT_EQ(pTexture->GetState(), RESOURCE_STATE_SHADER_RESOURCE);
+    RefCntAutoPtr<ITextureVk> pTextureVk{pTexture, IID_TextureVk};
+    ASSERT_NE(pTextureVk, nullptr);
+    EXPECT_EQ(pTextureVk->GetLayout(), VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+}
+
+TEST_F(VkBarrierStatisticsTest, DifferentRangesAreNotMerged)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    IDeviceContext* pContext = GPUTestingEnvironment::GetInstance()->GetDeviceContext();
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_NE(pContextVk, nullptr);
+
+    RefCntAutoPtr<ITexture> pTexture = CreateTestTexture();
+    ASSERT_NE(pTexture, nullptr);
+
+    // The second transition only covers the first mip level, so the pending
+    // barrier must be flushed before it is recorded.
+    const StateTransitionDesc Barriers[] = {
+        {pTexture, RESOURCE_STATE_COPY_DEST, RESOURCE_STATE_RENDER_TARGET, STATE_TRANSITION_FLAG_UPDATE_STATE},
+        {pTexture, RESOURCE_STATE_RENDER_TARGET, RESOURCE_STATE_SHADER_RESOURCE, 0, 1, 0, REMAINING_ARRAY_SLICES},
+    };
+    pContext->TransitionResourceStates(_countof(Barriers), Barriers);
+    pContext->Flush();
+    pContext->FinishFrame();
+
+    BarrierStatisticsVk Stats;
+    pContextVk->GetBarrierStatistics(Stats);
+    EXPECT_EQ(Stats.NumRequestedBarriers, 2u);
+    EXPECT_EQ(Stats.NumMergedTransitions, 0u);
+    EXPECT_EQ(Stats.NumPipelineBarriers, 2u);
+}
+
+} // namespace
@@ -0,0 +1,413 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <array>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "DeviceContextVk.h"
+#include "MapHelper.hpp"
+#include "ThreadSignal.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class VkConcurrentSubmissionTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+        if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "This test is only for Vulkan device";
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        GPUTestingEnvironment::GetInstance()->Reset();
+    }
+
+    static constexpr Uint32 TexSize = 16;
+
+    static Uint32 GetTexelValue(Uint32 Thread, Uint32 Item)
+    {
+        return 0xA0000000u | (Thread << 16u) | Item;
+    }
+
+    // Creates a texture initialized with the given value. Textures are always initialized through
+    // a staging buffer, so every call submits a transient command buffer to the queue.
+    static RefCntAutoPtr<ITexture> CreateInitializedTexture(Uint32 Value)
+    {
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Concurrent submission test texture";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = TexSize;
+        TexDesc.Height    = TexSize;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UINT;
+        TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+        TexDesc.Usage     = USAGE_DEFAULT;
+
+        const std::vector<Uint32> Texels(TexSize * TexSize, Value);
+
+        TextureSubResData SubresData{Texels.data(), TexSize * sizeof(Uint32)};
+        TextureData       InitData{&SubresData, 1};
+
+        RefCntAutoPtr<ITexture> pTexture;
+        GPUTestingEnvironment::GetInstance()->GetDevice()->CreateTexture(TexDesc, &InitData, &pTexture);
+        return pTexture;
+    }
+
+    static RefCntAutoPtr<IBuffer> CreateBuffer(const char* Name, USAGE Usage, CPU_ACCESS_FLAGS CPUAccess, Uint32 Size)
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = Name;
+        BuffDesc.Size           = Size;
+        BuffDesc.Usage          = Usage;
+        BuffDesc.CPUAccessFlags = CPUAccess;
+        BuffDesc.BindFlags      = Usage == USAGE_DEFAULT ? BIND_UNORDERED_ACCESS : BIND_NONE;
+        BuffDesc.Mode           = Usage == USAGE_DEFAULT ? BUFFER_MODE_RAW : BUFFER_MODE_UNDEFINED;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        GPUTestingEnvironment::GetInstance()->GetDevice()->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        return pBuffer;
+    }
+
+    static Uint64 GetNextFenceValue(IDeviceContext* pContext)
+    {
+        ICommandQueue* pQueue     = pContext->LockCommandQueue();
+        const Uint64   FenceValue = pQueue->GetNextFenceValue();
+        pContext->UnlockCommandQueue();
+        return FenceValue;
+    }
+
+    // Copies the textures into a staging texture and checks that every texel of texture i has value ExpectedValues[i]
+    static void VerifyTextures(const std::vector<RefCntAutoPtr<ITexture>>& Textures, const std::vector<Uint32>& ExpectedValues)
+    {
+        GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+        IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+        TextureDesc StagingDesc;
+        StagingDesc.Name           = "Concurrent submission test staging texture";
+        StagingDesc.Type           = RESOURCE_DIM_TEX_2D_ARRAY;
+        StagingDesc.Width          = TexSize;
+        StagingDesc.Height         = TexSize;
+        StagingDesc.ArraySize      = static_cast<Uint32>(Textures.size());
+        StagingDesc.Format         = TEX_FORMAT_RGBA8_UINT;
+        StagingDesc.Usage          = USAGE_STAGING;
+        StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+        RefCntAutoPtr<ITexture> pStagingTex;
+        pEnv->GetDevice()->CreateTexture(StagingDesc, nullptr, &pStagingTex);
+        ASSERT_NE(pStagingTex, nullptr);
+
+        for (Uint32 i = 0; i < Textures.size(); ++i)
+        {
+            CopyTextureAttribs CopyAttribs{Textures[i], RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+            CopyAttribs.DstSlice = i;
+            pContext->CopyTexture(CopyAttribs);
+        }
+        pContext->WaitForIdle();
+
+        for (Uint32 i = 0; i < Textures.size(); ++i)
+        {
+            MappedTextureSubresource MappedData;
+            pContext->MapTextureSubresource(pStagingTex, 0, i, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+            ASSERT_NE(MappedData.pData, nullptr);
+
+            bool DataOK = true;
+            for (Uint32 y = 0; y < TexSize && DataOK; ++y)
+            {
+                const Uint32* pRow = reinterpret_cast<const Uint32*>(static_cast<const Uint8*>(MappedData.pData) + y * MappedData.Stride);
+                for (Uint32 x = 0; x < TexSize && DataOK; ++x)
+                    DataOK = pRow[x] == ExpectedValues[i];
+            }
+            EXPECT_TRUE(DataOK) << "Texture " << i;
+
+            pContext->UnmapTextureSubresource(pStagingTex, 0, i);
+        }
+    }
+};
+
+// Several threads create textures with initial data at the same time. Every texture submits
+// a transient command buffer, so the submissions that overlap must be batched into fewer queue submits.
+TEST_F(VkConcurrentSubmissionTest, TransientUploadsFromMultipleThreads)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    IDeviceContext* pContext = GPUTestingEnvironment::GetInstance()->GetDeviceContext();
+
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    ASSERT_NE(pContextVk, nullptr);
+
+    constexpr Uint32 NumThreads           = 4;
+    constexpr Uint32 NumTexturesPerThread = 16;
+    // Whether submissions from different threads overlap depends on scheduling,
+    // so the uploads are repeated until some of them are batched.
+    constexpr Uint32 MaxAttempts = 8;
+
+    // Submissions can only overlap if the threads run in parallel
+    const bool ExpectBatching = std::thread::hardware_concurrency() > 1;
+
+    // Start a new frame so that the submission statistics only include the uploads
+    pContext->Flush();
+    pContext->FinishFrame();
+
+    SubmissionStatisticsVk Stats;
+    for (Uint32 Attempt = 0; Attempt < MaxAttempts; ++Attempt)
+    {
+        const Uint64 FirstFenceValue = GetNextFenceValue(pContext);
+
+        std::array<std::vector<RefCntAutoPtr<ITexture>>, NumThreads> ThreadTextures;
+
+        std::atomic<Uint32> NumThreadsReady{0};
+        Threading::Signal   StartSignal;
+
+        std::vector<std::thread> Threads;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            Threads.emplace_back(
+                [&](Uint32 ThreadId) //
+                {
+                    NumThreadsReady.fetch_add(1);
+                    StartSignal.Wait();
+
+                    for (Uint32 i = 0; i < NumTexturesPerThread; ++i)
+                        ThreadTextures[ThreadId].emplace_back(CreateInitializedTexture(GetTexelValue(ThreadId, i)));
+                },
+                t);
+        }
+
+        // Release all threads at once to maximize contention on the queue
+        while (NumThreadsReady.load() < NumThreads)
+            std::this_thread::yield();
+        StartSignal.Trigger(true);
+
+        for (std::thread& Thread : Threads)
+            Thread.join();
+
+        const Uint64 LastFenceValue = GetNextFenceValue(pContext);
+
+        pContext->FinishFrame();
+
+        // Every submission is assigned its own fence value, even if it was submitted as part of a batch
+        pContextVk->GetSubmissionStatistics(Stats);
+        EXPECT_GE(Stats.NumSubmissions, NumThreads * NumTexturesPerThread);
+        EXPECT_EQ(Stats.NumSubmissions, LastFenceValue - FirstFenceValue);
+        EXPECT_GE(Stats.NumQueueSubmits, 1u);
+        EXPECT_LE(Stats.NumQueueSubmits, Stats.NumSubmissions);
+        std::cout << TestingEnvironment::GetCurrentTestStatusString() << ' '
+                  << Stats.NumSubmissions << " submissions were issued in " << Stats.NumQueueSubmits << " queue submits" << std::endl;
+
+        std::vector<RefCntAutoPtr<ITexture>> Textures;
+        std::vector<Uint32>                  ExpectedValues;
+        for (Uint32 t = 0; t < NumThreads; ++t)
+        {
+            ASSERT_EQ(ThreadTextures[t].size(), NumTexturesPerThread);
+            for (Uint32 i = 0; i < NumTexturesPerThread; ++i)
+            {
+                ASSERT_NE(ThreadTextures[t][i], nullptr);
+                Textures.emplace_back(ThreadTextures[t][i]);
+                ExpectedValues.emplace_back(GetTexelValue(t, i));
+            }
+        }
+        VerifyTextures(Textures, ExpectedValues);
+
+        // The queue must have completed every submission
+        ICommandQueue* pQueue = pContext->LockCommandQueue();
+        EXPECT_GE(pQueue->GetCompletedFenceValue(), LastFenceValue - 1);
+        pContext->UnlockCommandQueue();
+
+        // VerifyTextures() submits the copy commands to the queue, start a new frame to not count them
+        pContext->FinishFrame();
+
+        if (Stats.NumQueueSubmits < Stats.NumSubmissions || !ExpectBatching)
+            break;
+    }
+
+    if (ExpectBatching)
+    {
+        EXPECT_LT(Stats.NumQueueSubmits, Stats.NumSubmissions) << "Concurrent submissions were not batched in " << MaxAttempts << " attempts";
+    }
+}
+
+// Deferred contexts record command lists while other threads create textures with initial data.
+// The immediate context executes the command lists one by one and signals a fence after each of them.
+// Fence values must be completed in order and every command list must be executed.
+TEST_F(VkConcurrentSubmissionTest, CommandListsAndTransientUploads)
+{
+    GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+    if (pEnv->GetNumDeferredContexts() < 2)
+    {
+        GTEST_SKIP() << "At least two deferred contexts are required";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    IRenderDevice*  pDevice  = pEnv->GetDevice();
+    IDeviceContext* pContext = pEnv->GetDeviceContext();
+
+    constexpr Uint32 NumRecordingThreads  = 2;
+    constexpr Uint32 NumUploadThreads     = 2;
+    constexpr Uint32 NumListsPerThread    = 8;
+    constexpr Uint32 NumCmdLists          = NumRecordingThreads * NumListsPerThread;
+    constexpr Uint32 NumTexturesPerThread = 16;
+    constexpr Uint32 BufferSize           = 256;
+
+    // Every command list writes its own value into its own region of the buffer
+    RefCntAutoPtr<IBuffer> pBuffer = CreateBuffer("Concurrent submission test buffer", USAGE_DEFAULT, CPU_ACCESS_NONE, BufferSize * NumCmdLists);
+    ASSERT_NE(pBuffer, nullptr);
+    RefCntAutoPtr<IBuffer> pStagingBuffer = CreateBuffer("Concurrent submission test staging buffer", USAGE_STAGING, CPU_ACCESS_READ, BufferSize * NumCmdLists);
+    ASSERT_NE(pStagingBuffer, nullptr);
+
+    StateTransitionDesc Barrier{pBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE};
+    pContext->TransitionResourceStates(1, &Barrier);
+    pContext->Flush();
+
+    FenceDesc FenceCI;
+    FenceCI.Name = "Concurrent submission test fence";
+    FenceCI.Type = FENCE_TYPE_CPU_WAIT_ONLY;
+    RefCntAutoPtr<IFence> pFence;
+    pDevice->CreateFence(FenceCI, &pFence);
+    ASSERT_NE(pFence, nullptr);
+    const Uint64 FirstFenceValue = pFence->GetCompletedValue() + 1;
+
+    std::array<RefCntAutoPtr<ICommandList>, NumCmdLists>               CmdLists;
+    std::array<std::vector<RefCntAutoPtr<ITexture>>, NumUploadThreads> ThreadTextures;
+
+    std::atomic<Uint32> NumCmdListsReady{0};
+    Threading::Signal   FinishFrameSignal;
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumRecordingThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&](Uint32 ThreadId) //
+            {
+                IDeviceContext* pCtx = pEnv->GetDeferredContext(ThreadId);
+                for (Uint32 i = 0; i < NumListsPerThread; ++i)
+                {
+                    const Uint32              ListIdx = ThreadId * NumListsPerThread + i;
+                    const std::vector<Uint32> Data(BufferSize / sizeof(Uint32), GetTexelValue(ThreadId, ListIdx));
+
+                    pCtx->Begin(0);
+                    pCtx->UpdateBuffer(pBuffer, ListIdx * BufferSize, BufferSize, Data.data(), RESOURCE_STATE_TRANSITION_MODE_VERIFY);
+                    pCtx->FinishCommandList(&CmdLists[ListIdx]);
+                    NumCmdListsReady.fetch_add(1);
+                }
+
+                FinishFrameSignal.Wait(true, NumRecordingThreads);
+                pCtx->FinishFrame();
+            },
+            t);
+    }
+    for (Uint32 t = 0; t < NumUploadThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&](Uint32 ThreadId) //
+            {
+                for (Uint32 i = 0; i < NumTexturesPerThread; ++i)
+                    ThreadTextures[ThreadId].emplace_back(CreateInitializedTexture(GetTexelValue(NumRecordingThreads + ThreadId, i)));
+            },
+            t);
+    }
+
+    // Wait until all command lists are recorded. Command lists from different threads
+    // write to different buffer regions, so the execution order only matters for the fence.
+    while (NumCmdListsReady.load() < NumCmdLists)
+        std::this_thread::yield();
+
+    Uint64 LastCompletedValue = 0;
+    for (Uint32 i = 0; i < NumCmdLists; ++i)
+    {
+        ICommandList* pCmdList = CmdLists[i];
+        ASSERT_NE(pCmdList, nullptr);
+        pContext->ExecuteCommandLists(1, &pCmdList);
+        pContext->EnqueueSignal(pFence, FirstFenceValue + i);
+        pContext->Flush();
+
+        // Fence values are signaled in submission order and must never go back
+        const Uint64 CompletedValue = pFence->GetCompletedValue();
+        EXPECT_GE(CompletedValue, LastCompletedValue);
+        EXPECT_LE(CompletedValue, FirstFenceValue + i);
+        LastCompletedValue = CompletedValue;
+    }
+
+    FinishFrameSignal.Trigger(true);
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    pFence->Wait(FirstFenceValue + NumCmdLists - 1);
+    EXPECT_EQ(pFence->GetCompletedValue(), FirstFenceValue + NumCmdLists - 1);
+
+    for (auto& CmdList : CmdLists)
+        CmdList.Release();
+    pContext->FinishFrame();
+
+    pContext->CopyBuffer(pBuffer, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingBuffer, 0, BufferSize * NumCmdLists, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+    {
+        MapHelper<Uint32> BufferData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+        const Uint32*     pData = BufferData;
+        ASSERT_NE(pData, nullptr);
+        for (Uint32 ListIdx = 0; ListIdx < NumCmdLists; ++ListIdx)
+        {
+            const Uint32 ThreadId = ListIdx / NumListsPerThread;
+            const Uint32 Expected = GetTexelValue(ThreadId, ListIdx);
+
+            bool DataOK = true;
+            for (Uint32 i = 0; i < BufferSize / sizeof(Uint32) && DataOK; ++i)
+                DataOK = pData[ListIdx * BufferSize / sizeof(Uint32) + i] == Expected;
+            EXPECT_TRUE(DataOK) << "Command list " << ListIdx;
+        }
+    }
+
+    std::vector<RefCntAutoPtr<ITexture>> Textures;
+    std::vector<Uint32>                  ExpectedValues;
+    for (Uint32 t = 0; t < NumUploadThreads; ++t)
+    {
+        ASSERT_EQ(ThreadTextures[t].size(), NumTexturesPerThread);
+        for (Uint32 i = 0; i < NumTexturesPerThread; ++i)
+        {
+            ASSERT_NE(ThreadTextures[t][i], nullptr);
+            Textures.emplace_back(ThreadTextures[t][i]);
+            ExpectedValues.emplace_back(GetTexelValue(NumRecordingThreads + t, i));
+        }
+    }
+    VerifyTextures(Textures, ExpectedValues);
+}
+
+} // namespace
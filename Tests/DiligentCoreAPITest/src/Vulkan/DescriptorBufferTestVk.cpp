@@ -0,0 +1,321 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "BasicMath.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+namespace HLSL
+{
+
+// clang-format off
+const std::string DescriptorBufferTest_CS{
+R"(
+// Signature 0
+cbuffer cbStatic
+{
+    float4 g_StaticValue;
+}
+Texture2D g_MutableTex;
+cbuffer cbDynamic
+{
+    float4 g_DynamicValue;
+}
+RWStructuredBuffer<float4> g_Output;
+SamplerState g_Sampler;
+
+// Signature 1
+Texture2D g_StaticTex;
+cbuffer cbMutable
+{
+    float4 g_MutableValue;
+}
+Texture2D g_DynamicTex;
+
+[numthreads(1, 1, 1)]
+void main()
+{
+    // The immutable sampler uses point filtering and clamp addressing,
+    // so this always returns the second texel of a 2x1 texture.
+    float2 UV = float2(1.25, 0.5);
+
+    g_Output[0] = g_StaticValue;
+    g_Output[1] = g_MutableValue;
+    g_Output[2] = g_DynamicValue;
+    g_Output[3] = g_StaticTex.SampleLevel(g_Sampler, UV, 0);
+    g_Output[4] = g_MutableTex.SampleLevel(g_Sampler, UV, 0);
+    g_Output[5] = g_DynamicTex.SampleLevel(g_Sampler, UV, 0);
+}
+)"
+};
+// clang-format on
+
+} // namespace HLSL
+
+class VkDescriptorBufferTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+        if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "This test is only for Vulkan device";
+        }
+
+        RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pEnv->GetDevice(), IID_RenderDeviceVk};
+        DeviceFeaturesVk               FeaturesVk;
+        pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+        // Only one path can be active in a device. The expected values are the same for both,
+        // so running the tests with --Features.DescriptorBuffer=On and Off compares the paths.
+        if (FeaturesVk.DescriptorBuffer == DEVICE_FEATURE_STATE_ENABLED)
+            LOG_INFO_MESSAGE("VK_EXT_descriptor_buffer is enabled: resources are bound through descriptor buffers");
+        else
+            LOG_INFO_MESSAGE("VK_EXT_descriptor_buffer is not enabled: resources are bound through descriptor sets");
+    }
+
+    static void TearDownTestSuite()
+    {
+        GPUTestingEnvironment::GetInstance()->Reset();
+    }
+};
+
+// Binds static, mutable and dynamic constant buffers and textures, a dynamic UAV and an immutable
+// sampler from two resource signatures, dispatches a compute shader that copies the values to the
+// output buffer, and compares the output with the values that were set.
+TEST_F(VkDescriptorBufferTest, StaticMutableDynamicResources)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    GPUTestingEnvironment* pEnv     = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice  = pEnv->GetDevice();
+    IDeviceContext*        pContext = pEnv->GetDeviceContext();
+
+    constexpr Uint32 NumPasses  = 2;
+    constexpr Uint32 NumOutputs = 6;
+
+    // clang-format off
+    const float4 StaticValue{1, 2, 3, 4};
+    const float4 MutableValues[NumPasses] = {{5, 6, 7, 8}, {9, 10, 11, 12}};
+    const float4 DynamicValues[NumPasses] = {{13, 14, 15, 16}, {17, 18, 19, 20}};
+
+    const float4 StaticTexel{0.25f, 0.5f, 0.75f, 1.f};
+    const float4 MutableTexels[NumPasses] = {{1, 0, 0, 1}, {0, 1, 0, 1}};
+    const float4 DynamicTexels[NumPasses] = {{0, 0, 1, 1}, {1, 1, 0, 0}};
+    // clang-format on
+
+    auto CreateConstants = [&](const char* Name, const float4& Value) {
+        RefCntAutoPtr<IBuffer> pBuffer;
+        CreateUniformBuffer(pDevice, sizeof(float4), Name, &pBuffer, USAGE_DEFAULT, BIND_UNIFORM_BUFFER, CPU_ACCESS_NONE, const_cast<float4*>(&Value));
+        return pBuffer;
+    };
+
+    auto CreateTexture = [&](const char* Name, const float4& Texel) -> RefCntAutoPtr<ITextureView> {
+        // The first texel must never be sampled
+        const float4            TexData[] = {float4{-1, -1, -1, -1}, Texel};
+        RefCntAutoPtr<ITexture> pTex      = pEnv->CreateTexture(Name, TEX_FORMAT_RGBA32_FLOAT, BIND_SHADER_RESOURCE, 2, 1, TexData);
+        return RefCntAutoPtr<ITextureView>{pTex ? pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE) : nullptr};
+    };
+
+    RefCntAutoPtr<IBuffer> pStaticCB = CreateConstants("Descriptor buffer test - static constants", StaticValue);
+    ASSERT_NE(pStaticCB, nullptr);
+    RefCntAutoPtr<ITextureView> pStaticTexSRV = CreateTexture("Descriptor buffer test - static texture", StaticTexel);
+    ASSERT_NE(pStaticTexSRV, nullptr);
+
+    RefCntAutoPtr<IBuffer>      pMutableCBs[NumPasses];
+    RefCntAutoPtr<ITextureView> pMutableTexSRVs[NumPasses];
+    RefCntAutoPtr<ITextureView> pDynamicTexSRVs[NumPasses];
+    RefCntAutoPtr<IBuffer>      pOutputs[NumPasses];
+    for (Uint32 pass = 0; pass < NumPasses; ++pass)
+    {
+        pMutableCBs[pass] = CreateConstants("Descriptor buffer test - mutable constants", MutableValues[pass]);
+        ASSERT_NE(pMutableCBs[pass], nullptr);
+        pMutableTexSRVs[pass] = CreateTexture("Descriptor buffer test - mutable texture", MutableTexels[pass]);
+        ASSERT_NE(pMutableTexSRVs[pass], nullptr);
+        pDynamicTexSRVs[pass] = CreateTexture("Descriptor buffer test - dynamic texture", DynamicTexels[pass]);
+        ASSERT_NE(pDynamicTexSRVs[pass], nullptr);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Descriptor buffer test - output";
+        BuffDesc.Size              = sizeof(float4) * NumOutputs;
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(float4);
+        pOutputs[pass]             = pEnv->CreateBuffer(BuffDesc);
+        ASSERT_NE(pOutputs[pass], nullptr);
+    }
+
+    RefCntAutoPtr<IBuffer> pDynamicCB;
+    CreateUniformBuffer(pDevice, sizeof(float4), "Descriptor buffer test - dynamic constants", &pDynamicCB);
+    ASSERT_NE(pDynamicCB, nullptr);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS[2];
+    {
+        // clang-format off
+        const PipelineResourceDesc Resources[] =
+        {
+            {SHADER_TYPE_COMPUTE, "cbStatic",     1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+            {SHADER_TYPE_COMPUTE, "g_MutableTex", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "cbDynamic",    1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+            {SHADER_TYPE_COMPUTE, "g_Output",     1, SHADER_RESOURCE_TYPE_BUFFER_UAV,      SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        };
+        const ImmutableSamplerDesc ImmutableSamplers[] =
+        {
+            {SHADER_TYPE_COMPUTE, "g_Sampler", SamplerDesc{FILTER_TYPE_POINT, FILTER_TYPE_POINT, FILTER_TYPE_POINT, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP, TEXTURE_ADDRESS_CLAMP}},
+        };
+        // clang-format on
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name                 = "Descriptor buffer test - signature 0";
+        PRSDesc.BindingIndex         = 0;
+        PRSDesc.Resources            = Resources;
+        PRSDesc.NumResources         = _countof(Resources);
+        PRSDesc.ImmutableSamplers    = ImmutableSamplers;
+        PRSDesc.NumImmutableSamplers = _countof(ImmutableSamplers);
+
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS[0]);
+        ASSERT_NE(pPRS[0], nullptr);
+    }
+    {
+        // clang-format off
+        const PipelineResourceDesc Resources[] =
+        {
+            {SHADER_TYPE_COMPUTE, "g_StaticTex",  1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_STATIC},
+            {SHADER_TYPE_COMPUTE, "cbMutable",    1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+            {SHADER_TYPE_COMPUTE, "g_DynamicTex", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        };
+        // clang-format on
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "Descriptor buffer test - signature 1";
+        PRSDesc.BindingIndex = 1;
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS[1]);
+        ASSERT_NE(pPRS[1], nullptr);
+    }
+
+    pPRS[0]->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "cbStatic")->Set(pStaticCB);
+    pPRS[1]->GetStaticVariableByName(SHADER_TYPE_COMPUTE, "g_StaticTex")->Set(pStaticTexSRV);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = HLSL::DescriptorBufferTest_CS.c_str();
+    ShaderCI.Desc           = {"Descriptor buffer test - CS", SHADER_TYPE_COMPUTE, true};
+
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = "Descriptor buffer test";
+
+    IPipelineResourceSignature* ppSignatures[] = {pPRS[0], pPRS[1]};
+    PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+    PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+    PSOCreateInfo.pCS                          = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRBs[NumPasses][2];
+    for (Uint32 pass = 0; pass < NumPasses; ++pass)
+    {
+        for (Uint32 s = 0; s < 2; ++s)
+        {
+            pPRS[s]->CreateShaderResourceBinding(&pSRBs[pass][s], true);
+            ASSERT_NE(pSRBs[pass][s], nullptr);
+        }
+        pSRBs[pass][0]->GetVariableByName(SHADER_TYPE_COMPUTE, "g_MutableTex")->Set(pMutableTexSRVs[pass]);
+        pSRBs[pass][0]->GetVariableByName(SHADER_TYPE_COMPUTE, "cbDynamic")->Set(pDynamicCB);
+        pSRBs[pass][1]->GetVariableByName(SHADER_TYPE_COMPUTE, "cbMutable")->Set(pMutableCBs[pass]);
+    }
+
+    pContext->SetPipelineState(pPSO);
+    for (Uint32 pass = 0; pass < NumPasses; ++pass)
+    {
+        // Dynamic variables are set right before the SRBs are committed, and the dynamic
+        // constant buffer is re-mapped before every dispatch, so that its offset changes.
+        pSRBs[pass][0]->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->Set(pOutputs[pass]->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+        pSRBs[pass][1]->GetVariableByName(SHADER_TYPE_COMPUTE, "g_DynamicTex")->Set(pDynamicTexSRVs[pass]);
+        {
+            MapHelper<float4> pData{pContext, pDynamicCB, MAP_WRITE, MAP_FLAG_DISCARD};
+            *pData = DynamicValues[pass];
+        }
+
+        pContext->CommitShaderResources(pSRBs[pass][0], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->CommitShaderResources(pSRBs[pass][1], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+    }
+
+    BufferDesc StagingDesc;
+    StagingDesc.Name           = "Descriptor buffer test - staging buffer";
+    StagingDesc.Size           = sizeof(float4) * NumOutputs * NumPasses;
+    StagingDesc.Usage          = USAGE_STAGING;
+    StagingDesc.CPUAccessFlags = CPU_ACCESS_READ;
+
+    RefCntAutoPtr<IBuffer> pStagingBuffer = pEnv->CreateBuffer(StagingDesc);
+    ASSERT_NE(pStagingBuffer, nullptr);
+    for (Uint32 pass = 0; pass < NumPasses; ++pass)
+    {
+        pContext->CopyBuffer(pOutputs[pass], 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION,
+                             pStagingBuffer, sizeof(float4) * NumOutputs * pass, sizeof(float4) * NumOutputs,
+                             RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+    pContext->WaitForIdle();
+
+    MapHelper<float4> MappedData{pContext, pStagingBuffer, MAP_READ, MAP_FLAG_DO_NOT_WAIT};
+    const float4*     pResults = MappedData;
+    ASSERT_NE(pResults, nullptr);
+    for (Uint32 pass = 0; pass < NumPasses; ++pass)
+    {
+        const float4* pPassResults = &pResults[NumOutputs * pass];
+
+        EXPECT_EQ(pPassResults[0], StaticValue) << "Pass " << pass << ": static constant buffer";
+        EXPECT_EQ(pPassResults[1], MutableValues[pass]) << "Pass " << pass << ": mutable constant buffer";
+        EXPECT_EQ(pPassResults[2], DynamicValues[pass]) << "Pass " << pass << ": dynamic constant buffer";
+        EXPECT_EQ(pPassResults[3], StaticTexel) << "Pass " << pass << ": static texture";
+        EXPECT_EQ(pPassResults[4], MutableTexels[pass]) << "Pass " << pass << ": mutable texture";
+        EXPECT_EQ(pPassResults[5], DynamicTexels[pass]) << "Pass " << pass << ": dynamic texture";
+    }
+}
+
+} // namespace
@@ -0,0 +1,298 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <vector>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace Diligent
+{
+namespace Testing
+{
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor = nullptr);
+}
+} // namespace Diligent
+
+namespace
+{
+
+namespace HLSL
+{
+
+// clang-format off
+const std::string DynamicHeapOverflowTest_PS{
+R"(
+cbuffer cbData0
+{
+    float4 g_Data0[NUM_ELEMENTS];
+}
+
+cbuffer cbData1
+{
+    float4 g_Data1[NUM_ELEMENTS];
+}
+
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float3 Color : COLOR;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    // Both buffers are mapped before every draw with the same value (x, 2x, 3x, Mode)
+    float4 Val0 = g_Data0[0];
+    float4 Val1 = g_Data0[NUM_ELEMENTS - 1];
+    float4 Val2 = g_Data1[0];
+    float4 Val3 = g_Data1[NUM_ELEMENTS - 1];
+
+    bool IsValid =
+        Val0.x > 0.0 && Val0.y == Val0.x * 2.0 && Val0.z == Val0.x * 3.0 &&
+        all(Val0 == Val1) && all(Val0 == Val2) && all(Val0 == Val3);
+
+    // In verification mode, valid draws leave the render target unchanged
+    if (Val0.w != 0.0 && IsValid)
+        discard;
+
+    return float4(PSIn.Color.rgb, 1.0) * (IsValid ? 1.0 : 0.0);
+}
+)"
+};
+// clang-format on
+
+} // namespace HLSL
+
+class VkDynamicHeapOverflowTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+        if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "This test is only for Vulkan device";
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        GPUTestingEnvironment::GetInstance()->Reset();
+    }
+
+    // Maps two dynamic constant buffers before every draw until the amount of dynamic data
+    // allocated in the frame exceeds the dynamic heap size several times, so that the buffers
+    // are allocated from overflow chunks. If Data1VarType is mutable, the second buffer is
+    // referenced by the static/mutable descriptor set of the SRB. Otherwise, both buffers are
+    // referenced by the dynamic set, which uses push descriptors at binding index 0 when
+    // DeviceFeaturesVk::PushDescriptor is enabled.
+    static void Render(Uint8 BindingIndex, SHADER_RESOURCE_VARIABLE_TYPE Data1VarType);
+};
+
+void VkDynamicHeapOverflowTest::Render(Uint8 BindingIndex, SHADER_RESOURCE_VARIABLE_TYPE Data1VarType)
+{
+    GPUTestingEnvironment* pEnv       = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice    = pEnv->GetDevice();
+    IDeviceContext*        pContext   = pEnv->GetDeviceContext();
+    ISwapChain*            pSwapChain = pEnv->GetSwapChain();
+
+    // maxUniformBufferRange is at least 16 KB
+    constexpr Uint32 NumElements = 1024;
+    constexpr Uint32 BufferSize  = NumElements * sizeof(float4);
+
+    // The testing environment uses the default dynamic heap size
+    const Uint32 DynamicHeapSize = EngineVkCreateInfo{}.DynamicHeapSize;
+    const Uint32 NumDraws        = DynamicHeapSize / BufferSize * 2;
+
+    RefCntAutoPtr<IBuffer> pData[2];
+    for (RefCntAutoPtr<IBuffer>& pCB : pData)
+    {
+        CreateUniformBuffer(pDevice, BufferSize, "Dynamic heap overflow test constants", &pCB);
+        ASSERT_NE(pCB, nullptr);
+    }
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Dynamic heap overflow test signature";
+    PRSDesc.BindingIndex = BindingIndex;
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_PIXEL, "cbData0", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_PIXEL, "cbData1", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, Data1VarType},
+    };
+    // clang-format on
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("NUM_ELEMENTS", NumElements);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Source = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        ShaderCI.Desc   = {"Dynamic heap overflow test - VS", SHADER_TYPE_VERTEX, true};
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Source = HLSL::DynamicHeapOverflowTest_PS.c_str();
+        ShaderCI.Desc   = {"Dynamic heap overflow test - PS", SHADER_TYPE_PIXEL, true};
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    const SwapChainDesc& SCDesc = pSwapChain->GetDesc();
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = "Dynamic heap overflow test";
+
+    IPipelineResourceSignature* ppSignatures[] = {pPRS};
+    PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+    PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+    GraphicsPipelineDesc& GraphicsPipeline        = PSOCreateInfo.GraphicsPipeline;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = SCDesc.ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbData0")->Set(pData[0]);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "cbData1")->Set(pData[1]);
+
+    static FastRandFloat rnd{0, 0, 1};
+    const float          ClearColor[] = {rnd(), rnd(), rnd(), rnd()};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(ppRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    auto WriteData = [&](Uint32 Draw, float Mode) {
+        const float  x = static_cast<float>(Draw + 1);
+        const float4 Value{x, x * 2, x * 3, Mode};
+        for (IBuffer* pCB : pData)
+        {
+            MapHelper<float4> pCBData{pContext, pCB, MAP_WRITE, MAP_FLAG_DISCARD};
+            pCBData[0]               = Value;
+            pCBData[NumElements - 1] = Value;
+        }
+    };
+
+    // Draw both triangles, then draw them again and again in verification mode:
+    // every draw that reads invalid data overwrites the triangle with black color.
+    for (Uint32 i = 0; i < NumDraws; ++i)
+    {
+        WriteData(i, i < 2 ? 0.f : 1.f);
+
+        DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+        DrawAttrs.StartVertexLocation = (i % 2) * 3;
+        pContext->Draw(DrawAttrs);
+    }
+
+    pSwapChain->Present();
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    Uint32 NumChunks = 0;
+    pDeviceVk->GetDynamicHeapChunkStats(NumChunks, nullptr);
+    std::vector<DynamicHeapChunkStatsVk> ChunkStats(NumChunks);
+    pDeviceVk->GetDynamicHeapChunkStats(NumChunks, ChunkStats.data());
+    ASSERT_EQ(NumChunks, ChunkStats.size());
+    // The data mapped in this frame does not fit into the primary chunk
+    ASSERT_GT(NumChunks, 1u);
+    EXPECT_EQ(ChunkStats[0].Index, 0u);
+    EXPECT_EQ(ChunkStats[0].Size, DynamicHeapSize);
+
+    Uint64 OverflowPeakUsedSize = 0;
+    for (Uint32 i = 1; i < NumChunks; ++i)
+    {
+        EXPECT_EQ(ChunkStats[i].Index, i);
+        OverflowPeakUsedSize += ChunkStats[i].PeakUsedSize;
+    }
+    EXPECT_GT(OverflowPeakUsedSize, 0u);
+}
+
+TEST_F(VkDynamicHeapOverflowTest, StaticAndDynamicSets)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    Render(0, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    Render(1, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+}
+
+TEST_F(VkDynamicHeapOverflowTest, DynamicSet)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    // Binding index 0: push descriptors, if enabled
+    Render(0, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+    // Binding index 1: descriptor set from the pool
+    Render(1, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+}
+
+} // namespace
@@ -0,0 +1,141 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class VkMemoryBudgetTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+        if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "This test is only for Vulkan device";
+        }
+    }
+
+    static RefCntAutoPtr<IBuffer> CreateDeviceLocalBuffer()
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name      = "Memory budget test buffer";
+        BuffDesc.Size      = 1 << 20;
+        BuffDesc.BindFlags = BIND_VERTEX_BUFFER;
+        BuffDesc.Usage     = USAGE_DEFAULT;
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        GPUTestingEnvironment::GetInstance()->GetDevice()->CreateBuffer(BuffDesc, nullptr, &pBuffer);
+        return pBuffer;
+    }
+};
+
+TEST_F(VkMemoryBudgetTest, GetMemoryBudget)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{GPUTestingEnvironment::GetInstance()->GetDevice(), IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateDeviceLocalBuffer();
+    ASSERT_NE(pBuffer, nullptr);
+
+    MemoryBudgetVk Budget;
+    pDeviceVk->GetMemoryBudget(Budget);
+    ASSERT_GT(Budget.NumHeaps, 0u);
+    ASSERT_LE(Budget.NumHeaps, MAX_MEMORY_HEAPS_VK);
+
+    Uint64 TotalEngineAllocated = 0;
+    for (Uint32 i = 0; i < Budget.NumHeaps; ++i)
+    {
+        const MemoryHeapBudgetVk& Heap = Budget.Heaps[i];
+        EXPECT_GT(Heap.Size, 0u);
+        EXPECT_GT(Heap.Budget, 0u);
+        if (!Budget.DriverReported)
+        {
+            EXPECT_LE(Heap.Budget, Heap.Size);
+            EXPECT_EQ(Heap.Usage, Heap.EngineAllocated);
+        }
+        TotalEngineAllocated += Heap.EngineAllocated;
+    }
+    EXPECT_GE(TotalEngineAllocated, pBuffer->GetDesc().Size);
+}
+
+struct BudgetCallbackData
+{
+    Uint32 NumCalls    = 0;
+    Uint32 HeapMask    = 0;
+    bool   ValidBudget = true;
+};
+
+void DILIGENT_CALL_TYPE OnMemoryBudget(Uint32 HeapIndex, const MemoryHeapBudgetVk* pBudget, void* pUserData)
+{
+    BudgetCallbackData& Data = *static_cast<BudgetCallbackData*>(pUserData);
+    ++Data.NumCalls;
+    Data.HeapMask |= 1u << HeapIndex;
+    if (pBudget == nullptr || pBudget->Budget == 0 || pBudget->Usage == 0)
+        Data.ValidBudget = false;
+}
+
+TEST_F(VkMemoryBudgetTest, BudgetCallback)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{GPUTestingEnvironment::GetInstance()->GetDevice(), IID_RenderDeviceVk};
+    ASSERT_NE(pDeviceVk, nullptr);
+
+    RefCntAutoPtr<IBuffer> pBuffer = CreateDeviceLocalBuffer();
+    ASSERT_NE(pBuffer, nullptr);
+
+    // Use a tiny threshold so that the callback is invoked for every heap the engine allocates memory from
+    BudgetCallbackData Data;
+    pDeviceVk->SetMemoryBudgetCallback(OnMemoryBudget, &Data, 1e-6f);
+
+    pDeviceVk->ReleaseStaleResources();
+    EXPECT_GT(Data.NumCalls, 0u);
+    EXPECT_TRUE(Data.ValidBudget);
+
+    // The callback must not be invoked again while the heap usage stays above the threshold
+    const Uint32 NumCalls = Data.NumCalls;
+    pDeviceVk->ReleaseStaleResources();
+    EXPECT_EQ(Data.NumCalls, NumCalls);
+
+    pDeviceVk->SetMemoryBudgetCallback(nullptr, nullptr, 1.f);
+    pDeviceVk->ReleaseStaleResources();
+    EXPECT_EQ(Data.NumCalls, NumCalls);
+}
+
+} // namespace
@@ -0,0 +1,407 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+#include "PipelineStateVk.h"
+#include "ShaderMacroHelper.hpp"
+#include "FastRand.hpp"
+
+#include "volk.h"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace Diligent
+{
+namespace Testing
+{
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor = nullptr);
+}
+} // namespace Diligent
+
+namespace
+{
+
+namespace HLSL
+{
+
+// clang-format off
+const std::string PipelineLibraryTest_PS{
+R"(
+Texture2D    g_Tex;
+SamplerState g_Tex_sampler;
+
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float3 Color : COLOR;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    // The result depends on the address mode of the immutable sampler, which is a part of the pipeline layout
+    float4 TexVal = g_Tex.SampleLevel(g_Tex_sampler, float2(1.25, 0.5), 0);
+    return float4(PSIn.Color.rgb, 1.0) * (all(TexVal == TEX_REF) ? 1.0 : 0.0);
+}
+)"
+};
+// clang-format on
+
+} // namespace HLSL
+
+// 2x1 texture: red texel followed by green texel
+constexpr Uint32 TexData[] = {0xFF0000FFu, 0xFF00FF00u};
+
+// Sampling at u = 1.25 returns the second texel with clamp addressing and the first one with wrap addressing
+const float4 ClampTexRef{0, 1, 0, 1};
+const float4 WrapTexRef{1, 0, 0, 1};
+
+class VkPipelineLibraryTest : public ::testing::Test
+{
+protected:
+    enum class LINK_MODE
+    {
+        // Pipelines are created without libraries
+        Monolithic,
+
+        // Pipelines are linked from libraries with link-time optimization
+        Optimized,
+
+        // Pipelines are fast-linked, and optimized pipelines are linked in the background
+        FastLink
+    };
+
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+        IRenderDevice*         pDevice = pEnv->GetDevice();
+        if (pDevice->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "This test is only for Vulkan device";
+        }
+
+        RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+        DeviceFeaturesVk               FeaturesVk;
+        pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+
+        // Which path is used is determined by the device, run the tests with --Features.GraphicsPipelineLibrary
+        // and --Features.AsyncShaderCompilation set to On and Off to cover all paths.
+        sm_LinkMode = LINK_MODE::Monolithic;
+        if (FeaturesVk.GraphicsPipelineLibrary == DEVICE_FEATURE_STATE_ENABLED)
+        {
+            VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT GPLProps{};
+            GPLProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT;
+
+            VkPhysicalDeviceProperties2 Props2{};
+            Props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+            Props2.pNext = &GPLProps;
+            vkGetPhysicalDeviceProperties2(pDeviceVk->GetVkPhysicalDevice(), &Props2);
+
+            sm_LinkMode = (pDevice->GetShaderCompilationThreadPool() != nullptr && GPLProps.graphicsPipelineLibraryFastLinking != VK_FALSE) ?
+                LINK_MODE::FastLink :
+                LINK_MODE::Optimized;
+        }
+
+        static constexpr const char* LinkModeNames[] = {
+            "monolithic pipelines",
+            "pipelines linked from libraries with link-time optimization",
+            "fast-linked pipelines, optimized pipelines are linked in the background",
+        };
+        LOG_INFO_MESSAGE("Pipeline library test mode: ", LinkModeNames[static_cast<int>(sm_LinkMode)]);
+    }
+
+    static void TearDownTestSuite()
+    {
+        GPUTestingEnvironment::GetInstance()->Reset();
+    }
+
+    static RefCntAutoPtr<IPipelineResourceSignature> CreateSignature(const char* Name, TEXTURE_ADDRESS_MODE AddressMode);
+
+    static RefCntAutoPtr<IPipelineState> CreatePSO(const char*                 Name,
+                                                   IPipelineResourceSignature* pSignature,
+                                                   const float4&               TexRef,
+                                                   PSO_CREATE_FLAGS            Flags       = PSO_CREATE_FLAG_NONE,
+                                                   bool                        EnableBlend = false);
+
+    // Renders two triangles with the pipeline and compares the result with the reference image
+    static void Render(IPipelineState* pPSO, IPipelineResourceSignature* pSignature);
+
+    // Waits until the pipeline switches from the fast-linked pipeline to the optimized one
+    static bool WaitForOptimizedPipeline(IPipelineState* pPSO, VkPipeline vkFastLinkedPipeline);
+
+    static LINK_MODE sm_LinkMode;
+};
+
+VkPipelineLibraryTest::LINK_MODE VkPipelineLibraryTest::sm_LinkMode = VkPipelineLibraryTest::LINK_MODE::Monolithic;
+
+RefCntAutoPtr<IPipelineResourceSignature> VkPipelineLibraryTest::CreateSignature(const char* Name, TEXTURE_ADDRESS_MODE AddressMode)
+{
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_Tex", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+    };
+    const ImmutableSamplerDesc ImmutableSamplers[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_Tex", SamplerDesc{FILTER_TYPE_POINT, FILTER_TYPE_POINT, FILTER_TYPE_POINT, AddressMode, AddressMode, AddressMode}},
+    };
+    // clang-format on
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name                       = Name;
+    PRSDesc.Resources                  = Resources;
+    PRSDesc.NumResources               = _countof(Resources);
+    PRSDesc.ImmutableSamplers          = ImmutableSamplers;
+    PRSDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+    PRSDesc.UseCombinedTextureSamplers = true;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    GPUTestingEnvironment::GetInstance()->GetDevice()->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    return pPRS;
+}
+
+RefCntAutoPtr<IPipelineState> VkPipelineLibraryTest::CreatePSO(const char*                 Name,
+                                                               IPipelineResourceSignature* pSignature,
+                                                               const float4&               TexRef,
+                                                               PSO_CREATE_FLAGS            Flags,
+                                                               bool                        EnableBlend)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("TEX_REF", TexRef);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Source = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        ShaderCI.Desc   = {"Pipeline library test - VS", SHADER_TYPE_VERTEX, true};
+        pDevice->CreateShader(ShaderCI, &pVS);
+        if (!pVS)
+            return {};
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Source = HLSL::PipelineLibraryTest_PS.c_str();
+        ShaderCI.Desc   = {"Pipeline library test - PS", SHADER_TYPE_PIXEL, true};
+        pDevice->CreateShader(ShaderCI, &pPS);
+        if (!pPS)
+            return {};
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = Name;
+    PSOCreateInfo.Flags        = Flags;
+
+    IPipelineResourceSignature* ppSignatures[] = {pSignature};
+    PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+    PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+    GraphicsPipelineDesc& GraphicsPipeline        = PSOCreateInfo.GraphicsPipeline;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pEnv->GetSwapChain()->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+    if (EnableBlend)
+    {
+        // Produces the same result as no blending, but the fragment output library is different
+        RenderTargetBlendDesc& RT0 = GraphicsPipeline.BlendDesc.RenderTargets[0];
+        RT0.BlendEnable            = True;
+        RT0.SrcBlend               = BLEND_FACTOR_ONE;
+        RT0.DestBlend              = BLEND_FACTOR_ZERO;
+        RT0.SrcBlendAlpha          = BLEND_FACTOR_ONE;
+        RT0.DestBlendAlpha         = BLEND_FACTOR_ZERO;
+    }
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    return pPSO;
+}
+
+void VkPipelineLibraryTest::Render(IPipelineState* pPSO, IPipelineResourceSignature* pSignature)
+{
+    GPUTestingEnvironment* pEnv       = GPUTestingEnvironment::GetInstance();
+    IDeviceContext*        pContext   = pEnv->GetDeviceContext();
+    ISwapChain*            pSwapChain = pEnv->GetSwapChain();
+
+    RefCntAutoPtr<ITexture> pTex = pEnv->CreateTexture("Pipeline library test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, 2, 1, TexData);
+    ASSERT_NE(pTex, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pSignature->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Tex")->Set(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+
+    static FastRandFloat rnd{0, 0, 1};
+    const float          ClearColor[] = {rnd(), rnd(), rnd(), rnd()};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(ppRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->CommitShaderResources(pSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->Draw(DrawAttribs{6, DRAW_FLAG_VERIFY_ALL});
+
+    pSwapChain->Present();
+}
+
+bool VkPipelineLibraryTest::WaitForOptimizedPipeline(IPipelineState* pPSO, VkPipeline vkFastLinkedPipeline)
+{
+    RefCntAutoPtr<IPipelineStateVk> pPSOVk{pPSO, IID_PipelineStateVk};
+
+    const auto StartTime = std::chrono::steady_clock::now();
+    while (pPSOVk->GetVkPipeline() == vkFastLinkedPipeline)
+    {
+        if (std::chrono::steady_clock::now() - StartTime > std::chrono::seconds{60})
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return true;
+}
+
+// Pipelines that share some of the state reuse the libraries. Libraries must not be shared
+// between pipelines whose layouts differ, even if everything else is the same.
+TEST_F(VkPipelineLibraryTest, SharedLibraries)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    // Two separately created signatures with the same description produce identical layouts
+    RefCntAutoPtr<IPipelineResourceSignature> pClampPRS0 = CreateSignature("Pipeline library test - clamp 0", TEXTURE_ADDRESS_CLAMP);
+    ASSERT_NE(pClampPRS0, nullptr);
+    RefCntAutoPtr<IPipelineResourceSignature> pClampPRS1 = CreateSignature("Pipeline library test - clamp 1", TEXTURE_ADDRESS_CLAMP);
+    ASSERT_NE(pClampPRS1, nullptr);
+    // The immutable sampler is a part of the descriptor set layout
+    RefCntAutoPtr<IPipelineResourceSignature> pWrapPRS = CreateSignature("Pipeline library test - wrap", TEXTURE_ADDRESS_WRAP);
+    ASSERT_NE(pWrapPRS, nullptr);
+
+    RefCntAutoPtr<IPipelineState> pClampPSO0 = CreatePSO("Pipeline library test - clamp 0", pClampPRS0, ClampTexRef);
+    ASSERT_NE(pClampPSO0, nullptr);
+    Render(pClampPSO0, pClampPRS0);
+
+    RefCntAutoPtr<IPipelineState> pClampPSO1 = CreatePSO("Pipeline library test - clamp 1", pClampPRS1, ClampTexRef);
+    ASSERT_NE(pClampPSO1, nullptr);
+    Render(pClampPSO1, pClampPRS1);
+
+    // Only the fragment output library is different
+    RefCntAutoPtr<IPipelineState> pBlendPSO = CreatePSO("Pipeline library test - blend", pClampPRS0, ClampTexRef, PSO_CREATE_FLAG_NONE, /*EnableBlend = */ true);
+    ASSERT_NE(pBlendPSO, nullptr);
+    Render(pBlendPSO, pClampPRS0);
+
+    RefCntAutoPtr<IPipelineState> pWrapPSO = CreatePSO("Pipeline library test - wrap", pWrapPRS, WrapTexRef);
+    ASSERT_NE(pWrapPSO, nullptr);
+    Render(pWrapPSO, pWrapPRS);
+
+    // Libraries outlive the pipelines they were created for
+    pClampPSO0.Release();
+    pClampPSO1.Release();
+    RefCntAutoPtr<IPipelineState> pClampPSO2 = CreatePSO("Pipeline library test - clamp 2", pClampPRS1, ClampTexRef);
+    ASSERT_NE(pClampPSO2, nullptr);
+    Render(pClampPSO2, pClampPRS1);
+}
+
+TEST_F(VkPipelineLibraryTest, BackgroundLink)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS = CreateSignature("Pipeline library test", TEXTURE_ADDRESS_CLAMP);
+    ASSERT_NE(pPRS, nullptr);
+
+    for (PSO_CREATE_FLAGS Flags : {PSO_CREATE_FLAG_NONE, PSO_CREATE_FLAG_ASYNCHRONOUS})
+    {
+        RefCntAutoPtr<IPipelineState> pPSO = CreatePSO("Pipeline library test - background link", pPRS, ClampTexRef, Flags);
+        ASSERT_NE(pPSO, nullptr);
+        ASSERT_EQ(pPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+
+        RefCntAutoPtr<IPipelineStateVk> pPSOVk{pPSO, IID_PipelineStateVk};
+        ASSERT_NE(pPSOVk, nullptr);
+        const VkPipeline vkInitialPipeline = pPSOVk->GetVkPipeline();
+        ASSERT_NE(vkInitialPipeline, VK_NULL_HANDLE);
+
+        // Render with the fast-linked pipeline, unless the optimized one is already available
+        Render(pPSO, pPRS);
+
+        if (sm_LinkMode == LINK_MODE::FastLink)
+        {
+            EXPECT_TRUE(WaitForOptimizedPipeline(pPSO, vkInitialPipeline)) << "The optimized pipeline has not been linked";
+        }
+        else
+        {
+            // There is no background link, so the pipeline never changes
+            EXPECT_EQ(pPSOVk->GetVkPipeline(), vkInitialPipeline);
+        }
+
+        Render(pPSO, pPRS);
+    }
+}
+
+// Pipelines are released while their optimized pipelines are being linked in the background
+TEST_F(VkPipelineLibraryTest, ReleaseWhileLinkPending)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS = CreateSignature("Pipeline library test", TEXTURE_ADDRESS_CLAMP);
+    ASSERT_NE(pPRS, nullptr);
+
+    for (PSO_CREATE_FLAGS Flags : {PSO_CREATE_FLAG_NONE, PSO_CREATE_FLAG_ASYNCHRONOUS})
+    {
+        for (Uint32 i = 0; i < 8; ++i)
+        {
+            RefCntAutoPtr<IPipelineState> pPSO = CreatePSO("Pipeline library test - release", pPRS, ClampTexRef, Flags);
+            ASSERT_NE(pPSO, nullptr);
+            // The pipeline is released right away without waiting for the asynchronous
+            // creation or the background link to complete
+        }
+    }
+
+    // The libraries created by the released pipelines are still usable
+    RefCntAutoPtr<IPipelineState> pPSO = CreatePSO("Pipeline library test - after release", pPRS, ClampTexRef);
+    ASSERT_NE(pPSO, nullptr);
+    Render(pPSO, pPRS);
+}
+
+} // namespace
@@ -0,0 +1,375 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <algorithm>
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "PipelineStateCacheVk.h"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Size of the header that SaveToStream() writes before the Vulkan cache data
+constexpr size_t CacheFileHeaderSize = 56;
+
+class VkPipelineStateCacheTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+        if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "This test is only for Vulkan device";
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        GPUTestingEnvironment::GetInstance()->Reset();
+    }
+
+    static RefCntAutoPtr<IPipelineStateCacheVk> CreateCache(const char* Name, const IDataBlob* pData = nullptr)
+    {
+        PipelineStateCacheCreateInfo CacheCI;
+        CacheCI.Desc.Name = Name;
+        CacheCI.Desc.Mode = PSO_CACHE_MODE_LOAD | PSO_CACHE_MODE_STORE;
+        if (pData != nullptr)
+        {
+            CacheCI.pCacheData    = pData->GetConstDataPtr();
+            CacheCI.CacheDataSize = static_cast<Uint32>(pData->GetSize());
+        }
+
+        RefCntAutoPtr<IPipelineStateCache> pCache;
+        GPUTestingEnvironment::GetInstance()->GetDevice()->CreatePipelineStateCache(CacheCI, &pCache);
+        return RefCntAutoPtr<IPipelineStateCacheVk>{pCache, IID_PipelineStateCacheVk};
+    }
+
+    // Creates a compute pipeline that is unique for the given variant
+    static RefCntAutoPtr<IPipelineState> CreateComputePSO(IPipelineStateCache* pCache, Uint32 Variant)
+    {
+        IRenderDevice* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+
+        const std::string Source = "RWBuffer<uint> g_Output;\n"
+                                   "[numthreads(1, 1, 1)]\n"
+                                   "void main()\n"
+                                   "{\n"
+                                   "    g_Output[0] = " +
+            std::to_string(Variant) + "u;\n}\n";
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = GPUTestingEnvironment::GetInstance()->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.EntryPoint     = "main";
+        ShaderCI.Source         = Source.c_str();
+        ShaderCI.Desc           = {"Pipeline state cache test - CS", SHADER_TYPE_COMPUTE, true};
+
+        RefCntAutoPtr<IShader> pCS;
+        pDevice->CreateShader(ShaderCI, &pCS);
+        if (!pCS)
+            return {};
+
+        ComputePipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.PSODesc.Name = "Pipeline state cache test";
+        PSOCreateInfo.pCS          = pCS;
+        PSOCreateInfo.pPSOCache    = pCache;
+
+        RefCntAutoPtr<IPipelineState> pPSO;
+        pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+        return pPSO;
+    }
+
+    static RefCntAutoPtr<IDataBlob> GetData(IPipelineStateCache* pCache)
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        pCache->GetData(&pData);
+        return pData;
+    }
+
+    static RefCntAutoPtr<IDataBlob> SaveToBlob(IPipelineStateCacheVk* pCache)
+    {
+        RefCntAutoPtr<DataBlobImpl>     pData   = DataBlobImpl::Create();
+        RefCntAutoPtr<MemoryFileStream> pStream = MemoryFileStream::Create(pData);
+        if (!pCache->SaveToStream(pStream))
+            return {};
+        return RefCntAutoPtr<IDataBlob>{pData};
+    }
+
+    static bool LoadFromBlob(IPipelineStateCacheVk* pCache, const IDataBlob* pData)
+    {
+        // Load from a copy so that the source data is not modified
+        RefCntAutoPtr<DataBlobImpl>     pCopy   = DataBlobImpl::Create(pData->GetSize(), pData->GetConstDataPtr());
+        RefCntAutoPtr<MemoryFileStream> pStream = MemoryFileStream::Create(pCopy);
+        return pCache->LoadFromStream(pStream);
+    }
+
+    static bool IsEqual(const IDataBlob* pData0, const IDataBlob* pData1)
+    {
+        return pData0->GetSize() == pData1->GetSize() &&
+            std::memcmp(pData0->GetConstDataPtr(), pData1->GetConstDataPtr(), pData0->GetSize()) == 0;
+    }
+
+    // Returns the size of the data of an empty cache. The data of a cache that contains pipelines is larger,
+    // unless the driver does not store pipelines in the cache at all.
+    static size_t GetEmptyCacheDataSize()
+    {
+        RefCntAutoPtr<IPipelineStateCacheVk> pCache = CreateCache("Empty cache");
+        if (!pCache)
+            return 0;
+        RefCntAutoPtr<IDataBlob> pData = GetData(pCache);
+        return pData ? pData->GetSize() : 0;
+    }
+};
+
+TEST_F(VkPipelineStateCacheTest, SaveAndLoad)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IPipelineStateCacheVk> pSrcCache = CreateCache("Source cache");
+    ASSERT_NE(pSrcCache, nullptr);
+
+    for (Uint32 i = 0; i < 4; ++i)
+        ASSERT_NE(CreateComputePSO(pSrcCache, i), nullptr);
+
+    const size_t             EmptySize = GetEmptyCacheDataSize();
+    RefCntAutoPtr<IDataBlob> pSrcData  = GetData(pSrcCache);
+    ASSERT_NE(pSrcData, nullptr);
+    if (pSrcData->GetSize() <= EmptySize)
+        GTEST_SKIP() << "The driver does not store pipelines in the pipeline cache";
+
+    RefCntAutoPtr<IDataBlob> pSaved = SaveToBlob(pSrcCache);
+    ASSERT_NE(pSaved, nullptr);
+    EXPECT_EQ(pSaved->GetSize(), CacheFileHeaderSize + pSrcData->GetSize());
+
+    // Load the data into an existing cache
+    {
+        RefCntAutoPtr<IPipelineStateCacheVk> pCache = CreateCache("Loaded cache");
+        ASSERT_NE(pCache, nullptr);
+        EXPECT_TRUE(LoadFromBlob(pCache, pSaved));
+
+        RefCntAutoPtr<IDataBlob> pData = GetData(pCache);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_GT(pData->GetSize(), EmptySize);
+    }
+
+    // Create a cache from the saved data
+    {
+        RefCntAutoPtr<IPipelineStateCacheVk> pCache = CreateCache("Cache created from saved data", pSaved);
+        ASSERT_NE(pCache, nullptr);
+
+        RefCntAutoPtr<IDataBlob> pData = GetData(pCache);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_GT(pData->GetSize(), EmptySize);
+
+        // Pipelines can be created with the loaded cache
+        EXPECT_NE(CreateComputePSO(pCache, 0), nullptr);
+    }
+}
+
+TEST_F(VkPipelineStateCacheTest, CorruptedData)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    RefCntAutoPtr<IPipelineStateCacheVk> pSrcCache = CreateCache("Source cache");
+    ASSERT_NE(pSrcCache, nullptr);
+    ASSERT_NE(CreateComputePSO(pSrcCache, 0), nullptr);
+
+    RefCntAutoPtr<IDataBlob> pSaved = SaveToBlob(pSrcCache);
+    ASSERT_NE(pSaved, nullptr);
+    ASSERT_GT(pSaved->GetSize(), CacheFileHeaderSize);
+
+    struct CorruptionInfo
+    {
+        const char* Name;
+        size_t      Offset; // Offset of the byte to corrupt
+        size_t      Size;   // Size of the corrupted data
+    };
+    const size_t         SavedSize = pSaved->GetSize();
+    const CorruptionInfo Corruptions[] = {
+        {"Magic", 0, SavedSize},
+        {"Version", 4, SavedSize},
+        {"Vendor ID", 8, SavedSize},
+        {"Device ID", 12, SavedSize},
+        {"Driver version", 16, SavedSize},
+        {"Pipeline cache UUID", 24, SavedSize},
+        {"Data size", 40, SavedSize},
+        {"Data hash", 48, SavedSize},
+        {"Vulkan cache data", CacheFileHeaderSize + (SavedSize - CacheFileHeaderSize) / 2, SavedSize},
+        {"Truncated data", SavedSize, SavedSize - 1},
+        {"Truncated header", SavedSize, CacheFileHeaderSize - 1},
+    };
+
+    for (const CorruptionInfo& Corruption : Corruptions)
+    {
+        RefCntAutoPtr<DataBlobImpl> pCorrupted = DataBlobImpl::Create(Corruption.Size, pSaved->GetConstDataPtr());
+        if (Corruption.Offset < Corruption.Size)
+            pCorrupted->GetDataPtr<Uint8>()[Corruption.Offset] ^= 0x5A;
+
+        // The cache must be left unchanged
+        RefCntAutoPtr<IPipelineStateCacheVk> pCache = CreateCache("Cache with corrupted data");
+        ASSERT_NE(pCache, nullptr);
+
+        RefCntAutoPtr<IDataBlob> pDataBefore = GetData(pCache);
+        ASSERT_NE(pDataBefore, nullptr);
+
+        EXPECT_FALSE(LoadFromBlob(pCache, pCorrupted)) << Corruption.Name;
+
+        RefCntAutoPtr<IDataBlob> pDataAfter = GetData(pCache);
+        ASSERT_NE(pDataAfter, nullptr);
+        EXPECT_TRUE(IsEqual(pDataBefore, pDataAfter)) << Corruption.Name;
+
+        // Corrupted data passed at creation must be ignored
+        RefCntAutoPtr<IPipelineStateCacheVk> pCache2 = CreateCache("Cache created from corrupted data", pCorrupted);
+        ASSERT_NE(pCache2, nullptr) << Corruption.Name;
+
+        RefCntAutoPtr<IDataBlob> pData2 = GetData(pCache2);
+        ASSERT_NE(pData2, nullptr);
+        EXPECT_TRUE(IsEqual(pDataBefore, pData2)) << Corruption.Name;
+    }
+}
+
+// Several threads create pipelines with their own caches while the caches are repeatedly merged into
+// a destination cache that is also used for pipeline creation by another thread.
+TEST_F(VkPipelineStateCacheTest, MergePerThreadCaches)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    constexpr Uint32 NumThreads          = 4;
+    constexpr Uint32 NumPSOsPerThread    = 4;
+    constexpr Uint32 DstCacheVariantBase = NumThreads * NumPSOsPerThread;
+
+    RefCntAutoPtr<IPipelineStateCacheVk> pDstCache = CreateCache("Merged cache");
+    ASSERT_NE(pDstCache, nullptr);
+
+    std::vector<RefCntAutoPtr<IPipelineStateCacheVk>> ThreadCaches(NumThreads);
+    std::vector<IPipelineStateCache*>                 ppThreadCaches(NumThreads);
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        ThreadCaches[t] = CreateCache("Per-thread cache");
+        ASSERT_NE(ThreadCaches[t], nullptr);
+        ppThreadCaches[t] = ThreadCaches[t];
+    }
+
+    RefCntAutoPtr<IDataBlob> pEmptyData = GetData(pDstCache);
+    ASSERT_NE(pEmptyData, nullptr);
+
+    // Null and self entries are skipped
+    {
+        IPipelineStateCache* ppSrcCaches[] = {nullptr, pDstCache};
+        EXPECT_TRUE(pDstCache->Merge(_countof(ppSrcCaches), ppSrcCaches));
+        RefCntAutoPtr<IDataBlob> pData = GetData(pDstCache);
+        ASSERT_NE(pData, nullptr);
+        EXPECT_TRUE(IsEqual(pEmptyData, pData));
+    }
+
+    std::atomic<Uint32> NumThreadsDone{0};
+    std::atomic<Uint32> NumFailedPSOs{0};
+
+    std::vector<std::thread> Threads;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back(
+            [&](Uint32 ThreadId) //
+            {
+                for (Uint32 i = 0; i < NumPSOsPerThread; ++i)
+                {
+                    if (!CreateComputePSO(ThreadCaches[ThreadId], ThreadId * NumPSOsPerThread + i))
+                        NumFailedPSOs.fetch_add(1);
+                }
+                NumThreadsDone.fetch_add(1);
+            },
+            t);
+    }
+
+    // The destination cache is used for pipeline creation while other caches are merged into it
+    Threads.emplace_back(
+        [&]() //
+        {
+            for (Uint32 i = 0; i < NumPSOsPerThread; ++i)
+            {
+                if (!CreateComputePSO(pDstCache, DstCacheVariantBase + i))
+                    NumFailedPSOs.fetch_add(1);
+            }
+        });
+
+    while (NumThreadsDone.load() < NumThreads)
+    {
+        EXPECT_TRUE(pDstCache->Merge(NumThreads, ppThreadCaches.data()));
+        std::this_thread::yield();
+    }
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+    EXPECT_EQ(NumFailedPSOs.load(), 0u);
+
+    // Merge all caches, including duplicates, after all pipelines have been created
+    std::vector<IPipelineStateCache*> ppSrcCaches = ppThreadCaches;
+    ppSrcCaches.push_back(ppThreadCaches[0]);
+    EXPECT_TRUE(pDstCache->Merge(static_cast<Uint32>(ppSrcCaches.size()), ppSrcCaches.data()));
+
+    RefCntAutoPtr<IDataBlob> pMergedData = GetData(pDstCache);
+    ASSERT_NE(pMergedData, nullptr);
+
+    size_t MaxThreadCacheSize = 0;
+    for (Uint32 t = 0; t < NumThreads; ++t)
+    {
+        RefCntAutoPtr<IDataBlob> pData = GetData(ThreadCaches[t]);
+        ASSERT_NE(pData, nullptr);
+        MaxThreadCacheSize = std::max(MaxThreadCacheSize, pData->GetSize());
+    }
+    if (MaxThreadCacheSize <= pEmptyData->GetSize())
+        GTEST_SKIP() << "The driver does not store pipelines in the pipeline cache";
+
+    EXPECT_GT(pMergedData->GetSize(), MaxThreadCacheSize);
+
+    // The merged cache can be saved and loaded
+    RefCntAutoPtr<IDataBlob> pSaved = SaveToBlob(pDstCache);
+    ASSERT_NE(pSaved, nullptr);
+
+    RefCntAutoPtr<IPipelineStateCacheVk> pLoadedCache = CreateCache("Loaded merged cache");
+    ASSERT_NE(pLoadedCache, nullptr);
+    EXPECT_TRUE(LoadFromBlob(pLoadedCache, pSaved));
+
+    RefCntAutoPtr<IDataBlob> pLoadedData = GetData(pLoadedCache);
+    ASSERT_NE(pLoadedData, nullptr);
+    EXPECT_GE(pLoadedData->GetSize(), MaxThreadCacheSize);
+}
+
+} // namespace
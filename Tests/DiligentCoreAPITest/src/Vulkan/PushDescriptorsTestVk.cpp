@@ -0,0 +1,309 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "Vulkan/TestingEnvironmentVk.hpp"
+
+#include "RenderDeviceVk.h"
+#include "DeviceContextVk.h"
+#include "GraphicsUtilities.h"
+#include "MapHelper.hpp"
+#include "ShaderMacroHelper.hpp"
+#include "FastRand.hpp"
+
+#include "gtest/gtest.h"
+
+#include "InlineShaders/DrawCommandTestHLSL.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace Diligent
+{
+namespace Testing
+{
+void RenderDrawCommandReference(ISwapChain* pSwapChain, const float* pClearColor = nullptr);
+}
+} // namespace Diligent
+
+namespace
+{
+
+namespace HLSL
+{
+
+// clang-format off
+const std::string PushDescriptorsTest_PS{
+R"(
+cbuffer cbConstants
+{
+    float4 g_Value;
+}
+
+Texture2D    g_Tex;
+SamplerState g_Tex_sampler;
+
+float4 CheckValue(float4 Val, float4 Expected)
+{
+    return float4(Val.x == Expected.x ? 1.0 : 0.0,
+                  Val.y == Expected.y ? 1.0 : 0.0,
+                  Val.z == Expected.z ? 1.0 : 0.0,
+                  Val.w == Expected.w ? 1.0 : 0.0);
+}
+
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float3 Color : COLOR;
+};
+
+float4 main(in PSInput PSIn) : SV_Target
+{
+    // The left triangle is drawn with the first constant buffer value, the right one - with the second
+    float4 Expected = PSIn.Pos.x < RT_HALF_WIDTH ? VALUE_REF0 : VALUE_REF1;
+    float4 TexVal   = g_Tex.SampleLevel(g_Tex_sampler, float2(0.5, 0.5), 0);
+    return float4(PSIn.Color.rgb, 1.0) * CheckValue(g_Value, Expected) * CheckValue(TexVal, TEX_REF);
+}
+)"
+};
+// clang-format on
+
+} // namespace HLSL
+
+class VkPushDescriptorsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv = GPUTestingEnvironment::GetInstance();
+        if (pEnv->GetDevice()->GetDeviceInfo().Type != RENDER_DEVICE_TYPE_VULKAN)
+        {
+            GTEST_SKIP() << "This test is only for Vulkan device";
+        }
+
+        RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pEnv->GetDevice(), IID_RenderDeviceVk};
+        DeviceFeaturesVk               FeaturesVk;
+        pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+        if (FeaturesVk.PushDescriptor != DEVICE_FEATURE_STATE_ENABLED)
+        {
+            // The test is still meaningful as both signatures then use descriptor sets
+            LOG_INFO_MESSAGE("VK_KHR_push_descriptor is not enabled: all signatures will use descriptor sets");
+        }
+    }
+
+    static void TearDownTestSuite()
+    {
+        GPUTestingEnvironment::GetInstance()->Reset();
+    }
+
+    // Renders two triangles using the signature with the given binding index.
+    // A signature at binding index 0 that only contains dynamic variables is committed
+    // through push descriptors when DeviceFeaturesVk::PushDescriptor is enabled;
+    // a signature at any other index always uses a descriptor set from the pool.
+    // If SwitchSRB is false, the same dynamic constant buffer is re-mapped between the draws,
+    // so that only its dynamic offset changes. Otherwise, the second draw uses another SRB.
+    static void Render(Uint8 BindingIndex, bool SwitchSRB);
+};
+
+void VkPushDescriptorsTest::Render(Uint8 BindingIndex, bool SwitchSRB)
+{
+    GPUTestingEnvironment* pEnv       = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice    = pEnv->GetDevice();
+    IDeviceContext*        pContext   = pEnv->GetDeviceContext();
+    ISwapChain*            pSwapChain = pEnv->GetSwapChain();
+
+    const SwapChainDesc& SCDesc = pSwapChain->GetDesc();
+
+    const float4 ValueRef0{1, 2, 3, 4};
+    const float4 ValueRef1{5, 6, 7, 8};
+    const float4 TexRef{0, 1, 0, 1};
+
+    constexpr Uint32          TexDim = 4;
+    const std::vector<Uint32> TexData(TexDim * TexDim, 0xFF00FF00u);
+    RefCntAutoPtr<ITexture>   pTex = pEnv->CreateTexture("Push descriptors test texture", TEX_FORMAT_RGBA8_UNORM, BIND_SHADER_RESOURCE, TexDim, TexDim, TexData.data());
+    ASSERT_NE(pTex, nullptr);
+
+    RefCntAutoPtr<IBuffer> pConstants[2];
+    for (RefCntAutoPtr<IBuffer>& pCB : pConstants)
+    {
+        CreateUniformBuffer(pDevice, sizeof(float4), "Push descriptors test constants", &pCB);
+        ASSERT_NE(pCB, nullptr);
+    }
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name         = "Push descriptors test signature";
+    PRSDesc.BindingIndex = BindingIndex;
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+        {SHADER_TYPE_PIXEL, "g_Tex",       1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+    };
+    const ImmutableSamplerDesc ImmutableSamplers[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_Tex", SamplerDesc{}},
+    };
+    // clang-format on
+    PRSDesc.Resources                  = Resources;
+    PRSDesc.NumResources               = _countof(Resources);
+    PRSDesc.ImmutableSamplers          = ImmutableSamplers;
+    PRSDesc.NumImmutableSamplers       = _countof(ImmutableSamplers);
+    PRSDesc.UseCombinedTextureSamplers = true;
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    ShaderMacroHelper Macros;
+    Macros.AddShaderMacro("RT_HALF_WIDTH", static_cast<float>(SCDesc.Width) * 0.5f);
+    Macros.AddShaderMacro("VALUE_REF0", ValueRef0);
+    Macros.AddShaderMacro("VALUE_REF1", ValueRef1);
+    Macros.AddShaderMacro("TEX_REF", TexRef);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Macros         = Macros;
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Source = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        ShaderCI.Desc   = {"Push descriptors test - VS", SHADER_TYPE_VERTEX, true};
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Source = HLSL::PushDescriptorsTest_PS.c_str();
+        ShaderCI.Desc   = {"Push descriptors test - PS", SHADER_TYPE_PIXEL, true};
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name = "Push descriptors test";
+
+    IPipelineResourceSignature* ppSignatures[] = {pPRS};
+    PSOCreateInfo.ppResourceSignatures         = ppSignatures;
+    PSOCreateInfo.ResourceSignaturesCount      = _countof(ppSignatures);
+
+    GraphicsPipelineDesc& GraphicsPipeline        = PSOCreateInfo.GraphicsPipeline;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = SCDesc.ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRBs[2];
+    for (size_t i = 0; i < _countof(pSRBs); ++i)
+    {
+        pPRS->CreateShaderResourceBinding(&pSRBs[i], true);
+        ASSERT_NE(pSRBs[i], nullptr);
+        pSRBs[i]->GetVariableByName(SHADER_TYPE_PIXEL, "cbConstants")->Set(pConstants[i]);
+        pSRBs[i]->GetVariableByName(SHADER_TYPE_PIXEL, "g_Tex")->Set(pTex->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    }
+
+    static FastRandFloat rnd{0, 0, 1};
+    const float          ClearColor[] = {rnd(), rnd(), rnd(), rnd()};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    ITextureView* ppRTVs[] = {pSwapChain->GetCurrentBackBufferRTV()};
+    pContext->SetRenderTargets(1, ppRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->ClearRenderTarget(ppRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    pContext->SetPipelineState(pPSO);
+
+    {
+        MapHelper<float4> pData{pContext, pConstants[0], MAP_WRITE, MAP_FLAG_DISCARD};
+        *pData = ValueRef0;
+    }
+    pContext->CommitShaderResources(pSRBs[0], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+    pContext->Draw(DrawAttrs);
+
+    IBuffer* pSecondCB = pConstants[SwitchSRB ? 1 : 0];
+    {
+        // Mapping the buffer with DISCARD flag changes its dynamic offset
+        MapHelper<float4> pData{pContext, pSecondCB, MAP_WRITE, MAP_FLAG_DISCARD};
+        *pData = ValueRef1;
+    }
+    if (SwitchSRB)
+        pContext->CommitShaderResources(pSRBs[1], RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+
+    DrawAttrs.StartVertexLocation = 3;
+    pContext->Draw(DrawAttrs);
+
+    pSwapChain->Present();
+
+    RefCntAutoPtr<IRenderDeviceVk> pDeviceVk{pDevice, IID_RenderDeviceVk};
+    DeviceFeaturesVk               FeaturesVk;
+    pDeviceVk->GetDeviceFeaturesVk(FeaturesVk);
+
+    // Present() finishes the frame, so the statistics cover the draws above
+    RefCntAutoPtr<IDeviceContextVk> pContextVk{pContext, IID_DeviceContextVk};
+    DescriptorSetStatisticsVk       Stats;
+    pContextVk->GetDescriptorSetStatistics(Stats);
+    if (BindingIndex == 0 && FeaturesVk.PushDescriptor == DEVICE_FEATURE_STATE_ENABLED)
+    {
+        EXPECT_GT(Stats.NumAvoidedDynamicSetAllocations, 0u);
+    }
+    else
+    {
+        EXPECT_EQ(Stats.NumAvoidedDynamicSetAllocations, 0u);
+        EXPECT_GT(Stats.NumDynamicSetAllocations, 0u);
+    }
+}
+
+TEST_F(VkPushDescriptorsTest, DynamicOffsetChange)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    // Binding index 0: push descriptors, if enabled
+    Render(0, /*SwitchSRB = */ false);
+    // Binding index 1: descriptor set from the pool
+    Render(1, /*SwitchSRB = */ false);
+}
+
+TEST_F(VkPushDescriptorsTest, SRBChange)
+{
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    Render(0, /*SwitchSRB = */ true);
+    Render(1, /*SwitchSRB = */ true);
+}
+
+} // namespace
@@ -0,0 +1,294 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#pragma once
+
+/// \file
+/// Minimal micro-benchmark framework that follows the Google Benchmark API and output format.
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <chrono>
+#include <ctime>
+
+#include "../../../Primitives/interface/BasicTypes.h"
+
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+// Suppresses unused variable warnings for the benchmark loop variable
+#    define DILIGENT_BENCHMARK_UNUSED __attribute__((unused))
+#else
+#    define DILIGENT_BENCHMARK_UNUSED
+#endif
+
+namespace Diligent
+{
+
+namespace Benchmarking
+{
+
+/// Benchmark state passed to every benchmark function.
+
+/// The function must run the measured code in the range-based for loop over the state:
+///
+///     void BM_Example(BenchmarkState& State)
+///     {
+///         // Setup (not timed)
+///         for (auto _ : State)
+///         {
+///             // Measured code
+///         }
+///     }
+///
+/// The loop is executed the number of times chosen by the framework to reach the minimal run time.
+class BenchmarkState
+{
+public:
+    /// User counters in the order they were first set
+    using CountersType = std::vector<std::pair<std::string, double>>;
+
+    BenchmarkState(Uint64 MaxIterations, const std::vector<Int64>& Args) noexcept :
+        m_MaxIterations{MaxIterations},
+        m_Args{Args}
+    {}
+
+    // clang-format off
+    BenchmarkState           (const BenchmarkState&) = delete;
+    BenchmarkState& operator=(const BenchmarkState&) = delete;
+    // clang-format on
+
+    struct DILIGENT_BENCHMARK_UNUSED Value
+    {};
+
+    class Iterator
+    {
+    public:
+        Iterator(BenchmarkState* pState, Uint64 Remaining) noexcept :
+            m_pState{pState},
+            m_Remaining{Remaining}
+        {}
+
+        Value operator*() const { return {}; }
+
+        Iterator& operator++()
+        {
+            --m_Remaining;
+            return *this;
+        }
+
+        bool operator!=(const Iterator&)
+        {
+            if (m_Remaining != 0)
+                return true;
+            m_pState->FinishKeepRunning();
+            return false;
+        }
+
+    private:
+        BenchmarkState* const m_pState;
+        Uint64                m_Remaining;
+    };
+
+    Iterator begin()
+    {
+        StartKeepRunning();
+        return Iterator{this, m_ErrorOccurred ? 0 : m_MaxIterations};
+    }
+
+    Iterator end()
+    {
+        return Iterator{this, 0};
+    }
+
+    /// Returns the benchmark argument with the given index.
+    Int64 Range(size_t Idx = 0) const
+    {
+        return Idx < m_Args.size() ? m_Args[Idx] : 0;
+    }
+
+    /// Stops the timer, e.g. to exclude per-iteration setup from the measurement.
+    void PauseTiming();
+
+    /// Resumes the timer stopped by PauseTiming().
+    void ResumeTiming();
+
+    /// Sets the total number of items processed in all iterations.
+    void SetItemsProcessed(Int64 Items) { m_ItemsProcessed = Items; }
+
+    /// Sets the total number of bytes processed in all iterations.
+    void SetBytesProcessed(Int64 Bytes) { m_BytesProcessed = Bytes; }
+
+    /// Sets the user counter that is reported along with the timings, similar to
+    /// Google Benchmark State.counters. The value is reported as is and is not
+    /// divided by the number of iterations.
+    void SetCounter(const char* Name, double Value);
+
+    /// Reports an error and stops the benchmark. Must be called before the loop.
+    void SkipWithError(const char* Message);
+
+    Uint64 Iterations() const { return m_MaxIterations; }
+
+    // clang-format off
+    double              GetRealTime()       const { return m_RealTime; }
+    double              GetCPUTime()        const { return m_CPUTime; }
+    Int64               GetItemsProcessed() const { return m_ItemsProcessed; }
+    Int64               GetBytesProcessed() const { return m_BytesProcessed; }
+    const CountersType& GetCounters()       const { return m_Counters; }
+    bool                ErrorOccurred()     const { return m_ErrorOccurred; }
+    const std::string&  GetErrorMessage()   const { return m_ErrorMessage; }
+    bool                IsFinished()        const { return m_Finished; }
+    // clang-format on
+
+private:
+    void StartKeepRunning();
+    void FinishKeepRunning();
+
+private:
+    const Uint64              m_MaxIterations;
+    const std::vector<Int64>& m_Args;
+
+    bool m_Running  = false;
+    bool m_Started  = false;
+    bool m_Finished = false;
+
+    std::chrono::high_resolution_clock::time_point m_RealStart;
+    std::clock_t                                   m_CPUStart = 0;
+
+    // Accumulated real and CPU time, in seconds
+    double m_RealTime = 0;
+    double m_CPUTime  = 0;
+
+    Int64 m_ItemsProcessed = 0;
+    Int64 m_BytesProcessed = 0;
+
+    CountersType m_Counters;
+
+    bool        m_ErrorOccurred = false;
+    std::string m_ErrorMessage;
+};
+
+using BenchmarkFunctionType = void (*)(BenchmarkState& State);
+
+/// Registered benchmark family.
+class Benchmark
+{
+public:
+    Benchmark(const char* Name, BenchmarkFunctionType Func) :
+        m_Name{Name},
+        m_Func{Func}
+    {}
+
+    /// Adds a benchmark instance with the given argument.
+    Benchmark* Arg(Int64 Arg)
+    {
+        m_Args.push_back({Arg});
+        return this;
+    }
+
+    /// Adds a benchmark instance with the given arguments.
+    Benchmark* Args(const std::vector<Int64>& Args)
+    {
+        m_Args.push_back(Args);
+        return this;
+    }
+
+    // clang-format off
+    const std::string&                     GetName()     const { return m_Name; }
+    BenchmarkFunctionType                  GetFunction() const { return m_Func; }
+    const std::vector<std::vector<Int64>>& GetArgs()     const { return m_Args; }
+    // clang-format on
+
+private:
+    const std::string               m_Name;
+    const BenchmarkFunctionType     m_Func;
+    std::vector<std::vector<Int64>> m_Args;
+};
+
+/// Registers the benchmark function. The returned object is owned by the framework.
+Benchmark* RegisterBenchmark(const char* Name, BenchmarkFunctionType Func);
+
+/// Runs registered benchmarks and returns the process exit code.
+
+/// Supported command line options (compatible with Google Benchmark):
+///   --benchmark_filter=<regex>        - run only the benchmarks whose names match the regular expression
+///   --benchmark_min_time=<seconds>    - minimal time to run every benchmark (default: 0.5)
+///   --benchmark_repetitions=<count>   - number of times to repeat every benchmark; mean, median and
+///                                       standard deviation are reported when the count is greater than 1
+///   --benchmark_out=<file>            - write results to the file in JSON format
+///   --benchmark_format=<console|json> - format of the standard output
+///   --benchmark_list_tests            - list benchmarks without running them
+///
+/// The JSON output uses the Google Benchmark schema, so the results of two runs can be
+/// compared with Google Benchmark tools/compare.py.
+int RunBenchmarks(int argc, char** argv);
+
+/// Prevents the compiler from optimizing away the value.
+template <typename Type>
+inline void DoNotOptimize(const Type& Val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile(""
+                 :
+                 : "r,m"(Val)
+                 : "memory");
+#else
+    const volatile void* volatile pSink = &Val;
+    (void)pSink;
+    _ReadWriteBarrier();
+#endif
+}
+
+/// Forces the compiler to flush pending writes to memory.
+inline void ClobberMemory()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile(""
+                 :
+                 :
+                 : "memory");
+#else
+    _ReadWriteBarrier();
+#endif
+}
+
+} // namespace Benchmarking
+
+} // namespace Diligent
+
+#define DILIGENT_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define DILIGENT_BENCHMARK_CONCAT(a, b)      DILIGENT_BENCHMARK_CONCAT_IMPL(a, b)
+
+/// Registers benchmark function Func. Arguments may be added to the returned object:
+///
+///     DILIGENT_BENCHMARK(BM_Example)->Arg(64)->Arg(1024);
+#define DILIGENT_BENCHMARK(Func)                                                                                        \
+    [[maybe_unused]] static ::Diligent::Benchmarking::Benchmark* DILIGENT_BENCHMARK_CONCAT(Benchmark_##Func, __LINE__) = \
+        ::Diligent::Benchmarking::RegisterBenchmark(#Func, Func)
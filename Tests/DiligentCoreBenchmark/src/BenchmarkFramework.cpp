@@ -0,0 +1,609 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BenchmarkFramework.hpp"
+
+#include <memory>
+#include <regex>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <functional>
+
+#include "PlatformDefinitions.h"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace Benchmarking
+{
+
+void BenchmarkState::StartKeepRunning()
+{
+    VERIFY(!m_Started, "The benchmark loop must only be executed once");
+    m_Started = true;
+    ResumeTiming();
+}
+
+void BenchmarkState::FinishKeepRunning()
+{
+    if (m_Finished)
+        return;
+
+    if (m_Running)
+        PauseTiming();
+    m_Finished = true;
+}
+
+void BenchmarkState::PauseTiming()
+{
+    VERIFY(m_Running, "Timer is not running");
+    const auto         RealEnd = std::chrono::high_resolution_clock::now();
+    const std::clock_t CPUEnd  = std::clock();
+
+    m_RealTime += std::chrono::duration<double>(RealEnd - m_RealStart).count();
+    m_CPUTime += static_cast<double>(CPUEnd - m_CPUStart) / CLOCKS_PER_SEC;
+    m_Running = false;
+}
+
+void BenchmarkState::ResumeTiming()
+{
+    VERIFY(!m_Running, "Timer is already running");
+    m_Running   = true;
+    m_RealStart = std::chrono::high_resolution_clock::now();
+    m_CPUStart  = std::clock();
+}
+
+void BenchmarkState::SetCounter(const char* Name, double Value)
+{
+    for (auto& Counter : m_Counters)
+    {
+        if (Counter.first == Name)
+        {
+            Counter.second = Value;
+            return;
+        }
+    }
+    m_Counters.emplace_back(Name, Value);
+}
+
+void BenchmarkState::SkipWithError(const char* Message)
+{
+    m_ErrorOccurred = true;
+    m_ErrorMessage  = Message != nullptr ? Message : "";
+}
+
+namespace
+{
+
+std::vector<std::unique_ptr<Benchmark>>& GetRegistry()
+{
+    static std::vector<std::unique_ptr<Benchmark>> Registry;
+    return Registry;
+}
+
+struct BenchmarkInstance
+{
+    const Benchmark*   pFamily = nullptr;
+    size_t             FamilyIndex;
+    size_t             InstanceIndex;
+    std::vector<Int64> Args;
+    std::string        Name;
+};
+
+struct RunResult
+{
+    std::string Name;
+    std::string RunName;
+    std::string AggregateName; // Empty for iteration runs
+
+    const BenchmarkInstance* pInstance = nullptr;
+
+    Uint32 Repetitions     = 1;
+    Uint32 RepetitionIndex = 0;
+    Uint64 Iterations      = 0;
+
+    // Per-iteration time, in nanoseconds
+    double RealTime = 0;
+    double CPUTime  = 0;
+
+    double ItemsPerSecond = 0;
+    double BytesPerSecond = 0;
+
+    BenchmarkState::CountersType Counters;
+
+    std::string ErrorMessage;
+};
+
+struct Options
+{
+    std::string Filter      = ".";
+    double      MinTime     = 0.5;
+    Uint32      Repetitions = 1;
+    std::string OutFile;
+    bool        JSONStdOut     = false;
+    bool        ListBenchmarks = false;
+};
+
+bool ParseOption(const char* Arg, const char* Name, std::string& Value)
+{
+    const size_t NameLen = strlen(Name);
+    if (strncmp(Arg, Name, NameLen) != 0)
+        return false;
+    if (Arg[NameLen] == '=')
+    {
+        Value = Arg + NameLen + 1;
+        return true;
+    }
+    if (Arg[NameLen] == '\0')
+    {
+        Value.clear();
+        return true;
+    }
+    return false;
+}
+
+bool ParseOptions(int argc, char** argv, Options& Opts)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* Arg = argv[i];
+        std::string Value;
+        if (ParseOption(Arg, "--benchmark_filter", Value))
+        {
+            Opts.Filter = Value;
+        }
+        else if (ParseOption(Arg, "--benchmark_min_time", Value))
+        {
+            // Google Benchmark accepts both "0.5" and "0.5s"
+            if (!Value.empty() && Value.back() == 's')
+                Value.pop_back();
+            Opts.MinTime = std::atof(Value.c_str());
+        }
+        else if (ParseOption(Arg, "--benchmark_repetitions", Value))
+        {
+            Opts.Repetitions = static_cast<Uint32>((std::max)(std::atoi(Value.c_str()), 1));
+        }
+        else if (ParseOption(Arg, "--benchmark_out", Value))
+        {
+            Opts.OutFile = Value;
+        }
+        else if (ParseOption(Arg, "--benchmark_out_format", Value))
+        {
+            if (Value != "json")
+            {
+                std::cerr << "Only json output file format is supported\n";
+                return false;
+            }
+        }
+        else if (ParseOption(Arg, "--benchmark_format", Value))
+        {
+            if (Value == "json")
+                Opts.JSONStdOut = true;
+            else if (Value != "console")
+            {
+                std::cerr << "Unknown benchmark format '" << Value << "'\n";
+                return false;
+            }
+        }
+        else if (ParseOption(Arg, "--benchmark_list_tests", Value))
+        {
+            Opts.ListBenchmarks = Value.empty() || Value == "true" || Value == "1";
+        }
+        else
+        {
+            std::cerr << "Unknown command line argument '" << Arg << "'\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<BenchmarkInstance> GetBenchmarkInstances(const std::string& Filter)
+{
+    std::vector<BenchmarkInstance> Instances;
+
+    const std::regex FilterRegex{Filter};
+
+    size_t FamilyIndex = 0;
+    for (const std::unique_ptr<Benchmark>& pBenchmark : GetRegistry())
+    {
+        std::vector<std::vector<Int64>> Args = pBenchmark->GetArgs();
+        if (Args.empty())
+            Args.emplace_back();
+
+        size_t InstanceIndex = 0;
+        for (const std::vector<Int64>& InstanceArgs : Args)
+        {
+            std::string Name = pBenchmark->GetName();
+            for (Int64 Arg : InstanceArgs)
+                Name += "/" + std::to_string(Arg);
+
+            if (!std::regex_search(Name, FilterRegex))
+                continue;
+
+            Instances.push_back({pBenchmark.get(), FamilyIndex, InstanceIndex++, InstanceArgs, std::move(Name)});
+        }
+        if (InstanceIndex > 0)
+            ++FamilyIndex;
+    }
+
+    return Instances;
+}
+
+RunResult RunInstance(const BenchmarkInstance& Instance, const Options& Opts, Uint32 RepetitionIndex)
+{
+    RunResult Result;
+    Result.Name            = Instance.Name;
+    Result.RunName         = Instance.Name;
+    Result.pInstance       = &Instance;
+    Result.Repetitions     = Opts.Repetitions;
+    Result.RepetitionIndex = RepetitionIndex;
+
+    // Similar to Google Benchmark, grow the iteration count until the run takes at least MinTime seconds
+    constexpr Uint64 MaxIterations = 1000000000;
+
+    Uint64 Iterations = 1;
+    while (true)
+    {
+        BenchmarkState State{Iterations, Instance.Args};
+        Instance.pFamily->GetFunction()(State);
+
+        if (State.ErrorOccurred())
+        {
+            Result.ErrorMessage = State.GetErrorMessage();
+            return Result;
+        }
+        VERIFY(State.IsFinished(), "Benchmark '", Instance.Name, "' did not run the benchmark loop");
+
+        const double RealTime = State.GetRealTime();
+        if (RealTime >= Opts.MinTime || Iterations >= MaxIterations)
+        {
+            Result.Iterations = Iterations;
+            Result.RealTime   = RealTime * 1e9 / static_cast<double>(Iterations);
+            Result.CPUTime    = State.GetCPUTime() * 1e9 / static_cast<double>(Iterations);
+            if (State.GetItemsProcessed() != 0 && RealTime > 0)
+                Result.ItemsPerSecond = static_cast<double>(State.GetItemsProcessed()) / RealTime;
+            if (State.GetBytesProcessed() != 0 && RealTime > 0)
+                Result.BytesPerSecond = static_cast<double>(State.GetBytesProcessed()) / RealTime;
+            Result.Counters = State.GetCounters();
+            return Result;
+        }
+
+        // Predict the number of iterations needed to reach the minimal time, but grow by at most 10x
+        double Multiplier = RealTime > 0 ? Opts.MinTime * 1.4 / RealTime : 10.0;
+        Multiplier        = (std::min)((std::max)(Multiplier, 2.0), 10.0);
+        Iterations        = (std::min)(static_cast<Uint64>(static_cast<double>(Iterations) * Multiplier) + 1, MaxIterations);
+    }
+}
+
+void ComputeAggregates(const std::vector<RunResult>& Runs, std::vector<RunResult>& Results)
+{
+    VERIFY_EXPR(!Runs.empty());
+
+    const auto Aggregate = [&](const char* Name, const std::function<double(std::vector<double>)>& Func) {
+        RunResult Res{Runs.front()};
+        Res.Name          = Runs.front().RunName + "_" + Name;
+        Res.AggregateName = Name;
+
+        const auto Apply = [&](double RunResult::*Member) {
+            std::vector<double> Values;
+            for (const RunResult& Run : Runs)
+                Values.push_back(Run.*Member);
+            Res.*Member = Func(std::move(Values));
+        };
+        Apply(&RunResult::RealTime);
+        Apply(&RunResult::CPUTime);
+        Apply(&RunResult::ItemsPerSecond);
+        Apply(&RunResult::BytesPerSecond);
+        for (size_t i = 0; i < Res.Counters.size(); ++i)
+        {
+            std::vector<double> Values;
+            for (const RunResult& Run : Runs)
+                Values.push_back(i < Run.Counters.size() ? Run.Counters[i].second : 0.0);
+            Res.Counters[i].second = Func(std::move(Values));
+        }
+        Results.push_back(std::move(Res));
+    };
+
+    const auto Mean = [](std::vector<double> Values) {
+        return std::accumulate(Values.begin(), Values.end(), 0.0) / static_cast<double>(Values.size());
+    };
+    Aggregate("mean", Mean);
+    Aggregate("median", [](std::vector<double> Values) {
+        std::sort(Values.begin(), Values.end());
+        const size_t Mid = Values.size() / 2;
+        return (Values.size() % 2 != 0) ? Values[Mid] : (Values[Mid - 1] + Values[Mid]) * 0.5;
+    });
+    Aggregate("stddev", [&Mean](std::vector<double> Values) {
+        if (Values.size() < 2)
+            return 0.0;
+        const double Avg   = Mean(Values);
+        double       SqSum = 0;
+        for (double Val : Values)
+            SqSum += (Val - Avg) * (Val - Avg);
+        return std::sqrt(SqSum / static_cast<double>(Values.size() - 1));
+    });
+}
+
+std::string FormatRate(double Rate, const char* Unit)
+{
+    const char* Prefixes[] = {"", "k", "M", "G", "T"};
+
+    size_t Prefix = 0;
+    while (Rate >= 1000.0 && Prefix + 1 < _countof(Prefixes))
+    {
+        Rate /= 1000.0;
+        ++Prefix;
+    }
+
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3) << Rate << Prefixes[Prefix] << Unit;
+    return ss.str();
+}
+
+void PrintConsoleHeader(std::ostream& os, size_t NameWidth)
+{
+    os << std::left << std::setw(static_cast<int>(NameWidth)) << "Benchmark"
+       << std::right << std::setw(15) << "Time"
+       << std::setw(15) << "CPU"
+       << std::setw(13) << "Iterations"
+       << "  UserCounters\n";
+    os << std::string(NameWidth + 15 + 15 + 13 + 14, '-') << '\n';
+}
+
+void PrintConsoleResult(std::ostream& os, const RunResult& Res, size_t NameWidth)
+{
+    os << std::left << std::setw(static_cast<int>(NameWidth)) << Res.Name << std::right;
+    if (!Res.ErrorMessage.empty())
+    {
+        os << " ERROR: " << Res.ErrorMessage << '\n';
+        return;
+    }
+
+    os << std::fixed << std::setprecision(0)
+       << std::setw(12) << Res.RealTime << " ns"
+       << std::setw(12) << Res.CPUTime << " ns";
+    if (Res.AggregateName.empty())
+        os << std::setw(13) << Res.Iterations;
+    else
+        os << std::setw(13) << Res.Repetitions;
+    if (Res.BytesPerSecond != 0)
+        os << "  bytes_per_second=" << FormatRate(Res.BytesPerSecond, "/s");
+    if (Res.ItemsPerSecond != 0)
+        os << "  items_per_second=" << FormatRate(Res.ItemsPerSecond, "/s");
+    for (const auto& Counter : Res.Counters)
+        os << "  " << Counter.first << "=" << FormatRate(Counter.second, "");
+    os << '\n';
+}
+
+std::string EscapeJSONString(const std::string& Str)
+{
+    std::string Escaped;
+    Escaped.reserve(Str.size());
+    for (char c : Str)
+    {
+        switch (c)
+        {
+            case '"': Escaped += "\\\""; break;
+            case '\\': Escaped += "\\\\"; break;
+            case '\n': Escaped += "\\n"; break;
+            case '\t': Escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    std::stringstream ss;
+                    ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+                    Escaped += ss.str();
+                }
+                else
+                {
+                    Escaped += c;
+                }
+        }
+    }
+    return Escaped;
+}
+
+void WriteJSON(std::ostream& os, const char* Executable, const std::vector<RunResult>& Results)
+{
+    const std::time_t Now = std::time(nullptr);
+    std::tm           LocalTime{};
+#if defined(_MSC_VER)
+    localtime_s(&LocalTime, &Now);
+#else
+    localtime_r(&Now, &LocalTime);
+#endif
+
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": \"" << std::put_time(&LocalTime, "%Y-%m-%dT%H:%M:%S") << "\",\n";
+    os << "    \"executable\": \"" << EscapeJSONString(Executable) << "\",\n";
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#ifdef DILIGENT_DEBUG
+    os << "    \"library_build_type\": \"debug\"\n";
+#else
+    os << "    \"library_build_type\": \"release\"\n";
+#endif
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < Results.size(); ++i)
+    {
+        const RunResult& Res = Results[i];
+        os << (i == 0 ? "\n" : ",\n");
+        os << "    {\n";
+        os << "      \"name\": \"" << EscapeJSONString(Res.Name) << "\",\n";
+        os << "      \"family_index\": " << Res.pInstance->FamilyIndex << ",\n";
+        os << "      \"per_family_instance_index\": " << Res.pInstance->InstanceIndex << ",\n";
+        os << "      \"run_name\": \"" << EscapeJSONString(Res.RunName) << "\",\n";
+        if (Res.AggregateName.empty())
+        {
+            os << "      \"run_type\": \"iteration\",\n";
+            os << "      \"repetitions\": " << Res.Repetitions << ",\n";
+            os << "      \"repetition_index\": " << Res.RepetitionIndex << ",\n";
+        }
+        else
+        {
+            os << "      \"run_type\": \"aggregate\",\n";
+            os << "      \"repetitions\": " << Res.Repetitions << ",\n";
+            os << "      \"aggregate_name\": \"" << Res.AggregateName << "\",\n";
+            os << "      \"aggregate_unit\": \"time\",\n";
+        }
+        os << "      \"threads\": 1,\n";
+        if (!Res.ErrorMessage.empty())
+        {
+            os << "      \"error_occurred\": true,\n";
+            os << "      \"error_message\": \"" << EscapeJSONString(Res.ErrorMessage) << "\"\n";
+        }
+        else
+        {
+            os << std::setprecision(10);
+            os << "      \"iterations\": " << (Res.AggregateName.empty() ? Res.Iterations : Res.Repetitions) << ",\n";
+            os << "      \"real_time\": " << Res.RealTime << ",\n";
+            os << "      \"cpu_time\": " << Res.CPUTime << ",\n";
+            os << "      \"time_unit\": \"ns\"";
+            if (Res.BytesPerSecond != 0)
+                os << ",\n      \"bytes_per_second\": " << Res.BytesPerSecond;
+            if (Res.ItemsPerSecond != 0)
+                os << ",\n      \"items_per_second\": " << Res.ItemsPerSecond;
+            for (const auto& Counter : Res.Counters)
+                os << ",\n      \"" << EscapeJSONString(Counter.first) << "\": " << Counter.second;
+            os << '\n';
+        }
+        os << "    }";
+    }
+    os << "\n  ]\n}\n";
+}
+
+} // namespace
+
+Benchmark* RegisterBenchmark(const char* Name, BenchmarkFunctionType Func)
+{
+    std::vector<std::unique_ptr<Benchmark>>& Registry = GetRegistry();
+    Registry.emplace_back(std::make_unique<Benchmark>(Name, Func));
+    return Registry.back().get();
+}
+
+int RunBenchmarks(int argc, char** argv)
+{
+    Options Opts;
+    if (!ParseOptions(argc, argv, Opts))
+        return -1;
+
+    std::vector<BenchmarkInstance> Instances;
+    try
+    {
+        Instances = GetBenchmarkInstances(Opts.Filter);
+    }
+    catch (const std::regex_error& err)
+    {
+        std::cerr << "Invalid benchmark filter '" << Opts.Filter << "': " << err.what() << '\n';
+        return -1;
+    }
+
+    if (Opts.ListBenchmarks)
+    {
+        for (const BenchmarkInstance& Instance : Instances)
+            std::cout << Instance.Name << '\n';
+        return 0;
+    }
+
+    if (Instances.empty())
+    {
+        std::cerr << "No benchmarks match the filter '" << Opts.Filter << "'\n";
+        return -1;
+    }
+
+#ifdef DILIGENT_DEBUG
+    std::cout << "***WARNING*** This is a debug build. Timings are not representative.\n";
+#endif
+
+    size_t NameWidth = 10;
+    for (const BenchmarkInstance& Instance : Instances)
+        NameWidth = (std::max)(NameWidth, Instance.Name.size() + (Opts.Repetitions > 1 ? 7 : 0) + 1);
+
+    if (!Opts.JSONStdOut)
+        PrintConsoleHeader(std::cout, NameWidth);
+
+    std::vector<RunResult> Results;
+    bool                   ErrorOccurred = false;
+    for (const BenchmarkInstance& Instance : Instances)
+    {
+        std::vector<RunResult> Runs;
+        for (Uint32 rep = 0; rep < Opts.Repetitions; ++rep)
+        {
+            Runs.push_back(RunInstance(Instance, Opts, rep));
+            if (!Opts.JSONStdOut)
+                PrintConsoleResult(std::cout, Runs.back(), NameWidth);
+            if (!Runs.back().ErrorMessage.empty())
+            {
+                ErrorOccurred = true;
+                break;
+            }
+        }
+
+        Results.insert(Results.end(), Runs.begin(), Runs.end());
+        if (Opts.Repetitions > 1 && Runs.back().ErrorMessage.empty())
+        {
+            const size_t NumResults = Results.size();
+            ComputeAggregates(Runs, Results);
+            if (!Opts.JSONStdOut)
+            {
+                for (size_t i = NumResults; i < Results.size(); ++i)
+                    PrintConsoleResult(std::cout, Results[i], NameWidth);
+            }
+        }
+    }
+
+    if (Opts.JSONStdOut)
+        WriteJSON(std::cout, argv[0], Results);
+
+    if (!Opts.OutFile.empty())
+    {
+        std::ofstream OutFile{Opts.OutFile};
+        if (!OutFile)
+        {
+            std::cerr << "Failed to open output file '" << Opts.OutFile << "'\n";
+            return -1;
+        }
+        WriteJSON(OutFile, argv[0], Results);
+    }
+
+    return ErrorOccurred ? -1 : 0;
+}
+
+} // namespace Benchmarking
+
+} // namespace Diligent
@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "CPUProfiler.hpp"
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Measures the cost of a profiling scope. Range(0) != 0 enables recording.
+// Range(1) != 0 releases the event blocks on every reset, so that the events are
+// always recorded to fresh memory, like the first frame of an application.
+void BM_CPUProfiler_ScopedEvent(BenchmarkState& State)
+{
+    const bool Enabled     = State.Range(0) != 0;
+    const bool FreshBlocks = State.Range(1) != 0;
+    // Make sure the events are not dropped
+    CPUProfiler::SetMaxEventsPerThread(~size_t{0});
+    CPUProfiler::SetEnabled(Enabled);
+    Uint64 NumScopes = 0;
+    for (auto _ : State)
+    {
+        {
+            CPUProfiler::ScopedEvent Scope{"BenchmarkScope"};
+            ClobberMemory();
+        }
+
+        // Discard the events periodically, like an application that collects a trace every frame
+        if ((++NumScopes % 65536) == 0)
+        {
+            State.PauseTiming();
+            CPUProfiler::Reset();
+            if (FreshBlocks)
+            {
+                // Spare blocks that are not reused until the next reset are released
+                CPUProfiler::Reset();
+            }
+            State.ResumeTiming();
+        }
+    }
+    CPUProfiler::Reset();
+    CPUProfiler::SetEnabled(false);
+    CPUProfiler::SetMaxEventsPerThread(size_t{1} << 20);
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations()));
+}
+DILIGENT_BENCHMARK(BM_CPUProfiler_ScopedEvent)->Args({0, 0})->Args({1, 0})->Args({1, 1});
+
+} // namespace
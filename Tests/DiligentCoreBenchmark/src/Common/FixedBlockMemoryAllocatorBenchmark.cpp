@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "FixedBlockMemoryAllocator.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr size_t NumAllocations = 1024;
+
+template <typename AllocatorType>
+void AllocateAndFree(BenchmarkState& State, AllocatorType& Allocator, size_t BlockSize)
+{
+    std::vector<void*> Blocks(NumAllocations);
+    for (auto _ : State)
+    {
+        for (size_t i = 0; i < NumAllocations; ++i)
+            Blocks[i] = Allocator.Allocate(BlockSize, "Benchmark block", __FILE__, __LINE__);
+        DoNotOptimize(Blocks.data());
+        // Free in the interleaved order to exercise the free-list
+        for (size_t i = 0; i < NumAllocations; i += 2)
+            Allocator.Free(Blocks[i]);
+        for (size_t i = 1; i < NumAllocations; i += 2)
+            Allocator.Free(Blocks[i]);
+    }
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumAllocations));
+}
+
+// Allocates and frees NumAllocations blocks of Range(0) bytes from the fixed block allocator.
+void BM_FixedBlockMemoryAllocator_AllocateFree(BenchmarkState& State)
+{
+    const size_t              BlockSize = static_cast<size_t>(State.Range(0));
+    FixedBlockMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), BlockSize, 256};
+    AllocateAndFree(State, Allocator, BlockSize);
+}
+DILIGENT_BENCHMARK(BM_FixedBlockMemoryAllocator_AllocateFree)->Arg(16)->Arg(64)->Arg(256);
+
+// Baseline: the same allocation pattern served by the default raw memory allocator.
+void BM_DefaultRawMemoryAllocator_AllocateFree(BenchmarkState& State)
+{
+    AllocateAndFree(State, DefaultRawMemoryAllocator::GetAllocator(), static_cast<size_t>(State.Range(0)));
+}
+DILIGENT_BENCHMARK(BM_DefaultRawMemoryAllocator_AllocateFree)->Arg(16)->Arg(64)->Arg(256);
+
+} // namespace
@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "HashUtils.hpp"
+#include "FastRand.hpp"
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Hashes Range(0) bytes of raw data.
+void BM_ComputeHashRaw(BenchmarkState& State)
+{
+    const size_t Size = static_cast<size_t>(State.Range(0));
+
+    std::vector<Uint8> Data(Size);
+    FastRand           Rnd{0};
+    for (Uint8& Byte : Data)
+        Byte = static_cast<Uint8>(Rnd());
+
+    for (auto _ : State)
+    {
+        size_t Hash = ComputeHashRaw(Data.data(), Data.size());
+        DoNotOptimize(Hash);
+    }
+
+    State.SetBytesProcessed(static_cast<Int64>(State.Iterations() * Size));
+}
+DILIGENT_BENCHMARK(BM_ComputeHashRaw)->Arg(64)->Arg(4096);
+
+
+// Hashes a null-terminated string of Range(0) characters.
+void BM_CStringHash(BenchmarkState& State)
+{
+    const std::string Str(static_cast<size_t>(State.Range(0)), 'x');
+
+    CStringHash<Char> Hasher;
+    for (auto _ : State)
+    {
+        size_t Hash = Hasher(Str.c_str());
+        DoNotOptimize(Hash);
+    }
+
+    State.SetBytesProcessed(static_cast<Int64>(State.Iterations() * Str.size()));
+}
+DILIGENT_BENCHMARK(BM_CStringHash)->Arg(16)->Arg(256);
+
+
+// Looks up Range(0) keys in an unordered map with HashMapStringKey keys,
+// which is how shader and resource names are looked up in the engine.
+void BM_HashMapStringKey_Find(BenchmarkState& State)
+{
+    const size_t NumKeys = static_cast<size_t>(State.Range(0));
+
+    std::vector<std::string> Names(NumKeys);
+    for (size_t i = 0; i < NumKeys; ++i)
+        Names[i] = "g_ShaderResourceVariable" + std::to_string(i);
+
+    std::unordered_map<HashMapStringKey, size_t> Map;
+    for (size_t i = 0; i < NumKeys; ++i)
+        Map.emplace(HashMapStringKey{Names[i].c_str()}, i);
+
+    for (auto _ : State)
+    {
+        size_t Sum = 0;
+        for (const std::string& Name : Names)
+            Sum += Map.find(HashMapStringKey{Name.c_str()})->second;
+        DoNotOptimize(Sum);
+    }
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumKeys));
+}
+DILIGENT_BENCHMARK(BM_HashMapStringKey_Find)->Arg(1024);
+
+
+// Hashes a typical graphics pipeline description, which is done for every
+// pipeline state lookup in the render state caches.
+void BM_Hash_GraphicsPipelineDesc(BenchmarkState& State)
+{
+    constexpr LayoutElement Elements[] =
+        {
+            LayoutElement{0, 0, 3, VT_FLOAT32},
+            LayoutElement{1, 0, 3, VT_FLOAT32},
+            LayoutElement{2, 0, 2, VT_FLOAT32},
+            LayoutElement{3, 0, 4, VT_UINT8, True},
+        };
+
+    GraphicsPipelineDesc Desc;
+    Desc.NumRenderTargets             = 3;
+    Desc.RTVFormats[0]                = TEX_FORMAT_RGBA8_UNORM_SRGB;
+    Desc.RTVFormats[1]                = TEX_FORMAT_RGBA16_FLOAT;
+    Desc.RTVFormats[2]                = TEX_FORMAT_RG16_FLOAT;
+    Desc.DSVFormat                    = TEX_FORMAT_D32_FLOAT;
+    Desc.BlendDesc.RenderTargets[0]   = RenderTargetBlendDesc{True};
+    Desc.RasterizerDesc.CullMode      = CULL_MODE_BACK;
+    Desc.DepthStencilDesc.DepthFunc   = COMPARISON_FUNC_GREATER_EQUAL;
+    Desc.InputLayout.LayoutElements   = Elements;
+    Desc.InputLayout.NumElements      = _countof(Elements);
+    Desc.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    Desc.SmplDesc.Count               = 4;
+
+    std::hash<GraphicsPipelineDesc> Hasher;
+    for (auto _ : State)
+    {
+        size_t Hash = Hasher(Desc);
+        DoNotOptimize(Hash);
+    }
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations()));
+}
+DILIGENT_BENCHMARK(BM_Hash_GraphicsPipelineDesc);
+
+} // namespace
@@ -0,0 +1,142 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "Serializer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <vector>
+#include <string>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+struct Record
+{
+    Uint32      Id;
+    Uint64      Hash;
+    float       Values[4];
+    const char* Name;
+};
+
+std::vector<std::string> GenerateNames(size_t NumRecords)
+{
+    std::vector<std::string> Names(NumRecords);
+    for (size_t i = 0; i < NumRecords; ++i)
+        Names[i] = "Serialized object " + std::to_string(i);
+    return Names;
+}
+
+std::vector<Record> GenerateRecords(const std::vector<std::string>& Names)
+{
+    std::vector<Record> Records(Names.size());
+    for (size_t i = 0; i < Names.size(); ++i)
+    {
+        Record& Rec = Records[i];
+        Rec.Id      = static_cast<Uint32>(i);
+        Rec.Hash    = i * 0x9E3779B97F4A7C15ull;
+        for (size_t v = 0; v < _countof(Rec.Values); ++v)
+            Rec.Values[v] = static_cast<float>(i + v);
+        Rec.Name = Names[i].c_str();
+    }
+    return Records;
+}
+
+template <SerializerMode Mode>
+bool SerializeRecords(Serializer<Mode>& Ser, typename Serializer<Mode>::template ConstQual<std::vector<Record>>& Records)
+{
+    for (auto& Rec : Records)
+    {
+        if (!Ser(Rec.Id, Rec.Hash, Rec.Name))
+            return false;
+        if (!Ser.CopyBytes(Rec.Values, sizeof(Rec.Values)))
+            return false;
+    }
+    return true;
+}
+
+// Measures and writes Range(0) records.
+void BM_Serializer_Write(BenchmarkState& State)
+{
+    const std::vector<std::string> Names   = GenerateNames(static_cast<size_t>(State.Range(0)));
+    const std::vector<Record>      Records = GenerateRecords(Names);
+
+    IMemoryAllocator& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+
+    size_t DataSize = 0;
+    for (auto _ : State)
+    {
+        Serializer<SerializerMode::Measure> MSer;
+        SerializeRecords(MSer, Records);
+
+        SerializedData Data = MSer.AllocateData(Allocator);
+
+        Serializer<SerializerMode::Write> WSer{Data};
+        SerializeRecords(WSer, Records);
+        VERIFY_EXPR(WSer.IsEnded());
+
+        DataSize = Data.Size();
+        DoNotOptimize(Data.Ptr());
+    }
+
+    State.SetBytesProcessed(static_cast<Int64>(State.Iterations() * DataSize));
+}
+DILIGENT_BENCHMARK(BM_Serializer_Write)->Arg(1024);
+
+
+// Reads Range(0) records.
+void BM_Serializer_Read(BenchmarkState& State)
+{
+    const std::vector<std::string> Names   = GenerateNames(static_cast<size_t>(State.Range(0)));
+    const std::vector<Record>      Records = GenerateRecords(Names);
+
+    Serializer<SerializerMode::Measure> MSer;
+    SerializeRecords(MSer, Records);
+    const SerializedData Data = MSer.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+    {
+        Serializer<SerializerMode::Write> WSer{Data};
+        SerializeRecords(WSer, Records);
+    }
+
+    std::vector<Record> ReadRecords(Records.size());
+    for (auto _ : State)
+    {
+        Serializer<SerializerMode::Read> RSer{Data};
+        SerializeRecords(RSer, ReadRecords);
+        VERIFY_EXPR(RSer.IsEnded());
+        DoNotOptimize(ReadRecords.data());
+    }
+
+    State.SetBytesProcessed(static_cast<Int64>(State.Iterations() * Data.Size()));
+}
+DILIGENT_BENCHMARK(BM_Serializer_Read)->Arg(1024);
+
+} // namespace
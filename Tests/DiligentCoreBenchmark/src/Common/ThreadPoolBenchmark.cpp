@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "ThreadPool.hpp"
+
+#include <vector>
+#include <atomic>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr Uint32 NumWorkerThreads = 4;
+
+// Enqueues Range(0) trivial tasks and waits for all of them to complete.
+// Measures the task queue overhead.
+void BM_ThreadPool_EnqueueAndWait(BenchmarkState& State)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumWorkerThreads});
+    if (!pThreadPool)
+    {
+        State.SkipWithError("Failed to create thread pool");
+        return;
+    }
+
+    const size_t        NumTasks = static_cast<size_t>(State.Range(0));
+    std::atomic<Uint64> Counter{0};
+    for (auto _ : State)
+    {
+        for (size_t i = 0; i < NumTasks; ++i)
+        {
+            EnqueueAsyncWork(pThreadPool,
+                             [&Counter](Uint32 ThreadId) {
+                                 Counter.fetch_add(1, std::memory_order_relaxed);
+                                 return ASYNC_TASK_STATUS_COMPLETE;
+                             });
+        }
+        pThreadPool->WaitForAllTasks();
+    }
+    DoNotOptimize(Counter.load());
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumTasks));
+}
+DILIGENT_BENCHMARK(BM_ThreadPool_EnqueueAndWait)->Arg(64)->Arg(1024);
+
+
+// Enqueues a chain of Range(0) tasks where every task depends on the previous one.
+// Measures the prerequisite tracking overhead.
+void BM_ThreadPool_PrerequisiteChain(BenchmarkState& State)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumWorkerThreads});
+    if (!pThreadPool)
+    {
+        State.SkipWithError("Failed to create thread pool");
+        return;
+    }
+
+    const size_t                           NumTasks = static_cast<size_t>(State.Range(0));
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks(NumTasks);
+    for (auto _ : State)
+    {
+        for (size_t i = 0; i < NumTasks; ++i)
+        {
+            IAsyncTask* pPrerequisite = i > 0 ? Tasks[i - 1].RawPtr() : nullptr;
+
+            Tasks[i] = EnqueueAsyncWork(pThreadPool, &pPrerequisite, pPrerequisite != nullptr ? 1 : 0,
+                                        [](Uint32 ThreadId) { return ASYNC_TASK_STATUS_COMPLETE; });
+        }
+        pThreadPool->WaitForAllTasks();
+    }
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumTasks));
+}
+DILIGENT_BENCHMARK(BM_ThreadPool_PrerequisiteChain)->Arg(256);
+
+} // namespace
@@ -0,0 +1,136 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "VariableSizeAllocationsManager.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "FastRand.hpp"
+
+#include <vector>
+#include <algorithm>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+using OffsetType = VariableSizeAllocationsManager::OffsetType;
+
+constexpr OffsetType ManagerSize = OffsetType{64} << 20;
+
+// Generates reproducible allocation sizes between 16 bytes and 16 KB
+std::vector<OffsetType> GenerateAllocationSizes(size_t NumAllocations)
+{
+    FastRand Rnd{0};
+
+    std::vector<OffsetType> Sizes(NumAllocations);
+    for (OffsetType& Size : Sizes)
+        Size = OffsetType{16} << (Rnd() % 11);
+    return Sizes;
+}
+
+VariableSizeAllocationsManager::CreateInfo GetManagerCI()
+{
+    // Disable the debug validation as it dominates the run time in debug builds
+    return {DefaultRawMemoryAllocator::GetAllocator(), ManagerSize, true};
+}
+
+// Allocates Range(0) blocks of different sizes and frees them in the shuffled order.
+void BM_VariableSizeAllocationsManager_AllocateFree(BenchmarkState& State)
+{
+    const size_t                  NumAllocations = static_cast<size_t>(State.Range(0));
+    const std::vector<OffsetType> Sizes          = GenerateAllocationSizes(NumAllocations);
+
+    // Reproducible order in which the allocations are released
+    std::vector<size_t> FreeOrder(NumAllocations);
+    {
+        FastRand Rnd{1};
+        for (size_t i = 0; i < NumAllocations; ++i)
+            FreeOrder[i] = i;
+        for (size_t i = NumAllocations; i > 1; --i)
+            std::swap(FreeOrder[i - 1], FreeOrder[Rnd() % i]);
+    }
+
+    VariableSizeAllocationsManager Mgr{GetManagerCI()};
+
+    std::vector<VariableSizeAllocationsManager::Allocation> Allocations(NumAllocations);
+    for (auto _ : State)
+    {
+        for (size_t i = 0; i < NumAllocations; ++i)
+            Allocations[i] = Mgr.Allocate(Sizes[i], 16);
+        for (size_t i : FreeOrder)
+            Mgr.Free(std::move(Allocations[i]));
+    }
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumAllocations));
+}
+DILIGENT_BENCHMARK(BM_VariableSizeAllocationsManager_AllocateFree)->Arg(256)->Arg(4096);
+
+
+// Allocates Range(0) blocks in a fragmented manager where every other block of the
+// same size range is in use. Measures the free block search in the fragmented state.
+void BM_VariableSizeAllocationsManager_Fragmented(BenchmarkState& State)
+{
+    const size_t                  NumAllocations = static_cast<size_t>(State.Range(0));
+    const std::vector<OffsetType> Sizes          = GenerateAllocationSizes(NumAllocations * 2);
+
+    VariableSizeAllocationsManager Mgr{GetManagerCI()};
+
+    // Fragment the manager: allocate 2 * NumAllocations blocks and free every other one
+    std::vector<VariableSizeAllocationsManager::Allocation> Pinned;
+    {
+        std::vector<VariableSizeAllocationsManager::Allocation> Allocations(Sizes.size());
+        for (size_t i = 0; i < Sizes.size(); ++i)
+            Allocations[i] = Mgr.Allocate(Sizes[i], 16);
+        for (size_t i = 0; i < Sizes.size(); ++i)
+        {
+            if (i % 2 == 0)
+                Mgr.Free(std::move(Allocations[i]));
+            else
+                Pinned.emplace_back(std::move(Allocations[i]));
+        }
+    }
+
+    std::vector<VariableSizeAllocationsManager::Allocation> Allocations(NumAllocations);
+    for (auto _ : State)
+    {
+        for (size_t i = 0; i < NumAllocations; ++i)
+            Allocations[i] = Mgr.Allocate(Sizes[i * 2], 64);
+        for (VariableSizeAllocationsManager::Allocation& Alloc : Allocations)
+            Mgr.Free(std::move(Alloc));
+    }
+
+    for (VariableSizeAllocationsManager::Allocation& Alloc : Pinned)
+        Mgr.Free(std::move(Alloc));
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumAllocations));
+}
+DILIGENT_BENCHMARK(BM_VariableSizeAllocationsManager_Fragmented)->Arg(1024);
+
+} // namespace
@@ -0,0 +1,216 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "DynamicHeap.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <vector>
+#include <thread>
+#include <memory>
+#include <atomic>
+#include <chrono>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr size_t PageSize         = size_t{64} << 10;
+constexpr size_t PageAlignment    = 1024;
+constexpr size_t NumFrames        = 16;
+constexpr size_t NumPagesPerFrame = 32;
+
+template <typename ManagerType>
+class TestMasterBlockManager final : public ManagerType
+{
+public:
+    using ManagerType::ManagerType;
+    using ManagerType::AllocateMasterBlock;
+};
+
+// Mimics the render device release queues. The GPU is assumed to have already
+// finished the frame, so stale blocks are returned to the manager immediately.
+class TestDevice
+{
+public:
+    template <typename ObjectType>
+    void SafeReleaseDeviceObject(ObjectType&& Object, Uint64 /*QueueMask*/)
+    {
+        ObjectType StaleObject{std::move(Object)};
+    }
+};
+
+bool IsValidBlock(const DynamicHeap::MasterBlockListBasedManager::MasterBlock& Block)
+{
+    return Block.IsValid();
+}
+
+bool IsValidBlock(const DynamicHeap::MasterBlockRingBufferBasedManager::MasterBlock& Block)
+{
+    return Block != DynamicHeap::MasterBlockRingBufferBasedManager::InvalidOffset;
+}
+
+// Returns the blocks of the finished frame to the manager and the number of times the manager was locked.
+Uint32 FinishFrame(TestMasterBlockManager<DynamicHeap::MasterBlockListBasedManager>&   Mgr,
+                   std::vector<DynamicHeap::MasterBlockListBasedManager::MasterBlock>& Blocks)
+{
+    const bool HasBlocks = !Blocks.empty();
+    TestDevice Device;
+    Mgr.ReleaseMasterBlocks(Blocks, Device, 1);
+    return HasBlocks ? 1 : 0;
+}
+
+Uint32 FinishFrame(TestMasterBlockManager<DynamicHeap::MasterBlockRingBufferBasedManager>&   Mgr,
+                   std::vector<DynamicHeap::MasterBlockRingBufferBasedManager::MasterBlock>& Blocks)
+{
+    // All contexts share the ring buffer frame. Use the same fence value for every frame,
+    // so that the frames may be finished by the contexts in any order.
+    Mgr.DiscardMasterBlocks(Blocks, 0);
+    Mgr.ReleaseStaleBlocks(0);
+    Blocks.clear();
+    return 2;
+}
+
+// Every one of Range(0) contexts records NumFrames frames in its own thread and allocates NumPagesPerFrame
+// master blocks in every frame. Range(1) is the master block cache batch size, 0 disables the cache and
+// every page is allocated from the manager under its lock.
+//
+// Reported counters:
+//  - AllocNsPerPage - the average time it takes a context to get a page, including the time spent waiting
+//                     for and holding the manager lock.
+//  - LocksPerFrame  - the average number of times a context locks the manager in a frame, including the
+//                     end of the frame.
+template <typename ManagerType>
+void BM_DynamicHeap_MultiContextRecording(BenchmarkState& State)
+{
+    using MasterBlock = typename ManagerType::MasterBlock;
+    using CacheType   = DynamicHeap::MasterBlockCache<ManagerType>;
+
+    const size_t NumContexts = static_cast<size_t>(State.Range(0));
+    const Uint32 BatchSize   = static_cast<Uint32>(State.Range(1));
+
+    TestMasterBlockManager<ManagerType> Mgr{DefaultRawMemoryAllocator::GetAllocator(), static_cast<Uint32>(PageSize * NumPagesPerFrame * NumContexts * 2)};
+
+    std::vector<std::unique_ptr<CacheType>> Caches(NumContexts);
+    if (BatchSize > 0)
+    {
+        for (std::unique_ptr<CacheType>& Cache : Caches)
+            Cache = std::make_unique<CacheType>(Mgr, PageSize, PageAlignment, BatchSize);
+    }
+
+    std::atomic<Int64>  TotalAllocNs{0};
+    std::atomic<Uint64> TotalLocks{0};
+
+    auto RecordFrames = [&](size_t Ctx) {
+        CacheType* pCache = Caches[Ctx].get();
+
+        std::vector<MasterBlock> Blocks;
+        Blocks.reserve(NumPagesPerFrame);
+
+        std::chrono::nanoseconds AllocTime{0};
+        Uint64                   NumLocks  = 0;
+        Uint32                   TrimEpoch = Mgr.GetTrimEpoch();
+        for (size_t frame = 0; frame < NumFrames; ++frame)
+        {
+            const auto StartTime = std::chrono::high_resolution_clock::now();
+            for (size_t page = 0; page < NumPagesPerFrame; ++page)
+            {
+                MasterBlock Block;
+                if (pCache != nullptr)
+                {
+                    if constexpr (ManagerType::CachedBlocksExpireWithFrame)
+                    {
+                        // Drop the blocks that expired with the frame before checking if the cache needs to be refilled
+                        const Uint32 CurrTrimEpoch = Mgr.GetTrimEpoch();
+                        if (TrimEpoch != CurrTrimEpoch)
+                        {
+                            pCache->TrimIfRequested();
+                            TrimEpoch = CurrTrimEpoch;
+                        }
+                    }
+                    if (pCache->GetNumCachedBlocks() == 0)
+                        ++NumLocks;
+                    Block = pCache->Allocate();
+                }
+                else
+                {
+                    ++NumLocks;
+                    Block = Mgr.AllocateMasterBlock(PageSize, PageAlignment);
+                }
+                if (IsValidBlock(Block))
+                    Blocks.emplace_back(std::move(Block));
+            }
+            AllocTime += std::chrono::high_resolution_clock::now() - StartTime;
+
+            if (pCache != nullptr)
+            {
+                pCache->TrimIfRequested();
+                TrimEpoch = Mgr.GetTrimEpoch();
+            }
+            NumLocks += FinishFrame(Mgr, Blocks);
+        }
+
+        TotalAllocNs.fetch_add(static_cast<Int64>(AllocTime.count()));
+        TotalLocks.fetch_add(NumLocks);
+    };
+
+    std::vector<std::thread> Threads(NumContexts);
+    for (auto _ : State)
+    {
+        for (size_t i = 0; i < NumContexts; ++i)
+            Threads[i] = std::thread{RecordFrames, i};
+        for (std::thread& Thread : Threads)
+            Thread.join();
+    }
+
+    Caches.clear();
+    // Retire the blocks the caches have dropped
+    std::vector<MasterBlock> NoBlocks;
+    FinishFrame(Mgr, NoBlocks);
+
+    const double NumContextFrames = static_cast<double>(State.Iterations() * NumContexts * NumFrames);
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumContexts * NumFrames * NumPagesPerFrame));
+    State.SetCounter("AllocNsPerPage", static_cast<double>(TotalAllocNs.load()) / (NumContextFrames * NumPagesPerFrame));
+    State.SetCounter("LocksPerFrame", static_cast<double>(TotalLocks.load()) / NumContextFrames);
+}
+
+void BM_DynamicHeap_MultiContextRecording_ListBased(BenchmarkState& State)
+{
+    BM_DynamicHeap_MultiContextRecording<DynamicHeap::MasterBlockListBasedManager>(State);
+}
+DILIGENT_BENCHMARK(BM_DynamicHeap_MultiContextRecording_ListBased)->Args({1, 0})->Args({1, 8})->Args({8, 0})->Args({8, 8});
+
+void BM_DynamicHeap_MultiContextRecording_RingBufferBased(BenchmarkState& State)
+{
+    BM_DynamicHeap_MultiContextRecording<DynamicHeap::MasterBlockRingBufferBasedManager>(State);
+}
+DILIGENT_BENCHMARK(BM_DynamicHeap_MultiContextRecording_RingBufferBased)->Args({1, 0})->Args({1, 8})->Args({8, 0})->Args({8, 8});
+
+} // namespace
@@ -0,0 +1,201 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "BytecodeCache.h"
+#include "DataBlobImpl.hpp"
+#include "Serializer.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+#include "XXH128Hasher.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr size_t             NumShaders   = 2048;
+constexpr size_t             BytecodeSize = 16384;
+constexpr RENDER_DEVICE_TYPE DeviceType   = RENDER_DEVICE_TYPE_VULKAN;
+
+struct CacheElements
+{
+    std::vector<std::string>               Sources;
+    std::vector<ShaderCreateInfo>          ShaderCIs;
+    std::vector<RefCntAutoPtr<IDataBlob>> Bytecodes;
+
+    CacheElements() :
+        Sources(NumShaders),
+        ShaderCIs(NumShaders),
+        Bytecodes(NumShaders)
+    {
+        for (size_t i = 0; i < NumShaders; ++i)
+        {
+            Sources[i]                    = "SomeCode" + std::to_string(i);
+            ShaderCIs[i].Desc.ShaderType = SHADER_TYPE_COMPUTE;
+            ShaderCIs[i].Source          = Sources[i].c_str();
+
+            RefCntAutoPtr<DataBlobImpl> pBytecode = DataBlobImpl::Create(BytecodeSize);
+            memset(pBytecode->GetDataPtr(), static_cast<int>(i), BytecodeSize);
+            memcpy(pBytecode->GetDataPtr(), &i, sizeof(i));
+            Bytecodes[i] = pBytecode;
+        }
+    }
+};
+
+const CacheElements& GetCacheElements()
+{
+    static const CacheElements Elements;
+    return Elements;
+}
+
+// Writes the cache data in version 2 format, where every byte code is copied on load
+RefCntAutoPtr<IDataBlob> WriteVersion2CacheData(const CacheElements& Elements)
+{
+    auto WriteData = [&](auto& Stream) {
+        Uint32 Magic        = 0x7ADECACE;
+        Uint32 Version      = 2;
+        Uint64 ElementCount = NumShaders;
+        Stream(Magic, Version, ElementCount);
+
+        std::vector<XXH128Hash> Hashes;
+        for (const RefCntAutoPtr<IDataBlob>& pBytecode : Elements.Bytecodes)
+        {
+            XXH128State Hasher;
+            Hasher.UpdateRaw(pBytecode->GetConstDataPtr(), pBytecode->GetSize());
+            const XXH128Hash Hash     = Hasher.Digest();
+            size_t           DataSize = pBytecode->GetSize();
+            Stream(Hash.LowPart, Hash.HighPart, DataSize);
+            Stream.CopyBytes(pBytecode->GetConstDataPtr(), DataSize);
+            Hashes.push_back(Hash);
+        }
+
+        Uint64 AliasCount = NumShaders;
+        Stream(AliasCount);
+        for (size_t i = 0; i < NumShaders; ++i)
+        {
+            XXH128State Hasher;
+            Hasher.Update(Elements.ShaderCIs[i]);
+            Hasher.Update(DeviceType);
+            const XXH128Hash CIHash = Hasher.Digest();
+            Stream(CIHash.LowPart, CIHash.HighPart, Hashes[i].LowPart, Hashes[i].HighPart);
+        }
+    };
+
+    Serializer<SerializerMode::Measure> MeasureStream{};
+    WriteData(MeasureStream);
+    const SerializedData Memory = MeasureStream.AllocateData(DefaultRawMemoryAllocator::GetAllocator());
+
+    Serializer<SerializerMode::Write> WriteStream{Memory};
+    WriteData(WriteStream);
+    return RefCntAutoPtr<IDataBlob>{DataBlobImpl::Create(Memory.Size(), Memory.Ptr())};
+}
+
+RefCntAutoPtr<IDataBlob> WriteIndexedCacheData(const CacheElements& Elements)
+{
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    CreateBytecodeCache({DeviceType}, &pCache);
+    for (size_t i = 0; i < NumShaders; ++i)
+        pCache->AddBytecode(Elements.ShaderCIs[i], Elements.Bytecodes[i]);
+
+    RefCntAutoPtr<IDataBlob> pData;
+    pCache->Store(&pData);
+    return pData;
+}
+
+// Measures loading 32 MB of byte code. Range(0) is the cache data format version (2 or 3).
+// The CopiedBytes and CopiedBlobs counters report the memory the loaded cache allocates
+// for the byte code in addition to the cache data itself.
+void BM_BytecodeCache_Load(BenchmarkState& State)
+{
+    const CacheElements& Elements = GetCacheElements();
+
+    RefCntAutoPtr<IDataBlob> pData = State.Range(0) == 2 ?
+        WriteVersion2CacheData(Elements) :
+        WriteIndexedCacheData(Elements);
+    if (!pData)
+    {
+        State.SkipWithError("Failed to write the cache data");
+        return;
+    }
+
+    // Byte code that is not a view into the loaded data is a copy
+    size_t CopiedBytes = 0;
+    size_t CopiedBlobs = 0;
+    {
+        RefCntAutoPtr<IBytecodeCache> pCache;
+        CreateBytecodeCache({DeviceType}, &pCache);
+        if (!pCache->Load(pData))
+        {
+            State.SkipWithError("Failed to load the cache data");
+            return;
+        }
+
+        const Uint8* pDataStart = pData->GetConstDataPtr<Uint8>();
+        const Uint8* pDataEnd   = pDataStart + pData->GetSize();
+        for (const ShaderCreateInfo& ShaderCI : Elements.ShaderCIs)
+        {
+            RefCntAutoPtr<IDataBlob> pBytecode;
+            pCache->GetBytecode(ShaderCI, &pBytecode);
+            if (!pBytecode)
+            {
+                State.SkipWithError("Byte code is not found in the loaded cache");
+                return;
+            }
+
+            const Uint8* pBytecodeStart = pBytecode->GetConstDataPtr<Uint8>();
+            if (pBytecodeStart < pDataStart || pBytecodeStart >= pDataEnd)
+            {
+                CopiedBytes += pBytecode->GetSize();
+                ++CopiedBlobs;
+            }
+        }
+    }
+
+    RefCntAutoPtr<IBytecodeCache> pCache;
+    for (auto _ : State)
+    {
+        State.PauseTiming();
+        pCache.Release();
+        CreateBytecodeCache({DeviceType}, &pCache);
+        State.ResumeTiming();
+
+        pCache->Load(pData);
+        DoNotOptimize(pCache.RawPtr());
+    }
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumShaders));
+    State.SetCounter("CopiedBytes", static_cast<double>(CopiedBytes));
+    State.SetCounter("CopiedBlobs", static_cast<double>(CopiedBlobs));
+}
+DILIGENT_BENCHMARK(BM_BytecodeCache_Load)->Arg(2)->Arg(3);
+
+} // namespace
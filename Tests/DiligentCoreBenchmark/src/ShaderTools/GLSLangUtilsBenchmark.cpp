@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GLSLangUtils.hpp"
+#include "ThreadPool.hpp"
+
+#include <string>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr char TestGLSL[] = R"(
+#version 450
+
+layout(std140, binding = 0) uniform Constants
+{
+    mat4 g_WorldViewProj;
+    vec4 g_Color;
+};
+
+layout(binding = 1) uniform sampler2D g_Texture;
+
+layout(location = 0) in vec2 in_UV;
+layout(location = 0) out vec4 out_Color;
+
+void main()
+{
+    vec4 Color = g_Color;
+    for (int i = 0; i < PERMUTATION % 4 + 1; ++i)
+        Color *= texture(g_Texture, in_UV * float(i + 1));
+#if PERMUTATION % 2 == 0
+    Color = g_WorldViewProj * Color;
+#endif
+    out_Color = Color;
+}
+)";
+
+constexpr Uint32 NumPermutations = 64;
+
+// Compiles NumPermutations permutations of the test shader. Range(0) is the number of
+// worker threads; zero compiles the batch sequentially in the calling thread.
+void BM_GLSLangUtils_CompileSPIRVBatch(BenchmarkState& State)
+{
+    const Uint32 NumThreads = static_cast<Uint32>(State.Range(0));
+
+    RefCntAutoPtr<IThreadPool> pThreadPool;
+    if (NumThreads > 0)
+    {
+        pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{NumThreads});
+        if (!pThreadPool)
+        {
+            State.SkipWithError("Failed to create thread pool");
+            return;
+        }
+    }
+
+    GLSLangUtils::InitializeGlslang();
+
+    std::vector<std::string>      PermutationValues(NumPermutations);
+    std::vector<ShaderMacro>      Macros(NumPermutations);
+    std::vector<ShaderCreateInfo> Shaders(NumPermutations);
+    for (Uint32 i = 0; i < NumPermutations; ++i)
+    {
+        PermutationValues[i] = std::to_string(i);
+        Macros[i]            = {"PERMUTATION", PermutationValues[i].c_str()};
+
+        ShaderCreateInfo& ShaderCI = Shaders[i];
+        ShaderCI.SourceLanguage    = SHADER_SOURCE_LANGUAGE_GLSL_VERBATIM;
+        ShaderCI.Source            = TestGLSL;
+        ShaderCI.SourceLength      = sizeof(TestGLSL) - 1;
+        ShaderCI.Desc              = {"SPIRV batch benchmark shader", SHADER_TYPE_PIXEL};
+        ShaderCI.Macros            = {&Macros[i], 1};
+    }
+
+    GLSLangUtils::SPIRVBatchCompileAttribs Attribs;
+    Attribs.pShaders    = Shaders.data();
+    Attribs.NumShaders  = NumPermutations;
+    Attribs.pThreadPool = pThreadPool;
+
+    for (auto _ : State)
+    {
+        std::vector<std::vector<unsigned int>> SPIRVs = GLSLangUtils::CompileSPIRVBatch(Attribs);
+        DoNotOptimize(SPIRVs.data());
+    }
+
+    GLSLangUtils::FinalizeGlslang();
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * NumPermutations));
+}
+DILIGENT_BENCHMARK(BM_GLSLangUtils_CompileSPIRVBatch)->Arg(0)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+
+} // namespace
@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "HLSL2GLSLConverterImpl.hpp"
+
+#include <string>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+constexpr char TestHLSLHeader[] = R"(
+cbuffer cbConstants
+{
+    float4x4 g_WorldViewProj;
+    float4   g_Params;
+};
+
+Texture2D<float4>   g_ColorMap;
+SamplerState        g_ColorMap_sampler;
+Texture2DArray      g_ShadowMap;
+SamplerState        g_ShadowMap_sampler;
+StructuredBuffer<float4> g_Instances;
+
+struct PSInput
+{
+    float4 Pos   : SV_POSITION;
+    float3 Norm  : NORMAL;
+    float2 UV    : TEX_COORD;
+};
+)";
+
+// Helper function that is repeated to produce a large source. FUNC_ID is replaced with the function index.
+constexpr char TestHLSLFunction[] = R"(
+/* Shading helper FUNC_ID */
+float4 ShadeFUNC_ID(in PSInput PSIn, float Scale)
+{
+    float4 Color  = g_ColorMap.Sample(g_ColorMap_sampler, PSIn.UV * Scale);
+    float  Shadow = g_ShadowMap.SampleLevel(g_ShadowMap_sampler, float3(PSIn.UV, 0.0), 0.0).r;
+    [branch]
+    if (Color.a < 0.5f)
+    {
+        Color.rgb *= Shadow + g_Params.x; // Darken
+    }
+    [unroll]
+    for (int i = 0; i < 4; ++i)
+        Color.rgb += g_Instances[i].rgb * saturate(dot(PSIn.Norm, float3(0.0, 1.0, 0.0)));
+    return Color;
+}
+)";
+
+constexpr char TestHLSLEntryPoint[] = R"(
+float4 main(in PSInput PSIn) : SV_Target
+{
+    return Shade0(PSIn, 1.0);
+}
+)";
+
+// Converts the source that contains Range(0) helper functions to GLSL.
+void BM_HLSL2GLSLConverter_Convert(BenchmarkState& State)
+{
+    std::string Source = TestHLSLHeader;
+    for (Int64 i = 0; i < State.Range(0); ++i)
+    {
+        std::string Function = TestHLSLFunction;
+        const std::string FuncId = std::to_string(i);
+        for (size_t Pos = Function.find("FUNC_ID"); Pos != std::string::npos; Pos = Function.find("FUNC_ID", Pos))
+            Function.replace(Pos, 7, FuncId);
+        Source += Function;
+    }
+    Source += TestHLSLEntryPoint;
+
+    const HLSL2GLSLConverterImpl& Converter = HLSL2GLSLConverterImpl::GetInstance();
+
+    HLSL2GLSLConverterImpl::ConversionAttribs Attribs;
+    Attribs.HLSLSource    = Source.c_str();
+    Attribs.NumSymbols    = Source.length();
+    Attribs.EntryPoint    = "main";
+    Attribs.ShaderType    = SHADER_TYPE_PIXEL;
+    Attribs.InputFileName = "BenchmarkShader";
+    for (auto _ : State)
+    {
+        StringAlloc GLSLSource = Converter.Convert(Attribs);
+        if (GLSLSource.empty())
+        {
+            State.SkipWithError("Failed to convert HLSL source");
+            break;
+        }
+        DoNotOptimize(GLSLSource.data());
+    }
+
+    State.SetBytesProcessed(static_cast<Int64>(State.Iterations() * Source.size()));
+}
+DILIGENT_BENCHMARK(BM_HLSL2GLSLConverter_Convert)->Arg(1)->Arg(64)->Arg(1024);
+
+} // namespace
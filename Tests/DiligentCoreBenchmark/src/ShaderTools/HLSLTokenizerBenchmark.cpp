@@ -0,0 +1,170 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "HLSLTokenizer.hpp"
+#include "EngineMemory.h"
+
+#include <string>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Representative HLSL source with structures, resources, macros, comments and functions
+constexpr char TestHLSL[] = R"(
+#define NUM_LIGHTS 4
+#if NUM_LIGHTS > 0
+#    define USE_LIGHTS 1
+#endif
+
+/* Per-frame constants */
+cbuffer cbCameraAttribs
+{
+    float4x4 g_ViewProj;
+    float4x4 g_World;
+    float4   g_CameraPos;
+};
+
+struct LightAttribs
+{
+    float4 Direction;
+    float4 Color;
+};
+
+cbuffer cbLights
+{
+    LightAttribs g_Lights[NUM_LIGHTS];
+};
+
+Texture2D<float4>       g_BaseColorMap;
+SamplerState            g_BaseColorMap_sampler;
+Texture2DArray          g_ShadowMap;
+SamplerComparisonState  g_ShadowMap_sampler;
+StructuredBuffer<float4> g_Instances;
+RWTexture2D<float4>     g_OutputUAV;
+
+struct VSInput
+{
+    float3 Pos    : ATTRIB0;
+    float3 Normal : ATTRIB1;
+    float2 UV     : ATTRIB2;
+    uint   InstID : SV_InstanceID;
+};
+
+struct PSInput
+{
+    float4 Pos    : SV_POSITION;
+    float3 Normal : NORMAL;
+    float2 UV     : TEX_COORD;
+};
+
+void VSMain(in VSInput VSIn, out PSInput PSIn)
+{
+    float4 InstOffset = g_Instances[VSIn.InstID];
+    float4 WorldPos   = mul(float4(VSIn.Pos + InstOffset.xyz, 1.0), g_World);
+    PSIn.Pos    = mul(WorldPos, g_ViewProj);
+    PSIn.Normal = normalize(mul(float4(VSIn.Normal, 0.0), g_World).xyz);
+    PSIn.UV     = VSIn.UV;
+}
+
+float ComputeShadow(float3 ShadowUV, uint Cascade)
+{
+    return g_ShadowMap.SampleCmpLevelZero(g_ShadowMap_sampler, float3(ShadowUV.xy, float(Cascade)), ShadowUV.z);
+}
+
+// Pixel shader
+float4 PSMain(in PSInput PSIn) : SV_Target
+{
+    float4 BaseColor = g_BaseColorMap.Sample(g_BaseColorMap_sampler, PSIn.UV);
+    float3 Color     = float3(0.0, 0.0, 0.0);
+#if USE_LIGHTS
+    [unroll]
+    for (int i = 0; i < NUM_LIGHTS; ++i)
+    {
+        float NdotL = saturate(dot(PSIn.Normal, -g_Lights[i].Direction.xyz));
+        Color += BaseColor.rgb * g_Lights[i].Color.rgb * NdotL * ComputeShadow(PSIn.Pos.xyz, uint(i));
+    }
+#endif
+    return float4(Color, BaseColor.a);
+}
+)";
+
+// Tokenizes the test source repeated Range(0) times.
+void BM_HLSLTokenizer_Tokenize(BenchmarkState& State)
+{
+    std::string Source;
+    for (Int64 i = 0; i < State.Range(0); ++i)
+        Source += TestHLSL;
+
+    const Parsing::HLSLTokenizer Tokenizer;
+    for (auto _ : State)
+    {
+        Parsing::HLSLTokenizer::TokenListType Tokens = Tokenizer.Tokenize(Source);
+        DoNotOptimize(Tokens.size());
+    }
+
+    State.SetBytesProcessed(static_cast<Int64>(State.Iterations() * Source.size()));
+}
+DILIGENT_BENCHMARK(BM_HLSLTokenizer_Tokenize)->Arg(1)->Arg(16);
+
+
+// Tokenizes the test source repeated Range(0) times in arena mode.
+void BM_HLSLTokenizer_TokenizeArena(BenchmarkState& State)
+{
+    std::string Source;
+    for (Int64 i = 0; i < State.Range(0); ++i)
+        Source += TestHLSL;
+
+    const Parsing::HLSLTokenizer Tokenizer;
+    for (auto _ : State)
+    {
+        Parsing::HLSLTokenArena               Arena{GetRawAllocator()};
+        Parsing::HLSLTokenizer::TokenListType Tokens = Tokenizer.Tokenize(Source, Arena);
+        DoNotOptimize(Tokens.size());
+    }
+
+    State.SetBytesProcessed(static_cast<Int64>(State.Iterations() * Source.size()));
+}
+DILIGENT_BENCHMARK(BM_HLSLTokenizer_TokenizeArena)->Arg(1)->Arg(16);
+
+
+// Creates the tokenizer, which initializes the keyword hash map.
+void BM_HLSLTokenizer_Create(BenchmarkState& State)
+{
+    for (auto _ : State)
+    {
+        Parsing::HLSLTokenizer Tokenizer;
+        DoNotOptimize(Tokenizer);
+    }
+}
+DILIGENT_BENCHMARK(BM_HLSLTokenizer_Create);
+
+} // namespace
@@ -0,0 +1,166 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVShaderResources.hpp"
+#include "GLSLangUtils.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
+
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Fragment shader that uses every commonly used resource type
+constexpr char TestGLSL[] = R"(
+#version 450
+
+layout(std140, binding = 0) uniform CameraAttribs
+{
+    mat4 g_ViewProj;
+    mat4 g_World;
+    vec4 g_CameraPos;
+    vec4 g_Params[16];
+};
+
+struct MaterialAttribs
+{
+    vec4  BaseColor;
+    vec4  Emissive;
+    float Roughness;
+    float Metallic;
+    vec2  Padding;
+};
+
+layout(std430, binding = 1) readonly buffer Materials
+{
+    MaterialAttribs g_Materials[];
+};
+
+layout(std430, binding = 2) buffer Counters
+{
+    uint g_Counters[];
+};
+
+layout(binding = 3) uniform sampler2D g_BaseColorMap;
+layout(binding = 4) uniform sampler2D g_NormalMap;
+layout(binding = 5) uniform sampler2DArrayShadow g_ShadowMap;
+layout(binding = 6) uniform samplerCube g_EnvMap[4];
+layout(binding = 7, rgba8) uniform writeonly image2D g_OutputImage;
+layout(binding = 8) uniform samplerBuffer g_InstanceData;
+
+layout(push_constant) uniform PushConstants
+{
+    uint  g_MaterialId;
+    float g_Time;
+};
+
+layout(location = 0) in vec3 in_Normal;
+layout(location = 1) in vec2 in_UV;
+layout(location = 2) in vec4 in_ShadowPos;
+
+layout(location = 0) out vec4 out_Color;
+
+void main()
+{
+    MaterialAttribs Mat = g_Materials[g_MaterialId];
+
+    vec4  BaseColor = texture(g_BaseColorMap, in_UV) * Mat.BaseColor;
+    vec3  Normal    = normalize(in_Normal + texture(g_NormalMap, in_UV).xyz);
+    float Shadow    = texture(g_ShadowMap, in_ShadowPos);
+    vec4  Env       = texture(g_EnvMap[g_MaterialId & 3u], Normal);
+    vec4  Instance  = texelFetch(g_InstanceData, int(g_MaterialId));
+
+    out_Color = BaseColor * Shadow + Env * Mat.Metallic + Instance * g_Params[g_MaterialId & 15u] + Mat.Emissive * g_Time;
+    out_Color = g_ViewProj * g_World * out_Color + g_CameraPos;
+    imageStore(g_OutputImage, ivec2(gl_FragCoord.xy), out_Color);
+    atomicAdd(g_Counters[g_MaterialId], 1u);
+}
+)";
+
+const std::vector<unsigned int>& GetTestSPIRV()
+{
+    static const std::vector<unsigned int> SPIRV = []() {
+        GLSLangUtils::InitializeGlslang();
+
+        GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+        Attribs.ShaderType    = SHADER_TYPE_PIXEL;
+        Attribs.ShaderSource  = TestGLSL;
+        Attribs.SourceCodeLen = static_cast<int>(sizeof(TestGLSL) - 1);
+        std::vector<unsigned int> SPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+
+        GLSLangUtils::FinalizeGlslang();
+        return SPIRV;
+    }();
+    return SPIRV;
+}
+
+// Loads resources from the SPIR-V byte code. Range(0) != 0 also enables the stage input
+// and uniform buffer reflection that is used by the shader loading in the engine.
+void CreateSPIRVShaderResources(BenchmarkState& State, bool UseSPIRVCross)
+{
+    const std::vector<unsigned int>& SPIRV = GetTestSPIRV();
+    if (SPIRV.empty())
+    {
+        State.SkipWithError("Failed to compile the test shader to SPIR-V");
+        return;
+    }
+
+    SPIRVShaderResources::CreateInfo ResCI;
+    ResCI.ShaderType                  = SHADER_TYPE_PIXEL;
+    ResCI.Name                        = "SPIRV benchmark shader";
+    ResCI.LoadShaderStageInputs       = State.Range(0) != 0;
+    ResCI.LoadUniformBufferReflection = State.Range(0) != 0;
+    ResCI.UseSPIRVCross               = UseSPIRVCross;
+
+    IMemoryAllocator& Allocator = DefaultRawMemoryAllocator::GetAllocator();
+    for (auto _ : State)
+    {
+        SPIRVShaderResources Resources{Allocator, SPIRV, ResCI};
+        DoNotOptimize(Resources.GetTotalResources());
+    }
+
+    State.SetBytesProcessed(static_cast<Int64>(State.Iterations() * SPIRV.size() * sizeof(SPIRV[0])));
+}
+
+void BM_SPIRVShaderResources_Create(BenchmarkState& State)
+{
+    CreateSPIRVShaderResources(State, /*UseSPIRVCross = */ false);
+}
+DILIGENT_BENCHMARK(BM_SPIRVShaderResources_Create)->Arg(0)->Arg(1);
+
+void BM_SPIRVShaderResources_CreateWithSPIRVCross(BenchmarkState& State)
+{
+    CreateSPIRVShaderResources(State, /*UseSPIRVCross = */ true);
+}
+DILIGENT_BENCHMARK(BM_SPIRVShaderResources_CreateWithSPIRVCross)->Arg(0)->Arg(1);
+
+} // namespace
@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVTools.hpp"
+#include "GLSLangUtils.hpp"
+
+#include <string>
+#include <vector>
+
+#include "BenchmarkFramework.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Benchmarking;
+
+namespace
+{
+
+// Small compute shader, typical for post-processing and GPU-driven rendering passes
+constexpr char TestComputeGLSL[] = R"(
+#version 450
+
+layout(local_size_x = 64) in;
+
+layout(std430, binding = 0) readonly buffer InputBuffer
+{
+    vec4 g_Input[];
+};
+
+layout(std430, binding = 1) writeonly buffer OutputBuffer
+{
+    vec4 g_Output[];
+};
+
+layout(std140, binding = 2) uniform Constants
+{
+    vec4 g_Scale;
+    uint g_Count;
+};
+
+void main()
+{
+    uint Idx = gl_GlobalInvocationID.x;
+    if (Idx >= g_Count)
+        return;
+
+    vec4 Value = g_Input[Idx];
+    for (int i = 0; i < VARIANT + 1; ++i)
+        Value = Value * g_Scale + vec4(float(i));
+    g_Output[Idx] = Value;
+}
+)";
+
+constexpr Uint32 NumShaders = 16;
+
+const std::vector<std::vector<uint32_t>>& GetTestCorpus()
+{
+    static const std::vector<std::vector<uint32_t>> Corpus = []() {
+        GLSLangUtils::InitializeGlslang();
+
+        std::vector<std::vector<uint32_t>> Corpus;
+        for (Uint32 i = 0; i < NumShaders; ++i)
+        {
+            const std::string Variant = std::to_string(i);
+            const ShaderMacro Macros[] = {{"VARIANT", Variant.c_str()}};
+
+            GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+            Attribs.ShaderType        = SHADER_TYPE_COMPUTE;
+            Attribs.ShaderSource      = TestComputeGLSL;
+            Attribs.SourceCodeLen     = static_cast<int>(sizeof(TestComputeGLSL) - 1);
+            Attribs.Macros            = {Macros, _countof(Macros)};
+            Attribs.OptimizationLevel = SHADER_OPTIMIZATION_LEVEL_DISABLED;
+
+            std::vector<uint32_t> SPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+            if (SPIRV.empty())
+                return std::vector<std::vector<uint32_t>>{};
+            Corpus.emplace_back(std::move(SPIRV));
+        }
+
+        GLSLangUtils::FinalizeGlslang();
+        return Corpus;
+    }();
+    return Corpus;
+}
+
+// Optimizes every shader in the corpus with the performance passes.
+void BM_SPIRVTools_Optimize(BenchmarkState& State)
+{
+    const std::vector<std::vector<uint32_t>>& Corpus = GetTestCorpus();
+    if (Corpus.empty())
+    {
+        State.SkipWithError("Failed to compile the test shaders to SPIR-V");
+        return;
+    }
+
+    for (auto _ : State)
+    {
+        for (const std::vector<uint32_t>& SPIRV : Corpus)
+        {
+            std::vector<uint32_t> OptimizedSPIRV = OptimizeSPIRV(SPIRV, SPIRV_OPTIMIZATION_FLAG_PERFORMANCE);
+            DoNotOptimize(OptimizedSPIRV.data());
+        }
+    }
+
+    State.SetItemsProcessed(static_cast<Int64>(State.Iterations() * Corpus.size()));
+}
+DILIGENT_BENCHMARK(BM_SPIRVTools_Optimize);
+
+} // namespace
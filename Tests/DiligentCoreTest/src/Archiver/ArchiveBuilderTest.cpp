@@ -0,0 +1,418 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <string>
+
+#include "ArchiveBuilder.hpp"
+#include "ArchiverFactoryLoader.h"
+#include "SerializationDevice.h"
+#include "FileWrapper.hpp"
+#include "FileSystem.hpp"
+#include "TempDirectory.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+void WriteTextFile(const std::string& Path, const std::string& Text)
+{
+    FileWrapper File{Path.c_str(), EFileAccessMode::Overwrite};
+    ASSERT_TRUE(File) << Path;
+    EXPECT_TRUE(File->Write(Text.data(), Text.size())) << Path;
+}
+
+std::string WriteManifest(const TempDirectory& TmpDir, const std::string& Text)
+{
+    const std::string Path = TmpDir.Get() + FileSystem::SlashSymbol + "Manifest.json";
+    WriteTextFile(Path, Text);
+    return Path;
+}
+
+TEST(ArchiveBuilder_Manifest, Load)
+{
+    TempDirectory TmpDir;
+
+    const std::string ManifestPath = WriteManifest(TmpDir, R"({
+    "output": "out/Test.bin",
+    "content_version": 7,
+    "devices": ["vulkan", "gl"],
+    "search_directories": ["Shaders"],
+    "shaders": [
+        {
+            "name": "VS",
+            "file": "VS.vsh",
+            "type": "vs",
+            "language": "hlsl",
+            "macros": {"INT": 3, "FLOAT": 0.5, "BOOL": true, "STR": "x"}
+        },
+        {"name": "PS", "file": "PS.psh", "type": "ps", "entry_point": "PSMain", "archive": true},
+        {"name": "CS", "file": "CS.csh", "type": "cs"}
+    ],
+    "signatures": [
+        {
+            "name": "Sign",
+            "binding_index": 1,
+            "use_combined_texture_samplers": true,
+            "resources": [
+                {"name": "cbConstants", "stages": ["vs", "ps"], "type": "constant_buffer", "var_type": "static"},
+                {"name": "g_Texture", "stages": "ps", "type": "texture_srv", "var_type": "dynamic", "array_size": 2}
+            ],
+            "immutable_samplers": [
+                {"name": "g_Texture", "stages": "ps", "filter": "point", "address": "wrap"}
+            ]
+        }
+    ],
+    "pipelines": [
+        {
+            "name": "Graphics PSO",
+            "shaders": {"vs": "VS", "ps": "PS"},
+            "signatures": ["Sign"],
+            "rtv_formats": ["RGBA8_UNORM", "TEX_FORMAT_R32_FLOAT"],
+            "dsv_format": "D32_FLOAT",
+            "cull_mode": "none",
+            "depth_enable": false,
+            "input_layout": [
+                {"buffer_slot": 0, "num_components": 3},
+                {"input_index": 1, "buffer_slot": 1, "num_components": 4, "value_type": "uint8"}
+            ],
+            "strip_reflection": true
+        },
+        {"name": "Compute PSO", "type": "compute", "shaders": {"cs": "CS"}, "default_variable_type": "mutable"}
+    ]
+})");
+
+    const ArchiveManifest Manifest = ArchiveManifest::Load(ManifestPath.c_str());
+
+    // Relative paths are resolved against the manifest directory
+    EXPECT_EQ(Manifest.OutputPath, FileSystem::SimplifyPath((TmpDir.Get() + "/out/Test.bin").c_str()));
+    ASSERT_EQ(Manifest.SearchDirectories.size(), size_t{1});
+    EXPECT_EQ(Manifest.SearchDirectories[0], FileSystem::SimplifyPath((TmpDir.Get() + "/Shaders").c_str()));
+    EXPECT_EQ(Manifest.ContentVersion, 7u);
+    EXPECT_EQ(Manifest.DeviceFlags, ARCHIVE_DEVICE_DATA_FLAG_VULKAN | ARCHIVE_DEVICE_DATA_FLAG_GL);
+
+    ASSERT_EQ(Manifest.Shaders.size(), size_t{3});
+    {
+        const ArchiveManifest::ShaderInfo& VS = Manifest.Shaders[0];
+        EXPECT_EQ(VS.Name, "VS");
+        EXPECT_EQ(VS.FilePath, "VS.vsh");
+        EXPECT_EQ(VS.EntryPoint, "main");
+        EXPECT_EQ(VS.Type, SHADER_TYPE_VERTEX);
+        EXPECT_EQ(VS.SourceLanguage, SHADER_SOURCE_LANGUAGE_HLSL);
+        EXPECT_FALSE(VS.Archive);
+
+        const std::vector<std::pair<std::string, std::string>> RefMacros = {
+            {"INT", "3"},
+            {"FLOAT", std::to_string(0.5)},
+            {"BOOL", "1"},
+            {"STR", "x"},
+        };
+        EXPECT_EQ(VS.Macros, RefMacros);
+
+        EXPECT_EQ(Manifest.Shaders[1].EntryPoint, "PSMain");
+        EXPECT_TRUE(Manifest.Shaders[1].Archive);
+    }
+    EXPECT_EQ(Manifest.FindShader("CS"), &Manifest.Shaders[2]);
+    EXPECT_EQ(Manifest.FindShader("Missing"), nullptr);
+
+    ASSERT_EQ(Manifest.Signatures.size(), size_t{1});
+    {
+        const PipelineResourceSignatureDescX& Sign = Manifest.Signatures[0];
+        EXPECT_STREQ(Sign.Name, "Sign");
+        EXPECT_EQ(Sign.BindingIndex, 1);
+        EXPECT_TRUE(Sign.UseCombinedTextureSamplers);
+        ASSERT_EQ(Sign.NumResources, 2u);
+        EXPECT_EQ(Sign.Resources[0], (PipelineResourceDesc{SHADER_TYPE_VERTEX | SHADER_TYPE_PIXEL, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_STATIC}));
+        EXPECT_EQ(Sign.Resources[1], (PipelineResourceDesc{SHADER_TYPE_PIXEL, "g_Texture", 2, SHADER_RESOURCE_TYPE_TEXTURE_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}));
+        ASSERT_EQ(Sign.NumImmutableSamplers, 1u);
+        EXPECT_EQ(Sign.ImmutableSamplers[0].Desc.MinFilter, FILTER_TYPE_POINT);
+        EXPECT_EQ(Sign.ImmutableSamplers[0].Desc.AddressU, TEXTURE_ADDRESS_WRAP);
+    }
+    EXPECT_EQ(Manifest.FindSignature("Sign"), &Manifest.Signatures[0]);
+
+    ASSERT_EQ(Manifest.Pipelines.size(), size_t{2});
+    {
+        const ArchiveManifest::PipelineInfo& PSO = Manifest.Pipelines[0];
+        EXPECT_EQ(PSO.Type, PIPELINE_TYPE_GRAPHICS);
+        EXPECT_STREQ(PSO.GetName(), "Graphics PSO");
+        EXPECT_EQ(PSO.ArchiveFlags, PSO_ARCHIVE_FLAG_STRIP_REFLECTION);
+        ASSERT_EQ(PSO.Shaders.size(), size_t{2});
+        EXPECT_EQ(PSO.Shaders[0], std::make_pair(SHADER_TYPE_VERTEX, std::string{"VS"}));
+        EXPECT_EQ(PSO.Shaders[1], std::make_pair(SHADER_TYPE_PIXEL, std::string{"PS"}));
+        EXPECT_EQ(PSO.Signatures, std::vector<std::string>{"Sign"});
+
+        const GraphicsPipelineDesc& GraphicsPipeline = PSO.GraphicsCI.GraphicsPipeline;
+        EXPECT_EQ(GraphicsPipeline.NumRenderTargets, 2);
+        EXPECT_EQ(GraphicsPipeline.RTVFormats[0], TEX_FORMAT_RGBA8_UNORM);
+        EXPECT_EQ(GraphicsPipeline.RTVFormats[1], TEX_FORMAT_R32_FLOAT);
+        EXPECT_EQ(GraphicsPipeline.DSVFormat, TEX_FORMAT_D32_FLOAT);
+        EXPECT_EQ(GraphicsPipeline.RasterizerDesc.CullMode, CULL_MODE_NONE);
+        EXPECT_FALSE(GraphicsPipeline.DepthStencilDesc.DepthEnable);
+        ASSERT_EQ(GraphicsPipeline.InputLayout.NumElements, 2u);
+        EXPECT_EQ(GraphicsPipeline.InputLayout.LayoutElements[0].ValueType, VT_FLOAT32);
+        EXPECT_FALSE(GraphicsPipeline.InputLayout.LayoutElements[0].IsNormalized);
+        EXPECT_EQ(GraphicsPipeline.InputLayout.LayoutElements[1].ValueType, VT_UINT8);
+        EXPECT_TRUE(GraphicsPipeline.InputLayout.LayoutElements[1].IsNormalized);
+    }
+    {
+        const ArchiveManifest::PipelineInfo& PSO = Manifest.Pipelines[1];
+        EXPECT_EQ(PSO.Type, PIPELINE_TYPE_COMPUTE);
+        EXPECT_STREQ(PSO.GetName(), "Compute PSO");
+        EXPECT_EQ(PSO.ComputeCI.PSODesc.PipelineType, PIPELINE_TYPE_COMPUTE);
+        EXPECT_EQ(PSO.ComputeCI.PSODesc.ResourceLayout.DefaultVariableType, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE);
+    }
+}
+
+TEST(ArchiveBuilder_Manifest, ValidationErrors)
+{
+    TempDirectory TmpDir;
+
+    const std::pair<const char*, const char*> Manifests[] = {
+        {R"({"shaders": []})", "'devices' must specify at least one device type"},
+        {R"({"devices": "dx9"})", "'dx9' is not a valid value for 'devices'"},
+        {R"({"devices": "gl", "unknown": 1})", "Unknown member 'unknown'"},
+        {R"({"devices": "gl", "content_version": -1})", "'content_version' must be a non-negative 32-bit integer"},
+        {R"({"devices": "gl", "shaders": {}})", "'shaders' must be array, but it is object"},
+        {R"({"devices": "gl", "shaders": [{"name": "S", "type": "vs"}]})", "Required member 'shaders[0].file' is missing"},
+        {R"({"devices": "gl", "shaders": [{"name": "S", "file": "S.vsh", "type": "vertex"}]})", "'vertex' is not a valid value for 'shaders[0].type'"},
+        {R"({"devices": "gl", "shaders": [{"name": "S", "file": "S.vsh", "type": "all"}]})", "'shaders[0].type' must specify a single shader stage"},
+        {R"({"devices": "gl", "shaders": [{"name": "S", "file": "S.vsh", "type": "vs", "entry": "main"}]})", "Unknown member 'shaders[0].entry'"},
+        {R"({"devices": "gl", "shaders": [{"name": "S", "file": "S.vsh", "type": "vs"}, {"name": "S", "file": "S2.vsh", "type": "vs"}]})", "Shader name 'S' is not unique"},
+        {R"({"devices": "gl", "signatures": [{"name": "R"}, {"name": "R"}]})", "Resource signature name 'R' is not unique"},
+        {R"({"devices": "gl", "signatures": [{"name": "R", "resources": [{"name": "r", "stages": "ps", "type": "texture"}]}]})", "'texture' is not a valid value for 'signatures[0].resources[0].type'"},
+        {R"({"devices": "gl", "pipelines": [{"name": "P"}]})", "Required member 'pipelines[0].shaders' is missing"},
+        {R"({"devices": "gl", "pipelines": [{"name": "P", "shaders": {"xs": "S"}}]})", "Unknown member 'pipelines[0].shaders.xs'"},
+        {R"({"devices": "gl", "pipelines": [{"name": "P", "shaders": {"vs": "S"}}]})", "Pipeline 'P' references unknown shader 'S'"},
+        {R"({"devices": "gl", "shaders": [{"name": "S", "file": "S.psh", "type": "ps"}], "pipelines": [{"name": "P", "shaders": {"vs": "S"}}]})", "Shader 'S' is used as SHADER_TYPE_VERTEX in pipeline 'P', but its type is SHADER_TYPE_PIXEL"},
+        {R"({"devices": "gl", "pipelines": [{"name": "P", "shaders": {}, "signatures": ["R"]}]})", "Pipeline 'P' references unknown resource signature 'R'"},
+        {R"({"devices": "gl", "pipelines": [{"name": "P", "shaders": {}}, {"name": "P", "shaders": {}}]})", "Pipeline name 'P' is not unique"},
+        {R"({"devices": "gl", "pipelines": [{"name": "P", "shaders": {}, "rtv_formats": ["RGBA9"]}]})", "'RGBA9' is not a valid texture format for 'pipelines[0].rtv_formats[0]'"},
+        {R"({"devices": "gl",})", "member name expected"},
+    };
+
+    for (const auto& Manifest : Manifests)
+    {
+        const std::string ManifestPath = WriteManifest(TmpDir, Manifest.first);
+
+        TestingEnvironment::ErrorScope ExpectedErrors{Manifest.second};
+        EXPECT_THROW(ArchiveManifest::Load(ManifestPath.c_str()), std::runtime_error) << Manifest.first;
+    }
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to read manifest file"};
+        EXPECT_THROW(ArchiveManifest::Load((TmpDir.Get() + "/Missing.json").c_str()), std::runtime_error);
+    }
+}
+
+class ArchiveBuilderTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        IArchiverFactory* pArchiverFactory = LoadAndGetArchiverFactory();
+        ASSERT_NE(pArchiverFactory, nullptr);
+
+        RefCntAutoPtr<ISerializationDevice> pDevice;
+        pArchiverFactory->CreateSerializationDevice(SerializationDeviceCreateInfo{}, &pDevice);
+        ASSERT_NE(pDevice, nullptr);
+
+        // Use a single device type that does not require a platform-specific compiler if possible
+        const std::pair<ARCHIVE_DEVICE_DATA_FLAGS, const char*> Devices[] = {
+            {ARCHIVE_DEVICE_DATA_FLAG_GL, "gl"},
+            {ARCHIVE_DEVICE_DATA_FLAG_VULKAN, "vulkan"},
+            {ARCHIVE_DEVICE_DATA_FLAG_GLES, "gles"},
+            {ARCHIVE_DEVICE_DATA_FLAG_D3D12, "d3d12"},
+            {ARCHIVE_DEVICE_DATA_FLAG_D3D11, "d3d11"},
+            {ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS, "metal_macos"},
+            {ARCHIVE_DEVICE_DATA_FLAG_WEBGPU, "webgpu"},
+        };
+        for (const auto& Device : Devices)
+        {
+            if ((pDevice->GetSupportedDeviceFlags() & Device.first) != 0)
+            {
+                m_DeviceName = Device.second;
+                break;
+            }
+        }
+    }
+
+    void SetUp() override
+    {
+        if (m_DeviceName == nullptr)
+            GTEST_SKIP() << "The archiver does not support any device type";
+    }
+
+    struct ManifestParams
+    {
+        std::string ValueB   = "2";
+        bool        IncludeB = true;
+    };
+
+    std::string GetManifest(const ManifestParams& Params) const
+    {
+        std::string Manifest = R"({
+    "output": "Archive.bin",
+    "devices": ")";
+        Manifest += m_DeviceName;
+        Manifest += R"(",
+    "shaders": [
+        {"name": "CS A", "file": "A.csh", "type": "cs", "language": "hlsl"},
+        {"name": "CS B", "file": "B.csh", "type": "cs", "language": "hlsl", "macros": {"VALUE": )";
+        Manifest += Params.ValueB;
+        Manifest += R"(}}
+    ],
+    "signatures": [
+        {
+            "name": "Signature",
+            "resources": [
+                {"name": "g_Buffer", "stages": "cs", "type": "buffer_uav", "var_type": "mutable"}
+            ]
+        }
+    ],
+    "pipelines": [
+        {"name": "PSO A", "type": "compute", "shaders": {"cs": "CS A"}, "signatures": ["Signature"]})";
+        if (Params.IncludeB)
+            Manifest += R"(,
+        {"name": "PSO B", "type": "compute", "shaders": {"cs": "CS B"}, "signatures": ["Signature"]})";
+        Manifest += R"(
+    ]
+})";
+        return Manifest;
+    }
+
+    static ArchiveBuilder::Statistics Build(const std::string& ManifestPath, bool ForceRebuild = false)
+    {
+        const ArchiveManifest Manifest = ArchiveManifest::Load(ManifestPath.c_str());
+
+        ArchiveBuilderSettings Settings;
+        Settings.ForceRebuild = ForceRebuild;
+
+        ArchiveBuilder Builder{LoadAndGetArchiverFactory(), Manifest, Settings};
+        EXPECT_TRUE(Builder.Build());
+        return Builder.GetStatistics();
+    }
+
+    static const char* m_DeviceName;
+};
+
+const char* ArchiveBuilderTest::m_DeviceName = nullptr;
+
+TEST_F(ArchiveBuilderTest, IncrementalBuild)
+{
+    TempDirectory TmpDir;
+
+    const std::string& Dir          = TmpDir.Get();
+    const std::string  ArchivePath  = Dir + FileSystem::SlashSymbol + "Archive.bin";
+    const std::string  CacheDir     = ArchivePath + ".cache";
+    const std::string  CommonPath   = Dir + FileSystem::SlashSymbol + "Common.fxh";
+    const std::string  ShaderAPath  = Dir + FileSystem::SlashSymbol + "A.csh";
+    const std::string  ShaderBPath  = Dir + FileSystem::SlashSymbol + "B.csh";
+    const std::string  ManifestPath = WriteManifest(TmpDir, GetManifest({}));
+
+    WriteTextFile(CommonPath, "#define COMMON_VALUE 1\n");
+    WriteTextFile(ShaderAPath, R"(
+#include "Common.fxh"
+RWStructuredBuffer<uint> g_Buffer;
+[numthreads(1, 1, 1)]
+void main(uint3 id : SV_DispatchThreadID)
+{
+    g_Buffer[id.x] = COMMON_VALUE;
+}
+)");
+    const std::string ShaderB = R"(
+RWStructuredBuffer<uint> g_Buffer;
+[numthreads(1, 1, 1)]
+void main(uint3 id : SV_DispatchThreadID)
+{
+    g_Buffer[id.x] = VALUE;
+}
+)";
+    WriteTextFile(ShaderBPath, ShaderB);
+
+    auto CheckStats = [](const ArchiveBuilder::Statistics& Stats, Uint32 NumObjects, Uint32 NumCompiled, bool UpToDate) {
+        EXPECT_EQ(Stats.NumObjects, NumObjects);
+        EXPECT_EQ(Stats.NumCompiled, NumCompiled);
+        EXPECT_EQ(Stats.NumCached, NumObjects - NumCompiled);
+        EXPECT_EQ(Stats.UpToDate, UpToDate);
+    };
+
+    auto GetNumCacheFiles = [&CacheDir]() {
+        return FileSystem::Search((CacheDir + FileSystem::SlashSymbol + "*.bin").c_str()).size();
+    };
+
+    // The signature and two pipelines; shaders used by pipelines are not archived separately
+    CheckStats(Build(ManifestPath), 3, 3, false);
+    EXPECT_TRUE(FileSystem::FileExists(ArchivePath.c_str()));
+    EXPECT_EQ(GetNumCacheFiles(), size_t{3});
+
+    // Nothing has changed
+    CheckStats(Build(ManifestPath), 3, 0, true);
+
+    // Changing the include file only invalidates the pipeline whose shader includes it
+    WriteTextFile(CommonPath, "#define COMMON_VALUE 2\n");
+    CheckStats(Build(ManifestPath), 3, 1, false);
+    CheckStats(Build(ManifestPath), 3, 0, true);
+
+    // Changing the source file
+    WriteTextFile(ShaderBPath, ShaderB + "// Modified\n");
+    CheckStats(Build(ManifestPath), 3, 1, false);
+
+    // Changing the shader macros in the manifest
+    {
+        ManifestParams Params;
+        Params.ValueB = "3";
+        WriteManifest(TmpDir, GetManifest(Params));
+    }
+    CheckStats(Build(ManifestPath), 3, 1, false);
+    // The archive of the previous version of the pipeline is removed from the cache
+    EXPECT_EQ(GetNumCacheFiles(), size_t{3});
+
+    WriteManifest(TmpDir, GetManifest({}));
+    CheckStats(Build(ManifestPath), 3, 1, false);
+
+    // The output archive is written again if it has been deleted
+    FileSystem::DeleteFile(ArchivePath.c_str());
+    CheckStats(Build(ManifestPath), 3, 0, false);
+    EXPECT_TRUE(FileSystem::FileExists(ArchivePath.c_str()));
+
+    CheckStats(Build(ManifestPath, /*ForceRebuild = */ true), 3, 3, false);
+
+    // Archives of the objects that are no longer in the manifest are removed from the cache
+    {
+        const size_t NumCacheFiles = GetNumCacheFiles();
+        ManifestParams Params;
+        Params.IncludeB = false;
+        WriteManifest(TmpDir, GetManifest(Params));
+        CheckStats(Build(ManifestPath), 2, 0, false);
+        EXPECT_EQ(GetNumCacheFiles(), NumCacheFiles - 1);
+    }
+}
+
+} // namespace
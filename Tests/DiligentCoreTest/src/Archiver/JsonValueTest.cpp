@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+
+#include "JsonValue.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+JsonValue Parse(const char* Text)
+{
+    return JsonValue::Parse(Text, strlen(Text), "test.json");
+}
+
+TEST(ArchiveBuilder_JsonValue, ParseValid)
+{
+    const char* Text = R"(
+// Comments are allowed before the document
+{
+    "null":   null,
+    "true":   true,
+    "false":  false, // and after values
+    "int":    42,
+    "neg":    -1.5e2,
+    "frac":   0.25,
+    "string": "a\"b\\c\/d\n\t\u0041",
+    "empty_array":  [],
+    "empty_object": {},
+    "array":  [1, "two", [3], {"four": 4}],
+    "object": {"b": 1, "a": 2}
+})";
+
+    const JsonValue Root = Parse(Text);
+    ASSERT_TRUE(Root.IsObject());
+
+    const auto& Members = Root.AsObject("");
+    ASSERT_EQ(Members.size(), size_t{11});
+    // Members are kept in the document order
+    EXPECT_EQ(Members[0].first, "null");
+    EXPECT_EQ(Members[10].first, "object");
+
+    ASSERT_NE(Root.Find("null"), nullptr);
+    EXPECT_TRUE(Root.Find("null")->IsNull());
+    EXPECT_TRUE(Root.Find("true")->AsBool("true"));
+    EXPECT_FALSE(Root.Find("false")->AsBool("false"));
+    EXPECT_EQ(Root.Find("int")->AsUint("int"), 42u);
+    EXPECT_EQ(Root.Find("neg")->AsNumber("neg"), -150.0);
+    EXPECT_EQ(Root.Find("frac")->AsNumber("frac"), 0.25);
+    EXPECT_EQ(Root.Find("string")->AsString("string"), "a\"b\\c/d\n\tA");
+    EXPECT_TRUE(Root.Find("empty_array")->AsArray("empty_array").empty());
+    EXPECT_TRUE(Root.Find("empty_object")->AsObject("empty_object").empty());
+    EXPECT_EQ(Root.Find("missing"), nullptr);
+
+    const auto& Array = Root.Find("array")->AsArray("array");
+    ASSERT_EQ(Array.size(), size_t{4});
+    EXPECT_EQ(Array[0].AsUint("array[0]"), 1u);
+    EXPECT_EQ(Array[1].AsString("array[1]"), "two");
+    ASSERT_EQ(Array[2].AsArray("array[2]").size(), size_t{1});
+    ASSERT_NE(Array[3].Find("four"), nullptr);
+    EXPECT_EQ(Array[3].Find("four")->AsUint("array[3].four"), 4u);
+
+    const auto& Object = Root.Find("object")->AsObject("object");
+    ASSERT_EQ(Object.size(), size_t{2});
+    EXPECT_EQ(Object[0].first, "b");
+    EXPECT_EQ(Object[1].first, "a");
+
+    // Scalar documents
+    EXPECT_EQ(Parse(" 7 ").AsUint(""), 7u);
+    EXPECT_EQ(Parse("\"str\"").AsString(""), "str");
+    EXPECT_TRUE(Parse("null").IsNull());
+}
+
+TEST(ArchiveBuilder_JsonValue, ParseMalformed)
+{
+    const std::pair<const char*, const char*> Documents[] = {
+        {"", "test.json(1,1): value expected"},
+        {"{", "member name expected"},
+        {"{\"a\": 1", "unexpected end of the document"},
+        {"{\"a\" 1}", "':' expected"},
+        {"{\"a\": 1 \"b\": 2}", "',' or '}' expected"},
+        {"{a: 1}", "member name expected"},
+        {"{\"a\": 1,}", "member name expected"},
+        {"{\"a\": 1, \"a\": 2}", "duplicate member 'a'"},
+        {"[1 2]", "',' or ']' expected"},
+        {"[1,]", "value expected"},
+        {"\"abc", "unexpected end of the document"},
+        {"\"abc\ndef\"", "unterminated string"},
+        {"\"\\x\"", "invalid escape sequence '\\x'"},
+        {"\"\\u00g0\"", "invalid hexadecimal digit"},
+        {"\"\\u00e9\"", "only supported for ASCII characters"},
+        {"tru", "'true' expected"},
+        {"nul", "'null' expected"},
+        {"-", "value expected"},
+        {"+1", "value expected"},
+        {"{} {}", "unexpected characters after the end of the document"},
+        {"[1,\n  x]", "test.json(2,3): value expected"},
+    };
+
+    for (const auto& Doc : Documents)
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{Doc.second};
+        EXPECT_THROW(Parse(Doc.first), std::runtime_error) << Doc.first;
+    }
+}
+
+TEST(ArchiveBuilder_JsonValue, TypeErrors)
+{
+    const JsonValue Root = Parse(R"({"str": "1", "neg": -1, "frac": 1.5, "big": 4294967296, "max": 4294967295})");
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"'root.str' must be number, but it is string"};
+        EXPECT_THROW(Root.Find("str")->AsUint("root.str"), std::runtime_error);
+    }
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"'root' must be array, but it is object"};
+        EXPECT_THROW(Root.AsArray("root"), std::runtime_error);
+    }
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"'root.str' must be boolean, but it is string"};
+        EXPECT_THROW(Root.Find("str")->AsBool("root.str"), std::runtime_error);
+    }
+    for (const char* Name : {"neg", "frac", "big"})
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"must be a non-negative 32-bit integer"};
+        EXPECT_THROW(Root.Find(Name)->AsUint(Name), std::runtime_error) << Name;
+    }
+    EXPECT_EQ(Root.Find("max")->AsUint("max"), 0xFFFFFFFFu);
+
+    // Find() returns null for non-objects
+    EXPECT_EQ(Root.Find("str")->Find("a"), nullptr);
+}
+
+} // namespace
@@ -0,0 +1,247 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <cstring>
+
+#include "ArchiverFactoryLoader.h"
+#include "SerializationDevice.h"
+#include "Archiver.h"
+#include "RefCntAutoPtr.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint64 ContentVersion = 1234;
+
+const char* const ComputeShaderSource = R"(
+VK_IMAGE_FORMAT("rgba8") RWTexture2D</*format=rgba8*/ float4> g_tex2DUAV : register(u0);
+
+cbuffer cbConstants
+{
+    uint2 g_TexDim;
+    uint2 g_TileDim;
+}
+
+StructuredBuffer<float> g_CoordinateScaleBuffer;
+
+RWStructuredBuffer<float> g_OutputBuffer;
+
+[numthreads(16, 16, 1)]
+void main(uint3 DTid : SV_DispatchThreadID)
+{
+    if (DTid.x >= g_TexDim.x || DTid.y >= g_TexDim.y)
+        return;
+
+    g_tex2DUAV[DTid.xy] = float4(float2(DTid.xy % g_TileDim.xy) / float2(g_CoordinateScaleBuffer[DTid.x], g_CoordinateScaleBuffer[DTid.y]), 0.0, 1.0);
+    g_OutputBuffer[DTid.x] = g_CoordinateScaleBuffer[DTid.x];
+}
+)";
+
+struct ComputePipelineParams
+{
+    PSO_ARCHIVE_FLAGS PSOFlags = PSO_ARCHIVE_FLAG_NONE;
+
+    // Pipelines with explicit signatures are patched for all devices in parallel,
+    // while pipelines that use the default signature are patched sequentially.
+    bool UseSignature = true;
+
+    bool CompileAsync = false;
+};
+
+class SerializationDeviceTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        m_pArchiverFactory = LoadAndGetArchiverFactory();
+        ASSERT_NE(m_pArchiverFactory, nullptr);
+
+        RefCntAutoPtr<ISerializationDevice> pDevice;
+        m_pArchiverFactory->CreateSerializationDevice(SerializationDeviceCreateInfo{}, &pDevice);
+        ASSERT_NE(pDevice, nullptr);
+
+        m_DeviceFlags = pDevice->GetSupportedDeviceFlags();
+#if PLATFORM_MACOS
+        // Compute shaders are not supported in OpenGL on macOS
+        m_DeviceFlags &= ~(ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES);
+#endif
+        // Metal shaders are compiled by external tools whose output is not guaranteed
+        // to be byte-identical between runs.
+        m_DeviceFlags &= ~(ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS | ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS);
+    }
+
+    static void TearDownTestSuite()
+    {
+        m_pArchiverFactory = nullptr;
+    }
+
+    void SetUp() override
+    {
+        if (m_DeviceFlags == ARCHIVE_DEVICE_DATA_FLAG_NONE)
+            GTEST_SKIP() << "The archiver does not support any device type";
+    }
+
+    static void SerializeComputePipeline(Uint32                       NumAsyncShaderCompilationThreads,
+                                         const ComputePipelineParams& Params,
+                                         IDataBlob**                  ppArchive)
+    {
+        SerializationDeviceCreateInfo SerDeviceCI;
+        SerDeviceCI.NumAsyncShaderCompilationThreads = NumAsyncShaderCompilationThreads;
+
+        RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+        m_pArchiverFactory->CreateSerializationDevice(SerDeviceCI, &pSerializationDevice);
+        ASSERT_NE(pSerializationDevice, nullptr);
+
+        RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+        if (Params.UseSignature)
+        {
+            constexpr PipelineResourceDesc Resources[] = {
+                {SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, PIPELINE_RESOURCE_FLAG_NONE, {WEB_GPU_BINDING_TYPE_WRITE_ONLY_TEXTURE_UAV, RESOURCE_DIM_TEX_2D, TEX_FORMAT_RGBA8_UNORM}},
+                {SHADER_TYPE_COMPUTE, "cbConstants", 1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+                {SHADER_TYPE_COMPUTE, "g_CoordinateScaleBuffer", 1, SHADER_RESOURCE_TYPE_BUFFER_SRV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+                {SHADER_TYPE_COMPUTE, "g_OutputBuffer", 1, SHADER_RESOURCE_TYPE_BUFFER_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC},
+            };
+
+            PipelineResourceSignatureDesc PRSDesc;
+            PRSDesc.Name         = "SerializationDeviceTest - PRS";
+            PRSDesc.Resources    = Resources;
+            PRSDesc.NumResources = _countof(Resources);
+
+            pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, ResourceSignatureArchiveInfo{m_DeviceFlags}, &pPRS);
+            ASSERT_NE(pPRS, nullptr);
+        }
+
+        RefCntAutoPtr<IShader> pCS;
+        {
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.Desc           = {"SerializationDeviceTest - CS", SHADER_TYPE_COMPUTE, true};
+            ShaderCI.EntryPoint     = "main";
+            ShaderCI.Source         = ComputeShaderSource;
+            ShaderCI.CompileFlags   = SHADER_COMPILE_FLAG_HLSL_TO_SPIRV_VIA_GLSL;
+            if (Params.CompileAsync)
+                ShaderCI.CompileFlags |= SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+
+            pSerializationDevice->CreateShader(ShaderCI, ShaderArchiveInfo{m_DeviceFlags}, &pCS);
+            ASSERT_NE(pCS, nullptr);
+        }
+
+        RefCntAutoPtr<IArchiver> pArchiver;
+        m_pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        ASSERT_NE(pArchiver, nullptr);
+
+        {
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name         = "SerializationDeviceTest - PSO";
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.pCS                  = pCS;
+            PSOCreateInfo.Flags                = Params.CompileAsync ? PSO_CREATE_FLAG_ASYNCHRONOUS : PSO_CREATE_FLAG_NONE;
+
+            IPipelineResourceSignature* Signatures[] = {pPRS};
+            if (Params.UseSignature)
+            {
+                PSOCreateInfo.ResourceSignaturesCount = _countof(Signatures);
+                PSOCreateInfo.ppResourceSignatures    = Signatures;
+            }
+            else
+            {
+                PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+            }
+
+            PipelineStateArchiveInfo ArchiveInfo;
+            ArchiveInfo.DeviceFlags = m_DeviceFlags;
+            ArchiveInfo.PSOFlags    = Params.PSOFlags;
+
+            RefCntAutoPtr<IPipelineState> pPSO;
+            pSerializationDevice->CreateComputePipelineState(PSOCreateInfo, ArchiveInfo, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+            ASSERT_TRUE(pArchiver->AddPipelineState(pPSO));
+        }
+
+        pArchiver->SerializeToBlob(ContentVersion, ppArchive);
+        ASSERT_NE(*ppArchive, nullptr);
+        EXPECT_TRUE(m_pArchiverFactory->PrintArchiveContent(*ppArchive));
+    }
+
+    // Serializes the same pipeline with a sequential device and with a device that
+    // compiles and patches shaders for all device types in parallel, and checks that
+    // both produce identical archives.
+    static void TestParallelSerialization(const ComputePipelineParams& Params)
+    {
+        RefCntAutoPtr<IDataBlob> pRefArchive;
+        SerializeComputePipeline(0, Params, &pRefArchive);
+        ASSERT_NE(pRefArchive, nullptr);
+
+        RefCntAutoPtr<IDataBlob> pArchive;
+        SerializeComputePipeline(2, Params, &pArchive);
+        ASSERT_NE(pArchive, nullptr);
+
+        ASSERT_EQ(pArchive->GetSize(), pRefArchive->GetSize());
+        EXPECT_EQ(std::memcmp(pArchive->GetConstDataPtr(), pRefArchive->GetConstDataPtr(), pArchive->GetSize()), 0);
+    }
+
+    static IArchiverFactory*         m_pArchiverFactory;
+    static ARCHIVE_DEVICE_DATA_FLAGS m_DeviceFlags;
+};
+
+IArchiverFactory*         SerializationDeviceTest::m_pArchiverFactory = nullptr;
+ARCHIVE_DEVICE_DATA_FLAGS SerializationDeviceTest::m_DeviceFlags      = ARCHIVE_DEVICE_DATA_FLAG_NONE;
+
+TEST_F(SerializationDeviceTest, ComputePipeline_Parallel)
+{
+    ComputePipelineParams Params;
+    TestParallelSerialization(Params);
+}
+
+TEST_F(SerializationDeviceTest, ComputePipeline_NoReflection_Parallel)
+{
+    ComputePipelineParams Params;
+    Params.PSOFlags = PSO_ARCHIVE_FLAG_STRIP_REFLECTION;
+    TestParallelSerialization(Params);
+}
+
+TEST_F(SerializationDeviceTest, ComputePipeline_DefaultSignature_Parallel)
+{
+    ComputePipelineParams Params;
+    Params.UseSignature = false;
+    TestParallelSerialization(Params);
+}
+
+TEST_F(SerializationDeviceTest, ComputePipeline_Async_Parallel)
+{
+    ComputePipelineParams Params;
+    Params.CompileAsync = true;
+    TestParallelSerialization(Params);
+}
+
+} // namespace
@@ -0,0 +1,225 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "CPUProfiler.hpp"
+
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+size_t CountSubstrings(const std::string& Str, const char* SubStr)
+{
+    size_t Count = 0;
+    for (size_t Pos = Str.find(SubStr); Pos != std::string::npos; Pos = Str.find(SubStr, Pos + 1))
+        ++Count;
+    return Count;
+}
+
+TEST(Common_CPUProfiler, ScopesAndCounters)
+{
+    CPUProfiler::Reset();
+
+    {
+        // Recording is disabled
+        CPUProfiler::ScopedEvent Scope{"DisabledScope"};
+    }
+    EXPECT_EQ(CPUProfiler::GetEventCount(), size_t{0});
+
+    CPUProfiler::SetEnabled(true);
+    CPUProfiler::SetCurrentThreadName("Main \"test\" thread");
+    {
+        CPUProfiler::ScopedEvent OuterScope{"OuterScope"};
+        {
+            CPUProfiler::ScopedEvent InnerScope{"InnerScope"};
+        }
+        CPUProfiler::RecordCounter("TestCounter", -42);
+    }
+    CPUProfiler::SetEnabled(false);
+
+    EXPECT_EQ(CPUProfiler::GetEventCount(), size_t{3});
+
+    const std::string Trace = CPUProfiler::GetChromeTrace();
+    EXPECT_EQ(CountSubstrings(Trace, "\"name\":\"OuterScope\""), size_t{1});
+    EXPECT_EQ(CountSubstrings(Trace, "\"name\":\"InnerScope\""), size_t{1});
+    EXPECT_EQ(CountSubstrings(Trace, "\"name\":\"DisabledScope\""), size_t{0});
+    EXPECT_EQ(CountSubstrings(Trace, "\"ph\":\"X\""), size_t{2});
+    EXPECT_EQ(CountSubstrings(Trace, "\"ph\":\"C\""), size_t{1});
+    EXPECT_EQ(CountSubstrings(Trace, "\"value\":-42"), size_t{1});
+    EXPECT_EQ(CountSubstrings(Trace, "Main \\\"test\\\" thread"), size_t{1});
+
+    CPUProfiler::Reset();
+    EXPECT_EQ(CPUProfiler::GetEventCount(), size_t{0});
+    EXPECT_EQ(CountSubstrings(CPUProfiler::GetChromeTrace(), "\"ph\":\"X\""), size_t{0});
+}
+
+TEST(Common_CPUProfiler, MultipleThreads)
+{
+    constexpr size_t NumThreads         = 4;
+    constexpr size_t NumScopesPerThread = 10000; // Spans several event blocks
+
+    CPUProfiler::Reset();
+    CPUProfiler::SetEnabled(true);
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([]() {
+            for (size_t i = 0; i < NumScopesPerThread; ++i)
+            {
+                CPUProfiler::ScopedEvent Scope{"WorkerScope"};
+            }
+        });
+    }
+
+    // Read the events while the threads are recording
+    const std::string PartialTrace = CPUProfiler::GetChromeTrace();
+    EXPECT_FALSE(PartialTrace.empty());
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+    CPUProfiler::SetEnabled(false);
+
+    EXPECT_EQ(CPUProfiler::GetEventCount(), NumThreads * NumScopesPerThread);
+    EXPECT_EQ(CPUProfiler::GetDroppedEventCount(), size_t{0});
+    EXPECT_EQ(CountSubstrings(CPUProfiler::GetChromeTrace(), "\"name\":\"WorkerScope\""), NumThreads * NumScopesPerThread);
+
+    CPUProfiler::Reset();
+}
+
+TEST(Common_CPUProfiler, MaxEventsPerThread)
+{
+    CPUProfiler::Reset();
+    CPUProfiler::SetEnabled(true);
+    CPUProfiler::SetMaxEventsPerThread(16);
+
+    // Use a new thread so that the events of other tests are not counted
+    std::thread Thread{[]() {
+        for (size_t i = 0; i < 20; ++i)
+            CPUProfiler::RecordCounter("Counter", static_cast<Int64>(i));
+    }};
+    Thread.join();
+
+    CPUProfiler::SetEnabled(false);
+    CPUProfiler::SetMaxEventsPerThread(size_t{1} << 20);
+
+    EXPECT_EQ(CPUProfiler::GetEventCount(), size_t{16});
+    EXPECT_EQ(CPUProfiler::GetDroppedEventCount(), size_t{4});
+
+    CPUProfiler::Reset();
+    EXPECT_EQ(CPUProfiler::GetDroppedEventCount(), size_t{0});
+}
+
+TEST(Common_CPUProfiler, MaxEventsPerThreadAfterReset)
+{
+    CPUProfiler::Reset();
+    CPUProfiler::SetEnabled(true);
+    CPUProfiler::SetMaxEventsPerThread(16);
+
+    // The event limit applies to the events recorded since the last reset
+    std::thread Thread{[]() {
+        for (size_t Frame = 0; Frame < 4; ++Frame)
+        {
+            for (size_t i = 0; i < 20; ++i)
+                CPUProfiler::RecordCounter("Counter", static_cast<Int64>(i));
+
+            EXPECT_EQ(CPUProfiler::GetEventCount(), size_t{16}) << "Frame " << Frame;
+            EXPECT_EQ(CPUProfiler::GetDroppedEventCount(), size_t{4}) << "Frame " << Frame;
+            CPUProfiler::Reset();
+        }
+    }};
+    Thread.join();
+
+    CPUProfiler::SetEnabled(false);
+    CPUProfiler::SetMaxEventsPerThread(size_t{1} << 20);
+    CPUProfiler::Reset();
+}
+
+TEST(Common_CPUProfiler, ReuseEventBlocks)
+{
+    // Spans several event blocks that are released or reused after every reset
+    static constexpr size_t NumScopesPerFrame = 3 * 4096 + 10;
+
+    CPUProfiler::Reset();
+    CPUProfiler::SetEnabled(true);
+
+    std::thread Thread{[]() {
+        for (size_t Frame = 0; Frame < 4; ++Frame)
+        {
+            for (size_t i = 0; i < NumScopesPerFrame; ++i)
+            {
+                CPUProfiler::ScopedEvent Scope{"FrameScope"};
+            }
+
+            EXPECT_EQ(CPUProfiler::GetEventCount(), NumScopesPerFrame) << "Frame " << Frame;
+            EXPECT_EQ(CountSubstrings(CPUProfiler::GetChromeTrace(), "\"name\":\"FrameScope\""), NumScopesPerFrame) << "Frame " << Frame;
+            CPUProfiler::Reset();
+        }
+    }};
+    Thread.join();
+
+    CPUProfiler::SetEnabled(false);
+    EXPECT_EQ(CPUProfiler::GetDroppedEventCount(), size_t{0});
+    CPUProfiler::Reset();
+}
+
+TEST(Common_CPUProfiler, ReleaseExitedThreadBuffers)
+{
+    CPUProfiler::Reset();
+    CPUProfiler::SetEnabled(true);
+
+    std::thread Thread{[]() {
+        CPUProfiler::SetCurrentThreadName("Exited thread");
+        for (size_t i = 0; i < 4096 + 10; ++i)
+        {
+            CPUProfiler::ScopedEvent Scope{"ExitedThreadScope"};
+        }
+    }};
+    Thread.join();
+
+    // The events of an exited thread are kept until they are reset
+    std::string Trace = CPUProfiler::GetChromeTrace();
+    EXPECT_EQ(CountSubstrings(Trace, "\"name\":\"ExitedThreadScope\""), size_t{4096 + 10});
+    EXPECT_EQ(CountSubstrings(Trace, "Exited thread"), size_t{1});
+
+    // The buffer of the exited thread is released together with its name
+    CPUProfiler::Reset();
+    Trace = CPUProfiler::GetChromeTrace();
+    EXPECT_EQ(CountSubstrings(Trace, "ExitedThreadScope"), size_t{0});
+    EXPECT_EQ(CountSubstrings(Trace, "Exited thread"), size_t{0});
+
+    CPUProfiler::SetEnabled(false);
+    CPUProfiler::Reset();
+}
+
+} // namespace
@@ -323,6 +323,69 @@ void TestConcurrentRequestsForDifferentKeysCreateIndependentObjects(size_t Shard
     }
 }
 
+void TestConcurrentSetReturnsSameObjectForSameKey(size_t ShardCount)
+{
+    static constexpr Uint32 ThreadCount = 16;
+    static constexpr Uint32 KeyCount    = 256;
+
+    WeakObjectCache<TestObject> Cache{ShardCount};
+    ThreadStartGate             StartGate{ThreadCount};
+    std::vector<std::thread>    Threads;
+
+    // Objects[ThreadIndex][KeyIndex] is the object the thread obtained for the key
+    std::vector<std::vector<TestObjectPtr>> Objects(ThreadCount, std::vector<TestObjectPtr>(KeyCount));
+
+    Threads.reserve(ThreadCount);
+    for (Uint32 ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+    {
+        Threads.emplace_back([&, ThreadIndex]() {
+            StartGate.Wait();
+
+            for (Uint32 i = 0; i < KeyCount; ++i)
+            {
+                // Visit the keys in a different order in every thread
+                const Uint32      KeyIndex = (i * 7u + ThreadIndex * 31u) % KeyCount;
+                const std::string Key      = "object-key-" + std::to_string(KeyIndex);
+
+                // Emulate the lookup-then-publish pattern used by the render state cache:
+                // every thread that misses creates its own object, and the cache picks one.
+                TestObjectPtr Object = Cache.Get(Key.c_str());
+                if (!Object)
+                {
+                    TestObjectPtr NewObject = CreateTestObject("object://concurrent", KeyIndex);
+                    Object                  = Cache.Set(Key.c_str(), NewObject);
+                }
+                Objects[ThreadIndex][KeyIndex] = std::move(Object);
+            }
+        });
+    }
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    EXPECT_EQ(Cache.Size(), size_t{KeyCount});
+    EXPECT_EQ(Cache.GetLiveObjects().size(), size_t{KeyCount});
+
+    for (Uint32 KeyIndex = 0; KeyIndex < KeyCount; ++KeyIndex)
+    {
+        const TestObjectPtr& FirstObject = Objects[0][KeyIndex];
+        ASSERT_NE(FirstObject, nullptr);
+        EXPECT_EQ(FirstObject->Value, KeyIndex);
+        for (Uint32 ThreadIndex = 1; ThreadIndex < ThreadCount; ++ThreadIndex)
+            EXPECT_EQ(Objects[ThreadIndex][KeyIndex].RawPtr(), FirstObject.RawPtr()) << "Key " << KeyIndex << ", thread " << ThreadIndex;
+    }
+
+    // Release all objects. Expired entries must be purged by lookups.
+    Objects.clear();
+    EXPECT_EQ(Cache.GetLiveObjects().size(), size_t{0});
+    for (Uint32 KeyIndex = 0; KeyIndex < KeyCount; ++KeyIndex)
+    {
+        const std::string Key = "object-key-" + std::to_string(KeyIndex);
+        EXPECT_EQ(Cache.Get(Key.c_str()), nullptr);
+    }
+    EXPECT_EQ(Cache.Size(), size_t{0});
+}
+
 } // namespace
 
 TEST(Common_WeakObjectCache, CreatesAndReusesCachedObject)
@@ -1285,3 +1348,97 @@ TEST(Common_WeakObjectCache, ConcurrentRequestsForDifferentKeysCreateIndependent
         TestConcurrentRequestsForDifferentKeysCreateIndependentObjects(ShardCount);
     }
 }
+
+TEST(Common_WeakObjectCache, GetAndSet)
+{
+    WeakObjectCache<TestObject> Cache{2};
+
+    EXPECT_EQ(Cache.Get("missing-key"), nullptr);
+    EXPECT_EQ(Cache.Size(), size_t{0});
+
+    std::vector<TestObjectPtr> Objects;
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const std::string Key = "object-key-" + std::to_string(i);
+        Objects.emplace_back(CreateTestObject("object://set", i));
+        EXPECT_EQ(Cache.Set(Key.c_str(), Objects.back()), Objects.back());
+    }
+    EXPECT_EQ(Cache.Size(), size_t{16});
+
+    for (Uint32 i = 0; i < 16; ++i)
+    {
+        const std::string Key = "object-key-" + std::to_string(i);
+        EXPECT_EQ(Cache.Get(Key.c_str()), Objects[i]);
+    }
+
+    // Set() must not replace a live object
+    {
+        TestObjectPtr Other = CreateTestObject("object://other", 100);
+        EXPECT_EQ(Cache.Set("object-key-5", Other), Objects[5]);
+        EXPECT_EQ(Cache.Get("object-key-5"), Objects[5]);
+    }
+
+    // GetOrCreate() must return the object published by Set()
+    {
+        auto [Object, Created] =
+            Cache.GetOrCreate(
+                "object-key-3",
+                [&]() {
+                    ADD_FAILURE() << "Factory must not be called when a live cache entry exists";
+                    return CreateTestObject("object://unexpected", 99);
+                });
+        EXPECT_EQ(Object, Objects[3]);
+        EXPECT_FALSE(Created);
+    }
+
+    // Release even objects
+    for (Uint32 i = 0; i < 16; i += 2)
+        Objects[i].Release();
+    EXPECT_EQ(Cache.GetLiveObjects().size(), size_t{8});
+
+    // Get() erases the expired entry
+    EXPECT_EQ(Cache.Get("object-key-0"), nullptr);
+    EXPECT_EQ(Cache.Size(), size_t{15});
+
+    // Set() replaces the expired entry
+    {
+        TestObjectPtr NewObject = CreateTestObject("object://replacement", 102);
+        EXPECT_EQ(Cache.Set("object-key-2", NewObject), NewObject);
+        EXPECT_EQ(Cache.Get("object-key-2"), NewObject);
+        Objects[2] = NewObject;
+    }
+
+    EXPECT_EQ(Cache.EraseExpired(), size_t{6});
+    EXPECT_EQ(Cache.Size(), size_t{9});
+    EXPECT_EQ(Cache.GetLiveObjects().size(), size_t{9});
+
+    Cache.Clear();
+    EXPECT_EQ(Cache.Size(), size_t{0});
+    EXPECT_EQ(Cache.Get("object-key-1"), nullptr);
+    EXPECT_EQ(Cache.GetLiveObjects().size(), size_t{0});
+}
+
+TEST(Common_WeakObjectCache, GetAndSetRejectNullOrEmptyKey)
+{
+    WeakObjectCache<TestObject> Cache;
+    TestObjectPtr               Object = CreateTestObject("object://key", 1);
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"WeakObjectCache key must not be null or empty"};
+        EXPECT_EQ(Cache.Get(nullptr), nullptr);
+    }
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"WeakObjectCache key must not be null or empty"};
+        EXPECT_EQ(Cache.Set("", Object), nullptr);
+    }
+    EXPECT_EQ(Cache.Size(), size_t{0});
+}
+
+TEST(Common_WeakObjectCache, ConcurrentSetReturnsSameObjectForSameKey)
+{
+    for (const size_t ShardCount : ConcurrentShardCounts)
+    {
+        SCOPED_TRACE(::testing::Message{} << "ShardCount: " << ShardCount);
+        TestConcurrentSetReturnsSameObjectForSameKey(ShardCount);
+    }
+}
@@ -0,0 +1,275 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include <atomic>
+#include <string>
+
+#include "ShaderSourceFactoryUtils.hpp"
+#include "ShaderSourceFileStampProvider.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "ShaderToolsCommon.hpp"
+#include "DataBlobImpl.hpp"
+#include "ObjectBase.hpp"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "TempDirectory.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+// Forwards all requests to another factory and counts the streams it creates.
+// The file stamp provider interface is only exposed if the source factory implements it.
+class CountingShaderSourceFactory final : public ObjectBase<IShaderSourceFileStampProvider>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceFileStampProvider>;
+
+    static RefCntAutoPtr<CountingShaderSourceFactory> Create(IShaderSourceInputStreamFactory* pSourceFactory)
+    {
+        return RefCntAutoPtr<CountingShaderSourceFactory>{MakeNewRCObj<CountingShaderSourceFactory>()(pSourceFactory)};
+    }
+
+    CountingShaderSourceFactory(IReferenceCounters*              pRefCounters,
+                                IShaderSourceInputStreamFactory* pSourceFactory) :
+        TBase{pRefCounters},
+        m_pSourceFactory{pSourceFactory},
+        m_pStampProvider{pSourceFactory, IID_ShaderSourceFileStampProvider}
+    {
+    }
+
+    virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override final
+    {
+        if (ppInterface == nullptr)
+            return;
+
+        *ppInterface = nullptr;
+        if (IID == IID_IShaderSourceInputStreamFactory || (IID == IID_ShaderSourceFileStampProvider && m_pStampProvider))
+        {
+            *ppInterface = this;
+            (*ppInterface)->AddRef();
+        }
+        else
+        {
+            TBase::QueryInterface(IID, ppInterface);
+        }
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char*   Name,
+                                                      IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        m_NumStreams.fetch_add(1);
+        m_pSourceFactory->CreateInputStream2(Name, Flags, ppStream);
+    }
+
+    virtual bool GetFileStamp(const Char* Name, std::string& FullPath, FileStat& Stat) override final
+    {
+        return m_pStampProvider && m_pStampProvider->GetFileStamp(Name, FullPath, Stat);
+    }
+
+    Uint32 GetNumStreams() const { return m_NumStreams.load(); }
+
+private:
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pSourceFactory;
+    RefCntAutoPtr<IShaderSourceFileStampProvider>  m_pStampProvider;
+
+    std::atomic<Uint32> m_NumStreams{0};
+};
+
+// Reads the file through the factory. Returns "<null>" if the file could not be opened.
+std::string ReadFile(IShaderSourceInputStreamFactory* pFactory, const char* Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags = CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE)
+{
+    RefCntAutoPtr<IFileStream> pStream;
+    pFactory->CreateInputStream2(Name, Flags, &pStream);
+    if (!pStream)
+        return "<null>";
+
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create();
+    pStream->ReadBlob(pData);
+    return std::string{pData->GetConstDataPtr<char>(), pData->GetSize()};
+}
+
+class CachingShaderSourceFactoryTest : public ::testing::Test
+{
+protected:
+    void WriteFile(const char* Name, const std::string& Source)
+    {
+        const std::string Path = GetPath(Name);
+        FileWrapper       File{Path.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        EXPECT_TRUE(File->Write(Source.data(), Source.size()));
+    }
+
+    std::string GetPath(const char* Name) const
+    {
+        return m_TmpDir.Get() + FileSystem::SlashSymbol + Name;
+    }
+
+    RefCntAutoPtr<CountingShaderSourceFactory> CreateFileFactory() const
+    {
+        RefCntAutoPtr<IShaderSourceInputStreamFactory> pDefaultFactory;
+        CreateDefaultShaderSourceStreamFactory(m_TmpDir.Get().c_str(), &pDefaultFactory);
+        return pDefaultFactory ? CountingShaderSourceFactory::Create(pDefaultFactory) : RefCntAutoPtr<CountingShaderSourceFactory>{};
+    }
+
+    TempDirectory m_TmpDir;
+};
+
+TEST_F(CachingShaderSourceFactoryTest, CacheHits)
+{
+    WriteFile("Common.hlsl", "float4 f;\n");
+
+    RefCntAutoPtr<CountingShaderSourceFactory> pFileFactory = CreateFileFactory();
+    ASSERT_NE(pFileFactory, nullptr);
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pCachingFactory = CreateCachingShaderSourceFactory(pFileFactory);
+    ASSERT_NE(pCachingFactory, nullptr);
+
+    // The caching factory provides file stamps of the source factory
+    RefCntAutoPtr<IShaderSourceFileStampProvider> pStampProvider{pCachingFactory, IID_ShaderSourceFileStampProvider};
+    ASSERT_NE(pStampProvider, nullptr);
+    {
+        std::string FullPath;
+        FileStat    Stat;
+        EXPECT_TRUE(pStampProvider->GetFileStamp("Common.hlsl", FullPath, Stat));
+        EXPECT_EQ(Stat.Size, Uint64{10});
+    }
+
+    // The file is only read from the source factory once
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(ReadFile(pCachingFactory, "Common.hlsl"), "float4 f;\n");
+        EXPECT_EQ(pFileFactory->GetNumStreams(), 1u);
+    }
+
+    // Every stream has its own position
+    {
+        RefCntAutoPtr<IFileStream> pStream0;
+        RefCntAutoPtr<IFileStream> pStream1;
+        pCachingFactory->CreateInputStream("Common.hlsl", &pStream0);
+        pCachingFactory->CreateInputStream("Common.hlsl", &pStream1);
+        ASSERT_NE(pStream0, nullptr);
+        ASSERT_NE(pStream1, nullptr);
+
+        char Buffer[6] = {};
+        EXPECT_TRUE(pStream0->Read(Buffer, 5));
+        EXPECT_STREQ(Buffer, "float");
+        EXPECT_TRUE(pStream1->Read(Buffer, 5));
+        EXPECT_STREQ(Buffer, "float");
+        EXPECT_EQ(pStream0->GetPos(), size_t{5});
+    }
+    EXPECT_EQ(pFileFactory->GetNumStreams(), 1u);
+
+    // Shaders that include the same files are served from the cache
+    WriteFile("Main0.hlsl", "#include \"Common.hlsl\"\nvoid main0() {}\n");
+    WriteFile("Main1.hlsl", "#include \"Common.hlsl\"\nvoid main1() {}\n");
+    for (const char* FilePath : {"Main0.hlsl", "Main1.hlsl", "Main0.hlsl"})
+    {
+        ShaderCreateInfo ShaderCI{};
+        ShaderCI.Desc.Name = "TestShader";
+        ShaderCI.FilePath  = FilePath;
+
+        ShaderCI.pShaderSourceStreamFactory = pFileFactory;
+        const std::string RefSource         = UnrollShaderIncludes(ShaderCI);
+        const Uint32      NumStreams        = pFileFactory->GetNumStreams();
+
+        ShaderCI.pShaderSourceStreamFactory = pCachingFactory;
+        EXPECT_EQ(UnrollShaderIncludes(ShaderCI), RefSource);
+        // Common.hlsl is always in the cache. MainN.hlsl is only read the first time.
+        EXPECT_LE(pFileFactory->GetNumStreams(), NumStreams + 1);
+    }
+    EXPECT_EQ(ReadFile(pCachingFactory, "Main0.hlsl"), ReadFile(pFileFactory, "Main0.hlsl"));
+}
+
+TEST_F(CachingShaderSourceFactoryTest, Invalidation)
+{
+    WriteFile("Common.hlsl", "float4 f;\n");
+
+    RefCntAutoPtr<CountingShaderSourceFactory> pFileFactory = CreateFileFactory();
+    ASSERT_NE(pFileFactory, nullptr);
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pCachingFactory = CreateCachingShaderSourceFactory(pFileFactory);
+    ASSERT_NE(pCachingFactory, nullptr);
+
+    EXPECT_EQ(ReadFile(pCachingFactory, "Common.hlsl"), "float4 f;\n");
+    EXPECT_EQ(pFileFactory->GetNumStreams(), 1u);
+
+    // Modify the file. The size changes, so the stale entry is detected
+    // even if the file system has a coarse modification time resolution.
+    WriteFile("Common.hlsl", "float4 f;\nfloat4 g;\n");
+    EXPECT_EQ(ReadFile(pCachingFactory, "Common.hlsl"), "float4 f;\nfloat4 g;\n");
+    EXPECT_EQ(pFileFactory->GetNumStreams(), 2u);
+
+    // The new content is cached
+    EXPECT_EQ(ReadFile(pCachingFactory, "Common.hlsl"), "float4 f;\nfloat4 g;\n");
+    EXPECT_EQ(pFileFactory->GetNumStreams(), 2u);
+
+    // A deleted file must not be served from the cache
+    FileSystem::DeleteFile(GetPath("Common.hlsl").c_str());
+    EXPECT_EQ(ReadFile(pCachingFactory, "Common.hlsl", CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT), "<null>");
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to create input stream for source file Common.hlsl"};
+        EXPECT_EQ(ReadFile(pCachingFactory, "Common.hlsl"), "<null>");
+    }
+
+    // The file is read again once it is restored
+    WriteFile("Common.hlsl", "float4 h;\n");
+    EXPECT_EQ(ReadFile(pCachingFactory, "Common.hlsl"), "float4 h;\n");
+}
+
+TEST_F(CachingShaderSourceFactoryTest, FactoryWithoutFileStamps)
+{
+    // Files from factories that do not provide file stamps can't be validated and are not cached
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pMemoryFactory = CreateMemoryShaderSourceFactory({{"Common.hlsl", "float4 f;\n"}});
+    ASSERT_NE(pMemoryFactory, nullptr);
+
+    RefCntAutoPtr<CountingShaderSourceFactory> pCountingFactory = CountingShaderSourceFactory::Create(pMemoryFactory);
+    ASSERT_EQ(RefCntAutoPtr<IShaderSourceFileStampProvider>(pCountingFactory, IID_ShaderSourceFileStampProvider), nullptr);
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pCachingFactory = CreateCachingShaderSourceFactory(pCountingFactory);
+    ASSERT_NE(pCachingFactory, nullptr);
+
+    for (Uint32 i = 1; i <= 3; ++i)
+    {
+        EXPECT_EQ(ReadFile(pCachingFactory, "Common.hlsl"), "float4 f;\n");
+        EXPECT_EQ(pCountingFactory->GetNumStreams(), i);
+    }
+}
+
+} // namespace
@@ -25,11 +25,18 @@
  */
 
 #include "XXH128Hasher.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "TempDirectory.hpp"
 #include "gtest/gtest.h"
 #include <memory>
 #include <unordered_set>
 
 using namespace Diligent;
+using namespace Diligent::Testing;
 
 namespace
 {
@@ -82,4 +89,99 @@ TEST(XXH128HasherTest, ToString)
     EXPECT_EQ(Hash.ToString(), "FEDCBA98765432100123456789ABCDEF");
 }
 
+static XXH128Hash HashShaderCI(const ShaderCreateInfo& ShaderCI, ShaderIncludeCache* pSourceCache)
+{
+    XXH128State Hasher;
+    Hasher.Update(ShaderCI, pSourceCache);
+    return Hasher.Digest();
+}
+
+TEST(XXH128HasherTest, ShaderSourceCache)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/ShaderPreprocessor", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.FilePath                   = "InlineIncludeShaderTest.hlsl";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    ShaderIncludeCache SourceCache;
+
+    const XXH128Hash RefHash = HashShaderCI(ShaderCI, nullptr);
+    EXPECT_EQ(SourceCache.GetFileCount(), size_t{0});
+
+    // The hash must not depend on whether the cache is used
+    EXPECT_EQ(HashShaderCI(ShaderCI, &SourceCache), RefHash);
+    // InlineIncludeShaderTest.hlsl and three common files
+    EXPECT_EQ(SourceCache.GetFileCount(), size_t{4});
+
+    EXPECT_EQ(SourceCache.GetMissCount(), Uint64{4});
+
+    // Cache hit
+    const Uint64 NumHits = SourceCache.GetHitCount();
+    EXPECT_EQ(HashShaderCI(ShaderCI, &SourceCache), RefHash);
+    EXPECT_EQ(SourceCache.GetFileCount(), size_t{4});
+    EXPECT_GT(SourceCache.GetHitCount(), NumHits);
+    EXPECT_EQ(SourceCache.GetMissCount(), Uint64{4});
+
+    // Source string with include directives
+    {
+        ShaderCreateInfo SourceCI;
+        SourceCI.Source                     = "#include \"InlineIncludeShaderCommon0.hlsl\"\n";
+        SourceCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+        EXPECT_EQ(HashShaderCI(SourceCI, &SourceCache), HashShaderCI(SourceCI, nullptr));
+    }
+
+    SourceCache.Clear();
+    EXPECT_EQ(SourceCache.GetFileCount(), size_t{0});
+}
+
+TEST(XXH128HasherTest, ShaderSourceCacheInvalidation)
+{
+    TempDirectory      TmpDir;
+    const std::string& TmpDirPath = TmpDir.Get();
+
+    auto WriteFile = [&](const char* Name, const std::string& Source) {
+        const std::string Path = TmpDirPath + FileSystem::SlashSymbol + Name;
+        FileWrapper       File{Path.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        EXPECT_TRUE(File->Write(Source.data(), Source.size()));
+    };
+
+    WriteFile("Main.hlsl", "#include \"Common.hlsl\"\nvoid main() {}\n");
+    WriteFile("Common.hlsl", "float4 f;\n");
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory(TmpDirPath.c_str(), &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.FilePath                   = "Main.hlsl";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    ShaderIncludeCache SourceCache;
+
+    const XXH128Hash Hash0 = HashShaderCI(ShaderCI, &SourceCache);
+    EXPECT_EQ(SourceCache.GetFileCount(), size_t{2});
+
+    // Modify the included file. The size changes, so the stale entry is detected
+    // even if the file system has a coarse modification time resolution.
+    WriteFile("Common.hlsl", "float4 f;\nfloat4 g;\n");
+
+    const XXH128Hash Hash1 = HashShaderCI(ShaderCI, &SourceCache);
+    EXPECT_NE(Hash1, Hash0);
+    EXPECT_EQ(Hash1, HashShaderCI(ShaderCI, nullptr));
+    EXPECT_EQ(SourceCache.GetFileCount(), size_t{2});
+
+    // Add a new include to the main file
+    WriteFile("Common2.hlsl", "float4 h;\n");
+    WriteFile("Main.hlsl", "#include \"Common.hlsl\"\n#include \"Common2.hlsl\"\nvoid main() {}\n");
+
+    const XXH128Hash Hash2 = HashShaderCI(ShaderCI, &SourceCache);
+    EXPECT_NE(Hash2, Hash1);
+    EXPECT_EQ(Hash2, HashShaderCI(ShaderCI, nullptr));
+    EXPECT_EQ(SourceCache.GetFileCount(), size_t{3});
+}
+
 } // namespace
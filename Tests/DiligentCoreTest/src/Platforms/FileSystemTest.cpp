@@ -519,6 +519,14 @@ TEST(Platforms_FileSystem, File)
     EXPECT_TRUE(FileSystem::FileExists(FilePath.c_str()));
     EXPECT_FALSE(FileSystem::IsDirectory(FilePath.c_str()));
 
+    {
+        FileStat Stat;
+        EXPECT_TRUE(FileSystem::GetFileStat(FilePath.c_str(), Stat));
+        EXPECT_EQ(Stat.Size, Data.size() * sizeof(Data[0]));
+        EXPECT_NE(Stat.ModificationTime, Uint64{0});
+        EXPECT_FALSE(FileSystem::GetFileStat(TmpDirPath.c_str(), Stat));
+    }
+
     {
         FileWrapper File{FilePath.c_str(), EFileAccessMode::Read};
         ASSERT_TRUE(File);
@@ -0,0 +1,211 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "GLSLangUtils.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
+
+#include <vector>
+
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class GLSLangUtilsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+    }
+
+    static void TearDownTestSuite()
+    {
+        GLSLangUtils::FinalizeGlslang();
+    }
+};
+
+// Shader permutations that share source files, similar to an offline archive build
+std::vector<ShaderCreateInfo> GetBatchShaders(IShaderSourceInputStreamFactory* pShaderSourceStreamFactory)
+{
+    static constexpr ShaderMacro Macros[] = {{"MACRO_A", "1"}};
+
+    static constexpr const char* FilePaths[] = {
+        "UniformBuffers.psh",
+        "StorageBuffers.psh",
+        "Textures.psh",
+        "MixedResources.psh",
+    };
+
+    std::vector<ShaderCreateInfo> Shaders;
+    for (Uint32 i = 0; i < 3; ++i)
+    {
+        for (const char* FilePath : FilePaths)
+        {
+            ShaderCreateInfo ShaderCI;
+            ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+            ShaderCI.FilePath                   = FilePath;
+            ShaderCI.Desc                       = {FilePath, SHADER_TYPE_PIXEL};
+            ShaderCI.EntryPoint                 = "main";
+            ShaderCI.pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+            if (i == 1)
+                ShaderCI.Macros = {Macros, _countof(Macros)};
+            else if (i == 2)
+                ShaderCI.ShaderOptimizationLevel = SHADER_OPTIMIZATION_LEVEL_DISABLED;
+            Shaders.push_back(ShaderCI);
+        }
+    }
+    return Shaders;
+}
+
+void TestCompileSPIRVBatch(IThreadPool* pThreadPool)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceStreamFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/SPIRV", &pShaderSourceStreamFactory);
+    ASSERT_NE(pShaderSourceStreamFactory, nullptr);
+
+    const std::vector<ShaderCreateInfo> Shaders = GetBatchShaders(pShaderSourceStreamFactory);
+
+    GLSLangUtils::SPIRVCompileStats Stats;
+
+    GLSLangUtils::SPIRVBatchCompileAttribs Attribs;
+    Attribs.pShaders    = Shaders.data();
+    Attribs.NumShaders  = static_cast<Uint32>(Shaders.size());
+    Attribs.pThreadPool = pThreadPool;
+    Attribs.pStats      = &Stats;
+
+    const std::vector<std::vector<unsigned int>> SPIRVs = GLSLangUtils::CompileSPIRVBatch(Attribs);
+    ASSERT_EQ(SPIRVs.size(), Shaders.size());
+    for (size_t i = 0; i < Shaders.size(); ++i)
+    {
+        const std::vector<unsigned int> RefSPIRV = GLSLangUtils::HLSLtoSPIRV(Shaders[i], GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+        ASSERT_FALSE(RefSPIRV.empty()) << Shaders[i].FilePath;
+        EXPECT_EQ(SPIRVs[i], RefSPIRV) << Shaders[i].FilePath;
+    }
+
+    EXPECT_EQ(Stats.NumFileReads + Stats.NumFileCacheHits, Shaders.size());
+    if (pThreadPool == nullptr)
+    {
+        // Every file is read exactly once when the shaders are compiled sequentially
+        EXPECT_EQ(Stats.NumFileReads, Shaders.size() / 3);
+    }
+    EXPECT_GT(Stats.ParseTime, 0.0);
+    EXPECT_GT(Stats.CodeGenTime, 0.0);
+}
+
+TEST_F(GLSLangUtilsTest, CompileSPIRVBatch)
+{
+    TestCompileSPIRVBatch(nullptr);
+}
+
+TEST_F(GLSLangUtilsTest, CompileSPIRVBatch_ThreadPool)
+{
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+    TestCompileSPIRVBatch(pThreadPool);
+}
+
+TEST_F(GLSLangUtilsTest, CompileSPIRVBatch_SharedIncludeCache)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceStreamFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/SPIRV", &pShaderSourceStreamFactory);
+    ASSERT_NE(pShaderSourceStreamFactory, nullptr);
+
+    const std::vector<ShaderCreateInfo> Shaders = GetBatchShaders(pShaderSourceStreamFactory);
+
+    ShaderIncludeCache IncludeCache;
+
+    GLSLangUtils::SPIRVBatchCompileAttribs Attribs;
+    Attribs.pShaders      = Shaders.data();
+    Attribs.NumShaders    = static_cast<Uint32>(Shaders.size());
+    Attribs.pIncludeCache = &IncludeCache;
+
+    GLSLangUtils::SPIRVCompileStats Stats1;
+    Attribs.pStats = &Stats1;
+
+    const std::vector<std::vector<unsigned int>> SPIRVs1 = GLSLangUtils::CompileSPIRVBatch(Attribs);
+    EXPECT_EQ(Stats1.NumFileReads, Shaders.size() / 3);
+    EXPECT_EQ(IncludeCache.GetFileCount(), Shaders.size() / 3);
+
+    // The second batch does not read any files
+    GLSLangUtils::SPIRVCompileStats Stats2;
+    Attribs.pStats = &Stats2;
+
+    const std::vector<std::vector<unsigned int>> SPIRVs2 = GLSLangUtils::CompileSPIRVBatch(Attribs);
+    EXPECT_EQ(Stats2.NumFileReads, Uint32{0});
+    EXPECT_EQ(Stats2.NumFileCacheHits, Shaders.size());
+    EXPECT_EQ(SPIRVs1, SPIRVs2);
+}
+
+TEST_F(GLSLangUtilsTest, CompileSPIRVBatch_Errors)
+{
+    static constexpr char InvalidSource[] = "float4 main() : SV_Target { return undefined_variable; }";
+
+    ShaderCreateInfo ShaderCIs[2];
+    for (ShaderCreateInfo& ShaderCI : ShaderCIs)
+    {
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.Source         = InvalidSource;
+        ShaderCI.Desc           = {"Invalid shader", SHADER_TYPE_PIXEL};
+        ShaderCI.EntryPoint     = "main";
+    }
+    ShaderCIs[1].Source = "float4 main() : SV_Target { return float4(0, 0, 0, 0); }";
+
+    IDataBlob* pCompilerOutputs[2] = {};
+
+    GLSLangUtils::SPIRVBatchCompileAttribs Attribs;
+    Attribs.pShaders          = ShaderCIs;
+    Attribs.NumShaders        = _countof(ShaderCIs);
+    Attribs.ppCompilerOutputs = pCompilerOutputs;
+
+    std::vector<std::vector<unsigned int>> SPIRVs;
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to parse shader source"};
+        SPIRVs = GLSLangUtils::CompileSPIRVBatch(Attribs);
+    }
+    ASSERT_EQ(SPIRVs.size(), 2u);
+    EXPECT_TRUE(SPIRVs[0].empty());
+    EXPECT_NE(pCompilerOutputs[0], nullptr);
+    EXPECT_FALSE(SPIRVs[1].empty());
+    EXPECT_EQ(pCompilerOutputs[1], nullptr);
+
+    for (IDataBlob* pCompilerOutput : pCompilerOutputs)
+    {
+        if (pCompilerOutput != nullptr)
+            pCompilerOutput->Release();
+    }
+}
+
+} // namespace
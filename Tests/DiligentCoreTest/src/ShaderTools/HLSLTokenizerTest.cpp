@@ -0,0 +1,149 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "HLSLTokenizer.hpp"
+#include "EngineMemory.h"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Parsing;
+
+namespace
+{
+
+static constexpr char g_TestHLSL[] = R"(
+// Comment
+struct VSInput
+{
+    float3 Pos : ATTRIB0; /* Position */
+    float2 UV  : ATTRIB1;
+};
+
+Texture2D    g_Texture;
+SamplerState g_Texture_sampler;
+
+#define MACRO(x) ((x) * 2.0)
+
+float4 main(in VSInput VSIn) : SV_Target
+{
+    float4 Color = g_Texture.Sample(g_Texture_sampler, VSIn.UV);
+    for (int i = 0; i < 4; ++i)
+        Color.rgb += MACRO(0.125) * float(i);
+    return Color;
+}
+)";
+
+TEST(HLSLTokenizerTest, ArenaTokenize)
+{
+    HLSLTokenizer Tokenizer;
+
+    const auto HeapTokens = Tokenizer.Tokenize(g_TestHLSL);
+
+    HLSLTokenArena Arena{GetRawAllocator(), 256};
+
+    const auto ArenaTokens = Tokenizer.Tokenize(g_TestHLSL, Arena);
+    ASSERT_EQ(HeapTokens.size(), ArenaTokens.size());
+
+    auto ArenaIt = ArenaTokens.begin();
+    for (const auto& Token : HeapTokens)
+    {
+        EXPECT_EQ(Token.GetType(), ArenaIt->GetType());
+        EXPECT_EQ(Token.Literal, ArenaIt->Literal);
+        EXPECT_EQ(Token.Delimiter, ArenaIt->Delimiter);
+        ++ArenaIt;
+    }
+
+    EXPECT_EQ(BuildSource(HeapTokens), g_TestHLSL);
+    EXPECT_EQ(BuildSource(ArenaTokens), g_TestHLSL);
+}
+
+TEST(HLSLTokenizerTest, ArenaTokenListEdit)
+{
+    HLSLTokenizer  Tokenizer;
+    HLSLTokenArena Arena{GetRawAllocator(), 256};
+
+    auto Tokens = Tokenizer.Tokenize("float4 Color = float4(0.0, 0.0, 0.0, 1.0);", Arena);
+    ASSERT_FALSE(Tokens.empty());
+
+    const auto NumTokens = Tokens.size();
+
+    // Nodes released by the list must be reused by the following insertions
+    const HLSLTokenInfo* pFirstToken = &Tokens.front();
+    Tokens.pop_front();
+    Tokens.emplace_front(HLSLTokenType::kw_float4, "vec4", "");
+    EXPECT_EQ(&Tokens.front(), pFirstToken);
+    EXPECT_EQ(Tokens.size(), NumTokens);
+
+    auto It = std::find_if(Tokens.begin(), Tokens.end(), [](const HLSLTokenInfo& Token) { return Token.Literal == "Color"; });
+    ASSERT_NE(It, Tokens.end());
+    It->Literal.append("Out");
+    It = Tokens.erase(Tokens.begin(), It);
+    Tokens.insert(It, HLSLTokenInfo{HLSLTokenType::Identifier, "out", ""});
+
+    EXPECT_EQ(BuildSource(Tokens), "out ColorOut = float4(0.0, 0.0, 0.0, 1.0);");
+}
+
+TEST(HLSLTokenizerTest, TokenString)
+{
+    static constexpr char Text[] = "Texture2D";
+
+    HLSLTokenString Ref = HLSLTokenString::MakeReference(Text, sizeof(Text) - 1);
+    EXPECT_EQ(Ref.data(), Text);
+    EXPECT_EQ(Ref.length(), size_t{9});
+    EXPECT_EQ(Ref, "Texture2D");
+
+    // Copying a reference does not copy the text
+    HLSLTokenString Copy = Ref;
+    EXPECT_EQ(Copy.data(), Text);
+
+    // Modifying the string makes it own the text
+    Copy.append("Array");
+    EXPECT_NE(Copy.data(), Text);
+    EXPECT_EQ(Copy, "Texture2DArray");
+    EXPECT_EQ(Ref, "Texture2D");
+    EXPECT_EQ(Copy.c_str()[Copy.length()], '\0');
+
+    HLSLTokenString Copy2 = Copy;
+    EXPECT_NE(Copy2.data(), Copy.data());
+    EXPECT_EQ(Copy2, Copy);
+
+    HLSLTokenString Moved = std::move(Copy2);
+    EXPECT_EQ(Moved, "Texture2DArray");
+    EXPECT_TRUE(Copy2.empty());
+
+    Moved.pop_back();
+    Moved.push_back('Y');
+    EXPECT_EQ(Moved, String{"Texture2DArraY"});
+    EXPECT_EQ(Ref + "MS", "Texture2DMS");
+
+    Moved.clear();
+    EXPECT_TRUE(Moved.empty());
+    EXPECT_EQ(Moved, "");
+}
+
+} // namespace
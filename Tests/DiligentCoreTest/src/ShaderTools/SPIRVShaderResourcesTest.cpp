@@ -189,6 +189,74 @@ void CompileSPIRV(const char*                FilePath,
     ASSERT_FALSE(SPIRV.empty()) << "Failed to compile shader: " << FilePath;
 }
 
+// Verifies that the direct SPIR-V parser produces the same reflection as SPIRV-Cross
+void CompareWithSPIRVCross(const std::vector<unsigned int>& SPIRV, SHADER_TYPE ShaderType)
+{
+    SPIRVShaderResources::CreateInfo ResCI;
+    ResCI.ShaderType                  = ShaderType;
+    ResCI.Name                        = "SPIRVResources test";
+    ResCI.LoadShaderStageInputs       = true;
+    ResCI.LoadUniformBufferReflection = true;
+
+    std::string EntryPoint;
+    const SPIRVShaderResources Resources{GetRawAllocator(), SPIRV, ResCI, &EntryPoint};
+    EXPECT_FALSE(Resources.IsReflectedWithSPIRVCross());
+
+    ResCI.UseSPIRVCross = true;
+    std::string                CrossEntryPoint;
+    const SPIRVShaderResources CrossResources{GetRawAllocator(), SPIRV, ResCI, &CrossEntryPoint};
+    EXPECT_TRUE(CrossResources.IsReflectedWithSPIRVCross());
+
+    EXPECT_EQ(EntryPoint, CrossEntryPoint);
+    EXPECT_EQ(Resources.IsHLSLSource(), CrossResources.IsHLSLSource());
+    EXPECT_EQ(Resources.GetComputeGroupSize(), CrossResources.GetComputeGroupSize());
+
+    ASSERT_EQ(Resources.GetTotalResources(), CrossResources.GetTotalResources());
+    for (Uint32 i = 0; i < Resources.GetTotalResources(); ++i)
+    {
+        const SPIRVShaderResourceAttribs& Res      = Resources.GetResource(i);
+        const SPIRVShaderResourceAttribs& CrossRes = CrossResources.GetResource(i);
+        EXPECT_STREQ(Res.Name, CrossRes.Name);
+        EXPECT_EQ(Res.Type, CrossRes.Type) << Res.Name;
+        EXPECT_EQ(Res.ArraySize, CrossRes.ArraySize) << Res.Name;
+        EXPECT_EQ(Res.ResourceDim, CrossRes.ResourceDim) << Res.Name;
+        EXPECT_EQ(Res.IsMS, CrossRes.IsMS) << Res.Name;
+        EXPECT_EQ(Res.BindingDecorationOffset, CrossRes.BindingDecorationOffset) << Res.Name;
+        EXPECT_EQ(Res.DescriptorSetDecorationOffset, CrossRes.DescriptorSetDecorationOffset) << Res.Name;
+        EXPECT_EQ(Res.BufferStaticSize, CrossRes.BufferStaticSize) << Res.Name;
+        EXPECT_EQ(Res.BufferStride, CrossRes.BufferStride) << Res.Name;
+    }
+
+    for (Uint32 i = 0; i < Resources.GetNumUBs(); ++i)
+    {
+        const ShaderCodeBufferDesc* pDesc      = Resources.GetUniformBufferDesc(i);
+        const ShaderCodeBufferDesc* pCrossDesc = CrossResources.GetUniformBufferDesc(i);
+        ASSERT_NE(pDesc, nullptr);
+        ASSERT_NE(pCrossDesc, nullptr);
+        EXPECT_TRUE(*pDesc == *pCrossDesc) << Resources.GetUB(i).Name;
+    }
+
+    ASSERT_EQ(Resources.GetNumShaderStageInputs(), CrossResources.GetNumShaderStageInputs());
+    for (Uint32 i = 0; i < Resources.GetNumShaderStageInputs(); ++i)
+    {
+        const SPIRVShaderStageInputAttribs& Input      = Resources.GetShaderStageInputAttribs(i);
+        const SPIRVShaderStageInputAttribs& CrossInput = CrossResources.GetShaderStageInputAttribs(i);
+        EXPECT_STREQ(Input.Semantic, CrossInput.Semantic);
+        EXPECT_EQ(Input.LocationDecorationOffset, CrossInput.LocationDecorationOffset) << Input.Semantic;
+    }
+
+    ASSERT_EQ(Resources.GetNumSpecConstants(), CrossResources.GetNumSpecConstants());
+    for (Uint32 i = 0; i < Resources.GetNumSpecConstants(); ++i)
+    {
+        const SPIRVSpecializationConstantAttribs& Const      = Resources.GetSpecConstant(i);
+        const SPIRVSpecializationConstantAttribs& CrossConst = CrossResources.GetSpecConstant(i);
+        EXPECT_STREQ(Const.Name, CrossConst.Name);
+        EXPECT_EQ(Const.SpecId, CrossConst.SpecId) << Const.Name;
+        EXPECT_EQ(Const.Size, CrossConst.Size) << Const.Name;
+        EXPECT_EQ(Const.BasicType, CrossConst.BasicType) << Const.Name;
+    }
+}
+
 void TestSPIRVResources(const char*                                                  FilePath,
                         const std::vector<SPIRVShaderResourceRefAttribs>&            RefResources,
                         SHADER_COMPILER                                              Compiler,
@@ -259,6 +327,8 @@ void TestSPIRVResources(const char*
     }
 
     EXPECT_EQ(nullptr, Resources.GetResourceByName("NullResource"));
+
+    CompareWithSPIRVCross(SPIRV, ShaderType);
 }
 
 using SPIRVResourceType = SPIRVShaderResourceAttribs::ResourceType;
@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2026 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+
+#include "SPIRVTools.hpp"
+#include "GLSLangUtils.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class SPIRVToolsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+    }
+
+    static void TearDownTestSuite()
+    {
+        GLSLangUtils::FinalizeGlslang();
+    }
+};
+
+constexpr char TestComputeGLSL[] = R"(
+#version 450
+
+layout(local_size_x = 64) in;
+
+layout(std430, binding = 0) buffer DataBuffer
+{
+    vec4 g_Data[];
+};
+
+layout(std140, binding = 1) uniform Constants
+{
+    vec4 g_Scale;
+    uint g_Count;
+};
+
+void main()
+{
+    uint Idx = gl_GlobalInvocationID.x;
+    if (Idx >= g_Count)
+        return;
+
+    vec4 Value = g_Data[Idx];
+    for (int i = 0; i < 4; ++i)
+        Value = Value * g_Scale + vec4(float(i));
+    g_Data[Idx] = Value;
+}
+)";
+
+std::vector<uint32_t> CompileTestShader()
+{
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+    Attribs.ShaderType        = SHADER_TYPE_COMPUTE;
+    Attribs.ShaderSource      = TestComputeGLSL;
+    Attribs.SourceCodeLen     = static_cast<int>(sizeof(TestComputeGLSL) - 1);
+    Attribs.OptimizationLevel = SHADER_OPTIMIZATION_LEVEL_DISABLED;
+    return GLSLangUtils::GLSLtoSPIRV(Attribs);
+}
+
+// Optimizing the same module repeatedly on one thread must always produce the same result.
+TEST_F(SPIRVToolsTest, OptimizeSPIRV_Repeated)
+{
+    const std::vector<uint32_t> SrcSPIRV = CompileTestShader();
+    ASSERT_FALSE(SrcSPIRV.empty());
+
+    constexpr SPIRV_OPTIMIZATION_FLAGS PassesList[] = {
+        SPIRV_OPTIMIZATION_FLAG_LEGALIZATION,
+        SPIRV_OPTIMIZATION_FLAG_PERFORMANCE,
+        SPIRV_OPTIMIZATION_FLAG_LEGALIZATION | SPIRV_OPTIMIZATION_FLAG_PERFORMANCE,
+        SPIRV_OPTIMIZATION_FLAG_LEGALIZATION | SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION,
+    };
+    for (SPIRV_OPTIMIZATION_FLAGS Passes : PassesList)
+    {
+        const std::vector<uint32_t> ColdSPIRV = OptimizeSPIRV(SrcSPIRV, Passes);
+        ASSERT_FALSE(ColdSPIRV.empty()) << "Passes: " << Passes;
+
+        const std::vector<uint32_t> SPIRV1 = OptimizeSPIRV(SrcSPIRV, Passes);
+        const std::vector<uint32_t> SPIRV2 = OptimizeSPIRV(SrcSPIRV, Passes);
+        EXPECT_EQ(SPIRV1, ColdSPIRV) << "Passes: " << Passes;
+        EXPECT_EQ(SPIRV2, ColdSPIRV) << "Passes: " << Passes;
+    }
+}
+
+} // namespace
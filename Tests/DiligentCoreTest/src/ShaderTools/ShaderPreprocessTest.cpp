@@ -29,6 +29,9 @@
 #include "ShaderToolsCommon.hpp"
 #include "DefaultShaderSourceStreamFactory.h"
 #include "RenderDevice.h"
+#include "FileSystem.hpp"
+#include "FileWrapper.hpp"
+#include "TempDirectory.hpp"
 #include "TestingEnvironment.hpp"
 
 #include "gtest/gtest.h"
@@ -194,6 +197,122 @@ TEST(ShaderPreprocessTest, UnrollIncludes)
     }
 }
 
+static std::vector<std::string> GetProcessedFiles(const ShaderCreateInfo& ShaderCI, ShaderIncludeCache* pCache)
+{
+    std::vector<std::string> Files;
+
+    const bool Result = ProcessShaderIncludes(
+        ShaderCI, [&](const ShaderIncludePreprocessInfo& ProcessInfo) {
+            Files.emplace_back(ProcessInfo.FilePath);
+            Files.back() += ':';
+            Files.back().append(ProcessInfo.Source, ProcessInfo.SourceLength);
+        },
+        pCache);
+    EXPECT_TRUE(Result);
+
+    return Files;
+}
+
+TEST(ShaderPreprocessTest, IncludeCache)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/ShaderPreprocessor", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderIncludeCache Cache;
+    for (const char* FilePath : {"IncludeBasicTest.hlsl", "InlineIncludeShaderTest.hlsl"})
+    {
+        ShaderCreateInfo ShaderCI{};
+        ShaderCI.Desc.Name                  = "TestShader";
+        ShaderCI.FilePath                   = FilePath;
+        ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+        const std::vector<std::string> RefFiles = GetProcessedFiles(ShaderCI, nullptr);
+
+        // The result must not depend on whether the cache is used
+        EXPECT_EQ(GetProcessedFiles(ShaderCI, &Cache), RefFiles);
+        const Uint64 NumMisses = Cache.GetMissCount();
+        EXPECT_EQ(GetProcessedFiles(ShaderCI, &Cache), RefFiles);
+        EXPECT_EQ(Cache.GetMissCount(), NumMisses);
+
+        EXPECT_EQ(UnrollShaderIncludes(ShaderCI, &Cache), UnrollShaderIncludes(ShaderCI));
+        EXPECT_EQ(Cache.GetMissCount(), NumMisses);
+    }
+    // IncludeBasicTest.hlsl, IncludeCommon0.hlsl, IncludeCommon1.hlsl,
+    // InlineIncludeShaderTest.hlsl and three common files
+    EXPECT_EQ(Cache.GetFileCount(), size_t{7});
+    EXPECT_EQ(Cache.GetMissCount(), Uint64{7});
+
+    // Source string with include directives
+    {
+        ShaderCreateInfo ShaderCI{};
+        ShaderCI.Desc.Name                  = "TestShader";
+        ShaderCI.Source                     = "#include \"IncludeCommon0.hlsl\"\n";
+        ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+        EXPECT_EQ(GetProcessedFiles(ShaderCI, &Cache), GetProcessedFiles(ShaderCI, nullptr));
+        EXPECT_EQ(Cache.GetMissCount(), Uint64{7});
+    }
+
+    // Parse errors are cached along with the file
+    {
+        ShaderCreateInfo ShaderCI{};
+        ShaderCI.Desc.Name                  = "TestShader";
+        ShaderCI.FilePath                   = "IncludeInvalidCase0.hlsl";
+        ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"Failed to process includes in file 'IncludeInvalidCase0.hlsl'",
+                                                      "Failed to process includes in file 'IncludeInvalidCase0.hlsl'"};
+        EXPECT_FALSE(ProcessShaderIncludes(ShaderCI, {}, &Cache));
+        EXPECT_FALSE(ProcessShaderIncludes(ShaderCI, {}, &Cache));
+        EXPECT_EQ(Cache.GetMissCount(), Uint64{8});
+    }
+
+    Cache.Clear();
+    EXPECT_EQ(Cache.GetFileCount(), size_t{0});
+}
+
+TEST(ShaderPreprocessTest, IncludeCacheInvalidation)
+{
+    TempDirectory      TmpDir;
+    const std::string& TmpDirPath = TmpDir.Get();
+
+    auto WriteFile = [&](const char* Name, const std::string& Source) {
+        const std::string Path = TmpDirPath + FileSystem::SlashSymbol + Name;
+        FileWrapper       File{Path.c_str(), EFileAccessMode::Overwrite};
+        ASSERT_TRUE(File);
+        EXPECT_TRUE(File->Write(Source.data(), Source.size()));
+    };
+
+    WriteFile("Main.hlsl", "#include \"Common.hlsl\"\nvoid main() {}\n");
+    WriteFile("Common.hlsl", "float4 f;\n");
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateDefaultShaderSourceStreamFactory(TmpDirPath.c_str(), &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI{};
+    ShaderCI.Desc.Name                  = "TestShader";
+    ShaderCI.FilePath                   = "Main.hlsl";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceFactory;
+
+    ShaderIncludeCache Cache;
+    EXPECT_EQ(UnrollShaderIncludes(ShaderCI, &Cache), "float4 f;\n\nvoid main() {}\n");
+    EXPECT_EQ(Cache.GetFileCount(), size_t{2});
+
+    // Modify the included file. The size changes, so the stale entry is detected
+    // even if the file system has a coarse modification time resolution.
+    WriteFile("Common.hlsl", "float4 f;\nfloat4 g;\n");
+    EXPECT_EQ(UnrollShaderIncludes(ShaderCI, &Cache), "float4 f;\nfloat4 g;\n\nvoid main() {}\n");
+    EXPECT_EQ(Cache.GetFileCount(), size_t{2});
+    EXPECT_EQ(Cache.GetMissCount(), Uint64{3});
+
+    // Add a new include to the main file
+    WriteFile("Common2.hlsl", "float4 h;\n");
+    WriteFile("Main.hlsl", "#include \"Common.hlsl\"\n#include \"Common2.hlsl\"\nvoid main() {}\n");
+    EXPECT_EQ(UnrollShaderIncludes(ShaderCI, &Cache), UnrollShaderIncludes(ShaderCI));
+    EXPECT_EQ(Cache.GetFileCount(), size_t{3});
+}
+
 TEST(ShaderPreprocessTest, ShaderSourceLanguageDefiniton)
 {
     EXPECT_EQ(ParseShaderSourceLanguageDefinition(""), SHADER_SOURCE_LANGUAGE_DEFAULT);
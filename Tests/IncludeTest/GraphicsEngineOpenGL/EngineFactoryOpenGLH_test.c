@@ -44,6 +44,7 @@ void TestEngineFactoryGL_CInterface()
     IEngineFactoryOpenGL_CreateDeviceAndSwapChainGL(pFactory, &EngineCI, (IRenderDevice**)NULL, (IDeviceContext**)NULL, (SwapChainDesc*)NULL, (ISwapChain**)NULL);
 
     IEngineFactoryOpenGL_CreateHLSL2GLSLConverter(pFactory, (IHLSL2GLSLConverter**)NULL);
+    IEngineFactoryOpenGL_CreateHLSL2GLSLConversionCache(pFactory, (IHLSL2GLSLConversionCache**)NULL);
 
     IEngineFactoryOpenGL_AttachToActiveGLContext(pFactory, (EngineGLCreateInfo*)NULL, (IRenderDevice**)NULL, (IDeviceContext**)NULL);
 }